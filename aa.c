@@ -0,0 +1,161 @@
+#include <string.h>
+
+#include "aa.h"
+
+const char *const aa_mode_names[AA_MODE_COUNT] = {
+    "none", "fxaa", "msaa2", "msaa4", "msaa8"
+};
+
+/* FXAA in the compact form of Lottes' original: blur along the local
+ * edge direction found from the luma of the four diagonal neighbors,
+ * falling back to the shorter blur where the longer one overshoots.
+ * Coordinates are clamped to the rendered region, which may be
+ * smaller than the texture.
+ */
+static const struct shader_source FXAA_SHADER = {
+    .name = "fxaa",
+    .vert =
+        "void main() {\n"
+        "    vec2 p = vec2(gl_VertexID & 1, gl_VertexID >> 1) * 4 - 1;\n"
+        "    gl_Position = vec4(p, 0, 1);\n"
+        "}\n",
+    .frag =
+        "uniform sampler2D scene;\n"
+        "uniform vec2 limit;\n"
+        "out vec4 fragment;\n"
+        "const vec3 LUMA = vec3(0.299, 0.587, 0.114);\n"
+        "const float REDUCE_MIN = 1.0 / 128;\n"
+        "const float REDUCE_MUL = 1.0 / 8;\n"
+        "const float SPAN_MAX = 8;\n"
+        "vec3 fetch(vec2 p) {\n"
+        "    vec2 size = vec2(textureSize(scene, 0));\n"
+        "    return texture(scene, min(p, limit) / size).rgb;\n"
+        "}\n"
+        "void main() {\n"
+        "    vec2 p = gl_FragCoord.xy;\n"
+        "    float nw = dot(fetch(p + vec2(-1, -1)), LUMA);\n"
+        "    float ne = dot(fetch(p + vec2(1, -1)), LUMA);\n"
+        "    float sw = dot(fetch(p + vec2(-1, 1)), LUMA);\n"
+        "    float se = dot(fetch(p + vec2(1, 1)), LUMA);\n"
+        "    vec3 middle = fetch(p);\n"
+        "    float m = dot(middle, LUMA);\n"
+        "    float lo = min(m, min(min(nw, ne), min(sw, se)));\n"
+        "    float hi = max(m, max(max(nw, ne), max(sw, se)));\n"
+        "    vec2 dir = vec2((sw + se) - (nw + ne),\n"
+        "                    (nw + sw) - (ne + se));\n"
+        "    float reduce = max((nw + ne + sw + se) * 0.25 * REDUCE_MUL,\n"
+        "                       REDUCE_MIN);\n"
+        "    float rcp = 1 / (min(abs(dir.x), abs(dir.y)) + reduce);\n"
+        "    dir = clamp(dir * rcp, -SPAN_MAX, SPAN_MAX);\n"
+        "    vec3 a = 0.5 * (fetch(p + dir * (1.0 / 3 - 0.5)) +\n"
+        "                    fetch(p + dir * (2.0 / 3 - 0.5)));\n"
+        "    vec3 b = 0.5 * a + 0.25 * (fetch(p - dir * 0.5) +\n"
+        "                               fetch(p + dir * 0.5));\n"
+        "    float lb = dot(b, LUMA);\n"
+        "    fragment = vec4(lb < lo || lb > hi ? a : b, 1);\n"
+        "}\n",
+};
+
+int
+aa_parse(const char *name)
+{
+    for (int i = 0; i < AA_MODE_COUNT; i++)
+        if (!strcmp(name, aa_mode_names[i]))
+            return i;
+    return -1;
+}
+
+void
+aa_init(struct aa *aa, enum aa_mode mode)
+{
+    memset(aa, 0, sizeof(*aa));
+    aa->mode = mode;
+    glGenQueries(AA_SLOTS * 3, aa->queries[0]);
+    if (mode == AA_FXAA) {
+        shader_set_init(&aa->shaders, &FXAA_SHADER);
+        aa->program = shader_variant(&aa->shaders, 0);
+        aa->uniform_limit = glGetUniformLocation(aa->program, "limit");
+        glGenVertexArrays(1, &aa->vao);
+    } else if (mode != AA_NONE) {
+        GLint max = 0;
+        glGetIntegerv(GL_MAX_SAMPLES, &max);
+        aa->samples = mode == AA_MSAA2 ? 2 : mode == AA_MSAA4 ? 4 : 8;
+        if (aa->samples > max)
+            aa->samples = max;
+    }
+}
+
+static void
+poll(struct aa *aa)
+{
+    for (unsigned i = 1; i <= AA_SLOTS; i++) {
+        unsigned slot = (aa->next + AA_SLOTS - i) % AA_SLOTS;
+        if (!aa->pending[slot])
+            continue;
+        GLuint available = 0;
+        glGetQueryObjectuiv(aa->queries[slot][2], GL_QUERY_RESULT_AVAILABLE,
+                            &available);
+        if (!available)
+            continue;
+        GLuint64 t[3];
+        for (int j = 0; j < 3; j++)
+            glGetQueryObjectui64v(aa->queries[slot][j], GL_QUERY_RESULT,
+                                  t + j);
+        aa->scene_ms = (t[1] - t[0]) / 1e6;
+        aa->resolve_ms = (t[2] - t[1]) / 1e6;
+        /* Older sets are stale: recycle them unread */
+        for (unsigned j = i; j <= AA_SLOTS; j++)
+            aa->pending[(aa->next + AA_SLOTS - j) % AA_SLOTS] = 0;
+        return;
+    }
+}
+
+void
+aa_begin(struct aa *aa, int width, int height)
+{
+    poll(aa);
+    aa->view[0] = width;
+    aa->view[1] = height;
+    if (!aa->pending[aa->next])
+        glQueryCounter(aa->queries[aa->next][0], GL_TIMESTAMP);
+}
+
+void
+aa_resolve(struct aa *aa, GLuint src, GLuint texture)
+{
+    int timed = !aa->pending[aa->next];
+    if (timed)
+        glQueryCounter(aa->queries[aa->next][1], GL_TIMESTAMP);
+    if (aa->mode == AA_FXAA) {
+        glUseProgram(aa->program);
+        glUniform2f(aa->uniform_limit, aa->view[0] - 0.5f,
+                    aa->view[1] - 0.5f);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glBindVertexArray(aa->vao);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        glBindVertexArray(0);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glUseProgram(0);
+    } else if (aa->mode != AA_NONE) {
+        /* A multisample resolve needs matching rectangles */
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, src);
+        glBlitFramebuffer(0, 0, aa->view[0], aa->view[1],
+                          0, 0, aa->view[0], aa->view[1],
+                          GL_COLOR_BUFFER_BIT, GL_NEAREST);
+    }
+    if (timed) {
+        glQueryCounter(aa->queries[aa->next][2], GL_TIMESTAMP);
+        aa->pending[aa->next] = 1;
+        aa->next = (aa->next + 1) % AA_SLOTS;
+    }
+}
+
+void
+aa_free(struct aa *aa)
+{
+    glDeleteQueries(AA_SLOTS * 3, aa->queries[0]);
+    if (aa->mode == AA_FXAA) {
+        glDeleteVertexArrays(1, &aa->vao);
+        shader_set_free(&aa->shaders);
+    }
+}
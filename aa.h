@@ -0,0 +1,61 @@
+#ifndef AA_H
+#define AA_H
+
+#include <GL/gl3w.h>
+
+#include "shader.h"
+
+#define AA_SLOTS 4  /* timestamp sets in flight */
+
+enum aa_mode {
+    AA_NONE,
+    AA_FXAA,
+    AA_MSAA2,
+    AA_MSAA4,
+    AA_MSAA8,
+    AA_MODE_COUNT
+};
+
+/* Anti-aliasing of the scene. The caller renders the scene into a
+ * target with aa.samples samples. MSAA modes resolve it with an
+ * explicit glBlitFramebuffer; FXAA filters the single-sampled texture
+ * with one fullscreen pass. AA_NONE renders straight into the
+ * destination. Three timestamps per frame split the cost into the
+ * scene and its resolve. They're read back once available, so
+ * reporting never stalls.
+ */
+struct aa {
+    enum aa_mode mode;
+    int samples;          /* for the scene, after the driver limit */
+    int view[2];          /* region rendered this frame */
+    GLuint vao;           /* attribute-less, for the fullscreen pass */
+    struct shader_set shaders;
+    GLuint program;
+    GLint uniform_limit;
+    GLuint queries[AA_SLOTS][3];
+    int pending[AA_SLOTS];
+    unsigned next;
+    double scene_ms;      /* newest available timings */
+    double resolve_ms;
+};
+
+extern const char *const aa_mode_names[AA_MODE_COUNT];
+
+/* Returns the mode named name, or -1. */
+int aa_parse(const char *name);
+
+void aa_init(struct aa *, enum aa_mode);
+
+/* Starts timing a scene of width by height pixels. */
+void aa_begin(struct aa *, int width, int height);
+
+/* Ends the scene's timing and resolves it from framebuffer src, or
+ * texture for FXAA, into the same region of the draw framebuffer.
+ * Under AA_NONE there is nothing to resolve, so call it once the
+ * scene is drawn, with no source, just to end the timing.
+ */
+void aa_resolve(struct aa *, GLuint src, GLuint texture);
+
+void aa_free(struct aa *);
+
+#endif
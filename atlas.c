@@ -0,0 +1,302 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#include "atlas.h"
+
+#define PADDING 1  /* empty texels between regions against bleeding */
+
+static void
+page_reset(struct atlas_page *page, int size)
+{
+    page->skyline[0].x = 0;
+    page->skyline[0].y = 0;
+    page->skyline[0].w = size;
+    page->len = 1;
+    page->hole_count = 0;
+    page->live = 0;
+    page->used = 0;
+}
+
+void
+atlas_init(struct atlas *atlas, int size, int pages)
+{
+    memset(atlas, 0, sizeof(*atlas));
+    atlas->size = size;
+    atlas->page_count = pages;
+    atlas->pages = calloc(pages, sizeof(*atlas->pages));
+    if (!atlas->pages) {
+        fprintf(stderr, "error: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < pages; i++) {
+        /* Every skyline segment is at least a texel wide */
+        atlas->pages[i].skyline = malloc(size * sizeof(struct atlas_skyline));
+        if (!atlas->pages[i].skyline) {
+            fprintf(stderr, "error: out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+        page_reset(atlas->pages + i, size);
+    }
+
+    glGenTextures(1, &atlas->texture);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, atlas->texture);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, size, size, pages, 0,
+                 GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+    glGenBuffers(ATLAS_PBO_COUNT, atlas->pbos);
+    for (int i = 0; i < ATLAS_PBO_COUNT; i++) {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, atlas->pbos[i]);
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, ATLAS_PBO_SIZE, NULL,
+                     GL_STREAM_DRAW);
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+/* Height at which a w wide rectangle rests when its left edge is at
+ * skyline segment i, or INT_MAX if it runs off the right edge.
+ */
+static int
+skyline_fit(const struct atlas_page *page, int i, int w, int size)
+{
+    int x = page->skyline[i].x;
+    if (x + w > size)
+        return INT_MAX;
+    int y = 0;
+    for (int left = w; left > 0; i++) {
+        if (page->skyline[i].y > y)
+            y = page->skyline[i].y;
+        left -= page->skyline[i].w;
+    }
+    return y;
+}
+
+static int
+skyline_insert(struct atlas_page *page, int w, int h, int size,
+               int *rx, int *ry)
+{
+    int best = -1;
+    int best_y = INT_MAX;
+    for (int i = 0; i < page->len; i++) {
+        int y = skyline_fit(page, i, w, size);
+        if (y != INT_MAX && y <= size - h && y < best_y) {
+            best = i;
+            best_y = y;
+        }
+    }
+    if (best < 0)
+        return -1;
+
+    /* Raise a new segment over the rectangle and cut those under it */
+    struct atlas_skyline *s = page->skyline;
+    int x = s[best].x;
+    memmove(s + best + 1, s + best, (page->len - best) * sizeof(*s));
+    page->len++;
+    s[best].x = x;
+    s[best].y = best_y + h;
+    s[best].w = w;
+    for (int i = best + 1; i < page->len; i++) {
+        int cut = x + w - s[i].x;
+        if (cut <= 0)
+            break;
+        if (cut < s[i].w) {
+            s[i].x += cut;
+            s[i].w -= cut;
+            break;
+        }
+        memmove(s + i, s + i + 1, (page->len - i - 1) * sizeof(*s));
+        page->len--;
+        i--;
+    }
+    for (int i = 0; i + 1 < page->len; i++) {
+        if (s[i].y == s[i + 1].y) {
+            s[i].w += s[i + 1].w;
+            memmove(s + i + 1, s + i + 2, (page->len - i - 2) * sizeof(*s));
+            page->len--;
+            i--;
+        }
+    }
+    *rx = x;
+    *ry = best_y;
+    return 0;
+}
+
+static void
+add_hole(struct atlas_page *page, int x, int y, int w, int h)
+{
+    if (w <= PADDING || h <= PADDING)
+        return;  /* too thin to hold anything */
+    if (page->hole_count == page->hole_cap) {
+        int cap = page->hole_cap ? page->hole_cap * 2 : 16;
+        struct atlas_rect *holes = realloc(page->holes,
+                                           cap * sizeof(*holes));
+        if (!holes)
+            return;  /* the space is lost until the page resets */
+        page->holes = holes;
+        page->hole_cap = cap;
+    }
+    struct atlas_rect r = {x, y, w, h};
+    page->holes[page->hole_count++] = r;
+}
+
+/* Places a w by h rectangle in the smallest hole that fits it. The
+ * rest of the hole is cut into the strip to its right, as tall as the
+ * rectangle, and the strip above it, as wide as the hole.
+ */
+static int
+hole_insert(struct atlas_page *page, int w, int h, int *rx, int *ry)
+{
+    int best = -1;
+    long best_area = 0;
+    for (int i = 0; i < page->hole_count; i++) {
+        struct atlas_rect *r = page->holes + i;
+        long area = (long) r->w * r->h;
+        if (r->w >= w && r->h >= h && (best < 0 || area < best_area)) {
+            best = i;
+            best_area = area;
+        }
+    }
+    if (best < 0)
+        return -1;
+    struct atlas_rect r = page->holes[best];
+    page->holes[best] = page->holes[--page->hole_count];
+    add_hole(page, r.x + w, r.y, r.w - w, h);
+    add_hole(page, r.x, r.y + h, r.w, r.h - h);
+    *rx = r.x;
+    *ry = r.y;
+    return 0;
+}
+
+/* Returns where in the ring to stage size bytes, moving to the next
+ * buffer when the current one is full.
+ */
+static size_t
+stage(struct atlas *atlas, size_t size)
+{
+    if (atlas->pbo_offset + size > ATLAS_PBO_SIZE) {
+        int i = atlas->pbo;
+        atlas->fences[i] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        i = (i + 1) % ATLAS_PBO_COUNT;
+        if (atlas->fences[i]) {
+            glClientWaitSync(atlas->fences[i], GL_SYNC_FLUSH_COMMANDS_BIT,
+                             UINT64_MAX);
+            glDeleteSync(atlas->fences[i]);
+            atlas->fences[i] = 0;
+        }
+        atlas->pbo = i;
+        atlas->pbo_offset = 0;
+    }
+    size_t offset = atlas->pbo_offset;
+    atlas->pbo_offset += (size + 15) & ~(size_t) 15;
+    return offset;
+}
+
+static void
+upload(struct atlas *atlas, const struct atlas_region *r, const void *pixels)
+{
+    size_t size = (size_t) r->w * r->h * 4;
+    glBindTexture(GL_TEXTURE_2D_ARRAY, atlas->texture);
+    if (size > ATLAS_PBO_SIZE) {
+        glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, r->x, r->y, r->page,
+                        r->w, r->h, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    } else {
+        size_t offset = stage(atlas, size);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, atlas->pbos[atlas->pbo]);
+        /* The fence guarantees nothing still reads this range */
+        void *p = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, offset, size,
+                                   GL_MAP_WRITE_BIT |
+                                   GL_MAP_UNSYNCHRONIZED_BIT |
+                                   GL_MAP_INVALIDATE_RANGE_BIT);
+        if (p) {
+            memcpy(p, pixels, size);
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+            glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, r->x, r->y, r->page,
+                            r->w, r->h, 1, GL_RGBA, GL_UNSIGNED_BYTE,
+                            (void *) offset);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        } else {
+            /* Copy straight from memory, as for oversized images */
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, r->x, r->y, r->page,
+                            r->w, r->h, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+        }
+    }
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+}
+
+int
+atlas_insert(struct atlas *atlas, int w, int h, const void *pixels,
+             struct atlas_region *region)
+{
+    for (int i = 0; i < atlas->page_count; i++) {
+        struct atlas_page *page = atlas->pages + i;
+        int x, y;
+        if (!hole_insert(page, w + PADDING, h + PADDING, &x, &y) ||
+            !skyline_insert(page, w + PADDING, h + PADDING, atlas->size,
+                            &x, &y)) {
+            page->live++;
+            page->used += (long) w * h;
+            region->x = x;
+            region->y = y;
+            region->w = w;
+            region->h = h;
+            region->page = i;
+            upload(atlas, region, pixels);
+            return 0;
+        }
+    }
+    return -1;
+}
+
+void
+atlas_remove(struct atlas *atlas, const struct atlas_region *region)
+{
+    struct atlas_page *page = atlas->pages + region->page;
+    page->used -= (long) region->w * region->h;
+    if (!--page->live)
+        page_reset(page, atlas->size);
+    else
+        add_hole(page, region->x, region->y, region->w + PADDING,
+                 region->h + PADDING);
+}
+
+void
+atlas_uv(const struct atlas *atlas, const struct atlas_region *region,
+         float uv[4])
+{
+    float scale = 1.0f / atlas->size;
+    uv[0] = region->x * scale;
+    uv[1] = region->y * scale;
+    uv[2] = (region->x + region->w) * scale;
+    uv[3] = (region->y + region->h) * scale;
+}
+
+double
+atlas_usage(const struct atlas *atlas)
+{
+    long used = 0;
+    for (int i = 0; i < atlas->page_count; i++)
+        used += atlas->pages[i].used;
+    return used / ((double) atlas->size * atlas->size * atlas->page_count);
+}
+
+void
+atlas_free(struct atlas *atlas)
+{
+    for (int i = 0; i < ATLAS_PBO_COUNT; i++)
+        if (atlas->fences[i])
+            glDeleteSync(atlas->fences[i]);
+    glDeleteBuffers(ATLAS_PBO_COUNT, atlas->pbos);
+    glDeleteTextures(1, &atlas->texture);
+    for (int i = 0; i < atlas->page_count; i++) {
+        free(atlas->pages[i].skyline);
+        free(atlas->pages[i].holes);
+    }
+    free(atlas->pages);
+}
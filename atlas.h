@@ -0,0 +1,76 @@
+#ifndef ATLAS_H
+#define ATLAS_H
+
+#include <stddef.h>
+#include <GL/gl3w.h>
+
+#define ATLAS_PBO_COUNT 3
+#define ATLAS_PBO_SIZE  (1 << 20)
+
+/* A rectangle allocated in one atlas page. */
+struct atlas_region {
+    int x, y, w, h;
+    int page;
+};
+
+struct atlas_skyline {
+    int x, y, w;
+};
+
+struct atlas_rect {
+    int x, y, w, h;
+};
+
+struct atlas_page {
+    struct atlas_skyline *skyline;
+    int len;
+    struct atlas_rect *holes;  /* space freed by removed regions */
+    int hole_count;
+    int hole_cap;
+    int live;       /* regions allocated and not yet removed */
+    long used;      /* pixels in live regions */
+};
+
+/* RGBA8 images packed into the layers of one GL_TEXTURE_2D_ARRAY, so
+ * every image in the atlas can be drawn without changing textures.
+ * Each page is packed bottom-left with a skyline. A removed region's
+ * space becomes a hole that later inserts fill before the skyline,
+ * taking the smallest hole that fits and keeping what's left of it as
+ * up to two smaller holes. Holes aren't merged, so a page only fully
+ * recovers when its last region is removed and it starts over empty.
+ *
+ * Pixels are staged through a ring of pixel unpack buffers and copied
+ * with glTexSubImage3D, so inserts return without waiting on the
+ * copy. A buffer is fenced when the ring moves past it and waited on,
+ * normally long since signaled, before it's written again.
+ */
+struct atlas {
+    GLuint texture;
+    int size;       /* pages are size by size */
+    int page_count;
+    struct atlas_page *pages;
+    GLuint pbos[ATLAS_PBO_COUNT];
+    GLsync fences[ATLAS_PBO_COUNT];
+    int pbo;        /* buffer being filled */
+    size_t pbo_offset;
+};
+
+void atlas_init(struct atlas *, int size, int pages);
+
+/* Copies a w by h RGBA8 image into the atlas. Returns 0, or -1 when no
+ * page has room.
+ */
+int atlas_insert(struct atlas *, int w, int h, const void *pixels,
+                 struct atlas_region *);
+void atlas_remove(struct atlas *, const struct atlas_region *);
+
+/* Region's texture coordinates: u0, v0, u1, v1. */
+void atlas_uv(const struct atlas *, const struct atlas_region *,
+              float uv[4]);
+
+/* Fraction of all pages covered by live regions. */
+double atlas_usage(const struct atlas *);
+
+void atlas_free(struct atlas *);
+
+#endif
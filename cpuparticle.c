@@ -0,0 +1,323 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define LANES 8
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define LANES 4
+#else
+#define LANES 1
+#endif
+
+#include "cpuparticle.h"
+#include "jobs.h"
+
+#define CHUNK 16384  /* particles per task, a multiple of LANES */
+
+struct step_job {
+    struct cpu_particles *cp;
+    float dt;
+    float emitter[2];
+    uint32_t seed;
+    float *xy;       /* output slot: interleaved positions, then ages */
+    float *age;
+};
+
+/* The update shader's hash, so both simulations launch alike. */
+static float
+random01(uint32_t x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x / 4294967296.0f;
+}
+
+static void
+respawn(struct cpu_particles *cp, size_t i, float a,
+        const struct step_job *job)
+{
+    uint32_t id = (uint32_t) i * 2 + job->seed * 0x9e3779b9u;
+    float angle = (random01(id) - 0.5f) * 0.6f;
+    float speed = 1.4f + 0.5f * random01(id + 1);
+    cp->x[i] = job->emitter[0];
+    cp->y[i] = job->emitter[1];
+    cp->vx[i] = speed * sinf(angle);
+    cp->vy[i] = speed * cosf(angle);
+    cp->age[i] = fmodf(a, PARTICLE_LIFETIME);
+}
+
+static void
+step(struct cpu_particles *cp, size_t i, const struct step_job *job)
+{
+    float dt = job->dt;
+    float age = cp->age[i];
+    float a = age + dt;
+    if (a >= PARTICLE_LIFETIME || (age < 0 && a >= 0)) {
+        respawn(cp, i, a, job);
+        return;
+    }
+    cp->age[i] = a;
+    if (a < 0)
+        return;
+    cp->vy[i] += PARTICLE_GRAVITY * dt;
+    cp->x[i] += cp->vx[i] * dt;
+    cp->y[i] += cp->vy[i] * dt;
+    if (cp->y[i] < PARTICLE_FLOOR) {
+        cp->y[i] = 2 * PARTICLE_FLOOR - cp->y[i];
+        cp->vy[i] *= -PARTICLE_BOUNCE;
+    }
+}
+
+static void
+step_chunk(void *arg, size_t chunk)
+{
+    const struct step_job *job = arg;
+    struct cpu_particles *cp = job->cp;
+    size_t begin = chunk * CHUNK;
+    size_t end = begin + CHUNK < cp->count ? begin + CHUNK : cp->count;
+    size_t i = begin;
+#if LANES == 8
+    __m256 dt = _mm256_set1_ps(job->dt);
+    __m256 zero = _mm256_setzero_ps();
+    __m256 lifetime = _mm256_set1_ps(PARTICLE_LIFETIME);
+    __m256 gdt = _mm256_set1_ps(PARTICLE_GRAVITY * job->dt);
+    __m256 ground = _mm256_set1_ps(PARTICLE_FLOOR);
+    __m256 bounce = _mm256_set1_ps(-PARTICLE_BOUNCE);
+    for (; i + 8 <= end; i += 8) {
+        __m256 age = _mm256_loadu_ps(cp->age + i);
+        __m256 a = _mm256_add_ps(age, dt);
+        __m256 born = _mm256_cmp_ps(a, zero, _CMP_GE_OQ);
+        __m256 spawn = _mm256_or_ps(
+            _mm256_cmp_ps(a, lifetime, _CMP_GE_OQ),
+            _mm256_and_ps(born, _mm256_cmp_ps(age, zero, _CMP_LT_OQ)));
+        __m256 live = _mm256_andnot_ps(spawn, born);
+        __m256 x = _mm256_loadu_ps(cp->x + i);
+        __m256 y = _mm256_loadu_ps(cp->y + i);
+        __m256 vx = _mm256_loadu_ps(cp->vx + i);
+        __m256 vy = _mm256_loadu_ps(cp->vy + i);
+        __m256 nvy = _mm256_add_ps(vy, gdt);
+        __m256 nx = _mm256_add_ps(x, _mm256_mul_ps(vx, dt));
+        __m256 ny = _mm256_add_ps(y, _mm256_mul_ps(nvy, dt));
+        __m256 hit = _mm256_cmp_ps(ny, ground, _CMP_LT_OQ);
+        ny = _mm256_blendv_ps(ny, _mm256_sub_ps(_mm256_add_ps(ground, ground),
+                                                ny), hit);
+        nvy = _mm256_blendv_ps(nvy, _mm256_mul_ps(nvy, bounce), hit);
+        x = _mm256_blendv_ps(x, nx, live);
+        y = _mm256_blendv_ps(y, ny, live);
+        vy = _mm256_blendv_ps(vy, nvy, live);
+        _mm256_storeu_ps(cp->x + i, x);
+        _mm256_storeu_ps(cp->y + i, y);
+        _mm256_storeu_ps(cp->vy + i, vy);
+        _mm256_storeu_ps(cp->age + i, a);
+        int mask = _mm256_movemask_ps(spawn);
+        if (mask) {
+            for (int lane = 0; lane < 8; lane++)
+                if (mask >> lane & 1)
+                    respawn(cp, i + lane, cp->age[i + lane], job);
+            x = _mm256_loadu_ps(cp->x + i);
+            y = _mm256_loadu_ps(cp->y + i);
+            a = _mm256_loadu_ps(cp->age + i);
+        }
+        __m256 lo = _mm256_unpacklo_ps(x, y);
+        __m256 hi = _mm256_unpackhi_ps(x, y);
+        _mm256_storeu_ps(job->xy + i * 2,
+                         _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_storeu_ps(job->xy + i * 2 + 8,
+                         _mm256_permute2f128_ps(lo, hi, 0x31));
+        _mm256_storeu_ps(job->age + i, a);
+    }
+#elif LANES == 4
+    __m128 dt = _mm_set1_ps(job->dt);
+    __m128 zero = _mm_setzero_ps();
+    __m128 lifetime = _mm_set1_ps(PARTICLE_LIFETIME);
+    __m128 gdt = _mm_set1_ps(PARTICLE_GRAVITY * job->dt);
+    __m128 ground = _mm_set1_ps(PARTICLE_FLOOR);
+    __m128 bounce = _mm_set1_ps(-PARTICLE_BOUNCE);
+    for (; i + 4 <= end; i += 4) {
+        __m128 age = _mm_loadu_ps(cp->age + i);
+        __m128 a = _mm_add_ps(age, dt);
+        __m128 born = _mm_cmpge_ps(a, zero);
+        __m128 spawn = _mm_or_ps(_mm_cmpge_ps(a, lifetime),
+                                 _mm_and_ps(born, _mm_cmplt_ps(age, zero)));
+        __m128 live = _mm_andnot_ps(spawn, born);
+        __m128 x = _mm_loadu_ps(cp->x + i);
+        __m128 y = _mm_loadu_ps(cp->y + i);
+        __m128 vx = _mm_loadu_ps(cp->vx + i);
+        __m128 vy = _mm_loadu_ps(cp->vy + i);
+        __m128 nvy = _mm_add_ps(vy, gdt);
+        __m128 nx = _mm_add_ps(x, _mm_mul_ps(vx, dt));
+        __m128 ny = _mm_add_ps(y, _mm_mul_ps(nvy, dt));
+        __m128 hit = _mm_cmplt_ps(ny, ground);
+        /* SSE2 has no blend: select with and/andnot */
+        ny = _mm_or_ps(_mm_andnot_ps(hit, ny),
+                       _mm_and_ps(hit, _mm_sub_ps(_mm_add_ps(ground, ground),
+                                                  ny)));
+        nvy = _mm_or_ps(_mm_andnot_ps(hit, nvy),
+                        _mm_and_ps(hit, _mm_mul_ps(nvy, bounce)));
+        x = _mm_or_ps(_mm_andnot_ps(live, x), _mm_and_ps(live, nx));
+        y = _mm_or_ps(_mm_andnot_ps(live, y), _mm_and_ps(live, ny));
+        vy = _mm_or_ps(_mm_andnot_ps(live, vy), _mm_and_ps(live, nvy));
+        _mm_storeu_ps(cp->x + i, x);
+        _mm_storeu_ps(cp->y + i, y);
+        _mm_storeu_ps(cp->vy + i, vy);
+        _mm_storeu_ps(cp->age + i, a);
+        int mask = _mm_movemask_ps(spawn);
+        if (mask) {
+            for (int lane = 0; lane < 4; lane++)
+                if (mask >> lane & 1)
+                    respawn(cp, i + lane, cp->age[i + lane], job);
+            x = _mm_loadu_ps(cp->x + i);
+            y = _mm_loadu_ps(cp->y + i);
+            a = _mm_loadu_ps(cp->age + i);
+        }
+        _mm_storeu_ps(job->xy + i * 2, _mm_unpacklo_ps(x, y));
+        _mm_storeu_ps(job->xy + i * 2 + 4, _mm_unpackhi_ps(x, y));
+        _mm_storeu_ps(job->age + i, a);
+    }
+#endif
+    for (; i < end; i++) {
+        step(cp, i, job);
+        job->xy[i * 2] = cp->x[i];
+        job->xy[i * 2 + 1] = cp->y[i];
+        job->age[i] = cp->age[i];
+    }
+}
+
+static size_t
+slot_size(const struct cpu_particles *cp)
+{
+    return cp->count * 3 * sizeof(float);
+}
+
+void
+cpu_particles_init(struct cpu_particles *cp, size_t count)
+{
+    memset(cp, 0, sizeof(*cp));
+    cp->count = count;
+    float *soa = malloc(count * 5 * sizeof(*soa));
+    if (!soa) {
+        fprintf(stderr, "error: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    cp->x = soa;
+    cp->y = soa + count;
+    cp->vx = soa + count * 2;
+    cp->vy = soa + count * 3;
+    cp->age = soa + count * 4;
+    memset(soa, 0, count * 4 * sizeof(*soa));
+    for (size_t i = 0; i < count; i++)
+        cp->age[i] = -PARTICLE_LIFETIME * i / count;
+
+    particle_renderer_init(&cp->renderer);
+    size_t size = slot_size(cp) * CPU_PARTICLE_SLOTS;
+    glGenBuffers(1, &cp->buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, cp->buffer);
+    cp->persistent = gl3wIsSupported(4, 4) ||
+                     gl3wHasExt(GL3W_ARB_buffer_storage);
+    if (cp->persistent) {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT |
+                           GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_ARRAY_BUFFER, size, NULL, flags);
+        cp->mapped = glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
+        if (!cp->mapped) {
+            /* The storage still allows mapping each frame */
+            fprintf(stderr, "warning: persistent particle map failed\n");
+            cp->persistent = 0;
+        }
+    } else {
+        glBufferData(GL_ARRAY_BUFFER, size, NULL, GL_STREAM_DRAW);
+    }
+    glGenVertexArrays(1, &cp->vao);
+    glBindVertexArray(cp->vao);
+    glEnableVertexAttribArray(0);
+    glEnableVertexAttribArray(2);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    cp->slot = 0;
+}
+
+void
+cpu_particles_update(struct cpu_particles *cp, float dt)
+{
+    int slot = (cp->slot + 1) % CPU_PARTICLE_SLOTS;
+    if (cp->fences[slot]) {
+        /* Normally long signaled: the draw was two frames ago */
+        while (glClientWaitSync(cp->fences[slot], GL_SYNC_FLUSH_COMMANDS_BIT,
+                                1000000000) == GL_TIMEOUT_EXPIRED)
+            ;
+        glDeleteSync(cp->fences[slot]);
+        cp->fences[slot] = 0;
+    }
+    size_t size = slot_size(cp);
+    float *dst;
+    if (cp->persistent) {
+        dst = (float *) (cp->mapped + slot * size);
+    } else {
+        glBindBuffer(GL_ARRAY_BUFFER, cp->buffer);
+        dst = glMapBufferRange(GL_ARRAY_BUFFER, slot * size, size,
+                               GL_MAP_WRITE_BIT |
+                               GL_MAP_UNSYNCHRONIZED_BIT |
+                               GL_MAP_INVALIDATE_RANGE_BIT);
+        if (!dst) {
+            /* Skip the step; the last one is drawn again */
+            fprintf(stderr, "warning: particle buffer map failed\n");
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            return;
+        }
+    }
+
+    cp->time += dt;
+    struct step_job job = {
+        cp, dt, {0.6f * sinf(0.7f * cp->time), -0.9f}, cp->frame++,
+        dst, dst + cp->count * 2
+    };
+    jobs_run(step_chunk, &job, (cp->count + CHUNK - 1) / CHUNK);
+
+    if (!cp->persistent) {
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+    cp->slot = slot;
+}
+
+void
+cpu_particles_draw(struct cpu_particles *cp)
+{
+    size_t offset = slot_size(cp) * cp->slot;
+    glBindVertexArray(cp->vao);
+    glBindBuffer(GL_ARRAY_BUFFER, cp->buffer);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, (void *) offset);
+    glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, 0,
+                          (void *) (offset + cp->count * 2 * sizeof(float)));
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+    particle_render(&cp->renderer, cp->vao, cp->count);
+    if (cp->fences[cp->slot])
+        glDeleteSync(cp->fences[cp->slot]);
+    cp->fences[cp->slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+void
+cpu_particles_free(struct cpu_particles *cp)
+{
+    for (int i = 0; i < CPU_PARTICLE_SLOTS; i++)
+        if (cp->fences[i])
+            glDeleteSync(cp->fences[i]);
+    glDeleteVertexArrays(1, &cp->vao);
+    if (cp->persistent) {
+        glBindBuffer(GL_ARRAY_BUFFER, cp->buffer);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+    glDeleteBuffers(1, &cp->buffer);
+    particle_renderer_free(&cp->renderer);
+    free(cp->x);
+}
@@ -0,0 +1,44 @@
+#ifndef CPUPARTICLE_H
+#define CPUPARTICLE_H
+
+#include <stddef.h>
+#include <GL/gl3w.h>
+
+#include "particle.h"
+
+#define CPU_PARTICLE_SLOTS 3
+
+/* The particle simulation of particle.c run on the CPU, for drivers
+ * where that is faster, e.g. when the "GPU" is a software rasterizer
+ * sharing the same cores. State is kept as structure of arrays and
+ * integrated 8 particles at a time with AVX, or 4 with SSE, in chunks
+ * spread over the job pool. Each chunk also writes its positions and
+ * ages into one slot of a ring in a streaming buffer, mapped once and
+ * persistently with OpenGL 4.4 or ARB_buffer_storage, and mapped
+ * unsynchronized every frame otherwise. A fence guards each slot
+ * until the draw reading it has finished.
+ */
+struct cpu_particles {
+    size_t count;
+    float *x, *y, *vx, *vy, *age;
+    double time;
+    unsigned frame;
+    struct particle_renderer renderer;
+    GLuint buffer;
+    GLuint vao;
+    int persistent;
+    unsigned char *mapped;   /* whole buffer, if persistent */
+    GLsync fences[CPU_PARTICLE_SLOTS];
+    int slot;                /* last written */
+};
+
+void cpu_particles_init(struct cpu_particles *, size_t count);
+
+/* Advances the simulation by dt seconds and uploads the result. */
+void cpu_particles_update(struct cpu_particles *, float dt);
+
+void cpu_particles_draw(struct cpu_particles *);
+
+void cpu_particles_free(struct cpu_particles *);
+
+#endif
@@ -0,0 +1,221 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "cull.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define LANES 8
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define LANES 4
+#else
+#define LANES 1
+#endif
+
+#define LEAF_SIZE 32
+
+struct item {
+    float x, y, radius, scale;
+};
+
+static int
+cmp_x(const void *a, const void *b)
+{
+    float d = ((const struct item *) a)->x - ((const struct item *) b)->x;
+    return (d > 0) - (d < 0);
+}
+
+static int
+cmp_y(const void *a, const void *b)
+{
+    float d = ((const struct item *) a)->y - ((const struct item *) b)->y;
+    return (d > 0) - (d < 0);
+}
+
+/* Median split on the longer axis. Children are allocated as a pair so
+ * a node only needs the index of the first.
+ */
+static void
+build(struct cull_set *set, struct item *items, uint32_t node,
+      uint32_t start, uint32_t count)
+{
+    struct cull_node *n = set->nodes + node;
+    n->min[0] = n->min[1] = INFINITY;
+    n->max[0] = n->max[1] = -INFINITY;
+    for (uint32_t i = start; i < start + count; i++) {
+        const struct item *it = items + i;
+        n->min[0] = fminf(n->min[0], it->x - it->radius);
+        n->min[1] = fminf(n->min[1], it->y - it->radius);
+        n->max[0] = fmaxf(n->max[0], it->x + it->radius);
+        n->max[1] = fmaxf(n->max[1], it->y + it->radius);
+    }
+    n->start = start;
+    n->count = count;
+    n->left = 0;
+    if (count <= LEAF_SIZE)
+        return;
+    int axis = n->max[1] - n->min[1] > n->max[0] - n->min[0];
+    qsort(items + start, count, sizeof(*items), axis ? cmp_y : cmp_x);
+    uint32_t left = set->node_count;
+    set->node_count += 2;
+    n->left = left;
+    build(set, items, left, start, count / 2);
+    build(set, items, left + 1, start + count / 2, count - count / 2);
+}
+
+int
+cull_set_init(struct cull_set *set, const float (*instances)[3], size_t count)
+{
+    size_t padded = (count + LANES - 1) / LANES * LANES + LANES;
+    memset(set, 0, sizeof(*set));
+    float *soa = malloc(padded * 4 * sizeof(*soa));
+    struct item *items = malloc((count ? count : 1) * sizeof(*items));
+    /* A binary tree with leaves of at least LEAF_SIZE / 2 */
+    size_t max_nodes = 2 * (count / (LEAF_SIZE / 2) + 1);
+    set->nodes = malloc(max_nodes * sizeof(*set->nodes));
+    if (!soa || !items || !set->nodes) {
+        free(soa);
+        free(items);
+        free(set->nodes);
+        return -1;
+    }
+    for (size_t i = 0; i < count; i++) {
+        items[i].x = instances[i][0];
+        items[i].y = instances[i][1];
+        items[i].scale = instances[i][2];
+        items[i].radius = instances[i][2] * 1.41421356f;
+    }
+    set->count = count;
+    set->node_count = 1;
+    build(set, items, 0, 0, count);
+
+    set->x = soa;
+    set->y = soa + padded;
+    set->radius = soa + padded * 2;
+    set->scale = soa + padded * 3;
+    for (size_t i = 0; i < padded; i++) {
+        /* Padding fails every test: INFINITY - 0 is never <= max x */
+        set->x[i] = i < count ? items[i].x : INFINITY;
+        set->y[i] = i < count ? items[i].y : INFINITY;
+        set->radius[i] = i < count ? items[i].radius : 0;
+        set->scale[i] = i < count ? items[i].scale : 0;
+    }
+    free(items);
+    return 0;
+}
+
+void
+cull_set_free(struct cull_set *set)
+{
+    free(set->x);
+    free(set->nodes);
+    memset(set, 0, sizeof(*set));
+}
+
+static size_t
+emit(const struct cull_set *set, size_t i, const float origin[2],
+     float (*out)[3])
+{
+    out[0][0] = set->x[i] - origin[0];
+    out[0][1] = set->y[i] - origin[1];
+    out[0][2] = set->scale[i];
+    return 1;
+}
+
+/* Tests a leaf's instances LANES at a time and compacts the visible
+ * ones into out.
+ */
+static size_t
+test_range(const struct cull_set *set, size_t start, size_t count,
+           const float view[4], const float origin[2], float (*out)[3])
+{
+    size_t n = 0;
+#if LANES == 8
+    __m256 minx = _mm256_set1_ps(view[0]);
+    __m256 miny = _mm256_set1_ps(view[1]);
+    __m256 maxx = _mm256_set1_ps(view[2]);
+    __m256 maxy = _mm256_set1_ps(view[3]);
+    for (size_t i = start; i < start + count; i += 8) {
+        __m256 x = _mm256_loadu_ps(set->x + i);
+        __m256 y = _mm256_loadu_ps(set->y + i);
+        __m256 r = _mm256_loadu_ps(set->radius + i);
+        __m256 in = _mm256_and_ps(
+            _mm256_and_ps(_mm256_cmp_ps(_mm256_add_ps(x, r), minx, _CMP_GE_OQ),
+                          _mm256_cmp_ps(_mm256_sub_ps(x, r), maxx, _CMP_LE_OQ)),
+            _mm256_and_ps(_mm256_cmp_ps(_mm256_add_ps(y, r), miny, _CMP_GE_OQ),
+                          _mm256_cmp_ps(_mm256_sub_ps(y, r), maxy, _CMP_LE_OQ)));
+        unsigned mask = _mm256_movemask_ps(in);
+        if (start + count - i < 8)
+            mask &= (1u << (start + count - i)) - 1;
+        for (; mask; mask &= mask - 1)
+            n += emit(set, i + __builtin_ctz(mask), origin, out + n);
+    }
+#elif LANES == 4
+    __m128 minx = _mm_set1_ps(view[0]);
+    __m128 miny = _mm_set1_ps(view[1]);
+    __m128 maxx = _mm_set1_ps(view[2]);
+    __m128 maxy = _mm_set1_ps(view[3]);
+    for (size_t i = start; i < start + count; i += 4) {
+        __m128 x = _mm_loadu_ps(set->x + i);
+        __m128 y = _mm_loadu_ps(set->y + i);
+        __m128 r = _mm_loadu_ps(set->radius + i);
+        __m128 in = _mm_and_ps(
+            _mm_and_ps(_mm_cmpge_ps(_mm_add_ps(x, r), minx),
+                       _mm_cmple_ps(_mm_sub_ps(x, r), maxx)),
+            _mm_and_ps(_mm_cmpge_ps(_mm_add_ps(y, r), miny),
+                       _mm_cmple_ps(_mm_sub_ps(y, r), maxy)));
+        unsigned mask = _mm_movemask_ps(in);
+        if (start + count - i < 4)
+            mask &= (1u << (start + count - i)) - 1;
+        for (; mask; mask &= mask - 1)
+            n += emit(set, i + __builtin_ctz(mask), origin, out + n);
+    }
+#else
+    for (size_t i = start; i < start + count; i++) {
+        float r = set->radius[i];
+        if (set->x[i] + r >= view[0] && set->x[i] - r <= view[2] &&
+            set->y[i] + r >= view[1] && set->y[i] - r <= view[3])
+            n += emit(set, i, origin, out + n);
+    }
+#endif
+    return n;
+}
+
+size_t
+cull_visible(const struct cull_set *set, const float view[4],
+             const float origin[2], float (*out)[3], struct cull_stats *stats)
+{
+    struct cull_stats s = {0, 0, 0};
+    uint32_t stack[64];
+    int top = 0;
+    size_t n = 0;
+    if (set->count)
+        stack[top++] = 0;
+    while (top) {
+        const struct cull_node *node = set->nodes + stack[--top];
+        s.nodes++;
+        if (node->max[0] < view[0] || node->min[0] > view[2] ||
+            node->max[1] < view[1] || node->min[1] > view[3])
+            continue;
+        int inside = node->min[0] >= view[0] && node->max[0] <= view[2] &&
+                     node->min[1] >= view[1] && node->max[1] <= view[3];
+        if (inside) {
+            /* Every instance below is visible: copy the whole range */
+            for (uint32_t i = node->start; i < node->start + node->count; i++)
+                n += emit(set, i, origin, out + n);
+            s.accepted += node->count;
+        } else if (!node->left) {
+            n += test_range(set, node->start, node->count, view, origin,
+                            out + n);
+            s.tested += node->count;
+        } else {
+            stack[top++] = node->left + 1;
+            stack[top++] = node->left;
+        }
+    }
+    if (stats)
+        *stats = s;
+    return n;
+}
@@ -0,0 +1,53 @@
+#ifndef CULL_H
+#define CULL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* View culling for instanced squares. Instance bounds are kept as
+ * bounding circles in structure-of-arrays form and tested 4 or 8 at a
+ * time with SSE or AVX. A bounding volume hierarchy over the static
+ * instances skips whole groups that are off-screen and accepts groups
+ * that are entirely on screen without per-instance tests.
+ */
+
+struct cull_node {
+    float min[2];
+    float max[2];
+    uint32_t start;  /* first instance below this node */
+    uint32_t count;  /* instances below this node */
+    uint32_t left;   /* children are left and left + 1, or 0 for a leaf */
+};
+
+struct cull_set {
+    size_t count;
+    float *x;        /* padded with off-screen entries for SIMD loads */
+    float *y;
+    float *radius;
+    float *scale;
+    struct cull_node *nodes;
+    size_t node_count;
+};
+
+struct cull_stats {
+    size_t nodes;     /* BVH nodes visited */
+    size_t tested;    /* instances tested individually */
+    size_t accepted;  /* instances accepted by whole node */
+};
+
+/* Instances are (x, y, scale) of a square of half-size scale, which
+ * may rotate. Instances are reordered into BVH leaf order. Returns 0,
+ * or -1 when out of memory.
+ */
+int cull_set_init(struct cull_set *, const float (*instances)[3], size_t count);
+void cull_set_free(struct cull_set *);
+
+/* Writes the instances overlapping view (min x, min y, max x, max y)
+ * to out, translated by -origin, and returns how many. out must hold
+ * every instance. stats may be NULL.
+ */
+size_t cull_visible(const struct cull_set *, const float view[4],
+                    const float origin[2], float (*out)[3],
+                    struct cull_stats *stats);
+
+#endif
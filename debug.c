@@ -0,0 +1,245 @@
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include <GL/gl3w.h>
+
+#include "debug.h"
+
+#define RING_SIZE    1024   /* power of two */
+#define MESSAGE_MAX  240
+#define TABLE_SIZE   256    /* power of two */
+#define POLL_NS      20000000L
+
+struct message {
+    GLenum source;
+    GLenum type;
+    GLuint id;
+    GLenum severity;
+    char text[MESSAGE_MAX];
+};
+
+/* Bounded multi-producer ring: drivers may call back from several
+ * threads at once. Each slot's sequence number says whether it's free
+ * for the producer at that position or full for the consumer.
+ */
+static struct {
+    unsigned long seq;
+    struct message msg;
+} ring[RING_SIZE];
+static unsigned long ring_head;  /* next position to fill */
+static unsigned long ring_tail;  /* next position to drain, consumer only */
+static unsigned long dropped;
+
+struct entry {
+    GLenum source;
+    GLenum type;
+    GLuint id;
+    GLenum severity;
+    unsigned long count;     /* since the last report */
+    unsigned long total;
+    char text[MESSAGE_MAX];  /* first occurrence */
+};
+
+static struct entry table[TABLE_SIZE];
+static unsigned long overflow;  /* messages with no room in the table */
+
+static pthread_t thread;
+static int running;
+static int stop;
+static double interval;
+
+static void APIENTRY
+debug_callback(GLenum source, GLenum type, GLuint id, GLenum severity,
+               GLsizei length, const GLchar *text, const void *arg)
+{
+    (void) arg;
+    unsigned long pos = __atomic_load_n(&ring_head, __ATOMIC_RELAXED);
+    for (;;) {
+        unsigned long seq =
+            __atomic_load_n(&ring[pos % RING_SIZE].seq, __ATOMIC_ACQUIRE);
+        long diff = (long) (seq - pos);
+        if (diff == 0) {
+            if (__atomic_compare_exchange_n(&ring_head, &pos, pos + 1, 1,
+                                            __ATOMIC_RELAXED,
+                                            __ATOMIC_RELAXED))
+                break;
+        } else if (diff < 0) {
+            __atomic_fetch_add(&dropped, 1, __ATOMIC_RELAXED);
+            return;
+        } else {
+            pos = __atomic_load_n(&ring_head, __ATOMIC_RELAXED);
+        }
+    }
+    struct message *m = &ring[pos % RING_SIZE].msg;
+    m->source = source;
+    m->type = type;
+    m->id = id;
+    m->severity = severity;
+    if (length < 0)
+        length = strlen(text);
+    if (length > MESSAGE_MAX - 1)
+        length = MESSAGE_MAX - 1;
+    memcpy(m->text, text, length);
+    m->text[length] = 0;
+    __atomic_store_n(&ring[pos % RING_SIZE].seq, pos + 1, __ATOMIC_RELEASE);
+}
+
+static int
+ring_pop(struct message *m)
+{
+    unsigned long pos = ring_tail;
+    unsigned long seq =
+        __atomic_load_n(&ring[pos % RING_SIZE].seq, __ATOMIC_ACQUIRE);
+    if (seq != pos + 1)
+        return 0;
+    *m = ring[pos % RING_SIZE].msg;
+    __atomic_store_n(&ring[pos % RING_SIZE].seq, pos + RING_SIZE,
+                     __ATOMIC_RELEASE);
+    ring_tail = pos + 1;
+    return 1;
+}
+
+static void
+aggregate(const struct message *m)
+{
+    unsigned h = (m->id * 2654435761u) ^ m->source;
+    for (unsigned i = 0; i < TABLE_SIZE; i++) {
+        struct entry *e = &table[(h + i) % TABLE_SIZE];
+        if (!e->total) {
+            e->source = m->source;
+            e->type = m->type;
+            e->id = m->id;
+            e->severity = m->severity;
+            memcpy(e->text, m->text, sizeof(e->text));
+        } else if (e->source != m->source || e->id != m->id) {
+            continue;
+        }
+        e->count++;
+        e->total++;
+        return;
+    }
+    overflow++;
+}
+
+static const char *
+source_name(GLenum source)
+{
+    switch (source) {
+        case GL_DEBUG_SOURCE_API:             return "api";
+        case GL_DEBUG_SOURCE_WINDOW_SYSTEM:   return "window";
+        case GL_DEBUG_SOURCE_SHADER_COMPILER: return "compiler";
+        case GL_DEBUG_SOURCE_THIRD_PARTY:     return "third-party";
+        case GL_DEBUG_SOURCE_APPLICATION:     return "application";
+    }
+    return "other";
+}
+
+static const char *
+type_name(GLenum type)
+{
+    switch (type) {
+        case GL_DEBUG_TYPE_ERROR:               return "error";
+        case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "deprecated";
+        case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:  return "undefined";
+        case GL_DEBUG_TYPE_PORTABILITY:         return "portability";
+        case GL_DEBUG_TYPE_PERFORMANCE:         return "performance";
+        case GL_DEBUG_TYPE_MARKER:              return "marker";
+    }
+    return "other";
+}
+
+static const char *
+severity_name(GLenum severity)
+{
+    switch (severity) {
+        case GL_DEBUG_SEVERITY_HIGH:   return "high";
+        case GL_DEBUG_SEVERITY_MEDIUM: return "medium";
+        case GL_DEBUG_SEVERITY_LOW:    return "low";
+    }
+    return "info";
+}
+
+/* Reports entries with new messages, or every entry when final. */
+static void
+report(int final)
+{
+    unsigned long lost = __atomic_exchange_n(&dropped, 0, __ATOMIC_RELAXED);
+    if (final)
+        fprintf(stderr, "debug: totals\n");
+    for (unsigned i = 0; i < TABLE_SIZE; i++) {
+        struct entry *e = &table[i];
+        unsigned long n = final ? e->total : e->count;
+        if (n)
+            fprintf(stderr, "debug: %6lux %s %s %s 0x%x: %s\n", n,
+                    severity_name(e->severity), source_name(e->source),
+                    type_name(e->type), e->id, e->text);
+        e->count = 0;
+    }
+    if (lost || overflow)
+        fprintf(stderr, "debug: %lu dropped, %lu unaggregated\n",
+                lost, overflow);
+    overflow = 0;
+}
+
+static void *
+aggregator(void *arg)
+{
+    (void) arg;
+    struct timespec poll = {0, POLL_NS};
+    double elapsed = 0;
+    struct message m;
+    while (!__atomic_load_n(&stop, __ATOMIC_ACQUIRE)) {
+        nanosleep(&poll, NULL);
+        while (ring_pop(&m))
+            aggregate(&m);
+        elapsed += POLL_NS / 1e9;
+        if (elapsed >= interval) {
+            report(0);
+            elapsed = 0;
+        }
+    }
+    while (ring_pop(&m))
+        aggregate(&m);
+    return NULL;
+}
+
+int
+debug_init(double seconds)
+{
+    if (!gl3wIsSupported(4, 3) && !gl3wHasExt(GL3W_KHR_debug))
+        return -1;
+    interval = seconds;
+    for (unsigned long i = 0; i < RING_SIZE; i++)
+        ring[i].seq = i;
+    ring_head = ring_tail = 0;
+    memset(table, 0, sizeof(table));
+    stop = 0;
+    if (pthread_create(&thread, NULL, aggregator, NULL))
+        return -1;
+    running = 1;
+
+    /* Notifications are chatty and rarely actionable. */
+    glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE,
+                          GL_DEBUG_SEVERITY_NOTIFICATION, 0, NULL, GL_FALSE);
+    glDebugMessageCallback(debug_callback, NULL);
+    glEnable(GL_DEBUG_OUTPUT);
+    glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    return 0;
+}
+
+void
+debug_shutdown(void)
+{
+    if (!running)
+        return;
+    glDisable(GL_DEBUG_OUTPUT);
+    glDebugMessageCallback(NULL, NULL);
+    __atomic_store_n(&stop, 1, __ATOMIC_RELEASE);
+    pthread_join(thread, NULL);
+    running = 0;
+    report(1);
+}
@@ -0,0 +1,19 @@
+#ifndef DEBUG_H
+#define DEBUG_H
+
+/* KHR_debug message collection that stays off the rendering thread.
+ * The callback only copies each message into a lock-free ring. A
+ * background thread drains the ring, merges repeats by source and ID,
+ * and every interval seconds reports what arrived since the last
+ * report, so driver performance warnings (stalls, recompiles) can be
+ * watched without distorting the frame times they describe.
+ *
+ * Needs a current context with OpenGL 4.3 or KHR_debug, ideally
+ * created as a debug context. Returns 0, or -1 if unsupported.
+ */
+int debug_init(double interval);
+
+/* Stops collection and prints the totals for the whole run. */
+void debug_shutdown(void);
+
+#endif
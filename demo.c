@@ -2,64 +2,143 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
+#include <errno.h>
 #include <getopt.h>
+#include <math.h>
 
 #define GLFW_INCLUDE_NONE
 #include <GL/gl3w.h>
 #include <GLFW/glfw3.h>
 
+#include "shader.h"
+#include "debug.h"
+#include "mesh.h"
+#include "drawlist.h"
+#include "cull.h"
+#include "gpucull.h"
+#include "sprite.h"
+#include "atlas.h"
+#include "stream.h"
+#include "jobs.h"
+#include "hud.h"
+#include "particle.h"
+#include "cpuparticle.h"
+#include "dynres.h"
+#include "aa.h"
+#include "targetpool.h"
+#include "graph.h"
+#include "manifest.h"
+
 #define countof(x) (sizeof(x) / sizeof(0[x]))
 
 #define M_PI 3.141592653589793
 #define ATTRIB_POINT 0
-
-static GLuint
-compile_shader(GLenum type, const GLchar *source)
-{
-    GLuint shader = glCreateShader(type);
-    glShaderSource(shader, 1, &source, NULL);
-    glCompileShader(shader);
-    GLint param;
-    glGetShaderiv(shader, GL_COMPILE_STATUS, &param);
-    if (!param) {
-        GLchar log[4096];
-        glGetShaderInfoLog(shader, sizeof(log), NULL, log);
-        fprintf(stderr, "error: %s: %s\n",
-                type == GL_FRAGMENT_SHADER ? "frag" : "vert", (char *) log);
-        exit(EXIT_FAILURE);
-    }
-    return shader;
-}
-
-static GLuint
-link_program(GLuint vert, GLuint frag)
-{
-    GLuint program = glCreateProgram();
-    glAttachShader(program, vert);
-    glAttachShader(program, frag);
-    glLinkProgram(program);
-    GLint param;
-    glGetProgramiv(program, GL_LINK_STATUS, &param);
-    if (!param) {
-        GLchar log[4096];
-        glGetProgramInfoLog(program, sizeof(log), NULL, log);
-        fprintf(stderr, "error: link: %s\n", (char *) log);
-        exit(EXIT_FAILURE);
-    }
-    return program;
-}
+#define ATTRIB_INSTANCE 1
+#define ATTRIB_COLOR 2
 
 struct graphics_context {
     GLFWwindow *window;
+    struct shader_set shaders;
     GLuint program;
     GLint uniform_angle;
+    GLint uniform_camera;
     GLuint vbo_point;
     GLuint vao_point;
+    struct mesh_gl mesh;
+    GLuint vbo_grid;
+    GLuint vao_grid;
+    int grid;  /* squares per side, or 0 */
+    bool multidraw;
+    struct draw_list draws;
+    GLuint vbo_instance;
+    GLuint vao_instance;
+    struct cull_set instances;
+    float (*visible)[3];
+    size_t visible_count;
+    GLuint vbo_world;
+    struct gpu_cull gpu_cull;
+    bool gpu_culling;
+    float camera[2];
+    double pan;
+    struct sprite_batch batch;
+    long sprite_count;
+    struct atlas atlas;
+    struct atlas_region images[64];
+    uint32_t image_seed;
+    struct streamer streamer;
+    struct stream_texture streamed[8];
+    int streamed_count;
+    struct hud hud;
+    struct dynres dynres;  /* target is 0 when rendering at full size */
+    struct aa aa;
+    struct target_pool pool;
+    struct graph graph;
+    int scene_target;      /* resources of the frame being built */
+    int resolved_target;
+    struct sprite_stats scene_stats;
+    struct particle_system particles;
+    struct cpu_particles cpu_particles;
+    bool cpu_simulation;
     double angle;
     long framecount;
     double lastframe;
 };
 
+/* Feature switches: INSTANCING places each copy with a per-instance
+ * offset and scale, COMPRESSED dequantizes normalized integer points,
+ * and VERTEX_COLOR takes the color from a vertex attribute.
+ */
+static const struct shader_source QUAD_SHADER = {
+    .name = "quad",
+    .features = SHADER_INSTANCING | SHADER_COMPRESSED | SHADER_VERTEX_COLOR,
+    .vert =
+        "layout(location = 0) in vec2 point;\n"
+        "#ifdef INSTANCING\n"
+        "layout(location = 1) in vec3 instance;\n"
+        "#endif\n"
+        "#ifdef VERTEX_COLOR\n"
+        "layout(location = 2) in vec3 vcolor;\n"
+        "out vec3 fcolor;\n"
+        "#endif\n"
+        "#ifdef COMPRESSED\n"
+        "uniform vec4 dequant;\n"
+        "#endif\n"
+        "#ifdef INSTANCING\n"
+        "uniform vec2 camera;\n"
+        "#endif\n"
+        "uniform float angle;\n"
+        "void main() {\n"
+        "    mat2 rotate = mat2(cos(angle), -sin(angle),\n"
+        "                       sin(angle), cos(angle));\n"
+        "    vec2 p = point;\n"
+        "#ifdef COMPRESSED\n"
+        "    p = p * dequant.xy + dequant.zw;\n"
+        "#endif\n"
+        "#ifdef INSTANCING\n"
+        "    p = instance.z * rotate * p + instance.xy - camera;\n"
+        "#else\n"
+        "    p = 0.75 * rotate * p;\n"
+        "#endif\n"
+        "#ifdef VERTEX_COLOR\n"
+        "    fcolor = vcolor;\n"
+        "#endif\n"
+        "    gl_Position = vec4(p, 0.0, 1.0);\n"
+        "}\n",
+    .frag =
+        "#ifdef VERTEX_COLOR\n"
+        "in vec3 fcolor;\n"
+        "#endif\n"
+        "out vec4 color;\n"
+        "void main() {\n"
+        "#ifdef VERTEX_COLOR\n"
+        "    color = vec4(fcolor, 0);\n"
+        "#else\n"
+        "    color = vec4(1, 0.15, 0.15, 0);\n"
+        "#endif\n"
+        "}\n",
+};
+
 const float SQUARE[] = {
     -1.0f,  1.0f,
     -1.0f, -1.0f,
@@ -67,42 +146,708 @@ const float SQUARE[] = {
      1.0f, -1.0f
 };
 
+/* A grid of squares stands in for many distinct meshes sharing one
+ * vertex buffer: each square is its own draw.
+ */
 static void
-render(struct graphics_context *context)
+init_grid(struct graphics_context *context, int n)
+{
+    size_t count = (size_t) n * n * countof(SQUARE);
+    float *vertices = malloc(count * sizeof(*vertices));
+    if (!vertices) {
+        fprintf(stderr, "error: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    float size = 2.0f / n;
+    for (int y = 0; y < n; y++) {
+        for (int x = 0; x < n; x++) {
+            float *v = vertices + (y * n + x) * countof(SQUARE);
+            for (size_t i = 0; i < countof(SQUARE); i += 2) {
+                v[i + 0] = (x + 0.5f + SQUARE[i + 0] * 0.4f) * size - 1;
+                v[i + 1] = (y + 0.5f + SQUARE[i + 1] * 0.4f) * size - 1;
+            }
+        }
+    }
+    glGenBuffers(1, &context->vbo_grid);
+    glBindBuffer(GL_ARRAY_BUFFER, context->vbo_grid);
+    glBufferData(GL_ARRAY_BUFFER, count * sizeof(*vertices), vertices,
+                 GL_STATIC_DRAW);
+    free(vertices);
+    glGenVertexArrays(1, &context->vao_grid);
+    glBindVertexArray(context->vao_grid);
+    glVertexAttribPointer(ATTRIB_POINT, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(ATTRIB_POINT);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    context->grid = n;
+    context->multidraw = true;
+    draw_list_init(&context->draws, 0);
+}
+
+static void
+draw_grid(struct graphics_context *context)
+{
+    GLuint per = countof(SQUARE) / 2;
+    GLuint total = context->grid * context->grid;
+    glBindVertexArray(context->vao_grid);
+    if (context->multidraw) {
+        draw_list_clear(&context->draws);
+        for (GLuint i = 0; i < total; i++)
+            draw_list_arrays(&context->draws, i * per, per, 1, 0);
+        draw_list_submit(&context->draws, GL_TRIANGLE_STRIP);
+    } else {
+        for (GLuint i = 0; i < total; i++)
+            glDrawArrays(GL_TRIANGLE_STRIP, i * per, per);
+    }
+    glBindVertexArray(0);
+}
+
+/* Instances are scattered over a world much larger than the view, at
+ * a density independent of their number. The camera pans across it.
+ */
+#define INSTANCE_SCALE 0.04f
+
+static void
+init_instances(struct graphics_context *context, size_t n)
 {
+    float (*instances)[3] = malloc(n * sizeof(*instances));
+    context->visible = malloc(n * sizeof(*context->visible));
+    if (!instances || !context->visible) {
+        fprintf(stderr, "error: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    float extent = sqrtf(n) * INSTANCE_SCALE * 4;
+    uint64_t rng = 0x9e3779b97f4a7c15;
+    for (size_t i = 0; i < n; i++) {
+        for (int j = 0; j < 2; j++) {
+            rng = rng * 0x5851f42d4c957f2d + 1;
+            float u = (rng >> 40) / (float) (1 << 24);
+            instances[i][j] = (u * 2 - 1) * extent;
+        }
+        instances[i][2] = INSTANCE_SCALE;
+    }
+    const float (*bounds)[3] = (const float (*)[3]) instances;
+    if (cull_set_init(&context->instances, bounds, n)) {
+        fprintf(stderr, "error: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+
+    glGenBuffers(1, &context->vbo_world);
+    glBindBuffer(GL_ARRAY_BUFFER, context->vbo_world);
+    glBufferData(GL_ARRAY_BUFFER, n * sizeof(*instances), instances,
+                 GL_STATIC_DRAW);
+    free(instances);
+    gpu_cull_init(&context->gpu_cull, context->vbo_world, n);
+    context->gpu_culling = false;
+
+    glGenBuffers(1, &context->vbo_instance);
+    glBindBuffer(GL_ARRAY_BUFFER, context->vbo_instance);
+    glBufferData(GL_ARRAY_BUFFER, n * sizeof(*context->visible), NULL,
+                 GL_STREAM_DRAW);
+    glGenVertexArrays(1, &context->vao_instance);
+    glBindVertexArray(context->vao_instance);
+    glVertexAttribDivisor(ATTRIB_INSTANCE, 1);
+    glEnableVertexAttribArray(ATTRIB_INSTANCE);
+    glBindBuffer(GL_ARRAY_BUFFER, context->vbo_point);
+    glVertexAttribPointer(ATTRIB_POINT, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(ATTRIB_POINT);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    context->pan = 0;
+    context->camera[0] = context->camera[1] = 0;
+}
+
+/* The GPU pass's results are a frame or two old when drawn, so it
+ * culls against a view enlarged by as far as the camera could move in
+ * the meantime. Its instances stay in world space and the shader
+ * subtracts the current camera.
+ */
+static GLuint
+gpu_cull_instances(struct graphics_context *context, const float camera[2])
+{
+    float dx = fabsf(camera[0] - context->camera[0]);
+    float dy = fabsf(camera[1] - context->camera[1]);
+    float margin = (dx > dy ? dx : dy) * GPU_CULL_SLOTS;
+    float view[4] = {
+        camera[0] - 1 - margin, camera[1] - 1 - margin,
+        camera[0] + 1 + margin, camera[1] + 1 + margin,
+    };
+    gpu_cull_run(&context->gpu_cull, view);
+    glUseProgram(context->program);
+
+    GLuint buffer, count;
+    if (!gpu_cull_result(&context->gpu_cull, &buffer, &count))
+        return 0;
+    glUniform2fv(context->uniform_camera, 1, camera);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBindVertexArray(context->vao_instance);
+    glVertexAttribPointer(ATTRIB_INSTANCE, 3, GL_FLOAT, GL_FALSE, 0, 0);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    return count;
+}
+
+static GLuint
+cpu_cull_instances(struct graphics_context *context, const float camera[2])
+{
+    float view[4] = {
+        camera[0] - 1, camera[1] - 1, camera[0] + 1, camera[1] + 1
+    };
+    size_t n = cull_visible(&context->instances, view, camera,
+                            context->visible, NULL);
+    static const float origin[2] = {0, 0};
+    glUniform2fv(context->uniform_camera, 1, origin);
+    glBindBuffer(GL_ARRAY_BUFFER, context->vbo_instance);
+    glBufferData(GL_ARRAY_BUFFER,
+                 context->instances.count * sizeof(*context->visible),
+                 NULL, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, n * sizeof(*context->visible),
+                    context->visible);
+    glBindVertexArray(context->vao_instance);
+    glVertexAttribPointer(ATTRIB_INSTANCE, 3, GL_FLOAT, GL_FALSE, 0, 0);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    return n;
+}
+
+/* Culls in world space against the view rectangle, so only visible
+ * instances reach the instance buffer, either on the CPU or on the
+ * device.
+ */
+static void
+draw_instances(struct graphics_context *context)
+{
+    size_t n = context->instances.count;
+    float extent = sqrtf(n) * INSTANCE_SCALE * 4;
+    float reach = extent > 1 ? extent - 1 : 0;
+    float camera[2] = {
+        reach * cosf(context->pan),
+        reach * sinf(context->pan * 0.7f),
+    };
+    if (context->gpu_culling)
+        context->visible_count = gpu_cull_instances(context, camera);
+    else
+        context->visible_count = cpu_cull_instances(context, camera);
+    context->camera[0] = camera[0];
+    context->camera[1] = camera[1];
+
+    glBindVertexArray(context->vao_instance);
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, countof(SQUARE) / 2,
+                          context->visible_count);
+    glBindVertexArray(0);
+}
+
+/* Sprite images are generated: checkers and discs of random sizes.
+ * One is replaced every frame, so the atlas is constantly inserting
+ * and evicting while every sprite still draws from one texture.
+ */
+static uint32_t
+image_random(uint32_t *seed)
+{
+    *seed = *seed * 1103515245 + 12345;
+    return *seed >> 16;
+}
+
+static struct atlas_region
+new_image(struct graphics_context *context)
+{
+    uint32_t *seed = &context->image_seed;
+    int w = 8 + image_random(seed) % 25;
+    int h = 8 + image_random(seed) % 25;
+    int cell = 1 + image_random(seed) % 4;
+    bool disc = image_random(seed) % 2;
+    uint32_t pixels[32 * 32];
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            uint32_t *p = pixels + y * w + x;
+            if (disc) {
+                float dx = (x + 0.5f) / w * 2 - 1;
+                float dy = (y + 0.5f) / h * 2 - 1;
+                *p = dx * dx + dy * dy < 1 ? 0xffffffff : 0;
+            } else {
+                *p = (x / cell + y / cell) % 2 ? 0xffffffff : 0xff404040;
+            }
+        }
+    }
+    struct atlas_region region;
+    if (atlas_insert(&context->atlas, w, h, pixels, &region))
+        region.w = 0;
+    return region;
+}
+
+static void
+init_sprites(struct graphics_context *context, long n)
+{
+    atlas_init(&context->atlas, 256, 4);
+    context->image_seed = 1;
+    for (size_t i = 0; i < countof(context->images); i++)
+        context->images[i] = new_image(context);
+    context->sprite_count = n;
+}
+
+/* Inserts first and evicts only on success, so a full atlas leaves
+ * the old image in place.
+ */
+static void
+replace_image(struct graphics_context *context)
+{
+    size_t slot = context->image_seed % countof(context->images);
+    struct atlas_region region = new_image(context);
+    if (region.w) {
+        atlas_remove(&context->atlas, context->images + slot);
+        context->images[slot] = region;
+    }
+}
+
+static void
+draw_sprites(struct graphics_context *context, int width, int height)
+{
+    double t = glfwGetTime();
+    replace_image(context);
+    sprite_texture(&context->batch, context->atlas.texture);
+    for (long i = 0; i < context->sprite_count; i++) {
+        uint64_t h = (i + 1) * UINT64_C(0x9e3779b97f4a7c15);
+        h ^= h >> 29;
+        float vx = (int) (h >> 48 & 0xff) - 128;
+        float vy = (int) (h >> 40 & 0xff) - 128;
+        float x = fmod((h >> 16 & 0xffff) + vx * t, width);
+        float y = fmod((h & 0xffff) + vy * t, height);
+        const struct atlas_region *image =
+            context->images + i % countof(context->images);
+        struct sprite sprite = {
+            .x = x < 0 ? x + width : x,
+            .y = y < 0 ? y + height : y,
+            .w = image->w / 2.0f,
+            .h = image->h / 2.0f,
+            .rotation = context->angle + i,
+            .layer = image->page,
+            .color = (uint32_t) (h >> 32) | 0xc0000000,
+        };
+        float uv[4];
+        atlas_uv(&context->atlas, image, uv);
+        sprite.u0 = uv[0];
+        sprite.v0 = uv[1];
+        sprite.u1 = uv[2];
+        sprite.v1 = uv[3];
+        sprite_draw(&context->batch, &sprite);
+    }
+}
+
+/* Streamed images are shown along the top once their uploads have
+ * completed, and simply left out until then.
+ */
+static void
+draw_streamed(struct graphics_context *context)
+{
+    float x = 8;
+    for (int i = 0; i < context->streamed_count; i++) {
+        struct stream_texture *t = context->streamed + i;
+        if (!stream_ready(t))
+            continue;
+        float scale = t->height > 128 ? 128.0f / t->height : 1;
+        struct sprite sprite = {
+            .x = x + t->width * scale / 2,
+            .y = 8 + t->height * scale / 2,
+            .w = t->width * scale / 2,
+            .h = t->height * scale / 2,
+            .u0 = 0, .v0 = 0, .u1 = 1, .v1 = 1,
+            .color = 0xffffffff,
+        };
+        sprite_texture(&context->batch, t->texture);
+        sprite_draw(&context->batch, &sprite);
+        x += t->width * scale + 8;
+    }
+}
+
+static void
+simulate_pass(struct graph *g, void *arg)
+{
+    (void) g;
+    struct graphics_context *context = arg;
+    /* Stepped by the last frame's duration */
+    double dt = glfwGetTime() - context->lastframe;
+    dt = dt < 0.1 ? dt : 0.1;
+    if (context->cpu_simulation)
+        cpu_particles_update(&context->cpu_particles, dt);
+    else
+        particle_update(&context->particles, dt);
+}
+
+static void
+scene_pass(struct graph *g, void *arg)
+{
+    (void) g;
+    struct graphics_context *context = arg;
+    /* Sprites are placed in window pixels at any render size */
+    int width, height;
+    glfwGetFramebufferSize(context->window, &width, &height);
+    int view[2] = {width, height};
+    if (context->dynres.target) {
+        view[0] = context->dynres.view[0];
+        view[1] = context->dynres.view[1];
+        glViewport(0, 0, view[0], view[1]);
+        dynres_begin(&context->dynres);
+    }
+    aa_begin(&context->aa, view[0], view[1]);
     glClearColor(0.15, 0.15, 0.15, 1);
     glClear(GL_COLOR_BUFFER_BIT);
-
+    sprite_begin(&context->batch, width, height);
     glUseProgram(context->program);
     glUniform1f(context->uniform_angle, context->angle);
-    glBindVertexArray(context->vao_point);
-    glDrawArrays(GL_TRIANGLE_STRIP, 0, countof(SQUARE) / 2);
-    glBindVertexArray(0);
+    if (context->particles.count) {
+        if (context->cpu_simulation)
+            cpu_particles_draw(&context->cpu_particles);
+        else
+            particle_draw(&context->particles);
+    } else if (context->sprite_count) {
+        draw_sprites(context, width, height);
+    } else if (context->instances.count) {
+        draw_instances(context);
+    } else if (context->grid) {
+        draw_grid(context);
+    } else if (context->mesh.vao) {
+        mesh_draw(&context->mesh);
+    } else {
+        glBindVertexArray(context->vao_point);
+        glDrawArrays(GL_TRIANGLE_STRIP, 0, countof(SQUARE) / 2);
+        glBindVertexArray(0);
+    }
     glUseProgram(0);
+    draw_streamed(context);
+
+    /* The scene's own batches, before the HUD's */
+    sprite_flush(&context->batch);
+    context->scene_stats = context->batch.stats;
+    if (context->aa.mode == AA_NONE)
+        aa_resolve(&context->aa, 0, 0);
+    if (context->dynres.target)
+        dynres_end(&context->dynres);
+}
+
+static void
+aa_pass(struct graph *g, void *arg)
+{
+    struct graphics_context *context = arg;
+    int scene = context->scene_target;
+    if (context->dynres.target)
+        glViewport(0, 0, context->dynres.view[0], context->dynres.view[1]);
+    aa_resolve(&context->aa, graph_framebuffer(g, scene),
+               graph_texture(g, scene));
+}
+
+static void
+upscale_pass(struct graph *g, void *arg)
+{
+    struct graphics_context *context = arg;
+    dynres_upscale(&context->dynres,
+                   graph_framebuffer(g, context->resolved_target));
+}
+
+static void
+hud_pass(struct graph *g, void *arg)
+{
+    (void) g;
+    struct graphics_context *context = arg;
+    hud_draw(&context->hud, &context->batch);
+    sprite_end(&context->batch);
+}
+
+/* Declares the frame: the scene is drawn into a multisampled or FXAA
+ * input target when anti-aliased, resolved into an offscreen target
+ * when rendering at a dynamic resolution, then scaled up to the
+ * window under the HUD. Stages that aren't needed write straight into
+ * the next one's target.
+ */
+static void
+build_frame(struct graphics_context *context, int width, int height)
+{
+    struct graph *g = &context->graph;
+    graph_reset(g);
+    if (context->dynres.target)
+        dynres_update(&context->dynres);
+    int window = graph_import(g, "window", 0, width, height);
+    struct target_desc desc = {width, height, GL_RGBA8, 0};
+    int resolved = window;
+    if (context->dynres.target)
+        resolved = graph_create(g, "resolved", &desc);
+    int scene = resolved;
+    if (context->aa.mode != AA_NONE) {
+        desc.samples = context->aa.samples;
+        scene = graph_create(g, "scene", &desc);
+    }
+    context->scene_target = scene;
+    context->resolved_target = resolved;
+
+    int particles = -1;
+    if (context->particles.count) {
+        particles = graph_buffer(g, "particles");
+        int pass = graph_pass(g, "simulate", simulate_pass, context);
+        graph_write(g, pass, particles);
+    }
+    int pass = graph_pass(g, "scene", scene_pass, context);
+    if (particles >= 0)
+        graph_read(g, pass, particles);
+    graph_write(g, pass, scene);
+    if (scene != resolved) {
+        pass = graph_pass(g, "aa", aa_pass, context);
+        graph_read(g, pass, scene);
+        graph_write(g, pass, resolved);
+    }
+    if (resolved != window) {
+        pass = graph_pass(g, "upscale", upscale_pass, context);
+        graph_read(g, pass, resolved);
+        graph_write(g, pass, window);
+    }
+    pass = graph_pass(g, "hud", hud_pass, context);
+    graph_write(g, pass, window);
+}
+
+static void
+render(struct graphics_context *context)
+{
+    int width, height;
+    glfwGetFramebufferSize(context->window, &width, &height);
+    build_frame(context, width, height);
+    graph_execute(&context->graph);
+    target_pool_frame(&context->pool);
+    struct sprite_stats stats = context->scene_stats;
 
     /* Physics */
     double now = glfwGetTime();
     double udiff = now - context->lastframe;
     context->angle += 1.0 * udiff;
+    context->pan += 0.2 * udiff;
     if (context->angle > 2 * M_PI)
         context->angle -= 2 * M_PI;
     context->framecount++;
+    hud_frame(&context->hud, udiff);
     if ((long)now != (long)context->lastframe) {
-        printf("FPS: %ld\n", context->framecount);
+        struct hud *hud = &context->hud;
+        hud_clear(hud);
+        hud_printf(hud, "FPS: %ld", context->framecount);
+        hud_printf(hud, "AA %s: scene %.2f ms, resolve %.2f ms",
+                   aa_mode_names[context->aa.mode], context->aa.scene_ms,
+                   context->aa.resolve_ms);
+        struct graph_stats *gs = &context->graph.stats;
+        hud_printf(hud, "graph: %d passes, %d culled, %d binds",
+                   gs->passes, gs->culled, gs->binds);
+        hud_printf(hud, "%d transient targets in %d",
+                   gs->transients, gs->targets);
+        struct target_pool_stats *ps = &context->pool.stats;
+        hud_printf(hud, "pool: %d targets, %.1f MB, %.1f%% hits",
+                   ps->targets, ps->bytes / 1048576.0,
+                   target_pool_hit_rate(&context->pool) * 100);
+        if (context->dynres.target) {
+            struct dynres *d = &context->dynres;
+            hud_printf(hud, "scene %dx%d, %.2f ms on the GPU",
+                       d->view[0], d->view[1], d->gpu_ms);
+        }
+        if (context->sprite_count) {
+            hud_printf(hud, "%zu sprites in %zu batches",
+                       stats.sprites, stats.batches);
+            hud_printf(hud, "breaks: %zu texture, %zu full",
+                       stats.texture_breaks, stats.full_breaks);
+            hud_printf(hud, "atlas %.0f%% used",
+                       atlas_usage(&context->atlas) * 100);
+        } else if (context->particles.count) {
+            if (context->cpu_simulation)
+                hud_printf(hud, "%ld particles on the CPU, %d threads",
+                           (long) context->particles.count, jobs_threads());
+            else
+                hud_printf(hud, "%ld particles on the GPU",
+                           (long) context->particles.count);
+        } else if (context->instances.count) {
+            hud_printf(hud, "%zu of %zu instances visible",
+                       context->visible_count, context->instances.count);
+        }
         context->framecount = 0;
     }
     context->lastframe = now;
 
+    gl3wCaptureFrame();
     glfwSwapBuffers(context->window);
 }
 
+#define BENCH_WARMUP 10
+#define BENCH_FRAMES 60
+
+/* Runs one simulation for a fixed number of frames with a fixed step,
+ * finishing each update and draw so device time is counted too.
+ * Every particle is born by the first timed frame.
+ */
+static void
+time_particles(bool cpu, long count, double *update, double *frame)
+{
+    struct particle_system gpu;
+    struct cpu_particles host;
+    if (cpu) {
+        cpu_particles_init(&host, count);
+        cpu_particles_update(&host, PARTICLE_LIFETIME);
+    } else {
+        particle_init(&gpu, count);
+        particle_update(&gpu, PARTICLE_LIFETIME);
+    }
+    double start = 0;
+    *update = 0;
+    for (int i = 0; i < BENCH_WARMUP + BENCH_FRAMES; i++) {
+        if (i == BENCH_WARMUP) {
+            start = glfwGetTime();
+            *update = 0;
+        }
+        double t = glfwGetTime();
+        if (cpu)
+            cpu_particles_update(&host, 1 / 60.0f);
+        else
+            particle_update(&gpu, 1 / 60.0f);
+        glFinish();
+        *update += glfwGetTime() - t;
+        glClear(GL_COLOR_BUFFER_BIT);
+        if (cpu)
+            cpu_particles_draw(&host);
+        else
+            particle_draw(&gpu);
+        glFinish();
+    }
+    *update = *update / BENCH_FRAMES * 1000;
+    *frame = (glfwGetTime() - start) / BENCH_FRAMES * 1000;
+    if (cpu)
+        cpu_particles_free(&host);
+    else
+        particle_free(&gpu);
+}
+
+/* Compares the CPU and GPU particle simulations at growing counts. */
+static void
+benchmark_particles(void)
+{
+    static const long counts[] = {10000, 30000, 100000, 300000, 1000000};
+    printf("CPU simulation on %d threads, times in ms per frame\n",
+           jobs_threads());
+    printf("%10s %10s %10s %10s %10s\n",
+           "particles", "cpu step", "cpu total", "gpu step", "gpu total");
+    for (size_t i = 0; i < countof(counts); i++) {
+        double cpu[2], gpu[2];
+        time_particles(true, counts[i], cpu, cpu + 1);
+        time_particles(false, counts[i], gpu, gpu + 1);
+        printf("%10ld %10.2f %10.2f %10.2f %10.2f%s\n", counts[i],
+               cpu[0], cpu[1], gpu[0], gpu[1],
+               cpu[1] < gpu[1] ? "  (cpu faster)" : "");
+    }
+}
+
+/* Uploads a mesh file and returns the shader features it needs. The
+ * COMPRESSED variant's dequantization expands quantized positions and
+ * scales the mesh to the square's extent.
+ */
+static unsigned
+load_mesh(struct graphics_context *context, const char *path,
+          float dequant[4])
+{
+    struct mesh mesh;
+    if (mesh_open(&mesh, path)) {
+        fprintf(stderr, "error: %s: %s\n", path, strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+    mesh_upload(&mesh, &context->mesh);
+
+    const struct mesh_header *h = mesh.header;
+    float w = h->bounds[1][0] - h->bounds[0][0];
+    float t = h->bounds[1][1] - h->bounds[0][1];
+    float scale = 2.0f / (w > t ? w : t);
+    if (h->flags & MESH_QUANTIZED) {
+        /* Stored positions span [-1, 1] over the bounds */
+        dequant[0] = w / 2 * scale;
+        dequant[1] = t / 2 * scale;
+        dequant[2] = 0;
+        dequant[3] = 0;
+    } else {
+        dequant[0] = scale;
+        dequant[1] = scale;
+        dequant[2] = -(h->bounds[0][0] + h->bounds[1][0]) / 2 * scale;
+        dequant[3] = -(h->bounds[0][1] + h->bounds[1][1]) / 2 * scale;
+    }
+
+    unsigned features = SHADER_COMPRESSED;
+    for (uint32_t i = 0; i < h->attrib_count; i++)
+        if (h->attribs[i].location == ATTRIB_COLOR)
+            features |= SHADER_VERTEX_COLOR;
+    mesh_close(&mesh);
+    return features;
+}
+
+/* Mode used when tracing is toggled on at run time. */
+static int trace_mode = GL3W_TRACE_CALLS;
+
+static int
+trace_cmp(const void *a, const void *b)
+{
+    const struct GL3WTraceStat *stats = gl3wTraceStats();
+    double sa = stats[*(const int *) a].seconds;
+    double sb = stats[*(const int *) b].seconds;
+    return (sa < sb) - (sa > sb);
+}
+
+static void
+trace_report(void)
+{
+    const struct GL3WTraceStat *stats = gl3wTraceStats();
+    int order[GL3W_PROC_COUNT];
+    int n = 0;
+    for (int i = 0; i < GL3W_PROC_COUNT; i++)
+        if (stats[i].calls)
+            order[n++] = i;
+    qsort(order, n, sizeof(*order), trace_cmp);
+    fprintf(stderr, "%-32s %10s %12s %10s %8s\n",
+            "entry point", "calls", "total ms", "avg us", "errors");
+    for (int i = 0; i < n; i++) {
+        const struct GL3WTraceStat *s = stats + order[i];
+        fprintf(stderr, "%-32s %10lu %12.3f %10.3f %8lu\n",
+                gl3wProcName(order[i]), s->calls, s->seconds * 1e3,
+                s->seconds * 1e6 / s->calls, s->errors);
+    }
+    gl3wTraceReset();
+}
+
 static void
 key_callback(GLFWwindow *window, int key, int scancode, int action, int mods)
 {
     (void) scancode;
     (void) mods;
+    struct graphics_context *context = glfwGetWindowUserPointer(window);
     if (key == GLFW_KEY_Q && action == GLFW_PRESS)
         glfwSetWindowShouldClose(window, GL_TRUE);
+    if (key == GLFW_KEY_M && action == GLFW_PRESS && context->grid) {
+        context->multidraw = !context->multidraw;
+        printf("Submission: %s\n", context->multidraw ?
+               (gl3wIsSupported(4, 3) ? "multi-draw indirect" : "multi-draw")
+               : "one call per square");
+    }
+    if (key == GLFW_KEY_C && action == GLFW_PRESS &&
+        context->instances.count) {
+        context->gpu_culling = !context->gpu_culling;
+        printf("Culling: %s\n", context->gpu_culling ? "GPU" : "CPU");
+    }
+    if (key == GLFW_KEY_P && action == GLFW_PRESS &&
+        context->particles.count) {
+        context->cpu_simulation = !context->cpu_simulation;
+        printf("Particles: %s\n", context->cpu_simulation ? "CPU" : "GPU");
+    }
+    if (key == GLFW_KEY_A && action == GLFW_PRESS) {
+        enum aa_mode mode = (context->aa.mode + 1) % AA_MODE_COUNT;
+        aa_free(&context->aa);
+        aa_init(&context->aa, mode);
+        printf("Anti-aliasing: %s\n", aa_mode_names[mode]);
+    }
+    if (key == GLFW_KEY_T && action == GLFW_PRESS) {
+        /* Leave a running capture alone */
+        int mode = gl3wTraceMode();
+        if (mode & ~GL3W_TRACE_CAPTURE) {
+            gl3wTrace(mode & GL3W_TRACE_CAPTURE);
+            trace_report();
+        } else {
+            gl3wTrace(mode | trace_mode);
+        }
+    }
 }
 
 int
@@ -110,14 +855,97 @@ main(int argc, char **argv)
 {
     /* Options */
     bool fullscreen = false;
+    bool precompile = false;
+    bool trace = false;
+    bool debug = false;
+    const char *capture = NULL;
+    const char *mesh = NULL;
+    int grid = 0;
+    long instances = 0;
+    long sprites = 0;
+    long particles = 0;
+    bool benchmark = false;
+    double target_ms = 0;
+    enum aa_mode aa_mode = AA_MSAA4;
+    const char *streamed[8];
+    int streamed_count = 0;
+    enum mipmap_filter filter = MIPMAP_BOX;
     const char *title = "OpenGL 3.3 Demo";
 
     int opt;
-    while ((opt = getopt(argc, argv, "f")) != -1) {
+    while ((opt = getopt(argc, argv, "fc:ptTr:dm:g:i:s:e:xD:a:l:b:")) != -1) {
         switch (opt) {
             case 'f':
                 fullscreen = true;
                 break;
+            case 'c':
+                shader_cache_dir(optarg);
+                break;
+            case 'p':
+                precompile = true;
+                break;
+            case 't':
+                trace = true;
+                break;
+            case 'T':
+                trace = true;
+                trace_mode = GL3W_TRACE_ERRORS;
+                break;
+            case 'r':
+                capture = optarg;
+                break;
+            case 'd':
+                debug = true;
+                break;
+            case 'm':
+                mesh = optarg;
+                break;
+            case 'g':
+                grid = atoi(optarg);
+                break;
+            case 'i':
+                instances = atol(optarg);
+                break;
+            case 's':
+                sprites = atol(optarg);
+                break;
+            case 'e':
+                particles = atol(optarg);
+                break;
+            case 'x':
+                benchmark = true;
+                break;
+            case 'D':
+                target_ms = atof(optarg);
+                break;
+            case 'a': {
+                int mode = aa_parse(optarg);
+                if (mode < 0) {
+                    fprintf(stderr, "error: unknown AA mode %s\n", optarg);
+                    exit(EXIT_FAILURE);
+                }
+                aa_mode = mode;
+                break;
+            }
+            case 'l':
+                if (streamed_count == countof(streamed)) {
+                    fprintf(stderr, "error: too many images\n");
+                    exit(EXIT_FAILURE);
+                }
+                streamed[streamed_count++] = optarg;
+                break;
+            case 'b':
+                if (!strcmp(optarg, "none")) {
+                    filter = MIPMAP_NONE;
+                } else if (!strcmp(optarg, "box")) {
+                    filter = MIPMAP_BOX;
+                } else if (!strcmp(optarg, "kaiser")) {
+                    filter = MIPMAP_KAISER;
+                } else {
+                    fprintf(stderr, "error: unknown filter %s\n", optarg);
+                    exit(EXIT_FAILURE);
+                }
+                break;
             default:
                 exit(EXIT_FAILURE);
         }
@@ -129,12 +957,13 @@ main(int argc, char **argv)
         fprintf(stderr, "GLFW3: failed to initialize\n");
         exit(EXIT_FAILURE);
     }
-    glfwWindowHint(GLFW_SAMPLES, 4);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
     glfwWindowHint(GLFW_RESIZABLE, GL_FALSE);
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    if (debug)
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);
     if (fullscreen) {
         GLFWmonitor *monitor = glfwGetPrimaryMonitor();
         const GLFWvidmode *m = glfwGetVideoMode(monitor);
@@ -147,36 +976,59 @@ main(int argc, char **argv)
     glfwMakeContextCurrent(context.window);
     glfwSwapInterval(1);
 
-    /* Initialize gl3w */
-    if (gl3wInit()) {
-        fprintf(stderr, "gl3w: failed to initialize\n");
+    /* Initialize gl3w, loading only the entry points this program uses */
+    struct GL3WSubset subset = {3, 3, NULL, gl3w_manifest};
+    switch (gl3wInitSubset(&subset)) {
+        case GL3W_OK:
+            break;
+        case GL3W_ERROR_MISSING:
+            fprintf(stderr, "gl3w: missing %s\n", gl3wMissing());
+            exit(EXIT_FAILURE);
+        default:
+            fprintf(stderr, "gl3w: failed to initialize\n");
+            exit(EXIT_FAILURE);
+    }
+    if (debug && debug_init(2.0))
+        fprintf(stderr, "warning: KHR_debug unsupported\n");
+    if (trace)
+        gl3wTrace(trace_mode);
+    if (capture && streamed_count) {
+        /* The streaming context's calls would interleave in the trace */
+        fprintf(stderr, "error: -r and -l can't be combined\n");
+        exit(EXIT_FAILURE);
+    }
+    if (capture && gl3wCaptureStart(capture)) {
+        fprintf(stderr, "gl3w: could not capture to %s\n", capture);
         exit(EXIT_FAILURE);
     }
 
-    /* Shader sources */
-    const GLchar *vert_shader =
-        "#version 330\n"
-        "layout(location = 0) in vec2 point;\n"
-        "uniform float angle;\n"
-        "void main() {\n"
-        "    mat2 rotate = mat2(cos(angle), -sin(angle),\n"
-        "                       sin(angle), cos(angle));\n"
-        "    gl_Position = vec4(0.75 * rotate * point, 0.0, 1.0);\n"
-        "}\n";
-    const GLchar *frag_shader =
-        "#version 330\n"
-        "out vec4 color;\n"
-        "void main() {\n"
-        "    color = vec4(1, 0.15, 0.15, 0);\n"
-        "}\n";
+    jobs_init(0);
 
     /* Compile and link OpenGL program */
-    GLuint vert = compile_shader(GL_VERTEX_SHADER, vert_shader);
-    GLuint frag = compile_shader(GL_FRAGMENT_SHADER, frag_shader);
-    context.program = link_program(vert, frag);
+    shader_set_init(&context.shaders, &QUAD_SHADER);
+    if (precompile)
+        shader_set_precompile(&context.shaders);
+    unsigned features = 0;
+    float dequant[4];
+    context.mesh.vao = 0;
+    context.grid = 0;
+    context.instances.count = 0;
+    context.sprite_count = 0;
+    context.particles.count = 0;
+    context.cpu_simulation = false;
+    if (mesh)
+        features = load_mesh(&context, mesh, dequant);
+    else if (instances > 0)
+        features = SHADER_INSTANCING;
+    context.program = shader_variant(&context.shaders, features);
     context.uniform_angle = glGetUniformLocation(context.program, "angle");
-    glDeleteShader(frag);
-    glDeleteShader(vert);
+    context.uniform_camera = glGetUniformLocation(context.program, "camera");
+    if (features & SHADER_COMPRESSED) {
+        glUseProgram(context.program);
+        glUniform4fv(glGetUniformLocation(context.program, "dequant"),
+                     1, dequant);
+        glUseProgram(0);
+    }
 
     /* Prepare vertex buffer object (VBO) */
     glGenBuffers(1, &context.vbo_point);
@@ -193,7 +1045,45 @@ main(int argc, char **argv)
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
 
+    if (grid > 0)
+        init_grid(&context, grid);
+    if (instances > 0 && !mesh)
+        init_instances(&context, instances);
+    sprite_batch_init(&context.batch);
+    hud_init(&context.hud, 2);
+    int width, height;
+    glfwGetFramebufferSize(context.window, &width, &height);
+    aa_init(&context.aa, aa_mode);
+    target_pool_init(&context.pool, 60);  /* about a second */
+    graph_init(&context.graph, &context.pool);
+    context.dynres.target = 0;
+    if (target_ms > 0)
+        dynres_init(&context.dynres, width, height, target_ms);
+    if (sprites > 0)
+        init_sprites(&context, sprites);
+    if (particles > 0) {
+        particle_init(&context.particles, particles);
+        cpu_particles_init(&context.cpu_particles, particles);
+    }
+    context.streamed_count = 0;
+    if (streamed_count) {
+        if (streamer_init(&context.streamer, context.window)) {
+            fprintf(stderr, "GLFW3: failed to create streaming context\n");
+            exit(EXIT_FAILURE);
+        }
+        context.streamer.filter = filter;
+        for (int i = 0; i < streamed_count; i++)
+            stream_load(&context.streamer, context.streamed + i, streamed[i]);
+        context.streamed_count = streamed_count;
+    }
+
+    if (benchmark) {
+        benchmark_particles();
+        glfwSetWindowShouldClose(context.window, GL_TRUE);
+    }
+
     /* Start main loop */
+    glfwSetWindowUserPointer(context.window, &context);
     glfwSetKeyCallback(context.window, key_callback);
     context.lastframe = glfwGetTime();
     context.framecount = 0;
@@ -202,11 +1092,54 @@ main(int argc, char **argv)
         glfwPollEvents();
     }
     fprintf(stderr, "Exiting ...\n");
+    if (gl3wTraceMode() & ~GL3W_TRACE_CAPTURE) {
+        gl3wTrace(gl3wTraceMode() & GL3W_TRACE_CAPTURE);
+        trace_report();
+    }
 
     /* Cleanup and exit */
     glDeleteVertexArrays(1, &context.vao_point);
     glDeleteBuffers(1, &context.vbo_point);
-    glDeleteProgram(context.program);
+    if (context.mesh.vao)
+        mesh_gl_free(&context.mesh);
+    if (context.grid) {
+        glDeleteVertexArrays(1, &context.vao_grid);
+        glDeleteBuffers(1, &context.vbo_grid);
+        draw_list_free(&context.draws);
+    }
+    if (context.instances.count) {
+        glDeleteVertexArrays(1, &context.vao_instance);
+        glDeleteBuffers(1, &context.vbo_instance);
+        gpu_cull_free(&context.gpu_cull);
+        glDeleteBuffers(1, &context.vbo_world);
+        cull_set_free(&context.instances);
+        free(context.visible);
+    }
+    if (context.sprite_count)
+        atlas_free(&context.atlas);
+    if (context.streamed_count) {
+        streamer_free(&context.streamer);
+        for (int i = 0; i < context.streamed_count; i++) {
+            struct stream_texture *t = context.streamed + i;
+            if (t->fence)
+                glDeleteSync(t->fence);
+            glDeleteTextures(1, &t->texture);
+        }
+    }
+    if (context.particles.count) {
+        particle_free(&context.particles);
+        cpu_particles_free(&context.cpu_particles);
+    }
+    if (context.dynres.target)
+        dynres_free(&context.dynres);
+    target_pool_free(&context.pool);
+    aa_free(&context.aa);
+    hud_free(&context.hud);
+    sprite_batch_free(&context.batch);
+    jobs_shutdown();
+    shader_set_free(&context.shaders);
+    gl3wCaptureStop();
+    debug_shutdown();
 
     glfwTerminate();
     return 0;
@@ -0,0 +1,169 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "drawlist.h"
+
+static size_t
+command_size(const struct draw_list *list)
+{
+    return list->index_type ? sizeof(struct draw_elements_command)
+                            : sizeof(struct draw_arrays_command);
+}
+
+static size_t
+index_size(GLenum type)
+{
+    switch (type) {
+        case GL_UNSIGNED_BYTE:  return 1;
+        case GL_UNSIGNED_SHORT: return 2;
+    }
+    return 4;
+}
+
+static void *
+push(struct draw_list *list)
+{
+    if (list->len == list->cap) {
+        size_t cap = list->cap ? list->cap * 2 : 256;
+        void *commands = realloc(list->commands, cap * command_size(list));
+        /* Room for first/count (or offset) and base vertex per draw */
+        void *fallback = realloc(list->fallback,
+                                 cap * (sizeof(void *) + 2 * sizeof(GLint)));
+        if (!commands || !fallback) {
+            fprintf(stderr, "error: out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+        list->commands = commands;
+        list->fallback = fallback;
+        list->cap = cap;
+    }
+    return (char *) list->commands + list->len++ * command_size(list);
+}
+
+void
+draw_list_init(struct draw_list *list, GLenum index_type)
+{
+    memset(list, 0, sizeof(*list));
+    list->index_type = index_type;
+}
+
+void
+draw_list_clear(struct draw_list *list)
+{
+    list->len = 0;
+}
+
+void
+draw_list_arrays(struct draw_list *list, GLuint first, GLuint count,
+                 GLuint instances, GLuint base_instance)
+{
+    struct draw_arrays_command *c = push(list);
+    c->count = count;
+    c->instance_count = instances;
+    c->first = first;
+    c->base_instance = base_instance;
+}
+
+void
+draw_list_elements(struct draw_list *list, GLuint first_index, GLuint count,
+                   GLint base_vertex, GLuint instances, GLuint base_instance)
+{
+    struct draw_elements_command *c = push(list);
+    c->count = count;
+    c->instance_count = instances;
+    c->first_index = first_index;
+    c->base_vertex = base_vertex;
+    c->base_instance = base_instance;
+}
+
+static void
+submit_indirect(struct draw_list *list, GLenum mode)
+{
+    size_t size = list->len * command_size(list);
+    if (!list->buffer)
+        glGenBuffers(1, &list->buffer);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, list->buffer);
+    if (size > list->buffer_size)
+        list->buffer_size = size * 2;
+    /* Orphan the storage rather than wait on last frame's draws */
+    glBufferData(GL_DRAW_INDIRECT_BUFFER, list->buffer_size, NULL,
+                 GL_STREAM_DRAW);
+    glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, size, list->commands);
+    if (list->index_type)
+        glMultiDrawElementsIndirect(mode, list->index_type, 0, list->len, 0);
+    else
+        glMultiDrawArraysIndirect(mode, 0, list->len, 0);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
+static void
+submit_arrays(struct draw_list *list, GLenum mode)
+{
+    const struct draw_arrays_command *c = list->commands;
+    GLint *firsts = list->fallback;
+    GLsizei *counts = firsts + list->len;
+    GLsizei n = 0;
+    for (size_t i = 0; i < list->len; i++) {
+        if (c[i].instance_count == 1) {
+            firsts[n] = c[i].first;
+            counts[n++] = c[i].count;
+        } else if (c[i].instance_count) {
+            glDrawArraysInstanced(mode, c[i].first, c[i].count,
+                                  c[i].instance_count);
+        }
+    }
+    if (n)
+        glMultiDrawArrays(mode, firsts, counts, n);
+}
+
+static void
+submit_elements(struct draw_list *list, GLenum mode)
+{
+    const struct draw_elements_command *c = list->commands;
+    size_t size = index_size(list->index_type);
+    const void **offsets = list->fallback;
+    GLsizei *counts = (GLsizei *) (offsets + list->len);
+    GLint *base_vertices = counts + list->len;
+    GLsizei n = 0;
+    for (size_t i = 0; i < list->len; i++) {
+        const void *offset = (void *) (uintptr_t) (c[i].first_index * size);
+        if (c[i].instance_count == 1) {
+            offsets[n] = offset;
+            counts[n] = c[i].count;
+            base_vertices[n++] = c[i].base_vertex;
+        } else if (c[i].instance_count) {
+            glDrawElementsInstancedBaseVertex(mode, c[i].count,
+                                              list->index_type, offset,
+                                              c[i].instance_count,
+                                              c[i].base_vertex);
+        }
+    }
+    if (n)
+        glMultiDrawElementsBaseVertex(mode, counts, list->index_type,
+                                      offsets, n, base_vertices);
+}
+
+void
+draw_list_submit(struct draw_list *list, GLenum mode)
+{
+    if (!list->len)
+        return;
+    if (gl3wIsSupported(4, 3))
+        submit_indirect(list, mode);
+    else if (list->index_type)
+        submit_elements(list, mode);
+    else
+        submit_arrays(list, mode);
+}
+
+void
+draw_list_free(struct draw_list *list)
+{
+    if (list->buffer)
+        glDeleteBuffers(1, &list->buffer);
+    free(list->commands);
+    free(list->fallback);
+    memset(list, 0, sizeof(*list));
+}
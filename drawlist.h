@@ -0,0 +1,52 @@
+#ifndef DRAWLIST_H
+#define DRAWLIST_H
+
+#include <stddef.h>
+#include <GL/gl3w.h>
+
+/* Layouts fixed by the GL for indirect draws */
+struct draw_arrays_command {
+    GLuint count;
+    GLuint instance_count;
+    GLuint first;
+    GLuint base_instance;
+};
+
+struct draw_elements_command {
+    GLuint count;
+    GLuint instance_count;
+    GLuint first_index;
+    GLint base_vertex;
+    GLuint base_instance;
+};
+
+/* A frame's worth of draws from one vertex array, submitted together.
+ * With OpenGL 4.3 the commands are uploaded to a draw indirect buffer
+ * and issued by a single glMultiDraw*Indirect call. On older contexts
+ * they go through glMultiDrawArrays/glMultiDrawElementsBaseVertex,
+ * where instanced commands cost a call each and base instances are
+ * ignored.
+ */
+struct draw_list {
+    GLenum index_type;  /* 0 for non-indexed draws */
+    size_t len;
+    size_t cap;
+    void *commands;
+    GLuint buffer;
+    size_t buffer_size;
+    void *fallback;     /* scratch for the glMultiDraw* argument arrays */
+};
+
+void draw_list_init(struct draw_list *, GLenum index_type);
+void draw_list_clear(struct draw_list *);
+void draw_list_arrays(struct draw_list *, GLuint first, GLuint count,
+                      GLuint instances, GLuint base_instance);
+void draw_list_elements(struct draw_list *, GLuint first_index,
+                        GLuint count, GLint base_vertex,
+                        GLuint instances, GLuint base_instance);
+
+/* Draws everything in the list. The vertex array must be bound. */
+void draw_list_submit(struct draw_list *, GLenum mode);
+void draw_list_free(struct draw_list *);
+
+#endif
@@ -0,0 +1,101 @@
+#include <math.h>
+
+#include "dynres.h"
+
+#define MIN_SCALE 0.25f
+#define MAX_STEP  1.25f  /* largest change of scale per adjustment */
+#define DEADBAND  0.1    /* ignore times within 10% of the target */
+
+void
+dynres_init(struct dynres *d, int width, int height, double target_ms)
+{
+    d->width = width;
+    d->height = height;
+    d->view[0] = width;
+    d->view[1] = height;
+    d->scale = 1;
+    d->target = target_ms;
+    d->gpu_ms = 0;
+    d->next = 0;
+    d->sum = 0;
+    d->samples = 0;
+    for (int i = 0; i < DYNRES_SLOTS; i++)
+        d->pending[i] = 0;
+    glGenQueries(DYNRES_SLOTS, d->queries);
+}
+
+/* Sizes are kept to multiples of 8 pixels so small swings in timing
+ * don't resize every period.
+ */
+static void
+adjust(struct dynres *d, double ms)
+{
+    d->gpu_ms = ms;
+    double ratio = d->target / (ms > 0.01 ? ms : 0.01);
+    if (fabs(ratio - 1) < DEADBAND)
+        return;
+    float step = sqrtf(ratio);
+    step = fminf(fmaxf(step, 1 / MAX_STEP), MAX_STEP);
+    d->scale = fminf(fmaxf(d->scale * step, MIN_SCALE), 1);
+    for (int i = 0; i < 2; i++) {
+        int full = i ? d->height : d->width;
+        int size = (int) (full * d->scale) / 8 * 8;
+        d->view[i] = size < 8 ? (full < 8 ? full : 8) : size;
+    }
+}
+
+void
+dynres_update(struct dynres *d)
+{
+    for (int i = 0; i < DYNRES_SLOTS; i++) {
+        if (!d->pending[i])
+            continue;
+        GLuint available = 0;
+        glGetQueryObjectuiv(d->queries[i], GL_QUERY_RESULT_AVAILABLE,
+                            &available);
+        if (!available)
+            continue;
+        GLuint64 ns;
+        glGetQueryObjectui64v(d->queries[i], GL_QUERY_RESULT, &ns);
+        d->pending[i] = 0;
+        d->sum += ns / 1e6;
+        if (++d->samples == DYNRES_PERIOD) {
+            adjust(d, d->sum / d->samples);
+            d->sum = 0;
+            d->samples = 0;
+        }
+    }
+}
+
+void
+dynres_begin(struct dynres *d)
+{
+    /* With every query in flight this frame goes untimed */
+    if (!d->pending[d->next])
+        glBeginQuery(GL_TIME_ELAPSED, d->queries[d->next]);
+}
+
+void
+dynres_end(struct dynres *d)
+{
+    if (!d->pending[d->next]) {
+        glEndQuery(GL_TIME_ELAPSED);
+        d->pending[d->next] = 1;
+        d->next = (d->next + 1) % DYNRES_SLOTS;
+    }
+}
+
+void
+dynres_upscale(struct dynres *d, GLuint src)
+{
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, src);
+    glBlitFramebuffer(0, 0, d->view[0], d->view[1],
+                      0, 0, d->width, d->height,
+                      GL_COLOR_BUFFER_BIT, GL_LINEAR);
+}
+
+void
+dynres_free(struct dynres *d)
+{
+    glDeleteQueries(DYNRES_SLOTS, d->queries);
+}
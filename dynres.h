@@ -0,0 +1,50 @@
+#ifndef DYNRES_H
+#define DYNRES_H
+
+#include <GL/gl3w.h>
+
+#define DYNRES_SLOTS  4   /* timer queries in flight */
+#define DYNRES_PERIOD 8   /* timed frames per adjustment */
+
+/* Picks the size to render the scene at, a fraction of the window's,
+ * for the caller to scale up to the window. Each scene is timed on the
+ * GPU with a timer query read back frames later, once available.
+ * Every DYNRES_PERIOD timed frames the render size is adjusted to
+ * bring the average toward the target: fill cost follows the pixel
+ * count, so both sides scale by the square root of the ratio. The
+ * caller's target keeps the window's size and only the viewport
+ * shrinks, so adjustments never reallocate.
+ */
+struct dynres {
+    int width, height;    /* window size */
+    int view[2];          /* current render size */
+    float scale;          /* render size over window size */
+    double target;        /* milliseconds */
+    double gpu_ms;        /* last adjustment's average */
+    GLuint queries[DYNRES_SLOTS];
+    int pending[DYNRES_SLOTS];
+    unsigned next;
+    double sum;
+    int samples;
+};
+
+void dynres_init(struct dynres *, int width, int height, double target_ms);
+
+/* Reads back finished timings and adjusts the render size. Call once
+ * per frame before anything reads view, so the scene, its resolve and
+ * the upscale all use the same size.
+ */
+void dynres_update(struct dynres *);
+
+/* Start and stop timing the scene. */
+void dynres_begin(struct dynres *);
+void dynres_end(struct dynres *);
+
+/* Scales the view region of framebuffer src up to the whole draw
+ * framebuffer with one filtered blit.
+ */
+void dynres_upscale(struct dynres *, GLuint src);
+
+void dynres_free(struct dynres *);
+
+#endif
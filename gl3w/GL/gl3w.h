@@ -41,1415 +41,1648 @@
 extern "C" {
 #endif
 
+#define GL3W_OK 0
+#define GL3W_ERROR_INIT -1
+#define GL3W_ERROR_OPENGL_VERSION -3
+#define GL3W_ERROR_MISSING -4
+
 typedef void (*GL3WglProc)(void);
 
+/* What an application needs from the context. All lists are NULL
+ * terminated and optional. Core entry points up to major.minor and the
+ * entry points of the listed extensions are required. A manifest, when
+ * given, limits loading to the entry points it names; those outside
+ * the required set are loaded if available but may be missing. Entry
+ * points of extensions promoted to core are declared under their core
+ * version only, so list them in the manifest.
+ */
+struct GL3WSubset {
+	int major, minor;
+	const char *const *extensions;
+	const char *const *procs;
+};
+
 /* gl3w api */
 int gl3wInit(void);
 int gl3wIsSupported(int major, int minor);
 GL3WglProc gl3wGetProcAddress(const char *proc);
 
+/* Load only the entry points a subset needs. Everything else points at
+ * a stub that reports its name and aborts when called. Returns GL3W_OK,
+ * or GL3W_ERROR_MISSING with gl3wMissing() naming the first required
+ * extension or entry point the context lacks.
+ */
+int gl3wInitSubset(const struct GL3WSubset *subset);
+const char *gl3wMissing(void);
+
+/* Slot of a core entry point in gl3wProcs, or -1 if unknown. */
+int gl3wProcIndex(const char *proc);
+const char *gl3wProcName(int slot);
+
+/* Instrumented dispatch. While tracing, every loaded entry point in
+ * gl3wProcs is swapped for a wrapper that counts calls and their CPU
+ * time and, with GL3W_TRACE_ERRORS, checks glGetError() after each
+ * call. GL3W_TRACE_OFF swaps the driver's entry points back, so tracing
+ * costs nothing while it's off. Statistics are indexed by slot. Built
+ * with GCC or Clang they are updated atomically, so several GL threads
+ * may be traced at once; other compilers update them unsynchronized,
+ * so trace one GL thread at a time there.
+ */
+#define GL3W_TRACE_OFF    0
+#define GL3W_TRACE_CALLS  1
+#define GL3W_TRACE_ERRORS 3
+#define GL3W_TRACE_CAPTURE 4
+
+struct GL3WTraceStat {
+	unsigned long calls;
+	unsigned long errors;
+	double seconds;
+};
+
+void gl3wTrace(int mode);
+int gl3wTraceMode(void);
+const struct GL3WTraceStat *gl3wTraceStats(void);
+void gl3wTraceReset(void);
+
+/* Capture records every call with its arguments, and the data behind
+ * its pointers, to a trace file for gl3wReplay(). It is a trace mode of
+ * its own and combines with the others. gl3wCaptureFrame() marks the
+ * end of a frame. Objects are remapped at replay, so start capturing
+ * before the application creates any. Capture isn't synchronized:
+ * make GL calls from one thread while it runs.
+ */
+int gl3wCaptureStart(const char *path);
+void gl3wCaptureFrame(void);
+void gl3wCaptureStop(void);
+
+/* Re-issue a captured trace held in memory on the current context.
+ * frame, if given, is called at each frame marker, e.g. to swap
+ * buffers. GL3W_REPLAY_TIMED keeps the original call timing, otherwise
+ * calls are issued as fast as possible. Returns 0, or -1 for a trace
+ * that is malformed or truncated.
+ */
+#define GL3W_REPLAY_TIMED 1
+
+struct GL3WReplayStats {
+	unsigned long calls;
+	unsigned long skipped;
+	unsigned long frames;
+};
+
+int gl3wReplay(const void *trace, size_t size, int flags,
+	       void (*frame)(void *), void *arg, struct GL3WReplayStats *stats);
+
+/* Extension registry. The extensions the context advertises are
+ * enumerated once at init into a hash set, so gl3wIsExtensionSupported()
+ * takes constant time. Extensions known to glcorearb.h also get a
+ * compile-time ID and a bit in gl3wExtensions, making gl3wHasExt() a
+ * single bit test for use in hot paths.
+ */
+enum GL3WExtension {
+	GL3W_ARB_ES2_compatibility,
+	GL3W_ARB_ES3_1_compatibility,
+	GL3W_ARB_ES3_compatibility,
+	GL3W_ARB_arrays_of_arrays,
+	GL3W_ARB_base_instance,
+	GL3W_ARB_bindless_texture,
+	GL3W_ARB_blend_func_extended,
+	GL3W_ARB_buffer_storage,
+	GL3W_ARB_cl_event,
+	GL3W_ARB_clear_buffer_object,
+	GL3W_ARB_clear_texture,
+	GL3W_ARB_clip_control,
+	GL3W_ARB_compressed_texture_pixel_storage,
+	GL3W_ARB_compute_shader,
+	GL3W_ARB_compute_variable_group_size,
+	GL3W_ARB_conditional_render_inverted,
+	GL3W_ARB_conservative_depth,
+	GL3W_ARB_copy_buffer,
+	GL3W_ARB_copy_image,
+	GL3W_ARB_cull_distance,
+	GL3W_ARB_debug_output,
+	GL3W_ARB_depth_buffer_float,
+	GL3W_ARB_depth_clamp,
+	GL3W_ARB_derivative_control,
+	GL3W_ARB_direct_state_access,
+	GL3W_ARB_draw_buffers_blend,
+	GL3W_ARB_draw_elements_base_vertex,
+	GL3W_ARB_draw_indirect,
+	GL3W_ARB_enhanced_layouts,
+	GL3W_ARB_explicit_attrib_location,
+	GL3W_ARB_explicit_uniform_location,
+	GL3W_ARB_fragment_coord_conventions,
+	GL3W_ARB_fragment_layer_viewport,
+	GL3W_ARB_framebuffer_no_attachments,
+	GL3W_ARB_framebuffer_object,
+	GL3W_ARB_framebuffer_sRGB,
+	GL3W_ARB_get_program_binary,
+	GL3W_ARB_get_texture_sub_image,
+	GL3W_ARB_gpu_shader5,
+	GL3W_ARB_gpu_shader_fp64,
+	GL3W_ARB_half_float_vertex,
+	GL3W_ARB_imaging,
+	GL3W_ARB_indirect_parameters,
+	GL3W_ARB_internalformat_query,
+	GL3W_ARB_internalformat_query2,
+	GL3W_ARB_invalidate_subdata,
+	GL3W_ARB_map_buffer_alignment,
+	GL3W_ARB_map_buffer_range,
+	GL3W_ARB_multi_bind,
+	GL3W_ARB_multi_draw_indirect,
+	GL3W_ARB_occlusion_query2,
+	GL3W_ARB_pipeline_statistics_query,
+	GL3W_ARB_program_interface_query,
+	GL3W_ARB_provoking_vertex,
+	GL3W_ARB_query_buffer_object,
+	GL3W_ARB_robust_buffer_access_behavior,
+	GL3W_ARB_robustness,
+	GL3W_ARB_robustness_isolation,
+	GL3W_ARB_sample_shading,
+	GL3W_ARB_sampler_objects,
+	GL3W_ARB_seamless_cube_map,
+	GL3W_ARB_seamless_cubemap_per_texture,
+	GL3W_ARB_separate_shader_objects,
+	GL3W_ARB_shader_atomic_counters,
+	GL3W_ARB_shader_bit_encoding,
+	GL3W_ARB_shader_draw_parameters,
+	GL3W_ARB_shader_group_vote,
+	GL3W_ARB_shader_image_load_store,
+	GL3W_ARB_shader_image_size,
+	GL3W_ARB_shader_precision,
+	GL3W_ARB_shader_stencil_export,
+	GL3W_ARB_shader_storage_buffer_object,
+	GL3W_ARB_shader_subroutine,
+	GL3W_ARB_shader_texture_image_samples,
+	GL3W_ARB_shading_language_420pack,
+	GL3W_ARB_shading_language_include,
+	GL3W_ARB_shading_language_packing,
+	GL3W_ARB_sparse_buffer,
+	GL3W_ARB_sparse_texture,
+	GL3W_ARB_stencil_texturing,
+	GL3W_ARB_sync,
+	GL3W_ARB_tessellation_shader,
+	GL3W_ARB_texture_barrier,
+	GL3W_ARB_texture_buffer_object_rgb32,
+	GL3W_ARB_texture_buffer_range,
+	GL3W_ARB_texture_compression_bptc,
+	GL3W_ARB_texture_compression_rgtc,
+	GL3W_ARB_texture_cube_map_array,
+	GL3W_ARB_texture_gather,
+	GL3W_ARB_texture_mirror_clamp_to_edge,
+	GL3W_ARB_texture_multisample,
+	GL3W_ARB_texture_query_levels,
+	GL3W_ARB_texture_query_lod,
+	GL3W_ARB_texture_rg,
+	GL3W_ARB_texture_rgb10_a2ui,
+	GL3W_ARB_texture_stencil8,
+	GL3W_ARB_texture_storage,
+	GL3W_ARB_texture_storage_multisample,
+	GL3W_ARB_texture_swizzle,
+	GL3W_ARB_texture_view,
+	GL3W_ARB_timer_query,
+	GL3W_ARB_transform_feedback2,
+	GL3W_ARB_transform_feedback3,
+	GL3W_ARB_transform_feedback_instanced,
+	GL3W_ARB_transform_feedback_overflow_query,
+	GL3W_ARB_uniform_buffer_object,
+	GL3W_ARB_vertex_array_bgra,
+	GL3W_ARB_vertex_array_object,
+	GL3W_ARB_vertex_attrib_64bit,
+	GL3W_ARB_vertex_attrib_binding,
+	GL3W_ARB_vertex_type_10f_11f_11f_rev,
+	GL3W_ARB_vertex_type_2_10_10_10_rev,
+	GL3W_ARB_viewport_array,
+	GL3W_KHR_context_flush_control,
+	GL3W_KHR_debug,
+	GL3W_KHR_robust_buffer_access_behavior,
+	GL3W_KHR_robustness,
+	GL3W_KHR_texture_compression_astc_hdr,
+	GL3W_KHR_texture_compression_astc_ldr,
+	GL3W_EXTENSION_COUNT
+};
+
+extern unsigned gl3wExtensions[(GL3W_EXTENSION_COUNT + 31) / 32];
+
+#define gl3wHasExt(ext) ((gl3wExtensions[(ext) / 32] >> ((ext) % 32)) & 1u)
+
+int gl3wIsExtensionSupported(const char *ext);
+
+/* Resolve many entry points at once, each distinct name at most once.
+ * Returns the number of entry points found.
+ */
+int gl3wGetProcAddresses(const char *const *procs, GL3WglProc *res, int count);
+
 /* OpenGL functions */
-extern PFNGLACTIVESHADERPROGRAMPROC                         gl3wActiveShaderProgram;
-extern PFNGLACTIVETEXTUREPROC                               gl3wActiveTexture;
-extern PFNGLATTACHSHADERPROC                                gl3wAttachShader;
-extern PFNGLBEGINCONDITIONALRENDERPROC                      gl3wBeginConditionalRender;
-extern PFNGLBEGINQUERYPROC                                  gl3wBeginQuery;
-extern PFNGLBEGINQUERYINDEXEDPROC                           gl3wBeginQueryIndexed;
-extern PFNGLBEGINTRANSFORMFEEDBACKPROC                      gl3wBeginTransformFeedback;
-extern PFNGLBINDATTRIBLOCATIONPROC                          gl3wBindAttribLocation;
-extern PFNGLBINDBUFFERPROC                                  gl3wBindBuffer;
-extern PFNGLBINDBUFFERBASEPROC                              gl3wBindBufferBase;
-extern PFNGLBINDBUFFERRANGEPROC                             gl3wBindBufferRange;
-extern PFNGLBINDBUFFERSBASEPROC                             gl3wBindBuffersBase;
-extern PFNGLBINDBUFFERSRANGEPROC                            gl3wBindBuffersRange;
-extern PFNGLBINDFRAGDATALOCATIONPROC                        gl3wBindFragDataLocation;
-extern PFNGLBINDFRAGDATALOCATIONINDEXEDPROC                 gl3wBindFragDataLocationIndexed;
-extern PFNGLBINDFRAMEBUFFERPROC                             gl3wBindFramebuffer;
-extern PFNGLBINDIMAGETEXTUREPROC                            gl3wBindImageTexture;
-extern PFNGLBINDIMAGETEXTURESPROC                           gl3wBindImageTextures;
-extern PFNGLBINDPROGRAMPIPELINEPROC                         gl3wBindProgramPipeline;
-extern PFNGLBINDRENDERBUFFERPROC                            gl3wBindRenderbuffer;
-extern PFNGLBINDSAMPLERPROC                                 gl3wBindSampler;
-extern PFNGLBINDSAMPLERSPROC                                gl3wBindSamplers;
-extern PFNGLBINDTEXTUREPROC                                 gl3wBindTexture;
-extern PFNGLBINDTEXTUREUNITPROC                             gl3wBindTextureUnit;
-extern PFNGLBINDTEXTURESPROC                                gl3wBindTextures;
-extern PFNGLBINDTRANSFORMFEEDBACKPROC                       gl3wBindTransformFeedback;
-extern PFNGLBINDVERTEXARRAYPROC                             gl3wBindVertexArray;
-extern PFNGLBINDVERTEXBUFFERPROC                            gl3wBindVertexBuffer;
-extern PFNGLBINDVERTEXBUFFERSPROC                           gl3wBindVertexBuffers;
-extern PFNGLBLENDCOLORPROC                                  gl3wBlendColor;
-extern PFNGLBLENDEQUATIONPROC                               gl3wBlendEquation;
-extern PFNGLBLENDEQUATIONSEPARATEPROC                       gl3wBlendEquationSeparate;
-extern PFNGLBLENDEQUATIONSEPARATEIPROC                      gl3wBlendEquationSeparatei;
-extern PFNGLBLENDEQUATIONSEPARATEIARBPROC                   gl3wBlendEquationSeparateiARB;
-extern PFNGLBLENDEQUATIONIPROC                              gl3wBlendEquationi;
-extern PFNGLBLENDEQUATIONIARBPROC                           gl3wBlendEquationiARB;
-extern PFNGLBLENDFUNCPROC                                   gl3wBlendFunc;
-extern PFNGLBLENDFUNCSEPARATEPROC                           gl3wBlendFuncSeparate;
-extern PFNGLBLENDFUNCSEPARATEIPROC                          gl3wBlendFuncSeparatei;
-extern PFNGLBLENDFUNCSEPARATEIARBPROC                       gl3wBlendFuncSeparateiARB;
-extern PFNGLBLENDFUNCIPROC                                  gl3wBlendFunci;
-extern PFNGLBLENDFUNCIARBPROC                               gl3wBlendFunciARB;
-extern PFNGLBLITFRAMEBUFFERPROC                             gl3wBlitFramebuffer;
-extern PFNGLBLITNAMEDFRAMEBUFFERPROC                        gl3wBlitNamedFramebuffer;
-extern PFNGLBUFFERDATAPROC                                  gl3wBufferData;
-extern PFNGLBUFFERPAGECOMMITMENTARBPROC                     gl3wBufferPageCommitmentARB;
-extern PFNGLBUFFERSTORAGEPROC                               gl3wBufferStorage;
-extern PFNGLBUFFERSUBDATAPROC                               gl3wBufferSubData;
-extern PFNGLCHECKFRAMEBUFFERSTATUSPROC                      gl3wCheckFramebufferStatus;
-extern PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC                 gl3wCheckNamedFramebufferStatus;
-extern PFNGLCLAMPCOLORPROC                                  gl3wClampColor;
-extern PFNGLCLEARPROC                                       gl3wClear;
-extern PFNGLCLEARBUFFERDATAPROC                             gl3wClearBufferData;
-extern PFNGLCLEARBUFFERSUBDATAPROC                          gl3wClearBufferSubData;
-extern PFNGLCLEARBUFFERFIPROC                               gl3wClearBufferfi;
-extern PFNGLCLEARBUFFERFVPROC                               gl3wClearBufferfv;
-extern PFNGLCLEARBUFFERIVPROC                               gl3wClearBufferiv;
-extern PFNGLCLEARBUFFERUIVPROC                              gl3wClearBufferuiv;
-extern PFNGLCLEARCOLORPROC                                  gl3wClearColor;
-extern PFNGLCLEARDEPTHPROC                                  gl3wClearDepth;
-extern PFNGLCLEARDEPTHFPROC                                 gl3wClearDepthf;
-extern PFNGLCLEARNAMEDBUFFERDATAPROC                        gl3wClearNamedBufferData;
-extern PFNGLCLEARNAMEDBUFFERSUBDATAPROC                     gl3wClearNamedBufferSubData;
-extern PFNGLCLEARNAMEDFRAMEBUFFERFIPROC                     gl3wClearNamedFramebufferfi;
-extern PFNGLCLEARNAMEDFRAMEBUFFERFVPROC                     gl3wClearNamedFramebufferfv;
-extern PFNGLCLEARNAMEDFRAMEBUFFERIVPROC                     gl3wClearNamedFramebufferiv;
-extern PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC                    gl3wClearNamedFramebufferuiv;
-extern PFNGLCLEARSTENCILPROC                                gl3wClearStencil;
-extern PFNGLCLEARTEXIMAGEPROC                               gl3wClearTexImage;
-extern PFNGLCLEARTEXSUBIMAGEPROC                            gl3wClearTexSubImage;
-extern PFNGLCLIENTWAITSYNCPROC                              gl3wClientWaitSync;
-extern PFNGLCLIPCONTROLPROC                                 gl3wClipControl;
-extern PFNGLCOLORMASKPROC                                   gl3wColorMask;
-extern PFNGLCOLORMASKIPROC                                  gl3wColorMaski;
-extern PFNGLCOMPILESHADERPROC                               gl3wCompileShader;
-extern PFNGLCOMPILESHADERINCLUDEARBPROC                     gl3wCompileShaderIncludeARB;
-extern PFNGLCOMPRESSEDTEXIMAGE1DPROC                        gl3wCompressedTexImage1D;
-extern PFNGLCOMPRESSEDTEXIMAGE2DPROC                        gl3wCompressedTexImage2D;
-extern PFNGLCOMPRESSEDTEXIMAGE3DPROC                        gl3wCompressedTexImage3D;
-extern PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC                     gl3wCompressedTexSubImage1D;
-extern PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC                     gl3wCompressedTexSubImage2D;
-extern PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC                     gl3wCompressedTexSubImage3D;
-extern PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC                 gl3wCompressedTextureSubImage1D;
-extern PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC                 gl3wCompressedTextureSubImage2D;
-extern PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC                 gl3wCompressedTextureSubImage3D;
-extern PFNGLCOPYBUFFERSUBDATAPROC                           gl3wCopyBufferSubData;
-extern PFNGLCOPYIMAGESUBDATAPROC                            gl3wCopyImageSubData;
-extern PFNGLCOPYNAMEDBUFFERSUBDATAPROC                      gl3wCopyNamedBufferSubData;
-extern PFNGLCOPYTEXIMAGE1DPROC                              gl3wCopyTexImage1D;
-extern PFNGLCOPYTEXIMAGE2DPROC                              gl3wCopyTexImage2D;
-extern PFNGLCOPYTEXSUBIMAGE1DPROC                           gl3wCopyTexSubImage1D;
-extern PFNGLCOPYTEXSUBIMAGE2DPROC                           gl3wCopyTexSubImage2D;
-extern PFNGLCOPYTEXSUBIMAGE3DPROC                           gl3wCopyTexSubImage3D;
-extern PFNGLCOPYTEXTURESUBIMAGE1DPROC                       gl3wCopyTextureSubImage1D;
-extern PFNGLCOPYTEXTURESUBIMAGE2DPROC                       gl3wCopyTextureSubImage2D;
-extern PFNGLCOPYTEXTURESUBIMAGE3DPROC                       gl3wCopyTextureSubImage3D;
-extern PFNGLCREATEBUFFERSPROC                               gl3wCreateBuffers;
-extern PFNGLCREATEFRAMEBUFFERSPROC                          gl3wCreateFramebuffers;
-extern PFNGLCREATEPROGRAMPROC                               gl3wCreateProgram;
-extern PFNGLCREATEPROGRAMPIPELINESPROC                      gl3wCreateProgramPipelines;
-extern PFNGLCREATEQUERIESPROC                               gl3wCreateQueries;
-extern PFNGLCREATERENDERBUFFERSPROC                         gl3wCreateRenderbuffers;
-extern PFNGLCREATESAMPLERSPROC                              gl3wCreateSamplers;
-extern PFNGLCREATESHADERPROC                                gl3wCreateShader;
-extern PFNGLCREATESHADERPROGRAMVPROC                        gl3wCreateShaderProgramv;
-extern PFNGLCREATESYNCFROMCLEVENTARBPROC                    gl3wCreateSyncFromCLeventARB;
-extern PFNGLCREATETEXTURESPROC                              gl3wCreateTextures;
-extern PFNGLCREATETRANSFORMFEEDBACKSPROC                    gl3wCreateTransformFeedbacks;
-extern PFNGLCREATEVERTEXARRAYSPROC                          gl3wCreateVertexArrays;
-extern PFNGLCULLFACEPROC                                    gl3wCullFace;
-extern PFNGLDEBUGMESSAGECALLBACKPROC                        gl3wDebugMessageCallback;
-extern PFNGLDEBUGMESSAGECALLBACKARBPROC                     gl3wDebugMessageCallbackARB;
-extern PFNGLDEBUGMESSAGECONTROLPROC                         gl3wDebugMessageControl;
-extern PFNGLDEBUGMESSAGECONTROLARBPROC                      gl3wDebugMessageControlARB;
-extern PFNGLDEBUGMESSAGEINSERTPROC                          gl3wDebugMessageInsert;
-extern PFNGLDEBUGMESSAGEINSERTARBPROC                       gl3wDebugMessageInsertARB;
-extern PFNGLDELETEBUFFERSPROC                               gl3wDeleteBuffers;
-extern PFNGLDELETEFRAMEBUFFERSPROC                          gl3wDeleteFramebuffers;
-extern PFNGLDELETENAMEDSTRINGARBPROC                        gl3wDeleteNamedStringARB;
-extern PFNGLDELETEPROGRAMPROC                               gl3wDeleteProgram;
-extern PFNGLDELETEPROGRAMPIPELINESPROC                      gl3wDeleteProgramPipelines;
-extern PFNGLDELETEQUERIESPROC                               gl3wDeleteQueries;
-extern PFNGLDELETERENDERBUFFERSPROC                         gl3wDeleteRenderbuffers;
-extern PFNGLDELETESAMPLERSPROC                              gl3wDeleteSamplers;
-extern PFNGLDELETESHADERPROC                                gl3wDeleteShader;
-extern PFNGLDELETESYNCPROC                                  gl3wDeleteSync;
-extern PFNGLDELETETEXTURESPROC                              gl3wDeleteTextures;
-extern PFNGLDELETETRANSFORMFEEDBACKSPROC                    gl3wDeleteTransformFeedbacks;
-extern PFNGLDELETEVERTEXARRAYSPROC                          gl3wDeleteVertexArrays;
-extern PFNGLDEPTHFUNCPROC                                   gl3wDepthFunc;
-extern PFNGLDEPTHMASKPROC                                   gl3wDepthMask;
-extern PFNGLDEPTHRANGEPROC                                  gl3wDepthRange;
-extern PFNGLDEPTHRANGEARRAYVPROC                            gl3wDepthRangeArrayv;
-extern PFNGLDEPTHRANGEINDEXEDPROC                           gl3wDepthRangeIndexed;
-extern PFNGLDEPTHRANGEFPROC                                 gl3wDepthRangef;
-extern PFNGLDETACHSHADERPROC                                gl3wDetachShader;
-extern PFNGLDISABLEPROC                                     gl3wDisable;
-extern PFNGLDISABLEVERTEXARRAYATTRIBPROC                    gl3wDisableVertexArrayAttrib;
-extern PFNGLDISABLEVERTEXATTRIBARRAYPROC                    gl3wDisableVertexAttribArray;
-extern PFNGLDISABLEIPROC                                    gl3wDisablei;
-extern PFNGLDISPATCHCOMPUTEPROC                             gl3wDispatchCompute;
-extern PFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC                 gl3wDispatchComputeGroupSizeARB;
-extern PFNGLDISPATCHCOMPUTEINDIRECTPROC                     gl3wDispatchComputeIndirect;
-extern PFNGLDRAWARRAYSPROC                                  gl3wDrawArrays;
-extern PFNGLDRAWARRAYSINDIRECTPROC                          gl3wDrawArraysIndirect;
-extern PFNGLDRAWARRAYSINSTANCEDPROC                         gl3wDrawArraysInstanced;
-extern PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC             gl3wDrawArraysInstancedBaseInstance;
-extern PFNGLDRAWBUFFERPROC                                  gl3wDrawBuffer;
-extern PFNGLDRAWBUFFERSPROC                                 gl3wDrawBuffers;
-extern PFNGLDRAWELEMENTSPROC                                gl3wDrawElements;
-extern PFNGLDRAWELEMENTSBASEVERTEXPROC                      gl3wDrawElementsBaseVertex;
-extern PFNGLDRAWELEMENTSINDIRECTPROC                        gl3wDrawElementsIndirect;
-extern PFNGLDRAWELEMENTSINSTANCEDPROC                       gl3wDrawElementsInstanced;
-extern PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC           gl3wDrawElementsInstancedBaseInstance;
-extern PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC             gl3wDrawElementsInstancedBaseVertex;
-extern PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC gl3wDrawElementsInstancedBaseVertexBaseInstance;
-extern PFNGLDRAWRANGEELEMENTSPROC                           gl3wDrawRangeElements;
-extern PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC                 gl3wDrawRangeElementsBaseVertex;
-extern PFNGLDRAWTRANSFORMFEEDBACKPROC                       gl3wDrawTransformFeedback;
-extern PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC              gl3wDrawTransformFeedbackInstanced;
-extern PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC                 gl3wDrawTransformFeedbackStream;
-extern PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC        gl3wDrawTransformFeedbackStreamInstanced;
-extern PFNGLENABLEPROC                                      gl3wEnable;
-extern PFNGLENABLEVERTEXARRAYATTRIBPROC                     gl3wEnableVertexArrayAttrib;
-extern PFNGLENABLEVERTEXATTRIBARRAYPROC                     gl3wEnableVertexAttribArray;
-extern PFNGLENABLEIPROC                                     gl3wEnablei;
-extern PFNGLENDCONDITIONALRENDERPROC                        gl3wEndConditionalRender;
-extern PFNGLENDQUERYPROC                                    gl3wEndQuery;
-extern PFNGLENDQUERYINDEXEDPROC                             gl3wEndQueryIndexed;
-extern PFNGLENDTRANSFORMFEEDBACKPROC                        gl3wEndTransformFeedback;
-extern PFNGLFENCESYNCPROC                                   gl3wFenceSync;
-extern PFNGLFINISHPROC                                      gl3wFinish;
-extern PFNGLFLUSHPROC                                       gl3wFlush;
-extern PFNGLFLUSHMAPPEDBUFFERRANGEPROC                      gl3wFlushMappedBufferRange;
-extern PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC                 gl3wFlushMappedNamedBufferRange;
-extern PFNGLFRAMEBUFFERPARAMETERIPROC                       gl3wFramebufferParameteri;
-extern PFNGLFRAMEBUFFERRENDERBUFFERPROC                     gl3wFramebufferRenderbuffer;
-extern PFNGLFRAMEBUFFERTEXTUREPROC                          gl3wFramebufferTexture;
-extern PFNGLFRAMEBUFFERTEXTURE1DPROC                        gl3wFramebufferTexture1D;
-extern PFNGLFRAMEBUFFERTEXTURE2DPROC                        gl3wFramebufferTexture2D;
-extern PFNGLFRAMEBUFFERTEXTURE3DPROC                        gl3wFramebufferTexture3D;
-extern PFNGLFRAMEBUFFERTEXTURELAYERPROC                     gl3wFramebufferTextureLayer;
-extern PFNGLFRONTFACEPROC                                   gl3wFrontFace;
-extern PFNGLGENBUFFERSPROC                                  gl3wGenBuffers;
-extern PFNGLGENFRAMEBUFFERSPROC                             gl3wGenFramebuffers;
-extern PFNGLGENPROGRAMPIPELINESPROC                         gl3wGenProgramPipelines;
-extern PFNGLGENQUERIESPROC                                  gl3wGenQueries;
-extern PFNGLGENRENDERBUFFERSPROC                            gl3wGenRenderbuffers;
-extern PFNGLGENSAMPLERSPROC                                 gl3wGenSamplers;
-extern PFNGLGENTEXTURESPROC                                 gl3wGenTextures;
-extern PFNGLGENTRANSFORMFEEDBACKSPROC                       gl3wGenTransformFeedbacks;
-extern PFNGLGENVERTEXARRAYSPROC                             gl3wGenVertexArrays;
-extern PFNGLGENERATEMIPMAPPROC                              gl3wGenerateMipmap;
-extern PFNGLGENERATETEXTUREMIPMAPPROC                       gl3wGenerateTextureMipmap;
-extern PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC              gl3wGetActiveAtomicCounterBufferiv;
-extern PFNGLGETACTIVEATTRIBPROC                             gl3wGetActiveAttrib;
-extern PFNGLGETACTIVESUBROUTINENAMEPROC                     gl3wGetActiveSubroutineName;
-extern PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC              gl3wGetActiveSubroutineUniformName;
-extern PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC                gl3wGetActiveSubroutineUniformiv;
-extern PFNGLGETACTIVEUNIFORMPROC                            gl3wGetActiveUniform;
-extern PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC                   gl3wGetActiveUniformBlockName;
-extern PFNGLGETACTIVEUNIFORMBLOCKIVPROC                     gl3wGetActiveUniformBlockiv;
-extern PFNGLGETACTIVEUNIFORMNAMEPROC                        gl3wGetActiveUniformName;
-extern PFNGLGETACTIVEUNIFORMSIVPROC                         gl3wGetActiveUniformsiv;
-extern PFNGLGETATTACHEDSHADERSPROC                          gl3wGetAttachedShaders;
-extern PFNGLGETATTRIBLOCATIONPROC                           gl3wGetAttribLocation;
-extern PFNGLGETBOOLEANI_VPROC                               gl3wGetBooleani_v;
-extern PFNGLGETBOOLEANVPROC                                 gl3wGetBooleanv;
-extern PFNGLGETBUFFERPARAMETERI64VPROC                      gl3wGetBufferParameteri64v;
-extern PFNGLGETBUFFERPARAMETERIVPROC                        gl3wGetBufferParameteriv;
-extern PFNGLGETBUFFERPOINTERVPROC                           gl3wGetBufferPointerv;
-extern PFNGLGETBUFFERSUBDATAPROC                            gl3wGetBufferSubData;
-extern PFNGLGETCOMPRESSEDTEXIMAGEPROC                       gl3wGetCompressedTexImage;
-extern PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC                   gl3wGetCompressedTextureImage;
-extern PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC                gl3wGetCompressedTextureSubImage;
-extern PFNGLGETDEBUGMESSAGELOGPROC                          gl3wGetDebugMessageLog;
-extern PFNGLGETDEBUGMESSAGELOGARBPROC                       gl3wGetDebugMessageLogARB;
-extern PFNGLGETDOUBLEI_VPROC                                gl3wGetDoublei_v;
-extern PFNGLGETDOUBLEVPROC                                  gl3wGetDoublev;
-extern PFNGLGETERRORPROC                                    gl3wGetError;
-extern PFNGLGETFLOATI_VPROC                                 gl3wGetFloati_v;
-extern PFNGLGETFLOATVPROC                                   gl3wGetFloatv;
-extern PFNGLGETFRAGDATAINDEXPROC                            gl3wGetFragDataIndex;
-extern PFNGLGETFRAGDATALOCATIONPROC                         gl3wGetFragDataLocation;
-extern PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC         gl3wGetFramebufferAttachmentParameteriv;
-extern PFNGLGETFRAMEBUFFERPARAMETERIVPROC                   gl3wGetFramebufferParameteriv;
-extern PFNGLGETGRAPHICSRESETSTATUSPROC                      gl3wGetGraphicsResetStatus;
-extern PFNGLGETGRAPHICSRESETSTATUSARBPROC                   gl3wGetGraphicsResetStatusARB;
-extern PFNGLGETIMAGEHANDLEARBPROC                           gl3wGetImageHandleARB;
-extern PFNGLGETINTEGER64I_VPROC                             gl3wGetInteger64i_v;
-extern PFNGLGETINTEGER64VPROC                               gl3wGetInteger64v;
-extern PFNGLGETINTEGERI_VPROC                               gl3wGetIntegeri_v;
-extern PFNGLGETINTEGERVPROC                                 gl3wGetIntegerv;
-extern PFNGLGETINTERNALFORMATI64VPROC                       gl3wGetInternalformati64v;
-extern PFNGLGETINTERNALFORMATIVPROC                         gl3wGetInternalformativ;
-extern PFNGLGETMULTISAMPLEFVPROC                            gl3wGetMultisamplefv;
-extern PFNGLGETNAMEDBUFFERPARAMETERI64VPROC                 gl3wGetNamedBufferParameteri64v;
-extern PFNGLGETNAMEDBUFFERPARAMETERIVPROC                   gl3wGetNamedBufferParameteriv;
-extern PFNGLGETNAMEDBUFFERPOINTERVPROC                      gl3wGetNamedBufferPointerv;
-extern PFNGLGETNAMEDBUFFERSUBDATAPROC                       gl3wGetNamedBufferSubData;
-extern PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC    gl3wGetNamedFramebufferAttachmentParameteriv;
-extern PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC              gl3wGetNamedFramebufferParameteriv;
-extern PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC             gl3wGetNamedRenderbufferParameteriv;
-extern PFNGLGETNAMEDSTRINGARBPROC                           gl3wGetNamedStringARB;
-extern PFNGLGETNAMEDSTRINGIVARBPROC                         gl3wGetNamedStringivARB;
-extern PFNGLGETOBJECTLABELPROC                              gl3wGetObjectLabel;
-extern PFNGLGETOBJECTPTRLABELPROC                           gl3wGetObjectPtrLabel;
-extern PFNGLGETPOINTERVPROC                                 gl3wGetPointerv;
-extern PFNGLGETPROGRAMBINARYPROC                            gl3wGetProgramBinary;
-extern PFNGLGETPROGRAMINFOLOGPROC                           gl3wGetProgramInfoLog;
-extern PFNGLGETPROGRAMINTERFACEIVPROC                       gl3wGetProgramInterfaceiv;
-extern PFNGLGETPROGRAMPIPELINEINFOLOGPROC                   gl3wGetProgramPipelineInfoLog;
-extern PFNGLGETPROGRAMPIPELINEIVPROC                        gl3wGetProgramPipelineiv;
-extern PFNGLGETPROGRAMRESOURCEINDEXPROC                     gl3wGetProgramResourceIndex;
-extern PFNGLGETPROGRAMRESOURCELOCATIONPROC                  gl3wGetProgramResourceLocation;
-extern PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC             gl3wGetProgramResourceLocationIndex;
-extern PFNGLGETPROGRAMRESOURCENAMEPROC                      gl3wGetProgramResourceName;
-extern PFNGLGETPROGRAMRESOURCEIVPROC                        gl3wGetProgramResourceiv;
-extern PFNGLGETPROGRAMSTAGEIVPROC                           gl3wGetProgramStageiv;
-extern PFNGLGETPROGRAMIVPROC                                gl3wGetProgramiv;
-extern PFNGLGETQUERYBUFFEROBJECTI64VPROC                    gl3wGetQueryBufferObjecti64v;
-extern PFNGLGETQUERYBUFFEROBJECTIVPROC                      gl3wGetQueryBufferObjectiv;
-extern PFNGLGETQUERYBUFFEROBJECTUI64VPROC                   gl3wGetQueryBufferObjectui64v;
-extern PFNGLGETQUERYBUFFEROBJECTUIVPROC                     gl3wGetQueryBufferObjectuiv;
-extern PFNGLGETQUERYINDEXEDIVPROC                           gl3wGetQueryIndexediv;
-extern PFNGLGETQUERYOBJECTI64VPROC                          gl3wGetQueryObjecti64v;
-extern PFNGLGETQUERYOBJECTIVPROC                            gl3wGetQueryObjectiv;
-extern PFNGLGETQUERYOBJECTUI64VPROC                         gl3wGetQueryObjectui64v;
-extern PFNGLGETQUERYOBJECTUIVPROC                           gl3wGetQueryObjectuiv;
-extern PFNGLGETQUERYIVPROC                                  gl3wGetQueryiv;
-extern PFNGLGETRENDERBUFFERPARAMETERIVPROC                  gl3wGetRenderbufferParameteriv;
-extern PFNGLGETSAMPLERPARAMETERIIVPROC                      gl3wGetSamplerParameterIiv;
-extern PFNGLGETSAMPLERPARAMETERIUIVPROC                     gl3wGetSamplerParameterIuiv;
-extern PFNGLGETSAMPLERPARAMETERFVPROC                       gl3wGetSamplerParameterfv;
-extern PFNGLGETSAMPLERPARAMETERIVPROC                       gl3wGetSamplerParameteriv;
-extern PFNGLGETSHADERINFOLOGPROC                            gl3wGetShaderInfoLog;
-extern PFNGLGETSHADERPRECISIONFORMATPROC                    gl3wGetShaderPrecisionFormat;
-extern PFNGLGETSHADERSOURCEPROC                             gl3wGetShaderSource;
-extern PFNGLGETSHADERIVPROC                                 gl3wGetShaderiv;
-extern PFNGLGETSTRINGPROC                                   gl3wGetString;
-extern PFNGLGETSTRINGIPROC                                  gl3wGetStringi;
-extern PFNGLGETSUBROUTINEINDEXPROC                          gl3wGetSubroutineIndex;
-extern PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC                gl3wGetSubroutineUniformLocation;
-extern PFNGLGETSYNCIVPROC                                   gl3wGetSynciv;
-extern PFNGLGETTEXIMAGEPROC                                 gl3wGetTexImage;
-extern PFNGLGETTEXLEVELPARAMETERFVPROC                      gl3wGetTexLevelParameterfv;
-extern PFNGLGETTEXLEVELPARAMETERIVPROC                      gl3wGetTexLevelParameteriv;
-extern PFNGLGETTEXPARAMETERIIVPROC                          gl3wGetTexParameterIiv;
-extern PFNGLGETTEXPARAMETERIUIVPROC                         gl3wGetTexParameterIuiv;
-extern PFNGLGETTEXPARAMETERFVPROC                           gl3wGetTexParameterfv;
-extern PFNGLGETTEXPARAMETERIVPROC                           gl3wGetTexParameteriv;
-extern PFNGLGETTEXTUREHANDLEARBPROC                         gl3wGetTextureHandleARB;
-extern PFNGLGETTEXTUREIMAGEPROC                             gl3wGetTextureImage;
-extern PFNGLGETTEXTURELEVELPARAMETERFVPROC                  gl3wGetTextureLevelParameterfv;
-extern PFNGLGETTEXTURELEVELPARAMETERIVPROC                  gl3wGetTextureLevelParameteriv;
-extern PFNGLGETTEXTUREPARAMETERIIVPROC                      gl3wGetTextureParameterIiv;
-extern PFNGLGETTEXTUREPARAMETERIUIVPROC                     gl3wGetTextureParameterIuiv;
-extern PFNGLGETTEXTUREPARAMETERFVPROC                       gl3wGetTextureParameterfv;
-extern PFNGLGETTEXTUREPARAMETERIVPROC                       gl3wGetTextureParameteriv;
-extern PFNGLGETTEXTURESAMPLERHANDLEARBPROC                  gl3wGetTextureSamplerHandleARB;
-extern PFNGLGETTEXTURESUBIMAGEPROC                          gl3wGetTextureSubImage;
-extern PFNGLGETTRANSFORMFEEDBACKVARYINGPROC                 gl3wGetTransformFeedbackVarying;
-extern PFNGLGETTRANSFORMFEEDBACKI64_VPROC                   gl3wGetTransformFeedbacki64_v;
-extern PFNGLGETTRANSFORMFEEDBACKI_VPROC                     gl3wGetTransformFeedbacki_v;
-extern PFNGLGETTRANSFORMFEEDBACKIVPROC                      gl3wGetTransformFeedbackiv;
-extern PFNGLGETUNIFORMBLOCKINDEXPROC                        gl3wGetUniformBlockIndex;
-extern PFNGLGETUNIFORMINDICESPROC                           gl3wGetUniformIndices;
-extern PFNGLGETUNIFORMLOCATIONPROC                          gl3wGetUniformLocation;
-extern PFNGLGETUNIFORMSUBROUTINEUIVPROC                     gl3wGetUniformSubroutineuiv;
-extern PFNGLGETUNIFORMDVPROC                                gl3wGetUniformdv;
-extern PFNGLGETUNIFORMFVPROC                                gl3wGetUniformfv;
-extern PFNGLGETUNIFORMIVPROC                                gl3wGetUniformiv;
-extern PFNGLGETUNIFORMUIVPROC                               gl3wGetUniformuiv;
-extern PFNGLGETVERTEXARRAYINDEXED64IVPROC                   gl3wGetVertexArrayIndexed64iv;
-extern PFNGLGETVERTEXARRAYINDEXEDIVPROC                     gl3wGetVertexArrayIndexediv;
-extern PFNGLGETVERTEXARRAYIVPROC                            gl3wGetVertexArrayiv;
-extern PFNGLGETVERTEXATTRIBIIVPROC                          gl3wGetVertexAttribIiv;
-extern PFNGLGETVERTEXATTRIBIUIVPROC                         gl3wGetVertexAttribIuiv;
-extern PFNGLGETVERTEXATTRIBLDVPROC                          gl3wGetVertexAttribLdv;
-extern PFNGLGETVERTEXATTRIBLUI64VARBPROC                    gl3wGetVertexAttribLui64vARB;
-extern PFNGLGETVERTEXATTRIBPOINTERVPROC                     gl3wGetVertexAttribPointerv;
-extern PFNGLGETVERTEXATTRIBDVPROC                           gl3wGetVertexAttribdv;
-extern PFNGLGETVERTEXATTRIBFVPROC                           gl3wGetVertexAttribfv;
-extern PFNGLGETVERTEXATTRIBIVPROC                           gl3wGetVertexAttribiv;
-extern PFNGLGETNCOMPRESSEDTEXIMAGEPROC                      gl3wGetnCompressedTexImage;
-extern PFNGLGETNCOMPRESSEDTEXIMAGEARBPROC                   gl3wGetnCompressedTexImageARB;
-extern PFNGLGETNTEXIMAGEPROC                                gl3wGetnTexImage;
-extern PFNGLGETNTEXIMAGEARBPROC                             gl3wGetnTexImageARB;
-extern PFNGLGETNUNIFORMDVPROC                               gl3wGetnUniformdv;
-extern PFNGLGETNUNIFORMDVARBPROC                            gl3wGetnUniformdvARB;
-extern PFNGLGETNUNIFORMFVPROC                               gl3wGetnUniformfv;
-extern PFNGLGETNUNIFORMFVARBPROC                            gl3wGetnUniformfvARB;
-extern PFNGLGETNUNIFORMIVPROC                               gl3wGetnUniformiv;
-extern PFNGLGETNUNIFORMIVARBPROC                            gl3wGetnUniformivARB;
-extern PFNGLGETNUNIFORMUIVPROC                              gl3wGetnUniformuiv;
-extern PFNGLGETNUNIFORMUIVARBPROC                           gl3wGetnUniformuivARB;
-extern PFNGLHINTPROC                                        gl3wHint;
-extern PFNGLINVALIDATEBUFFERDATAPROC                        gl3wInvalidateBufferData;
-extern PFNGLINVALIDATEBUFFERSUBDATAPROC                     gl3wInvalidateBufferSubData;
-extern PFNGLINVALIDATEFRAMEBUFFERPROC                       gl3wInvalidateFramebuffer;
-extern PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC              gl3wInvalidateNamedFramebufferData;
-extern PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC           gl3wInvalidateNamedFramebufferSubData;
-extern PFNGLINVALIDATESUBFRAMEBUFFERPROC                    gl3wInvalidateSubFramebuffer;
-extern PFNGLINVALIDATETEXIMAGEPROC                          gl3wInvalidateTexImage;
-extern PFNGLINVALIDATETEXSUBIMAGEPROC                       gl3wInvalidateTexSubImage;
-extern PFNGLISBUFFERPROC                                    gl3wIsBuffer;
-extern PFNGLISENABLEDPROC                                   gl3wIsEnabled;
-extern PFNGLISENABLEDIPROC                                  gl3wIsEnabledi;
-extern PFNGLISFRAMEBUFFERPROC                               gl3wIsFramebuffer;
-extern PFNGLISIMAGEHANDLERESIDENTARBPROC                    gl3wIsImageHandleResidentARB;
-extern PFNGLISNAMEDSTRINGARBPROC                            gl3wIsNamedStringARB;
-extern PFNGLISPROGRAMPROC                                   gl3wIsProgram;
-extern PFNGLISPROGRAMPIPELINEPROC                           gl3wIsProgramPipeline;
-extern PFNGLISQUERYPROC                                     gl3wIsQuery;
-extern PFNGLISRENDERBUFFERPROC                              gl3wIsRenderbuffer;
-extern PFNGLISSAMPLERPROC                                   gl3wIsSampler;
-extern PFNGLISSHADERPROC                                    gl3wIsShader;
-extern PFNGLISSYNCPROC                                      gl3wIsSync;
-extern PFNGLISTEXTUREPROC                                   gl3wIsTexture;
-extern PFNGLISTEXTUREHANDLERESIDENTARBPROC                  gl3wIsTextureHandleResidentARB;
-extern PFNGLISTRANSFORMFEEDBACKPROC                         gl3wIsTransformFeedback;
-extern PFNGLISVERTEXARRAYPROC                               gl3wIsVertexArray;
-extern PFNGLLINEWIDTHPROC                                   gl3wLineWidth;
-extern PFNGLLINKPROGRAMPROC                                 gl3wLinkProgram;
-extern PFNGLLOGICOPPROC                                     gl3wLogicOp;
-extern PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC               gl3wMakeImageHandleNonResidentARB;
-extern PFNGLMAKEIMAGEHANDLERESIDENTARBPROC                  gl3wMakeImageHandleResidentARB;
-extern PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC             gl3wMakeTextureHandleNonResidentARB;
-extern PFNGLMAKETEXTUREHANDLERESIDENTARBPROC                gl3wMakeTextureHandleResidentARB;
-extern PFNGLMAPBUFFERPROC                                   gl3wMapBuffer;
-extern PFNGLMAPBUFFERRANGEPROC                              gl3wMapBufferRange;
-extern PFNGLMAPNAMEDBUFFERPROC                              gl3wMapNamedBuffer;
-extern PFNGLMAPNAMEDBUFFERRANGEPROC                         gl3wMapNamedBufferRange;
-extern PFNGLMEMORYBARRIERPROC                               gl3wMemoryBarrier;
-extern PFNGLMEMORYBARRIERBYREGIONPROC                       gl3wMemoryBarrierByRegion;
-extern PFNGLMINSAMPLESHADINGPROC                            gl3wMinSampleShading;
-extern PFNGLMINSAMPLESHADINGARBPROC                         gl3wMinSampleShadingARB;
-extern PFNGLMULTIDRAWARRAYSPROC                             gl3wMultiDrawArrays;
-extern PFNGLMULTIDRAWARRAYSINDIRECTPROC                     gl3wMultiDrawArraysIndirect;
-extern PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC             gl3wMultiDrawArraysIndirectCountARB;
-extern PFNGLMULTIDRAWELEMENTSPROC                           gl3wMultiDrawElements;
-extern PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC                 gl3wMultiDrawElementsBaseVertex;
-extern PFNGLMULTIDRAWELEMENTSINDIRECTPROC                   gl3wMultiDrawElementsIndirect;
-extern PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC           gl3wMultiDrawElementsIndirectCountARB;
-extern PFNGLNAMEDBUFFERDATAPROC                             gl3wNamedBufferData;
-extern PFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC                gl3wNamedBufferPageCommitmentARB;
-extern PFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC                gl3wNamedBufferPageCommitmentEXT;
-extern PFNGLNAMEDBUFFERSTORAGEPROC                          gl3wNamedBufferStorage;
-extern PFNGLNAMEDBUFFERSUBDATAPROC                          gl3wNamedBufferSubData;
-extern PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC                  gl3wNamedFramebufferDrawBuffer;
-extern PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC                 gl3wNamedFramebufferDrawBuffers;
-extern PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC                  gl3wNamedFramebufferParameteri;
-extern PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC                  gl3wNamedFramebufferReadBuffer;
-extern PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC                gl3wNamedFramebufferRenderbuffer;
-extern PFNGLNAMEDFRAMEBUFFERTEXTUREPROC                     gl3wNamedFramebufferTexture;
-extern PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC                gl3wNamedFramebufferTextureLayer;
-extern PFNGLNAMEDRENDERBUFFERSTORAGEPROC                    gl3wNamedRenderbufferStorage;
-extern PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC         gl3wNamedRenderbufferStorageMultisample;
-extern PFNGLNAMEDSTRINGARBPROC                              gl3wNamedStringARB;
-extern PFNGLOBJECTLABELPROC                                 gl3wObjectLabel;
-extern PFNGLOBJECTPTRLABELPROC                              gl3wObjectPtrLabel;
-extern PFNGLPATCHPARAMETERFVPROC                            gl3wPatchParameterfv;
-extern PFNGLPATCHPARAMETERIPROC                             gl3wPatchParameteri;
-extern PFNGLPAUSETRANSFORMFEEDBACKPROC                      gl3wPauseTransformFeedback;
-extern PFNGLPIXELSTOREFPROC                                 gl3wPixelStoref;
-extern PFNGLPIXELSTOREIPROC                                 gl3wPixelStorei;
-extern PFNGLPOINTPARAMETERFPROC                             gl3wPointParameterf;
-extern PFNGLPOINTPARAMETERFVPROC                            gl3wPointParameterfv;
-extern PFNGLPOINTPARAMETERIPROC                             gl3wPointParameteri;
-extern PFNGLPOINTPARAMETERIVPROC                            gl3wPointParameteriv;
-extern PFNGLPOINTSIZEPROC                                   gl3wPointSize;
-extern PFNGLPOLYGONMODEPROC                                 gl3wPolygonMode;
-extern PFNGLPOLYGONOFFSETPROC                               gl3wPolygonOffset;
-extern PFNGLPOPDEBUGGROUPPROC                               gl3wPopDebugGroup;
-extern PFNGLPRIMITIVERESTARTINDEXPROC                       gl3wPrimitiveRestartIndex;
-extern PFNGLPROGRAMBINARYPROC                               gl3wProgramBinary;
-extern PFNGLPROGRAMPARAMETERIPROC                           gl3wProgramParameteri;
-extern PFNGLPROGRAMUNIFORM1DPROC                            gl3wProgramUniform1d;
-extern PFNGLPROGRAMUNIFORM1DVPROC                           gl3wProgramUniform1dv;
-extern PFNGLPROGRAMUNIFORM1FPROC                            gl3wProgramUniform1f;
-extern PFNGLPROGRAMUNIFORM1FVPROC                           gl3wProgramUniform1fv;
-extern PFNGLPROGRAMUNIFORM1IPROC                            gl3wProgramUniform1i;
-extern PFNGLPROGRAMUNIFORM1IVPROC                           gl3wProgramUniform1iv;
-extern PFNGLPROGRAMUNIFORM1UIPROC                           gl3wProgramUniform1ui;
-extern PFNGLPROGRAMUNIFORM1UIVPROC                          gl3wProgramUniform1uiv;
-extern PFNGLPROGRAMUNIFORM2DPROC                            gl3wProgramUniform2d;
-extern PFNGLPROGRAMUNIFORM2DVPROC                           gl3wProgramUniform2dv;
-extern PFNGLPROGRAMUNIFORM2FPROC                            gl3wProgramUniform2f;
-extern PFNGLPROGRAMUNIFORM2FVPROC                           gl3wProgramUniform2fv;
-extern PFNGLPROGRAMUNIFORM2IPROC                            gl3wProgramUniform2i;
-extern PFNGLPROGRAMUNIFORM2IVPROC                           gl3wProgramUniform2iv;
-extern PFNGLPROGRAMUNIFORM2UIPROC                           gl3wProgramUniform2ui;
-extern PFNGLPROGRAMUNIFORM2UIVPROC                          gl3wProgramUniform2uiv;
-extern PFNGLPROGRAMUNIFORM3DPROC                            gl3wProgramUniform3d;
-extern PFNGLPROGRAMUNIFORM3DVPROC                           gl3wProgramUniform3dv;
-extern PFNGLPROGRAMUNIFORM3FPROC                            gl3wProgramUniform3f;
-extern PFNGLPROGRAMUNIFORM3FVPROC                           gl3wProgramUniform3fv;
-extern PFNGLPROGRAMUNIFORM3IPROC                            gl3wProgramUniform3i;
-extern PFNGLPROGRAMUNIFORM3IVPROC                           gl3wProgramUniform3iv;
-extern PFNGLPROGRAMUNIFORM3UIPROC                           gl3wProgramUniform3ui;
-extern PFNGLPROGRAMUNIFORM3UIVPROC                          gl3wProgramUniform3uiv;
-extern PFNGLPROGRAMUNIFORM4DPROC                            gl3wProgramUniform4d;
-extern PFNGLPROGRAMUNIFORM4DVPROC                           gl3wProgramUniform4dv;
-extern PFNGLPROGRAMUNIFORM4FPROC                            gl3wProgramUniform4f;
-extern PFNGLPROGRAMUNIFORM4FVPROC                           gl3wProgramUniform4fv;
-extern PFNGLPROGRAMUNIFORM4IPROC                            gl3wProgramUniform4i;
-extern PFNGLPROGRAMUNIFORM4IVPROC                           gl3wProgramUniform4iv;
-extern PFNGLPROGRAMUNIFORM4UIPROC                           gl3wProgramUniform4ui;
-extern PFNGLPROGRAMUNIFORM4UIVPROC                          gl3wProgramUniform4uiv;
-extern PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC                 gl3wProgramUniformHandleui64ARB;
-extern PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC                gl3wProgramUniformHandleui64vARB;
-extern PFNGLPROGRAMUNIFORMMATRIX2DVPROC                     gl3wProgramUniformMatrix2dv;
-extern PFNGLPROGRAMUNIFORMMATRIX2FVPROC                     gl3wProgramUniformMatrix2fv;
-extern PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC                   gl3wProgramUniformMatrix2x3dv;
-extern PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC                   gl3wProgramUniformMatrix2x3fv;
-extern PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC                   gl3wProgramUniformMatrix2x4dv;
-extern PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC                   gl3wProgramUniformMatrix2x4fv;
-extern PFNGLPROGRAMUNIFORMMATRIX3DVPROC                     gl3wProgramUniformMatrix3dv;
-extern PFNGLPROGRAMUNIFORMMATRIX3FVPROC                     gl3wProgramUniformMatrix3fv;
-extern PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC                   gl3wProgramUniformMatrix3x2dv;
-extern PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC                   gl3wProgramUniformMatrix3x2fv;
-extern PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC                   gl3wProgramUniformMatrix3x4dv;
-extern PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC                   gl3wProgramUniformMatrix3x4fv;
-extern PFNGLPROGRAMUNIFORMMATRIX4DVPROC                     gl3wProgramUniformMatrix4dv;
-extern PFNGLPROGRAMUNIFORMMATRIX4FVPROC                     gl3wProgramUniformMatrix4fv;
-extern PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC                   gl3wProgramUniformMatrix4x2dv;
-extern PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC                   gl3wProgramUniformMatrix4x2fv;
-extern PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC                   gl3wProgramUniformMatrix4x3dv;
-extern PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC                   gl3wProgramUniformMatrix4x3fv;
-extern PFNGLPROVOKINGVERTEXPROC                             gl3wProvokingVertex;
-extern PFNGLPUSHDEBUGGROUPPROC                              gl3wPushDebugGroup;
-extern PFNGLQUERYCOUNTERPROC                                gl3wQueryCounter;
-extern PFNGLREADBUFFERPROC                                  gl3wReadBuffer;
-extern PFNGLREADPIXELSPROC                                  gl3wReadPixels;
-extern PFNGLREADNPIXELSPROC                                 gl3wReadnPixels;
-extern PFNGLREADNPIXELSARBPROC                              gl3wReadnPixelsARB;
-extern PFNGLRELEASESHADERCOMPILERPROC                       gl3wReleaseShaderCompiler;
-extern PFNGLRENDERBUFFERSTORAGEPROC                         gl3wRenderbufferStorage;
-extern PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC              gl3wRenderbufferStorageMultisample;
-extern PFNGLRESUMETRANSFORMFEEDBACKPROC                     gl3wResumeTransformFeedback;
-extern PFNGLSAMPLECOVERAGEPROC                              gl3wSampleCoverage;
-extern PFNGLSAMPLEMASKIPROC                                 gl3wSampleMaski;
-extern PFNGLSAMPLERPARAMETERIIVPROC                         gl3wSamplerParameterIiv;
-extern PFNGLSAMPLERPARAMETERIUIVPROC                        gl3wSamplerParameterIuiv;
-extern PFNGLSAMPLERPARAMETERFPROC                           gl3wSamplerParameterf;
-extern PFNGLSAMPLERPARAMETERFVPROC                          gl3wSamplerParameterfv;
-extern PFNGLSAMPLERPARAMETERIPROC                           gl3wSamplerParameteri;
-extern PFNGLSAMPLERPARAMETERIVPROC                          gl3wSamplerParameteriv;
-extern PFNGLSCISSORPROC                                     gl3wScissor;
-extern PFNGLSCISSORARRAYVPROC                               gl3wScissorArrayv;
-extern PFNGLSCISSORINDEXEDPROC                              gl3wScissorIndexed;
-extern PFNGLSCISSORINDEXEDVPROC                             gl3wScissorIndexedv;
-extern PFNGLSHADERBINARYPROC                                gl3wShaderBinary;
-extern PFNGLSHADERSOURCEPROC                                gl3wShaderSource;
-extern PFNGLSHADERSTORAGEBLOCKBINDINGPROC                   gl3wShaderStorageBlockBinding;
-extern PFNGLSTENCILFUNCPROC                                 gl3wStencilFunc;
-extern PFNGLSTENCILFUNCSEPARATEPROC                         gl3wStencilFuncSeparate;
-extern PFNGLSTENCILMASKPROC                                 gl3wStencilMask;
-extern PFNGLSTENCILMASKSEPARATEPROC                         gl3wStencilMaskSeparate;
-extern PFNGLSTENCILOPPROC                                   gl3wStencilOp;
-extern PFNGLSTENCILOPSEPARATEPROC                           gl3wStencilOpSeparate;
-extern PFNGLTEXBUFFERPROC                                   gl3wTexBuffer;
-extern PFNGLTEXBUFFERRANGEPROC                              gl3wTexBufferRange;
-extern PFNGLTEXIMAGE1DPROC                                  gl3wTexImage1D;
-extern PFNGLTEXIMAGE2DPROC                                  gl3wTexImage2D;
-extern PFNGLTEXIMAGE2DMULTISAMPLEPROC                       gl3wTexImage2DMultisample;
-extern PFNGLTEXIMAGE3DPROC                                  gl3wTexImage3D;
-extern PFNGLTEXIMAGE3DMULTISAMPLEPROC                       gl3wTexImage3DMultisample;
-extern PFNGLTEXPAGECOMMITMENTARBPROC                        gl3wTexPageCommitmentARB;
-extern PFNGLTEXPARAMETERIIVPROC                             gl3wTexParameterIiv;
-extern PFNGLTEXPARAMETERIUIVPROC                            gl3wTexParameterIuiv;
-extern PFNGLTEXPARAMETERFPROC                               gl3wTexParameterf;
-extern PFNGLTEXPARAMETERFVPROC                              gl3wTexParameterfv;
-extern PFNGLTEXPARAMETERIPROC                               gl3wTexParameteri;
-extern PFNGLTEXPARAMETERIVPROC                              gl3wTexParameteriv;
-extern PFNGLTEXSTORAGE1DPROC                                gl3wTexStorage1D;
-extern PFNGLTEXSTORAGE2DPROC                                gl3wTexStorage2D;
-extern PFNGLTEXSTORAGE2DMULTISAMPLEPROC                     gl3wTexStorage2DMultisample;
-extern PFNGLTEXSTORAGE3DPROC                                gl3wTexStorage3D;
-extern PFNGLTEXSTORAGE3DMULTISAMPLEPROC                     gl3wTexStorage3DMultisample;
-extern PFNGLTEXSUBIMAGE1DPROC                               gl3wTexSubImage1D;
-extern PFNGLTEXSUBIMAGE2DPROC                               gl3wTexSubImage2D;
-extern PFNGLTEXSUBIMAGE3DPROC                               gl3wTexSubImage3D;
-extern PFNGLTEXTUREBARRIERPROC                              gl3wTextureBarrier;
-extern PFNGLTEXTUREBUFFERPROC                               gl3wTextureBuffer;
-extern PFNGLTEXTUREBUFFERRANGEPROC                          gl3wTextureBufferRange;
-extern PFNGLTEXTUREPARAMETERIIVPROC                         gl3wTextureParameterIiv;
-extern PFNGLTEXTUREPARAMETERIUIVPROC                        gl3wTextureParameterIuiv;
-extern PFNGLTEXTUREPARAMETERFPROC                           gl3wTextureParameterf;
-extern PFNGLTEXTUREPARAMETERFVPROC                          gl3wTextureParameterfv;
-extern PFNGLTEXTUREPARAMETERIPROC                           gl3wTextureParameteri;
-extern PFNGLTEXTUREPARAMETERIVPROC                          gl3wTextureParameteriv;
-extern PFNGLTEXTURESTORAGE1DPROC                            gl3wTextureStorage1D;
-extern PFNGLTEXTURESTORAGE2DPROC                            gl3wTextureStorage2D;
-extern PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC                 gl3wTextureStorage2DMultisample;
-extern PFNGLTEXTURESTORAGE3DPROC                            gl3wTextureStorage3D;
-extern PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC                 gl3wTextureStorage3DMultisample;
-extern PFNGLTEXTURESUBIMAGE1DPROC                           gl3wTextureSubImage1D;
-extern PFNGLTEXTURESUBIMAGE2DPROC                           gl3wTextureSubImage2D;
-extern PFNGLTEXTURESUBIMAGE3DPROC                           gl3wTextureSubImage3D;
-extern PFNGLTEXTUREVIEWPROC                                 gl3wTextureView;
-extern PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC                 gl3wTransformFeedbackBufferBase;
-extern PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC                gl3wTransformFeedbackBufferRange;
-extern PFNGLTRANSFORMFEEDBACKVARYINGSPROC                   gl3wTransformFeedbackVaryings;
-extern PFNGLUNIFORM1DPROC                                   gl3wUniform1d;
-extern PFNGLUNIFORM1DVPROC                                  gl3wUniform1dv;
-extern PFNGLUNIFORM1FPROC                                   gl3wUniform1f;
-extern PFNGLUNIFORM1FVPROC                                  gl3wUniform1fv;
-extern PFNGLUNIFORM1IPROC                                   gl3wUniform1i;
-extern PFNGLUNIFORM1IVPROC                                  gl3wUniform1iv;
-extern PFNGLUNIFORM1UIPROC                                  gl3wUniform1ui;
-extern PFNGLUNIFORM1UIVPROC                                 gl3wUniform1uiv;
-extern PFNGLUNIFORM2DPROC                                   gl3wUniform2d;
-extern PFNGLUNIFORM2DVPROC                                  gl3wUniform2dv;
-extern PFNGLUNIFORM2FPROC                                   gl3wUniform2f;
-extern PFNGLUNIFORM2FVPROC                                  gl3wUniform2fv;
-extern PFNGLUNIFORM2IPROC                                   gl3wUniform2i;
-extern PFNGLUNIFORM2IVPROC                                  gl3wUniform2iv;
-extern PFNGLUNIFORM2UIPROC                                  gl3wUniform2ui;
-extern PFNGLUNIFORM2UIVPROC                                 gl3wUniform2uiv;
-extern PFNGLUNIFORM3DPROC                                   gl3wUniform3d;
-extern PFNGLUNIFORM3DVPROC                                  gl3wUniform3dv;
-extern PFNGLUNIFORM3FPROC                                   gl3wUniform3f;
-extern PFNGLUNIFORM3FVPROC                                  gl3wUniform3fv;
-extern PFNGLUNIFORM3IPROC                                   gl3wUniform3i;
-extern PFNGLUNIFORM3IVPROC                                  gl3wUniform3iv;
-extern PFNGLUNIFORM3UIPROC                                  gl3wUniform3ui;
-extern PFNGLUNIFORM3UIVPROC                                 gl3wUniform3uiv;
-extern PFNGLUNIFORM4DPROC                                   gl3wUniform4d;
-extern PFNGLUNIFORM4DVPROC                                  gl3wUniform4dv;
-extern PFNGLUNIFORM4FPROC                                   gl3wUniform4f;
-extern PFNGLUNIFORM4FVPROC                                  gl3wUniform4fv;
-extern PFNGLUNIFORM4IPROC                                   gl3wUniform4i;
-extern PFNGLUNIFORM4IVPROC                                  gl3wUniform4iv;
-extern PFNGLUNIFORM4UIPROC                                  gl3wUniform4ui;
-extern PFNGLUNIFORM4UIVPROC                                 gl3wUniform4uiv;
-extern PFNGLUNIFORMBLOCKBINDINGPROC                         gl3wUniformBlockBinding;
-extern PFNGLUNIFORMHANDLEUI64ARBPROC                        gl3wUniformHandleui64ARB;
-extern PFNGLUNIFORMHANDLEUI64VARBPROC                       gl3wUniformHandleui64vARB;
-extern PFNGLUNIFORMMATRIX2DVPROC                            gl3wUniformMatrix2dv;
-extern PFNGLUNIFORMMATRIX2FVPROC                            gl3wUniformMatrix2fv;
-extern PFNGLUNIFORMMATRIX2X3DVPROC                          gl3wUniformMatrix2x3dv;
-extern PFNGLUNIFORMMATRIX2X3FVPROC                          gl3wUniformMatrix2x3fv;
-extern PFNGLUNIFORMMATRIX2X4DVPROC                          gl3wUniformMatrix2x4dv;
-extern PFNGLUNIFORMMATRIX2X4FVPROC                          gl3wUniformMatrix2x4fv;
-extern PFNGLUNIFORMMATRIX3DVPROC                            gl3wUniformMatrix3dv;
-extern PFNGLUNIFORMMATRIX3FVPROC                            gl3wUniformMatrix3fv;
-extern PFNGLUNIFORMMATRIX3X2DVPROC                          gl3wUniformMatrix3x2dv;
-extern PFNGLUNIFORMMATRIX3X2FVPROC                          gl3wUniformMatrix3x2fv;
-extern PFNGLUNIFORMMATRIX3X4DVPROC                          gl3wUniformMatrix3x4dv;
-extern PFNGLUNIFORMMATRIX3X4FVPROC                          gl3wUniformMatrix3x4fv;
-extern PFNGLUNIFORMMATRIX4DVPROC                            gl3wUniformMatrix4dv;
-extern PFNGLUNIFORMMATRIX4FVPROC                            gl3wUniformMatrix4fv;
-extern PFNGLUNIFORMMATRIX4X2DVPROC                          gl3wUniformMatrix4x2dv;
-extern PFNGLUNIFORMMATRIX4X2FVPROC                          gl3wUniformMatrix4x2fv;
-extern PFNGLUNIFORMMATRIX4X3DVPROC                          gl3wUniformMatrix4x3dv;
-extern PFNGLUNIFORMMATRIX4X3FVPROC                          gl3wUniformMatrix4x3fv;
-extern PFNGLUNIFORMSUBROUTINESUIVPROC                       gl3wUniformSubroutinesuiv;
-extern PFNGLUNMAPBUFFERPROC                                 gl3wUnmapBuffer;
-extern PFNGLUNMAPNAMEDBUFFERPROC                            gl3wUnmapNamedBuffer;
-extern PFNGLUSEPROGRAMPROC                                  gl3wUseProgram;
-extern PFNGLUSEPROGRAMSTAGESPROC                            gl3wUseProgramStages;
-extern PFNGLVALIDATEPROGRAMPROC                             gl3wValidateProgram;
-extern PFNGLVALIDATEPROGRAMPIPELINEPROC                     gl3wValidateProgramPipeline;
-extern PFNGLVERTEXARRAYATTRIBBINDINGPROC                    gl3wVertexArrayAttribBinding;
-extern PFNGLVERTEXARRAYATTRIBFORMATPROC                     gl3wVertexArrayAttribFormat;
-extern PFNGLVERTEXARRAYATTRIBIFORMATPROC                    gl3wVertexArrayAttribIFormat;
-extern PFNGLVERTEXARRAYATTRIBLFORMATPROC                    gl3wVertexArrayAttribLFormat;
-extern PFNGLVERTEXARRAYBINDINGDIVISORPROC                   gl3wVertexArrayBindingDivisor;
-extern PFNGLVERTEXARRAYELEMENTBUFFERPROC                    gl3wVertexArrayElementBuffer;
-extern PFNGLVERTEXARRAYVERTEXBUFFERPROC                     gl3wVertexArrayVertexBuffer;
-extern PFNGLVERTEXARRAYVERTEXBUFFERSPROC                    gl3wVertexArrayVertexBuffers;
-extern PFNGLVERTEXATTRIB1DPROC                              gl3wVertexAttrib1d;
-extern PFNGLVERTEXATTRIB1DVPROC                             gl3wVertexAttrib1dv;
-extern PFNGLVERTEXATTRIB1FPROC                              gl3wVertexAttrib1f;
-extern PFNGLVERTEXATTRIB1FVPROC                             gl3wVertexAttrib1fv;
-extern PFNGLVERTEXATTRIB1SPROC                              gl3wVertexAttrib1s;
-extern PFNGLVERTEXATTRIB1SVPROC                             gl3wVertexAttrib1sv;
-extern PFNGLVERTEXATTRIB2DPROC                              gl3wVertexAttrib2d;
-extern PFNGLVERTEXATTRIB2DVPROC                             gl3wVertexAttrib2dv;
-extern PFNGLVERTEXATTRIB2FPROC                              gl3wVertexAttrib2f;
-extern PFNGLVERTEXATTRIB2FVPROC                             gl3wVertexAttrib2fv;
-extern PFNGLVERTEXATTRIB2SPROC                              gl3wVertexAttrib2s;
-extern PFNGLVERTEXATTRIB2SVPROC                             gl3wVertexAttrib2sv;
-extern PFNGLVERTEXATTRIB3DPROC                              gl3wVertexAttrib3d;
-extern PFNGLVERTEXATTRIB3DVPROC                             gl3wVertexAttrib3dv;
-extern PFNGLVERTEXATTRIB3FPROC                              gl3wVertexAttrib3f;
-extern PFNGLVERTEXATTRIB3FVPROC                             gl3wVertexAttrib3fv;
-extern PFNGLVERTEXATTRIB3SPROC                              gl3wVertexAttrib3s;
-extern PFNGLVERTEXATTRIB3SVPROC                             gl3wVertexAttrib3sv;
-extern PFNGLVERTEXATTRIB4NBVPROC                            gl3wVertexAttrib4Nbv;
-extern PFNGLVERTEXATTRIB4NIVPROC                            gl3wVertexAttrib4Niv;
-extern PFNGLVERTEXATTRIB4NSVPROC                            gl3wVertexAttrib4Nsv;
-extern PFNGLVERTEXATTRIB4NUBPROC                            gl3wVertexAttrib4Nub;
-extern PFNGLVERTEXATTRIB4NUBVPROC                           gl3wVertexAttrib4Nubv;
-extern PFNGLVERTEXATTRIB4NUIVPROC                           gl3wVertexAttrib4Nuiv;
-extern PFNGLVERTEXATTRIB4NUSVPROC                           gl3wVertexAttrib4Nusv;
-extern PFNGLVERTEXATTRIB4BVPROC                             gl3wVertexAttrib4bv;
-extern PFNGLVERTEXATTRIB4DPROC                              gl3wVertexAttrib4d;
-extern PFNGLVERTEXATTRIB4DVPROC                             gl3wVertexAttrib4dv;
-extern PFNGLVERTEXATTRIB4FPROC                              gl3wVertexAttrib4f;
-extern PFNGLVERTEXATTRIB4FVPROC                             gl3wVertexAttrib4fv;
-extern PFNGLVERTEXATTRIB4IVPROC                             gl3wVertexAttrib4iv;
-extern PFNGLVERTEXATTRIB4SPROC                              gl3wVertexAttrib4s;
-extern PFNGLVERTEXATTRIB4SVPROC                             gl3wVertexAttrib4sv;
-extern PFNGLVERTEXATTRIB4UBVPROC                            gl3wVertexAttrib4ubv;
-extern PFNGLVERTEXATTRIB4UIVPROC                            gl3wVertexAttrib4uiv;
-extern PFNGLVERTEXATTRIB4USVPROC                            gl3wVertexAttrib4usv;
-extern PFNGLVERTEXATTRIBBINDINGPROC                         gl3wVertexAttribBinding;
-extern PFNGLVERTEXATTRIBDIVISORPROC                         gl3wVertexAttribDivisor;
-extern PFNGLVERTEXATTRIBFORMATPROC                          gl3wVertexAttribFormat;
-extern PFNGLVERTEXATTRIBI1IPROC                             gl3wVertexAttribI1i;
-extern PFNGLVERTEXATTRIBI1IVPROC                            gl3wVertexAttribI1iv;
-extern PFNGLVERTEXATTRIBI1UIPROC                            gl3wVertexAttribI1ui;
-extern PFNGLVERTEXATTRIBI1UIVPROC                           gl3wVertexAttribI1uiv;
-extern PFNGLVERTEXATTRIBI2IPROC                             gl3wVertexAttribI2i;
-extern PFNGLVERTEXATTRIBI2IVPROC                            gl3wVertexAttribI2iv;
-extern PFNGLVERTEXATTRIBI2UIPROC                            gl3wVertexAttribI2ui;
-extern PFNGLVERTEXATTRIBI2UIVPROC                           gl3wVertexAttribI2uiv;
-extern PFNGLVERTEXATTRIBI3IPROC                             gl3wVertexAttribI3i;
-extern PFNGLVERTEXATTRIBI3IVPROC                            gl3wVertexAttribI3iv;
-extern PFNGLVERTEXATTRIBI3UIPROC                            gl3wVertexAttribI3ui;
-extern PFNGLVERTEXATTRIBI3UIVPROC                           gl3wVertexAttribI3uiv;
-extern PFNGLVERTEXATTRIBI4BVPROC                            gl3wVertexAttribI4bv;
-extern PFNGLVERTEXATTRIBI4IPROC                             gl3wVertexAttribI4i;
-extern PFNGLVERTEXATTRIBI4IVPROC                            gl3wVertexAttribI4iv;
-extern PFNGLVERTEXATTRIBI4SVPROC                            gl3wVertexAttribI4sv;
-extern PFNGLVERTEXATTRIBI4UBVPROC                           gl3wVertexAttribI4ubv;
-extern PFNGLVERTEXATTRIBI4UIPROC                            gl3wVertexAttribI4ui;
-extern PFNGLVERTEXATTRIBI4UIVPROC                           gl3wVertexAttribI4uiv;
-extern PFNGLVERTEXATTRIBI4USVPROC                           gl3wVertexAttribI4usv;
-extern PFNGLVERTEXATTRIBIFORMATPROC                         gl3wVertexAttribIFormat;
-extern PFNGLVERTEXATTRIBIPOINTERPROC                        gl3wVertexAttribIPointer;
-extern PFNGLVERTEXATTRIBL1DPROC                             gl3wVertexAttribL1d;
-extern PFNGLVERTEXATTRIBL1DVPROC                            gl3wVertexAttribL1dv;
-extern PFNGLVERTEXATTRIBL1UI64ARBPROC                       gl3wVertexAttribL1ui64ARB;
-extern PFNGLVERTEXATTRIBL1UI64VARBPROC                      gl3wVertexAttribL1ui64vARB;
-extern PFNGLVERTEXATTRIBL2DPROC                             gl3wVertexAttribL2d;
-extern PFNGLVERTEXATTRIBL2DVPROC                            gl3wVertexAttribL2dv;
-extern PFNGLVERTEXATTRIBL3DPROC                             gl3wVertexAttribL3d;
-extern PFNGLVERTEXATTRIBL3DVPROC                            gl3wVertexAttribL3dv;
-extern PFNGLVERTEXATTRIBL4DPROC                             gl3wVertexAttribL4d;
-extern PFNGLVERTEXATTRIBL4DVPROC                            gl3wVertexAttribL4dv;
-extern PFNGLVERTEXATTRIBLFORMATPROC                         gl3wVertexAttribLFormat;
-extern PFNGLVERTEXATTRIBLPOINTERPROC                        gl3wVertexAttribLPointer;
-extern PFNGLVERTEXATTRIBP1UIPROC                            gl3wVertexAttribP1ui;
-extern PFNGLVERTEXATTRIBP1UIVPROC                           gl3wVertexAttribP1uiv;
-extern PFNGLVERTEXATTRIBP2UIPROC                            gl3wVertexAttribP2ui;
-extern PFNGLVERTEXATTRIBP2UIVPROC                           gl3wVertexAttribP2uiv;
-extern PFNGLVERTEXATTRIBP3UIPROC                            gl3wVertexAttribP3ui;
-extern PFNGLVERTEXATTRIBP3UIVPROC                           gl3wVertexAttribP3uiv;
-extern PFNGLVERTEXATTRIBP4UIPROC                            gl3wVertexAttribP4ui;
-extern PFNGLVERTEXATTRIBP4UIVPROC                           gl3wVertexAttribP4uiv;
-extern PFNGLVERTEXATTRIBPOINTERPROC                         gl3wVertexAttribPointer;
-extern PFNGLVERTEXBINDINGDIVISORPROC                        gl3wVertexBindingDivisor;
-extern PFNGLVIEWPORTPROC                                    gl3wViewport;
-extern PFNGLVIEWPORTARRAYVPROC                              gl3wViewportArrayv;
-extern PFNGLVIEWPORTINDEXEDFPROC                            gl3wViewportIndexedf;
-extern PFNGLVIEWPORTINDEXEDFVPROC                           gl3wViewportIndexedfv;
-extern PFNGLWAITSYNCPROC                                    gl3wWaitSync;
+#define GL3W_PROC_COUNT 700
+
+union GL3WProcs {
+	GL3WglProc ptr[GL3W_PROC_COUNT];
+	struct {
+		PFNGLACTIVESHADERPROGRAMPROC                         ActiveShaderProgram;
+		PFNGLACTIVETEXTUREPROC                               ActiveTexture;
+		PFNGLATTACHSHADERPROC                                AttachShader;
+		PFNGLBEGINCONDITIONALRENDERPROC                      BeginConditionalRender;
+		PFNGLBEGINQUERYPROC                                  BeginQuery;
+		PFNGLBEGINQUERYINDEXEDPROC                           BeginQueryIndexed;
+		PFNGLBEGINTRANSFORMFEEDBACKPROC                      BeginTransformFeedback;
+		PFNGLBINDATTRIBLOCATIONPROC                          BindAttribLocation;
+		PFNGLBINDBUFFERPROC                                  BindBuffer;
+		PFNGLBINDBUFFERBASEPROC                              BindBufferBase;
+		PFNGLBINDBUFFERRANGEPROC                             BindBufferRange;
+		PFNGLBINDBUFFERSBASEPROC                             BindBuffersBase;
+		PFNGLBINDBUFFERSRANGEPROC                            BindBuffersRange;
+		PFNGLBINDFRAGDATALOCATIONPROC                        BindFragDataLocation;
+		PFNGLBINDFRAGDATALOCATIONINDEXEDPROC                 BindFragDataLocationIndexed;
+		PFNGLBINDFRAMEBUFFERPROC                             BindFramebuffer;
+		PFNGLBINDIMAGETEXTUREPROC                            BindImageTexture;
+		PFNGLBINDIMAGETEXTURESPROC                           BindImageTextures;
+		PFNGLBINDPROGRAMPIPELINEPROC                         BindProgramPipeline;
+		PFNGLBINDRENDERBUFFERPROC                            BindRenderbuffer;
+		PFNGLBINDSAMPLERPROC                                 BindSampler;
+		PFNGLBINDSAMPLERSPROC                                BindSamplers;
+		PFNGLBINDTEXTUREPROC                                 BindTexture;
+		PFNGLBINDTEXTUREUNITPROC                             BindTextureUnit;
+		PFNGLBINDTEXTURESPROC                                BindTextures;
+		PFNGLBINDTRANSFORMFEEDBACKPROC                       BindTransformFeedback;
+		PFNGLBINDVERTEXARRAYPROC                             BindVertexArray;
+		PFNGLBINDVERTEXBUFFERPROC                            BindVertexBuffer;
+		PFNGLBINDVERTEXBUFFERSPROC                           BindVertexBuffers;
+		PFNGLBLENDCOLORPROC                                  BlendColor;
+		PFNGLBLENDEQUATIONPROC                               BlendEquation;
+		PFNGLBLENDEQUATIONSEPARATEPROC                       BlendEquationSeparate;
+		PFNGLBLENDEQUATIONSEPARATEIPROC                      BlendEquationSeparatei;
+		PFNGLBLENDEQUATIONSEPARATEIARBPROC                   BlendEquationSeparateiARB;
+		PFNGLBLENDEQUATIONIPROC                              BlendEquationi;
+		PFNGLBLENDEQUATIONIARBPROC                           BlendEquationiARB;
+		PFNGLBLENDFUNCPROC                                   BlendFunc;
+		PFNGLBLENDFUNCSEPARATEPROC                           BlendFuncSeparate;
+		PFNGLBLENDFUNCSEPARATEIPROC                          BlendFuncSeparatei;
+		PFNGLBLENDFUNCSEPARATEIARBPROC                       BlendFuncSeparateiARB;
+		PFNGLBLENDFUNCIPROC                                  BlendFunci;
+		PFNGLBLENDFUNCIARBPROC                               BlendFunciARB;
+		PFNGLBLITFRAMEBUFFERPROC                             BlitFramebuffer;
+		PFNGLBLITNAMEDFRAMEBUFFERPROC                        BlitNamedFramebuffer;
+		PFNGLBUFFERDATAPROC                                  BufferData;
+		PFNGLBUFFERPAGECOMMITMENTARBPROC                     BufferPageCommitmentARB;
+		PFNGLBUFFERSTORAGEPROC                               BufferStorage;
+		PFNGLBUFFERSUBDATAPROC                               BufferSubData;
+		PFNGLCHECKFRAMEBUFFERSTATUSPROC                      CheckFramebufferStatus;
+		PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC                 CheckNamedFramebufferStatus;
+		PFNGLCLAMPCOLORPROC                                  ClampColor;
+		PFNGLCLEARPROC                                       Clear;
+		PFNGLCLEARBUFFERDATAPROC                             ClearBufferData;
+		PFNGLCLEARBUFFERSUBDATAPROC                          ClearBufferSubData;
+		PFNGLCLEARBUFFERFIPROC                               ClearBufferfi;
+		PFNGLCLEARBUFFERFVPROC                               ClearBufferfv;
+		PFNGLCLEARBUFFERIVPROC                               ClearBufferiv;
+		PFNGLCLEARBUFFERUIVPROC                              ClearBufferuiv;
+		PFNGLCLEARCOLORPROC                                  ClearColor;
+		PFNGLCLEARDEPTHPROC                                  ClearDepth;
+		PFNGLCLEARDEPTHFPROC                                 ClearDepthf;
+		PFNGLCLEARNAMEDBUFFERDATAPROC                        ClearNamedBufferData;
+		PFNGLCLEARNAMEDBUFFERSUBDATAPROC                     ClearNamedBufferSubData;
+		PFNGLCLEARNAMEDFRAMEBUFFERFIPROC                     ClearNamedFramebufferfi;
+		PFNGLCLEARNAMEDFRAMEBUFFERFVPROC                     ClearNamedFramebufferfv;
+		PFNGLCLEARNAMEDFRAMEBUFFERIVPROC                     ClearNamedFramebufferiv;
+		PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC                    ClearNamedFramebufferuiv;
+		PFNGLCLEARSTENCILPROC                                ClearStencil;
+		PFNGLCLEARTEXIMAGEPROC                               ClearTexImage;
+		PFNGLCLEARTEXSUBIMAGEPROC                            ClearTexSubImage;
+		PFNGLCLIENTWAITSYNCPROC                              ClientWaitSync;
+		PFNGLCLIPCONTROLPROC                                 ClipControl;
+		PFNGLCOLORMASKPROC                                   ColorMask;
+		PFNGLCOLORMASKIPROC                                  ColorMaski;
+		PFNGLCOMPILESHADERPROC                               CompileShader;
+		PFNGLCOMPILESHADERINCLUDEARBPROC                     CompileShaderIncludeARB;
+		PFNGLCOMPRESSEDTEXIMAGE1DPROC                        CompressedTexImage1D;
+		PFNGLCOMPRESSEDTEXIMAGE2DPROC                        CompressedTexImage2D;
+		PFNGLCOMPRESSEDTEXIMAGE3DPROC                        CompressedTexImage3D;
+		PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC                     CompressedTexSubImage1D;
+		PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC                     CompressedTexSubImage2D;
+		PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC                     CompressedTexSubImage3D;
+		PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC                 CompressedTextureSubImage1D;
+		PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC                 CompressedTextureSubImage2D;
+		PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC                 CompressedTextureSubImage3D;
+		PFNGLCOPYBUFFERSUBDATAPROC                           CopyBufferSubData;
+		PFNGLCOPYIMAGESUBDATAPROC                            CopyImageSubData;
+		PFNGLCOPYNAMEDBUFFERSUBDATAPROC                      CopyNamedBufferSubData;
+		PFNGLCOPYTEXIMAGE1DPROC                              CopyTexImage1D;
+		PFNGLCOPYTEXIMAGE2DPROC                              CopyTexImage2D;
+		PFNGLCOPYTEXSUBIMAGE1DPROC                           CopyTexSubImage1D;
+		PFNGLCOPYTEXSUBIMAGE2DPROC                           CopyTexSubImage2D;
+		PFNGLCOPYTEXSUBIMAGE3DPROC                           CopyTexSubImage3D;
+		PFNGLCOPYTEXTURESUBIMAGE1DPROC                       CopyTextureSubImage1D;
+		PFNGLCOPYTEXTURESUBIMAGE2DPROC                       CopyTextureSubImage2D;
+		PFNGLCOPYTEXTURESUBIMAGE3DPROC                       CopyTextureSubImage3D;
+		PFNGLCREATEBUFFERSPROC                               CreateBuffers;
+		PFNGLCREATEFRAMEBUFFERSPROC                          CreateFramebuffers;
+		PFNGLCREATEPROGRAMPROC                               CreateProgram;
+		PFNGLCREATEPROGRAMPIPELINESPROC                      CreateProgramPipelines;
+		PFNGLCREATEQUERIESPROC                               CreateQueries;
+		PFNGLCREATERENDERBUFFERSPROC                         CreateRenderbuffers;
+		PFNGLCREATESAMPLERSPROC                              CreateSamplers;
+		PFNGLCREATESHADERPROC                                CreateShader;
+		PFNGLCREATESHADERPROGRAMVPROC                        CreateShaderProgramv;
+		PFNGLCREATESYNCFROMCLEVENTARBPROC                    CreateSyncFromCLeventARB;
+		PFNGLCREATETEXTURESPROC                              CreateTextures;
+		PFNGLCREATETRANSFORMFEEDBACKSPROC                    CreateTransformFeedbacks;
+		PFNGLCREATEVERTEXARRAYSPROC                          CreateVertexArrays;
+		PFNGLCULLFACEPROC                                    CullFace;
+		PFNGLDEBUGMESSAGECALLBACKPROC                        DebugMessageCallback;
+		PFNGLDEBUGMESSAGECALLBACKARBPROC                     DebugMessageCallbackARB;
+		PFNGLDEBUGMESSAGECONTROLPROC                         DebugMessageControl;
+		PFNGLDEBUGMESSAGECONTROLARBPROC                      DebugMessageControlARB;
+		PFNGLDEBUGMESSAGEINSERTPROC                          DebugMessageInsert;
+		PFNGLDEBUGMESSAGEINSERTARBPROC                       DebugMessageInsertARB;
+		PFNGLDELETEBUFFERSPROC                               DeleteBuffers;
+		PFNGLDELETEFRAMEBUFFERSPROC                          DeleteFramebuffers;
+		PFNGLDELETENAMEDSTRINGARBPROC                        DeleteNamedStringARB;
+		PFNGLDELETEPROGRAMPROC                               DeleteProgram;
+		PFNGLDELETEPROGRAMPIPELINESPROC                      DeleteProgramPipelines;
+		PFNGLDELETEQUERIESPROC                               DeleteQueries;
+		PFNGLDELETERENDERBUFFERSPROC                         DeleteRenderbuffers;
+		PFNGLDELETESAMPLERSPROC                              DeleteSamplers;
+		PFNGLDELETESHADERPROC                                DeleteShader;
+		PFNGLDELETESYNCPROC                                  DeleteSync;
+		PFNGLDELETETEXTURESPROC                              DeleteTextures;
+		PFNGLDELETETRANSFORMFEEDBACKSPROC                    DeleteTransformFeedbacks;
+		PFNGLDELETEVERTEXARRAYSPROC                          DeleteVertexArrays;
+		PFNGLDEPTHFUNCPROC                                   DepthFunc;
+		PFNGLDEPTHMASKPROC                                   DepthMask;
+		PFNGLDEPTHRANGEPROC                                  DepthRange;
+		PFNGLDEPTHRANGEARRAYVPROC                            DepthRangeArrayv;
+		PFNGLDEPTHRANGEINDEXEDPROC                           DepthRangeIndexed;
+		PFNGLDEPTHRANGEFPROC                                 DepthRangef;
+		PFNGLDETACHSHADERPROC                                DetachShader;
+		PFNGLDISABLEPROC                                     Disable;
+		PFNGLDISABLEVERTEXARRAYATTRIBPROC                    DisableVertexArrayAttrib;
+		PFNGLDISABLEVERTEXATTRIBARRAYPROC                    DisableVertexAttribArray;
+		PFNGLDISABLEIPROC                                    Disablei;
+		PFNGLDISPATCHCOMPUTEPROC                             DispatchCompute;
+		PFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC                 DispatchComputeGroupSizeARB;
+		PFNGLDISPATCHCOMPUTEINDIRECTPROC                     DispatchComputeIndirect;
+		PFNGLDRAWARRAYSPROC                                  DrawArrays;
+		PFNGLDRAWARRAYSINDIRECTPROC                          DrawArraysIndirect;
+		PFNGLDRAWARRAYSINSTANCEDPROC                         DrawArraysInstanced;
+		PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC             DrawArraysInstancedBaseInstance;
+		PFNGLDRAWBUFFERPROC                                  DrawBuffer;
+		PFNGLDRAWBUFFERSPROC                                 DrawBuffers;
+		PFNGLDRAWELEMENTSPROC                                DrawElements;
+		PFNGLDRAWELEMENTSBASEVERTEXPROC                      DrawElementsBaseVertex;
+		PFNGLDRAWELEMENTSINDIRECTPROC                        DrawElementsIndirect;
+		PFNGLDRAWELEMENTSINSTANCEDPROC                       DrawElementsInstanced;
+		PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC           DrawElementsInstancedBaseInstance;
+		PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC             DrawElementsInstancedBaseVertex;
+		PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC DrawElementsInstancedBaseVertexBaseInstance;
+		PFNGLDRAWRANGEELEMENTSPROC                           DrawRangeElements;
+		PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC                 DrawRangeElementsBaseVertex;
+		PFNGLDRAWTRANSFORMFEEDBACKPROC                       DrawTransformFeedback;
+		PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC              DrawTransformFeedbackInstanced;
+		PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC                 DrawTransformFeedbackStream;
+		PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC        DrawTransformFeedbackStreamInstanced;
+		PFNGLENABLEPROC                                      Enable;
+		PFNGLENABLEVERTEXARRAYATTRIBPROC                     EnableVertexArrayAttrib;
+		PFNGLENABLEVERTEXATTRIBARRAYPROC                     EnableVertexAttribArray;
+		PFNGLENABLEIPROC                                     Enablei;
+		PFNGLENDCONDITIONALRENDERPROC                        EndConditionalRender;
+		PFNGLENDQUERYPROC                                    EndQuery;
+		PFNGLENDQUERYINDEXEDPROC                             EndQueryIndexed;
+		PFNGLENDTRANSFORMFEEDBACKPROC                        EndTransformFeedback;
+		PFNGLFENCESYNCPROC                                   FenceSync;
+		PFNGLFINISHPROC                                      Finish;
+		PFNGLFLUSHPROC                                       Flush;
+		PFNGLFLUSHMAPPEDBUFFERRANGEPROC                      FlushMappedBufferRange;
+		PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC                 FlushMappedNamedBufferRange;
+		PFNGLFRAMEBUFFERPARAMETERIPROC                       FramebufferParameteri;
+		PFNGLFRAMEBUFFERRENDERBUFFERPROC                     FramebufferRenderbuffer;
+		PFNGLFRAMEBUFFERTEXTUREPROC                          FramebufferTexture;
+		PFNGLFRAMEBUFFERTEXTURE1DPROC                        FramebufferTexture1D;
+		PFNGLFRAMEBUFFERTEXTURE2DPROC                        FramebufferTexture2D;
+		PFNGLFRAMEBUFFERTEXTURE3DPROC                        FramebufferTexture3D;
+		PFNGLFRAMEBUFFERTEXTURELAYERPROC                     FramebufferTextureLayer;
+		PFNGLFRONTFACEPROC                                   FrontFace;
+		PFNGLGENBUFFERSPROC                                  GenBuffers;
+		PFNGLGENFRAMEBUFFERSPROC                             GenFramebuffers;
+		PFNGLGENPROGRAMPIPELINESPROC                         GenProgramPipelines;
+		PFNGLGENQUERIESPROC                                  GenQueries;
+		PFNGLGENRENDERBUFFERSPROC                            GenRenderbuffers;
+		PFNGLGENSAMPLERSPROC                                 GenSamplers;
+		PFNGLGENTEXTURESPROC                                 GenTextures;
+		PFNGLGENTRANSFORMFEEDBACKSPROC                       GenTransformFeedbacks;
+		PFNGLGENVERTEXARRAYSPROC                             GenVertexArrays;
+		PFNGLGENERATEMIPMAPPROC                              GenerateMipmap;
+		PFNGLGENERATETEXTUREMIPMAPPROC                       GenerateTextureMipmap;
+		PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC              GetActiveAtomicCounterBufferiv;
+		PFNGLGETACTIVEATTRIBPROC                             GetActiveAttrib;
+		PFNGLGETACTIVESUBROUTINENAMEPROC                     GetActiveSubroutineName;
+		PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC              GetActiveSubroutineUniformName;
+		PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC                GetActiveSubroutineUniformiv;
+		PFNGLGETACTIVEUNIFORMPROC                            GetActiveUniform;
+		PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC                   GetActiveUniformBlockName;
+		PFNGLGETACTIVEUNIFORMBLOCKIVPROC                     GetActiveUniformBlockiv;
+		PFNGLGETACTIVEUNIFORMNAMEPROC                        GetActiveUniformName;
+		PFNGLGETACTIVEUNIFORMSIVPROC                         GetActiveUniformsiv;
+		PFNGLGETATTACHEDSHADERSPROC                          GetAttachedShaders;
+		PFNGLGETATTRIBLOCATIONPROC                           GetAttribLocation;
+		PFNGLGETBOOLEANI_VPROC                               GetBooleani_v;
+		PFNGLGETBOOLEANVPROC                                 GetBooleanv;
+		PFNGLGETBUFFERPARAMETERI64VPROC                      GetBufferParameteri64v;
+		PFNGLGETBUFFERPARAMETERIVPROC                        GetBufferParameteriv;
+		PFNGLGETBUFFERPOINTERVPROC                           GetBufferPointerv;
+		PFNGLGETBUFFERSUBDATAPROC                            GetBufferSubData;
+		PFNGLGETCOMPRESSEDTEXIMAGEPROC                       GetCompressedTexImage;
+		PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC                   GetCompressedTextureImage;
+		PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC                GetCompressedTextureSubImage;
+		PFNGLGETDEBUGMESSAGELOGPROC                          GetDebugMessageLog;
+		PFNGLGETDEBUGMESSAGELOGARBPROC                       GetDebugMessageLogARB;
+		PFNGLGETDOUBLEI_VPROC                                GetDoublei_v;
+		PFNGLGETDOUBLEVPROC                                  GetDoublev;
+		PFNGLGETERRORPROC                                    GetError;
+		PFNGLGETFLOATI_VPROC                                 GetFloati_v;
+		PFNGLGETFLOATVPROC                                   GetFloatv;
+		PFNGLGETFRAGDATAINDEXPROC                            GetFragDataIndex;
+		PFNGLGETFRAGDATALOCATIONPROC                         GetFragDataLocation;
+		PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC         GetFramebufferAttachmentParameteriv;
+		PFNGLGETFRAMEBUFFERPARAMETERIVPROC                   GetFramebufferParameteriv;
+		PFNGLGETGRAPHICSRESETSTATUSPROC                      GetGraphicsResetStatus;
+		PFNGLGETGRAPHICSRESETSTATUSARBPROC                   GetGraphicsResetStatusARB;
+		PFNGLGETIMAGEHANDLEARBPROC                           GetImageHandleARB;
+		PFNGLGETINTEGER64I_VPROC                             GetInteger64i_v;
+		PFNGLGETINTEGER64VPROC                               GetInteger64v;
+		PFNGLGETINTEGERI_VPROC                               GetIntegeri_v;
+		PFNGLGETINTEGERVPROC                                 GetIntegerv;
+		PFNGLGETINTERNALFORMATI64VPROC                       GetInternalformati64v;
+		PFNGLGETINTERNALFORMATIVPROC                         GetInternalformativ;
+		PFNGLGETMULTISAMPLEFVPROC                            GetMultisamplefv;
+		PFNGLGETNAMEDBUFFERPARAMETERI64VPROC                 GetNamedBufferParameteri64v;
+		PFNGLGETNAMEDBUFFERPARAMETERIVPROC                   GetNamedBufferParameteriv;
+		PFNGLGETNAMEDBUFFERPOINTERVPROC                      GetNamedBufferPointerv;
+		PFNGLGETNAMEDBUFFERSUBDATAPROC                       GetNamedBufferSubData;
+		PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC    GetNamedFramebufferAttachmentParameteriv;
+		PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC              GetNamedFramebufferParameteriv;
+		PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC             GetNamedRenderbufferParameteriv;
+		PFNGLGETNAMEDSTRINGARBPROC                           GetNamedStringARB;
+		PFNGLGETNAMEDSTRINGIVARBPROC                         GetNamedStringivARB;
+		PFNGLGETOBJECTLABELPROC                              GetObjectLabel;
+		PFNGLGETOBJECTPTRLABELPROC                           GetObjectPtrLabel;
+		PFNGLGETPOINTERVPROC                                 GetPointerv;
+		PFNGLGETPROGRAMBINARYPROC                            GetProgramBinary;
+		PFNGLGETPROGRAMINFOLOGPROC                           GetProgramInfoLog;
+		PFNGLGETPROGRAMINTERFACEIVPROC                       GetProgramInterfaceiv;
+		PFNGLGETPROGRAMPIPELINEINFOLOGPROC                   GetProgramPipelineInfoLog;
+		PFNGLGETPROGRAMPIPELINEIVPROC                        GetProgramPipelineiv;
+		PFNGLGETPROGRAMRESOURCEINDEXPROC                     GetProgramResourceIndex;
+		PFNGLGETPROGRAMRESOURCELOCATIONPROC                  GetProgramResourceLocation;
+		PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC             GetProgramResourceLocationIndex;
+		PFNGLGETPROGRAMRESOURCENAMEPROC                      GetProgramResourceName;
+		PFNGLGETPROGRAMRESOURCEIVPROC                        GetProgramResourceiv;
+		PFNGLGETPROGRAMSTAGEIVPROC                           GetProgramStageiv;
+		PFNGLGETPROGRAMIVPROC                                GetProgramiv;
+		PFNGLGETQUERYBUFFEROBJECTI64VPROC                    GetQueryBufferObjecti64v;
+		PFNGLGETQUERYBUFFEROBJECTIVPROC                      GetQueryBufferObjectiv;
+		PFNGLGETQUERYBUFFEROBJECTUI64VPROC                   GetQueryBufferObjectui64v;
+		PFNGLGETQUERYBUFFEROBJECTUIVPROC                     GetQueryBufferObjectuiv;
+		PFNGLGETQUERYINDEXEDIVPROC                           GetQueryIndexediv;
+		PFNGLGETQUERYOBJECTI64VPROC                          GetQueryObjecti64v;
+		PFNGLGETQUERYOBJECTIVPROC                            GetQueryObjectiv;
+		PFNGLGETQUERYOBJECTUI64VPROC                         GetQueryObjectui64v;
+		PFNGLGETQUERYOBJECTUIVPROC                           GetQueryObjectuiv;
+		PFNGLGETQUERYIVPROC                                  GetQueryiv;
+		PFNGLGETRENDERBUFFERPARAMETERIVPROC                  GetRenderbufferParameteriv;
+		PFNGLGETSAMPLERPARAMETERIIVPROC                      GetSamplerParameterIiv;
+		PFNGLGETSAMPLERPARAMETERIUIVPROC                     GetSamplerParameterIuiv;
+		PFNGLGETSAMPLERPARAMETERFVPROC                       GetSamplerParameterfv;
+		PFNGLGETSAMPLERPARAMETERIVPROC                       GetSamplerParameteriv;
+		PFNGLGETSHADERINFOLOGPROC                            GetShaderInfoLog;
+		PFNGLGETSHADERPRECISIONFORMATPROC                    GetShaderPrecisionFormat;
+		PFNGLGETSHADERSOURCEPROC                             GetShaderSource;
+		PFNGLGETSHADERIVPROC                                 GetShaderiv;
+		PFNGLGETSTRINGPROC                                   GetString;
+		PFNGLGETSTRINGIPROC                                  GetStringi;
+		PFNGLGETSUBROUTINEINDEXPROC                          GetSubroutineIndex;
+		PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC                GetSubroutineUniformLocation;
+		PFNGLGETSYNCIVPROC                                   GetSynciv;
+		PFNGLGETTEXIMAGEPROC                                 GetTexImage;
+		PFNGLGETTEXLEVELPARAMETERFVPROC                      GetTexLevelParameterfv;
+		PFNGLGETTEXLEVELPARAMETERIVPROC                      GetTexLevelParameteriv;
+		PFNGLGETTEXPARAMETERIIVPROC                          GetTexParameterIiv;
+		PFNGLGETTEXPARAMETERIUIVPROC                         GetTexParameterIuiv;
+		PFNGLGETTEXPARAMETERFVPROC                           GetTexParameterfv;
+		PFNGLGETTEXPARAMETERIVPROC                           GetTexParameteriv;
+		PFNGLGETTEXTUREHANDLEARBPROC                         GetTextureHandleARB;
+		PFNGLGETTEXTUREIMAGEPROC                             GetTextureImage;
+		PFNGLGETTEXTURELEVELPARAMETERFVPROC                  GetTextureLevelParameterfv;
+		PFNGLGETTEXTURELEVELPARAMETERIVPROC                  GetTextureLevelParameteriv;
+		PFNGLGETTEXTUREPARAMETERIIVPROC                      GetTextureParameterIiv;
+		PFNGLGETTEXTUREPARAMETERIUIVPROC                     GetTextureParameterIuiv;
+		PFNGLGETTEXTUREPARAMETERFVPROC                       GetTextureParameterfv;
+		PFNGLGETTEXTUREPARAMETERIVPROC                       GetTextureParameteriv;
+		PFNGLGETTEXTURESAMPLERHANDLEARBPROC                  GetTextureSamplerHandleARB;
+		PFNGLGETTEXTURESUBIMAGEPROC                          GetTextureSubImage;
+		PFNGLGETTRANSFORMFEEDBACKVARYINGPROC                 GetTransformFeedbackVarying;
+		PFNGLGETTRANSFORMFEEDBACKI64_VPROC                   GetTransformFeedbacki64_v;
+		PFNGLGETTRANSFORMFEEDBACKI_VPROC                     GetTransformFeedbacki_v;
+		PFNGLGETTRANSFORMFEEDBACKIVPROC                      GetTransformFeedbackiv;
+		PFNGLGETUNIFORMBLOCKINDEXPROC                        GetUniformBlockIndex;
+		PFNGLGETUNIFORMINDICESPROC                           GetUniformIndices;
+		PFNGLGETUNIFORMLOCATIONPROC                          GetUniformLocation;
+		PFNGLGETUNIFORMSUBROUTINEUIVPROC                     GetUniformSubroutineuiv;
+		PFNGLGETUNIFORMDVPROC                                GetUniformdv;
+		PFNGLGETUNIFORMFVPROC                                GetUniformfv;
+		PFNGLGETUNIFORMIVPROC                                GetUniformiv;
+		PFNGLGETUNIFORMUIVPROC                               GetUniformuiv;
+		PFNGLGETVERTEXARRAYINDEXED64IVPROC                   GetVertexArrayIndexed64iv;
+		PFNGLGETVERTEXARRAYINDEXEDIVPROC                     GetVertexArrayIndexediv;
+		PFNGLGETVERTEXARRAYIVPROC                            GetVertexArrayiv;
+		PFNGLGETVERTEXATTRIBIIVPROC                          GetVertexAttribIiv;
+		PFNGLGETVERTEXATTRIBIUIVPROC                         GetVertexAttribIuiv;
+		PFNGLGETVERTEXATTRIBLDVPROC                          GetVertexAttribLdv;
+		PFNGLGETVERTEXATTRIBLUI64VARBPROC                    GetVertexAttribLui64vARB;
+		PFNGLGETVERTEXATTRIBPOINTERVPROC                     GetVertexAttribPointerv;
+		PFNGLGETVERTEXATTRIBDVPROC                           GetVertexAttribdv;
+		PFNGLGETVERTEXATTRIBFVPROC                           GetVertexAttribfv;
+		PFNGLGETVERTEXATTRIBIVPROC                           GetVertexAttribiv;
+		PFNGLGETNCOMPRESSEDTEXIMAGEPROC                      GetnCompressedTexImage;
+		PFNGLGETNCOMPRESSEDTEXIMAGEARBPROC                   GetnCompressedTexImageARB;
+		PFNGLGETNTEXIMAGEPROC                                GetnTexImage;
+		PFNGLGETNTEXIMAGEARBPROC                             GetnTexImageARB;
+		PFNGLGETNUNIFORMDVPROC                               GetnUniformdv;
+		PFNGLGETNUNIFORMDVARBPROC                            GetnUniformdvARB;
+		PFNGLGETNUNIFORMFVPROC                               GetnUniformfv;
+		PFNGLGETNUNIFORMFVARBPROC                            GetnUniformfvARB;
+		PFNGLGETNUNIFORMIVPROC                               GetnUniformiv;
+		PFNGLGETNUNIFORMIVARBPROC                            GetnUniformivARB;
+		PFNGLGETNUNIFORMUIVPROC                              GetnUniformuiv;
+		PFNGLGETNUNIFORMUIVARBPROC                           GetnUniformuivARB;
+		PFNGLHINTPROC                                        Hint;
+		PFNGLINVALIDATEBUFFERDATAPROC                        InvalidateBufferData;
+		PFNGLINVALIDATEBUFFERSUBDATAPROC                     InvalidateBufferSubData;
+		PFNGLINVALIDATEFRAMEBUFFERPROC                       InvalidateFramebuffer;
+		PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC              InvalidateNamedFramebufferData;
+		PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC           InvalidateNamedFramebufferSubData;
+		PFNGLINVALIDATESUBFRAMEBUFFERPROC                    InvalidateSubFramebuffer;
+		PFNGLINVALIDATETEXIMAGEPROC                          InvalidateTexImage;
+		PFNGLINVALIDATETEXSUBIMAGEPROC                       InvalidateTexSubImage;
+		PFNGLISBUFFERPROC                                    IsBuffer;
+		PFNGLISENABLEDPROC                                   IsEnabled;
+		PFNGLISENABLEDIPROC                                  IsEnabledi;
+		PFNGLISFRAMEBUFFERPROC                               IsFramebuffer;
+		PFNGLISIMAGEHANDLERESIDENTARBPROC                    IsImageHandleResidentARB;
+		PFNGLISNAMEDSTRINGARBPROC                            IsNamedStringARB;
+		PFNGLISPROGRAMPROC                                   IsProgram;
+		PFNGLISPROGRAMPIPELINEPROC                           IsProgramPipeline;
+		PFNGLISQUERYPROC                                     IsQuery;
+		PFNGLISRENDERBUFFERPROC                              IsRenderbuffer;
+		PFNGLISSAMPLERPROC                                   IsSampler;
+		PFNGLISSHADERPROC                                    IsShader;
+		PFNGLISSYNCPROC                                      IsSync;
+		PFNGLISTEXTUREPROC                                   IsTexture;
+		PFNGLISTEXTUREHANDLERESIDENTARBPROC                  IsTextureHandleResidentARB;
+		PFNGLISTRANSFORMFEEDBACKPROC                         IsTransformFeedback;
+		PFNGLISVERTEXARRAYPROC                               IsVertexArray;
+		PFNGLLINEWIDTHPROC                                   LineWidth;
+		PFNGLLINKPROGRAMPROC                                 LinkProgram;
+		PFNGLLOGICOPPROC                                     LogicOp;
+		PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC               MakeImageHandleNonResidentARB;
+		PFNGLMAKEIMAGEHANDLERESIDENTARBPROC                  MakeImageHandleResidentARB;
+		PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC             MakeTextureHandleNonResidentARB;
+		PFNGLMAKETEXTUREHANDLERESIDENTARBPROC                MakeTextureHandleResidentARB;
+		PFNGLMAPBUFFERPROC                                   MapBuffer;
+		PFNGLMAPBUFFERRANGEPROC                              MapBufferRange;
+		PFNGLMAPNAMEDBUFFERPROC                              MapNamedBuffer;
+		PFNGLMAPNAMEDBUFFERRANGEPROC                         MapNamedBufferRange;
+		PFNGLMEMORYBARRIERPROC                               MemoryBarrier;
+		PFNGLMEMORYBARRIERBYREGIONPROC                       MemoryBarrierByRegion;
+		PFNGLMINSAMPLESHADINGPROC                            MinSampleShading;
+		PFNGLMINSAMPLESHADINGARBPROC                         MinSampleShadingARB;
+		PFNGLMULTIDRAWARRAYSPROC                             MultiDrawArrays;
+		PFNGLMULTIDRAWARRAYSINDIRECTPROC                     MultiDrawArraysIndirect;
+		PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC             MultiDrawArraysIndirectCountARB;
+		PFNGLMULTIDRAWELEMENTSPROC                           MultiDrawElements;
+		PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC                 MultiDrawElementsBaseVertex;
+		PFNGLMULTIDRAWELEMENTSINDIRECTPROC                   MultiDrawElementsIndirect;
+		PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC           MultiDrawElementsIndirectCountARB;
+		PFNGLNAMEDBUFFERDATAPROC                             NamedBufferData;
+		PFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC                NamedBufferPageCommitmentARB;
+		PFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC                NamedBufferPageCommitmentEXT;
+		PFNGLNAMEDBUFFERSTORAGEPROC                          NamedBufferStorage;
+		PFNGLNAMEDBUFFERSUBDATAPROC                          NamedBufferSubData;
+		PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC                  NamedFramebufferDrawBuffer;
+		PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC                 NamedFramebufferDrawBuffers;
+		PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC                  NamedFramebufferParameteri;
+		PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC                  NamedFramebufferReadBuffer;
+		PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC                NamedFramebufferRenderbuffer;
+		PFNGLNAMEDFRAMEBUFFERTEXTUREPROC                     NamedFramebufferTexture;
+		PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC                NamedFramebufferTextureLayer;
+		PFNGLNAMEDRENDERBUFFERSTORAGEPROC                    NamedRenderbufferStorage;
+		PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC         NamedRenderbufferStorageMultisample;
+		PFNGLNAMEDSTRINGARBPROC                              NamedStringARB;
+		PFNGLOBJECTLABELPROC                                 ObjectLabel;
+		PFNGLOBJECTPTRLABELPROC                              ObjectPtrLabel;
+		PFNGLPATCHPARAMETERFVPROC                            PatchParameterfv;
+		PFNGLPATCHPARAMETERIPROC                             PatchParameteri;
+		PFNGLPAUSETRANSFORMFEEDBACKPROC                      PauseTransformFeedback;
+		PFNGLPIXELSTOREFPROC                                 PixelStoref;
+		PFNGLPIXELSTOREIPROC                                 PixelStorei;
+		PFNGLPOINTPARAMETERFPROC                             PointParameterf;
+		PFNGLPOINTPARAMETERFVPROC                            PointParameterfv;
+		PFNGLPOINTPARAMETERIPROC                             PointParameteri;
+		PFNGLPOINTPARAMETERIVPROC                            PointParameteriv;
+		PFNGLPOINTSIZEPROC                                   PointSize;
+		PFNGLPOLYGONMODEPROC                                 PolygonMode;
+		PFNGLPOLYGONOFFSETPROC                               PolygonOffset;
+		PFNGLPOPDEBUGGROUPPROC                               PopDebugGroup;
+		PFNGLPRIMITIVERESTARTINDEXPROC                       PrimitiveRestartIndex;
+		PFNGLPROGRAMBINARYPROC                               ProgramBinary;
+		PFNGLPROGRAMPARAMETERIPROC                           ProgramParameteri;
+		PFNGLPROGRAMUNIFORM1DPROC                            ProgramUniform1d;
+		PFNGLPROGRAMUNIFORM1DVPROC                           ProgramUniform1dv;
+		PFNGLPROGRAMUNIFORM1FPROC                            ProgramUniform1f;
+		PFNGLPROGRAMUNIFORM1FVPROC                           ProgramUniform1fv;
+		PFNGLPROGRAMUNIFORM1IPROC                            ProgramUniform1i;
+		PFNGLPROGRAMUNIFORM1IVPROC                           ProgramUniform1iv;
+		PFNGLPROGRAMUNIFORM1UIPROC                           ProgramUniform1ui;
+		PFNGLPROGRAMUNIFORM1UIVPROC                          ProgramUniform1uiv;
+		PFNGLPROGRAMUNIFORM2DPROC                            ProgramUniform2d;
+		PFNGLPROGRAMUNIFORM2DVPROC                           ProgramUniform2dv;
+		PFNGLPROGRAMUNIFORM2FPROC                            ProgramUniform2f;
+		PFNGLPROGRAMUNIFORM2FVPROC                           ProgramUniform2fv;
+		PFNGLPROGRAMUNIFORM2IPROC                            ProgramUniform2i;
+		PFNGLPROGRAMUNIFORM2IVPROC                           ProgramUniform2iv;
+		PFNGLPROGRAMUNIFORM2UIPROC                           ProgramUniform2ui;
+		PFNGLPROGRAMUNIFORM2UIVPROC                          ProgramUniform2uiv;
+		PFNGLPROGRAMUNIFORM3DPROC                            ProgramUniform3d;
+		PFNGLPROGRAMUNIFORM3DVPROC                           ProgramUniform3dv;
+		PFNGLPROGRAMUNIFORM3FPROC                            ProgramUniform3f;
+		PFNGLPROGRAMUNIFORM3FVPROC                           ProgramUniform3fv;
+		PFNGLPROGRAMUNIFORM3IPROC                            ProgramUniform3i;
+		PFNGLPROGRAMUNIFORM3IVPROC                           ProgramUniform3iv;
+		PFNGLPROGRAMUNIFORM3UIPROC                           ProgramUniform3ui;
+		PFNGLPROGRAMUNIFORM3UIVPROC                          ProgramUniform3uiv;
+		PFNGLPROGRAMUNIFORM4DPROC                            ProgramUniform4d;
+		PFNGLPROGRAMUNIFORM4DVPROC                           ProgramUniform4dv;
+		PFNGLPROGRAMUNIFORM4FPROC                            ProgramUniform4f;
+		PFNGLPROGRAMUNIFORM4FVPROC                           ProgramUniform4fv;
+		PFNGLPROGRAMUNIFORM4IPROC                            ProgramUniform4i;
+		PFNGLPROGRAMUNIFORM4IVPROC                           ProgramUniform4iv;
+		PFNGLPROGRAMUNIFORM4UIPROC                           ProgramUniform4ui;
+		PFNGLPROGRAMUNIFORM4UIVPROC                          ProgramUniform4uiv;
+		PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC                 ProgramUniformHandleui64ARB;
+		PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC                ProgramUniformHandleui64vARB;
+		PFNGLPROGRAMUNIFORMMATRIX2DVPROC                     ProgramUniformMatrix2dv;
+		PFNGLPROGRAMUNIFORMMATRIX2FVPROC                     ProgramUniformMatrix2fv;
+		PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC                   ProgramUniformMatrix2x3dv;
+		PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC                   ProgramUniformMatrix2x3fv;
+		PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC                   ProgramUniformMatrix2x4dv;
+		PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC                   ProgramUniformMatrix2x4fv;
+		PFNGLPROGRAMUNIFORMMATRIX3DVPROC                     ProgramUniformMatrix3dv;
+		PFNGLPROGRAMUNIFORMMATRIX3FVPROC                     ProgramUniformMatrix3fv;
+		PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC                   ProgramUniformMatrix3x2dv;
+		PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC                   ProgramUniformMatrix3x2fv;
+		PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC                   ProgramUniformMatrix3x4dv;
+		PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC                   ProgramUniformMatrix3x4fv;
+		PFNGLPROGRAMUNIFORMMATRIX4DVPROC                     ProgramUniformMatrix4dv;
+		PFNGLPROGRAMUNIFORMMATRIX4FVPROC                     ProgramUniformMatrix4fv;
+		PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC                   ProgramUniformMatrix4x2dv;
+		PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC                   ProgramUniformMatrix4x2fv;
+		PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC                   ProgramUniformMatrix4x3dv;
+		PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC                   ProgramUniformMatrix4x3fv;
+		PFNGLPROVOKINGVERTEXPROC                             ProvokingVertex;
+		PFNGLPUSHDEBUGGROUPPROC                              PushDebugGroup;
+		PFNGLQUERYCOUNTERPROC                                QueryCounter;
+		PFNGLREADBUFFERPROC                                  ReadBuffer;
+		PFNGLREADPIXELSPROC                                  ReadPixels;
+		PFNGLREADNPIXELSPROC                                 ReadnPixels;
+		PFNGLREADNPIXELSARBPROC                              ReadnPixelsARB;
+		PFNGLRELEASESHADERCOMPILERPROC                       ReleaseShaderCompiler;
+		PFNGLRENDERBUFFERSTORAGEPROC                         RenderbufferStorage;
+		PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC              RenderbufferStorageMultisample;
+		PFNGLRESUMETRANSFORMFEEDBACKPROC                     ResumeTransformFeedback;
+		PFNGLSAMPLECOVERAGEPROC                              SampleCoverage;
+		PFNGLSAMPLEMASKIPROC                                 SampleMaski;
+		PFNGLSAMPLERPARAMETERIIVPROC                         SamplerParameterIiv;
+		PFNGLSAMPLERPARAMETERIUIVPROC                        SamplerParameterIuiv;
+		PFNGLSAMPLERPARAMETERFPROC                           SamplerParameterf;
+		PFNGLSAMPLERPARAMETERFVPROC                          SamplerParameterfv;
+		PFNGLSAMPLERPARAMETERIPROC                           SamplerParameteri;
+		PFNGLSAMPLERPARAMETERIVPROC                          SamplerParameteriv;
+		PFNGLSCISSORPROC                                     Scissor;
+		PFNGLSCISSORARRAYVPROC                               ScissorArrayv;
+		PFNGLSCISSORINDEXEDPROC                              ScissorIndexed;
+		PFNGLSCISSORINDEXEDVPROC                             ScissorIndexedv;
+		PFNGLSHADERBINARYPROC                                ShaderBinary;
+		PFNGLSHADERSOURCEPROC                                ShaderSource;
+		PFNGLSHADERSTORAGEBLOCKBINDINGPROC                   ShaderStorageBlockBinding;
+		PFNGLSTENCILFUNCPROC                                 StencilFunc;
+		PFNGLSTENCILFUNCSEPARATEPROC                         StencilFuncSeparate;
+		PFNGLSTENCILMASKPROC                                 StencilMask;
+		PFNGLSTENCILMASKSEPARATEPROC                         StencilMaskSeparate;
+		PFNGLSTENCILOPPROC                                   StencilOp;
+		PFNGLSTENCILOPSEPARATEPROC                           StencilOpSeparate;
+		PFNGLTEXBUFFERPROC                                   TexBuffer;
+		PFNGLTEXBUFFERRANGEPROC                              TexBufferRange;
+		PFNGLTEXIMAGE1DPROC                                  TexImage1D;
+		PFNGLTEXIMAGE2DPROC                                  TexImage2D;
+		PFNGLTEXIMAGE2DMULTISAMPLEPROC                       TexImage2DMultisample;
+		PFNGLTEXIMAGE3DPROC                                  TexImage3D;
+		PFNGLTEXIMAGE3DMULTISAMPLEPROC                       TexImage3DMultisample;
+		PFNGLTEXPAGECOMMITMENTARBPROC                        TexPageCommitmentARB;
+		PFNGLTEXPARAMETERIIVPROC                             TexParameterIiv;
+		PFNGLTEXPARAMETERIUIVPROC                            TexParameterIuiv;
+		PFNGLTEXPARAMETERFPROC                               TexParameterf;
+		PFNGLTEXPARAMETERFVPROC                              TexParameterfv;
+		PFNGLTEXPARAMETERIPROC                               TexParameteri;
+		PFNGLTEXPARAMETERIVPROC                              TexParameteriv;
+		PFNGLTEXSTORAGE1DPROC                                TexStorage1D;
+		PFNGLTEXSTORAGE2DPROC                                TexStorage2D;
+		PFNGLTEXSTORAGE2DMULTISAMPLEPROC                     TexStorage2DMultisample;
+		PFNGLTEXSTORAGE3DPROC                                TexStorage3D;
+		PFNGLTEXSTORAGE3DMULTISAMPLEPROC                     TexStorage3DMultisample;
+		PFNGLTEXSUBIMAGE1DPROC                               TexSubImage1D;
+		PFNGLTEXSUBIMAGE2DPROC                               TexSubImage2D;
+		PFNGLTEXSUBIMAGE3DPROC                               TexSubImage3D;
+		PFNGLTEXTUREBARRIERPROC                              TextureBarrier;
+		PFNGLTEXTUREBUFFERPROC                               TextureBuffer;
+		PFNGLTEXTUREBUFFERRANGEPROC                          TextureBufferRange;
+		PFNGLTEXTUREPARAMETERIIVPROC                         TextureParameterIiv;
+		PFNGLTEXTUREPARAMETERIUIVPROC                        TextureParameterIuiv;
+		PFNGLTEXTUREPARAMETERFPROC                           TextureParameterf;
+		PFNGLTEXTUREPARAMETERFVPROC                          TextureParameterfv;
+		PFNGLTEXTUREPARAMETERIPROC                           TextureParameteri;
+		PFNGLTEXTUREPARAMETERIVPROC                          TextureParameteriv;
+		PFNGLTEXTURESTORAGE1DPROC                            TextureStorage1D;
+		PFNGLTEXTURESTORAGE2DPROC                            TextureStorage2D;
+		PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC                 TextureStorage2DMultisample;
+		PFNGLTEXTURESTORAGE3DPROC                            TextureStorage3D;
+		PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC                 TextureStorage3DMultisample;
+		PFNGLTEXTURESUBIMAGE1DPROC                           TextureSubImage1D;
+		PFNGLTEXTURESUBIMAGE2DPROC                           TextureSubImage2D;
+		PFNGLTEXTURESUBIMAGE3DPROC                           TextureSubImage3D;
+		PFNGLTEXTUREVIEWPROC                                 TextureView;
+		PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC                 TransformFeedbackBufferBase;
+		PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC                TransformFeedbackBufferRange;
+		PFNGLTRANSFORMFEEDBACKVARYINGSPROC                   TransformFeedbackVaryings;
+		PFNGLUNIFORM1DPROC                                   Uniform1d;
+		PFNGLUNIFORM1DVPROC                                  Uniform1dv;
+		PFNGLUNIFORM1FPROC                                   Uniform1f;
+		PFNGLUNIFORM1FVPROC                                  Uniform1fv;
+		PFNGLUNIFORM1IPROC                                   Uniform1i;
+		PFNGLUNIFORM1IVPROC                                  Uniform1iv;
+		PFNGLUNIFORM1UIPROC                                  Uniform1ui;
+		PFNGLUNIFORM1UIVPROC                                 Uniform1uiv;
+		PFNGLUNIFORM2DPROC                                   Uniform2d;
+		PFNGLUNIFORM2DVPROC                                  Uniform2dv;
+		PFNGLUNIFORM2FPROC                                   Uniform2f;
+		PFNGLUNIFORM2FVPROC                                  Uniform2fv;
+		PFNGLUNIFORM2IPROC                                   Uniform2i;
+		PFNGLUNIFORM2IVPROC                                  Uniform2iv;
+		PFNGLUNIFORM2UIPROC                                  Uniform2ui;
+		PFNGLUNIFORM2UIVPROC                                 Uniform2uiv;
+		PFNGLUNIFORM3DPROC                                   Uniform3d;
+		PFNGLUNIFORM3DVPROC                                  Uniform3dv;
+		PFNGLUNIFORM3FPROC                                   Uniform3f;
+		PFNGLUNIFORM3FVPROC                                  Uniform3fv;
+		PFNGLUNIFORM3IPROC                                   Uniform3i;
+		PFNGLUNIFORM3IVPROC                                  Uniform3iv;
+		PFNGLUNIFORM3UIPROC                                  Uniform3ui;
+		PFNGLUNIFORM3UIVPROC                                 Uniform3uiv;
+		PFNGLUNIFORM4DPROC                                   Uniform4d;
+		PFNGLUNIFORM4DVPROC                                  Uniform4dv;
+		PFNGLUNIFORM4FPROC                                   Uniform4f;
+		PFNGLUNIFORM4FVPROC                                  Uniform4fv;
+		PFNGLUNIFORM4IPROC                                   Uniform4i;
+		PFNGLUNIFORM4IVPROC                                  Uniform4iv;
+		PFNGLUNIFORM4UIPROC                                  Uniform4ui;
+		PFNGLUNIFORM4UIVPROC                                 Uniform4uiv;
+		PFNGLUNIFORMBLOCKBINDINGPROC                         UniformBlockBinding;
+		PFNGLUNIFORMHANDLEUI64ARBPROC                        UniformHandleui64ARB;
+		PFNGLUNIFORMHANDLEUI64VARBPROC                       UniformHandleui64vARB;
+		PFNGLUNIFORMMATRIX2DVPROC                            UniformMatrix2dv;
+		PFNGLUNIFORMMATRIX2FVPROC                            UniformMatrix2fv;
+		PFNGLUNIFORMMATRIX2X3DVPROC                          UniformMatrix2x3dv;
+		PFNGLUNIFORMMATRIX2X3FVPROC                          UniformMatrix2x3fv;
+		PFNGLUNIFORMMATRIX2X4DVPROC                          UniformMatrix2x4dv;
+		PFNGLUNIFORMMATRIX2X4FVPROC                          UniformMatrix2x4fv;
+		PFNGLUNIFORMMATRIX3DVPROC                            UniformMatrix3dv;
+		PFNGLUNIFORMMATRIX3FVPROC                            UniformMatrix3fv;
+		PFNGLUNIFORMMATRIX3X2DVPROC                          UniformMatrix3x2dv;
+		PFNGLUNIFORMMATRIX3X2FVPROC                          UniformMatrix3x2fv;
+		PFNGLUNIFORMMATRIX3X4DVPROC                          UniformMatrix3x4dv;
+		PFNGLUNIFORMMATRIX3X4FVPROC                          UniformMatrix3x4fv;
+		PFNGLUNIFORMMATRIX4DVPROC                            UniformMatrix4dv;
+		PFNGLUNIFORMMATRIX4FVPROC                            UniformMatrix4fv;
+		PFNGLUNIFORMMATRIX4X2DVPROC                          UniformMatrix4x2dv;
+		PFNGLUNIFORMMATRIX4X2FVPROC                          UniformMatrix4x2fv;
+		PFNGLUNIFORMMATRIX4X3DVPROC                          UniformMatrix4x3dv;
+		PFNGLUNIFORMMATRIX4X3FVPROC                          UniformMatrix4x3fv;
+		PFNGLUNIFORMSUBROUTINESUIVPROC                       UniformSubroutinesuiv;
+		PFNGLUNMAPBUFFERPROC                                 UnmapBuffer;
+		PFNGLUNMAPNAMEDBUFFERPROC                            UnmapNamedBuffer;
+		PFNGLUSEPROGRAMPROC                                  UseProgram;
+		PFNGLUSEPROGRAMSTAGESPROC                            UseProgramStages;
+		PFNGLVALIDATEPROGRAMPROC                             ValidateProgram;
+		PFNGLVALIDATEPROGRAMPIPELINEPROC                     ValidateProgramPipeline;
+		PFNGLVERTEXARRAYATTRIBBINDINGPROC                    VertexArrayAttribBinding;
+		PFNGLVERTEXARRAYATTRIBFORMATPROC                     VertexArrayAttribFormat;
+		PFNGLVERTEXARRAYATTRIBIFORMATPROC                    VertexArrayAttribIFormat;
+		PFNGLVERTEXARRAYATTRIBLFORMATPROC                    VertexArrayAttribLFormat;
+		PFNGLVERTEXARRAYBINDINGDIVISORPROC                   VertexArrayBindingDivisor;
+		PFNGLVERTEXARRAYELEMENTBUFFERPROC                    VertexArrayElementBuffer;
+		PFNGLVERTEXARRAYVERTEXBUFFERPROC                     VertexArrayVertexBuffer;
+		PFNGLVERTEXARRAYVERTEXBUFFERSPROC                    VertexArrayVertexBuffers;
+		PFNGLVERTEXATTRIB1DPROC                              VertexAttrib1d;
+		PFNGLVERTEXATTRIB1DVPROC                             VertexAttrib1dv;
+		PFNGLVERTEXATTRIB1FPROC                              VertexAttrib1f;
+		PFNGLVERTEXATTRIB1FVPROC                             VertexAttrib1fv;
+		PFNGLVERTEXATTRIB1SPROC                              VertexAttrib1s;
+		PFNGLVERTEXATTRIB1SVPROC                             VertexAttrib1sv;
+		PFNGLVERTEXATTRIB2DPROC                              VertexAttrib2d;
+		PFNGLVERTEXATTRIB2DVPROC                             VertexAttrib2dv;
+		PFNGLVERTEXATTRIB2FPROC                              VertexAttrib2f;
+		PFNGLVERTEXATTRIB2FVPROC                             VertexAttrib2fv;
+		PFNGLVERTEXATTRIB2SPROC                              VertexAttrib2s;
+		PFNGLVERTEXATTRIB2SVPROC                             VertexAttrib2sv;
+		PFNGLVERTEXATTRIB3DPROC                              VertexAttrib3d;
+		PFNGLVERTEXATTRIB3DVPROC                             VertexAttrib3dv;
+		PFNGLVERTEXATTRIB3FPROC                              VertexAttrib3f;
+		PFNGLVERTEXATTRIB3FVPROC                             VertexAttrib3fv;
+		PFNGLVERTEXATTRIB3SPROC                              VertexAttrib3s;
+		PFNGLVERTEXATTRIB3SVPROC                             VertexAttrib3sv;
+		PFNGLVERTEXATTRIB4NBVPROC                            VertexAttrib4Nbv;
+		PFNGLVERTEXATTRIB4NIVPROC                            VertexAttrib4Niv;
+		PFNGLVERTEXATTRIB4NSVPROC                            VertexAttrib4Nsv;
+		PFNGLVERTEXATTRIB4NUBPROC                            VertexAttrib4Nub;
+		PFNGLVERTEXATTRIB4NUBVPROC                           VertexAttrib4Nubv;
+		PFNGLVERTEXATTRIB4NUIVPROC                           VertexAttrib4Nuiv;
+		PFNGLVERTEXATTRIB4NUSVPROC                           VertexAttrib4Nusv;
+		PFNGLVERTEXATTRIB4BVPROC                             VertexAttrib4bv;
+		PFNGLVERTEXATTRIB4DPROC                              VertexAttrib4d;
+		PFNGLVERTEXATTRIB4DVPROC                             VertexAttrib4dv;
+		PFNGLVERTEXATTRIB4FPROC                              VertexAttrib4f;
+		PFNGLVERTEXATTRIB4FVPROC                             VertexAttrib4fv;
+		PFNGLVERTEXATTRIB4IVPROC                             VertexAttrib4iv;
+		PFNGLVERTEXATTRIB4SPROC                              VertexAttrib4s;
+		PFNGLVERTEXATTRIB4SVPROC                             VertexAttrib4sv;
+		PFNGLVERTEXATTRIB4UBVPROC                            VertexAttrib4ubv;
+		PFNGLVERTEXATTRIB4UIVPROC                            VertexAttrib4uiv;
+		PFNGLVERTEXATTRIB4USVPROC                            VertexAttrib4usv;
+		PFNGLVERTEXATTRIBBINDINGPROC                         VertexAttribBinding;
+		PFNGLVERTEXATTRIBDIVISORPROC                         VertexAttribDivisor;
+		PFNGLVERTEXATTRIBFORMATPROC                          VertexAttribFormat;
+		PFNGLVERTEXATTRIBI1IPROC                             VertexAttribI1i;
+		PFNGLVERTEXATTRIBI1IVPROC                            VertexAttribI1iv;
+		PFNGLVERTEXATTRIBI1UIPROC                            VertexAttribI1ui;
+		PFNGLVERTEXATTRIBI1UIVPROC                           VertexAttribI1uiv;
+		PFNGLVERTEXATTRIBI2IPROC                             VertexAttribI2i;
+		PFNGLVERTEXATTRIBI2IVPROC                            VertexAttribI2iv;
+		PFNGLVERTEXATTRIBI2UIPROC                            VertexAttribI2ui;
+		PFNGLVERTEXATTRIBI2UIVPROC                           VertexAttribI2uiv;
+		PFNGLVERTEXATTRIBI3IPROC                             VertexAttribI3i;
+		PFNGLVERTEXATTRIBI3IVPROC                            VertexAttribI3iv;
+		PFNGLVERTEXATTRIBI3UIPROC                            VertexAttribI3ui;
+		PFNGLVERTEXATTRIBI3UIVPROC                           VertexAttribI3uiv;
+		PFNGLVERTEXATTRIBI4BVPROC                            VertexAttribI4bv;
+		PFNGLVERTEXATTRIBI4IPROC                             VertexAttribI4i;
+		PFNGLVERTEXATTRIBI4IVPROC                            VertexAttribI4iv;
+		PFNGLVERTEXATTRIBI4SVPROC                            VertexAttribI4sv;
+		PFNGLVERTEXATTRIBI4UBVPROC                           VertexAttribI4ubv;
+		PFNGLVERTEXATTRIBI4UIPROC                            VertexAttribI4ui;
+		PFNGLVERTEXATTRIBI4UIVPROC                           VertexAttribI4uiv;
+		PFNGLVERTEXATTRIBI4USVPROC                           VertexAttribI4usv;
+		PFNGLVERTEXATTRIBIFORMATPROC                         VertexAttribIFormat;
+		PFNGLVERTEXATTRIBIPOINTERPROC                        VertexAttribIPointer;
+		PFNGLVERTEXATTRIBL1DPROC                             VertexAttribL1d;
+		PFNGLVERTEXATTRIBL1DVPROC                            VertexAttribL1dv;
+		PFNGLVERTEXATTRIBL1UI64ARBPROC                       VertexAttribL1ui64ARB;
+		PFNGLVERTEXATTRIBL1UI64VARBPROC                      VertexAttribL1ui64vARB;
+		PFNGLVERTEXATTRIBL2DPROC                             VertexAttribL2d;
+		PFNGLVERTEXATTRIBL2DVPROC                            VertexAttribL2dv;
+		PFNGLVERTEXATTRIBL3DPROC                             VertexAttribL3d;
+		PFNGLVERTEXATTRIBL3DVPROC                            VertexAttribL3dv;
+		PFNGLVERTEXATTRIBL4DPROC                             VertexAttribL4d;
+		PFNGLVERTEXATTRIBL4DVPROC                            VertexAttribL4dv;
+		PFNGLVERTEXATTRIBLFORMATPROC                         VertexAttribLFormat;
+		PFNGLVERTEXATTRIBLPOINTERPROC                        VertexAttribLPointer;
+		PFNGLVERTEXATTRIBP1UIPROC                            VertexAttribP1ui;
+		PFNGLVERTEXATTRIBP1UIVPROC                           VertexAttribP1uiv;
+		PFNGLVERTEXATTRIBP2UIPROC                            VertexAttribP2ui;
+		PFNGLVERTEXATTRIBP2UIVPROC                           VertexAttribP2uiv;
+		PFNGLVERTEXATTRIBP3UIPROC                            VertexAttribP3ui;
+		PFNGLVERTEXATTRIBP3UIVPROC                           VertexAttribP3uiv;
+		PFNGLVERTEXATTRIBP4UIPROC                            VertexAttribP4ui;
+		PFNGLVERTEXATTRIBP4UIVPROC                           VertexAttribP4uiv;
+		PFNGLVERTEXATTRIBPOINTERPROC                         VertexAttribPointer;
+		PFNGLVERTEXBINDINGDIVISORPROC                        VertexBindingDivisor;
+		PFNGLVIEWPORTPROC                                    Viewport;
+		PFNGLVIEWPORTARRAYVPROC                              ViewportArrayv;
+		PFNGLVIEWPORTINDEXEDFPROC                            ViewportIndexedf;
+		PFNGLVIEWPORTINDEXEDFVPROC                           ViewportIndexedfv;
+		PFNGLWAITSYNCPROC                                    WaitSync;
+	} gl;
+};
+
+extern union GL3WProcs gl3wProcs;
 
-#define glActiveShaderProgram                         gl3wActiveShaderProgram
-#define glActiveTexture                               gl3wActiveTexture
-#define glAttachShader                                gl3wAttachShader
-#define glBeginConditionalRender                      gl3wBeginConditionalRender
-#define glBeginQuery                                  gl3wBeginQuery
-#define glBeginQueryIndexed                           gl3wBeginQueryIndexed
-#define glBeginTransformFeedback                      gl3wBeginTransformFeedback
-#define glBindAttribLocation                          gl3wBindAttribLocation
-#define glBindBuffer                                  gl3wBindBuffer
-#define glBindBufferBase                              gl3wBindBufferBase
-#define glBindBufferRange                             gl3wBindBufferRange
-#define glBindBuffersBase                             gl3wBindBuffersBase
-#define glBindBuffersRange                            gl3wBindBuffersRange
-#define glBindFragDataLocation                        gl3wBindFragDataLocation
-#define glBindFragDataLocationIndexed                 gl3wBindFragDataLocationIndexed
-#define glBindFramebuffer                             gl3wBindFramebuffer
-#define glBindImageTexture                            gl3wBindImageTexture
-#define glBindImageTextures                           gl3wBindImageTextures
-#define glBindProgramPipeline                         gl3wBindProgramPipeline
-#define glBindRenderbuffer                            gl3wBindRenderbuffer
-#define glBindSampler                                 gl3wBindSampler
-#define glBindSamplers                                gl3wBindSamplers
-#define glBindTexture                                 gl3wBindTexture
-#define glBindTextureUnit                             gl3wBindTextureUnit
-#define glBindTextures                                gl3wBindTextures
-#define glBindTransformFeedback                       gl3wBindTransformFeedback
-#define glBindVertexArray                             gl3wBindVertexArray
-#define glBindVertexBuffer                            gl3wBindVertexBuffer
-#define glBindVertexBuffers                           gl3wBindVertexBuffers
-#define glBlendColor                                  gl3wBlendColor
-#define glBlendEquation                               gl3wBlendEquation
-#define glBlendEquationSeparate                       gl3wBlendEquationSeparate
-#define glBlendEquationSeparatei                      gl3wBlendEquationSeparatei
-#define glBlendEquationSeparateiARB                   gl3wBlendEquationSeparateiARB
-#define glBlendEquationi                              gl3wBlendEquationi
-#define glBlendEquationiARB                           gl3wBlendEquationiARB
-#define glBlendFunc                                   gl3wBlendFunc
-#define glBlendFuncSeparate                           gl3wBlendFuncSeparate
-#define glBlendFuncSeparatei                          gl3wBlendFuncSeparatei
-#define glBlendFuncSeparateiARB                       gl3wBlendFuncSeparateiARB
-#define glBlendFunci                                  gl3wBlendFunci
-#define glBlendFunciARB                               gl3wBlendFunciARB
-#define glBlitFramebuffer                             gl3wBlitFramebuffer
-#define glBlitNamedFramebuffer                        gl3wBlitNamedFramebuffer
-#define glBufferData                                  gl3wBufferData
-#define glBufferPageCommitmentARB                     gl3wBufferPageCommitmentARB
-#define glBufferStorage                               gl3wBufferStorage
-#define glBufferSubData                               gl3wBufferSubData
-#define glCheckFramebufferStatus                      gl3wCheckFramebufferStatus
-#define glCheckNamedFramebufferStatus                 gl3wCheckNamedFramebufferStatus
-#define glClampColor                                  gl3wClampColor
-#define glClear                                       gl3wClear
-#define glClearBufferData                             gl3wClearBufferData
-#define glClearBufferSubData                          gl3wClearBufferSubData
-#define glClearBufferfi                               gl3wClearBufferfi
-#define glClearBufferfv                               gl3wClearBufferfv
-#define glClearBufferiv                               gl3wClearBufferiv
-#define glClearBufferuiv                              gl3wClearBufferuiv
-#define glClearColor                                  gl3wClearColor
-#define glClearDepth                                  gl3wClearDepth
-#define glClearDepthf                                 gl3wClearDepthf
-#define glClearNamedBufferData                        gl3wClearNamedBufferData
-#define glClearNamedBufferSubData                     gl3wClearNamedBufferSubData
-#define glClearNamedFramebufferfi                     gl3wClearNamedFramebufferfi
-#define glClearNamedFramebufferfv                     gl3wClearNamedFramebufferfv
-#define glClearNamedFramebufferiv                     gl3wClearNamedFramebufferiv
-#define glClearNamedFramebufferuiv                    gl3wClearNamedFramebufferuiv
-#define glClearStencil                                gl3wClearStencil
-#define glClearTexImage                               gl3wClearTexImage
-#define glClearTexSubImage                            gl3wClearTexSubImage
-#define glClientWaitSync                              gl3wClientWaitSync
-#define glClipControl                                 gl3wClipControl
-#define glColorMask                                   gl3wColorMask
-#define glColorMaski                                  gl3wColorMaski
-#define glCompileShader                               gl3wCompileShader
-#define glCompileShaderIncludeARB                     gl3wCompileShaderIncludeARB
-#define glCompressedTexImage1D                        gl3wCompressedTexImage1D
-#define glCompressedTexImage2D                        gl3wCompressedTexImage2D
-#define glCompressedTexImage3D                        gl3wCompressedTexImage3D
-#define glCompressedTexSubImage1D                     gl3wCompressedTexSubImage1D
-#define glCompressedTexSubImage2D                     gl3wCompressedTexSubImage2D
-#define glCompressedTexSubImage3D                     gl3wCompressedTexSubImage3D
-#define glCompressedTextureSubImage1D                 gl3wCompressedTextureSubImage1D
-#define glCompressedTextureSubImage2D                 gl3wCompressedTextureSubImage2D
-#define glCompressedTextureSubImage3D                 gl3wCompressedTextureSubImage3D
-#define glCopyBufferSubData                           gl3wCopyBufferSubData
-#define glCopyImageSubData                            gl3wCopyImageSubData
-#define glCopyNamedBufferSubData                      gl3wCopyNamedBufferSubData
-#define glCopyTexImage1D                              gl3wCopyTexImage1D
-#define glCopyTexImage2D                              gl3wCopyTexImage2D
-#define glCopyTexSubImage1D                           gl3wCopyTexSubImage1D
-#define glCopyTexSubImage2D                           gl3wCopyTexSubImage2D
-#define glCopyTexSubImage3D                           gl3wCopyTexSubImage3D
-#define glCopyTextureSubImage1D                       gl3wCopyTextureSubImage1D
-#define glCopyTextureSubImage2D                       gl3wCopyTextureSubImage2D
-#define glCopyTextureSubImage3D                       gl3wCopyTextureSubImage3D
-#define glCreateBuffers                               gl3wCreateBuffers
-#define glCreateFramebuffers                          gl3wCreateFramebuffers
-#define glCreateProgram                               gl3wCreateProgram
-#define glCreateProgramPipelines                      gl3wCreateProgramPipelines
-#define glCreateQueries                               gl3wCreateQueries
-#define glCreateRenderbuffers                         gl3wCreateRenderbuffers
-#define glCreateSamplers                              gl3wCreateSamplers
-#define glCreateShader                                gl3wCreateShader
-#define glCreateShaderProgramv                        gl3wCreateShaderProgramv
-#define glCreateSyncFromCLeventARB                    gl3wCreateSyncFromCLeventARB
-#define glCreateTextures                              gl3wCreateTextures
-#define glCreateTransformFeedbacks                    gl3wCreateTransformFeedbacks
-#define glCreateVertexArrays                          gl3wCreateVertexArrays
-#define glCullFace                                    gl3wCullFace
-#define glDebugMessageCallback                        gl3wDebugMessageCallback
-#define glDebugMessageCallbackARB                     gl3wDebugMessageCallbackARB
-#define glDebugMessageControl                         gl3wDebugMessageControl
-#define glDebugMessageControlARB                      gl3wDebugMessageControlARB
-#define glDebugMessageInsert                          gl3wDebugMessageInsert
-#define glDebugMessageInsertARB                       gl3wDebugMessageInsertARB
-#define glDeleteBuffers                               gl3wDeleteBuffers
-#define glDeleteFramebuffers                          gl3wDeleteFramebuffers
-#define glDeleteNamedStringARB                        gl3wDeleteNamedStringARB
-#define glDeleteProgram                               gl3wDeleteProgram
-#define glDeleteProgramPipelines                      gl3wDeleteProgramPipelines
-#define glDeleteQueries                               gl3wDeleteQueries
-#define glDeleteRenderbuffers                         gl3wDeleteRenderbuffers
-#define glDeleteSamplers                              gl3wDeleteSamplers
-#define glDeleteShader                                gl3wDeleteShader
-#define glDeleteSync                                  gl3wDeleteSync
-#define glDeleteTextures                              gl3wDeleteTextures
-#define glDeleteTransformFeedbacks                    gl3wDeleteTransformFeedbacks
-#define glDeleteVertexArrays                          gl3wDeleteVertexArrays
-#define glDepthFunc                                   gl3wDepthFunc
-#define glDepthMask                                   gl3wDepthMask
-#define glDepthRange                                  gl3wDepthRange
-#define glDepthRangeArrayv                            gl3wDepthRangeArrayv
-#define glDepthRangeIndexed                           gl3wDepthRangeIndexed
-#define glDepthRangef                                 gl3wDepthRangef
-#define glDetachShader                                gl3wDetachShader
-#define glDisable                                     gl3wDisable
-#define glDisableVertexArrayAttrib                    gl3wDisableVertexArrayAttrib
-#define glDisableVertexAttribArray                    gl3wDisableVertexAttribArray
-#define glDisablei                                    gl3wDisablei
-#define glDispatchCompute                             gl3wDispatchCompute
-#define glDispatchComputeGroupSizeARB                 gl3wDispatchComputeGroupSizeARB
-#define glDispatchComputeIndirect                     gl3wDispatchComputeIndirect
-#define glDrawArrays                                  gl3wDrawArrays
-#define glDrawArraysIndirect                          gl3wDrawArraysIndirect
-#define glDrawArraysInstanced                         gl3wDrawArraysInstanced
-#define glDrawArraysInstancedBaseInstance             gl3wDrawArraysInstancedBaseInstance
-#define glDrawBuffer                                  gl3wDrawBuffer
-#define glDrawBuffers                                 gl3wDrawBuffers
-#define glDrawElements                                gl3wDrawElements
-#define glDrawElementsBaseVertex                      gl3wDrawElementsBaseVertex
-#define glDrawElementsIndirect                        gl3wDrawElementsIndirect
-#define glDrawElementsInstanced                       gl3wDrawElementsInstanced
-#define glDrawElementsInstancedBaseInstance           gl3wDrawElementsInstancedBaseInstance
-#define glDrawElementsInstancedBaseVertex             gl3wDrawElementsInstancedBaseVertex
-#define glDrawElementsInstancedBaseVertexBaseInstance gl3wDrawElementsInstancedBaseVertexBaseInstance
-#define glDrawRangeElements                           gl3wDrawRangeElements
-#define glDrawRangeElementsBaseVertex                 gl3wDrawRangeElementsBaseVertex
-#define glDrawTransformFeedback                       gl3wDrawTransformFeedback
-#define glDrawTransformFeedbackInstanced              gl3wDrawTransformFeedbackInstanced
-#define glDrawTransformFeedbackStream                 gl3wDrawTransformFeedbackStream
-#define glDrawTransformFeedbackStreamInstanced        gl3wDrawTransformFeedbackStreamInstanced
-#define glEnable                                      gl3wEnable
-#define glEnableVertexArrayAttrib                     gl3wEnableVertexArrayAttrib
-#define glEnableVertexAttribArray                     gl3wEnableVertexAttribArray
-#define glEnablei                                     gl3wEnablei
-#define glEndConditionalRender                        gl3wEndConditionalRender
-#define glEndQuery                                    gl3wEndQuery
-#define glEndQueryIndexed                             gl3wEndQueryIndexed
-#define glEndTransformFeedback                        gl3wEndTransformFeedback
-#define glFenceSync                                   gl3wFenceSync
-#define glFinish                                      gl3wFinish
-#define glFlush                                       gl3wFlush
-#define glFlushMappedBufferRange                      gl3wFlushMappedBufferRange
-#define glFlushMappedNamedBufferRange                 gl3wFlushMappedNamedBufferRange
-#define glFramebufferParameteri                       gl3wFramebufferParameteri
-#define glFramebufferRenderbuffer                     gl3wFramebufferRenderbuffer
-#define glFramebufferTexture                          gl3wFramebufferTexture
-#define glFramebufferTexture1D                        gl3wFramebufferTexture1D
-#define glFramebufferTexture2D                        gl3wFramebufferTexture2D
-#define glFramebufferTexture3D                        gl3wFramebufferTexture3D
-#define glFramebufferTextureLayer                     gl3wFramebufferTextureLayer
-#define glFrontFace                                   gl3wFrontFace
-#define glGenBuffers                                  gl3wGenBuffers
-#define glGenFramebuffers                             gl3wGenFramebuffers
-#define glGenProgramPipelines                         gl3wGenProgramPipelines
-#define glGenQueries                                  gl3wGenQueries
-#define glGenRenderbuffers                            gl3wGenRenderbuffers
-#define glGenSamplers                                 gl3wGenSamplers
-#define glGenTextures                                 gl3wGenTextures
-#define glGenTransformFeedbacks                       gl3wGenTransformFeedbacks
-#define glGenVertexArrays                             gl3wGenVertexArrays
-#define glGenerateMipmap                              gl3wGenerateMipmap
-#define glGenerateTextureMipmap                       gl3wGenerateTextureMipmap
-#define glGetActiveAtomicCounterBufferiv              gl3wGetActiveAtomicCounterBufferiv
-#define glGetActiveAttrib                             gl3wGetActiveAttrib
-#define glGetActiveSubroutineName                     gl3wGetActiveSubroutineName
-#define glGetActiveSubroutineUniformName              gl3wGetActiveSubroutineUniformName
-#define glGetActiveSubroutineUniformiv                gl3wGetActiveSubroutineUniformiv
-#define glGetActiveUniform                            gl3wGetActiveUniform
-#define glGetActiveUniformBlockName                   gl3wGetActiveUniformBlockName
-#define glGetActiveUniformBlockiv                     gl3wGetActiveUniformBlockiv
-#define glGetActiveUniformName                        gl3wGetActiveUniformName
-#define glGetActiveUniformsiv                         gl3wGetActiveUniformsiv
-#define glGetAttachedShaders                          gl3wGetAttachedShaders
-#define glGetAttribLocation                           gl3wGetAttribLocation
-#define glGetBooleani_v                               gl3wGetBooleani_v
-#define glGetBooleanv                                 gl3wGetBooleanv
-#define glGetBufferParameteri64v                      gl3wGetBufferParameteri64v
-#define glGetBufferParameteriv                        gl3wGetBufferParameteriv
-#define glGetBufferPointerv                           gl3wGetBufferPointerv
-#define glGetBufferSubData                            gl3wGetBufferSubData
-#define glGetCompressedTexImage                       gl3wGetCompressedTexImage
-#define glGetCompressedTextureImage                   gl3wGetCompressedTextureImage
-#define glGetCompressedTextureSubImage                gl3wGetCompressedTextureSubImage
-#define glGetDebugMessageLog                          gl3wGetDebugMessageLog
-#define glGetDebugMessageLogARB                       gl3wGetDebugMessageLogARB
-#define glGetDoublei_v                                gl3wGetDoublei_v
-#define glGetDoublev                                  gl3wGetDoublev
-#define glGetError                                    gl3wGetError
-#define glGetFloati_v                                 gl3wGetFloati_v
-#define glGetFloatv                                   gl3wGetFloatv
-#define glGetFragDataIndex                            gl3wGetFragDataIndex
-#define glGetFragDataLocation                         gl3wGetFragDataLocation
-#define glGetFramebufferAttachmentParameteriv         gl3wGetFramebufferAttachmentParameteriv
-#define glGetFramebufferParameteriv                   gl3wGetFramebufferParameteriv
-#define glGetGraphicsResetStatus                      gl3wGetGraphicsResetStatus
-#define glGetGraphicsResetStatusARB                   gl3wGetGraphicsResetStatusARB
-#define glGetImageHandleARB                           gl3wGetImageHandleARB
-#define glGetInteger64i_v                             gl3wGetInteger64i_v
-#define glGetInteger64v                               gl3wGetInteger64v
-#define glGetIntegeri_v                               gl3wGetIntegeri_v
-#define glGetIntegerv                                 gl3wGetIntegerv
-#define glGetInternalformati64v                       gl3wGetInternalformati64v
-#define glGetInternalformativ                         gl3wGetInternalformativ
-#define glGetMultisamplefv                            gl3wGetMultisamplefv
-#define glGetNamedBufferParameteri64v                 gl3wGetNamedBufferParameteri64v
-#define glGetNamedBufferParameteriv                   gl3wGetNamedBufferParameteriv
-#define glGetNamedBufferPointerv                      gl3wGetNamedBufferPointerv
-#define glGetNamedBufferSubData                       gl3wGetNamedBufferSubData
-#define glGetNamedFramebufferAttachmentParameteriv    gl3wGetNamedFramebufferAttachmentParameteriv
-#define glGetNamedFramebufferParameteriv              gl3wGetNamedFramebufferParameteriv
-#define glGetNamedRenderbufferParameteriv             gl3wGetNamedRenderbufferParameteriv
-#define glGetNamedStringARB                           gl3wGetNamedStringARB
-#define glGetNamedStringivARB                         gl3wGetNamedStringivARB
-#define glGetObjectLabel                              gl3wGetObjectLabel
-#define glGetObjectPtrLabel                           gl3wGetObjectPtrLabel
-#define glGetPointerv                                 gl3wGetPointerv
-#define glGetProgramBinary                            gl3wGetProgramBinary
-#define glGetProgramInfoLog                           gl3wGetProgramInfoLog
-#define glGetProgramInterfaceiv                       gl3wGetProgramInterfaceiv
-#define glGetProgramPipelineInfoLog                   gl3wGetProgramPipelineInfoLog
-#define glGetProgramPipelineiv                        gl3wGetProgramPipelineiv
-#define glGetProgramResourceIndex                     gl3wGetProgramResourceIndex
-#define glGetProgramResourceLocation                  gl3wGetProgramResourceLocation
-#define glGetProgramResourceLocationIndex             gl3wGetProgramResourceLocationIndex
-#define glGetProgramResourceName                      gl3wGetProgramResourceName
-#define glGetProgramResourceiv                        gl3wGetProgramResourceiv
-#define glGetProgramStageiv                           gl3wGetProgramStageiv
-#define glGetProgramiv                                gl3wGetProgramiv
-#define glGetQueryBufferObjecti64v                    gl3wGetQueryBufferObjecti64v
-#define glGetQueryBufferObjectiv                      gl3wGetQueryBufferObjectiv
-#define glGetQueryBufferObjectui64v                   gl3wGetQueryBufferObjectui64v
-#define glGetQueryBufferObjectuiv                     gl3wGetQueryBufferObjectuiv
-#define glGetQueryIndexediv                           gl3wGetQueryIndexediv
-#define glGetQueryObjecti64v                          gl3wGetQueryObjecti64v
-#define glGetQueryObjectiv                            gl3wGetQueryObjectiv
-#define glGetQueryObjectui64v                         gl3wGetQueryObjectui64v
-#define glGetQueryObjectuiv                           gl3wGetQueryObjectuiv
-#define glGetQueryiv                                  gl3wGetQueryiv
-#define glGetRenderbufferParameteriv                  gl3wGetRenderbufferParameteriv
-#define glGetSamplerParameterIiv                      gl3wGetSamplerParameterIiv
-#define glGetSamplerParameterIuiv                     gl3wGetSamplerParameterIuiv
-#define glGetSamplerParameterfv                       gl3wGetSamplerParameterfv
-#define glGetSamplerParameteriv                       gl3wGetSamplerParameteriv
-#define glGetShaderInfoLog                            gl3wGetShaderInfoLog
-#define glGetShaderPrecisionFormat                    gl3wGetShaderPrecisionFormat
-#define glGetShaderSource                             gl3wGetShaderSource
-#define glGetShaderiv                                 gl3wGetShaderiv
-#define glGetString                                   gl3wGetString
-#define glGetStringi                                  gl3wGetStringi
-#define glGetSubroutineIndex                          gl3wGetSubroutineIndex
-#define glGetSubroutineUniformLocation                gl3wGetSubroutineUniformLocation
-#define glGetSynciv                                   gl3wGetSynciv
-#define glGetTexImage                                 gl3wGetTexImage
-#define glGetTexLevelParameterfv                      gl3wGetTexLevelParameterfv
-#define glGetTexLevelParameteriv                      gl3wGetTexLevelParameteriv
-#define glGetTexParameterIiv                          gl3wGetTexParameterIiv
-#define glGetTexParameterIuiv                         gl3wGetTexParameterIuiv
-#define glGetTexParameterfv                           gl3wGetTexParameterfv
-#define glGetTexParameteriv                           gl3wGetTexParameteriv
-#define glGetTextureHandleARB                         gl3wGetTextureHandleARB
-#define glGetTextureImage                             gl3wGetTextureImage
-#define glGetTextureLevelParameterfv                  gl3wGetTextureLevelParameterfv
-#define glGetTextureLevelParameteriv                  gl3wGetTextureLevelParameteriv
-#define glGetTextureParameterIiv                      gl3wGetTextureParameterIiv
-#define glGetTextureParameterIuiv                     gl3wGetTextureParameterIuiv
-#define glGetTextureParameterfv                       gl3wGetTextureParameterfv
-#define glGetTextureParameteriv                       gl3wGetTextureParameteriv
-#define glGetTextureSamplerHandleARB                  gl3wGetTextureSamplerHandleARB
-#define glGetTextureSubImage                          gl3wGetTextureSubImage
-#define glGetTransformFeedbackVarying                 gl3wGetTransformFeedbackVarying
-#define glGetTransformFeedbacki64_v                   gl3wGetTransformFeedbacki64_v
-#define glGetTransformFeedbacki_v                     gl3wGetTransformFeedbacki_v
-#define glGetTransformFeedbackiv                      gl3wGetTransformFeedbackiv
-#define glGetUniformBlockIndex                        gl3wGetUniformBlockIndex
-#define glGetUniformIndices                           gl3wGetUniformIndices
-#define glGetUniformLocation                          gl3wGetUniformLocation
-#define glGetUniformSubroutineuiv                     gl3wGetUniformSubroutineuiv
-#define glGetUniformdv                                gl3wGetUniformdv
-#define glGetUniformfv                                gl3wGetUniformfv
-#define glGetUniformiv                                gl3wGetUniformiv
-#define glGetUniformuiv                               gl3wGetUniformuiv
-#define glGetVertexArrayIndexed64iv                   gl3wGetVertexArrayIndexed64iv
-#define glGetVertexArrayIndexediv                     gl3wGetVertexArrayIndexediv
-#define glGetVertexArrayiv                            gl3wGetVertexArrayiv
-#define glGetVertexAttribIiv                          gl3wGetVertexAttribIiv
-#define glGetVertexAttribIuiv                         gl3wGetVertexAttribIuiv
-#define glGetVertexAttribLdv                          gl3wGetVertexAttribLdv
-#define glGetVertexAttribLui64vARB                    gl3wGetVertexAttribLui64vARB
-#define glGetVertexAttribPointerv                     gl3wGetVertexAttribPointerv
-#define glGetVertexAttribdv                           gl3wGetVertexAttribdv
-#define glGetVertexAttribfv                           gl3wGetVertexAttribfv
-#define glGetVertexAttribiv                           gl3wGetVertexAttribiv
-#define glGetnCompressedTexImage                      gl3wGetnCompressedTexImage
-#define glGetnCompressedTexImageARB                   gl3wGetnCompressedTexImageARB
-#define glGetnTexImage                                gl3wGetnTexImage
-#define glGetnTexImageARB                             gl3wGetnTexImageARB
-#define glGetnUniformdv                               gl3wGetnUniformdv
-#define glGetnUniformdvARB                            gl3wGetnUniformdvARB
-#define glGetnUniformfv                               gl3wGetnUniformfv
-#define glGetnUniformfvARB                            gl3wGetnUniformfvARB
-#define glGetnUniformiv                               gl3wGetnUniformiv
-#define glGetnUniformivARB                            gl3wGetnUniformivARB
-#define glGetnUniformuiv                              gl3wGetnUniformuiv
-#define glGetnUniformuivARB                           gl3wGetnUniformuivARB
-#define glHint                                        gl3wHint
-#define glInvalidateBufferData                        gl3wInvalidateBufferData
-#define glInvalidateBufferSubData                     gl3wInvalidateBufferSubData
-#define glInvalidateFramebuffer                       gl3wInvalidateFramebuffer
-#define glInvalidateNamedFramebufferData              gl3wInvalidateNamedFramebufferData
-#define glInvalidateNamedFramebufferSubData           gl3wInvalidateNamedFramebufferSubData
-#define glInvalidateSubFramebuffer                    gl3wInvalidateSubFramebuffer
-#define glInvalidateTexImage                          gl3wInvalidateTexImage
-#define glInvalidateTexSubImage                       gl3wInvalidateTexSubImage
-#define glIsBuffer                                    gl3wIsBuffer
-#define glIsEnabled                                   gl3wIsEnabled
-#define glIsEnabledi                                  gl3wIsEnabledi
-#define glIsFramebuffer                               gl3wIsFramebuffer
-#define glIsImageHandleResidentARB                    gl3wIsImageHandleResidentARB
-#define glIsNamedStringARB                            gl3wIsNamedStringARB
-#define glIsProgram                                   gl3wIsProgram
-#define glIsProgramPipeline                           gl3wIsProgramPipeline
-#define glIsQuery                                     gl3wIsQuery
-#define glIsRenderbuffer                              gl3wIsRenderbuffer
-#define glIsSampler                                   gl3wIsSampler
-#define glIsShader                                    gl3wIsShader
-#define glIsSync                                      gl3wIsSync
-#define glIsTexture                                   gl3wIsTexture
-#define glIsTextureHandleResidentARB                  gl3wIsTextureHandleResidentARB
-#define glIsTransformFeedback                         gl3wIsTransformFeedback
-#define glIsVertexArray                               gl3wIsVertexArray
-#define glLineWidth                                   gl3wLineWidth
-#define glLinkProgram                                 gl3wLinkProgram
-#define glLogicOp                                     gl3wLogicOp
-#define glMakeImageHandleNonResidentARB               gl3wMakeImageHandleNonResidentARB
-#define glMakeImageHandleResidentARB                  gl3wMakeImageHandleResidentARB
-#define glMakeTextureHandleNonResidentARB             gl3wMakeTextureHandleNonResidentARB
-#define glMakeTextureHandleResidentARB                gl3wMakeTextureHandleResidentARB
-#define glMapBuffer                                   gl3wMapBuffer
-#define glMapBufferRange                              gl3wMapBufferRange
-#define glMapNamedBuffer                              gl3wMapNamedBuffer
-#define glMapNamedBufferRange                         gl3wMapNamedBufferRange
-#define glMemoryBarrier                               gl3wMemoryBarrier
-#define glMemoryBarrierByRegion                       gl3wMemoryBarrierByRegion
-#define glMinSampleShading                            gl3wMinSampleShading
-#define glMinSampleShadingARB                         gl3wMinSampleShadingARB
-#define glMultiDrawArrays                             gl3wMultiDrawArrays
-#define glMultiDrawArraysIndirect                     gl3wMultiDrawArraysIndirect
-#define glMultiDrawArraysIndirectCountARB             gl3wMultiDrawArraysIndirectCountARB
-#define glMultiDrawElements                           gl3wMultiDrawElements
-#define glMultiDrawElementsBaseVertex                 gl3wMultiDrawElementsBaseVertex
-#define glMultiDrawElementsIndirect                   gl3wMultiDrawElementsIndirect
-#define glMultiDrawElementsIndirectCountARB           gl3wMultiDrawElementsIndirectCountARB
-#define glNamedBufferData                             gl3wNamedBufferData
-#define glNamedBufferPageCommitmentARB                gl3wNamedBufferPageCommitmentARB
-#define glNamedBufferPageCommitmentEXT                gl3wNamedBufferPageCommitmentEXT
-#define glNamedBufferStorage                          gl3wNamedBufferStorage
-#define glNamedBufferSubData                          gl3wNamedBufferSubData
-#define glNamedFramebufferDrawBuffer                  gl3wNamedFramebufferDrawBuffer
-#define glNamedFramebufferDrawBuffers                 gl3wNamedFramebufferDrawBuffers
-#define glNamedFramebufferParameteri                  gl3wNamedFramebufferParameteri
-#define glNamedFramebufferReadBuffer                  gl3wNamedFramebufferReadBuffer
-#define glNamedFramebufferRenderbuffer                gl3wNamedFramebufferRenderbuffer
-#define glNamedFramebufferTexture                     gl3wNamedFramebufferTexture
-#define glNamedFramebufferTextureLayer                gl3wNamedFramebufferTextureLayer
-#define glNamedRenderbufferStorage                    gl3wNamedRenderbufferStorage
-#define glNamedRenderbufferStorageMultisample         gl3wNamedRenderbufferStorageMultisample
-#define glNamedStringARB                              gl3wNamedStringARB
-#define glObjectLabel                                 gl3wObjectLabel
-#define glObjectPtrLabel                              gl3wObjectPtrLabel
-#define glPatchParameterfv                            gl3wPatchParameterfv
-#define glPatchParameteri                             gl3wPatchParameteri
-#define glPauseTransformFeedback                      gl3wPauseTransformFeedback
-#define glPixelStoref                                 gl3wPixelStoref
-#define glPixelStorei                                 gl3wPixelStorei
-#define glPointParameterf                             gl3wPointParameterf
-#define glPointParameterfv                            gl3wPointParameterfv
-#define glPointParameteri                             gl3wPointParameteri
-#define glPointParameteriv                            gl3wPointParameteriv
-#define glPointSize                                   gl3wPointSize
-#define glPolygonMode                                 gl3wPolygonMode
-#define glPolygonOffset                               gl3wPolygonOffset
-#define glPopDebugGroup                               gl3wPopDebugGroup
-#define glPrimitiveRestartIndex                       gl3wPrimitiveRestartIndex
-#define glProgramBinary                               gl3wProgramBinary
-#define glProgramParameteri                           gl3wProgramParameteri
-#define glProgramUniform1d                            gl3wProgramUniform1d
-#define glProgramUniform1dv                           gl3wProgramUniform1dv
-#define glProgramUniform1f                            gl3wProgramUniform1f
-#define glProgramUniform1fv                           gl3wProgramUniform1fv
-#define glProgramUniform1i                            gl3wProgramUniform1i
-#define glProgramUniform1iv                           gl3wProgramUniform1iv
-#define glProgramUniform1ui                           gl3wProgramUniform1ui
-#define glProgramUniform1uiv                          gl3wProgramUniform1uiv
-#define glProgramUniform2d                            gl3wProgramUniform2d
-#define glProgramUniform2dv                           gl3wProgramUniform2dv
-#define glProgramUniform2f                            gl3wProgramUniform2f
-#define glProgramUniform2fv                           gl3wProgramUniform2fv
-#define glProgramUniform2i                            gl3wProgramUniform2i
-#define glProgramUniform2iv                           gl3wProgramUniform2iv
-#define glProgramUniform2ui                           gl3wProgramUniform2ui
-#define glProgramUniform2uiv                          gl3wProgramUniform2uiv
-#define glProgramUniform3d                            gl3wProgramUniform3d
-#define glProgramUniform3dv                           gl3wProgramUniform3dv
-#define glProgramUniform3f                            gl3wProgramUniform3f
-#define glProgramUniform3fv                           gl3wProgramUniform3fv
-#define glProgramUniform3i                            gl3wProgramUniform3i
-#define glProgramUniform3iv                           gl3wProgramUniform3iv
-#define glProgramUniform3ui                           gl3wProgramUniform3ui
-#define glProgramUniform3uiv                          gl3wProgramUniform3uiv
-#define glProgramUniform4d                            gl3wProgramUniform4d
-#define glProgramUniform4dv                           gl3wProgramUniform4dv
-#define glProgramUniform4f                            gl3wProgramUniform4f
-#define glProgramUniform4fv                           gl3wProgramUniform4fv
-#define glProgramUniform4i                            gl3wProgramUniform4i
-#define glProgramUniform4iv                           gl3wProgramUniform4iv
-#define glProgramUniform4ui                           gl3wProgramUniform4ui
-#define glProgramUniform4uiv                          gl3wProgramUniform4uiv
-#define glProgramUniformHandleui64ARB                 gl3wProgramUniformHandleui64ARB
-#define glProgramUniformHandleui64vARB                gl3wProgramUniformHandleui64vARB
-#define glProgramUniformMatrix2dv                     gl3wProgramUniformMatrix2dv
-#define glProgramUniformMatrix2fv                     gl3wProgramUniformMatrix2fv
-#define glProgramUniformMatrix2x3dv                   gl3wProgramUniformMatrix2x3dv
-#define glProgramUniformMatrix2x3fv                   gl3wProgramUniformMatrix2x3fv
-#define glProgramUniformMatrix2x4dv                   gl3wProgramUniformMatrix2x4dv
-#define glProgramUniformMatrix2x4fv                   gl3wProgramUniformMatrix2x4fv
-#define glProgramUniformMatrix3dv                     gl3wProgramUniformMatrix3dv
-#define glProgramUniformMatrix3fv                     gl3wProgramUniformMatrix3fv
-#define glProgramUniformMatrix3x2dv                   gl3wProgramUniformMatrix3x2dv
-#define glProgramUniformMatrix3x2fv                   gl3wProgramUniformMatrix3x2fv
-#define glProgramUniformMatrix3x4dv                   gl3wProgramUniformMatrix3x4dv
-#define glProgramUniformMatrix3x4fv                   gl3wProgramUniformMatrix3x4fv
-#define glProgramUniformMatrix4dv                     gl3wProgramUniformMatrix4dv
-#define glProgramUniformMatrix4fv                     gl3wProgramUniformMatrix4fv
-#define glProgramUniformMatrix4x2dv                   gl3wProgramUniformMatrix4x2dv
-#define glProgramUniformMatrix4x2fv                   gl3wProgramUniformMatrix4x2fv
-#define glProgramUniformMatrix4x3dv                   gl3wProgramUniformMatrix4x3dv
-#define glProgramUniformMatrix4x3fv                   gl3wProgramUniformMatrix4x3fv
-#define glProvokingVertex                             gl3wProvokingVertex
-#define glPushDebugGroup                              gl3wPushDebugGroup
-#define glQueryCounter                                gl3wQueryCounter
-#define glReadBuffer                                  gl3wReadBuffer
-#define glReadPixels                                  gl3wReadPixels
-#define glReadnPixels                                 gl3wReadnPixels
-#define glReadnPixelsARB                              gl3wReadnPixelsARB
-#define glReleaseShaderCompiler                       gl3wReleaseShaderCompiler
-#define glRenderbufferStorage                         gl3wRenderbufferStorage
-#define glRenderbufferStorageMultisample              gl3wRenderbufferStorageMultisample
-#define glResumeTransformFeedback                     gl3wResumeTransformFeedback
-#define glSampleCoverage                              gl3wSampleCoverage
-#define glSampleMaski                                 gl3wSampleMaski
-#define glSamplerParameterIiv                         gl3wSamplerParameterIiv
-#define glSamplerParameterIuiv                        gl3wSamplerParameterIuiv
-#define glSamplerParameterf                           gl3wSamplerParameterf
-#define glSamplerParameterfv                          gl3wSamplerParameterfv
-#define glSamplerParameteri                           gl3wSamplerParameteri
-#define glSamplerParameteriv                          gl3wSamplerParameteriv
-#define glScissor                                     gl3wScissor
-#define glScissorArrayv                               gl3wScissorArrayv
-#define glScissorIndexed                              gl3wScissorIndexed
-#define glScissorIndexedv                             gl3wScissorIndexedv
-#define glShaderBinary                                gl3wShaderBinary
-#define glShaderSource                                gl3wShaderSource
-#define glShaderStorageBlockBinding                   gl3wShaderStorageBlockBinding
-#define glStencilFunc                                 gl3wStencilFunc
-#define glStencilFuncSeparate                         gl3wStencilFuncSeparate
-#define glStencilMask                                 gl3wStencilMask
-#define glStencilMaskSeparate                         gl3wStencilMaskSeparate
-#define glStencilOp                                   gl3wStencilOp
-#define glStencilOpSeparate                           gl3wStencilOpSeparate
-#define glTexBuffer                                   gl3wTexBuffer
-#define glTexBufferRange                              gl3wTexBufferRange
-#define glTexImage1D                                  gl3wTexImage1D
-#define glTexImage2D                                  gl3wTexImage2D
-#define glTexImage2DMultisample                       gl3wTexImage2DMultisample
-#define glTexImage3D                                  gl3wTexImage3D
-#define glTexImage3DMultisample                       gl3wTexImage3DMultisample
-#define glTexPageCommitmentARB                        gl3wTexPageCommitmentARB
-#define glTexParameterIiv                             gl3wTexParameterIiv
-#define glTexParameterIuiv                            gl3wTexParameterIuiv
-#define glTexParameterf                               gl3wTexParameterf
-#define glTexParameterfv                              gl3wTexParameterfv
-#define glTexParameteri                               gl3wTexParameteri
-#define glTexParameteriv                              gl3wTexParameteriv
-#define glTexStorage1D                                gl3wTexStorage1D
-#define glTexStorage2D                                gl3wTexStorage2D
-#define glTexStorage2DMultisample                     gl3wTexStorage2DMultisample
-#define glTexStorage3D                                gl3wTexStorage3D
-#define glTexStorage3DMultisample                     gl3wTexStorage3DMultisample
-#define glTexSubImage1D                               gl3wTexSubImage1D
-#define glTexSubImage2D                               gl3wTexSubImage2D
-#define glTexSubImage3D                               gl3wTexSubImage3D
-#define glTextureBarrier                              gl3wTextureBarrier
-#define glTextureBuffer                               gl3wTextureBuffer
-#define glTextureBufferRange                          gl3wTextureBufferRange
-#define glTextureParameterIiv                         gl3wTextureParameterIiv
-#define glTextureParameterIuiv                        gl3wTextureParameterIuiv
-#define glTextureParameterf                           gl3wTextureParameterf
-#define glTextureParameterfv                          gl3wTextureParameterfv
-#define glTextureParameteri                           gl3wTextureParameteri
-#define glTextureParameteriv                          gl3wTextureParameteriv
-#define glTextureStorage1D                            gl3wTextureStorage1D
-#define glTextureStorage2D                            gl3wTextureStorage2D
-#define glTextureStorage2DMultisample                 gl3wTextureStorage2DMultisample
-#define glTextureStorage3D                            gl3wTextureStorage3D
-#define glTextureStorage3DMultisample                 gl3wTextureStorage3DMultisample
-#define glTextureSubImage1D                           gl3wTextureSubImage1D
-#define glTextureSubImage2D                           gl3wTextureSubImage2D
-#define glTextureSubImage3D                           gl3wTextureSubImage3D
-#define glTextureView                                 gl3wTextureView
-#define glTransformFeedbackBufferBase                 gl3wTransformFeedbackBufferBase
-#define glTransformFeedbackBufferRange                gl3wTransformFeedbackBufferRange
-#define glTransformFeedbackVaryings                   gl3wTransformFeedbackVaryings
-#define glUniform1d                                   gl3wUniform1d
-#define glUniform1dv                                  gl3wUniform1dv
-#define glUniform1f                                   gl3wUniform1f
-#define glUniform1fv                                  gl3wUniform1fv
-#define glUniform1i                                   gl3wUniform1i
-#define glUniform1iv                                  gl3wUniform1iv
-#define glUniform1ui                                  gl3wUniform1ui
-#define glUniform1uiv                                 gl3wUniform1uiv
-#define glUniform2d                                   gl3wUniform2d
-#define glUniform2dv                                  gl3wUniform2dv
-#define glUniform2f                                   gl3wUniform2f
-#define glUniform2fv                                  gl3wUniform2fv
-#define glUniform2i                                   gl3wUniform2i
-#define glUniform2iv                                  gl3wUniform2iv
-#define glUniform2ui                                  gl3wUniform2ui
-#define glUniform2uiv                                 gl3wUniform2uiv
-#define glUniform3d                                   gl3wUniform3d
-#define glUniform3dv                                  gl3wUniform3dv
-#define glUniform3f                                   gl3wUniform3f
-#define glUniform3fv                                  gl3wUniform3fv
-#define glUniform3i                                   gl3wUniform3i
-#define glUniform3iv                                  gl3wUniform3iv
-#define glUniform3ui                                  gl3wUniform3ui
-#define glUniform3uiv                                 gl3wUniform3uiv
-#define glUniform4d                                   gl3wUniform4d
-#define glUniform4dv                                  gl3wUniform4dv
-#define glUniform4f                                   gl3wUniform4f
-#define glUniform4fv                                  gl3wUniform4fv
-#define glUniform4i                                   gl3wUniform4i
-#define glUniform4iv                                  gl3wUniform4iv
-#define glUniform4ui                                  gl3wUniform4ui
-#define glUniform4uiv                                 gl3wUniform4uiv
-#define glUniformBlockBinding                         gl3wUniformBlockBinding
-#define glUniformHandleui64ARB                        gl3wUniformHandleui64ARB
-#define glUniformHandleui64vARB                       gl3wUniformHandleui64vARB
-#define glUniformMatrix2dv                            gl3wUniformMatrix2dv
-#define glUniformMatrix2fv                            gl3wUniformMatrix2fv
-#define glUniformMatrix2x3dv                          gl3wUniformMatrix2x3dv
-#define glUniformMatrix2x3fv                          gl3wUniformMatrix2x3fv
-#define glUniformMatrix2x4dv                          gl3wUniformMatrix2x4dv
-#define glUniformMatrix2x4fv                          gl3wUniformMatrix2x4fv
-#define glUniformMatrix3dv                            gl3wUniformMatrix3dv
-#define glUniformMatrix3fv                            gl3wUniformMatrix3fv
-#define glUniformMatrix3x2dv                          gl3wUniformMatrix3x2dv
-#define glUniformMatrix3x2fv                          gl3wUniformMatrix3x2fv
-#define glUniformMatrix3x4dv                          gl3wUniformMatrix3x4dv
-#define glUniformMatrix3x4fv                          gl3wUniformMatrix3x4fv
-#define glUniformMatrix4dv                            gl3wUniformMatrix4dv
-#define glUniformMatrix4fv                            gl3wUniformMatrix4fv
-#define glUniformMatrix4x2dv                          gl3wUniformMatrix4x2dv
-#define glUniformMatrix4x2fv                          gl3wUniformMatrix4x2fv
-#define glUniformMatrix4x3dv                          gl3wUniformMatrix4x3dv
-#define glUniformMatrix4x3fv                          gl3wUniformMatrix4x3fv
-#define glUniformSubroutinesuiv                       gl3wUniformSubroutinesuiv
-#define glUnmapBuffer                                 gl3wUnmapBuffer
-#define glUnmapNamedBuffer                            gl3wUnmapNamedBuffer
-#define glUseProgram                                  gl3wUseProgram
-#define glUseProgramStages                            gl3wUseProgramStages
-#define glValidateProgram                             gl3wValidateProgram
-#define glValidateProgramPipeline                     gl3wValidateProgramPipeline
-#define glVertexArrayAttribBinding                    gl3wVertexArrayAttribBinding
-#define glVertexArrayAttribFormat                     gl3wVertexArrayAttribFormat
-#define glVertexArrayAttribIFormat                    gl3wVertexArrayAttribIFormat
-#define glVertexArrayAttribLFormat                    gl3wVertexArrayAttribLFormat
-#define glVertexArrayBindingDivisor                   gl3wVertexArrayBindingDivisor
-#define glVertexArrayElementBuffer                    gl3wVertexArrayElementBuffer
-#define glVertexArrayVertexBuffer                     gl3wVertexArrayVertexBuffer
-#define glVertexArrayVertexBuffers                    gl3wVertexArrayVertexBuffers
-#define glVertexAttrib1d                              gl3wVertexAttrib1d
-#define glVertexAttrib1dv                             gl3wVertexAttrib1dv
-#define glVertexAttrib1f                              gl3wVertexAttrib1f
-#define glVertexAttrib1fv                             gl3wVertexAttrib1fv
-#define glVertexAttrib1s                              gl3wVertexAttrib1s
-#define glVertexAttrib1sv                             gl3wVertexAttrib1sv
-#define glVertexAttrib2d                              gl3wVertexAttrib2d
-#define glVertexAttrib2dv                             gl3wVertexAttrib2dv
-#define glVertexAttrib2f                              gl3wVertexAttrib2f
-#define glVertexAttrib2fv                             gl3wVertexAttrib2fv
-#define glVertexAttrib2s                              gl3wVertexAttrib2s
-#define glVertexAttrib2sv                             gl3wVertexAttrib2sv
-#define glVertexAttrib3d                              gl3wVertexAttrib3d
-#define glVertexAttrib3dv                             gl3wVertexAttrib3dv
-#define glVertexAttrib3f                              gl3wVertexAttrib3f
-#define glVertexAttrib3fv                             gl3wVertexAttrib3fv
-#define glVertexAttrib3s                              gl3wVertexAttrib3s
-#define glVertexAttrib3sv                             gl3wVertexAttrib3sv
-#define glVertexAttrib4Nbv                            gl3wVertexAttrib4Nbv
-#define glVertexAttrib4Niv                            gl3wVertexAttrib4Niv
-#define glVertexAttrib4Nsv                            gl3wVertexAttrib4Nsv
-#define glVertexAttrib4Nub                            gl3wVertexAttrib4Nub
-#define glVertexAttrib4Nubv                           gl3wVertexAttrib4Nubv
-#define glVertexAttrib4Nuiv                           gl3wVertexAttrib4Nuiv
-#define glVertexAttrib4Nusv                           gl3wVertexAttrib4Nusv
-#define glVertexAttrib4bv                             gl3wVertexAttrib4bv
-#define glVertexAttrib4d                              gl3wVertexAttrib4d
-#define glVertexAttrib4dv                             gl3wVertexAttrib4dv
-#define glVertexAttrib4f                              gl3wVertexAttrib4f
-#define glVertexAttrib4fv                             gl3wVertexAttrib4fv
-#define glVertexAttrib4iv                             gl3wVertexAttrib4iv
-#define glVertexAttrib4s                              gl3wVertexAttrib4s
-#define glVertexAttrib4sv                             gl3wVertexAttrib4sv
-#define glVertexAttrib4ubv                            gl3wVertexAttrib4ubv
-#define glVertexAttrib4uiv                            gl3wVertexAttrib4uiv
-#define glVertexAttrib4usv                            gl3wVertexAttrib4usv
-#define glVertexAttribBinding                         gl3wVertexAttribBinding
-#define glVertexAttribDivisor                         gl3wVertexAttribDivisor
-#define glVertexAttribFormat                          gl3wVertexAttribFormat
-#define glVertexAttribI1i                             gl3wVertexAttribI1i
-#define glVertexAttribI1iv                            gl3wVertexAttribI1iv
-#define glVertexAttribI1ui                            gl3wVertexAttribI1ui
-#define glVertexAttribI1uiv                           gl3wVertexAttribI1uiv
-#define glVertexAttribI2i                             gl3wVertexAttribI2i
-#define glVertexAttribI2iv                            gl3wVertexAttribI2iv
-#define glVertexAttribI2ui                            gl3wVertexAttribI2ui
-#define glVertexAttribI2uiv                           gl3wVertexAttribI2uiv
-#define glVertexAttribI3i                             gl3wVertexAttribI3i
-#define glVertexAttribI3iv                            gl3wVertexAttribI3iv
-#define glVertexAttribI3ui                            gl3wVertexAttribI3ui
-#define glVertexAttribI3uiv                           gl3wVertexAttribI3uiv
-#define glVertexAttribI4bv                            gl3wVertexAttribI4bv
-#define glVertexAttribI4i                             gl3wVertexAttribI4i
-#define glVertexAttribI4iv                            gl3wVertexAttribI4iv
-#define glVertexAttribI4sv                            gl3wVertexAttribI4sv
-#define glVertexAttribI4ubv                           gl3wVertexAttribI4ubv
-#define glVertexAttribI4ui                            gl3wVertexAttribI4ui
-#define glVertexAttribI4uiv                           gl3wVertexAttribI4uiv
-#define glVertexAttribI4usv                           gl3wVertexAttribI4usv
-#define glVertexAttribIFormat                         gl3wVertexAttribIFormat
-#define glVertexAttribIPointer                        gl3wVertexAttribIPointer
-#define glVertexAttribL1d                             gl3wVertexAttribL1d
-#define glVertexAttribL1dv                            gl3wVertexAttribL1dv
-#define glVertexAttribL1ui64ARB                       gl3wVertexAttribL1ui64ARB
-#define glVertexAttribL1ui64vARB                      gl3wVertexAttribL1ui64vARB
-#define glVertexAttribL2d                             gl3wVertexAttribL2d
-#define glVertexAttribL2dv                            gl3wVertexAttribL2dv
-#define glVertexAttribL3d                             gl3wVertexAttribL3d
-#define glVertexAttribL3dv                            gl3wVertexAttribL3dv
-#define glVertexAttribL4d                             gl3wVertexAttribL4d
-#define glVertexAttribL4dv                            gl3wVertexAttribL4dv
-#define glVertexAttribLFormat                         gl3wVertexAttribLFormat
-#define glVertexAttribLPointer                        gl3wVertexAttribLPointer
-#define glVertexAttribP1ui                            gl3wVertexAttribP1ui
-#define glVertexAttribP1uiv                           gl3wVertexAttribP1uiv
-#define glVertexAttribP2ui                            gl3wVertexAttribP2ui
-#define glVertexAttribP2uiv                           gl3wVertexAttribP2uiv
-#define glVertexAttribP3ui                            gl3wVertexAttribP3ui
-#define glVertexAttribP3uiv                           gl3wVertexAttribP3uiv
-#define glVertexAttribP4ui                            gl3wVertexAttribP4ui
-#define glVertexAttribP4uiv                           gl3wVertexAttribP4uiv
-#define glVertexAttribPointer                         gl3wVertexAttribPointer
-#define glVertexBindingDivisor                        gl3wVertexBindingDivisor
-#define glViewport                                    gl3wViewport
-#define glViewportArrayv                              gl3wViewportArrayv
-#define glViewportIndexedf                            gl3wViewportIndexedf
-#define glViewportIndexedfv                           gl3wViewportIndexedfv
-#define glWaitSync                                    gl3wWaitSync
+#define glActiveShaderProgram                         gl3wProcs.gl.ActiveShaderProgram
+#define glActiveTexture                               gl3wProcs.gl.ActiveTexture
+#define glAttachShader                                gl3wProcs.gl.AttachShader
+#define glBeginConditionalRender                      gl3wProcs.gl.BeginConditionalRender
+#define glBeginQuery                                  gl3wProcs.gl.BeginQuery
+#define glBeginQueryIndexed                           gl3wProcs.gl.BeginQueryIndexed
+#define glBeginTransformFeedback                      gl3wProcs.gl.BeginTransformFeedback
+#define glBindAttribLocation                          gl3wProcs.gl.BindAttribLocation
+#define glBindBuffer                                  gl3wProcs.gl.BindBuffer
+#define glBindBufferBase                              gl3wProcs.gl.BindBufferBase
+#define glBindBufferRange                             gl3wProcs.gl.BindBufferRange
+#define glBindBuffersBase                             gl3wProcs.gl.BindBuffersBase
+#define glBindBuffersRange                            gl3wProcs.gl.BindBuffersRange
+#define glBindFragDataLocation                        gl3wProcs.gl.BindFragDataLocation
+#define glBindFragDataLocationIndexed                 gl3wProcs.gl.BindFragDataLocationIndexed
+#define glBindFramebuffer                             gl3wProcs.gl.BindFramebuffer
+#define glBindImageTexture                            gl3wProcs.gl.BindImageTexture
+#define glBindImageTextures                           gl3wProcs.gl.BindImageTextures
+#define glBindProgramPipeline                         gl3wProcs.gl.BindProgramPipeline
+#define glBindRenderbuffer                            gl3wProcs.gl.BindRenderbuffer
+#define glBindSampler                                 gl3wProcs.gl.BindSampler
+#define glBindSamplers                                gl3wProcs.gl.BindSamplers
+#define glBindTexture                                 gl3wProcs.gl.BindTexture
+#define glBindTextureUnit                             gl3wProcs.gl.BindTextureUnit
+#define glBindTextures                                gl3wProcs.gl.BindTextures
+#define glBindTransformFeedback                       gl3wProcs.gl.BindTransformFeedback
+#define glBindVertexArray                             gl3wProcs.gl.BindVertexArray
+#define glBindVertexBuffer                            gl3wProcs.gl.BindVertexBuffer
+#define glBindVertexBuffers                           gl3wProcs.gl.BindVertexBuffers
+#define glBlendColor                                  gl3wProcs.gl.BlendColor
+#define glBlendEquation                               gl3wProcs.gl.BlendEquation
+#define glBlendEquationSeparate                       gl3wProcs.gl.BlendEquationSeparate
+#define glBlendEquationSeparatei                      gl3wProcs.gl.BlendEquationSeparatei
+#define glBlendEquationSeparateiARB                   gl3wProcs.gl.BlendEquationSeparateiARB
+#define glBlendEquationi                              gl3wProcs.gl.BlendEquationi
+#define glBlendEquationiARB                           gl3wProcs.gl.BlendEquationiARB
+#define glBlendFunc                                   gl3wProcs.gl.BlendFunc
+#define glBlendFuncSeparate                           gl3wProcs.gl.BlendFuncSeparate
+#define glBlendFuncSeparatei                          gl3wProcs.gl.BlendFuncSeparatei
+#define glBlendFuncSeparateiARB                       gl3wProcs.gl.BlendFuncSeparateiARB
+#define glBlendFunci                                  gl3wProcs.gl.BlendFunci
+#define glBlendFunciARB                               gl3wProcs.gl.BlendFunciARB
+#define glBlitFramebuffer                             gl3wProcs.gl.BlitFramebuffer
+#define glBlitNamedFramebuffer                        gl3wProcs.gl.BlitNamedFramebuffer
+#define glBufferData                                  gl3wProcs.gl.BufferData
+#define glBufferPageCommitmentARB                     gl3wProcs.gl.BufferPageCommitmentARB
+#define glBufferStorage                               gl3wProcs.gl.BufferStorage
+#define glBufferSubData                               gl3wProcs.gl.BufferSubData
+#define glCheckFramebufferStatus                      gl3wProcs.gl.CheckFramebufferStatus
+#define glCheckNamedFramebufferStatus                 gl3wProcs.gl.CheckNamedFramebufferStatus
+#define glClampColor                                  gl3wProcs.gl.ClampColor
+#define glClear                                       gl3wProcs.gl.Clear
+#define glClearBufferData                             gl3wProcs.gl.ClearBufferData
+#define glClearBufferSubData                          gl3wProcs.gl.ClearBufferSubData
+#define glClearBufferfi                               gl3wProcs.gl.ClearBufferfi
+#define glClearBufferfv                               gl3wProcs.gl.ClearBufferfv
+#define glClearBufferiv                               gl3wProcs.gl.ClearBufferiv
+#define glClearBufferuiv                              gl3wProcs.gl.ClearBufferuiv
+#define glClearColor                                  gl3wProcs.gl.ClearColor
+#define glClearDepth                                  gl3wProcs.gl.ClearDepth
+#define glClearDepthf                                 gl3wProcs.gl.ClearDepthf
+#define glClearNamedBufferData                        gl3wProcs.gl.ClearNamedBufferData
+#define glClearNamedBufferSubData                     gl3wProcs.gl.ClearNamedBufferSubData
+#define glClearNamedFramebufferfi                     gl3wProcs.gl.ClearNamedFramebufferfi
+#define glClearNamedFramebufferfv                     gl3wProcs.gl.ClearNamedFramebufferfv
+#define glClearNamedFramebufferiv                     gl3wProcs.gl.ClearNamedFramebufferiv
+#define glClearNamedFramebufferuiv                    gl3wProcs.gl.ClearNamedFramebufferuiv
+#define glClearStencil                                gl3wProcs.gl.ClearStencil
+#define glClearTexImage                               gl3wProcs.gl.ClearTexImage
+#define glClearTexSubImage                            gl3wProcs.gl.ClearTexSubImage
+#define glClientWaitSync                              gl3wProcs.gl.ClientWaitSync
+#define glClipControl                                 gl3wProcs.gl.ClipControl
+#define glColorMask                                   gl3wProcs.gl.ColorMask
+#define glColorMaski                                  gl3wProcs.gl.ColorMaski
+#define glCompileShader                               gl3wProcs.gl.CompileShader
+#define glCompileShaderIncludeARB                     gl3wProcs.gl.CompileShaderIncludeARB
+#define glCompressedTexImage1D                        gl3wProcs.gl.CompressedTexImage1D
+#define glCompressedTexImage2D                        gl3wProcs.gl.CompressedTexImage2D
+#define glCompressedTexImage3D                        gl3wProcs.gl.CompressedTexImage3D
+#define glCompressedTexSubImage1D                     gl3wProcs.gl.CompressedTexSubImage1D
+#define glCompressedTexSubImage2D                     gl3wProcs.gl.CompressedTexSubImage2D
+#define glCompressedTexSubImage3D                     gl3wProcs.gl.CompressedTexSubImage3D
+#define glCompressedTextureSubImage1D                 gl3wProcs.gl.CompressedTextureSubImage1D
+#define glCompressedTextureSubImage2D                 gl3wProcs.gl.CompressedTextureSubImage2D
+#define glCompressedTextureSubImage3D                 gl3wProcs.gl.CompressedTextureSubImage3D
+#define glCopyBufferSubData                           gl3wProcs.gl.CopyBufferSubData
+#define glCopyImageSubData                            gl3wProcs.gl.CopyImageSubData
+#define glCopyNamedBufferSubData                      gl3wProcs.gl.CopyNamedBufferSubData
+#define glCopyTexImage1D                              gl3wProcs.gl.CopyTexImage1D
+#define glCopyTexImage2D                              gl3wProcs.gl.CopyTexImage2D
+#define glCopyTexSubImage1D                           gl3wProcs.gl.CopyTexSubImage1D
+#define glCopyTexSubImage2D                           gl3wProcs.gl.CopyTexSubImage2D
+#define glCopyTexSubImage3D                           gl3wProcs.gl.CopyTexSubImage3D
+#define glCopyTextureSubImage1D                       gl3wProcs.gl.CopyTextureSubImage1D
+#define glCopyTextureSubImage2D                       gl3wProcs.gl.CopyTextureSubImage2D
+#define glCopyTextureSubImage3D                       gl3wProcs.gl.CopyTextureSubImage3D
+#define glCreateBuffers                               gl3wProcs.gl.CreateBuffers
+#define glCreateFramebuffers                          gl3wProcs.gl.CreateFramebuffers
+#define glCreateProgram                               gl3wProcs.gl.CreateProgram
+#define glCreateProgramPipelines                      gl3wProcs.gl.CreateProgramPipelines
+#define glCreateQueries                               gl3wProcs.gl.CreateQueries
+#define glCreateRenderbuffers                         gl3wProcs.gl.CreateRenderbuffers
+#define glCreateSamplers                              gl3wProcs.gl.CreateSamplers
+#define glCreateShader                                gl3wProcs.gl.CreateShader
+#define glCreateShaderProgramv                        gl3wProcs.gl.CreateShaderProgramv
+#define glCreateSyncFromCLeventARB                    gl3wProcs.gl.CreateSyncFromCLeventARB
+#define glCreateTextures                              gl3wProcs.gl.CreateTextures
+#define glCreateTransformFeedbacks                    gl3wProcs.gl.CreateTransformFeedbacks
+#define glCreateVertexArrays                          gl3wProcs.gl.CreateVertexArrays
+#define glCullFace                                    gl3wProcs.gl.CullFace
+#define glDebugMessageCallback                        gl3wProcs.gl.DebugMessageCallback
+#define glDebugMessageCallbackARB                     gl3wProcs.gl.DebugMessageCallbackARB
+#define glDebugMessageControl                         gl3wProcs.gl.DebugMessageControl
+#define glDebugMessageControlARB                      gl3wProcs.gl.DebugMessageControlARB
+#define glDebugMessageInsert                          gl3wProcs.gl.DebugMessageInsert
+#define glDebugMessageInsertARB                       gl3wProcs.gl.DebugMessageInsertARB
+#define glDeleteBuffers                               gl3wProcs.gl.DeleteBuffers
+#define glDeleteFramebuffers                          gl3wProcs.gl.DeleteFramebuffers
+#define glDeleteNamedStringARB                        gl3wProcs.gl.DeleteNamedStringARB
+#define glDeleteProgram                               gl3wProcs.gl.DeleteProgram
+#define glDeleteProgramPipelines                      gl3wProcs.gl.DeleteProgramPipelines
+#define glDeleteQueries                               gl3wProcs.gl.DeleteQueries
+#define glDeleteRenderbuffers                         gl3wProcs.gl.DeleteRenderbuffers
+#define glDeleteSamplers                              gl3wProcs.gl.DeleteSamplers
+#define glDeleteShader                                gl3wProcs.gl.DeleteShader
+#define glDeleteSync                                  gl3wProcs.gl.DeleteSync
+#define glDeleteTextures                              gl3wProcs.gl.DeleteTextures
+#define glDeleteTransformFeedbacks                    gl3wProcs.gl.DeleteTransformFeedbacks
+#define glDeleteVertexArrays                          gl3wProcs.gl.DeleteVertexArrays
+#define glDepthFunc                                   gl3wProcs.gl.DepthFunc
+#define glDepthMask                                   gl3wProcs.gl.DepthMask
+#define glDepthRange                                  gl3wProcs.gl.DepthRange
+#define glDepthRangeArrayv                            gl3wProcs.gl.DepthRangeArrayv
+#define glDepthRangeIndexed                           gl3wProcs.gl.DepthRangeIndexed
+#define glDepthRangef                                 gl3wProcs.gl.DepthRangef
+#define glDetachShader                                gl3wProcs.gl.DetachShader
+#define glDisable                                     gl3wProcs.gl.Disable
+#define glDisableVertexArrayAttrib                    gl3wProcs.gl.DisableVertexArrayAttrib
+#define glDisableVertexAttribArray                    gl3wProcs.gl.DisableVertexAttribArray
+#define glDisablei                                    gl3wProcs.gl.Disablei
+#define glDispatchCompute                             gl3wProcs.gl.DispatchCompute
+#define glDispatchComputeGroupSizeARB                 gl3wProcs.gl.DispatchComputeGroupSizeARB
+#define glDispatchComputeIndirect                     gl3wProcs.gl.DispatchComputeIndirect
+#define glDrawArrays                                  gl3wProcs.gl.DrawArrays
+#define glDrawArraysIndirect                          gl3wProcs.gl.DrawArraysIndirect
+#define glDrawArraysInstanced                         gl3wProcs.gl.DrawArraysInstanced
+#define glDrawArraysInstancedBaseInstance             gl3wProcs.gl.DrawArraysInstancedBaseInstance
+#define glDrawBuffer                                  gl3wProcs.gl.DrawBuffer
+#define glDrawBuffers                                 gl3wProcs.gl.DrawBuffers
+#define glDrawElements                                gl3wProcs.gl.DrawElements
+#define glDrawElementsBaseVertex                      gl3wProcs.gl.DrawElementsBaseVertex
+#define glDrawElementsIndirect                        gl3wProcs.gl.DrawElementsIndirect
+#define glDrawElementsInstanced                       gl3wProcs.gl.DrawElementsInstanced
+#define glDrawElementsInstancedBaseInstance           gl3wProcs.gl.DrawElementsInstancedBaseInstance
+#define glDrawElementsInstancedBaseVertex             gl3wProcs.gl.DrawElementsInstancedBaseVertex
+#define glDrawElementsInstancedBaseVertexBaseInstance gl3wProcs.gl.DrawElementsInstancedBaseVertexBaseInstance
+#define glDrawRangeElements                           gl3wProcs.gl.DrawRangeElements
+#define glDrawRangeElementsBaseVertex                 gl3wProcs.gl.DrawRangeElementsBaseVertex
+#define glDrawTransformFeedback                       gl3wProcs.gl.DrawTransformFeedback
+#define glDrawTransformFeedbackInstanced              gl3wProcs.gl.DrawTransformFeedbackInstanced
+#define glDrawTransformFeedbackStream                 gl3wProcs.gl.DrawTransformFeedbackStream
+#define glDrawTransformFeedbackStreamInstanced        gl3wProcs.gl.DrawTransformFeedbackStreamInstanced
+#define glEnable                                      gl3wProcs.gl.Enable
+#define glEnableVertexArrayAttrib                     gl3wProcs.gl.EnableVertexArrayAttrib
+#define glEnableVertexAttribArray                     gl3wProcs.gl.EnableVertexAttribArray
+#define glEnablei                                     gl3wProcs.gl.Enablei
+#define glEndConditionalRender                        gl3wProcs.gl.EndConditionalRender
+#define glEndQuery                                    gl3wProcs.gl.EndQuery
+#define glEndQueryIndexed                             gl3wProcs.gl.EndQueryIndexed
+#define glEndTransformFeedback                        gl3wProcs.gl.EndTransformFeedback
+#define glFenceSync                                   gl3wProcs.gl.FenceSync
+#define glFinish                                      gl3wProcs.gl.Finish
+#define glFlush                                       gl3wProcs.gl.Flush
+#define glFlushMappedBufferRange                      gl3wProcs.gl.FlushMappedBufferRange
+#define glFlushMappedNamedBufferRange                 gl3wProcs.gl.FlushMappedNamedBufferRange
+#define glFramebufferParameteri                       gl3wProcs.gl.FramebufferParameteri
+#define glFramebufferRenderbuffer                     gl3wProcs.gl.FramebufferRenderbuffer
+#define glFramebufferTexture                          gl3wProcs.gl.FramebufferTexture
+#define glFramebufferTexture1D                        gl3wProcs.gl.FramebufferTexture1D
+#define glFramebufferTexture2D                        gl3wProcs.gl.FramebufferTexture2D
+#define glFramebufferTexture3D                        gl3wProcs.gl.FramebufferTexture3D
+#define glFramebufferTextureLayer                     gl3wProcs.gl.FramebufferTextureLayer
+#define glFrontFace                                   gl3wProcs.gl.FrontFace
+#define glGenBuffers                                  gl3wProcs.gl.GenBuffers
+#define glGenFramebuffers                             gl3wProcs.gl.GenFramebuffers
+#define glGenProgramPipelines                         gl3wProcs.gl.GenProgramPipelines
+#define glGenQueries                                  gl3wProcs.gl.GenQueries
+#define glGenRenderbuffers                            gl3wProcs.gl.GenRenderbuffers
+#define glGenSamplers                                 gl3wProcs.gl.GenSamplers
+#define glGenTextures                                 gl3wProcs.gl.GenTextures
+#define glGenTransformFeedbacks                       gl3wProcs.gl.GenTransformFeedbacks
+#define glGenVertexArrays                             gl3wProcs.gl.GenVertexArrays
+#define glGenerateMipmap                              gl3wProcs.gl.GenerateMipmap
+#define glGenerateTextureMipmap                       gl3wProcs.gl.GenerateTextureMipmap
+#define glGetActiveAtomicCounterBufferiv              gl3wProcs.gl.GetActiveAtomicCounterBufferiv
+#define glGetActiveAttrib                             gl3wProcs.gl.GetActiveAttrib
+#define glGetActiveSubroutineName                     gl3wProcs.gl.GetActiveSubroutineName
+#define glGetActiveSubroutineUniformName              gl3wProcs.gl.GetActiveSubroutineUniformName
+#define glGetActiveSubroutineUniformiv                gl3wProcs.gl.GetActiveSubroutineUniformiv
+#define glGetActiveUniform                            gl3wProcs.gl.GetActiveUniform
+#define glGetActiveUniformBlockName                   gl3wProcs.gl.GetActiveUniformBlockName
+#define glGetActiveUniformBlockiv                     gl3wProcs.gl.GetActiveUniformBlockiv
+#define glGetActiveUniformName                        gl3wProcs.gl.GetActiveUniformName
+#define glGetActiveUniformsiv                         gl3wProcs.gl.GetActiveUniformsiv
+#define glGetAttachedShaders                          gl3wProcs.gl.GetAttachedShaders
+#define glGetAttribLocation                           gl3wProcs.gl.GetAttribLocation
+#define glGetBooleani_v                               gl3wProcs.gl.GetBooleani_v
+#define glGetBooleanv                                 gl3wProcs.gl.GetBooleanv
+#define glGetBufferParameteri64v                      gl3wProcs.gl.GetBufferParameteri64v
+#define glGetBufferParameteriv                        gl3wProcs.gl.GetBufferParameteriv
+#define glGetBufferPointerv                           gl3wProcs.gl.GetBufferPointerv
+#define glGetBufferSubData                            gl3wProcs.gl.GetBufferSubData
+#define glGetCompressedTexImage                       gl3wProcs.gl.GetCompressedTexImage
+#define glGetCompressedTextureImage                   gl3wProcs.gl.GetCompressedTextureImage
+#define glGetCompressedTextureSubImage                gl3wProcs.gl.GetCompressedTextureSubImage
+#define glGetDebugMessageLog                          gl3wProcs.gl.GetDebugMessageLog
+#define glGetDebugMessageLogARB                       gl3wProcs.gl.GetDebugMessageLogARB
+#define glGetDoublei_v                                gl3wProcs.gl.GetDoublei_v
+#define glGetDoublev                                  gl3wProcs.gl.GetDoublev
+#define glGetError                                    gl3wProcs.gl.GetError
+#define glGetFloati_v                                 gl3wProcs.gl.GetFloati_v
+#define glGetFloatv                                   gl3wProcs.gl.GetFloatv
+#define glGetFragDataIndex                            gl3wProcs.gl.GetFragDataIndex
+#define glGetFragDataLocation                         gl3wProcs.gl.GetFragDataLocation
+#define glGetFramebufferAttachmentParameteriv         gl3wProcs.gl.GetFramebufferAttachmentParameteriv
+#define glGetFramebufferParameteriv                   gl3wProcs.gl.GetFramebufferParameteriv
+#define glGetGraphicsResetStatus                      gl3wProcs.gl.GetGraphicsResetStatus
+#define glGetGraphicsResetStatusARB                   gl3wProcs.gl.GetGraphicsResetStatusARB
+#define glGetImageHandleARB                           gl3wProcs.gl.GetImageHandleARB
+#define glGetInteger64i_v                             gl3wProcs.gl.GetInteger64i_v
+#define glGetInteger64v                               gl3wProcs.gl.GetInteger64v
+#define glGetIntegeri_v                               gl3wProcs.gl.GetIntegeri_v
+#define glGetIntegerv                                 gl3wProcs.gl.GetIntegerv
+#define glGetInternalformati64v                       gl3wProcs.gl.GetInternalformati64v
+#define glGetInternalformativ                         gl3wProcs.gl.GetInternalformativ
+#define glGetMultisamplefv                            gl3wProcs.gl.GetMultisamplefv
+#define glGetNamedBufferParameteri64v                 gl3wProcs.gl.GetNamedBufferParameteri64v
+#define glGetNamedBufferParameteriv                   gl3wProcs.gl.GetNamedBufferParameteriv
+#define glGetNamedBufferPointerv                      gl3wProcs.gl.GetNamedBufferPointerv
+#define glGetNamedBufferSubData                       gl3wProcs.gl.GetNamedBufferSubData
+#define glGetNamedFramebufferAttachmentParameteriv    gl3wProcs.gl.GetNamedFramebufferAttachmentParameteriv
+#define glGetNamedFramebufferParameteriv              gl3wProcs.gl.GetNamedFramebufferParameteriv
+#define glGetNamedRenderbufferParameteriv             gl3wProcs.gl.GetNamedRenderbufferParameteriv
+#define glGetNamedStringARB                           gl3wProcs.gl.GetNamedStringARB
+#define glGetNamedStringivARB                         gl3wProcs.gl.GetNamedStringivARB
+#define glGetObjectLabel                              gl3wProcs.gl.GetObjectLabel
+#define glGetObjectPtrLabel                           gl3wProcs.gl.GetObjectPtrLabel
+#define glGetPointerv                                 gl3wProcs.gl.GetPointerv
+#define glGetProgramBinary                            gl3wProcs.gl.GetProgramBinary
+#define glGetProgramInfoLog                           gl3wProcs.gl.GetProgramInfoLog
+#define glGetProgramInterfaceiv                       gl3wProcs.gl.GetProgramInterfaceiv
+#define glGetProgramPipelineInfoLog                   gl3wProcs.gl.GetProgramPipelineInfoLog
+#define glGetProgramPipelineiv                        gl3wProcs.gl.GetProgramPipelineiv
+#define glGetProgramResourceIndex                     gl3wProcs.gl.GetProgramResourceIndex
+#define glGetProgramResourceLocation                  gl3wProcs.gl.GetProgramResourceLocation
+#define glGetProgramResourceLocationIndex             gl3wProcs.gl.GetProgramResourceLocationIndex
+#define glGetProgramResourceName                      gl3wProcs.gl.GetProgramResourceName
+#define glGetProgramResourceiv                        gl3wProcs.gl.GetProgramResourceiv
+#define glGetProgramStageiv                           gl3wProcs.gl.GetProgramStageiv
+#define glGetProgramiv                                gl3wProcs.gl.GetProgramiv
+#define glGetQueryBufferObjecti64v                    gl3wProcs.gl.GetQueryBufferObjecti64v
+#define glGetQueryBufferObjectiv                      gl3wProcs.gl.GetQueryBufferObjectiv
+#define glGetQueryBufferObjectui64v                   gl3wProcs.gl.GetQueryBufferObjectui64v
+#define glGetQueryBufferObjectuiv                     gl3wProcs.gl.GetQueryBufferObjectuiv
+#define glGetQueryIndexediv                           gl3wProcs.gl.GetQueryIndexediv
+#define glGetQueryObjecti64v                          gl3wProcs.gl.GetQueryObjecti64v
+#define glGetQueryObjectiv                            gl3wProcs.gl.GetQueryObjectiv
+#define glGetQueryObjectui64v                         gl3wProcs.gl.GetQueryObjectui64v
+#define glGetQueryObjectuiv                           gl3wProcs.gl.GetQueryObjectuiv
+#define glGetQueryiv                                  gl3wProcs.gl.GetQueryiv
+#define glGetRenderbufferParameteriv                  gl3wProcs.gl.GetRenderbufferParameteriv
+#define glGetSamplerParameterIiv                      gl3wProcs.gl.GetSamplerParameterIiv
+#define glGetSamplerParameterIuiv                     gl3wProcs.gl.GetSamplerParameterIuiv
+#define glGetSamplerParameterfv                       gl3wProcs.gl.GetSamplerParameterfv
+#define glGetSamplerParameteriv                       gl3wProcs.gl.GetSamplerParameteriv
+#define glGetShaderInfoLog                            gl3wProcs.gl.GetShaderInfoLog
+#define glGetShaderPrecisionFormat                    gl3wProcs.gl.GetShaderPrecisionFormat
+#define glGetShaderSource                             gl3wProcs.gl.GetShaderSource
+#define glGetShaderiv                                 gl3wProcs.gl.GetShaderiv
+#define glGetString                                   gl3wProcs.gl.GetString
+#define glGetStringi                                  gl3wProcs.gl.GetStringi
+#define glGetSubroutineIndex                          gl3wProcs.gl.GetSubroutineIndex
+#define glGetSubroutineUniformLocation                gl3wProcs.gl.GetSubroutineUniformLocation
+#define glGetSynciv                                   gl3wProcs.gl.GetSynciv
+#define glGetTexImage                                 gl3wProcs.gl.GetTexImage
+#define glGetTexLevelParameterfv                      gl3wProcs.gl.GetTexLevelParameterfv
+#define glGetTexLevelParameteriv                      gl3wProcs.gl.GetTexLevelParameteriv
+#define glGetTexParameterIiv                          gl3wProcs.gl.GetTexParameterIiv
+#define glGetTexParameterIuiv                         gl3wProcs.gl.GetTexParameterIuiv
+#define glGetTexParameterfv                           gl3wProcs.gl.GetTexParameterfv
+#define glGetTexParameteriv                           gl3wProcs.gl.GetTexParameteriv
+#define glGetTextureHandleARB                         gl3wProcs.gl.GetTextureHandleARB
+#define glGetTextureImage                             gl3wProcs.gl.GetTextureImage
+#define glGetTextureLevelParameterfv                  gl3wProcs.gl.GetTextureLevelParameterfv
+#define glGetTextureLevelParameteriv                  gl3wProcs.gl.GetTextureLevelParameteriv
+#define glGetTextureParameterIiv                      gl3wProcs.gl.GetTextureParameterIiv
+#define glGetTextureParameterIuiv                     gl3wProcs.gl.GetTextureParameterIuiv
+#define glGetTextureParameterfv                       gl3wProcs.gl.GetTextureParameterfv
+#define glGetTextureParameteriv                       gl3wProcs.gl.GetTextureParameteriv
+#define glGetTextureSamplerHandleARB                  gl3wProcs.gl.GetTextureSamplerHandleARB
+#define glGetTextureSubImage                          gl3wProcs.gl.GetTextureSubImage
+#define glGetTransformFeedbackVarying                 gl3wProcs.gl.GetTransformFeedbackVarying
+#define glGetTransformFeedbacki64_v                   gl3wProcs.gl.GetTransformFeedbacki64_v
+#define glGetTransformFeedbacki_v                     gl3wProcs.gl.GetTransformFeedbacki_v
+#define glGetTransformFeedbackiv                      gl3wProcs.gl.GetTransformFeedbackiv
+#define glGetUniformBlockIndex                        gl3wProcs.gl.GetUniformBlockIndex
+#define glGetUniformIndices                           gl3wProcs.gl.GetUniformIndices
+#define glGetUniformLocation                          gl3wProcs.gl.GetUniformLocation
+#define glGetUniformSubroutineuiv                     gl3wProcs.gl.GetUniformSubroutineuiv
+#define glGetUniformdv                                gl3wProcs.gl.GetUniformdv
+#define glGetUniformfv                                gl3wProcs.gl.GetUniformfv
+#define glGetUniformiv                                gl3wProcs.gl.GetUniformiv
+#define glGetUniformuiv                               gl3wProcs.gl.GetUniformuiv
+#define glGetVertexArrayIndexed64iv                   gl3wProcs.gl.GetVertexArrayIndexed64iv
+#define glGetVertexArrayIndexediv                     gl3wProcs.gl.GetVertexArrayIndexediv
+#define glGetVertexArrayiv                            gl3wProcs.gl.GetVertexArrayiv
+#define glGetVertexAttribIiv                          gl3wProcs.gl.GetVertexAttribIiv
+#define glGetVertexAttribIuiv                         gl3wProcs.gl.GetVertexAttribIuiv
+#define glGetVertexAttribLdv                          gl3wProcs.gl.GetVertexAttribLdv
+#define glGetVertexAttribLui64vARB                    gl3wProcs.gl.GetVertexAttribLui64vARB
+#define glGetVertexAttribPointerv                     gl3wProcs.gl.GetVertexAttribPointerv
+#define glGetVertexAttribdv                           gl3wProcs.gl.GetVertexAttribdv
+#define glGetVertexAttribfv                           gl3wProcs.gl.GetVertexAttribfv
+#define glGetVertexAttribiv                           gl3wProcs.gl.GetVertexAttribiv
+#define glGetnCompressedTexImage                      gl3wProcs.gl.GetnCompressedTexImage
+#define glGetnCompressedTexImageARB                   gl3wProcs.gl.GetnCompressedTexImageARB
+#define glGetnTexImage                                gl3wProcs.gl.GetnTexImage
+#define glGetnTexImageARB                             gl3wProcs.gl.GetnTexImageARB
+#define glGetnUniformdv                               gl3wProcs.gl.GetnUniformdv
+#define glGetnUniformdvARB                            gl3wProcs.gl.GetnUniformdvARB
+#define glGetnUniformfv                               gl3wProcs.gl.GetnUniformfv
+#define glGetnUniformfvARB                            gl3wProcs.gl.GetnUniformfvARB
+#define glGetnUniformiv                               gl3wProcs.gl.GetnUniformiv
+#define glGetnUniformivARB                            gl3wProcs.gl.GetnUniformivARB
+#define glGetnUniformuiv                              gl3wProcs.gl.GetnUniformuiv
+#define glGetnUniformuivARB                           gl3wProcs.gl.GetnUniformuivARB
+#define glHint                                        gl3wProcs.gl.Hint
+#define glInvalidateBufferData                        gl3wProcs.gl.InvalidateBufferData
+#define glInvalidateBufferSubData                     gl3wProcs.gl.InvalidateBufferSubData
+#define glInvalidateFramebuffer                       gl3wProcs.gl.InvalidateFramebuffer
+#define glInvalidateNamedFramebufferData              gl3wProcs.gl.InvalidateNamedFramebufferData
+#define glInvalidateNamedFramebufferSubData           gl3wProcs.gl.InvalidateNamedFramebufferSubData
+#define glInvalidateSubFramebuffer                    gl3wProcs.gl.InvalidateSubFramebuffer
+#define glInvalidateTexImage                          gl3wProcs.gl.InvalidateTexImage
+#define glInvalidateTexSubImage                       gl3wProcs.gl.InvalidateTexSubImage
+#define glIsBuffer                                    gl3wProcs.gl.IsBuffer
+#define glIsEnabled                                   gl3wProcs.gl.IsEnabled
+#define glIsEnabledi                                  gl3wProcs.gl.IsEnabledi
+#define glIsFramebuffer                               gl3wProcs.gl.IsFramebuffer
+#define glIsImageHandleResidentARB                    gl3wProcs.gl.IsImageHandleResidentARB
+#define glIsNamedStringARB                            gl3wProcs.gl.IsNamedStringARB
+#define glIsProgram                                   gl3wProcs.gl.IsProgram
+#define glIsProgramPipeline                           gl3wProcs.gl.IsProgramPipeline
+#define glIsQuery                                     gl3wProcs.gl.IsQuery
+#define glIsRenderbuffer                              gl3wProcs.gl.IsRenderbuffer
+#define glIsSampler                                   gl3wProcs.gl.IsSampler
+#define glIsShader                                    gl3wProcs.gl.IsShader
+#define glIsSync                                      gl3wProcs.gl.IsSync
+#define glIsTexture                                   gl3wProcs.gl.IsTexture
+#define glIsTextureHandleResidentARB                  gl3wProcs.gl.IsTextureHandleResidentARB
+#define glIsTransformFeedback                         gl3wProcs.gl.IsTransformFeedback
+#define glIsVertexArray                               gl3wProcs.gl.IsVertexArray
+#define glLineWidth                                   gl3wProcs.gl.LineWidth
+#define glLinkProgram                                 gl3wProcs.gl.LinkProgram
+#define glLogicOp                                     gl3wProcs.gl.LogicOp
+#define glMakeImageHandleNonResidentARB               gl3wProcs.gl.MakeImageHandleNonResidentARB
+#define glMakeImageHandleResidentARB                  gl3wProcs.gl.MakeImageHandleResidentARB
+#define glMakeTextureHandleNonResidentARB             gl3wProcs.gl.MakeTextureHandleNonResidentARB
+#define glMakeTextureHandleResidentARB                gl3wProcs.gl.MakeTextureHandleResidentARB
+#define glMapBuffer                                   gl3wProcs.gl.MapBuffer
+#define glMapBufferRange                              gl3wProcs.gl.MapBufferRange
+#define glMapNamedBuffer                              gl3wProcs.gl.MapNamedBuffer
+#define glMapNamedBufferRange                         gl3wProcs.gl.MapNamedBufferRange
+#define glMemoryBarrier                               gl3wProcs.gl.MemoryBarrier
+#define glMemoryBarrierByRegion                       gl3wProcs.gl.MemoryBarrierByRegion
+#define glMinSampleShading                            gl3wProcs.gl.MinSampleShading
+#define glMinSampleShadingARB                         gl3wProcs.gl.MinSampleShadingARB
+#define glMultiDrawArrays                             gl3wProcs.gl.MultiDrawArrays
+#define glMultiDrawArraysIndirect                     gl3wProcs.gl.MultiDrawArraysIndirect
+#define glMultiDrawArraysIndirectCountARB             gl3wProcs.gl.MultiDrawArraysIndirectCountARB
+#define glMultiDrawElements                           gl3wProcs.gl.MultiDrawElements
+#define glMultiDrawElementsBaseVertex                 gl3wProcs.gl.MultiDrawElementsBaseVertex
+#define glMultiDrawElementsIndirect                   gl3wProcs.gl.MultiDrawElementsIndirect
+#define glMultiDrawElementsIndirectCountARB           gl3wProcs.gl.MultiDrawElementsIndirectCountARB
+#define glNamedBufferData                             gl3wProcs.gl.NamedBufferData
+#define glNamedBufferPageCommitmentARB                gl3wProcs.gl.NamedBufferPageCommitmentARB
+#define glNamedBufferPageCommitmentEXT                gl3wProcs.gl.NamedBufferPageCommitmentEXT
+#define glNamedBufferStorage                          gl3wProcs.gl.NamedBufferStorage
+#define glNamedBufferSubData                          gl3wProcs.gl.NamedBufferSubData
+#define glNamedFramebufferDrawBuffer                  gl3wProcs.gl.NamedFramebufferDrawBuffer
+#define glNamedFramebufferDrawBuffers                 gl3wProcs.gl.NamedFramebufferDrawBuffers
+#define glNamedFramebufferParameteri                  gl3wProcs.gl.NamedFramebufferParameteri
+#define glNamedFramebufferReadBuffer                  gl3wProcs.gl.NamedFramebufferReadBuffer
+#define glNamedFramebufferRenderbuffer                gl3wProcs.gl.NamedFramebufferRenderbuffer
+#define glNamedFramebufferTexture                     gl3wProcs.gl.NamedFramebufferTexture
+#define glNamedFramebufferTextureLayer                gl3wProcs.gl.NamedFramebufferTextureLayer
+#define glNamedRenderbufferStorage                    gl3wProcs.gl.NamedRenderbufferStorage
+#define glNamedRenderbufferStorageMultisample         gl3wProcs.gl.NamedRenderbufferStorageMultisample
+#define glNamedStringARB                              gl3wProcs.gl.NamedStringARB
+#define glObjectLabel                                 gl3wProcs.gl.ObjectLabel
+#define glObjectPtrLabel                              gl3wProcs.gl.ObjectPtrLabel
+#define glPatchParameterfv                            gl3wProcs.gl.PatchParameterfv
+#define glPatchParameteri                             gl3wProcs.gl.PatchParameteri
+#define glPauseTransformFeedback                      gl3wProcs.gl.PauseTransformFeedback
+#define glPixelStoref                                 gl3wProcs.gl.PixelStoref
+#define glPixelStorei                                 gl3wProcs.gl.PixelStorei
+#define glPointParameterf                             gl3wProcs.gl.PointParameterf
+#define glPointParameterfv                            gl3wProcs.gl.PointParameterfv
+#define glPointParameteri                             gl3wProcs.gl.PointParameteri
+#define glPointParameteriv                            gl3wProcs.gl.PointParameteriv
+#define glPointSize                                   gl3wProcs.gl.PointSize
+#define glPolygonMode                                 gl3wProcs.gl.PolygonMode
+#define glPolygonOffset                               gl3wProcs.gl.PolygonOffset
+#define glPopDebugGroup                               gl3wProcs.gl.PopDebugGroup
+#define glPrimitiveRestartIndex                       gl3wProcs.gl.PrimitiveRestartIndex
+#define glProgramBinary                               gl3wProcs.gl.ProgramBinary
+#define glProgramParameteri                           gl3wProcs.gl.ProgramParameteri
+#define glProgramUniform1d                            gl3wProcs.gl.ProgramUniform1d
+#define glProgramUniform1dv                           gl3wProcs.gl.ProgramUniform1dv
+#define glProgramUniform1f                            gl3wProcs.gl.ProgramUniform1f
+#define glProgramUniform1fv                           gl3wProcs.gl.ProgramUniform1fv
+#define glProgramUniform1i                            gl3wProcs.gl.ProgramUniform1i
+#define glProgramUniform1iv                           gl3wProcs.gl.ProgramUniform1iv
+#define glProgramUniform1ui                           gl3wProcs.gl.ProgramUniform1ui
+#define glProgramUniform1uiv                          gl3wProcs.gl.ProgramUniform1uiv
+#define glProgramUniform2d                            gl3wProcs.gl.ProgramUniform2d
+#define glProgramUniform2dv                           gl3wProcs.gl.ProgramUniform2dv
+#define glProgramUniform2f                            gl3wProcs.gl.ProgramUniform2f
+#define glProgramUniform2fv                           gl3wProcs.gl.ProgramUniform2fv
+#define glProgramUniform2i                            gl3wProcs.gl.ProgramUniform2i
+#define glProgramUniform2iv                           gl3wProcs.gl.ProgramUniform2iv
+#define glProgramUniform2ui                           gl3wProcs.gl.ProgramUniform2ui
+#define glProgramUniform2uiv                          gl3wProcs.gl.ProgramUniform2uiv
+#define glProgramUniform3d                            gl3wProcs.gl.ProgramUniform3d
+#define glProgramUniform3dv                           gl3wProcs.gl.ProgramUniform3dv
+#define glProgramUniform3f                            gl3wProcs.gl.ProgramUniform3f
+#define glProgramUniform3fv                           gl3wProcs.gl.ProgramUniform3fv
+#define glProgramUniform3i                            gl3wProcs.gl.ProgramUniform3i
+#define glProgramUniform3iv                           gl3wProcs.gl.ProgramUniform3iv
+#define glProgramUniform3ui                           gl3wProcs.gl.ProgramUniform3ui
+#define glProgramUniform3uiv                          gl3wProcs.gl.ProgramUniform3uiv
+#define glProgramUniform4d                            gl3wProcs.gl.ProgramUniform4d
+#define glProgramUniform4dv                           gl3wProcs.gl.ProgramUniform4dv
+#define glProgramUniform4f                            gl3wProcs.gl.ProgramUniform4f
+#define glProgramUniform4fv                           gl3wProcs.gl.ProgramUniform4fv
+#define glProgramUniform4i                            gl3wProcs.gl.ProgramUniform4i
+#define glProgramUniform4iv                           gl3wProcs.gl.ProgramUniform4iv
+#define glProgramUniform4ui                           gl3wProcs.gl.ProgramUniform4ui
+#define glProgramUniform4uiv                          gl3wProcs.gl.ProgramUniform4uiv
+#define glProgramUniformHandleui64ARB                 gl3wProcs.gl.ProgramUniformHandleui64ARB
+#define glProgramUniformHandleui64vARB                gl3wProcs.gl.ProgramUniformHandleui64vARB
+#define glProgramUniformMatrix2dv                     gl3wProcs.gl.ProgramUniformMatrix2dv
+#define glProgramUniformMatrix2fv                     gl3wProcs.gl.ProgramUniformMatrix2fv
+#define glProgramUniformMatrix2x3dv                   gl3wProcs.gl.ProgramUniformMatrix2x3dv
+#define glProgramUniformMatrix2x3fv                   gl3wProcs.gl.ProgramUniformMatrix2x3fv
+#define glProgramUniformMatrix2x4dv                   gl3wProcs.gl.ProgramUniformMatrix2x4dv
+#define glProgramUniformMatrix2x4fv                   gl3wProcs.gl.ProgramUniformMatrix2x4fv
+#define glProgramUniformMatrix3dv                     gl3wProcs.gl.ProgramUniformMatrix3dv
+#define glProgramUniformMatrix3fv                     gl3wProcs.gl.ProgramUniformMatrix3fv
+#define glProgramUniformMatrix3x2dv                   gl3wProcs.gl.ProgramUniformMatrix3x2dv
+#define glProgramUniformMatrix3x2fv                   gl3wProcs.gl.ProgramUniformMatrix3x2fv
+#define glProgramUniformMatrix3x4dv                   gl3wProcs.gl.ProgramUniformMatrix3x4dv
+#define glProgramUniformMatrix3x4fv                   gl3wProcs.gl.ProgramUniformMatrix3x4fv
+#define glProgramUniformMatrix4dv                     gl3wProcs.gl.ProgramUniformMatrix4dv
+#define glProgramUniformMatrix4fv                     gl3wProcs.gl.ProgramUniformMatrix4fv
+#define glProgramUniformMatrix4x2dv                   gl3wProcs.gl.ProgramUniformMatrix4x2dv
+#define glProgramUniformMatrix4x2fv                   gl3wProcs.gl.ProgramUniformMatrix4x2fv
+#define glProgramUniformMatrix4x3dv                   gl3wProcs.gl.ProgramUniformMatrix4x3dv
+#define glProgramUniformMatrix4x3fv                   gl3wProcs.gl.ProgramUniformMatrix4x3fv
+#define glProvokingVertex                             gl3wProcs.gl.ProvokingVertex
+#define glPushDebugGroup                              gl3wProcs.gl.PushDebugGroup
+#define glQueryCounter                                gl3wProcs.gl.QueryCounter
+#define glReadBuffer                                  gl3wProcs.gl.ReadBuffer
+#define glReadPixels                                  gl3wProcs.gl.ReadPixels
+#define glReadnPixels                                 gl3wProcs.gl.ReadnPixels
+#define glReadnPixelsARB                              gl3wProcs.gl.ReadnPixelsARB
+#define glReleaseShaderCompiler                       gl3wProcs.gl.ReleaseShaderCompiler
+#define glRenderbufferStorage                         gl3wProcs.gl.RenderbufferStorage
+#define glRenderbufferStorageMultisample              gl3wProcs.gl.RenderbufferStorageMultisample
+#define glResumeTransformFeedback                     gl3wProcs.gl.ResumeTransformFeedback
+#define glSampleCoverage                              gl3wProcs.gl.SampleCoverage
+#define glSampleMaski                                 gl3wProcs.gl.SampleMaski
+#define glSamplerParameterIiv                         gl3wProcs.gl.SamplerParameterIiv
+#define glSamplerParameterIuiv                        gl3wProcs.gl.SamplerParameterIuiv
+#define glSamplerParameterf                           gl3wProcs.gl.SamplerParameterf
+#define glSamplerParameterfv                          gl3wProcs.gl.SamplerParameterfv
+#define glSamplerParameteri                           gl3wProcs.gl.SamplerParameteri
+#define glSamplerParameteriv                          gl3wProcs.gl.SamplerParameteriv
+#define glScissor                                     gl3wProcs.gl.Scissor
+#define glScissorArrayv                               gl3wProcs.gl.ScissorArrayv
+#define glScissorIndexed                              gl3wProcs.gl.ScissorIndexed
+#define glScissorIndexedv                             gl3wProcs.gl.ScissorIndexedv
+#define glShaderBinary                                gl3wProcs.gl.ShaderBinary
+#define glShaderSource                                gl3wProcs.gl.ShaderSource
+#define glShaderStorageBlockBinding                   gl3wProcs.gl.ShaderStorageBlockBinding
+#define glStencilFunc                                 gl3wProcs.gl.StencilFunc
+#define glStencilFuncSeparate                         gl3wProcs.gl.StencilFuncSeparate
+#define glStencilMask                                 gl3wProcs.gl.StencilMask
+#define glStencilMaskSeparate                         gl3wProcs.gl.StencilMaskSeparate
+#define glStencilOp                                   gl3wProcs.gl.StencilOp
+#define glStencilOpSeparate                           gl3wProcs.gl.StencilOpSeparate
+#define glTexBuffer                                   gl3wProcs.gl.TexBuffer
+#define glTexBufferRange                              gl3wProcs.gl.TexBufferRange
+#define glTexImage1D                                  gl3wProcs.gl.TexImage1D
+#define glTexImage2D                                  gl3wProcs.gl.TexImage2D
+#define glTexImage2DMultisample                       gl3wProcs.gl.TexImage2DMultisample
+#define glTexImage3D                                  gl3wProcs.gl.TexImage3D
+#define glTexImage3DMultisample                       gl3wProcs.gl.TexImage3DMultisample
+#define glTexPageCommitmentARB                        gl3wProcs.gl.TexPageCommitmentARB
+#define glTexParameterIiv                             gl3wProcs.gl.TexParameterIiv
+#define glTexParameterIuiv                            gl3wProcs.gl.TexParameterIuiv
+#define glTexParameterf                               gl3wProcs.gl.TexParameterf
+#define glTexParameterfv                              gl3wProcs.gl.TexParameterfv
+#define glTexParameteri                               gl3wProcs.gl.TexParameteri
+#define glTexParameteriv                              gl3wProcs.gl.TexParameteriv
+#define glTexStorage1D                                gl3wProcs.gl.TexStorage1D
+#define glTexStorage2D                                gl3wProcs.gl.TexStorage2D
+#define glTexStorage2DMultisample                     gl3wProcs.gl.TexStorage2DMultisample
+#define glTexStorage3D                                gl3wProcs.gl.TexStorage3D
+#define glTexStorage3DMultisample                     gl3wProcs.gl.TexStorage3DMultisample
+#define glTexSubImage1D                               gl3wProcs.gl.TexSubImage1D
+#define glTexSubImage2D                               gl3wProcs.gl.TexSubImage2D
+#define glTexSubImage3D                               gl3wProcs.gl.TexSubImage3D
+#define glTextureBarrier                              gl3wProcs.gl.TextureBarrier
+#define glTextureBuffer                               gl3wProcs.gl.TextureBuffer
+#define glTextureBufferRange                          gl3wProcs.gl.TextureBufferRange
+#define glTextureParameterIiv                         gl3wProcs.gl.TextureParameterIiv
+#define glTextureParameterIuiv                        gl3wProcs.gl.TextureParameterIuiv
+#define glTextureParameterf                           gl3wProcs.gl.TextureParameterf
+#define glTextureParameterfv                          gl3wProcs.gl.TextureParameterfv
+#define glTextureParameteri                           gl3wProcs.gl.TextureParameteri
+#define glTextureParameteriv                          gl3wProcs.gl.TextureParameteriv
+#define glTextureStorage1D                            gl3wProcs.gl.TextureStorage1D
+#define glTextureStorage2D                            gl3wProcs.gl.TextureStorage2D
+#define glTextureStorage2DMultisample                 gl3wProcs.gl.TextureStorage2DMultisample
+#define glTextureStorage3D                            gl3wProcs.gl.TextureStorage3D
+#define glTextureStorage3DMultisample                 gl3wProcs.gl.TextureStorage3DMultisample
+#define glTextureSubImage1D                           gl3wProcs.gl.TextureSubImage1D
+#define glTextureSubImage2D                           gl3wProcs.gl.TextureSubImage2D
+#define glTextureSubImage3D                           gl3wProcs.gl.TextureSubImage3D
+#define glTextureView                                 gl3wProcs.gl.TextureView
+#define glTransformFeedbackBufferBase                 gl3wProcs.gl.TransformFeedbackBufferBase
+#define glTransformFeedbackBufferRange                gl3wProcs.gl.TransformFeedbackBufferRange
+#define glTransformFeedbackVaryings                   gl3wProcs.gl.TransformFeedbackVaryings
+#define glUniform1d                                   gl3wProcs.gl.Uniform1d
+#define glUniform1dv                                  gl3wProcs.gl.Uniform1dv
+#define glUniform1f                                   gl3wProcs.gl.Uniform1f
+#define glUniform1fv                                  gl3wProcs.gl.Uniform1fv
+#define glUniform1i                                   gl3wProcs.gl.Uniform1i
+#define glUniform1iv                                  gl3wProcs.gl.Uniform1iv
+#define glUniform1ui                                  gl3wProcs.gl.Uniform1ui
+#define glUniform1uiv                                 gl3wProcs.gl.Uniform1uiv
+#define glUniform2d                                   gl3wProcs.gl.Uniform2d
+#define glUniform2dv                                  gl3wProcs.gl.Uniform2dv
+#define glUniform2f                                   gl3wProcs.gl.Uniform2f
+#define glUniform2fv                                  gl3wProcs.gl.Uniform2fv
+#define glUniform2i                                   gl3wProcs.gl.Uniform2i
+#define glUniform2iv                                  gl3wProcs.gl.Uniform2iv
+#define glUniform2ui                                  gl3wProcs.gl.Uniform2ui
+#define glUniform2uiv                                 gl3wProcs.gl.Uniform2uiv
+#define glUniform3d                                   gl3wProcs.gl.Uniform3d
+#define glUniform3dv                                  gl3wProcs.gl.Uniform3dv
+#define glUniform3f                                   gl3wProcs.gl.Uniform3f
+#define glUniform3fv                                  gl3wProcs.gl.Uniform3fv
+#define glUniform3i                                   gl3wProcs.gl.Uniform3i
+#define glUniform3iv                                  gl3wProcs.gl.Uniform3iv
+#define glUniform3ui                                  gl3wProcs.gl.Uniform3ui
+#define glUniform3uiv                                 gl3wProcs.gl.Uniform3uiv
+#define glUniform4d                                   gl3wProcs.gl.Uniform4d
+#define glUniform4dv                                  gl3wProcs.gl.Uniform4dv
+#define glUniform4f                                   gl3wProcs.gl.Uniform4f
+#define glUniform4fv                                  gl3wProcs.gl.Uniform4fv
+#define glUniform4i                                   gl3wProcs.gl.Uniform4i
+#define glUniform4iv                                  gl3wProcs.gl.Uniform4iv
+#define glUniform4ui                                  gl3wProcs.gl.Uniform4ui
+#define glUniform4uiv                                 gl3wProcs.gl.Uniform4uiv
+#define glUniformBlockBinding                         gl3wProcs.gl.UniformBlockBinding
+#define glUniformHandleui64ARB                        gl3wProcs.gl.UniformHandleui64ARB
+#define glUniformHandleui64vARB                       gl3wProcs.gl.UniformHandleui64vARB
+#define glUniformMatrix2dv                            gl3wProcs.gl.UniformMatrix2dv
+#define glUniformMatrix2fv                            gl3wProcs.gl.UniformMatrix2fv
+#define glUniformMatrix2x3dv                          gl3wProcs.gl.UniformMatrix2x3dv
+#define glUniformMatrix2x3fv                          gl3wProcs.gl.UniformMatrix2x3fv
+#define glUniformMatrix2x4dv                          gl3wProcs.gl.UniformMatrix2x4dv
+#define glUniformMatrix2x4fv                          gl3wProcs.gl.UniformMatrix2x4fv
+#define glUniformMatrix3dv                            gl3wProcs.gl.UniformMatrix3dv
+#define glUniformMatrix3fv                            gl3wProcs.gl.UniformMatrix3fv
+#define glUniformMatrix3x2dv                          gl3wProcs.gl.UniformMatrix3x2dv
+#define glUniformMatrix3x2fv                          gl3wProcs.gl.UniformMatrix3x2fv
+#define glUniformMatrix3x4dv                          gl3wProcs.gl.UniformMatrix3x4dv
+#define glUniformMatrix3x4fv                          gl3wProcs.gl.UniformMatrix3x4fv
+#define glUniformMatrix4dv                            gl3wProcs.gl.UniformMatrix4dv
+#define glUniformMatrix4fv                            gl3wProcs.gl.UniformMatrix4fv
+#define glUniformMatrix4x2dv                          gl3wProcs.gl.UniformMatrix4x2dv
+#define glUniformMatrix4x2fv                          gl3wProcs.gl.UniformMatrix4x2fv
+#define glUniformMatrix4x3dv                          gl3wProcs.gl.UniformMatrix4x3dv
+#define glUniformMatrix4x3fv                          gl3wProcs.gl.UniformMatrix4x3fv
+#define glUniformSubroutinesuiv                       gl3wProcs.gl.UniformSubroutinesuiv
+#define glUnmapBuffer                                 gl3wProcs.gl.UnmapBuffer
+#define glUnmapNamedBuffer                            gl3wProcs.gl.UnmapNamedBuffer
+#define glUseProgram                                  gl3wProcs.gl.UseProgram
+#define glUseProgramStages                            gl3wProcs.gl.UseProgramStages
+#define glValidateProgram                             gl3wProcs.gl.ValidateProgram
+#define glValidateProgramPipeline                     gl3wProcs.gl.ValidateProgramPipeline
+#define glVertexArrayAttribBinding                    gl3wProcs.gl.VertexArrayAttribBinding
+#define glVertexArrayAttribFormat                     gl3wProcs.gl.VertexArrayAttribFormat
+#define glVertexArrayAttribIFormat                    gl3wProcs.gl.VertexArrayAttribIFormat
+#define glVertexArrayAttribLFormat                    gl3wProcs.gl.VertexArrayAttribLFormat
+#define glVertexArrayBindingDivisor                   gl3wProcs.gl.VertexArrayBindingDivisor
+#define glVertexArrayElementBuffer                    gl3wProcs.gl.VertexArrayElementBuffer
+#define glVertexArrayVertexBuffer                     gl3wProcs.gl.VertexArrayVertexBuffer
+#define glVertexArrayVertexBuffers                    gl3wProcs.gl.VertexArrayVertexBuffers
+#define glVertexAttrib1d                              gl3wProcs.gl.VertexAttrib1d
+#define glVertexAttrib1dv                             gl3wProcs.gl.VertexAttrib1dv
+#define glVertexAttrib1f                              gl3wProcs.gl.VertexAttrib1f
+#define glVertexAttrib1fv                             gl3wProcs.gl.VertexAttrib1fv
+#define glVertexAttrib1s                              gl3wProcs.gl.VertexAttrib1s
+#define glVertexAttrib1sv                             gl3wProcs.gl.VertexAttrib1sv
+#define glVertexAttrib2d                              gl3wProcs.gl.VertexAttrib2d
+#define glVertexAttrib2dv                             gl3wProcs.gl.VertexAttrib2dv
+#define glVertexAttrib2f                              gl3wProcs.gl.VertexAttrib2f
+#define glVertexAttrib2fv                             gl3wProcs.gl.VertexAttrib2fv
+#define glVertexAttrib2s                              gl3wProcs.gl.VertexAttrib2s
+#define glVertexAttrib2sv                             gl3wProcs.gl.VertexAttrib2sv
+#define glVertexAttrib3d                              gl3wProcs.gl.VertexAttrib3d
+#define glVertexAttrib3dv                             gl3wProcs.gl.VertexAttrib3dv
+#define glVertexAttrib3f                              gl3wProcs.gl.VertexAttrib3f
+#define glVertexAttrib3fv                             gl3wProcs.gl.VertexAttrib3fv
+#define glVertexAttrib3s                              gl3wProcs.gl.VertexAttrib3s
+#define glVertexAttrib3sv                             gl3wProcs.gl.VertexAttrib3sv
+#define glVertexAttrib4Nbv                            gl3wProcs.gl.VertexAttrib4Nbv
+#define glVertexAttrib4Niv                            gl3wProcs.gl.VertexAttrib4Niv
+#define glVertexAttrib4Nsv                            gl3wProcs.gl.VertexAttrib4Nsv
+#define glVertexAttrib4Nub                            gl3wProcs.gl.VertexAttrib4Nub
+#define glVertexAttrib4Nubv                           gl3wProcs.gl.VertexAttrib4Nubv
+#define glVertexAttrib4Nuiv                           gl3wProcs.gl.VertexAttrib4Nuiv
+#define glVertexAttrib4Nusv                           gl3wProcs.gl.VertexAttrib4Nusv
+#define glVertexAttrib4bv                             gl3wProcs.gl.VertexAttrib4bv
+#define glVertexAttrib4d                              gl3wProcs.gl.VertexAttrib4d
+#define glVertexAttrib4dv                             gl3wProcs.gl.VertexAttrib4dv
+#define glVertexAttrib4f                              gl3wProcs.gl.VertexAttrib4f
+#define glVertexAttrib4fv                             gl3wProcs.gl.VertexAttrib4fv
+#define glVertexAttrib4iv                             gl3wProcs.gl.VertexAttrib4iv
+#define glVertexAttrib4s                              gl3wProcs.gl.VertexAttrib4s
+#define glVertexAttrib4sv                             gl3wProcs.gl.VertexAttrib4sv
+#define glVertexAttrib4ubv                            gl3wProcs.gl.VertexAttrib4ubv
+#define glVertexAttrib4uiv                            gl3wProcs.gl.VertexAttrib4uiv
+#define glVertexAttrib4usv                            gl3wProcs.gl.VertexAttrib4usv
+#define glVertexAttribBinding                         gl3wProcs.gl.VertexAttribBinding
+#define glVertexAttribDivisor                         gl3wProcs.gl.VertexAttribDivisor
+#define glVertexAttribFormat                          gl3wProcs.gl.VertexAttribFormat
+#define glVertexAttribI1i                             gl3wProcs.gl.VertexAttribI1i
+#define glVertexAttribI1iv                            gl3wProcs.gl.VertexAttribI1iv
+#define glVertexAttribI1ui                            gl3wProcs.gl.VertexAttribI1ui
+#define glVertexAttribI1uiv                           gl3wProcs.gl.VertexAttribI1uiv
+#define glVertexAttribI2i                             gl3wProcs.gl.VertexAttribI2i
+#define glVertexAttribI2iv                            gl3wProcs.gl.VertexAttribI2iv
+#define glVertexAttribI2ui                            gl3wProcs.gl.VertexAttribI2ui
+#define glVertexAttribI2uiv                           gl3wProcs.gl.VertexAttribI2uiv
+#define glVertexAttribI3i                             gl3wProcs.gl.VertexAttribI3i
+#define glVertexAttribI3iv                            gl3wProcs.gl.VertexAttribI3iv
+#define glVertexAttribI3ui                            gl3wProcs.gl.VertexAttribI3ui
+#define glVertexAttribI3uiv                           gl3wProcs.gl.VertexAttribI3uiv
+#define glVertexAttribI4bv                            gl3wProcs.gl.VertexAttribI4bv
+#define glVertexAttribI4i                             gl3wProcs.gl.VertexAttribI4i
+#define glVertexAttribI4iv                            gl3wProcs.gl.VertexAttribI4iv
+#define glVertexAttribI4sv                            gl3wProcs.gl.VertexAttribI4sv
+#define glVertexAttribI4ubv                           gl3wProcs.gl.VertexAttribI4ubv
+#define glVertexAttribI4ui                            gl3wProcs.gl.VertexAttribI4ui
+#define glVertexAttribI4uiv                           gl3wProcs.gl.VertexAttribI4uiv
+#define glVertexAttribI4usv                           gl3wProcs.gl.VertexAttribI4usv
+#define glVertexAttribIFormat                         gl3wProcs.gl.VertexAttribIFormat
+#define glVertexAttribIPointer                        gl3wProcs.gl.VertexAttribIPointer
+#define glVertexAttribL1d                             gl3wProcs.gl.VertexAttribL1d
+#define glVertexAttribL1dv                            gl3wProcs.gl.VertexAttribL1dv
+#define glVertexAttribL1ui64ARB                       gl3wProcs.gl.VertexAttribL1ui64ARB
+#define glVertexAttribL1ui64vARB                      gl3wProcs.gl.VertexAttribL1ui64vARB
+#define glVertexAttribL2d                             gl3wProcs.gl.VertexAttribL2d
+#define glVertexAttribL2dv                            gl3wProcs.gl.VertexAttribL2dv
+#define glVertexAttribL3d                             gl3wProcs.gl.VertexAttribL3d
+#define glVertexAttribL3dv                            gl3wProcs.gl.VertexAttribL3dv
+#define glVertexAttribL4d                             gl3wProcs.gl.VertexAttribL4d
+#define glVertexAttribL4dv                            gl3wProcs.gl.VertexAttribL4dv
+#define glVertexAttribLFormat                         gl3wProcs.gl.VertexAttribLFormat
+#define glVertexAttribLPointer                        gl3wProcs.gl.VertexAttribLPointer
+#define glVertexAttribP1ui                            gl3wProcs.gl.VertexAttribP1ui
+#define glVertexAttribP1uiv                           gl3wProcs.gl.VertexAttribP1uiv
+#define glVertexAttribP2ui                            gl3wProcs.gl.VertexAttribP2ui
+#define glVertexAttribP2uiv                           gl3wProcs.gl.VertexAttribP2uiv
+#define glVertexAttribP3ui                            gl3wProcs.gl.VertexAttribP3ui
+#define glVertexAttribP3uiv                           gl3wProcs.gl.VertexAttribP3uiv
+#define glVertexAttribP4ui                            gl3wProcs.gl.VertexAttribP4ui
+#define glVertexAttribP4uiv                           gl3wProcs.gl.VertexAttribP4uiv
+#define glVertexAttribPointer                         gl3wProcs.gl.VertexAttribPointer
+#define glVertexBindingDivisor                        gl3wProcs.gl.VertexBindingDivisor
+#define glViewport                                    gl3wProcs.gl.Viewport
+#define glViewportArrayv                              gl3wProcs.gl.ViewportArrayv
+#define glViewportIndexedf                            gl3wProcs.gl.ViewportIndexedf
+#define glViewportIndexedfv                           gl3wProcs.gl.ViewportIndexedfv
+#define glWaitSync                                    gl3wProcs.gl.WaitSync
 
 #ifdef __cplusplus
 }
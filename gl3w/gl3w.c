@@ -28,7 +28,16 @@
 
 */
 
+#if !defined(_WIN32) && !defined(__APPLE__) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
 #include <GL/gl3w.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ARRAY_SIZE(x)  (sizeof(x) / sizeof((x)[0]))
 
 #ifdef _WIN32
 #define WIN32_LEAN_AND_MEAN 1
@@ -55,6 +64,15 @@ static GL3WglProc get_proc(const char *proc)
 		res = (GL3WglProc) GetProcAddress(libgl, proc);
 	return res;
 }
+
+static double now(void)
+{
+	LARGE_INTEGER count, freq;
+
+	QueryPerformanceCounter(&count);
+	QueryPerformanceFrequency(&freq);
+	return (double) count.QuadPart / freq.QuadPart;
+}
 #elif defined(__APPLE__) || defined(__APPLE_CC__)
 #include <Carbon/Carbon.h>
 
@@ -87,8 +105,14 @@ static GL3WglProc get_proc(const char *proc)
 	CFRelease(procname);
 	return res;
 }
+
+static double now(void)
+{
+	return CFAbsoluteTimeGetCurrent();
+}
 #else
 #include <dlfcn.h>
+#include <time.h>
 #include <GL/glx.h>
 
 static void *libgl;
@@ -112,6 +136,14 @@ static GL3WglProc get_proc(const char *proc)
 		res = (GL3WglProc) dlsym(libgl, proc);
 	return res;
 }
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
 #endif
 
 static struct {
@@ -132,13 +164,21 @@ static int parse_version(void)
 }
 
 static void load_procs(void);
+static void load_extensions(void);
 
+/* The library stays open for gl3wGetProcAddress() after init. */
 int gl3wInit(void)
 {
-	open_libgl();
+	gl3wTrace(GL3W_TRACE_OFF);
+	if (!libgl) {
+		open_libgl();
+		atexit(close_libgl);
+	}
 	load_procs();
-	close_libgl();
-	return parse_version();
+	if (parse_version())
+		return -1;
+	load_extensions();
+	return 0;
 }
 
 int gl3wIsSupported(int major, int minor)
@@ -150,1412 +190,13473 @@ int gl3wIsSupported(int major, int minor)
 	return version.major >= major;
 }
 
+static const char *const proc_names[] = {
+	"glActiveShaderProgram",
+	"glActiveTexture",
+	"glAttachShader",
+	"glBeginConditionalRender",
+	"glBeginQuery",
+	"glBeginQueryIndexed",
+	"glBeginTransformFeedback",
+	"glBindAttribLocation",
+	"glBindBuffer",
+	"glBindBufferBase",
+	"glBindBufferRange",
+	"glBindBuffersBase",
+	"glBindBuffersRange",
+	"glBindFragDataLocation",
+	"glBindFragDataLocationIndexed",
+	"glBindFramebuffer",
+	"glBindImageTexture",
+	"glBindImageTextures",
+	"glBindProgramPipeline",
+	"glBindRenderbuffer",
+	"glBindSampler",
+	"glBindSamplers",
+	"glBindTexture",
+	"glBindTextureUnit",
+	"glBindTextures",
+	"glBindTransformFeedback",
+	"glBindVertexArray",
+	"glBindVertexBuffer",
+	"glBindVertexBuffers",
+	"glBlendColor",
+	"glBlendEquation",
+	"glBlendEquationSeparate",
+	"glBlendEquationSeparatei",
+	"glBlendEquationSeparateiARB",
+	"glBlendEquationi",
+	"glBlendEquationiARB",
+	"glBlendFunc",
+	"glBlendFuncSeparate",
+	"glBlendFuncSeparatei",
+	"glBlendFuncSeparateiARB",
+	"glBlendFunci",
+	"glBlendFunciARB",
+	"glBlitFramebuffer",
+	"glBlitNamedFramebuffer",
+	"glBufferData",
+	"glBufferPageCommitmentARB",
+	"glBufferStorage",
+	"glBufferSubData",
+	"glCheckFramebufferStatus",
+	"glCheckNamedFramebufferStatus",
+	"glClampColor",
+	"glClear",
+	"glClearBufferData",
+	"glClearBufferSubData",
+	"glClearBufferfi",
+	"glClearBufferfv",
+	"glClearBufferiv",
+	"glClearBufferuiv",
+	"glClearColor",
+	"glClearDepth",
+	"glClearDepthf",
+	"glClearNamedBufferData",
+	"glClearNamedBufferSubData",
+	"glClearNamedFramebufferfi",
+	"glClearNamedFramebufferfv",
+	"glClearNamedFramebufferiv",
+	"glClearNamedFramebufferuiv",
+	"glClearStencil",
+	"glClearTexImage",
+	"glClearTexSubImage",
+	"glClientWaitSync",
+	"glClipControl",
+	"glColorMask",
+	"glColorMaski",
+	"glCompileShader",
+	"glCompileShaderIncludeARB",
+	"glCompressedTexImage1D",
+	"glCompressedTexImage2D",
+	"glCompressedTexImage3D",
+	"glCompressedTexSubImage1D",
+	"glCompressedTexSubImage2D",
+	"glCompressedTexSubImage3D",
+	"glCompressedTextureSubImage1D",
+	"glCompressedTextureSubImage2D",
+	"glCompressedTextureSubImage3D",
+	"glCopyBufferSubData",
+	"glCopyImageSubData",
+	"glCopyNamedBufferSubData",
+	"glCopyTexImage1D",
+	"glCopyTexImage2D",
+	"glCopyTexSubImage1D",
+	"glCopyTexSubImage2D",
+	"glCopyTexSubImage3D",
+	"glCopyTextureSubImage1D",
+	"glCopyTextureSubImage2D",
+	"glCopyTextureSubImage3D",
+	"glCreateBuffers",
+	"glCreateFramebuffers",
+	"glCreateProgram",
+	"glCreateProgramPipelines",
+	"glCreateQueries",
+	"glCreateRenderbuffers",
+	"glCreateSamplers",
+	"glCreateShader",
+	"glCreateShaderProgramv",
+	"glCreateSyncFromCLeventARB",
+	"glCreateTextures",
+	"glCreateTransformFeedbacks",
+	"glCreateVertexArrays",
+	"glCullFace",
+	"glDebugMessageCallback",
+	"glDebugMessageCallbackARB",
+	"glDebugMessageControl",
+	"glDebugMessageControlARB",
+	"glDebugMessageInsert",
+	"glDebugMessageInsertARB",
+	"glDeleteBuffers",
+	"glDeleteFramebuffers",
+	"glDeleteNamedStringARB",
+	"glDeleteProgram",
+	"glDeleteProgramPipelines",
+	"glDeleteQueries",
+	"glDeleteRenderbuffers",
+	"glDeleteSamplers",
+	"glDeleteShader",
+	"glDeleteSync",
+	"glDeleteTextures",
+	"glDeleteTransformFeedbacks",
+	"glDeleteVertexArrays",
+	"glDepthFunc",
+	"glDepthMask",
+	"glDepthRange",
+	"glDepthRangeArrayv",
+	"glDepthRangeIndexed",
+	"glDepthRangef",
+	"glDetachShader",
+	"glDisable",
+	"glDisableVertexArrayAttrib",
+	"glDisableVertexAttribArray",
+	"glDisablei",
+	"glDispatchCompute",
+	"glDispatchComputeGroupSizeARB",
+	"glDispatchComputeIndirect",
+	"glDrawArrays",
+	"glDrawArraysIndirect",
+	"glDrawArraysInstanced",
+	"glDrawArraysInstancedBaseInstance",
+	"glDrawBuffer",
+	"glDrawBuffers",
+	"glDrawElements",
+	"glDrawElementsBaseVertex",
+	"glDrawElementsIndirect",
+	"glDrawElementsInstanced",
+	"glDrawElementsInstancedBaseInstance",
+	"glDrawElementsInstancedBaseVertex",
+	"glDrawElementsInstancedBaseVertexBaseInstance",
+	"glDrawRangeElements",
+	"glDrawRangeElementsBaseVertex",
+	"glDrawTransformFeedback",
+	"glDrawTransformFeedbackInstanced",
+	"glDrawTransformFeedbackStream",
+	"glDrawTransformFeedbackStreamInstanced",
+	"glEnable",
+	"glEnableVertexArrayAttrib",
+	"glEnableVertexAttribArray",
+	"glEnablei",
+	"glEndConditionalRender",
+	"glEndQuery",
+	"glEndQueryIndexed",
+	"glEndTransformFeedback",
+	"glFenceSync",
+	"glFinish",
+	"glFlush",
+	"glFlushMappedBufferRange",
+	"glFlushMappedNamedBufferRange",
+	"glFramebufferParameteri",
+	"glFramebufferRenderbuffer",
+	"glFramebufferTexture",
+	"glFramebufferTexture1D",
+	"glFramebufferTexture2D",
+	"glFramebufferTexture3D",
+	"glFramebufferTextureLayer",
+	"glFrontFace",
+	"glGenBuffers",
+	"glGenFramebuffers",
+	"glGenProgramPipelines",
+	"glGenQueries",
+	"glGenRenderbuffers",
+	"glGenSamplers",
+	"glGenTextures",
+	"glGenTransformFeedbacks",
+	"glGenVertexArrays",
+	"glGenerateMipmap",
+	"glGenerateTextureMipmap",
+	"glGetActiveAtomicCounterBufferiv",
+	"glGetActiveAttrib",
+	"glGetActiveSubroutineName",
+	"glGetActiveSubroutineUniformName",
+	"glGetActiveSubroutineUniformiv",
+	"glGetActiveUniform",
+	"glGetActiveUniformBlockName",
+	"glGetActiveUniformBlockiv",
+	"glGetActiveUniformName",
+	"glGetActiveUniformsiv",
+	"glGetAttachedShaders",
+	"glGetAttribLocation",
+	"glGetBooleani_v",
+	"glGetBooleanv",
+	"glGetBufferParameteri64v",
+	"glGetBufferParameteriv",
+	"glGetBufferPointerv",
+	"glGetBufferSubData",
+	"glGetCompressedTexImage",
+	"glGetCompressedTextureImage",
+	"glGetCompressedTextureSubImage",
+	"glGetDebugMessageLog",
+	"glGetDebugMessageLogARB",
+	"glGetDoublei_v",
+	"glGetDoublev",
+	"glGetError",
+	"glGetFloati_v",
+	"glGetFloatv",
+	"glGetFragDataIndex",
+	"glGetFragDataLocation",
+	"glGetFramebufferAttachmentParameteriv",
+	"glGetFramebufferParameteriv",
+	"glGetGraphicsResetStatus",
+	"glGetGraphicsResetStatusARB",
+	"glGetImageHandleARB",
+	"glGetInteger64i_v",
+	"glGetInteger64v",
+	"glGetIntegeri_v",
+	"glGetIntegerv",
+	"glGetInternalformati64v",
+	"glGetInternalformativ",
+	"glGetMultisamplefv",
+	"glGetNamedBufferParameteri64v",
+	"glGetNamedBufferParameteriv",
+	"glGetNamedBufferPointerv",
+	"glGetNamedBufferSubData",
+	"glGetNamedFramebufferAttachmentParameteriv",
+	"glGetNamedFramebufferParameteriv",
+	"glGetNamedRenderbufferParameteriv",
+	"glGetNamedStringARB",
+	"glGetNamedStringivARB",
+	"glGetObjectLabel",
+	"glGetObjectPtrLabel",
+	"glGetPointerv",
+	"glGetProgramBinary",
+	"glGetProgramInfoLog",
+	"glGetProgramInterfaceiv",
+	"glGetProgramPipelineInfoLog",
+	"glGetProgramPipelineiv",
+	"glGetProgramResourceIndex",
+	"glGetProgramResourceLocation",
+	"glGetProgramResourceLocationIndex",
+	"glGetProgramResourceName",
+	"glGetProgramResourceiv",
+	"glGetProgramStageiv",
+	"glGetProgramiv",
+	"glGetQueryBufferObjecti64v",
+	"glGetQueryBufferObjectiv",
+	"glGetQueryBufferObjectui64v",
+	"glGetQueryBufferObjectuiv",
+	"glGetQueryIndexediv",
+	"glGetQueryObjecti64v",
+	"glGetQueryObjectiv",
+	"glGetQueryObjectui64v",
+	"glGetQueryObjectuiv",
+	"glGetQueryiv",
+	"glGetRenderbufferParameteriv",
+	"glGetSamplerParameterIiv",
+	"glGetSamplerParameterIuiv",
+	"glGetSamplerParameterfv",
+	"glGetSamplerParameteriv",
+	"glGetShaderInfoLog",
+	"glGetShaderPrecisionFormat",
+	"glGetShaderSource",
+	"glGetShaderiv",
+	"glGetString",
+	"glGetStringi",
+	"glGetSubroutineIndex",
+	"glGetSubroutineUniformLocation",
+	"glGetSynciv",
+	"glGetTexImage",
+	"glGetTexLevelParameterfv",
+	"glGetTexLevelParameteriv",
+	"glGetTexParameterIiv",
+	"glGetTexParameterIuiv",
+	"glGetTexParameterfv",
+	"glGetTexParameteriv",
+	"glGetTextureHandleARB",
+	"glGetTextureImage",
+	"glGetTextureLevelParameterfv",
+	"glGetTextureLevelParameteriv",
+	"glGetTextureParameterIiv",
+	"glGetTextureParameterIuiv",
+	"glGetTextureParameterfv",
+	"glGetTextureParameteriv",
+	"glGetTextureSamplerHandleARB",
+	"glGetTextureSubImage",
+	"glGetTransformFeedbackVarying",
+	"glGetTransformFeedbacki64_v",
+	"glGetTransformFeedbacki_v",
+	"glGetTransformFeedbackiv",
+	"glGetUniformBlockIndex",
+	"glGetUniformIndices",
+	"glGetUniformLocation",
+	"glGetUniformSubroutineuiv",
+	"glGetUniformdv",
+	"glGetUniformfv",
+	"glGetUniformiv",
+	"glGetUniformuiv",
+	"glGetVertexArrayIndexed64iv",
+	"glGetVertexArrayIndexediv",
+	"glGetVertexArrayiv",
+	"glGetVertexAttribIiv",
+	"glGetVertexAttribIuiv",
+	"glGetVertexAttribLdv",
+	"glGetVertexAttribLui64vARB",
+	"glGetVertexAttribPointerv",
+	"glGetVertexAttribdv",
+	"glGetVertexAttribfv",
+	"glGetVertexAttribiv",
+	"glGetnCompressedTexImage",
+	"glGetnCompressedTexImageARB",
+	"glGetnTexImage",
+	"glGetnTexImageARB",
+	"glGetnUniformdv",
+	"glGetnUniformdvARB",
+	"glGetnUniformfv",
+	"glGetnUniformfvARB",
+	"glGetnUniformiv",
+	"glGetnUniformivARB",
+	"glGetnUniformuiv",
+	"glGetnUniformuivARB",
+	"glHint",
+	"glInvalidateBufferData",
+	"glInvalidateBufferSubData",
+	"glInvalidateFramebuffer",
+	"glInvalidateNamedFramebufferData",
+	"glInvalidateNamedFramebufferSubData",
+	"glInvalidateSubFramebuffer",
+	"glInvalidateTexImage",
+	"glInvalidateTexSubImage",
+	"glIsBuffer",
+	"glIsEnabled",
+	"glIsEnabledi",
+	"glIsFramebuffer",
+	"glIsImageHandleResidentARB",
+	"glIsNamedStringARB",
+	"glIsProgram",
+	"glIsProgramPipeline",
+	"glIsQuery",
+	"glIsRenderbuffer",
+	"glIsSampler",
+	"glIsShader",
+	"glIsSync",
+	"glIsTexture",
+	"glIsTextureHandleResidentARB",
+	"glIsTransformFeedback",
+	"glIsVertexArray",
+	"glLineWidth",
+	"glLinkProgram",
+	"glLogicOp",
+	"glMakeImageHandleNonResidentARB",
+	"glMakeImageHandleResidentARB",
+	"glMakeTextureHandleNonResidentARB",
+	"glMakeTextureHandleResidentARB",
+	"glMapBuffer",
+	"glMapBufferRange",
+	"glMapNamedBuffer",
+	"glMapNamedBufferRange",
+	"glMemoryBarrier",
+	"glMemoryBarrierByRegion",
+	"glMinSampleShading",
+	"glMinSampleShadingARB",
+	"glMultiDrawArrays",
+	"glMultiDrawArraysIndirect",
+	"glMultiDrawArraysIndirectCountARB",
+	"glMultiDrawElements",
+	"glMultiDrawElementsBaseVertex",
+	"glMultiDrawElementsIndirect",
+	"glMultiDrawElementsIndirectCountARB",
+	"glNamedBufferData",
+	"glNamedBufferPageCommitmentARB",
+	"glNamedBufferPageCommitmentEXT",
+	"glNamedBufferStorage",
+	"glNamedBufferSubData",
+	"glNamedFramebufferDrawBuffer",
+	"glNamedFramebufferDrawBuffers",
+	"glNamedFramebufferParameteri",
+	"glNamedFramebufferReadBuffer",
+	"glNamedFramebufferRenderbuffer",
+	"glNamedFramebufferTexture",
+	"glNamedFramebufferTextureLayer",
+	"glNamedRenderbufferStorage",
+	"glNamedRenderbufferStorageMultisample",
+	"glNamedStringARB",
+	"glObjectLabel",
+	"glObjectPtrLabel",
+	"glPatchParameterfv",
+	"glPatchParameteri",
+	"glPauseTransformFeedback",
+	"glPixelStoref",
+	"glPixelStorei",
+	"glPointParameterf",
+	"glPointParameterfv",
+	"glPointParameteri",
+	"glPointParameteriv",
+	"glPointSize",
+	"glPolygonMode",
+	"glPolygonOffset",
+	"glPopDebugGroup",
+	"glPrimitiveRestartIndex",
+	"glProgramBinary",
+	"glProgramParameteri",
+	"glProgramUniform1d",
+	"glProgramUniform1dv",
+	"glProgramUniform1f",
+	"glProgramUniform1fv",
+	"glProgramUniform1i",
+	"glProgramUniform1iv",
+	"glProgramUniform1ui",
+	"glProgramUniform1uiv",
+	"glProgramUniform2d",
+	"glProgramUniform2dv",
+	"glProgramUniform2f",
+	"glProgramUniform2fv",
+	"glProgramUniform2i",
+	"glProgramUniform2iv",
+	"glProgramUniform2ui",
+	"glProgramUniform2uiv",
+	"glProgramUniform3d",
+	"glProgramUniform3dv",
+	"glProgramUniform3f",
+	"glProgramUniform3fv",
+	"glProgramUniform3i",
+	"glProgramUniform3iv",
+	"glProgramUniform3ui",
+	"glProgramUniform3uiv",
+	"glProgramUniform4d",
+	"glProgramUniform4dv",
+	"glProgramUniform4f",
+	"glProgramUniform4fv",
+	"glProgramUniform4i",
+	"glProgramUniform4iv",
+	"glProgramUniform4ui",
+	"glProgramUniform4uiv",
+	"glProgramUniformHandleui64ARB",
+	"glProgramUniformHandleui64vARB",
+	"glProgramUniformMatrix2dv",
+	"glProgramUniformMatrix2fv",
+	"glProgramUniformMatrix2x3dv",
+	"glProgramUniformMatrix2x3fv",
+	"glProgramUniformMatrix2x4dv",
+	"glProgramUniformMatrix2x4fv",
+	"glProgramUniformMatrix3dv",
+	"glProgramUniformMatrix3fv",
+	"glProgramUniformMatrix3x2dv",
+	"glProgramUniformMatrix3x2fv",
+	"glProgramUniformMatrix3x4dv",
+	"glProgramUniformMatrix3x4fv",
+	"glProgramUniformMatrix4dv",
+	"glProgramUniformMatrix4fv",
+	"glProgramUniformMatrix4x2dv",
+	"glProgramUniformMatrix4x2fv",
+	"glProgramUniformMatrix4x3dv",
+	"glProgramUniformMatrix4x3fv",
+	"glProvokingVertex",
+	"glPushDebugGroup",
+	"glQueryCounter",
+	"glReadBuffer",
+	"glReadPixels",
+	"glReadnPixels",
+	"glReadnPixelsARB",
+	"glReleaseShaderCompiler",
+	"glRenderbufferStorage",
+	"glRenderbufferStorageMultisample",
+	"glResumeTransformFeedback",
+	"glSampleCoverage",
+	"glSampleMaski",
+	"glSamplerParameterIiv",
+	"glSamplerParameterIuiv",
+	"glSamplerParameterf",
+	"glSamplerParameterfv",
+	"glSamplerParameteri",
+	"glSamplerParameteriv",
+	"glScissor",
+	"glScissorArrayv",
+	"glScissorIndexed",
+	"glScissorIndexedv",
+	"glShaderBinary",
+	"glShaderSource",
+	"glShaderStorageBlockBinding",
+	"glStencilFunc",
+	"glStencilFuncSeparate",
+	"glStencilMask",
+	"glStencilMaskSeparate",
+	"glStencilOp",
+	"glStencilOpSeparate",
+	"glTexBuffer",
+	"glTexBufferRange",
+	"glTexImage1D",
+	"glTexImage2D",
+	"glTexImage2DMultisample",
+	"glTexImage3D",
+	"glTexImage3DMultisample",
+	"glTexPageCommitmentARB",
+	"glTexParameterIiv",
+	"glTexParameterIuiv",
+	"glTexParameterf",
+	"glTexParameterfv",
+	"glTexParameteri",
+	"glTexParameteriv",
+	"glTexStorage1D",
+	"glTexStorage2D",
+	"glTexStorage2DMultisample",
+	"glTexStorage3D",
+	"glTexStorage3DMultisample",
+	"glTexSubImage1D",
+	"glTexSubImage2D",
+	"glTexSubImage3D",
+	"glTextureBarrier",
+	"glTextureBuffer",
+	"glTextureBufferRange",
+	"glTextureParameterIiv",
+	"glTextureParameterIuiv",
+	"glTextureParameterf",
+	"glTextureParameterfv",
+	"glTextureParameteri",
+	"glTextureParameteriv",
+	"glTextureStorage1D",
+	"glTextureStorage2D",
+	"glTextureStorage2DMultisample",
+	"glTextureStorage3D",
+	"glTextureStorage3DMultisample",
+	"glTextureSubImage1D",
+	"glTextureSubImage2D",
+	"glTextureSubImage3D",
+	"glTextureView",
+	"glTransformFeedbackBufferBase",
+	"glTransformFeedbackBufferRange",
+	"glTransformFeedbackVaryings",
+	"glUniform1d",
+	"glUniform1dv",
+	"glUniform1f",
+	"glUniform1fv",
+	"glUniform1i",
+	"glUniform1iv",
+	"glUniform1ui",
+	"glUniform1uiv",
+	"glUniform2d",
+	"glUniform2dv",
+	"glUniform2f",
+	"glUniform2fv",
+	"glUniform2i",
+	"glUniform2iv",
+	"glUniform2ui",
+	"glUniform2uiv",
+	"glUniform3d",
+	"glUniform3dv",
+	"glUniform3f",
+	"glUniform3fv",
+	"glUniform3i",
+	"glUniform3iv",
+	"glUniform3ui",
+	"glUniform3uiv",
+	"glUniform4d",
+	"glUniform4dv",
+	"glUniform4f",
+	"glUniform4fv",
+	"glUniform4i",
+	"glUniform4iv",
+	"glUniform4ui",
+	"glUniform4uiv",
+	"glUniformBlockBinding",
+	"glUniformHandleui64ARB",
+	"glUniformHandleui64vARB",
+	"glUniformMatrix2dv",
+	"glUniformMatrix2fv",
+	"glUniformMatrix2x3dv",
+	"glUniformMatrix2x3fv",
+	"glUniformMatrix2x4dv",
+	"glUniformMatrix2x4fv",
+	"glUniformMatrix3dv",
+	"glUniformMatrix3fv",
+	"glUniformMatrix3x2dv",
+	"glUniformMatrix3x2fv",
+	"glUniformMatrix3x4dv",
+	"glUniformMatrix3x4fv",
+	"glUniformMatrix4dv",
+	"glUniformMatrix4fv",
+	"glUniformMatrix4x2dv",
+	"glUniformMatrix4x2fv",
+	"glUniformMatrix4x3dv",
+	"glUniformMatrix4x3fv",
+	"glUniformSubroutinesuiv",
+	"glUnmapBuffer",
+	"glUnmapNamedBuffer",
+	"glUseProgram",
+	"glUseProgramStages",
+	"glValidateProgram",
+	"glValidateProgramPipeline",
+	"glVertexArrayAttribBinding",
+	"glVertexArrayAttribFormat",
+	"glVertexArrayAttribIFormat",
+	"glVertexArrayAttribLFormat",
+	"glVertexArrayBindingDivisor",
+	"glVertexArrayElementBuffer",
+	"glVertexArrayVertexBuffer",
+	"glVertexArrayVertexBuffers",
+	"glVertexAttrib1d",
+	"glVertexAttrib1dv",
+	"glVertexAttrib1f",
+	"glVertexAttrib1fv",
+	"glVertexAttrib1s",
+	"glVertexAttrib1sv",
+	"glVertexAttrib2d",
+	"glVertexAttrib2dv",
+	"glVertexAttrib2f",
+	"glVertexAttrib2fv",
+	"glVertexAttrib2s",
+	"glVertexAttrib2sv",
+	"glVertexAttrib3d",
+	"glVertexAttrib3dv",
+	"glVertexAttrib3f",
+	"glVertexAttrib3fv",
+	"glVertexAttrib3s",
+	"glVertexAttrib3sv",
+	"glVertexAttrib4Nbv",
+	"glVertexAttrib4Niv",
+	"glVertexAttrib4Nsv",
+	"glVertexAttrib4Nub",
+	"glVertexAttrib4Nubv",
+	"glVertexAttrib4Nuiv",
+	"glVertexAttrib4Nusv",
+	"glVertexAttrib4bv",
+	"glVertexAttrib4d",
+	"glVertexAttrib4dv",
+	"glVertexAttrib4f",
+	"glVertexAttrib4fv",
+	"glVertexAttrib4iv",
+	"glVertexAttrib4s",
+	"glVertexAttrib4sv",
+	"glVertexAttrib4ubv",
+	"glVertexAttrib4uiv",
+	"glVertexAttrib4usv",
+	"glVertexAttribBinding",
+	"glVertexAttribDivisor",
+	"glVertexAttribFormat",
+	"glVertexAttribI1i",
+	"glVertexAttribI1iv",
+	"glVertexAttribI1ui",
+	"glVertexAttribI1uiv",
+	"glVertexAttribI2i",
+	"glVertexAttribI2iv",
+	"glVertexAttribI2ui",
+	"glVertexAttribI2uiv",
+	"glVertexAttribI3i",
+	"glVertexAttribI3iv",
+	"glVertexAttribI3ui",
+	"glVertexAttribI3uiv",
+	"glVertexAttribI4bv",
+	"glVertexAttribI4i",
+	"glVertexAttribI4iv",
+	"glVertexAttribI4sv",
+	"glVertexAttribI4ubv",
+	"glVertexAttribI4ui",
+	"glVertexAttribI4uiv",
+	"glVertexAttribI4usv",
+	"glVertexAttribIFormat",
+	"glVertexAttribIPointer",
+	"glVertexAttribL1d",
+	"glVertexAttribL1dv",
+	"glVertexAttribL1ui64ARB",
+	"glVertexAttribL1ui64vARB",
+	"glVertexAttribL2d",
+	"glVertexAttribL2dv",
+	"glVertexAttribL3d",
+	"glVertexAttribL3dv",
+	"glVertexAttribL4d",
+	"glVertexAttribL4dv",
+	"glVertexAttribLFormat",
+	"glVertexAttribLPointer",
+	"glVertexAttribP1ui",
+	"glVertexAttribP1uiv",
+	"glVertexAttribP2ui",
+	"glVertexAttribP2uiv",
+	"glVertexAttribP3ui",
+	"glVertexAttribP3uiv",
+	"glVertexAttribP4ui",
+	"glVertexAttribP4uiv",
+	"glVertexAttribPointer",
+	"glVertexBindingDivisor",
+	"glViewport",
+	"glViewportArrayv",
+	"glViewportIndexedf",
+	"glViewportIndexedfv",
+	"glWaitSync",
+};
+
+/* Core version (major * 10 + minor) introducing each entry point,
+ * or 0 for extension entry points.
+ */
+static const unsigned char proc_versions[] = {
+	41, 13, 20, 30, 15, 40, 30, 20, 15, 30, 30, 44, 44, 30, 33, 30, 42, 44, 41, 30,
+	33, 44, 11, 45, 44, 40, 30, 43, 44, 14, 14, 20, 40, 0, 40, 0, 10, 14, 40, 0,
+	40, 0, 30, 45, 15, 0, 44, 15, 30, 45, 30, 10, 43, 43, 30, 30, 30, 30, 10, 10,
+	41, 45, 45, 45, 45, 45, 45, 10, 44, 44, 32, 45, 10, 30, 20, 0, 13, 13, 13, 13,
+	13, 13, 45, 45, 45, 31, 43, 45, 11, 11, 11, 11, 12, 45, 45, 45, 45, 45, 20, 45,
+	45, 45, 45, 20, 41, 0, 45, 45, 45, 10, 43, 0, 43, 0, 43, 0, 15, 30, 0, 20,
+	41, 15, 30, 33, 20, 32, 11, 40, 30, 10, 10, 10, 41, 41, 41, 20, 10, 45, 20, 30,
+	43, 0, 43, 11, 40, 31, 42, 10, 20, 11, 32, 40, 31, 42, 32, 42, 12, 32, 40, 42,
+	40, 42, 10, 45, 20, 30, 30, 15, 40, 30, 32, 10, 10, 30, 45, 43, 30, 32, 30, 30,
+	30, 30, 10, 15, 30, 41, 15, 30, 33, 11, 40, 30, 30, 45, 42, 20, 40, 40, 40, 20,
+	31, 31, 31, 31, 20, 20, 30, 10, 32, 15, 15, 15, 13, 45, 45, 43, 0, 41, 10, 10,
+	41, 10, 33, 30, 30, 43, 45, 0, 0, 32, 32, 30, 10, 43, 42, 32, 45, 45, 45, 45,
+	45, 45, 45, 0, 0, 43, 43, 11, 41, 20, 43, 41, 41, 43, 43, 43, 43, 43, 40, 20,
+	45, 45, 45, 45, 40, 33, 15, 33, 15, 15, 30, 33, 33, 33, 33, 20, 41, 20, 20, 10,
+	30, 40, 40, 32, 10, 10, 10, 30, 30, 10, 10, 0, 45, 45, 45, 45, 45, 45, 45, 0,
+	45, 30, 45, 45, 45, 31, 31, 20, 40, 40, 20, 20, 30, 45, 45, 45, 30, 30, 41, 0,
+	20, 20, 20, 20, 45, 0, 45, 0, 45, 0, 45, 0, 45, 0, 45, 0, 10, 43, 43, 43,
+	45, 45, 43, 43, 43, 15, 10, 30, 30, 0, 0, 20, 41, 15, 30, 33, 20, 32, 11, 0,
+	40, 30, 10, 20, 10, 0, 0, 0, 0, 15, 30, 45, 45, 42, 45, 40, 0, 14, 43, 0,
+	14, 32, 43, 0, 45, 0, 0, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 0, 43,
+	43, 40, 40, 40, 10, 10, 14, 14, 14, 14, 10, 10, 11, 43, 31, 41, 41, 41, 41, 41,
+	41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+	41, 41, 41, 41, 41, 41, 41, 41, 41, 0, 0, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+	41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 43, 33, 10, 10, 45, 0, 41, 30, 30, 40,
+	13, 32, 33, 33, 33, 33, 33, 33, 10, 41, 41, 41, 41, 20, 43, 10, 20, 10, 20, 10,
+	20, 31, 43, 10, 10, 32, 12, 32, 0, 30, 30, 10, 10, 10, 10, 42, 42, 43, 42, 43,
+	11, 11, 12, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+	43, 45, 45, 30, 40, 40, 20, 20, 20, 20, 30, 30, 40, 40, 20, 20, 20, 20, 30, 30,
+	40, 40, 20, 20, 20, 20, 30, 30, 40, 40, 20, 20, 20, 20, 30, 30, 31, 0, 0, 40,
+	20, 40, 21, 40, 21, 40, 20, 40, 21, 40, 21, 40, 20, 40, 21, 40, 21, 40, 15, 45,
+	20, 41, 20, 41, 45, 45, 45, 45, 45, 45, 45, 45, 20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20, 43, 33, 43, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+	30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 43, 30, 41, 41, 0, 0, 41, 41, 41,
+	41, 41, 41, 43, 41, 33, 33, 33, 33, 33, 33, 33, 33, 20, 43, 10, 41, 41, 41, 32,
+};
+
+static const char *const ext_names[] = {
+	"GL_ARB_ES2_compatibility",
+	"GL_ARB_ES3_1_compatibility",
+	"GL_ARB_ES3_compatibility",
+	"GL_ARB_arrays_of_arrays",
+	"GL_ARB_base_instance",
+	"GL_ARB_bindless_texture",
+	"GL_ARB_blend_func_extended",
+	"GL_ARB_buffer_storage",
+	"GL_ARB_cl_event",
+	"GL_ARB_clear_buffer_object",
+	"GL_ARB_clear_texture",
+	"GL_ARB_clip_control",
+	"GL_ARB_compressed_texture_pixel_storage",
+	"GL_ARB_compute_shader",
+	"GL_ARB_compute_variable_group_size",
+	"GL_ARB_conditional_render_inverted",
+	"GL_ARB_conservative_depth",
+	"GL_ARB_copy_buffer",
+	"GL_ARB_copy_image",
+	"GL_ARB_cull_distance",
+	"GL_ARB_debug_output",
+	"GL_ARB_depth_buffer_float",
+	"GL_ARB_depth_clamp",
+	"GL_ARB_derivative_control",
+	"GL_ARB_direct_state_access",
+	"GL_ARB_draw_buffers_blend",
+	"GL_ARB_draw_elements_base_vertex",
+	"GL_ARB_draw_indirect",
+	"GL_ARB_enhanced_layouts",
+	"GL_ARB_explicit_attrib_location",
+	"GL_ARB_explicit_uniform_location",
+	"GL_ARB_fragment_coord_conventions",
+	"GL_ARB_fragment_layer_viewport",
+	"GL_ARB_framebuffer_no_attachments",
+	"GL_ARB_framebuffer_object",
+	"GL_ARB_framebuffer_sRGB",
+	"GL_ARB_get_program_binary",
+	"GL_ARB_get_texture_sub_image",
+	"GL_ARB_gpu_shader5",
+	"GL_ARB_gpu_shader_fp64",
+	"GL_ARB_half_float_vertex",
+	"GL_ARB_imaging",
+	"GL_ARB_indirect_parameters",
+	"GL_ARB_internalformat_query",
+	"GL_ARB_internalformat_query2",
+	"GL_ARB_invalidate_subdata",
+	"GL_ARB_map_buffer_alignment",
+	"GL_ARB_map_buffer_range",
+	"GL_ARB_multi_bind",
+	"GL_ARB_multi_draw_indirect",
+	"GL_ARB_occlusion_query2",
+	"GL_ARB_pipeline_statistics_query",
+	"GL_ARB_program_interface_query",
+	"GL_ARB_provoking_vertex",
+	"GL_ARB_query_buffer_object",
+	"GL_ARB_robust_buffer_access_behavior",
+	"GL_ARB_robustness",
+	"GL_ARB_robustness_isolation",
+	"GL_ARB_sample_shading",
+	"GL_ARB_sampler_objects",
+	"GL_ARB_seamless_cube_map",
+	"GL_ARB_seamless_cubemap_per_texture",
+	"GL_ARB_separate_shader_objects",
+	"GL_ARB_shader_atomic_counters",
+	"GL_ARB_shader_bit_encoding",
+	"GL_ARB_shader_draw_parameters",
+	"GL_ARB_shader_group_vote",
+	"GL_ARB_shader_image_load_store",
+	"GL_ARB_shader_image_size",
+	"GL_ARB_shader_precision",
+	"GL_ARB_shader_stencil_export",
+	"GL_ARB_shader_storage_buffer_object",
+	"GL_ARB_shader_subroutine",
+	"GL_ARB_shader_texture_image_samples",
+	"GL_ARB_shading_language_420pack",
+	"GL_ARB_shading_language_include",
+	"GL_ARB_shading_language_packing",
+	"GL_ARB_sparse_buffer",
+	"GL_ARB_sparse_texture",
+	"GL_ARB_stencil_texturing",
+	"GL_ARB_sync",
+	"GL_ARB_tessellation_shader",
+	"GL_ARB_texture_barrier",
+	"GL_ARB_texture_buffer_object_rgb32",
+	"GL_ARB_texture_buffer_range",
+	"GL_ARB_texture_compression_bptc",
+	"GL_ARB_texture_compression_rgtc",
+	"GL_ARB_texture_cube_map_array",
+	"GL_ARB_texture_gather",
+	"GL_ARB_texture_mirror_clamp_to_edge",
+	"GL_ARB_texture_multisample",
+	"GL_ARB_texture_query_levels",
+	"GL_ARB_texture_query_lod",
+	"GL_ARB_texture_rg",
+	"GL_ARB_texture_rgb10_a2ui",
+	"GL_ARB_texture_stencil8",
+	"GL_ARB_texture_storage",
+	"GL_ARB_texture_storage_multisample",
+	"GL_ARB_texture_swizzle",
+	"GL_ARB_texture_view",
+	"GL_ARB_timer_query",
+	"GL_ARB_transform_feedback2",
+	"GL_ARB_transform_feedback3",
+	"GL_ARB_transform_feedback_instanced",
+	"GL_ARB_transform_feedback_overflow_query",
+	"GL_ARB_uniform_buffer_object",
+	"GL_ARB_vertex_array_bgra",
+	"GL_ARB_vertex_array_object",
+	"GL_ARB_vertex_attrib_64bit",
+	"GL_ARB_vertex_attrib_binding",
+	"GL_ARB_vertex_type_10f_11f_11f_rev",
+	"GL_ARB_vertex_type_2_10_10_10_rev",
+	"GL_ARB_viewport_array",
+	"GL_KHR_context_flush_control",
+	"GL_KHR_debug",
+	"GL_KHR_robust_buffer_access_behavior",
+	"GL_KHR_robustness",
+	"GL_KHR_texture_compression_astc_hdr",
+	"GL_KHR_texture_compression_astc_ldr",
+};
+
+/* Extension ID plus one, or 0 for core entry points. */
+static const unsigned char proc_exts[] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 26, 0, 0, 0, 26,
+	0, 26, 0, 0, 0, 78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 21, 0, 21, 0, 21, 0, 0, 76, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 57, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 76, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 6,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+	0, 0, 0, 0, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 76, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+	0, 0, 0, 0, 0, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 59, 0, 0, 43,
+	0, 0, 0, 43, 0, 78, 78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+#define PROC_SEED1 0x364527b5u
+#define PROC_SEED2 0x94b54c10u
+
+static const unsigned short proc_graph[1471] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 180, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 555, 0, 0, 260, 0, 0,
+	0, 0, 669, 0, 429, 0, 0, 0, 231, 0, 289, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 263, 0,
+	326, 0, 84, 0, 0, 0, 0, 0, 0, 0, 245, 0,
+	0, 0, 664, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 72, 0, 0, 259, 0, 0, 0, 0, 0, 0,
+	0, 548, 0, 0, 483, 105, 0, 0, 128, 0, 0, 0,
+	0, 445, 0, 0, 0, 0, 268, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 460, 616, 0, 512, 332, 0,
+	0, 0, 0, 263, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 119, 0, 240, 0, 0, 0, 0,
+	0, 0, 640, 452, 0, 0, 0, 273, 0, 516, 113, 384,
+	0, 632, 0, 0, 0, 351, 302, 0, 308, 0, 0, 0,
+	0, 0, 0, 0, 251, 150, 0, 130, 0, 0, 0, 290,
+	0, 0, 0, 309, 0, 0, 0, 0, 0, 604, 0, 637,
+	0, 0, 0, 416, 29, 438, 560, 0, 0, 230, 0, 202,
+	0, 478, 648, 0, 0, 57, 0, 0, 0, 0, 0, 348,
+	174, 0, 0, 410, 0, 0, 0, 0, 74, 0, 591, 0,
+	0, 0, 0, 0, 478, 0, 6, 0, 24, 0, 0, 600,
+	483, 0, 0, 0, 0, 0, 56, 0, 0, 0, 460, 378,
+	0, 0, 0, 0, 4, 0, 612, 0, 0, 0, 207, 0,
+	0, 235, 248, 0, 547, 0, 0, 0, 0, 0, 482, 87,
+	0, 0, 0, 0, 479, 508, 0, 0, 0, 0, 58, 0,
+	0, 0, 0, 0, 0, 387, 0, 0, 0, 232, 0, 179,
+	0, 479, 0, 0, 0, 0, 0, 0, 100, 0, 0, 294,
+	45, 0, 462, 0, 124, 0, 427, 7, 656, 0, 130, 265,
+	0, 242, 0, 0, 545, 131, 0, 244, 0, 398, 0, 695,
+	595, 468, 0, 132, 0, 70, 0, 0, 27, 0, 31, 0,
+	0, 0, 304, 87, 0, 0, 0, 0, 0, 143, 0, 613,
+	467, 125, 216, 450, 339, 0, 0, 0, 0, 0, 0, 0,
+	246, 627, 0, 624, 0, 0, 0, 0, 530, 0, 360, 0,
+	0, 0, 0, 389, 620, 0, 142, 407, 0, 0, 0, 660,
+	633, 367, 107, 489, 0, 338, 643, 0, 23, 480, 0, 67,
+	607, 0, 283, 230, 453, 581, 0, 0, 456, 28, 0, 0,
+	557, 0, 0, 224, 385, 0, 0, 239, 533, 0, 0, 0,
+	688, 0, 0, 114, 0, 0, 0, 0, 0, 0, 0, 0,
+	354, 685, 332, 0, 428, 0, 0, 665, 0, 463, 0, 514,
+	0, 480, 0, 0, 417, 0, 0, 655, 0, 0, 0, 126,
+	140, 0, 660, 693, 0, 334, 471, 129, 0, 0, 65, 601,
+	562, 0, 137, 0, 475, 0, 0, 384, 0, 455, 0, 0,
+	348, 208, 558, 0, 587, 155, 190, 541, 0, 0, 492, 0,
+	0, 626, 71, 333, 0, 28, 87, 175, 0, 0, 0, 0,
+	645, 0, 127, 73, 0, 0, 353, 0, 321, 0, 391, 0,
+	0, 0, 0, 0, 0, 170, 0, 0, 338, 0, 288, 0,
+	562, 278, 0, 342, 0, 485, 0, 0, 0, 600, 0, 0,
+	0, 623, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 585, 217, 0, 0, 0, 636, 0, 193, 327, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 684, 576, 437, 0,
+	0, 0, 0, 0, 0, 0, 0, 683, 0, 541, 0, 0,
+	282, 637, 606, 428, 0, 0, 322, 0, 650, 660, 565, 0,
+	325, 416, 0, 609, 0, 466, 0, 0, 0, 534, 328, 0,
+	0, 252, 0, 0, 0, 488, 0, 0, 442, 503, 0, 0,
+	46, 592, 467, 0, 0, 0, 0, 66, 597, 0, 548, 426,
+	398, 0, 271, 0, 0, 140, 0, 0, 0, 531, 0, 615,
+	0, 0, 0, 540, 0, 0, 0, 698, 0, 9, 94, 673,
+	447, 123, 148, 0, 0, 134, 695, 509, 388, 0, 223, 0,
+	169, 0, 0, 0, 632, 0, 0, 650, 0, 0, 0, 0,
+	0, 0, 0, 561, 482, 0, 0, 337, 664, 18, 0, 0,
+	0, 331, 0, 138, 369, 582, 406, 590, 234, 17, 316, 362,
+	165, 630, 0, 93, 0, 0, 0, 0, 415, 0, 0, 509,
+	19, 0, 544, 248, 108, 221, 0, 0, 44, 690, 0, 530,
+	527, 421, 107, 38, 585, 0, 0, 0, 0, 257, 180, 375,
+	0, 0, 198, 445, 182, 326, 624, 0, 105, 361, 289, 530,
+	0, 0, 0, 240, 0, 0, 223, 0, 0, 75, 0, 0,
+	0, 0, 513, 0, 0, 0, 4, 0, 0, 97, 0, 607,
+	0, 0, 0, 423, 323, 0, 0, 0, 684, 307, 31, 680,
+	555, 358, 0, 0, 0, 0, 0, 0, 0, 674, 601, 93,
+	0, 0, 0, 518, 0, 301, 0, 0, 0, 17, 126, 321,
+	0, 649, 0, 0, 65, 0, 0, 269, 0, 0, 493, 0,
+	197, 0, 552, 0, 359, 235, 0, 0, 0, 195, 333, 0,
+	0, 422, 0, 0, 0, 0, 592, 0, 490, 0, 329, 84,
+	488, 0, 0, 294, 0, 485, 0, 647, 0, 596, 0, 12,
+	86, 274, 0, 0, 151, 679, 0, 0, 0, 0, 59, 8,
+	38, 0, 0, 220, 473, 542, 167, 0, 0, 0, 661, 578,
+	0, 586, 331, 0, 494, 569, 466, 0, 601, 653, 248, 454,
+	462, 0, 0, 0, 115, 23, 473, 0, 0, 0, 16, 558,
+	6, 603, 0, 636, 0, 420, 0, 172, 0, 0, 696, 490,
+	631, 508, 0, 604, 0, 478, 461, 0, 268, 299, 568, 48,
+	0, 84, 502, 215, 495, 477, 1, 553, 663, 0, 0, 0,
+	611, 0, 376, 174, 0, 272, 95, 0, 578, 0, 53, 59,
+	101, 0, 96, 455, 677, 0, 574, 652, 0, 0, 626, 653,
+	0, 0, 640, 438, 0, 298, 25, 539, 619, 677, 0, 0,
+	69, 6, 283, 569, 262, 79, 10, 0, 649, 171, 0, 150,
+	181, 371, 563, 0, 0, 297, 0, 320, 0, 0, 344, 35,
+	666, 627, 501, 425, 0, 0, 187, 655, 334, 430, 172, 227,
+	0, 250, 0, 480, 577, 112, 476, 557, 581, 23, 18, 257,
+	0, 689, 115, 0, 0, 0, 379, 0, 444, 0, 0, 269,
+	657, 350, 0, 0, 469, 0, 61, 0, 0, 0, 348, 527,
+	368, 0, 0, 121, 0, 0, 126, 575, 0, 498, 489, 27,
+	232, 516, 346, 0, 0, 260, 0, 0, 312, 121, 0, 0,
+	40, 387, 246, 0, 0, 0, 0, 0, 0, 403, 19, 0,
+	309, 373, 42, 450, 578, 0, 219, 0, 66, 0, 302, 506,
+	99, 627, 0, 0, 0, 253, 511, 0, 0, 0, 0, 81,
+	0, 368, 542, 0, 678, 505, 361, 204, 431, 0, 658, 0,
+	260, 0, 0, 551, 86, 0, 0, 0, 0, 210, 226, 588,
+	517, 176, 43, 0, 580, 0, 90, 313, 78, 0, 0, 0,
+	0, 0, 0, 0, 0, 395, 0, 35, 554, 0, 0, 72,
+	0, 453, 426, 0, 329, 0, 58, 573, 0, 321, 0, 0,
+	559, 0, 0, 0, 0, 0, 500, 0, 497, 0, 0, 145,
+	313, 113, 0, 375, 0, 0, 0, 299, 0, 0, 0, 271,
+	356, 230, 575, 67, 482, 0, 414, 484, 0, 0, 177, 0,
+	475, 0, 634, 361, 216, 349, 615, 1, 542, 357, 629, 159,
+	322, 145, 319, 0, 300, 231, 0, 162, 26, 297, 177, 646,
+	0, 0, 0, 530, 7, 344, 183, 0, 154, 0, 151, 0,
+	0, 69, 0, 0, 435, 190, 224, 0, 193, 365, 51, 504,
+	552, 564, 314, 614, 0, 0, 0, 75, 0, 369, 0, 0,
+	0, 0, 200, 173, 270, 424, 22, 219, 98, 579, 291, 551,
+	83, 80, 278, 0, 0, 119, 74, 30, 527, 0, 0, 22,
+	342, 0, 197, 328, 151, 0, 575, 519, 0, 179, 0, 516,
+	535, 526, 395, 236, 637, 621, 20, 297, 0, 0, 21, 202,
+	599, 203, 0, 0, 639, 0, 0, 64, 308, 0, 0, 525,
+	0, 242, 124, 537, 0, 295, 300, 109, 0, 0, 587, 173,
+	0, 0, 83, 0, 402, 532, 245, 530, 324, 185, 418, 377,
+	0, 477, 3, 194, 0, 0, 0, 540, 20, 408, 586, 260,
+	0, 0, 334, 82, 0, 0, 618, 0, 173, 106, 534, 0,
+	577, 0, 13, 275, 0, 523, 309, 0, 0, 0, 103, 325,
+	184, 419, 637, 85, 627, 0, 267, 467, 0, 0, 0, 293,
+	503, 475, 338, 0, 517, 0, 688, 358, 36, 567, 0, 0,
+	86, 474, 421, 282, 450, 377, 535, 0, 52, 441, 231, 134,
+	83, 0, 164, 149, 522, 0, 572,
+};
+
+static unsigned fnv1a(unsigned h, const char *s)
+{
+	while (*s)
+		h = ((h ^ (unsigned char) *s++) * 16777619u) & 0xffffffffu;
+	return h;
+}
+
+static unsigned proc_hash(unsigned h, const char *proc)
+{
+	return fnv1a(h, proc) % ARRAY_SIZE(proc_graph);
+}
+
+int gl3wProcIndex(const char *proc)
+{
+	unsigned a = proc_graph[proc_hash(PROC_SEED1, proc)];
+	unsigned b = proc_graph[proc_hash(PROC_SEED2, proc)];
+	unsigned slot = (a + b) % GL3W_PROC_COUNT;
+
+	if (strcmp(proc_names[slot], proc))
+		return -1;
+	return slot;
+}
+
+const char *gl3wProcName(int slot)
+{
+	if (slot < 0 || slot >= GL3W_PROC_COUNT)
+		return NULL;
+	return proc_names[slot];
+}
+
+static const GL3WglProc trace_procs[GL3W_PROC_COUNT];
+static union GL3WProcs real;
+static int trace_mode;
+
+static int is_stub(int slot);
+static void trace_resolved(int slot, GL3WglProc proc);
+
+static GL3WglProc lookup_proc(const char *proc)
+{
+	int slot = gl3wProcIndex(proc);
+
+	if (slot < 0)
+		return get_proc(proc);
+	if ((trace_mode ? !real.ptr[slot] : !gl3wProcs.ptr[slot]) ||
+	    is_stub(slot)) {
+		GL3WglProc res = get_proc(proc);
+
+		if (!res)
+			return NULL;
+		trace_resolved(slot, res);
+	}
+	return gl3wProcs.ptr[slot];
+}
+
 GL3WglProc gl3wGetProcAddress(const char *proc)
 {
-	return get_proc(proc);
-}
-
-PFNGLACTIVESHADERPROGRAMPROC                         gl3wActiveShaderProgram;
-PFNGLACTIVETEXTUREPROC                               gl3wActiveTexture;
-PFNGLATTACHSHADERPROC                                gl3wAttachShader;
-PFNGLBEGINCONDITIONALRENDERPROC                      gl3wBeginConditionalRender;
-PFNGLBEGINQUERYPROC                                  gl3wBeginQuery;
-PFNGLBEGINQUERYINDEXEDPROC                           gl3wBeginQueryIndexed;
-PFNGLBEGINTRANSFORMFEEDBACKPROC                      gl3wBeginTransformFeedback;
-PFNGLBINDATTRIBLOCATIONPROC                          gl3wBindAttribLocation;
-PFNGLBINDBUFFERPROC                                  gl3wBindBuffer;
-PFNGLBINDBUFFERBASEPROC                              gl3wBindBufferBase;
-PFNGLBINDBUFFERRANGEPROC                             gl3wBindBufferRange;
-PFNGLBINDBUFFERSBASEPROC                             gl3wBindBuffersBase;
-PFNGLBINDBUFFERSRANGEPROC                            gl3wBindBuffersRange;
-PFNGLBINDFRAGDATALOCATIONPROC                        gl3wBindFragDataLocation;
-PFNGLBINDFRAGDATALOCATIONINDEXEDPROC                 gl3wBindFragDataLocationIndexed;
-PFNGLBINDFRAMEBUFFERPROC                             gl3wBindFramebuffer;
-PFNGLBINDIMAGETEXTUREPROC                            gl3wBindImageTexture;
-PFNGLBINDIMAGETEXTURESPROC                           gl3wBindImageTextures;
-PFNGLBINDPROGRAMPIPELINEPROC                         gl3wBindProgramPipeline;
-PFNGLBINDRENDERBUFFERPROC                            gl3wBindRenderbuffer;
-PFNGLBINDSAMPLERPROC                                 gl3wBindSampler;
-PFNGLBINDSAMPLERSPROC                                gl3wBindSamplers;
-PFNGLBINDTEXTUREPROC                                 gl3wBindTexture;
-PFNGLBINDTEXTUREUNITPROC                             gl3wBindTextureUnit;
-PFNGLBINDTEXTURESPROC                                gl3wBindTextures;
-PFNGLBINDTRANSFORMFEEDBACKPROC                       gl3wBindTransformFeedback;
-PFNGLBINDVERTEXARRAYPROC                             gl3wBindVertexArray;
-PFNGLBINDVERTEXBUFFERPROC                            gl3wBindVertexBuffer;
-PFNGLBINDVERTEXBUFFERSPROC                           gl3wBindVertexBuffers;
-PFNGLBLENDCOLORPROC                                  gl3wBlendColor;
-PFNGLBLENDEQUATIONPROC                               gl3wBlendEquation;
-PFNGLBLENDEQUATIONSEPARATEPROC                       gl3wBlendEquationSeparate;
-PFNGLBLENDEQUATIONSEPARATEIPROC                      gl3wBlendEquationSeparatei;
-PFNGLBLENDEQUATIONSEPARATEIARBPROC                   gl3wBlendEquationSeparateiARB;
-PFNGLBLENDEQUATIONIPROC                              gl3wBlendEquationi;
-PFNGLBLENDEQUATIONIARBPROC                           gl3wBlendEquationiARB;
-PFNGLBLENDFUNCPROC                                   gl3wBlendFunc;
-PFNGLBLENDFUNCSEPARATEPROC                           gl3wBlendFuncSeparate;
-PFNGLBLENDFUNCSEPARATEIPROC                          gl3wBlendFuncSeparatei;
-PFNGLBLENDFUNCSEPARATEIARBPROC                       gl3wBlendFuncSeparateiARB;
-PFNGLBLENDFUNCIPROC                                  gl3wBlendFunci;
-PFNGLBLENDFUNCIARBPROC                               gl3wBlendFunciARB;
-PFNGLBLITFRAMEBUFFERPROC                             gl3wBlitFramebuffer;
-PFNGLBLITNAMEDFRAMEBUFFERPROC                        gl3wBlitNamedFramebuffer;
-PFNGLBUFFERDATAPROC                                  gl3wBufferData;
-PFNGLBUFFERPAGECOMMITMENTARBPROC                     gl3wBufferPageCommitmentARB;
-PFNGLBUFFERSTORAGEPROC                               gl3wBufferStorage;
-PFNGLBUFFERSUBDATAPROC                               gl3wBufferSubData;
-PFNGLCHECKFRAMEBUFFERSTATUSPROC                      gl3wCheckFramebufferStatus;
-PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC                 gl3wCheckNamedFramebufferStatus;
-PFNGLCLAMPCOLORPROC                                  gl3wClampColor;
-PFNGLCLEARPROC                                       gl3wClear;
-PFNGLCLEARBUFFERDATAPROC                             gl3wClearBufferData;
-PFNGLCLEARBUFFERSUBDATAPROC                          gl3wClearBufferSubData;
-PFNGLCLEARBUFFERFIPROC                               gl3wClearBufferfi;
-PFNGLCLEARBUFFERFVPROC                               gl3wClearBufferfv;
-PFNGLCLEARBUFFERIVPROC                               gl3wClearBufferiv;
-PFNGLCLEARBUFFERUIVPROC                              gl3wClearBufferuiv;
-PFNGLCLEARCOLORPROC                                  gl3wClearColor;
-PFNGLCLEARDEPTHPROC                                  gl3wClearDepth;
-PFNGLCLEARDEPTHFPROC                                 gl3wClearDepthf;
-PFNGLCLEARNAMEDBUFFERDATAPROC                        gl3wClearNamedBufferData;
-PFNGLCLEARNAMEDBUFFERSUBDATAPROC                     gl3wClearNamedBufferSubData;
-PFNGLCLEARNAMEDFRAMEBUFFERFIPROC                     gl3wClearNamedFramebufferfi;
-PFNGLCLEARNAMEDFRAMEBUFFERFVPROC                     gl3wClearNamedFramebufferfv;
-PFNGLCLEARNAMEDFRAMEBUFFERIVPROC                     gl3wClearNamedFramebufferiv;
-PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC                    gl3wClearNamedFramebufferuiv;
-PFNGLCLEARSTENCILPROC                                gl3wClearStencil;
-PFNGLCLEARTEXIMAGEPROC                               gl3wClearTexImage;
-PFNGLCLEARTEXSUBIMAGEPROC                            gl3wClearTexSubImage;
-PFNGLCLIENTWAITSYNCPROC                              gl3wClientWaitSync;
-PFNGLCLIPCONTROLPROC                                 gl3wClipControl;
-PFNGLCOLORMASKPROC                                   gl3wColorMask;
-PFNGLCOLORMASKIPROC                                  gl3wColorMaski;
-PFNGLCOMPILESHADERPROC                               gl3wCompileShader;
-PFNGLCOMPILESHADERINCLUDEARBPROC                     gl3wCompileShaderIncludeARB;
-PFNGLCOMPRESSEDTEXIMAGE1DPROC                        gl3wCompressedTexImage1D;
-PFNGLCOMPRESSEDTEXIMAGE2DPROC                        gl3wCompressedTexImage2D;
-PFNGLCOMPRESSEDTEXIMAGE3DPROC                        gl3wCompressedTexImage3D;
-PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC                     gl3wCompressedTexSubImage1D;
-PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC                     gl3wCompressedTexSubImage2D;
-PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC                     gl3wCompressedTexSubImage3D;
-PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC                 gl3wCompressedTextureSubImage1D;
-PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC                 gl3wCompressedTextureSubImage2D;
-PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC                 gl3wCompressedTextureSubImage3D;
-PFNGLCOPYBUFFERSUBDATAPROC                           gl3wCopyBufferSubData;
-PFNGLCOPYIMAGESUBDATAPROC                            gl3wCopyImageSubData;
-PFNGLCOPYNAMEDBUFFERSUBDATAPROC                      gl3wCopyNamedBufferSubData;
-PFNGLCOPYTEXIMAGE1DPROC                              gl3wCopyTexImage1D;
-PFNGLCOPYTEXIMAGE2DPROC                              gl3wCopyTexImage2D;
-PFNGLCOPYTEXSUBIMAGE1DPROC                           gl3wCopyTexSubImage1D;
-PFNGLCOPYTEXSUBIMAGE2DPROC                           gl3wCopyTexSubImage2D;
-PFNGLCOPYTEXSUBIMAGE3DPROC                           gl3wCopyTexSubImage3D;
-PFNGLCOPYTEXTURESUBIMAGE1DPROC                       gl3wCopyTextureSubImage1D;
-PFNGLCOPYTEXTURESUBIMAGE2DPROC                       gl3wCopyTextureSubImage2D;
-PFNGLCOPYTEXTURESUBIMAGE3DPROC                       gl3wCopyTextureSubImage3D;
-PFNGLCREATEBUFFERSPROC                               gl3wCreateBuffers;
-PFNGLCREATEFRAMEBUFFERSPROC                          gl3wCreateFramebuffers;
-PFNGLCREATEPROGRAMPROC                               gl3wCreateProgram;
-PFNGLCREATEPROGRAMPIPELINESPROC                      gl3wCreateProgramPipelines;
-PFNGLCREATEQUERIESPROC                               gl3wCreateQueries;
-PFNGLCREATERENDERBUFFERSPROC                         gl3wCreateRenderbuffers;
-PFNGLCREATESAMPLERSPROC                              gl3wCreateSamplers;
-PFNGLCREATESHADERPROC                                gl3wCreateShader;
-PFNGLCREATESHADERPROGRAMVPROC                        gl3wCreateShaderProgramv;
-PFNGLCREATESYNCFROMCLEVENTARBPROC                    gl3wCreateSyncFromCLeventARB;
-PFNGLCREATETEXTURESPROC                              gl3wCreateTextures;
-PFNGLCREATETRANSFORMFEEDBACKSPROC                    gl3wCreateTransformFeedbacks;
-PFNGLCREATEVERTEXARRAYSPROC                          gl3wCreateVertexArrays;
-PFNGLCULLFACEPROC                                    gl3wCullFace;
-PFNGLDEBUGMESSAGECALLBACKPROC                        gl3wDebugMessageCallback;
-PFNGLDEBUGMESSAGECALLBACKARBPROC                     gl3wDebugMessageCallbackARB;
-PFNGLDEBUGMESSAGECONTROLPROC                         gl3wDebugMessageControl;
-PFNGLDEBUGMESSAGECONTROLARBPROC                      gl3wDebugMessageControlARB;
-PFNGLDEBUGMESSAGEINSERTPROC                          gl3wDebugMessageInsert;
-PFNGLDEBUGMESSAGEINSERTARBPROC                       gl3wDebugMessageInsertARB;
-PFNGLDELETEBUFFERSPROC                               gl3wDeleteBuffers;
-PFNGLDELETEFRAMEBUFFERSPROC                          gl3wDeleteFramebuffers;
-PFNGLDELETENAMEDSTRINGARBPROC                        gl3wDeleteNamedStringARB;
-PFNGLDELETEPROGRAMPROC                               gl3wDeleteProgram;
-PFNGLDELETEPROGRAMPIPELINESPROC                      gl3wDeleteProgramPipelines;
-PFNGLDELETEQUERIESPROC                               gl3wDeleteQueries;
-PFNGLDELETERENDERBUFFERSPROC                         gl3wDeleteRenderbuffers;
-PFNGLDELETESAMPLERSPROC                              gl3wDeleteSamplers;
-PFNGLDELETESHADERPROC                                gl3wDeleteShader;
-PFNGLDELETESYNCPROC                                  gl3wDeleteSync;
-PFNGLDELETETEXTURESPROC                              gl3wDeleteTextures;
-PFNGLDELETETRANSFORMFEEDBACKSPROC                    gl3wDeleteTransformFeedbacks;
-PFNGLDELETEVERTEXARRAYSPROC                          gl3wDeleteVertexArrays;
-PFNGLDEPTHFUNCPROC                                   gl3wDepthFunc;
-PFNGLDEPTHMASKPROC                                   gl3wDepthMask;
-PFNGLDEPTHRANGEPROC                                  gl3wDepthRange;
-PFNGLDEPTHRANGEARRAYVPROC                            gl3wDepthRangeArrayv;
-PFNGLDEPTHRANGEINDEXEDPROC                           gl3wDepthRangeIndexed;
-PFNGLDEPTHRANGEFPROC                                 gl3wDepthRangef;
-PFNGLDETACHSHADERPROC                                gl3wDetachShader;
-PFNGLDISABLEPROC                                     gl3wDisable;
-PFNGLDISABLEVERTEXARRAYATTRIBPROC                    gl3wDisableVertexArrayAttrib;
-PFNGLDISABLEVERTEXATTRIBARRAYPROC                    gl3wDisableVertexAttribArray;
-PFNGLDISABLEIPROC                                    gl3wDisablei;
-PFNGLDISPATCHCOMPUTEPROC                             gl3wDispatchCompute;
-PFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC                 gl3wDispatchComputeGroupSizeARB;
-PFNGLDISPATCHCOMPUTEINDIRECTPROC                     gl3wDispatchComputeIndirect;
-PFNGLDRAWARRAYSPROC                                  gl3wDrawArrays;
-PFNGLDRAWARRAYSINDIRECTPROC                          gl3wDrawArraysIndirect;
-PFNGLDRAWARRAYSINSTANCEDPROC                         gl3wDrawArraysInstanced;
-PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC             gl3wDrawArraysInstancedBaseInstance;
-PFNGLDRAWBUFFERPROC                                  gl3wDrawBuffer;
-PFNGLDRAWBUFFERSPROC                                 gl3wDrawBuffers;
-PFNGLDRAWELEMENTSPROC                                gl3wDrawElements;
-PFNGLDRAWELEMENTSBASEVERTEXPROC                      gl3wDrawElementsBaseVertex;
-PFNGLDRAWELEMENTSINDIRECTPROC                        gl3wDrawElementsIndirect;
-PFNGLDRAWELEMENTSINSTANCEDPROC                       gl3wDrawElementsInstanced;
-PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC           gl3wDrawElementsInstancedBaseInstance;
-PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC             gl3wDrawElementsInstancedBaseVertex;
-PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC gl3wDrawElementsInstancedBaseVertexBaseInstance;
-PFNGLDRAWRANGEELEMENTSPROC                           gl3wDrawRangeElements;
-PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC                 gl3wDrawRangeElementsBaseVertex;
-PFNGLDRAWTRANSFORMFEEDBACKPROC                       gl3wDrawTransformFeedback;
-PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC              gl3wDrawTransformFeedbackInstanced;
-PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC                 gl3wDrawTransformFeedbackStream;
-PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC        gl3wDrawTransformFeedbackStreamInstanced;
-PFNGLENABLEPROC                                      gl3wEnable;
-PFNGLENABLEVERTEXARRAYATTRIBPROC                     gl3wEnableVertexArrayAttrib;
-PFNGLENABLEVERTEXATTRIBARRAYPROC                     gl3wEnableVertexAttribArray;
-PFNGLENABLEIPROC                                     gl3wEnablei;
-PFNGLENDCONDITIONALRENDERPROC                        gl3wEndConditionalRender;
-PFNGLENDQUERYPROC                                    gl3wEndQuery;
-PFNGLENDQUERYINDEXEDPROC                             gl3wEndQueryIndexed;
-PFNGLENDTRANSFORMFEEDBACKPROC                        gl3wEndTransformFeedback;
-PFNGLFENCESYNCPROC                                   gl3wFenceSync;
-PFNGLFINISHPROC                                      gl3wFinish;
-PFNGLFLUSHPROC                                       gl3wFlush;
-PFNGLFLUSHMAPPEDBUFFERRANGEPROC                      gl3wFlushMappedBufferRange;
-PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC                 gl3wFlushMappedNamedBufferRange;
-PFNGLFRAMEBUFFERPARAMETERIPROC                       gl3wFramebufferParameteri;
-PFNGLFRAMEBUFFERRENDERBUFFERPROC                     gl3wFramebufferRenderbuffer;
-PFNGLFRAMEBUFFERTEXTUREPROC                          gl3wFramebufferTexture;
-PFNGLFRAMEBUFFERTEXTURE1DPROC                        gl3wFramebufferTexture1D;
-PFNGLFRAMEBUFFERTEXTURE2DPROC                        gl3wFramebufferTexture2D;
-PFNGLFRAMEBUFFERTEXTURE3DPROC                        gl3wFramebufferTexture3D;
-PFNGLFRAMEBUFFERTEXTURELAYERPROC                     gl3wFramebufferTextureLayer;
-PFNGLFRONTFACEPROC                                   gl3wFrontFace;
-PFNGLGENBUFFERSPROC                                  gl3wGenBuffers;
-PFNGLGENFRAMEBUFFERSPROC                             gl3wGenFramebuffers;
-PFNGLGENPROGRAMPIPELINESPROC                         gl3wGenProgramPipelines;
-PFNGLGENQUERIESPROC                                  gl3wGenQueries;
-PFNGLGENRENDERBUFFERSPROC                            gl3wGenRenderbuffers;
-PFNGLGENSAMPLERSPROC                                 gl3wGenSamplers;
-PFNGLGENTEXTURESPROC                                 gl3wGenTextures;
-PFNGLGENTRANSFORMFEEDBACKSPROC                       gl3wGenTransformFeedbacks;
-PFNGLGENVERTEXARRAYSPROC                             gl3wGenVertexArrays;
-PFNGLGENERATEMIPMAPPROC                              gl3wGenerateMipmap;
-PFNGLGENERATETEXTUREMIPMAPPROC                       gl3wGenerateTextureMipmap;
-PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC              gl3wGetActiveAtomicCounterBufferiv;
-PFNGLGETACTIVEATTRIBPROC                             gl3wGetActiveAttrib;
-PFNGLGETACTIVESUBROUTINENAMEPROC                     gl3wGetActiveSubroutineName;
-PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC              gl3wGetActiveSubroutineUniformName;
-PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC                gl3wGetActiveSubroutineUniformiv;
-PFNGLGETACTIVEUNIFORMPROC                            gl3wGetActiveUniform;
-PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC                   gl3wGetActiveUniformBlockName;
-PFNGLGETACTIVEUNIFORMBLOCKIVPROC                     gl3wGetActiveUniformBlockiv;
-PFNGLGETACTIVEUNIFORMNAMEPROC                        gl3wGetActiveUniformName;
-PFNGLGETACTIVEUNIFORMSIVPROC                         gl3wGetActiveUniformsiv;
-PFNGLGETATTACHEDSHADERSPROC                          gl3wGetAttachedShaders;
-PFNGLGETATTRIBLOCATIONPROC                           gl3wGetAttribLocation;
-PFNGLGETBOOLEANI_VPROC                               gl3wGetBooleani_v;
-PFNGLGETBOOLEANVPROC                                 gl3wGetBooleanv;
-PFNGLGETBUFFERPARAMETERI64VPROC                      gl3wGetBufferParameteri64v;
-PFNGLGETBUFFERPARAMETERIVPROC                        gl3wGetBufferParameteriv;
-PFNGLGETBUFFERPOINTERVPROC                           gl3wGetBufferPointerv;
-PFNGLGETBUFFERSUBDATAPROC                            gl3wGetBufferSubData;
-PFNGLGETCOMPRESSEDTEXIMAGEPROC                       gl3wGetCompressedTexImage;
-PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC                   gl3wGetCompressedTextureImage;
-PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC                gl3wGetCompressedTextureSubImage;
-PFNGLGETDEBUGMESSAGELOGPROC                          gl3wGetDebugMessageLog;
-PFNGLGETDEBUGMESSAGELOGARBPROC                       gl3wGetDebugMessageLogARB;
-PFNGLGETDOUBLEI_VPROC                                gl3wGetDoublei_v;
-PFNGLGETDOUBLEVPROC                                  gl3wGetDoublev;
-PFNGLGETERRORPROC                                    gl3wGetError;
-PFNGLGETFLOATI_VPROC                                 gl3wGetFloati_v;
-PFNGLGETFLOATVPROC                                   gl3wGetFloatv;
-PFNGLGETFRAGDATAINDEXPROC                            gl3wGetFragDataIndex;
-PFNGLGETFRAGDATALOCATIONPROC                         gl3wGetFragDataLocation;
-PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC         gl3wGetFramebufferAttachmentParameteriv;
-PFNGLGETFRAMEBUFFERPARAMETERIVPROC                   gl3wGetFramebufferParameteriv;
-PFNGLGETGRAPHICSRESETSTATUSPROC                      gl3wGetGraphicsResetStatus;
-PFNGLGETGRAPHICSRESETSTATUSARBPROC                   gl3wGetGraphicsResetStatusARB;
-PFNGLGETIMAGEHANDLEARBPROC                           gl3wGetImageHandleARB;
-PFNGLGETINTEGER64I_VPROC                             gl3wGetInteger64i_v;
-PFNGLGETINTEGER64VPROC                               gl3wGetInteger64v;
-PFNGLGETINTEGERI_VPROC                               gl3wGetIntegeri_v;
-PFNGLGETINTEGERVPROC                                 gl3wGetIntegerv;
-PFNGLGETINTERNALFORMATI64VPROC                       gl3wGetInternalformati64v;
-PFNGLGETINTERNALFORMATIVPROC                         gl3wGetInternalformativ;
-PFNGLGETMULTISAMPLEFVPROC                            gl3wGetMultisamplefv;
-PFNGLGETNAMEDBUFFERPARAMETERI64VPROC                 gl3wGetNamedBufferParameteri64v;
-PFNGLGETNAMEDBUFFERPARAMETERIVPROC                   gl3wGetNamedBufferParameteriv;
-PFNGLGETNAMEDBUFFERPOINTERVPROC                      gl3wGetNamedBufferPointerv;
-PFNGLGETNAMEDBUFFERSUBDATAPROC                       gl3wGetNamedBufferSubData;
-PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC    gl3wGetNamedFramebufferAttachmentParameteriv;
-PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC              gl3wGetNamedFramebufferParameteriv;
-PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC             gl3wGetNamedRenderbufferParameteriv;
-PFNGLGETNAMEDSTRINGARBPROC                           gl3wGetNamedStringARB;
-PFNGLGETNAMEDSTRINGIVARBPROC                         gl3wGetNamedStringivARB;
-PFNGLGETOBJECTLABELPROC                              gl3wGetObjectLabel;
-PFNGLGETOBJECTPTRLABELPROC                           gl3wGetObjectPtrLabel;
-PFNGLGETPOINTERVPROC                                 gl3wGetPointerv;
-PFNGLGETPROGRAMBINARYPROC                            gl3wGetProgramBinary;
-PFNGLGETPROGRAMINFOLOGPROC                           gl3wGetProgramInfoLog;
-PFNGLGETPROGRAMINTERFACEIVPROC                       gl3wGetProgramInterfaceiv;
-PFNGLGETPROGRAMPIPELINEINFOLOGPROC                   gl3wGetProgramPipelineInfoLog;
-PFNGLGETPROGRAMPIPELINEIVPROC                        gl3wGetProgramPipelineiv;
-PFNGLGETPROGRAMRESOURCEINDEXPROC                     gl3wGetProgramResourceIndex;
-PFNGLGETPROGRAMRESOURCELOCATIONPROC                  gl3wGetProgramResourceLocation;
-PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC             gl3wGetProgramResourceLocationIndex;
-PFNGLGETPROGRAMRESOURCENAMEPROC                      gl3wGetProgramResourceName;
-PFNGLGETPROGRAMRESOURCEIVPROC                        gl3wGetProgramResourceiv;
-PFNGLGETPROGRAMSTAGEIVPROC                           gl3wGetProgramStageiv;
-PFNGLGETPROGRAMIVPROC                                gl3wGetProgramiv;
-PFNGLGETQUERYBUFFEROBJECTI64VPROC                    gl3wGetQueryBufferObjecti64v;
-PFNGLGETQUERYBUFFEROBJECTIVPROC                      gl3wGetQueryBufferObjectiv;
-PFNGLGETQUERYBUFFEROBJECTUI64VPROC                   gl3wGetQueryBufferObjectui64v;
-PFNGLGETQUERYBUFFEROBJECTUIVPROC                     gl3wGetQueryBufferObjectuiv;
-PFNGLGETQUERYINDEXEDIVPROC                           gl3wGetQueryIndexediv;
-PFNGLGETQUERYOBJECTI64VPROC                          gl3wGetQueryObjecti64v;
-PFNGLGETQUERYOBJECTIVPROC                            gl3wGetQueryObjectiv;
-PFNGLGETQUERYOBJECTUI64VPROC                         gl3wGetQueryObjectui64v;
-PFNGLGETQUERYOBJECTUIVPROC                           gl3wGetQueryObjectuiv;
-PFNGLGETQUERYIVPROC                                  gl3wGetQueryiv;
-PFNGLGETRENDERBUFFERPARAMETERIVPROC                  gl3wGetRenderbufferParameteriv;
-PFNGLGETSAMPLERPARAMETERIIVPROC                      gl3wGetSamplerParameterIiv;
-PFNGLGETSAMPLERPARAMETERIUIVPROC                     gl3wGetSamplerParameterIuiv;
-PFNGLGETSAMPLERPARAMETERFVPROC                       gl3wGetSamplerParameterfv;
-PFNGLGETSAMPLERPARAMETERIVPROC                       gl3wGetSamplerParameteriv;
-PFNGLGETSHADERINFOLOGPROC                            gl3wGetShaderInfoLog;
-PFNGLGETSHADERPRECISIONFORMATPROC                    gl3wGetShaderPrecisionFormat;
-PFNGLGETSHADERSOURCEPROC                             gl3wGetShaderSource;
-PFNGLGETSHADERIVPROC                                 gl3wGetShaderiv;
-PFNGLGETSTRINGPROC                                   gl3wGetString;
-PFNGLGETSTRINGIPROC                                  gl3wGetStringi;
-PFNGLGETSUBROUTINEINDEXPROC                          gl3wGetSubroutineIndex;
-PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC                gl3wGetSubroutineUniformLocation;
-PFNGLGETSYNCIVPROC                                   gl3wGetSynciv;
-PFNGLGETTEXIMAGEPROC                                 gl3wGetTexImage;
-PFNGLGETTEXLEVELPARAMETERFVPROC                      gl3wGetTexLevelParameterfv;
-PFNGLGETTEXLEVELPARAMETERIVPROC                      gl3wGetTexLevelParameteriv;
-PFNGLGETTEXPARAMETERIIVPROC                          gl3wGetTexParameterIiv;
-PFNGLGETTEXPARAMETERIUIVPROC                         gl3wGetTexParameterIuiv;
-PFNGLGETTEXPARAMETERFVPROC                           gl3wGetTexParameterfv;
-PFNGLGETTEXPARAMETERIVPROC                           gl3wGetTexParameteriv;
-PFNGLGETTEXTUREHANDLEARBPROC                         gl3wGetTextureHandleARB;
-PFNGLGETTEXTUREIMAGEPROC                             gl3wGetTextureImage;
-PFNGLGETTEXTURELEVELPARAMETERFVPROC                  gl3wGetTextureLevelParameterfv;
-PFNGLGETTEXTURELEVELPARAMETERIVPROC                  gl3wGetTextureLevelParameteriv;
-PFNGLGETTEXTUREPARAMETERIIVPROC                      gl3wGetTextureParameterIiv;
-PFNGLGETTEXTUREPARAMETERIUIVPROC                     gl3wGetTextureParameterIuiv;
-PFNGLGETTEXTUREPARAMETERFVPROC                       gl3wGetTextureParameterfv;
-PFNGLGETTEXTUREPARAMETERIVPROC                       gl3wGetTextureParameteriv;
-PFNGLGETTEXTURESAMPLERHANDLEARBPROC                  gl3wGetTextureSamplerHandleARB;
-PFNGLGETTEXTURESUBIMAGEPROC                          gl3wGetTextureSubImage;
-PFNGLGETTRANSFORMFEEDBACKVARYINGPROC                 gl3wGetTransformFeedbackVarying;
-PFNGLGETTRANSFORMFEEDBACKI64_VPROC                   gl3wGetTransformFeedbacki64_v;
-PFNGLGETTRANSFORMFEEDBACKI_VPROC                     gl3wGetTransformFeedbacki_v;
-PFNGLGETTRANSFORMFEEDBACKIVPROC                      gl3wGetTransformFeedbackiv;
-PFNGLGETUNIFORMBLOCKINDEXPROC                        gl3wGetUniformBlockIndex;
-PFNGLGETUNIFORMINDICESPROC                           gl3wGetUniformIndices;
-PFNGLGETUNIFORMLOCATIONPROC                          gl3wGetUniformLocation;
-PFNGLGETUNIFORMSUBROUTINEUIVPROC                     gl3wGetUniformSubroutineuiv;
-PFNGLGETUNIFORMDVPROC                                gl3wGetUniformdv;
-PFNGLGETUNIFORMFVPROC                                gl3wGetUniformfv;
-PFNGLGETUNIFORMIVPROC                                gl3wGetUniformiv;
-PFNGLGETUNIFORMUIVPROC                               gl3wGetUniformuiv;
-PFNGLGETVERTEXARRAYINDEXED64IVPROC                   gl3wGetVertexArrayIndexed64iv;
-PFNGLGETVERTEXARRAYINDEXEDIVPROC                     gl3wGetVertexArrayIndexediv;
-PFNGLGETVERTEXARRAYIVPROC                            gl3wGetVertexArrayiv;
-PFNGLGETVERTEXATTRIBIIVPROC                          gl3wGetVertexAttribIiv;
-PFNGLGETVERTEXATTRIBIUIVPROC                         gl3wGetVertexAttribIuiv;
-PFNGLGETVERTEXATTRIBLDVPROC                          gl3wGetVertexAttribLdv;
-PFNGLGETVERTEXATTRIBLUI64VARBPROC                    gl3wGetVertexAttribLui64vARB;
-PFNGLGETVERTEXATTRIBPOINTERVPROC                     gl3wGetVertexAttribPointerv;
-PFNGLGETVERTEXATTRIBDVPROC                           gl3wGetVertexAttribdv;
-PFNGLGETVERTEXATTRIBFVPROC                           gl3wGetVertexAttribfv;
-PFNGLGETVERTEXATTRIBIVPROC                           gl3wGetVertexAttribiv;
-PFNGLGETNCOMPRESSEDTEXIMAGEPROC                      gl3wGetnCompressedTexImage;
-PFNGLGETNCOMPRESSEDTEXIMAGEARBPROC                   gl3wGetnCompressedTexImageARB;
-PFNGLGETNTEXIMAGEPROC                                gl3wGetnTexImage;
-PFNGLGETNTEXIMAGEARBPROC                             gl3wGetnTexImageARB;
-PFNGLGETNUNIFORMDVPROC                               gl3wGetnUniformdv;
-PFNGLGETNUNIFORMDVARBPROC                            gl3wGetnUniformdvARB;
-PFNGLGETNUNIFORMFVPROC                               gl3wGetnUniformfv;
-PFNGLGETNUNIFORMFVARBPROC                            gl3wGetnUniformfvARB;
-PFNGLGETNUNIFORMIVPROC                               gl3wGetnUniformiv;
-PFNGLGETNUNIFORMIVARBPROC                            gl3wGetnUniformivARB;
-PFNGLGETNUNIFORMUIVPROC                              gl3wGetnUniformuiv;
-PFNGLGETNUNIFORMUIVARBPROC                           gl3wGetnUniformuivARB;
-PFNGLHINTPROC                                        gl3wHint;
-PFNGLINVALIDATEBUFFERDATAPROC                        gl3wInvalidateBufferData;
-PFNGLINVALIDATEBUFFERSUBDATAPROC                     gl3wInvalidateBufferSubData;
-PFNGLINVALIDATEFRAMEBUFFERPROC                       gl3wInvalidateFramebuffer;
-PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC              gl3wInvalidateNamedFramebufferData;
-PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC           gl3wInvalidateNamedFramebufferSubData;
-PFNGLINVALIDATESUBFRAMEBUFFERPROC                    gl3wInvalidateSubFramebuffer;
-PFNGLINVALIDATETEXIMAGEPROC                          gl3wInvalidateTexImage;
-PFNGLINVALIDATETEXSUBIMAGEPROC                       gl3wInvalidateTexSubImage;
-PFNGLISBUFFERPROC                                    gl3wIsBuffer;
-PFNGLISENABLEDPROC                                   gl3wIsEnabled;
-PFNGLISENABLEDIPROC                                  gl3wIsEnabledi;
-PFNGLISFRAMEBUFFERPROC                               gl3wIsFramebuffer;
-PFNGLISIMAGEHANDLERESIDENTARBPROC                    gl3wIsImageHandleResidentARB;
-PFNGLISNAMEDSTRINGARBPROC                            gl3wIsNamedStringARB;
-PFNGLISPROGRAMPROC                                   gl3wIsProgram;
-PFNGLISPROGRAMPIPELINEPROC                           gl3wIsProgramPipeline;
-PFNGLISQUERYPROC                                     gl3wIsQuery;
-PFNGLISRENDERBUFFERPROC                              gl3wIsRenderbuffer;
-PFNGLISSAMPLERPROC                                   gl3wIsSampler;
-PFNGLISSHADERPROC                                    gl3wIsShader;
-PFNGLISSYNCPROC                                      gl3wIsSync;
-PFNGLISTEXTUREPROC                                   gl3wIsTexture;
-PFNGLISTEXTUREHANDLERESIDENTARBPROC                  gl3wIsTextureHandleResidentARB;
-PFNGLISTRANSFORMFEEDBACKPROC                         gl3wIsTransformFeedback;
-PFNGLISVERTEXARRAYPROC                               gl3wIsVertexArray;
-PFNGLLINEWIDTHPROC                                   gl3wLineWidth;
-PFNGLLINKPROGRAMPROC                                 gl3wLinkProgram;
-PFNGLLOGICOPPROC                                     gl3wLogicOp;
-PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC               gl3wMakeImageHandleNonResidentARB;
-PFNGLMAKEIMAGEHANDLERESIDENTARBPROC                  gl3wMakeImageHandleResidentARB;
-PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC             gl3wMakeTextureHandleNonResidentARB;
-PFNGLMAKETEXTUREHANDLERESIDENTARBPROC                gl3wMakeTextureHandleResidentARB;
-PFNGLMAPBUFFERPROC                                   gl3wMapBuffer;
-PFNGLMAPBUFFERRANGEPROC                              gl3wMapBufferRange;
-PFNGLMAPNAMEDBUFFERPROC                              gl3wMapNamedBuffer;
-PFNGLMAPNAMEDBUFFERRANGEPROC                         gl3wMapNamedBufferRange;
-PFNGLMEMORYBARRIERPROC                               gl3wMemoryBarrier;
-PFNGLMEMORYBARRIERBYREGIONPROC                       gl3wMemoryBarrierByRegion;
-PFNGLMINSAMPLESHADINGPROC                            gl3wMinSampleShading;
-PFNGLMINSAMPLESHADINGARBPROC                         gl3wMinSampleShadingARB;
-PFNGLMULTIDRAWARRAYSPROC                             gl3wMultiDrawArrays;
-PFNGLMULTIDRAWARRAYSINDIRECTPROC                     gl3wMultiDrawArraysIndirect;
-PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC             gl3wMultiDrawArraysIndirectCountARB;
-PFNGLMULTIDRAWELEMENTSPROC                           gl3wMultiDrawElements;
-PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC                 gl3wMultiDrawElementsBaseVertex;
-PFNGLMULTIDRAWELEMENTSINDIRECTPROC                   gl3wMultiDrawElementsIndirect;
-PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC           gl3wMultiDrawElementsIndirectCountARB;
-PFNGLNAMEDBUFFERDATAPROC                             gl3wNamedBufferData;
-PFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC                gl3wNamedBufferPageCommitmentARB;
-PFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC                gl3wNamedBufferPageCommitmentEXT;
-PFNGLNAMEDBUFFERSTORAGEPROC                          gl3wNamedBufferStorage;
-PFNGLNAMEDBUFFERSUBDATAPROC                          gl3wNamedBufferSubData;
-PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC                  gl3wNamedFramebufferDrawBuffer;
-PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC                 gl3wNamedFramebufferDrawBuffers;
-PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC                  gl3wNamedFramebufferParameteri;
-PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC                  gl3wNamedFramebufferReadBuffer;
-PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC                gl3wNamedFramebufferRenderbuffer;
-PFNGLNAMEDFRAMEBUFFERTEXTUREPROC                     gl3wNamedFramebufferTexture;
-PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC                gl3wNamedFramebufferTextureLayer;
-PFNGLNAMEDRENDERBUFFERSTORAGEPROC                    gl3wNamedRenderbufferStorage;
-PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC         gl3wNamedRenderbufferStorageMultisample;
-PFNGLNAMEDSTRINGARBPROC                              gl3wNamedStringARB;
-PFNGLOBJECTLABELPROC                                 gl3wObjectLabel;
-PFNGLOBJECTPTRLABELPROC                              gl3wObjectPtrLabel;
-PFNGLPATCHPARAMETERFVPROC                            gl3wPatchParameterfv;
-PFNGLPATCHPARAMETERIPROC                             gl3wPatchParameteri;
-PFNGLPAUSETRANSFORMFEEDBACKPROC                      gl3wPauseTransformFeedback;
-PFNGLPIXELSTOREFPROC                                 gl3wPixelStoref;
-PFNGLPIXELSTOREIPROC                                 gl3wPixelStorei;
-PFNGLPOINTPARAMETERFPROC                             gl3wPointParameterf;
-PFNGLPOINTPARAMETERFVPROC                            gl3wPointParameterfv;
-PFNGLPOINTPARAMETERIPROC                             gl3wPointParameteri;
-PFNGLPOINTPARAMETERIVPROC                            gl3wPointParameteriv;
-PFNGLPOINTSIZEPROC                                   gl3wPointSize;
-PFNGLPOLYGONMODEPROC                                 gl3wPolygonMode;
-PFNGLPOLYGONOFFSETPROC                               gl3wPolygonOffset;
-PFNGLPOPDEBUGGROUPPROC                               gl3wPopDebugGroup;
-PFNGLPRIMITIVERESTARTINDEXPROC                       gl3wPrimitiveRestartIndex;
-PFNGLPROGRAMBINARYPROC                               gl3wProgramBinary;
-PFNGLPROGRAMPARAMETERIPROC                           gl3wProgramParameteri;
-PFNGLPROGRAMUNIFORM1DPROC                            gl3wProgramUniform1d;
-PFNGLPROGRAMUNIFORM1DVPROC                           gl3wProgramUniform1dv;
-PFNGLPROGRAMUNIFORM1FPROC                            gl3wProgramUniform1f;
-PFNGLPROGRAMUNIFORM1FVPROC                           gl3wProgramUniform1fv;
-PFNGLPROGRAMUNIFORM1IPROC                            gl3wProgramUniform1i;
-PFNGLPROGRAMUNIFORM1IVPROC                           gl3wProgramUniform1iv;
-PFNGLPROGRAMUNIFORM1UIPROC                           gl3wProgramUniform1ui;
-PFNGLPROGRAMUNIFORM1UIVPROC                          gl3wProgramUniform1uiv;
-PFNGLPROGRAMUNIFORM2DPROC                            gl3wProgramUniform2d;
-PFNGLPROGRAMUNIFORM2DVPROC                           gl3wProgramUniform2dv;
-PFNGLPROGRAMUNIFORM2FPROC                            gl3wProgramUniform2f;
-PFNGLPROGRAMUNIFORM2FVPROC                           gl3wProgramUniform2fv;
-PFNGLPROGRAMUNIFORM2IPROC                            gl3wProgramUniform2i;
-PFNGLPROGRAMUNIFORM2IVPROC                           gl3wProgramUniform2iv;
-PFNGLPROGRAMUNIFORM2UIPROC                           gl3wProgramUniform2ui;
-PFNGLPROGRAMUNIFORM2UIVPROC                          gl3wProgramUniform2uiv;
-PFNGLPROGRAMUNIFORM3DPROC                            gl3wProgramUniform3d;
-PFNGLPROGRAMUNIFORM3DVPROC                           gl3wProgramUniform3dv;
-PFNGLPROGRAMUNIFORM3FPROC                            gl3wProgramUniform3f;
-PFNGLPROGRAMUNIFORM3FVPROC                           gl3wProgramUniform3fv;
-PFNGLPROGRAMUNIFORM3IPROC                            gl3wProgramUniform3i;
-PFNGLPROGRAMUNIFORM3IVPROC                           gl3wProgramUniform3iv;
-PFNGLPROGRAMUNIFORM3UIPROC                           gl3wProgramUniform3ui;
-PFNGLPROGRAMUNIFORM3UIVPROC                          gl3wProgramUniform3uiv;
-PFNGLPROGRAMUNIFORM4DPROC                            gl3wProgramUniform4d;
-PFNGLPROGRAMUNIFORM4DVPROC                           gl3wProgramUniform4dv;
-PFNGLPROGRAMUNIFORM4FPROC                            gl3wProgramUniform4f;
-PFNGLPROGRAMUNIFORM4FVPROC                           gl3wProgramUniform4fv;
-PFNGLPROGRAMUNIFORM4IPROC                            gl3wProgramUniform4i;
-PFNGLPROGRAMUNIFORM4IVPROC                           gl3wProgramUniform4iv;
-PFNGLPROGRAMUNIFORM4UIPROC                           gl3wProgramUniform4ui;
-PFNGLPROGRAMUNIFORM4UIVPROC                          gl3wProgramUniform4uiv;
-PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC                 gl3wProgramUniformHandleui64ARB;
-PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC                gl3wProgramUniformHandleui64vARB;
-PFNGLPROGRAMUNIFORMMATRIX2DVPROC                     gl3wProgramUniformMatrix2dv;
-PFNGLPROGRAMUNIFORMMATRIX2FVPROC                     gl3wProgramUniformMatrix2fv;
-PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC                   gl3wProgramUniformMatrix2x3dv;
-PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC                   gl3wProgramUniformMatrix2x3fv;
-PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC                   gl3wProgramUniformMatrix2x4dv;
-PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC                   gl3wProgramUniformMatrix2x4fv;
-PFNGLPROGRAMUNIFORMMATRIX3DVPROC                     gl3wProgramUniformMatrix3dv;
-PFNGLPROGRAMUNIFORMMATRIX3FVPROC                     gl3wProgramUniformMatrix3fv;
-PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC                   gl3wProgramUniformMatrix3x2dv;
-PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC                   gl3wProgramUniformMatrix3x2fv;
-PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC                   gl3wProgramUniformMatrix3x4dv;
-PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC                   gl3wProgramUniformMatrix3x4fv;
-PFNGLPROGRAMUNIFORMMATRIX4DVPROC                     gl3wProgramUniformMatrix4dv;
-PFNGLPROGRAMUNIFORMMATRIX4FVPROC                     gl3wProgramUniformMatrix4fv;
-PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC                   gl3wProgramUniformMatrix4x2dv;
-PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC                   gl3wProgramUniformMatrix4x2fv;
-PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC                   gl3wProgramUniformMatrix4x3dv;
-PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC                   gl3wProgramUniformMatrix4x3fv;
-PFNGLPROVOKINGVERTEXPROC                             gl3wProvokingVertex;
-PFNGLPUSHDEBUGGROUPPROC                              gl3wPushDebugGroup;
-PFNGLQUERYCOUNTERPROC                                gl3wQueryCounter;
-PFNGLREADBUFFERPROC                                  gl3wReadBuffer;
-PFNGLREADPIXELSPROC                                  gl3wReadPixels;
-PFNGLREADNPIXELSPROC                                 gl3wReadnPixels;
-PFNGLREADNPIXELSARBPROC                              gl3wReadnPixelsARB;
-PFNGLRELEASESHADERCOMPILERPROC                       gl3wReleaseShaderCompiler;
-PFNGLRENDERBUFFERSTORAGEPROC                         gl3wRenderbufferStorage;
-PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC              gl3wRenderbufferStorageMultisample;
-PFNGLRESUMETRANSFORMFEEDBACKPROC                     gl3wResumeTransformFeedback;
-PFNGLSAMPLECOVERAGEPROC                              gl3wSampleCoverage;
-PFNGLSAMPLEMASKIPROC                                 gl3wSampleMaski;
-PFNGLSAMPLERPARAMETERIIVPROC                         gl3wSamplerParameterIiv;
-PFNGLSAMPLERPARAMETERIUIVPROC                        gl3wSamplerParameterIuiv;
-PFNGLSAMPLERPARAMETERFPROC                           gl3wSamplerParameterf;
-PFNGLSAMPLERPARAMETERFVPROC                          gl3wSamplerParameterfv;
-PFNGLSAMPLERPARAMETERIPROC                           gl3wSamplerParameteri;
-PFNGLSAMPLERPARAMETERIVPROC                          gl3wSamplerParameteriv;
-PFNGLSCISSORPROC                                     gl3wScissor;
-PFNGLSCISSORARRAYVPROC                               gl3wScissorArrayv;
-PFNGLSCISSORINDEXEDPROC                              gl3wScissorIndexed;
-PFNGLSCISSORINDEXEDVPROC                             gl3wScissorIndexedv;
-PFNGLSHADERBINARYPROC                                gl3wShaderBinary;
-PFNGLSHADERSOURCEPROC                                gl3wShaderSource;
-PFNGLSHADERSTORAGEBLOCKBINDINGPROC                   gl3wShaderStorageBlockBinding;
-PFNGLSTENCILFUNCPROC                                 gl3wStencilFunc;
-PFNGLSTENCILFUNCSEPARATEPROC                         gl3wStencilFuncSeparate;
-PFNGLSTENCILMASKPROC                                 gl3wStencilMask;
-PFNGLSTENCILMASKSEPARATEPROC                         gl3wStencilMaskSeparate;
-PFNGLSTENCILOPPROC                                   gl3wStencilOp;
-PFNGLSTENCILOPSEPARATEPROC                           gl3wStencilOpSeparate;
-PFNGLTEXBUFFERPROC                                   gl3wTexBuffer;
-PFNGLTEXBUFFERRANGEPROC                              gl3wTexBufferRange;
-PFNGLTEXIMAGE1DPROC                                  gl3wTexImage1D;
-PFNGLTEXIMAGE2DPROC                                  gl3wTexImage2D;
-PFNGLTEXIMAGE2DMULTISAMPLEPROC                       gl3wTexImage2DMultisample;
-PFNGLTEXIMAGE3DPROC                                  gl3wTexImage3D;
-PFNGLTEXIMAGE3DMULTISAMPLEPROC                       gl3wTexImage3DMultisample;
-PFNGLTEXPAGECOMMITMENTARBPROC                        gl3wTexPageCommitmentARB;
-PFNGLTEXPARAMETERIIVPROC                             gl3wTexParameterIiv;
-PFNGLTEXPARAMETERIUIVPROC                            gl3wTexParameterIuiv;
-PFNGLTEXPARAMETERFPROC                               gl3wTexParameterf;
-PFNGLTEXPARAMETERFVPROC                              gl3wTexParameterfv;
-PFNGLTEXPARAMETERIPROC                               gl3wTexParameteri;
-PFNGLTEXPARAMETERIVPROC                              gl3wTexParameteriv;
-PFNGLTEXSTORAGE1DPROC                                gl3wTexStorage1D;
-PFNGLTEXSTORAGE2DPROC                                gl3wTexStorage2D;
-PFNGLTEXSTORAGE2DMULTISAMPLEPROC                     gl3wTexStorage2DMultisample;
-PFNGLTEXSTORAGE3DPROC                                gl3wTexStorage3D;
-PFNGLTEXSTORAGE3DMULTISAMPLEPROC                     gl3wTexStorage3DMultisample;
-PFNGLTEXSUBIMAGE1DPROC                               gl3wTexSubImage1D;
-PFNGLTEXSUBIMAGE2DPROC                               gl3wTexSubImage2D;
-PFNGLTEXSUBIMAGE3DPROC                               gl3wTexSubImage3D;
-PFNGLTEXTUREBARRIERPROC                              gl3wTextureBarrier;
-PFNGLTEXTUREBUFFERPROC                               gl3wTextureBuffer;
-PFNGLTEXTUREBUFFERRANGEPROC                          gl3wTextureBufferRange;
-PFNGLTEXTUREPARAMETERIIVPROC                         gl3wTextureParameterIiv;
-PFNGLTEXTUREPARAMETERIUIVPROC                        gl3wTextureParameterIuiv;
-PFNGLTEXTUREPARAMETERFPROC                           gl3wTextureParameterf;
-PFNGLTEXTUREPARAMETERFVPROC                          gl3wTextureParameterfv;
-PFNGLTEXTUREPARAMETERIPROC                           gl3wTextureParameteri;
-PFNGLTEXTUREPARAMETERIVPROC                          gl3wTextureParameteriv;
-PFNGLTEXTURESTORAGE1DPROC                            gl3wTextureStorage1D;
-PFNGLTEXTURESTORAGE2DPROC                            gl3wTextureStorage2D;
-PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC                 gl3wTextureStorage2DMultisample;
-PFNGLTEXTURESTORAGE3DPROC                            gl3wTextureStorage3D;
-PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC                 gl3wTextureStorage3DMultisample;
-PFNGLTEXTURESUBIMAGE1DPROC                           gl3wTextureSubImage1D;
-PFNGLTEXTURESUBIMAGE2DPROC                           gl3wTextureSubImage2D;
-PFNGLTEXTURESUBIMAGE3DPROC                           gl3wTextureSubImage3D;
-PFNGLTEXTUREVIEWPROC                                 gl3wTextureView;
-PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC                 gl3wTransformFeedbackBufferBase;
-PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC                gl3wTransformFeedbackBufferRange;
-PFNGLTRANSFORMFEEDBACKVARYINGSPROC                   gl3wTransformFeedbackVaryings;
-PFNGLUNIFORM1DPROC                                   gl3wUniform1d;
-PFNGLUNIFORM1DVPROC                                  gl3wUniform1dv;
-PFNGLUNIFORM1FPROC                                   gl3wUniform1f;
-PFNGLUNIFORM1FVPROC                                  gl3wUniform1fv;
-PFNGLUNIFORM1IPROC                                   gl3wUniform1i;
-PFNGLUNIFORM1IVPROC                                  gl3wUniform1iv;
-PFNGLUNIFORM1UIPROC                                  gl3wUniform1ui;
-PFNGLUNIFORM1UIVPROC                                 gl3wUniform1uiv;
-PFNGLUNIFORM2DPROC                                   gl3wUniform2d;
-PFNGLUNIFORM2DVPROC                                  gl3wUniform2dv;
-PFNGLUNIFORM2FPROC                                   gl3wUniform2f;
-PFNGLUNIFORM2FVPROC                                  gl3wUniform2fv;
-PFNGLUNIFORM2IPROC                                   gl3wUniform2i;
-PFNGLUNIFORM2IVPROC                                  gl3wUniform2iv;
-PFNGLUNIFORM2UIPROC                                  gl3wUniform2ui;
-PFNGLUNIFORM2UIVPROC                                 gl3wUniform2uiv;
-PFNGLUNIFORM3DPROC                                   gl3wUniform3d;
-PFNGLUNIFORM3DVPROC                                  gl3wUniform3dv;
-PFNGLUNIFORM3FPROC                                   gl3wUniform3f;
-PFNGLUNIFORM3FVPROC                                  gl3wUniform3fv;
-PFNGLUNIFORM3IPROC                                   gl3wUniform3i;
-PFNGLUNIFORM3IVPROC                                  gl3wUniform3iv;
-PFNGLUNIFORM3UIPROC                                  gl3wUniform3ui;
-PFNGLUNIFORM3UIVPROC                                 gl3wUniform3uiv;
-PFNGLUNIFORM4DPROC                                   gl3wUniform4d;
-PFNGLUNIFORM4DVPROC                                  gl3wUniform4dv;
-PFNGLUNIFORM4FPROC                                   gl3wUniform4f;
-PFNGLUNIFORM4FVPROC                                  gl3wUniform4fv;
-PFNGLUNIFORM4IPROC                                   gl3wUniform4i;
-PFNGLUNIFORM4IVPROC                                  gl3wUniform4iv;
-PFNGLUNIFORM4UIPROC                                  gl3wUniform4ui;
-PFNGLUNIFORM4UIVPROC                                 gl3wUniform4uiv;
-PFNGLUNIFORMBLOCKBINDINGPROC                         gl3wUniformBlockBinding;
-PFNGLUNIFORMHANDLEUI64ARBPROC                        gl3wUniformHandleui64ARB;
-PFNGLUNIFORMHANDLEUI64VARBPROC                       gl3wUniformHandleui64vARB;
-PFNGLUNIFORMMATRIX2DVPROC                            gl3wUniformMatrix2dv;
-PFNGLUNIFORMMATRIX2FVPROC                            gl3wUniformMatrix2fv;
-PFNGLUNIFORMMATRIX2X3DVPROC                          gl3wUniformMatrix2x3dv;
-PFNGLUNIFORMMATRIX2X3FVPROC                          gl3wUniformMatrix2x3fv;
-PFNGLUNIFORMMATRIX2X4DVPROC                          gl3wUniformMatrix2x4dv;
-PFNGLUNIFORMMATRIX2X4FVPROC                          gl3wUniformMatrix2x4fv;
-PFNGLUNIFORMMATRIX3DVPROC                            gl3wUniformMatrix3dv;
-PFNGLUNIFORMMATRIX3FVPROC                            gl3wUniformMatrix3fv;
-PFNGLUNIFORMMATRIX3X2DVPROC                          gl3wUniformMatrix3x2dv;
-PFNGLUNIFORMMATRIX3X2FVPROC                          gl3wUniformMatrix3x2fv;
-PFNGLUNIFORMMATRIX3X4DVPROC                          gl3wUniformMatrix3x4dv;
-PFNGLUNIFORMMATRIX3X4FVPROC                          gl3wUniformMatrix3x4fv;
-PFNGLUNIFORMMATRIX4DVPROC                            gl3wUniformMatrix4dv;
-PFNGLUNIFORMMATRIX4FVPROC                            gl3wUniformMatrix4fv;
-PFNGLUNIFORMMATRIX4X2DVPROC                          gl3wUniformMatrix4x2dv;
-PFNGLUNIFORMMATRIX4X2FVPROC                          gl3wUniformMatrix4x2fv;
-PFNGLUNIFORMMATRIX4X3DVPROC                          gl3wUniformMatrix4x3dv;
-PFNGLUNIFORMMATRIX4X3FVPROC                          gl3wUniformMatrix4x3fv;
-PFNGLUNIFORMSUBROUTINESUIVPROC                       gl3wUniformSubroutinesuiv;
-PFNGLUNMAPBUFFERPROC                                 gl3wUnmapBuffer;
-PFNGLUNMAPNAMEDBUFFERPROC                            gl3wUnmapNamedBuffer;
-PFNGLUSEPROGRAMPROC                                  gl3wUseProgram;
-PFNGLUSEPROGRAMSTAGESPROC                            gl3wUseProgramStages;
-PFNGLVALIDATEPROGRAMPROC                             gl3wValidateProgram;
-PFNGLVALIDATEPROGRAMPIPELINEPROC                     gl3wValidateProgramPipeline;
-PFNGLVERTEXARRAYATTRIBBINDINGPROC                    gl3wVertexArrayAttribBinding;
-PFNGLVERTEXARRAYATTRIBFORMATPROC                     gl3wVertexArrayAttribFormat;
-PFNGLVERTEXARRAYATTRIBIFORMATPROC                    gl3wVertexArrayAttribIFormat;
-PFNGLVERTEXARRAYATTRIBLFORMATPROC                    gl3wVertexArrayAttribLFormat;
-PFNGLVERTEXARRAYBINDINGDIVISORPROC                   gl3wVertexArrayBindingDivisor;
-PFNGLVERTEXARRAYELEMENTBUFFERPROC                    gl3wVertexArrayElementBuffer;
-PFNGLVERTEXARRAYVERTEXBUFFERPROC                     gl3wVertexArrayVertexBuffer;
-PFNGLVERTEXARRAYVERTEXBUFFERSPROC                    gl3wVertexArrayVertexBuffers;
-PFNGLVERTEXATTRIB1DPROC                              gl3wVertexAttrib1d;
-PFNGLVERTEXATTRIB1DVPROC                             gl3wVertexAttrib1dv;
-PFNGLVERTEXATTRIB1FPROC                              gl3wVertexAttrib1f;
-PFNGLVERTEXATTRIB1FVPROC                             gl3wVertexAttrib1fv;
-PFNGLVERTEXATTRIB1SPROC                              gl3wVertexAttrib1s;
-PFNGLVERTEXATTRIB1SVPROC                             gl3wVertexAttrib1sv;
-PFNGLVERTEXATTRIB2DPROC                              gl3wVertexAttrib2d;
-PFNGLVERTEXATTRIB2DVPROC                             gl3wVertexAttrib2dv;
-PFNGLVERTEXATTRIB2FPROC                              gl3wVertexAttrib2f;
-PFNGLVERTEXATTRIB2FVPROC                             gl3wVertexAttrib2fv;
-PFNGLVERTEXATTRIB2SPROC                              gl3wVertexAttrib2s;
-PFNGLVERTEXATTRIB2SVPROC                             gl3wVertexAttrib2sv;
-PFNGLVERTEXATTRIB3DPROC                              gl3wVertexAttrib3d;
-PFNGLVERTEXATTRIB3DVPROC                             gl3wVertexAttrib3dv;
-PFNGLVERTEXATTRIB3FPROC                              gl3wVertexAttrib3f;
-PFNGLVERTEXATTRIB3FVPROC                             gl3wVertexAttrib3fv;
-PFNGLVERTEXATTRIB3SPROC                              gl3wVertexAttrib3s;
-PFNGLVERTEXATTRIB3SVPROC                             gl3wVertexAttrib3sv;
-PFNGLVERTEXATTRIB4NBVPROC                            gl3wVertexAttrib4Nbv;
-PFNGLVERTEXATTRIB4NIVPROC                            gl3wVertexAttrib4Niv;
-PFNGLVERTEXATTRIB4NSVPROC                            gl3wVertexAttrib4Nsv;
-PFNGLVERTEXATTRIB4NUBPROC                            gl3wVertexAttrib4Nub;
-PFNGLVERTEXATTRIB4NUBVPROC                           gl3wVertexAttrib4Nubv;
-PFNGLVERTEXATTRIB4NUIVPROC                           gl3wVertexAttrib4Nuiv;
-PFNGLVERTEXATTRIB4NUSVPROC                           gl3wVertexAttrib4Nusv;
-PFNGLVERTEXATTRIB4BVPROC                             gl3wVertexAttrib4bv;
-PFNGLVERTEXATTRIB4DPROC                              gl3wVertexAttrib4d;
-PFNGLVERTEXATTRIB4DVPROC                             gl3wVertexAttrib4dv;
-PFNGLVERTEXATTRIB4FPROC                              gl3wVertexAttrib4f;
-PFNGLVERTEXATTRIB4FVPROC                             gl3wVertexAttrib4fv;
-PFNGLVERTEXATTRIB4IVPROC                             gl3wVertexAttrib4iv;
-PFNGLVERTEXATTRIB4SPROC                              gl3wVertexAttrib4s;
-PFNGLVERTEXATTRIB4SVPROC                             gl3wVertexAttrib4sv;
-PFNGLVERTEXATTRIB4UBVPROC                            gl3wVertexAttrib4ubv;
-PFNGLVERTEXATTRIB4UIVPROC                            gl3wVertexAttrib4uiv;
-PFNGLVERTEXATTRIB4USVPROC                            gl3wVertexAttrib4usv;
-PFNGLVERTEXATTRIBBINDINGPROC                         gl3wVertexAttribBinding;
-PFNGLVERTEXATTRIBDIVISORPROC                         gl3wVertexAttribDivisor;
-PFNGLVERTEXATTRIBFORMATPROC                          gl3wVertexAttribFormat;
-PFNGLVERTEXATTRIBI1IPROC                             gl3wVertexAttribI1i;
-PFNGLVERTEXATTRIBI1IVPROC                            gl3wVertexAttribI1iv;
-PFNGLVERTEXATTRIBI1UIPROC                            gl3wVertexAttribI1ui;
-PFNGLVERTEXATTRIBI1UIVPROC                           gl3wVertexAttribI1uiv;
-PFNGLVERTEXATTRIBI2IPROC                             gl3wVertexAttribI2i;
-PFNGLVERTEXATTRIBI2IVPROC                            gl3wVertexAttribI2iv;
-PFNGLVERTEXATTRIBI2UIPROC                            gl3wVertexAttribI2ui;
-PFNGLVERTEXATTRIBI2UIVPROC                           gl3wVertexAttribI2uiv;
-PFNGLVERTEXATTRIBI3IPROC                             gl3wVertexAttribI3i;
-PFNGLVERTEXATTRIBI3IVPROC                            gl3wVertexAttribI3iv;
-PFNGLVERTEXATTRIBI3UIPROC                            gl3wVertexAttribI3ui;
-PFNGLVERTEXATTRIBI3UIVPROC                           gl3wVertexAttribI3uiv;
-PFNGLVERTEXATTRIBI4BVPROC                            gl3wVertexAttribI4bv;
-PFNGLVERTEXATTRIBI4IPROC                             gl3wVertexAttribI4i;
-PFNGLVERTEXATTRIBI4IVPROC                            gl3wVertexAttribI4iv;
-PFNGLVERTEXATTRIBI4SVPROC                            gl3wVertexAttribI4sv;
-PFNGLVERTEXATTRIBI4UBVPROC                           gl3wVertexAttribI4ubv;
-PFNGLVERTEXATTRIBI4UIPROC                            gl3wVertexAttribI4ui;
-PFNGLVERTEXATTRIBI4UIVPROC                           gl3wVertexAttribI4uiv;
-PFNGLVERTEXATTRIBI4USVPROC                           gl3wVertexAttribI4usv;
-PFNGLVERTEXATTRIBIFORMATPROC                         gl3wVertexAttribIFormat;
-PFNGLVERTEXATTRIBIPOINTERPROC                        gl3wVertexAttribIPointer;
-PFNGLVERTEXATTRIBL1DPROC                             gl3wVertexAttribL1d;
-PFNGLVERTEXATTRIBL1DVPROC                            gl3wVertexAttribL1dv;
-PFNGLVERTEXATTRIBL1UI64ARBPROC                       gl3wVertexAttribL1ui64ARB;
-PFNGLVERTEXATTRIBL1UI64VARBPROC                      gl3wVertexAttribL1ui64vARB;
-PFNGLVERTEXATTRIBL2DPROC                             gl3wVertexAttribL2d;
-PFNGLVERTEXATTRIBL2DVPROC                            gl3wVertexAttribL2dv;
-PFNGLVERTEXATTRIBL3DPROC                             gl3wVertexAttribL3d;
-PFNGLVERTEXATTRIBL3DVPROC                            gl3wVertexAttribL3dv;
-PFNGLVERTEXATTRIBL4DPROC                             gl3wVertexAttribL4d;
-PFNGLVERTEXATTRIBL4DVPROC                            gl3wVertexAttribL4dv;
-PFNGLVERTEXATTRIBLFORMATPROC                         gl3wVertexAttribLFormat;
-PFNGLVERTEXATTRIBLPOINTERPROC                        gl3wVertexAttribLPointer;
-PFNGLVERTEXATTRIBP1UIPROC                            gl3wVertexAttribP1ui;
-PFNGLVERTEXATTRIBP1UIVPROC                           gl3wVertexAttribP1uiv;
-PFNGLVERTEXATTRIBP2UIPROC                            gl3wVertexAttribP2ui;
-PFNGLVERTEXATTRIBP2UIVPROC                           gl3wVertexAttribP2uiv;
-PFNGLVERTEXATTRIBP3UIPROC                            gl3wVertexAttribP3ui;
-PFNGLVERTEXATTRIBP3UIVPROC                           gl3wVertexAttribP3uiv;
-PFNGLVERTEXATTRIBP4UIPROC                            gl3wVertexAttribP4ui;
-PFNGLVERTEXATTRIBP4UIVPROC                           gl3wVertexAttribP4uiv;
-PFNGLVERTEXATTRIBPOINTERPROC                         gl3wVertexAttribPointer;
-PFNGLVERTEXBINDINGDIVISORPROC                        gl3wVertexBindingDivisor;
-PFNGLVIEWPORTPROC                                    gl3wViewport;
-PFNGLVIEWPORTARRAYVPROC                              gl3wViewportArrayv;
-PFNGLVIEWPORTINDEXEDFPROC                            gl3wViewportIndexedf;
-PFNGLVIEWPORTINDEXEDFVPROC                           gl3wViewportIndexedfv;
-PFNGLWAITSYNCPROC                                    gl3wWaitSync;
+	return lookup_proc(proc);
+}
+
+int gl3wGetProcAddresses(const char *const *procs, GL3WglProc *res, int count)
+{
+	int i, j, found = 0;
+
+	for (i = 0; i < count; i++) {
+		res[i] = NULL;
+		if (gl3wProcIndex(procs[i]) < 0) {
+			for (j = 0; j < i; j++) {
+				if (!strcmp(procs[i], procs[j])) {
+					res[i] = res[j];
+					break;
+				}
+			}
+			if (j < i) {
+				found += res[i] != NULL;
+				continue;
+			}
+		}
+		res[i] = lookup_proc(procs[i]);
+		found += res[i] != NULL;
+	}
+	return found;
+}
+
+union GL3WProcs gl3wProcs;
 
 static void load_procs(void)
 {
-	gl3wActiveShaderProgram = (PFNGLACTIVESHADERPROGRAMPROC) get_proc("glActiveShaderProgram");
-	gl3wActiveTexture = (PFNGLACTIVETEXTUREPROC) get_proc("glActiveTexture");
-	gl3wAttachShader = (PFNGLATTACHSHADERPROC) get_proc("glAttachShader");
-	gl3wBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC) get_proc("glBeginConditionalRender");
-	gl3wBeginQuery = (PFNGLBEGINQUERYPROC) get_proc("glBeginQuery");
-	gl3wBeginQueryIndexed = (PFNGLBEGINQUERYINDEXEDPROC) get_proc("glBeginQueryIndexed");
-	gl3wBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC) get_proc("glBeginTransformFeedback");
-	gl3wBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC) get_proc("glBindAttribLocation");
-	gl3wBindBuffer = (PFNGLBINDBUFFERPROC) get_proc("glBindBuffer");
-	gl3wBindBufferBase = (PFNGLBINDBUFFERBASEPROC) get_proc("glBindBufferBase");
-	gl3wBindBufferRange = (PFNGLBINDBUFFERRANGEPROC) get_proc("glBindBufferRange");
-	gl3wBindBuffersBase = (PFNGLBINDBUFFERSBASEPROC) get_proc("glBindBuffersBase");
-	gl3wBindBuffersRange = (PFNGLBINDBUFFERSRANGEPROC) get_proc("glBindBuffersRange");
-	gl3wBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC) get_proc("glBindFragDataLocation");
-	gl3wBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC) get_proc("glBindFragDataLocationIndexed");
-	gl3wBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC) get_proc("glBindFramebuffer");
-	gl3wBindImageTexture = (PFNGLBINDIMAGETEXTUREPROC) get_proc("glBindImageTexture");
-	gl3wBindImageTextures = (PFNGLBINDIMAGETEXTURESPROC) get_proc("glBindImageTextures");
-	gl3wBindProgramPipeline = (PFNGLBINDPROGRAMPIPELINEPROC) get_proc("glBindProgramPipeline");
-	gl3wBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC) get_proc("glBindRenderbuffer");
-	gl3wBindSampler = (PFNGLBINDSAMPLERPROC) get_proc("glBindSampler");
-	gl3wBindSamplers = (PFNGLBINDSAMPLERSPROC) get_proc("glBindSamplers");
-	gl3wBindTexture = (PFNGLBINDTEXTUREPROC) get_proc("glBindTexture");
-	gl3wBindTextureUnit = (PFNGLBINDTEXTUREUNITPROC) get_proc("glBindTextureUnit");
-	gl3wBindTextures = (PFNGLBINDTEXTURESPROC) get_proc("glBindTextures");
-	gl3wBindTransformFeedback = (PFNGLBINDTRANSFORMFEEDBACKPROC) get_proc("glBindTransformFeedback");
-	gl3wBindVertexArray = (PFNGLBINDVERTEXARRAYPROC) get_proc("glBindVertexArray");
-	gl3wBindVertexBuffer = (PFNGLBINDVERTEXBUFFERPROC) get_proc("glBindVertexBuffer");
-	gl3wBindVertexBuffers = (PFNGLBINDVERTEXBUFFERSPROC) get_proc("glBindVertexBuffers");
-	gl3wBlendColor = (PFNGLBLENDCOLORPROC) get_proc("glBlendColor");
-	gl3wBlendEquation = (PFNGLBLENDEQUATIONPROC) get_proc("glBlendEquation");
-	gl3wBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC) get_proc("glBlendEquationSeparate");
-	gl3wBlendEquationSeparatei = (PFNGLBLENDEQUATIONSEPARATEIPROC) get_proc("glBlendEquationSeparatei");
-	gl3wBlendEquationSeparateiARB = (PFNGLBLENDEQUATIONSEPARATEIARBPROC) get_proc("glBlendEquationSeparateiARB");
-	gl3wBlendEquationi = (PFNGLBLENDEQUATIONIPROC) get_proc("glBlendEquationi");
-	gl3wBlendEquationiARB = (PFNGLBLENDEQUATIONIARBPROC) get_proc("glBlendEquationiARB");
-	gl3wBlendFunc = (PFNGLBLENDFUNCPROC) get_proc("glBlendFunc");
-	gl3wBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC) get_proc("glBlendFuncSeparate");
-	gl3wBlendFuncSeparatei = (PFNGLBLENDFUNCSEPARATEIPROC) get_proc("glBlendFuncSeparatei");
-	gl3wBlendFuncSeparateiARB = (PFNGLBLENDFUNCSEPARATEIARBPROC) get_proc("glBlendFuncSeparateiARB");
-	gl3wBlendFunci = (PFNGLBLENDFUNCIPROC) get_proc("glBlendFunci");
-	gl3wBlendFunciARB = (PFNGLBLENDFUNCIARBPROC) get_proc("glBlendFunciARB");
-	gl3wBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC) get_proc("glBlitFramebuffer");
-	gl3wBlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC) get_proc("glBlitNamedFramebuffer");
-	gl3wBufferData = (PFNGLBUFFERDATAPROC) get_proc("glBufferData");
-	gl3wBufferPageCommitmentARB = (PFNGLBUFFERPAGECOMMITMENTARBPROC) get_proc("glBufferPageCommitmentARB");
-	gl3wBufferStorage = (PFNGLBUFFERSTORAGEPROC) get_proc("glBufferStorage");
-	gl3wBufferSubData = (PFNGLBUFFERSUBDATAPROC) get_proc("glBufferSubData");
-	gl3wCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC) get_proc("glCheckFramebufferStatus");
-	gl3wCheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC) get_proc("glCheckNamedFramebufferStatus");
-	gl3wClampColor = (PFNGLCLAMPCOLORPROC) get_proc("glClampColor");
-	gl3wClear = (PFNGLCLEARPROC) get_proc("glClear");
-	gl3wClearBufferData = (PFNGLCLEARBUFFERDATAPROC) get_proc("glClearBufferData");
-	gl3wClearBufferSubData = (PFNGLCLEARBUFFERSUBDATAPROC) get_proc("glClearBufferSubData");
-	gl3wClearBufferfi = (PFNGLCLEARBUFFERFIPROC) get_proc("glClearBufferfi");
-	gl3wClearBufferfv = (PFNGLCLEARBUFFERFVPROC) get_proc("glClearBufferfv");
-	gl3wClearBufferiv = (PFNGLCLEARBUFFERIVPROC) get_proc("glClearBufferiv");
-	gl3wClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC) get_proc("glClearBufferuiv");
-	gl3wClearColor = (PFNGLCLEARCOLORPROC) get_proc("glClearColor");
-	gl3wClearDepth = (PFNGLCLEARDEPTHPROC) get_proc("glClearDepth");
-	gl3wClearDepthf = (PFNGLCLEARDEPTHFPROC) get_proc("glClearDepthf");
-	gl3wClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC) get_proc("glClearNamedBufferData");
-	gl3wClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC) get_proc("glClearNamedBufferSubData");
-	gl3wClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC) get_proc("glClearNamedFramebufferfi");
-	gl3wClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC) get_proc("glClearNamedFramebufferfv");
-	gl3wClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC) get_proc("glClearNamedFramebufferiv");
-	gl3wClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC) get_proc("glClearNamedFramebufferuiv");
-	gl3wClearStencil = (PFNGLCLEARSTENCILPROC) get_proc("glClearStencil");
-	gl3wClearTexImage = (PFNGLCLEARTEXIMAGEPROC) get_proc("glClearTexImage");
-	gl3wClearTexSubImage = (PFNGLCLEARTEXSUBIMAGEPROC) get_proc("glClearTexSubImage");
-	gl3wClientWaitSync = (PFNGLCLIENTWAITSYNCPROC) get_proc("glClientWaitSync");
-	gl3wClipControl = (PFNGLCLIPCONTROLPROC) get_proc("glClipControl");
-	gl3wColorMask = (PFNGLCOLORMASKPROC) get_proc("glColorMask");
-	gl3wColorMaski = (PFNGLCOLORMASKIPROC) get_proc("glColorMaski");
-	gl3wCompileShader = (PFNGLCOMPILESHADERPROC) get_proc("glCompileShader");
-	gl3wCompileShaderIncludeARB = (PFNGLCOMPILESHADERINCLUDEARBPROC) get_proc("glCompileShaderIncludeARB");
-	gl3wCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC) get_proc("glCompressedTexImage1D");
-	gl3wCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC) get_proc("glCompressedTexImage2D");
-	gl3wCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC) get_proc("glCompressedTexImage3D");
-	gl3wCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC) get_proc("glCompressedTexSubImage1D");
-	gl3wCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC) get_proc("glCompressedTexSubImage2D");
-	gl3wCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC) get_proc("glCompressedTexSubImage3D");
-	gl3wCompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC) get_proc("glCompressedTextureSubImage1D");
-	gl3wCompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC) get_proc("glCompressedTextureSubImage2D");
-	gl3wCompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC) get_proc("glCompressedTextureSubImage3D");
-	gl3wCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC) get_proc("glCopyBufferSubData");
-	gl3wCopyImageSubData = (PFNGLCOPYIMAGESUBDATAPROC) get_proc("glCopyImageSubData");
-	gl3wCopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC) get_proc("glCopyNamedBufferSubData");
-	gl3wCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC) get_proc("glCopyTexImage1D");
-	gl3wCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC) get_proc("glCopyTexImage2D");
-	gl3wCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC) get_proc("glCopyTexSubImage1D");
-	gl3wCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC) get_proc("glCopyTexSubImage2D");
-	gl3wCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC) get_proc("glCopyTexSubImage3D");
-	gl3wCopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC) get_proc("glCopyTextureSubImage1D");
-	gl3wCopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC) get_proc("glCopyTextureSubImage2D");
-	gl3wCopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC) get_proc("glCopyTextureSubImage3D");
-	gl3wCreateBuffers = (PFNGLCREATEBUFFERSPROC) get_proc("glCreateBuffers");
-	gl3wCreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC) get_proc("glCreateFramebuffers");
-	gl3wCreateProgram = (PFNGLCREATEPROGRAMPROC) get_proc("glCreateProgram");
-	gl3wCreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC) get_proc("glCreateProgramPipelines");
-	gl3wCreateQueries = (PFNGLCREATEQUERIESPROC) get_proc("glCreateQueries");
-	gl3wCreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC) get_proc("glCreateRenderbuffers");
-	gl3wCreateSamplers = (PFNGLCREATESAMPLERSPROC) get_proc("glCreateSamplers");
-	gl3wCreateShader = (PFNGLCREATESHADERPROC) get_proc("glCreateShader");
-	gl3wCreateShaderProgramv = (PFNGLCREATESHADERPROGRAMVPROC) get_proc("glCreateShaderProgramv");
-	gl3wCreateSyncFromCLeventARB = (PFNGLCREATESYNCFROMCLEVENTARBPROC) get_proc("glCreateSyncFromCLeventARB");
-	gl3wCreateTextures = (PFNGLCREATETEXTURESPROC) get_proc("glCreateTextures");
-	gl3wCreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC) get_proc("glCreateTransformFeedbacks");
-	gl3wCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC) get_proc("glCreateVertexArrays");
-	gl3wCullFace = (PFNGLCULLFACEPROC) get_proc("glCullFace");
-	gl3wDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC) get_proc("glDebugMessageCallback");
-	gl3wDebugMessageCallbackARB = (PFNGLDEBUGMESSAGECALLBACKARBPROC) get_proc("glDebugMessageCallbackARB");
-	gl3wDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC) get_proc("glDebugMessageControl");
-	gl3wDebugMessageControlARB = (PFNGLDEBUGMESSAGECONTROLARBPROC) get_proc("glDebugMessageControlARB");
-	gl3wDebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC) get_proc("glDebugMessageInsert");
-	gl3wDebugMessageInsertARB = (PFNGLDEBUGMESSAGEINSERTARBPROC) get_proc("glDebugMessageInsertARB");
-	gl3wDeleteBuffers = (PFNGLDELETEBUFFERSPROC) get_proc("glDeleteBuffers");
-	gl3wDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC) get_proc("glDeleteFramebuffers");
-	gl3wDeleteNamedStringARB = (PFNGLDELETENAMEDSTRINGARBPROC) get_proc("glDeleteNamedStringARB");
-	gl3wDeleteProgram = (PFNGLDELETEPROGRAMPROC) get_proc("glDeleteProgram");
-	gl3wDeleteProgramPipelines = (PFNGLDELETEPROGRAMPIPELINESPROC) get_proc("glDeleteProgramPipelines");
-	gl3wDeleteQueries = (PFNGLDELETEQUERIESPROC) get_proc("glDeleteQueries");
-	gl3wDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC) get_proc("glDeleteRenderbuffers");
-	gl3wDeleteSamplers = (PFNGLDELETESAMPLERSPROC) get_proc("glDeleteSamplers");
-	gl3wDeleteShader = (PFNGLDELETESHADERPROC) get_proc("glDeleteShader");
-	gl3wDeleteSync = (PFNGLDELETESYNCPROC) get_proc("glDeleteSync");
-	gl3wDeleteTextures = (PFNGLDELETETEXTURESPROC) get_proc("glDeleteTextures");
-	gl3wDeleteTransformFeedbacks = (PFNGLDELETETRANSFORMFEEDBACKSPROC) get_proc("glDeleteTransformFeedbacks");
-	gl3wDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC) get_proc("glDeleteVertexArrays");
-	gl3wDepthFunc = (PFNGLDEPTHFUNCPROC) get_proc("glDepthFunc");
-	gl3wDepthMask = (PFNGLDEPTHMASKPROC) get_proc("glDepthMask");
-	gl3wDepthRange = (PFNGLDEPTHRANGEPROC) get_proc("glDepthRange");
-	gl3wDepthRangeArrayv = (PFNGLDEPTHRANGEARRAYVPROC) get_proc("glDepthRangeArrayv");
-	gl3wDepthRangeIndexed = (PFNGLDEPTHRANGEINDEXEDPROC) get_proc("glDepthRangeIndexed");
-	gl3wDepthRangef = (PFNGLDEPTHRANGEFPROC) get_proc("glDepthRangef");
-	gl3wDetachShader = (PFNGLDETACHSHADERPROC) get_proc("glDetachShader");
-	gl3wDisable = (PFNGLDISABLEPROC) get_proc("glDisable");
-	gl3wDisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC) get_proc("glDisableVertexArrayAttrib");
-	gl3wDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC) get_proc("glDisableVertexAttribArray");
-	gl3wDisablei = (PFNGLDISABLEIPROC) get_proc("glDisablei");
-	gl3wDispatchCompute = (PFNGLDISPATCHCOMPUTEPROC) get_proc("glDispatchCompute");
-	gl3wDispatchComputeGroupSizeARB = (PFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC) get_proc("glDispatchComputeGroupSizeARB");
-	gl3wDispatchComputeIndirect = (PFNGLDISPATCHCOMPUTEINDIRECTPROC) get_proc("glDispatchComputeIndirect");
-	gl3wDrawArrays = (PFNGLDRAWARRAYSPROC) get_proc("glDrawArrays");
-	gl3wDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC) get_proc("glDrawArraysIndirect");
-	gl3wDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC) get_proc("glDrawArraysInstanced");
-	gl3wDrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC) get_proc("glDrawArraysInstancedBaseInstance");
-	gl3wDrawBuffer = (PFNGLDRAWBUFFERPROC) get_proc("glDrawBuffer");
-	gl3wDrawBuffers = (PFNGLDRAWBUFFERSPROC) get_proc("glDrawBuffers");
-	gl3wDrawElements = (PFNGLDRAWELEMENTSPROC) get_proc("glDrawElements");
-	gl3wDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC) get_proc("glDrawElementsBaseVertex");
-	gl3wDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC) get_proc("glDrawElementsIndirect");
-	gl3wDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC) get_proc("glDrawElementsInstanced");
-	gl3wDrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC) get_proc("glDrawElementsInstancedBaseInstance");
-	gl3wDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC) get_proc("glDrawElementsInstancedBaseVertex");
-	gl3wDrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC) get_proc("glDrawElementsInstancedBaseVertexBaseInstance");
-	gl3wDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC) get_proc("glDrawRangeElements");
-	gl3wDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC) get_proc("glDrawRangeElementsBaseVertex");
-	gl3wDrawTransformFeedback = (PFNGLDRAWTRANSFORMFEEDBACKPROC) get_proc("glDrawTransformFeedback");
-	gl3wDrawTransformFeedbackInstanced = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC) get_proc("glDrawTransformFeedbackInstanced");
-	gl3wDrawTransformFeedbackStream = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC) get_proc("glDrawTransformFeedbackStream");
-	gl3wDrawTransformFeedbackStreamInstanced = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC) get_proc("glDrawTransformFeedbackStreamInstanced");
-	gl3wEnable = (PFNGLENABLEPROC) get_proc("glEnable");
-	gl3wEnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC) get_proc("glEnableVertexArrayAttrib");
-	gl3wEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC) get_proc("glEnableVertexAttribArray");
-	gl3wEnablei = (PFNGLENABLEIPROC) get_proc("glEnablei");
-	gl3wEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC) get_proc("glEndConditionalRender");
-	gl3wEndQuery = (PFNGLENDQUERYPROC) get_proc("glEndQuery");
-	gl3wEndQueryIndexed = (PFNGLENDQUERYINDEXEDPROC) get_proc("glEndQueryIndexed");
-	gl3wEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC) get_proc("glEndTransformFeedback");
-	gl3wFenceSync = (PFNGLFENCESYNCPROC) get_proc("glFenceSync");
-	gl3wFinish = (PFNGLFINISHPROC) get_proc("glFinish");
-	gl3wFlush = (PFNGLFLUSHPROC) get_proc("glFlush");
-	gl3wFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC) get_proc("glFlushMappedBufferRange");
-	gl3wFlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC) get_proc("glFlushMappedNamedBufferRange");
-	gl3wFramebufferParameteri = (PFNGLFRAMEBUFFERPARAMETERIPROC) get_proc("glFramebufferParameteri");
-	gl3wFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC) get_proc("glFramebufferRenderbuffer");
-	gl3wFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC) get_proc("glFramebufferTexture");
-	gl3wFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC) get_proc("glFramebufferTexture1D");
-	gl3wFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC) get_proc("glFramebufferTexture2D");
-	gl3wFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC) get_proc("glFramebufferTexture3D");
-	gl3wFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC) get_proc("glFramebufferTextureLayer");
-	gl3wFrontFace = (PFNGLFRONTFACEPROC) get_proc("glFrontFace");
-	gl3wGenBuffers = (PFNGLGENBUFFERSPROC) get_proc("glGenBuffers");
-	gl3wGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC) get_proc("glGenFramebuffers");
-	gl3wGenProgramPipelines = (PFNGLGENPROGRAMPIPELINESPROC) get_proc("glGenProgramPipelines");
-	gl3wGenQueries = (PFNGLGENQUERIESPROC) get_proc("glGenQueries");
-	gl3wGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC) get_proc("glGenRenderbuffers");
-	gl3wGenSamplers = (PFNGLGENSAMPLERSPROC) get_proc("glGenSamplers");
-	gl3wGenTextures = (PFNGLGENTEXTURESPROC) get_proc("glGenTextures");
-	gl3wGenTransformFeedbacks = (PFNGLGENTRANSFORMFEEDBACKSPROC) get_proc("glGenTransformFeedbacks");
-	gl3wGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC) get_proc("glGenVertexArrays");
-	gl3wGenerateMipmap = (PFNGLGENERATEMIPMAPPROC) get_proc("glGenerateMipmap");
-	gl3wGenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC) get_proc("glGenerateTextureMipmap");
-	gl3wGetActiveAtomicCounterBufferiv = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC) get_proc("glGetActiveAtomicCounterBufferiv");
-	gl3wGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC) get_proc("glGetActiveAttrib");
-	gl3wGetActiveSubroutineName = (PFNGLGETACTIVESUBROUTINENAMEPROC) get_proc("glGetActiveSubroutineName");
-	gl3wGetActiveSubroutineUniformName = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC) get_proc("glGetActiveSubroutineUniformName");
-	gl3wGetActiveSubroutineUniformiv = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC) get_proc("glGetActiveSubroutineUniformiv");
-	gl3wGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC) get_proc("glGetActiveUniform");
-	gl3wGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC) get_proc("glGetActiveUniformBlockName");
-	gl3wGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC) get_proc("glGetActiveUniformBlockiv");
-	gl3wGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC) get_proc("glGetActiveUniformName");
-	gl3wGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC) get_proc("glGetActiveUniformsiv");
-	gl3wGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC) get_proc("glGetAttachedShaders");
-	gl3wGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC) get_proc("glGetAttribLocation");
-	gl3wGetBooleani_v = (PFNGLGETBOOLEANI_VPROC) get_proc("glGetBooleani_v");
-	gl3wGetBooleanv = (PFNGLGETBOOLEANVPROC) get_proc("glGetBooleanv");
-	gl3wGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC) get_proc("glGetBufferParameteri64v");
-	gl3wGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC) get_proc("glGetBufferParameteriv");
-	gl3wGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC) get_proc("glGetBufferPointerv");
-	gl3wGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC) get_proc("glGetBufferSubData");
-	gl3wGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC) get_proc("glGetCompressedTexImage");
-	gl3wGetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC) get_proc("glGetCompressedTextureImage");
-	gl3wGetCompressedTextureSubImage = (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC) get_proc("glGetCompressedTextureSubImage");
-	gl3wGetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC) get_proc("glGetDebugMessageLog");
-	gl3wGetDebugMessageLogARB = (PFNGLGETDEBUGMESSAGELOGARBPROC) get_proc("glGetDebugMessageLogARB");
-	gl3wGetDoublei_v = (PFNGLGETDOUBLEI_VPROC) get_proc("glGetDoublei_v");
-	gl3wGetDoublev = (PFNGLGETDOUBLEVPROC) get_proc("glGetDoublev");
-	gl3wGetError = (PFNGLGETERRORPROC) get_proc("glGetError");
-	gl3wGetFloati_v = (PFNGLGETFLOATI_VPROC) get_proc("glGetFloati_v");
-	gl3wGetFloatv = (PFNGLGETFLOATVPROC) get_proc("glGetFloatv");
-	gl3wGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC) get_proc("glGetFragDataIndex");
-	gl3wGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC) get_proc("glGetFragDataLocation");
-	gl3wGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC) get_proc("glGetFramebufferAttachmentParameteriv");
-	gl3wGetFramebufferParameteriv = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC) get_proc("glGetFramebufferParameteriv");
-	gl3wGetGraphicsResetStatus = (PFNGLGETGRAPHICSRESETSTATUSPROC) get_proc("glGetGraphicsResetStatus");
-	gl3wGetGraphicsResetStatusARB = (PFNGLGETGRAPHICSRESETSTATUSARBPROC) get_proc("glGetGraphicsResetStatusARB");
-	gl3wGetImageHandleARB = (PFNGLGETIMAGEHANDLEARBPROC) get_proc("glGetImageHandleARB");
-	gl3wGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC) get_proc("glGetInteger64i_v");
-	gl3wGetInteger64v = (PFNGLGETINTEGER64VPROC) get_proc("glGetInteger64v");
-	gl3wGetIntegeri_v = (PFNGLGETINTEGERI_VPROC) get_proc("glGetIntegeri_v");
-	gl3wGetIntegerv = (PFNGLGETINTEGERVPROC) get_proc("glGetIntegerv");
-	gl3wGetInternalformati64v = (PFNGLGETINTERNALFORMATI64VPROC) get_proc("glGetInternalformati64v");
-	gl3wGetInternalformativ = (PFNGLGETINTERNALFORMATIVPROC) get_proc("glGetInternalformativ");
-	gl3wGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC) get_proc("glGetMultisamplefv");
-	gl3wGetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC) get_proc("glGetNamedBufferParameteri64v");
-	gl3wGetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC) get_proc("glGetNamedBufferParameteriv");
-	gl3wGetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC) get_proc("glGetNamedBufferPointerv");
-	gl3wGetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC) get_proc("glGetNamedBufferSubData");
-	gl3wGetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC) get_proc("glGetNamedFramebufferAttachmentParameteriv");
-	gl3wGetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC) get_proc("glGetNamedFramebufferParameteriv");
-	gl3wGetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC) get_proc("glGetNamedRenderbufferParameteriv");
-	gl3wGetNamedStringARB = (PFNGLGETNAMEDSTRINGARBPROC) get_proc("glGetNamedStringARB");
-	gl3wGetNamedStringivARB = (PFNGLGETNAMEDSTRINGIVARBPROC) get_proc("glGetNamedStringivARB");
-	gl3wGetObjectLabel = (PFNGLGETOBJECTLABELPROC) get_proc("glGetObjectLabel");
-	gl3wGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC) get_proc("glGetObjectPtrLabel");
-	gl3wGetPointerv = (PFNGLGETPOINTERVPROC) get_proc("glGetPointerv");
-	gl3wGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC) get_proc("glGetProgramBinary");
-	gl3wGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC) get_proc("glGetProgramInfoLog");
-	gl3wGetProgramInterfaceiv = (PFNGLGETPROGRAMINTERFACEIVPROC) get_proc("glGetProgramInterfaceiv");
-	gl3wGetProgramPipelineInfoLog = (PFNGLGETPROGRAMPIPELINEINFOLOGPROC) get_proc("glGetProgramPipelineInfoLog");
-	gl3wGetProgramPipelineiv = (PFNGLGETPROGRAMPIPELINEIVPROC) get_proc("glGetProgramPipelineiv");
-	gl3wGetProgramResourceIndex = (PFNGLGETPROGRAMRESOURCEINDEXPROC) get_proc("glGetProgramResourceIndex");
-	gl3wGetProgramResourceLocation = (PFNGLGETPROGRAMRESOURCELOCATIONPROC) get_proc("glGetProgramResourceLocation");
-	gl3wGetProgramResourceLocationIndex = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC) get_proc("glGetProgramResourceLocationIndex");
-	gl3wGetProgramResourceName = (PFNGLGETPROGRAMRESOURCENAMEPROC) get_proc("glGetProgramResourceName");
-	gl3wGetProgramResourceiv = (PFNGLGETPROGRAMRESOURCEIVPROC) get_proc("glGetProgramResourceiv");
-	gl3wGetProgramStageiv = (PFNGLGETPROGRAMSTAGEIVPROC) get_proc("glGetProgramStageiv");
-	gl3wGetProgramiv = (PFNGLGETPROGRAMIVPROC) get_proc("glGetProgramiv");
-	gl3wGetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC) get_proc("glGetQueryBufferObjecti64v");
-	gl3wGetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC) get_proc("glGetQueryBufferObjectiv");
-	gl3wGetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC) get_proc("glGetQueryBufferObjectui64v");
-	gl3wGetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC) get_proc("glGetQueryBufferObjectuiv");
-	gl3wGetQueryIndexediv = (PFNGLGETQUERYINDEXEDIVPROC) get_proc("glGetQueryIndexediv");
-	gl3wGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC) get_proc("glGetQueryObjecti64v");
-	gl3wGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC) get_proc("glGetQueryObjectiv");
-	gl3wGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC) get_proc("glGetQueryObjectui64v");
-	gl3wGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC) get_proc("glGetQueryObjectuiv");
-	gl3wGetQueryiv = (PFNGLGETQUERYIVPROC) get_proc("glGetQueryiv");
-	gl3wGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC) get_proc("glGetRenderbufferParameteriv");
-	gl3wGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC) get_proc("glGetSamplerParameterIiv");
-	gl3wGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC) get_proc("glGetSamplerParameterIuiv");
-	gl3wGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC) get_proc("glGetSamplerParameterfv");
-	gl3wGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC) get_proc("glGetSamplerParameteriv");
-	gl3wGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC) get_proc("glGetShaderInfoLog");
-	gl3wGetShaderPrecisionFormat = (PFNGLGETSHADERPRECISIONFORMATPROC) get_proc("glGetShaderPrecisionFormat");
-	gl3wGetShaderSource = (PFNGLGETSHADERSOURCEPROC) get_proc("glGetShaderSource");
-	gl3wGetShaderiv = (PFNGLGETSHADERIVPROC) get_proc("glGetShaderiv");
-	gl3wGetString = (PFNGLGETSTRINGPROC) get_proc("glGetString");
-	gl3wGetStringi = (PFNGLGETSTRINGIPROC) get_proc("glGetStringi");
-	gl3wGetSubroutineIndex = (PFNGLGETSUBROUTINEINDEXPROC) get_proc("glGetSubroutineIndex");
-	gl3wGetSubroutineUniformLocation = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC) get_proc("glGetSubroutineUniformLocation");
-	gl3wGetSynciv = (PFNGLGETSYNCIVPROC) get_proc("glGetSynciv");
-	gl3wGetTexImage = (PFNGLGETTEXIMAGEPROC) get_proc("glGetTexImage");
-	gl3wGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC) get_proc("glGetTexLevelParameterfv");
-	gl3wGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC) get_proc("glGetTexLevelParameteriv");
-	gl3wGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC) get_proc("glGetTexParameterIiv");
-	gl3wGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC) get_proc("glGetTexParameterIuiv");
-	gl3wGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC) get_proc("glGetTexParameterfv");
-	gl3wGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC) get_proc("glGetTexParameteriv");
-	gl3wGetTextureHandleARB = (PFNGLGETTEXTUREHANDLEARBPROC) get_proc("glGetTextureHandleARB");
-	gl3wGetTextureImage = (PFNGLGETTEXTUREIMAGEPROC) get_proc("glGetTextureImage");
-	gl3wGetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC) get_proc("glGetTextureLevelParameterfv");
-	gl3wGetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC) get_proc("glGetTextureLevelParameteriv");
-	gl3wGetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC) get_proc("glGetTextureParameterIiv");
-	gl3wGetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC) get_proc("glGetTextureParameterIuiv");
-	gl3wGetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC) get_proc("glGetTextureParameterfv");
-	gl3wGetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC) get_proc("glGetTextureParameteriv");
-	gl3wGetTextureSamplerHandleARB = (PFNGLGETTEXTURESAMPLERHANDLEARBPROC) get_proc("glGetTextureSamplerHandleARB");
-	gl3wGetTextureSubImage = (PFNGLGETTEXTURESUBIMAGEPROC) get_proc("glGetTextureSubImage");
-	gl3wGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC) get_proc("glGetTransformFeedbackVarying");
-	gl3wGetTransformFeedbacki64_v = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC) get_proc("glGetTransformFeedbacki64_v");
-	gl3wGetTransformFeedbacki_v = (PFNGLGETTRANSFORMFEEDBACKI_VPROC) get_proc("glGetTransformFeedbacki_v");
-	gl3wGetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC) get_proc("glGetTransformFeedbackiv");
-	gl3wGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC) get_proc("glGetUniformBlockIndex");
-	gl3wGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC) get_proc("glGetUniformIndices");
-	gl3wGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC) get_proc("glGetUniformLocation");
-	gl3wGetUniformSubroutineuiv = (PFNGLGETUNIFORMSUBROUTINEUIVPROC) get_proc("glGetUniformSubroutineuiv");
-	gl3wGetUniformdv = (PFNGLGETUNIFORMDVPROC) get_proc("glGetUniformdv");
-	gl3wGetUniformfv = (PFNGLGETUNIFORMFVPROC) get_proc("glGetUniformfv");
-	gl3wGetUniformiv = (PFNGLGETUNIFORMIVPROC) get_proc("glGetUniformiv");
-	gl3wGetUniformuiv = (PFNGLGETUNIFORMUIVPROC) get_proc("glGetUniformuiv");
-	gl3wGetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC) get_proc("glGetVertexArrayIndexed64iv");
-	gl3wGetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC) get_proc("glGetVertexArrayIndexediv");
-	gl3wGetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC) get_proc("glGetVertexArrayiv");
-	gl3wGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC) get_proc("glGetVertexAttribIiv");
-	gl3wGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC) get_proc("glGetVertexAttribIuiv");
-	gl3wGetVertexAttribLdv = (PFNGLGETVERTEXATTRIBLDVPROC) get_proc("glGetVertexAttribLdv");
-	gl3wGetVertexAttribLui64vARB = (PFNGLGETVERTEXATTRIBLUI64VARBPROC) get_proc("glGetVertexAttribLui64vARB");
-	gl3wGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC) get_proc("glGetVertexAttribPointerv");
-	gl3wGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC) get_proc("glGetVertexAttribdv");
-	gl3wGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC) get_proc("glGetVertexAttribfv");
-	gl3wGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC) get_proc("glGetVertexAttribiv");
-	gl3wGetnCompressedTexImage = (PFNGLGETNCOMPRESSEDTEXIMAGEPROC) get_proc("glGetnCompressedTexImage");
-	gl3wGetnCompressedTexImageARB = (PFNGLGETNCOMPRESSEDTEXIMAGEARBPROC) get_proc("glGetnCompressedTexImageARB");
-	gl3wGetnTexImage = (PFNGLGETNTEXIMAGEPROC) get_proc("glGetnTexImage");
-	gl3wGetnTexImageARB = (PFNGLGETNTEXIMAGEARBPROC) get_proc("glGetnTexImageARB");
-	gl3wGetnUniformdv = (PFNGLGETNUNIFORMDVPROC) get_proc("glGetnUniformdv");
-	gl3wGetnUniformdvARB = (PFNGLGETNUNIFORMDVARBPROC) get_proc("glGetnUniformdvARB");
-	gl3wGetnUniformfv = (PFNGLGETNUNIFORMFVPROC) get_proc("glGetnUniformfv");
-	gl3wGetnUniformfvARB = (PFNGLGETNUNIFORMFVARBPROC) get_proc("glGetnUniformfvARB");
-	gl3wGetnUniformiv = (PFNGLGETNUNIFORMIVPROC) get_proc("glGetnUniformiv");
-	gl3wGetnUniformivARB = (PFNGLGETNUNIFORMIVARBPROC) get_proc("glGetnUniformivARB");
-	gl3wGetnUniformuiv = (PFNGLGETNUNIFORMUIVPROC) get_proc("glGetnUniformuiv");
-	gl3wGetnUniformuivARB = (PFNGLGETNUNIFORMUIVARBPROC) get_proc("glGetnUniformuivARB");
-	gl3wHint = (PFNGLHINTPROC) get_proc("glHint");
-	gl3wInvalidateBufferData = (PFNGLINVALIDATEBUFFERDATAPROC) get_proc("glInvalidateBufferData");
-	gl3wInvalidateBufferSubData = (PFNGLINVALIDATEBUFFERSUBDATAPROC) get_proc("glInvalidateBufferSubData");
-	gl3wInvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC) get_proc("glInvalidateFramebuffer");
-	gl3wInvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC) get_proc("glInvalidateNamedFramebufferData");
-	gl3wInvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC) get_proc("glInvalidateNamedFramebufferSubData");
-	gl3wInvalidateSubFramebuffer = (PFNGLINVALIDATESUBFRAMEBUFFERPROC) get_proc("glInvalidateSubFramebuffer");
-	gl3wInvalidateTexImage = (PFNGLINVALIDATETEXIMAGEPROC) get_proc("glInvalidateTexImage");
-	gl3wInvalidateTexSubImage = (PFNGLINVALIDATETEXSUBIMAGEPROC) get_proc("glInvalidateTexSubImage");
-	gl3wIsBuffer = (PFNGLISBUFFERPROC) get_proc("glIsBuffer");
-	gl3wIsEnabled = (PFNGLISENABLEDPROC) get_proc("glIsEnabled");
-	gl3wIsEnabledi = (PFNGLISENABLEDIPROC) get_proc("glIsEnabledi");
-	gl3wIsFramebuffer = (PFNGLISFRAMEBUFFERPROC) get_proc("glIsFramebuffer");
-	gl3wIsImageHandleResidentARB = (PFNGLISIMAGEHANDLERESIDENTARBPROC) get_proc("glIsImageHandleResidentARB");
-	gl3wIsNamedStringARB = (PFNGLISNAMEDSTRINGARBPROC) get_proc("glIsNamedStringARB");
-	gl3wIsProgram = (PFNGLISPROGRAMPROC) get_proc("glIsProgram");
-	gl3wIsProgramPipeline = (PFNGLISPROGRAMPIPELINEPROC) get_proc("glIsProgramPipeline");
-	gl3wIsQuery = (PFNGLISQUERYPROC) get_proc("glIsQuery");
-	gl3wIsRenderbuffer = (PFNGLISRENDERBUFFERPROC) get_proc("glIsRenderbuffer");
-	gl3wIsSampler = (PFNGLISSAMPLERPROC) get_proc("glIsSampler");
-	gl3wIsShader = (PFNGLISSHADERPROC) get_proc("glIsShader");
-	gl3wIsSync = (PFNGLISSYNCPROC) get_proc("glIsSync");
-	gl3wIsTexture = (PFNGLISTEXTUREPROC) get_proc("glIsTexture");
-	gl3wIsTextureHandleResidentARB = (PFNGLISTEXTUREHANDLERESIDENTARBPROC) get_proc("glIsTextureHandleResidentARB");
-	gl3wIsTransformFeedback = (PFNGLISTRANSFORMFEEDBACKPROC) get_proc("glIsTransformFeedback");
-	gl3wIsVertexArray = (PFNGLISVERTEXARRAYPROC) get_proc("glIsVertexArray");
-	gl3wLineWidth = (PFNGLLINEWIDTHPROC) get_proc("glLineWidth");
-	gl3wLinkProgram = (PFNGLLINKPROGRAMPROC) get_proc("glLinkProgram");
-	gl3wLogicOp = (PFNGLLOGICOPPROC) get_proc("glLogicOp");
-	gl3wMakeImageHandleNonResidentARB = (PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC) get_proc("glMakeImageHandleNonResidentARB");
-	gl3wMakeImageHandleResidentARB = (PFNGLMAKEIMAGEHANDLERESIDENTARBPROC) get_proc("glMakeImageHandleResidentARB");
-	gl3wMakeTextureHandleNonResidentARB = (PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC) get_proc("glMakeTextureHandleNonResidentARB");
-	gl3wMakeTextureHandleResidentARB = (PFNGLMAKETEXTUREHANDLERESIDENTARBPROC) get_proc("glMakeTextureHandleResidentARB");
-	gl3wMapBuffer = (PFNGLMAPBUFFERPROC) get_proc("glMapBuffer");
-	gl3wMapBufferRange = (PFNGLMAPBUFFERRANGEPROC) get_proc("glMapBufferRange");
-	gl3wMapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC) get_proc("glMapNamedBuffer");
-	gl3wMapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC) get_proc("glMapNamedBufferRange");
-	gl3wMemoryBarrier = (PFNGLMEMORYBARRIERPROC) get_proc("glMemoryBarrier");
-	gl3wMemoryBarrierByRegion = (PFNGLMEMORYBARRIERBYREGIONPROC) get_proc("glMemoryBarrierByRegion");
-	gl3wMinSampleShading = (PFNGLMINSAMPLESHADINGPROC) get_proc("glMinSampleShading");
-	gl3wMinSampleShadingARB = (PFNGLMINSAMPLESHADINGARBPROC) get_proc("glMinSampleShadingARB");
-	gl3wMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC) get_proc("glMultiDrawArrays");
-	gl3wMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC) get_proc("glMultiDrawArraysIndirect");
-	gl3wMultiDrawArraysIndirectCountARB = (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC) get_proc("glMultiDrawArraysIndirectCountARB");
-	gl3wMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC) get_proc("glMultiDrawElements");
-	gl3wMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC) get_proc("glMultiDrawElementsBaseVertex");
-	gl3wMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC) get_proc("glMultiDrawElementsIndirect");
-	gl3wMultiDrawElementsIndirectCountARB = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC) get_proc("glMultiDrawElementsIndirectCountARB");
-	gl3wNamedBufferData = (PFNGLNAMEDBUFFERDATAPROC) get_proc("glNamedBufferData");
-	gl3wNamedBufferPageCommitmentARB = (PFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC) get_proc("glNamedBufferPageCommitmentARB");
-	gl3wNamedBufferPageCommitmentEXT = (PFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC) get_proc("glNamedBufferPageCommitmentEXT");
-	gl3wNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC) get_proc("glNamedBufferStorage");
-	gl3wNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC) get_proc("glNamedBufferSubData");
-	gl3wNamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC) get_proc("glNamedFramebufferDrawBuffer");
-	gl3wNamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC) get_proc("glNamedFramebufferDrawBuffers");
-	gl3wNamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC) get_proc("glNamedFramebufferParameteri");
-	gl3wNamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC) get_proc("glNamedFramebufferReadBuffer");
-	gl3wNamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC) get_proc("glNamedFramebufferRenderbuffer");
-	gl3wNamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC) get_proc("glNamedFramebufferTexture");
-	gl3wNamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC) get_proc("glNamedFramebufferTextureLayer");
-	gl3wNamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC) get_proc("glNamedRenderbufferStorage");
-	gl3wNamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC) get_proc("glNamedRenderbufferStorageMultisample");
-	gl3wNamedStringARB = (PFNGLNAMEDSTRINGARBPROC) get_proc("glNamedStringARB");
-	gl3wObjectLabel = (PFNGLOBJECTLABELPROC) get_proc("glObjectLabel");
-	gl3wObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC) get_proc("glObjectPtrLabel");
-	gl3wPatchParameterfv = (PFNGLPATCHPARAMETERFVPROC) get_proc("glPatchParameterfv");
-	gl3wPatchParameteri = (PFNGLPATCHPARAMETERIPROC) get_proc("glPatchParameteri");
-	gl3wPauseTransformFeedback = (PFNGLPAUSETRANSFORMFEEDBACKPROC) get_proc("glPauseTransformFeedback");
-	gl3wPixelStoref = (PFNGLPIXELSTOREFPROC) get_proc("glPixelStoref");
-	gl3wPixelStorei = (PFNGLPIXELSTOREIPROC) get_proc("glPixelStorei");
-	gl3wPointParameterf = (PFNGLPOINTPARAMETERFPROC) get_proc("glPointParameterf");
-	gl3wPointParameterfv = (PFNGLPOINTPARAMETERFVPROC) get_proc("glPointParameterfv");
-	gl3wPointParameteri = (PFNGLPOINTPARAMETERIPROC) get_proc("glPointParameteri");
-	gl3wPointParameteriv = (PFNGLPOINTPARAMETERIVPROC) get_proc("glPointParameteriv");
-	gl3wPointSize = (PFNGLPOINTSIZEPROC) get_proc("glPointSize");
-	gl3wPolygonMode = (PFNGLPOLYGONMODEPROC) get_proc("glPolygonMode");
-	gl3wPolygonOffset = (PFNGLPOLYGONOFFSETPROC) get_proc("glPolygonOffset");
-	gl3wPopDebugGroup = (PFNGLPOPDEBUGGROUPPROC) get_proc("glPopDebugGroup");
-	gl3wPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC) get_proc("glPrimitiveRestartIndex");
-	gl3wProgramBinary = (PFNGLPROGRAMBINARYPROC) get_proc("glProgramBinary");
-	gl3wProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC) get_proc("glProgramParameteri");
-	gl3wProgramUniform1d = (PFNGLPROGRAMUNIFORM1DPROC) get_proc("glProgramUniform1d");
-	gl3wProgramUniform1dv = (PFNGLPROGRAMUNIFORM1DVPROC) get_proc("glProgramUniform1dv");
-	gl3wProgramUniform1f = (PFNGLPROGRAMUNIFORM1FPROC) get_proc("glProgramUniform1f");
-	gl3wProgramUniform1fv = (PFNGLPROGRAMUNIFORM1FVPROC) get_proc("glProgramUniform1fv");
-	gl3wProgramUniform1i = (PFNGLPROGRAMUNIFORM1IPROC) get_proc("glProgramUniform1i");
-	gl3wProgramUniform1iv = (PFNGLPROGRAMUNIFORM1IVPROC) get_proc("glProgramUniform1iv");
-	gl3wProgramUniform1ui = (PFNGLPROGRAMUNIFORM1UIPROC) get_proc("glProgramUniform1ui");
-	gl3wProgramUniform1uiv = (PFNGLPROGRAMUNIFORM1UIVPROC) get_proc("glProgramUniform1uiv");
-	gl3wProgramUniform2d = (PFNGLPROGRAMUNIFORM2DPROC) get_proc("glProgramUniform2d");
-	gl3wProgramUniform2dv = (PFNGLPROGRAMUNIFORM2DVPROC) get_proc("glProgramUniform2dv");
-	gl3wProgramUniform2f = (PFNGLPROGRAMUNIFORM2FPROC) get_proc("glProgramUniform2f");
-	gl3wProgramUniform2fv = (PFNGLPROGRAMUNIFORM2FVPROC) get_proc("glProgramUniform2fv");
-	gl3wProgramUniform2i = (PFNGLPROGRAMUNIFORM2IPROC) get_proc("glProgramUniform2i");
-	gl3wProgramUniform2iv = (PFNGLPROGRAMUNIFORM2IVPROC) get_proc("glProgramUniform2iv");
-	gl3wProgramUniform2ui = (PFNGLPROGRAMUNIFORM2UIPROC) get_proc("glProgramUniform2ui");
-	gl3wProgramUniform2uiv = (PFNGLPROGRAMUNIFORM2UIVPROC) get_proc("glProgramUniform2uiv");
-	gl3wProgramUniform3d = (PFNGLPROGRAMUNIFORM3DPROC) get_proc("glProgramUniform3d");
-	gl3wProgramUniform3dv = (PFNGLPROGRAMUNIFORM3DVPROC) get_proc("glProgramUniform3dv");
-	gl3wProgramUniform3f = (PFNGLPROGRAMUNIFORM3FPROC) get_proc("glProgramUniform3f");
-	gl3wProgramUniform3fv = (PFNGLPROGRAMUNIFORM3FVPROC) get_proc("glProgramUniform3fv");
-	gl3wProgramUniform3i = (PFNGLPROGRAMUNIFORM3IPROC) get_proc("glProgramUniform3i");
-	gl3wProgramUniform3iv = (PFNGLPROGRAMUNIFORM3IVPROC) get_proc("glProgramUniform3iv");
-	gl3wProgramUniform3ui = (PFNGLPROGRAMUNIFORM3UIPROC) get_proc("glProgramUniform3ui");
-	gl3wProgramUniform3uiv = (PFNGLPROGRAMUNIFORM3UIVPROC) get_proc("glProgramUniform3uiv");
-	gl3wProgramUniform4d = (PFNGLPROGRAMUNIFORM4DPROC) get_proc("glProgramUniform4d");
-	gl3wProgramUniform4dv = (PFNGLPROGRAMUNIFORM4DVPROC) get_proc("glProgramUniform4dv");
-	gl3wProgramUniform4f = (PFNGLPROGRAMUNIFORM4FPROC) get_proc("glProgramUniform4f");
-	gl3wProgramUniform4fv = (PFNGLPROGRAMUNIFORM4FVPROC) get_proc("glProgramUniform4fv");
-	gl3wProgramUniform4i = (PFNGLPROGRAMUNIFORM4IPROC) get_proc("glProgramUniform4i");
-	gl3wProgramUniform4iv = (PFNGLPROGRAMUNIFORM4IVPROC) get_proc("glProgramUniform4iv");
-	gl3wProgramUniform4ui = (PFNGLPROGRAMUNIFORM4UIPROC) get_proc("glProgramUniform4ui");
-	gl3wProgramUniform4uiv = (PFNGLPROGRAMUNIFORM4UIVPROC) get_proc("glProgramUniform4uiv");
-	gl3wProgramUniformHandleui64ARB = (PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC) get_proc("glProgramUniformHandleui64ARB");
-	gl3wProgramUniformHandleui64vARB = (PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC) get_proc("glProgramUniformHandleui64vARB");
-	gl3wProgramUniformMatrix2dv = (PFNGLPROGRAMUNIFORMMATRIX2DVPROC) get_proc("glProgramUniformMatrix2dv");
-	gl3wProgramUniformMatrix2fv = (PFNGLPROGRAMUNIFORMMATRIX2FVPROC) get_proc("glProgramUniformMatrix2fv");
-	gl3wProgramUniformMatrix2x3dv = (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC) get_proc("glProgramUniformMatrix2x3dv");
-	gl3wProgramUniformMatrix2x3fv = (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC) get_proc("glProgramUniformMatrix2x3fv");
-	gl3wProgramUniformMatrix2x4dv = (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC) get_proc("glProgramUniformMatrix2x4dv");
-	gl3wProgramUniformMatrix2x4fv = (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC) get_proc("glProgramUniformMatrix2x4fv");
-	gl3wProgramUniformMatrix3dv = (PFNGLPROGRAMUNIFORMMATRIX3DVPROC) get_proc("glProgramUniformMatrix3dv");
-	gl3wProgramUniformMatrix3fv = (PFNGLPROGRAMUNIFORMMATRIX3FVPROC) get_proc("glProgramUniformMatrix3fv");
-	gl3wProgramUniformMatrix3x2dv = (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC) get_proc("glProgramUniformMatrix3x2dv");
-	gl3wProgramUniformMatrix3x2fv = (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC) get_proc("glProgramUniformMatrix3x2fv");
-	gl3wProgramUniformMatrix3x4dv = (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC) get_proc("glProgramUniformMatrix3x4dv");
-	gl3wProgramUniformMatrix3x4fv = (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC) get_proc("glProgramUniformMatrix3x4fv");
-	gl3wProgramUniformMatrix4dv = (PFNGLPROGRAMUNIFORMMATRIX4DVPROC) get_proc("glProgramUniformMatrix4dv");
-	gl3wProgramUniformMatrix4fv = (PFNGLPROGRAMUNIFORMMATRIX4FVPROC) get_proc("glProgramUniformMatrix4fv");
-	gl3wProgramUniformMatrix4x2dv = (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC) get_proc("glProgramUniformMatrix4x2dv");
-	gl3wProgramUniformMatrix4x2fv = (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC) get_proc("glProgramUniformMatrix4x2fv");
-	gl3wProgramUniformMatrix4x3dv = (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC) get_proc("glProgramUniformMatrix4x3dv");
-	gl3wProgramUniformMatrix4x3fv = (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC) get_proc("glProgramUniformMatrix4x3fv");
-	gl3wProvokingVertex = (PFNGLPROVOKINGVERTEXPROC) get_proc("glProvokingVertex");
-	gl3wPushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC) get_proc("glPushDebugGroup");
-	gl3wQueryCounter = (PFNGLQUERYCOUNTERPROC) get_proc("glQueryCounter");
-	gl3wReadBuffer = (PFNGLREADBUFFERPROC) get_proc("glReadBuffer");
-	gl3wReadPixels = (PFNGLREADPIXELSPROC) get_proc("glReadPixels");
-	gl3wReadnPixels = (PFNGLREADNPIXELSPROC) get_proc("glReadnPixels");
-	gl3wReadnPixelsARB = (PFNGLREADNPIXELSARBPROC) get_proc("glReadnPixelsARB");
-	gl3wReleaseShaderCompiler = (PFNGLRELEASESHADERCOMPILERPROC) get_proc("glReleaseShaderCompiler");
-	gl3wRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC) get_proc("glRenderbufferStorage");
-	gl3wRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC) get_proc("glRenderbufferStorageMultisample");
-	gl3wResumeTransformFeedback = (PFNGLRESUMETRANSFORMFEEDBACKPROC) get_proc("glResumeTransformFeedback");
-	gl3wSampleCoverage = (PFNGLSAMPLECOVERAGEPROC) get_proc("glSampleCoverage");
-	gl3wSampleMaski = (PFNGLSAMPLEMASKIPROC) get_proc("glSampleMaski");
-	gl3wSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC) get_proc("glSamplerParameterIiv");
-	gl3wSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC) get_proc("glSamplerParameterIuiv");
-	gl3wSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC) get_proc("glSamplerParameterf");
-	gl3wSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC) get_proc("glSamplerParameterfv");
-	gl3wSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC) get_proc("glSamplerParameteri");
-	gl3wSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC) get_proc("glSamplerParameteriv");
-	gl3wScissor = (PFNGLSCISSORPROC) get_proc("glScissor");
-	gl3wScissorArrayv = (PFNGLSCISSORARRAYVPROC) get_proc("glScissorArrayv");
-	gl3wScissorIndexed = (PFNGLSCISSORINDEXEDPROC) get_proc("glScissorIndexed");
-	gl3wScissorIndexedv = (PFNGLSCISSORINDEXEDVPROC) get_proc("glScissorIndexedv");
-	gl3wShaderBinary = (PFNGLSHADERBINARYPROC) get_proc("glShaderBinary");
-	gl3wShaderSource = (PFNGLSHADERSOURCEPROC) get_proc("glShaderSource");
-	gl3wShaderStorageBlockBinding = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC) get_proc("glShaderStorageBlockBinding");
-	gl3wStencilFunc = (PFNGLSTENCILFUNCPROC) get_proc("glStencilFunc");
-	gl3wStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC) get_proc("glStencilFuncSeparate");
-	gl3wStencilMask = (PFNGLSTENCILMASKPROC) get_proc("glStencilMask");
-	gl3wStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC) get_proc("glStencilMaskSeparate");
-	gl3wStencilOp = (PFNGLSTENCILOPPROC) get_proc("glStencilOp");
-	gl3wStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC) get_proc("glStencilOpSeparate");
-	gl3wTexBuffer = (PFNGLTEXBUFFERPROC) get_proc("glTexBuffer");
-	gl3wTexBufferRange = (PFNGLTEXBUFFERRANGEPROC) get_proc("glTexBufferRange");
-	gl3wTexImage1D = (PFNGLTEXIMAGE1DPROC) get_proc("glTexImage1D");
-	gl3wTexImage2D = (PFNGLTEXIMAGE2DPROC) get_proc("glTexImage2D");
-	gl3wTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC) get_proc("glTexImage2DMultisample");
-	gl3wTexImage3D = (PFNGLTEXIMAGE3DPROC) get_proc("glTexImage3D");
-	gl3wTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC) get_proc("glTexImage3DMultisample");
-	gl3wTexPageCommitmentARB = (PFNGLTEXPAGECOMMITMENTARBPROC) get_proc("glTexPageCommitmentARB");
-	gl3wTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC) get_proc("glTexParameterIiv");
-	gl3wTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC) get_proc("glTexParameterIuiv");
-	gl3wTexParameterf = (PFNGLTEXPARAMETERFPROC) get_proc("glTexParameterf");
-	gl3wTexParameterfv = (PFNGLTEXPARAMETERFVPROC) get_proc("glTexParameterfv");
-	gl3wTexParameteri = (PFNGLTEXPARAMETERIPROC) get_proc("glTexParameteri");
-	gl3wTexParameteriv = (PFNGLTEXPARAMETERIVPROC) get_proc("glTexParameteriv");
-	gl3wTexStorage1D = (PFNGLTEXSTORAGE1DPROC) get_proc("glTexStorage1D");
-	gl3wTexStorage2D = (PFNGLTEXSTORAGE2DPROC) get_proc("glTexStorage2D");
-	gl3wTexStorage2DMultisample = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC) get_proc("glTexStorage2DMultisample");
-	gl3wTexStorage3D = (PFNGLTEXSTORAGE3DPROC) get_proc("glTexStorage3D");
-	gl3wTexStorage3DMultisample = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC) get_proc("glTexStorage3DMultisample");
-	gl3wTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC) get_proc("glTexSubImage1D");
-	gl3wTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC) get_proc("glTexSubImage2D");
-	gl3wTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC) get_proc("glTexSubImage3D");
-	gl3wTextureBarrier = (PFNGLTEXTUREBARRIERPROC) get_proc("glTextureBarrier");
-	gl3wTextureBuffer = (PFNGLTEXTUREBUFFERPROC) get_proc("glTextureBuffer");
-	gl3wTextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC) get_proc("glTextureBufferRange");
-	gl3wTextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC) get_proc("glTextureParameterIiv");
-	gl3wTextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC) get_proc("glTextureParameterIuiv");
-	gl3wTextureParameterf = (PFNGLTEXTUREPARAMETERFPROC) get_proc("glTextureParameterf");
-	gl3wTextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC) get_proc("glTextureParameterfv");
-	gl3wTextureParameteri = (PFNGLTEXTUREPARAMETERIPROC) get_proc("glTextureParameteri");
-	gl3wTextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC) get_proc("glTextureParameteriv");
-	gl3wTextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC) get_proc("glTextureStorage1D");
-	gl3wTextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC) get_proc("glTextureStorage2D");
-	gl3wTextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC) get_proc("glTextureStorage2DMultisample");
-	gl3wTextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC) get_proc("glTextureStorage3D");
-	gl3wTextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC) get_proc("glTextureStorage3DMultisample");
-	gl3wTextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC) get_proc("glTextureSubImage1D");
-	gl3wTextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC) get_proc("glTextureSubImage2D");
-	gl3wTextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC) get_proc("glTextureSubImage3D");
-	gl3wTextureView = (PFNGLTEXTUREVIEWPROC) get_proc("glTextureView");
-	gl3wTransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC) get_proc("glTransformFeedbackBufferBase");
-	gl3wTransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC) get_proc("glTransformFeedbackBufferRange");
-	gl3wTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC) get_proc("glTransformFeedbackVaryings");
-	gl3wUniform1d = (PFNGLUNIFORM1DPROC) get_proc("glUniform1d");
-	gl3wUniform1dv = (PFNGLUNIFORM1DVPROC) get_proc("glUniform1dv");
-	gl3wUniform1f = (PFNGLUNIFORM1FPROC) get_proc("glUniform1f");
-	gl3wUniform1fv = (PFNGLUNIFORM1FVPROC) get_proc("glUniform1fv");
-	gl3wUniform1i = (PFNGLUNIFORM1IPROC) get_proc("glUniform1i");
-	gl3wUniform1iv = (PFNGLUNIFORM1IVPROC) get_proc("glUniform1iv");
-	gl3wUniform1ui = (PFNGLUNIFORM1UIPROC) get_proc("glUniform1ui");
-	gl3wUniform1uiv = (PFNGLUNIFORM1UIVPROC) get_proc("glUniform1uiv");
-	gl3wUniform2d = (PFNGLUNIFORM2DPROC) get_proc("glUniform2d");
-	gl3wUniform2dv = (PFNGLUNIFORM2DVPROC) get_proc("glUniform2dv");
-	gl3wUniform2f = (PFNGLUNIFORM2FPROC) get_proc("glUniform2f");
-	gl3wUniform2fv = (PFNGLUNIFORM2FVPROC) get_proc("glUniform2fv");
-	gl3wUniform2i = (PFNGLUNIFORM2IPROC) get_proc("glUniform2i");
-	gl3wUniform2iv = (PFNGLUNIFORM2IVPROC) get_proc("glUniform2iv");
-	gl3wUniform2ui = (PFNGLUNIFORM2UIPROC) get_proc("glUniform2ui");
-	gl3wUniform2uiv = (PFNGLUNIFORM2UIVPROC) get_proc("glUniform2uiv");
-	gl3wUniform3d = (PFNGLUNIFORM3DPROC) get_proc("glUniform3d");
-	gl3wUniform3dv = (PFNGLUNIFORM3DVPROC) get_proc("glUniform3dv");
-	gl3wUniform3f = (PFNGLUNIFORM3FPROC) get_proc("glUniform3f");
-	gl3wUniform3fv = (PFNGLUNIFORM3FVPROC) get_proc("glUniform3fv");
-	gl3wUniform3i = (PFNGLUNIFORM3IPROC) get_proc("glUniform3i");
-	gl3wUniform3iv = (PFNGLUNIFORM3IVPROC) get_proc("glUniform3iv");
-	gl3wUniform3ui = (PFNGLUNIFORM3UIPROC) get_proc("glUniform3ui");
-	gl3wUniform3uiv = (PFNGLUNIFORM3UIVPROC) get_proc("glUniform3uiv");
-	gl3wUniform4d = (PFNGLUNIFORM4DPROC) get_proc("glUniform4d");
-	gl3wUniform4dv = (PFNGLUNIFORM4DVPROC) get_proc("glUniform4dv");
-	gl3wUniform4f = (PFNGLUNIFORM4FPROC) get_proc("glUniform4f");
-	gl3wUniform4fv = (PFNGLUNIFORM4FVPROC) get_proc("glUniform4fv");
-	gl3wUniform4i = (PFNGLUNIFORM4IPROC) get_proc("glUniform4i");
-	gl3wUniform4iv = (PFNGLUNIFORM4IVPROC) get_proc("glUniform4iv");
-	gl3wUniform4ui = (PFNGLUNIFORM4UIPROC) get_proc("glUniform4ui");
-	gl3wUniform4uiv = (PFNGLUNIFORM4UIVPROC) get_proc("glUniform4uiv");
-	gl3wUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC) get_proc("glUniformBlockBinding");
-	gl3wUniformHandleui64ARB = (PFNGLUNIFORMHANDLEUI64ARBPROC) get_proc("glUniformHandleui64ARB");
-	gl3wUniformHandleui64vARB = (PFNGLUNIFORMHANDLEUI64VARBPROC) get_proc("glUniformHandleui64vARB");
-	gl3wUniformMatrix2dv = (PFNGLUNIFORMMATRIX2DVPROC) get_proc("glUniformMatrix2dv");
-	gl3wUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC) get_proc("glUniformMatrix2fv");
-	gl3wUniformMatrix2x3dv = (PFNGLUNIFORMMATRIX2X3DVPROC) get_proc("glUniformMatrix2x3dv");
-	gl3wUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC) get_proc("glUniformMatrix2x3fv");
-	gl3wUniformMatrix2x4dv = (PFNGLUNIFORMMATRIX2X4DVPROC) get_proc("glUniformMatrix2x4dv");
-	gl3wUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC) get_proc("glUniformMatrix2x4fv");
-	gl3wUniformMatrix3dv = (PFNGLUNIFORMMATRIX3DVPROC) get_proc("glUniformMatrix3dv");
-	gl3wUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC) get_proc("glUniformMatrix3fv");
-	gl3wUniformMatrix3x2dv = (PFNGLUNIFORMMATRIX3X2DVPROC) get_proc("glUniformMatrix3x2dv");
-	gl3wUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC) get_proc("glUniformMatrix3x2fv");
-	gl3wUniformMatrix3x4dv = (PFNGLUNIFORMMATRIX3X4DVPROC) get_proc("glUniformMatrix3x4dv");
-	gl3wUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC) get_proc("glUniformMatrix3x4fv");
-	gl3wUniformMatrix4dv = (PFNGLUNIFORMMATRIX4DVPROC) get_proc("glUniformMatrix4dv");
-	gl3wUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC) get_proc("glUniformMatrix4fv");
-	gl3wUniformMatrix4x2dv = (PFNGLUNIFORMMATRIX4X2DVPROC) get_proc("glUniformMatrix4x2dv");
-	gl3wUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC) get_proc("glUniformMatrix4x2fv");
-	gl3wUniformMatrix4x3dv = (PFNGLUNIFORMMATRIX4X3DVPROC) get_proc("glUniformMatrix4x3dv");
-	gl3wUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC) get_proc("glUniformMatrix4x3fv");
-	gl3wUniformSubroutinesuiv = (PFNGLUNIFORMSUBROUTINESUIVPROC) get_proc("glUniformSubroutinesuiv");
-	gl3wUnmapBuffer = (PFNGLUNMAPBUFFERPROC) get_proc("glUnmapBuffer");
-	gl3wUnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC) get_proc("glUnmapNamedBuffer");
-	gl3wUseProgram = (PFNGLUSEPROGRAMPROC) get_proc("glUseProgram");
-	gl3wUseProgramStages = (PFNGLUSEPROGRAMSTAGESPROC) get_proc("glUseProgramStages");
-	gl3wValidateProgram = (PFNGLVALIDATEPROGRAMPROC) get_proc("glValidateProgram");
-	gl3wValidateProgramPipeline = (PFNGLVALIDATEPROGRAMPIPELINEPROC) get_proc("glValidateProgramPipeline");
-	gl3wVertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC) get_proc("glVertexArrayAttribBinding");
-	gl3wVertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC) get_proc("glVertexArrayAttribFormat");
-	gl3wVertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC) get_proc("glVertexArrayAttribIFormat");
-	gl3wVertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC) get_proc("glVertexArrayAttribLFormat");
-	gl3wVertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC) get_proc("glVertexArrayBindingDivisor");
-	gl3wVertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC) get_proc("glVertexArrayElementBuffer");
-	gl3wVertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC) get_proc("glVertexArrayVertexBuffer");
-	gl3wVertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC) get_proc("glVertexArrayVertexBuffers");
-	gl3wVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC) get_proc("glVertexAttrib1d");
-	gl3wVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC) get_proc("glVertexAttrib1dv");
-	gl3wVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC) get_proc("glVertexAttrib1f");
-	gl3wVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC) get_proc("glVertexAttrib1fv");
-	gl3wVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC) get_proc("glVertexAttrib1s");
-	gl3wVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC) get_proc("glVertexAttrib1sv");
-	gl3wVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC) get_proc("glVertexAttrib2d");
-	gl3wVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC) get_proc("glVertexAttrib2dv");
-	gl3wVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC) get_proc("glVertexAttrib2f");
-	gl3wVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC) get_proc("glVertexAttrib2fv");
-	gl3wVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC) get_proc("glVertexAttrib2s");
-	gl3wVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC) get_proc("glVertexAttrib2sv");
-	gl3wVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC) get_proc("glVertexAttrib3d");
-	gl3wVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC) get_proc("glVertexAttrib3dv");
-	gl3wVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC) get_proc("glVertexAttrib3f");
-	gl3wVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC) get_proc("glVertexAttrib3fv");
-	gl3wVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC) get_proc("glVertexAttrib3s");
-	gl3wVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC) get_proc("glVertexAttrib3sv");
-	gl3wVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC) get_proc("glVertexAttrib4Nbv");
-	gl3wVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC) get_proc("glVertexAttrib4Niv");
-	gl3wVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC) get_proc("glVertexAttrib4Nsv");
-	gl3wVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC) get_proc("glVertexAttrib4Nub");
-	gl3wVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC) get_proc("glVertexAttrib4Nubv");
-	gl3wVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC) get_proc("glVertexAttrib4Nuiv");
-	gl3wVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC) get_proc("glVertexAttrib4Nusv");
-	gl3wVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC) get_proc("glVertexAttrib4bv");
-	gl3wVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC) get_proc("glVertexAttrib4d");
-	gl3wVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC) get_proc("glVertexAttrib4dv");
-	gl3wVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC) get_proc("glVertexAttrib4f");
-	gl3wVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC) get_proc("glVertexAttrib4fv");
-	gl3wVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC) get_proc("glVertexAttrib4iv");
-	gl3wVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC) get_proc("glVertexAttrib4s");
-	gl3wVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC) get_proc("glVertexAttrib4sv");
-	gl3wVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC) get_proc("glVertexAttrib4ubv");
-	gl3wVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC) get_proc("glVertexAttrib4uiv");
-	gl3wVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC) get_proc("glVertexAttrib4usv");
-	gl3wVertexAttribBinding = (PFNGLVERTEXATTRIBBINDINGPROC) get_proc("glVertexAttribBinding");
-	gl3wVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC) get_proc("glVertexAttribDivisor");
-	gl3wVertexAttribFormat = (PFNGLVERTEXATTRIBFORMATPROC) get_proc("glVertexAttribFormat");
-	gl3wVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC) get_proc("glVertexAttribI1i");
-	gl3wVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC) get_proc("glVertexAttribI1iv");
-	gl3wVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC) get_proc("glVertexAttribI1ui");
-	gl3wVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC) get_proc("glVertexAttribI1uiv");
-	gl3wVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC) get_proc("glVertexAttribI2i");
-	gl3wVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC) get_proc("glVertexAttribI2iv");
-	gl3wVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC) get_proc("glVertexAttribI2ui");
-	gl3wVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC) get_proc("glVertexAttribI2uiv");
-	gl3wVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC) get_proc("glVertexAttribI3i");
-	gl3wVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC) get_proc("glVertexAttribI3iv");
-	gl3wVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC) get_proc("glVertexAttribI3ui");
-	gl3wVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC) get_proc("glVertexAttribI3uiv");
-	gl3wVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC) get_proc("glVertexAttribI4bv");
-	gl3wVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC) get_proc("glVertexAttribI4i");
-	gl3wVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC) get_proc("glVertexAttribI4iv");
-	gl3wVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC) get_proc("glVertexAttribI4sv");
-	gl3wVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC) get_proc("glVertexAttribI4ubv");
-	gl3wVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC) get_proc("glVertexAttribI4ui");
-	gl3wVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC) get_proc("glVertexAttribI4uiv");
-	gl3wVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC) get_proc("glVertexAttribI4usv");
-	gl3wVertexAttribIFormat = (PFNGLVERTEXATTRIBIFORMATPROC) get_proc("glVertexAttribIFormat");
-	gl3wVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC) get_proc("glVertexAttribIPointer");
-	gl3wVertexAttribL1d = (PFNGLVERTEXATTRIBL1DPROC) get_proc("glVertexAttribL1d");
-	gl3wVertexAttribL1dv = (PFNGLVERTEXATTRIBL1DVPROC) get_proc("glVertexAttribL1dv");
-	gl3wVertexAttribL1ui64ARB = (PFNGLVERTEXATTRIBL1UI64ARBPROC) get_proc("glVertexAttribL1ui64ARB");
-	gl3wVertexAttribL1ui64vARB = (PFNGLVERTEXATTRIBL1UI64VARBPROC) get_proc("glVertexAttribL1ui64vARB");
-	gl3wVertexAttribL2d = (PFNGLVERTEXATTRIBL2DPROC) get_proc("glVertexAttribL2d");
-	gl3wVertexAttribL2dv = (PFNGLVERTEXATTRIBL2DVPROC) get_proc("glVertexAttribL2dv");
-	gl3wVertexAttribL3d = (PFNGLVERTEXATTRIBL3DPROC) get_proc("glVertexAttribL3d");
-	gl3wVertexAttribL3dv = (PFNGLVERTEXATTRIBL3DVPROC) get_proc("glVertexAttribL3dv");
-	gl3wVertexAttribL4d = (PFNGLVERTEXATTRIBL4DPROC) get_proc("glVertexAttribL4d");
-	gl3wVertexAttribL4dv = (PFNGLVERTEXATTRIBL4DVPROC) get_proc("glVertexAttribL4dv");
-	gl3wVertexAttribLFormat = (PFNGLVERTEXATTRIBLFORMATPROC) get_proc("glVertexAttribLFormat");
-	gl3wVertexAttribLPointer = (PFNGLVERTEXATTRIBLPOINTERPROC) get_proc("glVertexAttribLPointer");
-	gl3wVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC) get_proc("glVertexAttribP1ui");
-	gl3wVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC) get_proc("glVertexAttribP1uiv");
-	gl3wVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC) get_proc("glVertexAttribP2ui");
-	gl3wVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC) get_proc("glVertexAttribP2uiv");
-	gl3wVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC) get_proc("glVertexAttribP3ui");
-	gl3wVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC) get_proc("glVertexAttribP3uiv");
-	gl3wVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC) get_proc("glVertexAttribP4ui");
-	gl3wVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC) get_proc("glVertexAttribP4uiv");
-	gl3wVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC) get_proc("glVertexAttribPointer");
-	gl3wVertexBindingDivisor = (PFNGLVERTEXBINDINGDIVISORPROC) get_proc("glVertexBindingDivisor");
-	gl3wViewport = (PFNGLVIEWPORTPROC) get_proc("glViewport");
-	gl3wViewportArrayv = (PFNGLVIEWPORTARRAYVPROC) get_proc("glViewportArrayv");
-	gl3wViewportIndexedf = (PFNGLVIEWPORTINDEXEDFPROC) get_proc("glViewportIndexedf");
-	gl3wViewportIndexedfv = (PFNGLVIEWPORTINDEXEDFVPROC) get_proc("glViewportIndexedfv");
-	gl3wWaitSync = (PFNGLWAITSYNCPROC) get_proc("glWaitSync");
+	size_t i;
+
+	for (i = 0; i < ARRAY_SIZE(proc_names); i++)
+		gl3wProcs.ptr[i] = get_proc(proc_names[i]);
+}
+
+static void missing_proc(int slot)
+{
+	fprintf(stderr, "gl3w: %s called but not loaded\n", proc_names[slot]);
+	abort();
+}
+
+#define STUB(i) static void stub##i(void) { missing_proc(i); }
+STUB(0) STUB(1) STUB(2) STUB(3) STUB(4) STUB(5)
+STUB(6) STUB(7) STUB(8) STUB(9) STUB(10) STUB(11)
+STUB(12) STUB(13) STUB(14) STUB(15) STUB(16) STUB(17)
+STUB(18) STUB(19) STUB(20) STUB(21) STUB(22) STUB(23)
+STUB(24) STUB(25) STUB(26) STUB(27) STUB(28) STUB(29)
+STUB(30) STUB(31) STUB(32) STUB(33) STUB(34) STUB(35)
+STUB(36) STUB(37) STUB(38) STUB(39) STUB(40) STUB(41)
+STUB(42) STUB(43) STUB(44) STUB(45) STUB(46) STUB(47)
+STUB(48) STUB(49) STUB(50) STUB(51) STUB(52) STUB(53)
+STUB(54) STUB(55) STUB(56) STUB(57) STUB(58) STUB(59)
+STUB(60) STUB(61) STUB(62) STUB(63) STUB(64) STUB(65)
+STUB(66) STUB(67) STUB(68) STUB(69) STUB(70) STUB(71)
+STUB(72) STUB(73) STUB(74) STUB(75) STUB(76) STUB(77)
+STUB(78) STUB(79) STUB(80) STUB(81) STUB(82) STUB(83)
+STUB(84) STUB(85) STUB(86) STUB(87) STUB(88) STUB(89)
+STUB(90) STUB(91) STUB(92) STUB(93) STUB(94) STUB(95)
+STUB(96) STUB(97) STUB(98) STUB(99) STUB(100) STUB(101)
+STUB(102) STUB(103) STUB(104) STUB(105) STUB(106) STUB(107)
+STUB(108) STUB(109) STUB(110) STUB(111) STUB(112) STUB(113)
+STUB(114) STUB(115) STUB(116) STUB(117) STUB(118) STUB(119)
+STUB(120) STUB(121) STUB(122) STUB(123) STUB(124) STUB(125)
+STUB(126) STUB(127) STUB(128) STUB(129) STUB(130) STUB(131)
+STUB(132) STUB(133) STUB(134) STUB(135) STUB(136) STUB(137)
+STUB(138) STUB(139) STUB(140) STUB(141) STUB(142) STUB(143)
+STUB(144) STUB(145) STUB(146) STUB(147) STUB(148) STUB(149)
+STUB(150) STUB(151) STUB(152) STUB(153) STUB(154) STUB(155)
+STUB(156) STUB(157) STUB(158) STUB(159) STUB(160) STUB(161)
+STUB(162) STUB(163) STUB(164) STUB(165) STUB(166) STUB(167)
+STUB(168) STUB(169) STUB(170) STUB(171) STUB(172) STUB(173)
+STUB(174) STUB(175) STUB(176) STUB(177) STUB(178) STUB(179)
+STUB(180) STUB(181) STUB(182) STUB(183) STUB(184) STUB(185)
+STUB(186) STUB(187) STUB(188) STUB(189) STUB(190) STUB(191)
+STUB(192) STUB(193) STUB(194) STUB(195) STUB(196) STUB(197)
+STUB(198) STUB(199) STUB(200) STUB(201) STUB(202) STUB(203)
+STUB(204) STUB(205) STUB(206) STUB(207) STUB(208) STUB(209)
+STUB(210) STUB(211) STUB(212) STUB(213) STUB(214) STUB(215)
+STUB(216) STUB(217) STUB(218) STUB(219) STUB(220) STUB(221)
+STUB(222) STUB(223) STUB(224) STUB(225) STUB(226) STUB(227)
+STUB(228) STUB(229) STUB(230) STUB(231) STUB(232) STUB(233)
+STUB(234) STUB(235) STUB(236) STUB(237) STUB(238) STUB(239)
+STUB(240) STUB(241) STUB(242) STUB(243) STUB(244) STUB(245)
+STUB(246) STUB(247) STUB(248) STUB(249) STUB(250) STUB(251)
+STUB(252) STUB(253) STUB(254) STUB(255) STUB(256) STUB(257)
+STUB(258) STUB(259) STUB(260) STUB(261) STUB(262) STUB(263)
+STUB(264) STUB(265) STUB(266) STUB(267) STUB(268) STUB(269)
+STUB(270) STUB(271) STUB(272) STUB(273) STUB(274) STUB(275)
+STUB(276) STUB(277) STUB(278) STUB(279) STUB(280) STUB(281)
+STUB(282) STUB(283) STUB(284) STUB(285) STUB(286) STUB(287)
+STUB(288) STUB(289) STUB(290) STUB(291) STUB(292) STUB(293)
+STUB(294) STUB(295) STUB(296) STUB(297) STUB(298) STUB(299)
+STUB(300) STUB(301) STUB(302) STUB(303) STUB(304) STUB(305)
+STUB(306) STUB(307) STUB(308) STUB(309) STUB(310) STUB(311)
+STUB(312) STUB(313) STUB(314) STUB(315) STUB(316) STUB(317)
+STUB(318) STUB(319) STUB(320) STUB(321) STUB(322) STUB(323)
+STUB(324) STUB(325) STUB(326) STUB(327) STUB(328) STUB(329)
+STUB(330) STUB(331) STUB(332) STUB(333) STUB(334) STUB(335)
+STUB(336) STUB(337) STUB(338) STUB(339) STUB(340) STUB(341)
+STUB(342) STUB(343) STUB(344) STUB(345) STUB(346) STUB(347)
+STUB(348) STUB(349) STUB(350) STUB(351) STUB(352) STUB(353)
+STUB(354) STUB(355) STUB(356) STUB(357) STUB(358) STUB(359)
+STUB(360) STUB(361) STUB(362) STUB(363) STUB(364) STUB(365)
+STUB(366) STUB(367) STUB(368) STUB(369) STUB(370) STUB(371)
+STUB(372) STUB(373) STUB(374) STUB(375) STUB(376) STUB(377)
+STUB(378) STUB(379) STUB(380) STUB(381) STUB(382) STUB(383)
+STUB(384) STUB(385) STUB(386) STUB(387) STUB(388) STUB(389)
+STUB(390) STUB(391) STUB(392) STUB(393) STUB(394) STUB(395)
+STUB(396) STUB(397) STUB(398) STUB(399) STUB(400) STUB(401)
+STUB(402) STUB(403) STUB(404) STUB(405) STUB(406) STUB(407)
+STUB(408) STUB(409) STUB(410) STUB(411) STUB(412) STUB(413)
+STUB(414) STUB(415) STUB(416) STUB(417) STUB(418) STUB(419)
+STUB(420) STUB(421) STUB(422) STUB(423) STUB(424) STUB(425)
+STUB(426) STUB(427) STUB(428) STUB(429) STUB(430) STUB(431)
+STUB(432) STUB(433) STUB(434) STUB(435) STUB(436) STUB(437)
+STUB(438) STUB(439) STUB(440) STUB(441) STUB(442) STUB(443)
+STUB(444) STUB(445) STUB(446) STUB(447) STUB(448) STUB(449)
+STUB(450) STUB(451) STUB(452) STUB(453) STUB(454) STUB(455)
+STUB(456) STUB(457) STUB(458) STUB(459) STUB(460) STUB(461)
+STUB(462) STUB(463) STUB(464) STUB(465) STUB(466) STUB(467)
+STUB(468) STUB(469) STUB(470) STUB(471) STUB(472) STUB(473)
+STUB(474) STUB(475) STUB(476) STUB(477) STUB(478) STUB(479)
+STUB(480) STUB(481) STUB(482) STUB(483) STUB(484) STUB(485)
+STUB(486) STUB(487) STUB(488) STUB(489) STUB(490) STUB(491)
+STUB(492) STUB(493) STUB(494) STUB(495) STUB(496) STUB(497)
+STUB(498) STUB(499) STUB(500) STUB(501) STUB(502) STUB(503)
+STUB(504) STUB(505) STUB(506) STUB(507) STUB(508) STUB(509)
+STUB(510) STUB(511) STUB(512) STUB(513) STUB(514) STUB(515)
+STUB(516) STUB(517) STUB(518) STUB(519) STUB(520) STUB(521)
+STUB(522) STUB(523) STUB(524) STUB(525) STUB(526) STUB(527)
+STUB(528) STUB(529) STUB(530) STUB(531) STUB(532) STUB(533)
+STUB(534) STUB(535) STUB(536) STUB(537) STUB(538) STUB(539)
+STUB(540) STUB(541) STUB(542) STUB(543) STUB(544) STUB(545)
+STUB(546) STUB(547) STUB(548) STUB(549) STUB(550) STUB(551)
+STUB(552) STUB(553) STUB(554) STUB(555) STUB(556) STUB(557)
+STUB(558) STUB(559) STUB(560) STUB(561) STUB(562) STUB(563)
+STUB(564) STUB(565) STUB(566) STUB(567) STUB(568) STUB(569)
+STUB(570) STUB(571) STUB(572) STUB(573) STUB(574) STUB(575)
+STUB(576) STUB(577) STUB(578) STUB(579) STUB(580) STUB(581)
+STUB(582) STUB(583) STUB(584) STUB(585) STUB(586) STUB(587)
+STUB(588) STUB(589) STUB(590) STUB(591) STUB(592) STUB(593)
+STUB(594) STUB(595) STUB(596) STUB(597) STUB(598) STUB(599)
+STUB(600) STUB(601) STUB(602) STUB(603) STUB(604) STUB(605)
+STUB(606) STUB(607) STUB(608) STUB(609) STUB(610) STUB(611)
+STUB(612) STUB(613) STUB(614) STUB(615) STUB(616) STUB(617)
+STUB(618) STUB(619) STUB(620) STUB(621) STUB(622) STUB(623)
+STUB(624) STUB(625) STUB(626) STUB(627) STUB(628) STUB(629)
+STUB(630) STUB(631) STUB(632) STUB(633) STUB(634) STUB(635)
+STUB(636) STUB(637) STUB(638) STUB(639) STUB(640) STUB(641)
+STUB(642) STUB(643) STUB(644) STUB(645) STUB(646) STUB(647)
+STUB(648) STUB(649) STUB(650) STUB(651) STUB(652) STUB(653)
+STUB(654) STUB(655) STUB(656) STUB(657) STUB(658) STUB(659)
+STUB(660) STUB(661) STUB(662) STUB(663) STUB(664) STUB(665)
+STUB(666) STUB(667) STUB(668) STUB(669) STUB(670) STUB(671)
+STUB(672) STUB(673) STUB(674) STUB(675) STUB(676) STUB(677)
+STUB(678) STUB(679) STUB(680) STUB(681) STUB(682) STUB(683)
+STUB(684) STUB(685) STUB(686) STUB(687) STUB(688) STUB(689)
+STUB(690) STUB(691) STUB(692) STUB(693) STUB(694) STUB(695)
+STUB(696) STUB(697) STUB(698) STUB(699)
+
+static const GL3WglProc proc_stubs[GL3W_PROC_COUNT] = {
+	stub0, stub1, stub2, stub3, stub4, stub5, stub6, stub7,
+	stub8, stub9, stub10, stub11, stub12, stub13, stub14, stub15,
+	stub16, stub17, stub18, stub19, stub20, stub21, stub22, stub23,
+	stub24, stub25, stub26, stub27, stub28, stub29, stub30, stub31,
+	stub32, stub33, stub34, stub35, stub36, stub37, stub38, stub39,
+	stub40, stub41, stub42, stub43, stub44, stub45, stub46, stub47,
+	stub48, stub49, stub50, stub51, stub52, stub53, stub54, stub55,
+	stub56, stub57, stub58, stub59, stub60, stub61, stub62, stub63,
+	stub64, stub65, stub66, stub67, stub68, stub69, stub70, stub71,
+	stub72, stub73, stub74, stub75, stub76, stub77, stub78, stub79,
+	stub80, stub81, stub82, stub83, stub84, stub85, stub86, stub87,
+	stub88, stub89, stub90, stub91, stub92, stub93, stub94, stub95,
+	stub96, stub97, stub98, stub99, stub100, stub101, stub102, stub103,
+	stub104, stub105, stub106, stub107, stub108, stub109, stub110, stub111,
+	stub112, stub113, stub114, stub115, stub116, stub117, stub118, stub119,
+	stub120, stub121, stub122, stub123, stub124, stub125, stub126, stub127,
+	stub128, stub129, stub130, stub131, stub132, stub133, stub134, stub135,
+	stub136, stub137, stub138, stub139, stub140, stub141, stub142, stub143,
+	stub144, stub145, stub146, stub147, stub148, stub149, stub150, stub151,
+	stub152, stub153, stub154, stub155, stub156, stub157, stub158, stub159,
+	stub160, stub161, stub162, stub163, stub164, stub165, stub166, stub167,
+	stub168, stub169, stub170, stub171, stub172, stub173, stub174, stub175,
+	stub176, stub177, stub178, stub179, stub180, stub181, stub182, stub183,
+	stub184, stub185, stub186, stub187, stub188, stub189, stub190, stub191,
+	stub192, stub193, stub194, stub195, stub196, stub197, stub198, stub199,
+	stub200, stub201, stub202, stub203, stub204, stub205, stub206, stub207,
+	stub208, stub209, stub210, stub211, stub212, stub213, stub214, stub215,
+	stub216, stub217, stub218, stub219, stub220, stub221, stub222, stub223,
+	stub224, stub225, stub226, stub227, stub228, stub229, stub230, stub231,
+	stub232, stub233, stub234, stub235, stub236, stub237, stub238, stub239,
+	stub240, stub241, stub242, stub243, stub244, stub245, stub246, stub247,
+	stub248, stub249, stub250, stub251, stub252, stub253, stub254, stub255,
+	stub256, stub257, stub258, stub259, stub260, stub261, stub262, stub263,
+	stub264, stub265, stub266, stub267, stub268, stub269, stub270, stub271,
+	stub272, stub273, stub274, stub275, stub276, stub277, stub278, stub279,
+	stub280, stub281, stub282, stub283, stub284, stub285, stub286, stub287,
+	stub288, stub289, stub290, stub291, stub292, stub293, stub294, stub295,
+	stub296, stub297, stub298, stub299, stub300, stub301, stub302, stub303,
+	stub304, stub305, stub306, stub307, stub308, stub309, stub310, stub311,
+	stub312, stub313, stub314, stub315, stub316, stub317, stub318, stub319,
+	stub320, stub321, stub322, stub323, stub324, stub325, stub326, stub327,
+	stub328, stub329, stub330, stub331, stub332, stub333, stub334, stub335,
+	stub336, stub337, stub338, stub339, stub340, stub341, stub342, stub343,
+	stub344, stub345, stub346, stub347, stub348, stub349, stub350, stub351,
+	stub352, stub353, stub354, stub355, stub356, stub357, stub358, stub359,
+	stub360, stub361, stub362, stub363, stub364, stub365, stub366, stub367,
+	stub368, stub369, stub370, stub371, stub372, stub373, stub374, stub375,
+	stub376, stub377, stub378, stub379, stub380, stub381, stub382, stub383,
+	stub384, stub385, stub386, stub387, stub388, stub389, stub390, stub391,
+	stub392, stub393, stub394, stub395, stub396, stub397, stub398, stub399,
+	stub400, stub401, stub402, stub403, stub404, stub405, stub406, stub407,
+	stub408, stub409, stub410, stub411, stub412, stub413, stub414, stub415,
+	stub416, stub417, stub418, stub419, stub420, stub421, stub422, stub423,
+	stub424, stub425, stub426, stub427, stub428, stub429, stub430, stub431,
+	stub432, stub433, stub434, stub435, stub436, stub437, stub438, stub439,
+	stub440, stub441, stub442, stub443, stub444, stub445, stub446, stub447,
+	stub448, stub449, stub450, stub451, stub452, stub453, stub454, stub455,
+	stub456, stub457, stub458, stub459, stub460, stub461, stub462, stub463,
+	stub464, stub465, stub466, stub467, stub468, stub469, stub470, stub471,
+	stub472, stub473, stub474, stub475, stub476, stub477, stub478, stub479,
+	stub480, stub481, stub482, stub483, stub484, stub485, stub486, stub487,
+	stub488, stub489, stub490, stub491, stub492, stub493, stub494, stub495,
+	stub496, stub497, stub498, stub499, stub500, stub501, stub502, stub503,
+	stub504, stub505, stub506, stub507, stub508, stub509, stub510, stub511,
+	stub512, stub513, stub514, stub515, stub516, stub517, stub518, stub519,
+	stub520, stub521, stub522, stub523, stub524, stub525, stub526, stub527,
+	stub528, stub529, stub530, stub531, stub532, stub533, stub534, stub535,
+	stub536, stub537, stub538, stub539, stub540, stub541, stub542, stub543,
+	stub544, stub545, stub546, stub547, stub548, stub549, stub550, stub551,
+	stub552, stub553, stub554, stub555, stub556, stub557, stub558, stub559,
+	stub560, stub561, stub562, stub563, stub564, stub565, stub566, stub567,
+	stub568, stub569, stub570, stub571, stub572, stub573, stub574, stub575,
+	stub576, stub577, stub578, stub579, stub580, stub581, stub582, stub583,
+	stub584, stub585, stub586, stub587, stub588, stub589, stub590, stub591,
+	stub592, stub593, stub594, stub595, stub596, stub597, stub598, stub599,
+	stub600, stub601, stub602, stub603, stub604, stub605, stub606, stub607,
+	stub608, stub609, stub610, stub611, stub612, stub613, stub614, stub615,
+	stub616, stub617, stub618, stub619, stub620, stub621, stub622, stub623,
+	stub624, stub625, stub626, stub627, stub628, stub629, stub630, stub631,
+	stub632, stub633, stub634, stub635, stub636, stub637, stub638, stub639,
+	stub640, stub641, stub642, stub643, stub644, stub645, stub646, stub647,
+	stub648, stub649, stub650, stub651, stub652, stub653, stub654, stub655,
+	stub656, stub657, stub658, stub659, stub660, stub661, stub662, stub663,
+	stub664, stub665, stub666, stub667, stub668, stub669, stub670, stub671,
+	stub672, stub673, stub674, stub675, stub676, stub677, stub678, stub679,
+	stub680, stub681, stub682, stub683, stub684, stub685, stub686, stub687,
+	stub688, stub689, stub690, stub691, stub692, stub693, stub694, stub695,
+	stub696, stub697, stub698, stub699,
+};
+
+/* While tracing, gl3wProcs holds wrappers and the driver's entry
+ * points live in the real table.
+ */
+static int is_stub(int slot)
+{
+	if (trace_mode)
+		return real.ptr[slot] == proc_stubs[slot];
+	return gl3wProcs.ptr[slot] == proc_stubs[slot];
+}
+
+static const char *missing;
+
+const char *gl3wMissing(void)
+{
+	return missing;
+}
+
+unsigned gl3wExtensions[(GL3W_EXTENSION_COUNT + 31) / 32];
+
+/* Open addressing with linear probing, at most half full. The strings
+ * belong to the context and live as long as it does.
+ */
+static const char **ext_set;
+static unsigned ext_mask;
+
+static int ext_cmp(const void *a, const void *b)
+{
+	return strcmp((const char *) a, *(const char *const *) b);
+}
+
+/* ID of a known extension, or -1. */
+static int ext_id(const char *ext)
+{
+	const char *const *p = (const char *const *) bsearch(ext, ext_names,
+		ARRAY_SIZE(ext_names), sizeof(*ext_names), ext_cmp);
+
+	return p ? (int) (p - ext_names) : -1;
+}
+
+static void load_extensions(void)
+{
+	GLint i, n = 0;
+	unsigned h, size = 16;
+	const char *ext;
+	int id;
+
+	free(ext_set);
+	memset(gl3wExtensions, 0, sizeof(gl3wExtensions));
+	glGetIntegerv(GL_NUM_EXTENSIONS, &n);
+	while (size < 2 * (unsigned) n)
+		size *= 2;
+	ext_set = (const char **) calloc(size, sizeof(*ext_set));
+	if (!ext_set)
+		return;
+	ext_mask = size - 1;
+	for (i = 0; i < n; i++) {
+		ext = (const char *) glGetStringi(GL_EXTENSIONS, i);
+		if (!ext || gl3wIsExtensionSupported(ext))
+			continue;
+		for (h = fnv1a(2166136261u, ext); ext_set[h & ext_mask]; h++)
+			;
+		ext_set[h & ext_mask] = ext;
+		if ((id = ext_id(ext)) >= 0)
+			gl3wExtensions[id / 32] |= 1u << (id % 32);
+	}
+}
+
+int gl3wIsExtensionSupported(const char *ext)
+{
+	unsigned h;
+
+	if (!ext_set)
+		return 0;
+	for (h = fnv1a(2166136261u, ext); ext_set[h & ext_mask]; h++)
+		if (!strcmp(ext_set[h & ext_mask], ext))
+			return 1;
+	return 0;
+}
+
+enum { SKIP, OPTIONAL, REQUIRED };
+
+int gl3wInitSubset(const struct GL3WSubset *subset)
+{
+	static const char *const bootstrap[] = {
+		"glGetIntegerv", "glGetString", "glGetStringi"
+	};
+	unsigned char want[GL3W_PROC_COUNT];
+	const char *const *p;
+	int i, slot, ext, need, ret = GL3W_OK;
+
+	gl3wTrace(GL3W_TRACE_OFF);
+	if (!libgl) {
+		open_libgl();
+		atexit(close_libgl);
+	}
+	missing = NULL;
+	memcpy(gl3wProcs.ptr, proc_stubs, sizeof(proc_stubs));
+	for (i = 0; i < (int) ARRAY_SIZE(bootstrap); i++) {
+		GL3WglProc proc = get_proc(bootstrap[i]);
+
+		if (!proc)
+			return GL3W_ERROR_INIT;
+		gl3wProcs.ptr[gl3wProcIndex(bootstrap[i])] = proc;
+	}
+	if (parse_version())
+		return GL3W_ERROR_INIT;
+	load_extensions();
+	need = subset->major * 10 + subset->minor;
+	if (version.major * 10 + version.minor < need)
+		return GL3W_ERROR_OPENGL_VERSION;
+
+	for (i = 0; i < GL3W_PROC_COUNT; i++)
+		want[i] = proc_versions[i] && proc_versions[i] <= need ?
+			REQUIRED : SKIP;
+	for (p = subset->extensions; p && *p; p++) {
+		if (!gl3wIsExtensionSupported(*p)) {
+			if (!missing)
+				missing = *p;
+			ret = GL3W_ERROR_MISSING;
+			continue;
+		}
+		ext = ext_id(*p) + 1;
+		for (i = 0; ext && i < GL3W_PROC_COUNT; i++)
+			if (proc_exts[i] == ext)
+				want[i] = REQUIRED;
+	}
+	if (subset->procs) {
+		unsigned char listed[GL3W_PROC_COUNT] = {0};
+
+		for (p = subset->procs; *p; p++)
+			if ((slot = gl3wProcIndex(*p)) >= 0)
+				listed[slot] = 1;
+		for (i = 0; i < GL3W_PROC_COUNT; i++) {
+			if (!listed[i])
+				want[i] = SKIP;
+			else if (want[i] == SKIP)
+				want[i] = OPTIONAL;
+		}
+	}
+
+	for (i = 0; i < GL3W_PROC_COUNT; i++) {
+		GL3WglProc proc;
+
+		if (want[i] == SKIP)
+			continue;
+		proc = get_proc(proc_names[i]);
+		if (proc) {
+			gl3wProcs.ptr[i] = proc;
+		} else if (want[i] == REQUIRED) {
+			if (!missing)
+				missing = proc_names[i];
+			ret = GL3W_ERROR_MISSING;
+		}
+	}
+	return ret;
+}
+
+/* Capture. A trace file starts with the magic "GL3WTRC", a version and
+ * a byte order mark, each 32-bit, followed by records. A record has a
+ * 16-byte header (16-bit slot, 16-bit flags, 32-bit payload length,
+ * 64-bit nanoseconds since the capture started) and a payload of the
+ * call's arguments in parameter order. Blobs are length prefixed and
+ * 8-byte aligned in the file so replay can use them in place.
+ */
+#define CAPTURE_VERSION     1
+#define CAPTURE_FRAME       0xffff
+#define CAPTURE_NAME        0xfffe
+#define CAPTURE_MAPDATA     0xfffd
+#define CAPTURE_UNSUPPORTED 1
+
+struct capture_mapping {
+	int named;
+	GLuint key;
+	unsigned char *ptr;
+	GLsizeiptr length;
+	GLbitfield access;
+};
+
+static FILE *capture_file;
+static unsigned char *capture_buf;
+static size_t capture_len, capture_cap, capture_start;
+static GLuint64 capture_pos;
+static double capture_epoch;
+static unsigned char capture_named[(GL3W_PROC_COUNT + 7) / 8];
+static struct capture_mapping capture_maps[16];
+
+static void capture_put(const void *data, size_t len)
+{
+	if (capture_len + len > capture_cap) {
+		size_t cap = capture_cap ? capture_cap : 4096;
+		unsigned char *buf;
+
+		while (cap < capture_len + len)
+			cap *= 2;
+		buf = (unsigned char *) realloc(capture_buf, cap);
+		if (!buf) {
+			fprintf(stderr, "gl3w: capture: out of memory\n");
+			abort();
+		}
+		capture_buf = buf;
+		capture_cap = cap;
+	}
+	memcpy(capture_buf + capture_len, data, len);
+	capture_len += len;
+}
+
+static void capture_u16(unsigned short v) { capture_put(&v, sizeof(v)); }
+static void capture_u32(GLuint v) { capture_put(&v, sizeof(v)); }
+static void capture_u64(GLuint64 v) { capture_put(&v, sizeof(v)); }
+static void capture_f32(GLfloat v) { capture_put(&v, sizeof(v)); }
+static void capture_f64(GLdouble v) { capture_put(&v, sizeof(v)); }
+
+static void capture_align(void)
+{
+	static const unsigned char zero[8];
+
+	capture_put(zero, (8 - (capture_pos + capture_len) % 8) % 8);
+}
+
+static void capture_blob(const void *data, size_t len)
+{
+	capture_u32((GLuint) len);
+	capture_align();
+	capture_put(data, len);
+}
+
+static void capture_header(unsigned short slot, unsigned short flags, double t)
+{
+	capture_start = capture_len;
+	capture_u16(slot);
+	capture_u16(flags);
+	capture_u32(0);
+	capture_u64((GLuint64) ((t - capture_epoch) * 1e9));
+}
+
+static void capture_end(void)
+{
+	GLuint len = (GLuint) (capture_len - capture_start - 16);
+
+	memcpy(capture_buf + capture_start + 4, &len, sizeof(len));
+	if (fwrite(capture_buf, capture_len, 1, capture_file) != 1)
+		fprintf(stderr, "gl3w: capture: write failed\n");
+	capture_pos += capture_len;
+	capture_len = 0;
+}
+
+static void capture_begin(int slot, double t)
+{
+	if (!(capture_named[slot / 8] & (1 << (slot % 8)))) {
+		capture_named[slot / 8] |= 1 << (slot % 8);
+		capture_header(CAPTURE_NAME, 0, t);
+		capture_u32(slot);
+		capture_blob(proc_names[slot], strlen(proc_names[slot]) + 1);
+		capture_end();
+	}
+	capture_header((unsigned short) slot, 0, t);
+}
+
+static void capture_unsupported(int slot, double t)
+{
+	capture_begin(slot, t);
+	memcpy(capture_buf + capture_start + 2, "\1\0", 2);
+	capture_end();
+}
+
+/* Pointers come in three flavors: 0 for NULL, 1 for an offset into a
+ * bound buffer, 2 for data copied into the trace.
+ */
+static void capture_data(const void *data, GLsizeiptr len)
+{
+	if (!data) {
+		capture_u32(0);
+	} else {
+		capture_u32(2);
+		capture_blob(data, len > 0 ? (size_t) len : 0);
+	}
+}
+
+static void capture_pixels(const void *data, GLsizeiptr len)
+{
+	GLint buffer = 0;
+
+	real.gl.GetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING, &buffer);
+	if (buffer) {
+		capture_u32(1);
+		capture_u64((GLuint64) (size_t) data);
+	} else {
+		capture_data(data, len);
+	}
+}
+
+static void capture_pack(const void *data)
+{
+	GLint buffer = 0;
+
+	real.gl.GetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &buffer);
+	if (buffer) {
+		capture_u32(1);
+		capture_u64((GLuint64) (size_t) data);
+	} else {
+		capture_u32(0);
+	}
+}
+
+static void capture_string(const GLchar *s, GLsizei len)
+{
+	/* A NULL string is recorded as an empty one */
+	if (!s) {
+		s = "";
+		len = 0;
+	} else if (len < 0) {
+		len = (GLsizei) strlen(s);
+	}
+	capture_u32(len + 1);
+	capture_align();
+	capture_put(s, len);
+	capture_put("", 1);
+}
+
+static void capture_strings(GLsizei count, const GLchar *const *s,
+			    const GLint *lens)
+{
+	GLsizei i;
+
+	capture_u32(count);
+	for (i = 0; i < count; i++)
+		capture_string(s[i], lens ? lens[i] : -1);
+}
+
+static void capture_offsets(const void *const *offsets, GLsizei count)
+{
+	GLsizei i;
+
+	capture_u32(count);
+	for (i = 0; i < count; i++)
+		capture_u64((GLuint64) (size_t) offsets[i]);
+}
+
+static size_t capture_param_size(GLenum pname)
+{
+	switch (pname) {
+	case GL_TEXTURE_BORDER_COLOR:
+	case GL_TEXTURE_SWIZZLE_RGBA:
+		return 16;
+	}
+	return 4;
+}
+
+static size_t capture_pixel_size(GLenum format, GLenum type)
+{
+	size_t components, size;
+
+	switch (type) {
+	case GL_UNSIGNED_BYTE_3_3_2:
+	case GL_UNSIGNED_BYTE_2_3_3_REV:
+		return 1;
+	case GL_UNSIGNED_SHORT_5_6_5:
+	case GL_UNSIGNED_SHORT_5_6_5_REV:
+	case GL_UNSIGNED_SHORT_4_4_4_4:
+	case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+	case GL_UNSIGNED_SHORT_5_5_5_1:
+	case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+		return 2;
+	case GL_UNSIGNED_INT_8_8_8_8:
+	case GL_UNSIGNED_INT_8_8_8_8_REV:
+	case GL_UNSIGNED_INT_10_10_10_2:
+	case GL_UNSIGNED_INT_2_10_10_10_REV:
+	case GL_UNSIGNED_INT_24_8:
+	case GL_UNSIGNED_INT_10F_11F_11F_REV:
+	case GL_UNSIGNED_INT_5_9_9_9_REV:
+		return 4;
+	case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+		return 8;
+	case GL_SHORT:
+	case GL_UNSIGNED_SHORT:
+	case GL_HALF_FLOAT:
+		size = 2;
+		break;
+	case GL_INT:
+	case GL_UNSIGNED_INT:
+	case GL_FLOAT:
+		size = 4;
+		break;
+	default:
+		size = 1;
+	}
+	switch (format) {
+	case GL_RG:
+	case GL_RG_INTEGER:
+	case GL_DEPTH_STENCIL:
+		components = 2;
+		break;
+	case GL_RGB:
+	case GL_BGR:
+	case GL_RGB_INTEGER:
+	case GL_BGR_INTEGER:
+		components = 3;
+		break;
+	case GL_RGBA:
+	case GL_BGRA:
+	case GL_RGBA_INTEGER:
+	case GL_BGRA_INTEGER:
+		components = 4;
+		break;
+	default:
+		components = 1;
+	}
+	return components * size;
+}
+
+/* Honors GL_UNPACK_ALIGNMENT but not the other unpack parameters. */
+static size_t capture_image_size(GLenum format, GLenum type,
+				 GLsizei width, GLsizei height, GLsizei depth)
+{
+	GLint align = 4;
+	size_t row, stride;
+
+	if (width <= 0 || height <= 0 || depth <= 0)
+		return 0;
+	real.gl.GetIntegerv(GL_UNPACK_ALIGNMENT, &align);
+	row = capture_pixel_size(format, type) * width;
+	stride = (row + align - 1) / align * align;
+	return stride * ((size_t) height * depth - 1) + row;
+}
+
+static GLsizeiptr capture_buffer_size(int named, GLuint key)
+{
+	GLint64 size = 0;
+
+	if (named)
+		real.gl.GetNamedBufferParameteri64v(key, GL_BUFFER_SIZE, &size);
+	else
+		real.gl.GetBufferParameteri64v(key, GL_BUFFER_SIZE, &size);
+	return (GLsizeiptr) size;
+}
+
+static struct capture_mapping *capture_find(int named, GLuint key)
+{
+	size_t i;
+
+	for (i = 0; i < ARRAY_SIZE(capture_maps); i++)
+		if (capture_maps[i].ptr && capture_maps[i].named == named &&
+		    capture_maps[i].key == key)
+			return capture_maps + i;
+	return NULL;
+}
+
+static void capture_map(int named, GLuint key, void *ptr,
+			GLsizeiptr length, GLbitfield access)
+{
+	struct capture_mapping *m = capture_find(named, key);
+	size_t i;
+
+	for (i = 0; !m && i < ARRAY_SIZE(capture_maps); i++)
+		if (!capture_maps[i].ptr)
+			m = capture_maps + i;
+	if (!m || !ptr)
+		return;
+	m->named = named;
+	m->key = key;
+	m->ptr = (unsigned char *) ptr;
+	m->length = length;
+	m->access = access;
+}
+
+/* Writes through a mapping are invisible to the wrappers, so they are
+ * recorded when flushed or unmapped. Persistent mappings that are
+ * never flushed explicitly can't be captured.
+ */
+static void capture_unmap(int named, GLuint key, GLintptr offset,
+			  GLsizeiptr length)
+{
+	struct capture_mapping *m = capture_find(named, key);
+
+	if (!m)
+		return;
+	if (length < 0 && (!(m->access & GL_MAP_WRITE_BIT) ||
+			   (m->access & GL_MAP_FLUSH_EXPLICIT_BIT))) {
+		m->ptr = NULL;
+		return;
+	}
+	if (length < 0)
+		length = m->length;
+	capture_header(CAPTURE_MAPDATA, 0, now());
+	capture_u32(named);
+	capture_u32(key);
+	capture_u64(offset);
+	capture_blob(m->ptr + offset, length);
+	capture_end();
+	if (offset == 0 && length == m->length && !(m->access & GL_MAP_FLUSH_EXPLICIT_BIT))
+		m->ptr = NULL;
+}
+
+int gl3wCaptureStart(const char *path)
+{
+	GLuint header[4];
+
+	gl3wCaptureStop();
+	capture_file = fopen(path, "wb");
+	if (!capture_file)
+		return -1;
+	memcpy(header, "GL3WTRC", 8);
+	header[2] = CAPTURE_VERSION;
+	header[3] = 0x01020304;
+	fwrite(header, sizeof(header), 1, capture_file);
+	capture_pos = sizeof(header);
+	capture_epoch = now();
+	lookup_proc("glGetBufferParameteri64v");
+	gl3wTrace(trace_mode | GL3W_TRACE_CAPTURE);
+	return 0;
+}
+
+void gl3wCaptureFrame(void)
+{
+	if (!(trace_mode & GL3W_TRACE_CAPTURE))
+		return;
+	capture_header(CAPTURE_FRAME, 0, now());
+	capture_end();
+}
+
+void gl3wCaptureStop(void)
+{
+	if (!capture_file)
+		return;
+	gl3wTrace(trace_mode & ~GL3W_TRACE_CAPTURE);
+	fclose(capture_file);
+	capture_file = NULL;
+	free(capture_buf);
+	capture_buf = NULL;
+	capture_len = capture_cap = 0;
+	memset(capture_named, 0, sizeof(capture_named));
+	memset(capture_maps, 0, sizeof(capture_maps));
+}
+
+static struct GL3WTraceStat trace_stats[GL3W_PROC_COUNT];
+static int trace_reported[GL3W_PROC_COUNT];
+
+static void trace_resolved(int slot, GL3WglProc proc)
+{
+	if (trace_mode) {
+		real.ptr[slot] = proc;
+		gl3wProcs.ptr[slot] = trace_procs[slot];
+	} else {
+		gl3wProcs.ptr[slot] = proc;
+	}
+}
+
+void gl3wTrace(int mode)
+{
+	int i;
+
+	if (!capture_file)
+		mode &= ~GL3W_TRACE_CAPTURE;
+	/* A subset may have left glGetError() unloaded. */
+	if ((mode & GL3W_TRACE_ERRORS) == GL3W_TRACE_ERRORS)
+		lookup_proc("glGetError");
+	if (!trace_mode && mode) {
+		real = gl3wProcs;
+		for (i = 0; i < GL3W_PROC_COUNT; i++)
+			if (gl3wProcs.ptr[i])
+				gl3wProcs.ptr[i] = trace_procs[i];
+	} else if (trace_mode && !mode) {
+		gl3wProcs = real;
+	}
+	trace_mode = mode;
+}
+
+int gl3wTraceMode(void)
+{
+	return trace_mode;
 }
+
+const struct GL3WTraceStat *gl3wTraceStats(void)
+{
+	return trace_stats;
+}
+
+void gl3wTraceReset(void)
+{
+	memset(trace_stats, 0, sizeof(trace_stats));
+	memset(trace_reported, 0, sizeof(trace_reported));
+}
+
+/* Other threads' contexts, such as a streaming worker's, dispatch
+ * through the same table, so the statistics are updated atomically
+ * where the compiler has the GNU builtins for it.
+ */
+#ifdef __GNUC__
+static void add_count(unsigned long *count)
+{
+	__atomic_fetch_add(count, 1, __ATOMIC_RELAXED);
+}
+
+static void add_seconds(double *sum, double seconds)
+{
+	double old;
+
+	__atomic_load(sum, &old, __ATOMIC_RELAXED);
+	while (!__atomic_compare_exchange(sum, &old, &(double){old + seconds},
+					  1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+		;
+}
+
+/* Sets *flag and returns whether it was clear. */
+static int first_time(int *flag)
+{
+	return !__atomic_exchange_n(flag, 1, __ATOMIC_RELAXED);
+}
+#else
+static void add_count(unsigned long *count)
+{
+	++*count;
+}
+
+static void add_seconds(double *sum, double seconds)
+{
+	*sum += seconds;
+}
+
+static int first_time(int *flag)
+{
+	int old = *flag;
+
+	*flag = 1;
+	return !old;
+}
+#endif
+
+static void trace_end(int slot, double start)
+{
+	GLenum err;
+
+	add_count(&trace_stats[slot].calls);
+	add_seconds(&trace_stats[slot].seconds, now() - start);
+	if ((trace_mode & GL3W_TRACE_ERRORS) != GL3W_TRACE_ERRORS ||
+	    slot == 219)
+		return;
+	while ((err = real.gl.GetError()) != GL_NO_ERROR) {
+		add_count(&trace_stats[slot].errors);
+		if (first_time(&trace_reported[slot])) {
+			fprintf(stderr, "gl3w: %s: error 0x%04x\n",
+				proc_names[slot], (unsigned) err);
+		}
+	}
+}
+
+static void APIENTRY trace_ActiveShaderProgram(GLuint pipeline, GLuint program)
+{
+	double t0 = now();
+
+	real.gl.ActiveShaderProgram(pipeline, program);
+	trace_end(0, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(0, t0);
+		capture_u32((GLuint) pipeline);
+		capture_u32((GLuint) program);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ActiveTexture(GLenum texture)
+{
+	double t0 = now();
+
+	real.gl.ActiveTexture(texture);
+	trace_end(1, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(1, t0);
+		capture_u32((GLuint) texture);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_AttachShader(GLuint program, GLuint shader)
+{
+	double t0 = now();
+
+	real.gl.AttachShader(program, shader);
+	trace_end(2, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(2, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) shader);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BeginConditionalRender(GLuint id, GLenum mode)
+{
+	double t0 = now();
+
+	real.gl.BeginConditionalRender(id, mode);
+	trace_end(3, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(3, t0);
+		capture_u32((GLuint) id);
+		capture_u32((GLuint) mode);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BeginQuery(GLenum target, GLuint id)
+{
+	double t0 = now();
+
+	real.gl.BeginQuery(target, id);
+	trace_end(4, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(4, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) id);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BeginQueryIndexed(GLenum target, GLuint index, GLuint id)
+{
+	double t0 = now();
+
+	real.gl.BeginQueryIndexed(target, index, id);
+	trace_end(5, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(5, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) id);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BeginTransformFeedback(GLenum primitiveMode)
+{
+	double t0 = now();
+
+	real.gl.BeginTransformFeedback(primitiveMode);
+	trace_end(6, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(6, t0);
+		capture_u32((GLuint) primitiveMode);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BindAttribLocation(GLuint program, GLuint index, const GLchar *name)
+{
+	double t0 = now();
+
+	real.gl.BindAttribLocation(program, index, name);
+	trace_end(7, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(7, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) index);
+		capture_string(name, -1);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BindBuffer(GLenum target, GLuint buffer)
+{
+	double t0 = now();
+
+	real.gl.BindBuffer(target, buffer);
+	trace_end(8, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(8, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) buffer);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+	double t0 = now();
+
+	real.gl.BindBufferBase(target, index, buffer);
+	trace_end(9, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(9, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) buffer);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+	double t0 = now();
+
+	real.gl.BindBufferRange(target, index, buffer, offset, size);
+	trace_end(10, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(10, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) buffer);
+		capture_u64((GLuint64) offset);
+		capture_u64((GLuint64) size);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers)
+{
+	double t0 = now();
+
+	real.gl.BindBuffersBase(target, first, count, buffers);
+	trace_end(11, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(11, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) first);
+		capture_u32((GLuint) count);
+		capture_data(buffers, count * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes)
+{
+	double t0 = now();
+
+	real.gl.BindBuffersRange(target, first, count, buffers, offsets, sizes);
+	trace_end(12, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(12, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) first);
+		capture_u32((GLuint) count);
+		capture_data(buffers, count * 4);
+		capture_data(offsets, count * 8);
+		capture_data(sizes, count * 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BindFragDataLocation(GLuint program, GLuint color, const GLchar *name)
+{
+	double t0 = now();
+
+	real.gl.BindFragDataLocation(program, color, name);
+	trace_end(13, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(13, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) color);
+		capture_string(name, -1);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name)
+{
+	double t0 = now();
+
+	real.gl.BindFragDataLocationIndexed(program, colorNumber, index, name);
+	trace_end(14, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(14, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) colorNumber);
+		capture_u32((GLuint) index);
+		capture_string(name, -1);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BindFramebuffer(GLenum target, GLuint framebuffer)
+{
+	double t0 = now();
+
+	real.gl.BindFramebuffer(target, framebuffer);
+	trace_end(15, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(15, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) framebuffer);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format)
+{
+	double t0 = now();
+
+	real.gl.BindImageTexture(unit, texture, level, layered, layer, access, format);
+	trace_end(16, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(16, t0);
+		capture_u32((GLuint) unit);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) layered);
+		capture_u32((GLuint) layer);
+		capture_u32((GLuint) access);
+		capture_u32((GLuint) format);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BindImageTextures(GLuint first, GLsizei count, const GLuint *textures)
+{
+	double t0 = now();
+
+	real.gl.BindImageTextures(first, count, textures);
+	trace_end(17, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(17, t0);
+		capture_u32((GLuint) first);
+		capture_u32((GLuint) count);
+		capture_data(textures, count * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BindProgramPipeline(GLuint pipeline)
+{
+	double t0 = now();
+
+	real.gl.BindProgramPipeline(pipeline);
+	trace_end(18, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(18, t0);
+		capture_u32((GLuint) pipeline);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BindRenderbuffer(GLenum target, GLuint renderbuffer)
+{
+	double t0 = now();
+
+	real.gl.BindRenderbuffer(target, renderbuffer);
+	trace_end(19, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(19, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) renderbuffer);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BindSampler(GLuint unit, GLuint sampler)
+{
+	double t0 = now();
+
+	real.gl.BindSampler(unit, sampler);
+	trace_end(20, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(20, t0);
+		capture_u32((GLuint) unit);
+		capture_u32((GLuint) sampler);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BindSamplers(GLuint first, GLsizei count, const GLuint *samplers)
+{
+	double t0 = now();
+
+	real.gl.BindSamplers(first, count, samplers);
+	trace_end(21, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(21, t0);
+		capture_u32((GLuint) first);
+		capture_u32((GLuint) count);
+		capture_data(samplers, count * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BindTexture(GLenum target, GLuint texture)
+{
+	double t0 = now();
+
+	real.gl.BindTexture(target, texture);
+	trace_end(22, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(22, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) texture);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BindTextureUnit(GLuint unit, GLuint texture)
+{
+	double t0 = now();
+
+	real.gl.BindTextureUnit(unit, texture);
+	trace_end(23, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(23, t0);
+		capture_u32((GLuint) unit);
+		capture_u32((GLuint) texture);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BindTextures(GLuint first, GLsizei count, const GLuint *textures)
+{
+	double t0 = now();
+
+	real.gl.BindTextures(first, count, textures);
+	trace_end(24, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(24, t0);
+		capture_u32((GLuint) first);
+		capture_u32((GLuint) count);
+		capture_data(textures, count * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BindTransformFeedback(GLenum target, GLuint id)
+{
+	double t0 = now();
+
+	real.gl.BindTransformFeedback(target, id);
+	trace_end(25, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(25, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) id);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BindVertexArray(GLuint array)
+{
+	double t0 = now();
+
+	real.gl.BindVertexArray(array);
+	trace_end(26, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(26, t0);
+		capture_u32((GLuint) array);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+	double t0 = now();
+
+	real.gl.BindVertexBuffer(bindingindex, buffer, offset, stride);
+	trace_end(27, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(27, t0);
+		capture_u32((GLuint) bindingindex);
+		capture_u32((GLuint) buffer);
+		capture_u64((GLuint64) offset);
+		capture_u32((GLuint) stride);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides)
+{
+	double t0 = now();
+
+	real.gl.BindVertexBuffers(first, count, buffers, offsets, strides);
+	trace_end(28, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(28, t0);
+		capture_u32((GLuint) first);
+		capture_u32((GLuint) count);
+		capture_data(buffers, count * 4);
+		capture_data(offsets, count * 8);
+		capture_data(strides, count * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+	double t0 = now();
+
+	real.gl.BlendColor(red, green, blue, alpha);
+	trace_end(29, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(29, t0);
+		capture_f32(red);
+		capture_f32(green);
+		capture_f32(blue);
+		capture_f32(alpha);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BlendEquation(GLenum mode)
+{
+	double t0 = now();
+
+	real.gl.BlendEquation(mode);
+	trace_end(30, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(30, t0);
+		capture_u32((GLuint) mode);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
+{
+	double t0 = now();
+
+	real.gl.BlendEquationSeparate(modeRGB, modeAlpha);
+	trace_end(31, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(31, t0);
+		capture_u32((GLuint) modeRGB);
+		capture_u32((GLuint) modeAlpha);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+	double t0 = now();
+
+	real.gl.BlendEquationSeparatei(buf, modeRGB, modeAlpha);
+	trace_end(32, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(32, t0);
+		capture_u32((GLuint) buf);
+		capture_u32((GLuint) modeRGB);
+		capture_u32((GLuint) modeAlpha);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BlendEquationSeparateiARB(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+	double t0 = now();
+
+	real.gl.BlendEquationSeparateiARB(buf, modeRGB, modeAlpha);
+	trace_end(33, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(33, t0);
+		capture_u32((GLuint) buf);
+		capture_u32((GLuint) modeRGB);
+		capture_u32((GLuint) modeAlpha);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BlendEquationi(GLuint buf, GLenum mode)
+{
+	double t0 = now();
+
+	real.gl.BlendEquationi(buf, mode);
+	trace_end(34, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(34, t0);
+		capture_u32((GLuint) buf);
+		capture_u32((GLuint) mode);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BlendEquationiARB(GLuint buf, GLenum mode)
+{
+	double t0 = now();
+
+	real.gl.BlendEquationiARB(buf, mode);
+	trace_end(35, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(35, t0);
+		capture_u32((GLuint) buf);
+		capture_u32((GLuint) mode);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BlendFunc(GLenum sfactor, GLenum dfactor)
+{
+	double t0 = now();
+
+	real.gl.BlendFunc(sfactor, dfactor);
+	trace_end(36, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(36, t0);
+		capture_u32((GLuint) sfactor);
+		capture_u32((GLuint) dfactor);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+	double t0 = now();
+
+	real.gl.BlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+	trace_end(37, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(37, t0);
+		capture_u32((GLuint) sfactorRGB);
+		capture_u32((GLuint) dfactorRGB);
+		capture_u32((GLuint) sfactorAlpha);
+		capture_u32((GLuint) dfactorAlpha);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+	double t0 = now();
+
+	real.gl.BlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+	trace_end(38, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(38, t0);
+		capture_u32((GLuint) buf);
+		capture_u32((GLuint) srcRGB);
+		capture_u32((GLuint) dstRGB);
+		capture_u32((GLuint) srcAlpha);
+		capture_u32((GLuint) dstAlpha);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BlendFuncSeparateiARB(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+	double t0 = now();
+
+	real.gl.BlendFuncSeparateiARB(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+	trace_end(39, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(39, t0);
+		capture_u32((GLuint) buf);
+		capture_u32((GLuint) srcRGB);
+		capture_u32((GLuint) dstRGB);
+		capture_u32((GLuint) srcAlpha);
+		capture_u32((GLuint) dstAlpha);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BlendFunci(GLuint buf, GLenum src, GLenum dst)
+{
+	double t0 = now();
+
+	real.gl.BlendFunci(buf, src, dst);
+	trace_end(40, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(40, t0);
+		capture_u32((GLuint) buf);
+		capture_u32((GLuint) src);
+		capture_u32((GLuint) dst);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BlendFunciARB(GLuint buf, GLenum src, GLenum dst)
+{
+	double t0 = now();
+
+	real.gl.BlendFunciARB(buf, src, dst);
+	trace_end(41, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(41, t0);
+		capture_u32((GLuint) buf);
+		capture_u32((GLuint) src);
+		capture_u32((GLuint) dst);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+	double t0 = now();
+
+	real.gl.BlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	trace_end(42, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(42, t0);
+		capture_u32((GLuint) srcX0);
+		capture_u32((GLuint) srcY0);
+		capture_u32((GLuint) srcX1);
+		capture_u32((GLuint) srcY1);
+		capture_u32((GLuint) dstX0);
+		capture_u32((GLuint) dstY0);
+		capture_u32((GLuint) dstX1);
+		capture_u32((GLuint) dstY1);
+		capture_u32((GLuint) mask);
+		capture_u32((GLuint) filter);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+	double t0 = now();
+
+	real.gl.BlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	trace_end(43, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(43, t0);
+		capture_u32((GLuint) readFramebuffer);
+		capture_u32((GLuint) drawFramebuffer);
+		capture_u32((GLuint) srcX0);
+		capture_u32((GLuint) srcY0);
+		capture_u32((GLuint) srcX1);
+		capture_u32((GLuint) srcY1);
+		capture_u32((GLuint) dstX0);
+		capture_u32((GLuint) dstY0);
+		capture_u32((GLuint) dstX1);
+		capture_u32((GLuint) dstY1);
+		capture_u32((GLuint) mask);
+		capture_u32((GLuint) filter);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+{
+	double t0 = now();
+
+	real.gl.BufferData(target, size, data, usage);
+	trace_end(44, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(44, t0);
+		capture_u32((GLuint) target);
+		capture_u64((GLuint64) size);
+		capture_data(data, size);
+		capture_u32((GLuint) usage);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BufferPageCommitmentARB(GLenum target, GLintptr offset, GLsizeiptr size, GLboolean commit)
+{
+	double t0 = now();
+
+	real.gl.BufferPageCommitmentARB(target, offset, size, commit);
+	trace_end(45, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(45, t0);
+		capture_u32((GLuint) target);
+		capture_u64((GLuint64) offset);
+		capture_u64((GLuint64) size);
+		capture_u32((GLuint) commit);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+	double t0 = now();
+
+	real.gl.BufferStorage(target, size, data, flags);
+	trace_end(46, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(46, t0);
+		capture_u32((GLuint) target);
+		capture_u64((GLuint64) size);
+		capture_data(data, size);
+		capture_u32((GLuint) flags);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+{
+	double t0 = now();
+
+	real.gl.BufferSubData(target, offset, size, data);
+	trace_end(47, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(47, t0);
+		capture_u32((GLuint) target);
+		capture_u64((GLuint64) offset);
+		capture_u64((GLuint64) size);
+		capture_data(data, size);
+		capture_end();
+	}
+}
+
+static GLenum APIENTRY trace_CheckFramebufferStatus(GLenum target)
+{
+	GLenum res;
+	double t0 = now();
+
+	res = real.gl.CheckFramebufferStatus(target);
+	trace_end(48, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(48, t0);
+		capture_u32((GLuint) target);
+		capture_end();
+	}
+	return res;
+}
+
+static GLenum APIENTRY trace_CheckNamedFramebufferStatus(GLuint framebuffer, GLenum target)
+{
+	GLenum res;
+	double t0 = now();
+
+	res = real.gl.CheckNamedFramebufferStatus(framebuffer, target);
+	trace_end(49, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(49, t0);
+		capture_u32((GLuint) framebuffer);
+		capture_u32((GLuint) target);
+		capture_end();
+	}
+	return res;
+}
+
+static void APIENTRY trace_ClampColor(GLenum target, GLenum clamp)
+{
+	double t0 = now();
+
+	real.gl.ClampColor(target, clamp);
+	trace_end(50, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(50, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) clamp);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Clear(GLbitfield mask)
+{
+	double t0 = now();
+
+	real.gl.Clear(mask);
+	trace_end(51, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(51, t0);
+		capture_u32((GLuint) mask);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data)
+{
+	double t0 = now();
+
+	real.gl.ClearBufferData(target, internalformat, format, type, data);
+	trace_end(52, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(52, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) type);
+		capture_data(data, capture_pixel_size(format, type));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data)
+{
+	double t0 = now();
+
+	real.gl.ClearBufferSubData(target, internalformat, offset, size, format, type, data);
+	trace_end(53, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(53, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) internalformat);
+		capture_u64((GLuint64) offset);
+		capture_u64((GLuint64) size);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) type);
+		capture_data(data, capture_pixel_size(format, type));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+{
+	double t0 = now();
+
+	real.gl.ClearBufferfi(buffer, drawbuffer, depth, stencil);
+	trace_end(54, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(54, t0);
+		capture_u32((GLuint) buffer);
+		capture_u32((GLuint) drawbuffer);
+		capture_f32(depth);
+		capture_u32((GLuint) stencil);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.ClearBufferfv(buffer, drawbuffer, value);
+	trace_end(55, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(55, t0);
+		capture_u32((GLuint) buffer);
+		capture_u32((GLuint) drawbuffer);
+		capture_data(value, buffer == GL_COLOR ? 16 : 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value)
+{
+	double t0 = now();
+
+	real.gl.ClearBufferiv(buffer, drawbuffer, value);
+	trace_end(56, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(56, t0);
+		capture_u32((GLuint) buffer);
+		capture_u32((GLuint) drawbuffer);
+		capture_data(value, buffer == GL_COLOR ? 16 : 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value)
+{
+	double t0 = now();
+
+	real.gl.ClearBufferuiv(buffer, drawbuffer, value);
+	trace_end(57, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(57, t0);
+		capture_u32((GLuint) buffer);
+		capture_u32((GLuint) drawbuffer);
+		capture_data(value, buffer == GL_COLOR ? 16 : 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+	double t0 = now();
+
+	real.gl.ClearColor(red, green, blue, alpha);
+	trace_end(58, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(58, t0);
+		capture_f32(red);
+		capture_f32(green);
+		capture_f32(blue);
+		capture_f32(alpha);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ClearDepth(GLdouble depth)
+{
+	double t0 = now();
+
+	real.gl.ClearDepth(depth);
+	trace_end(59, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(59, t0);
+		capture_f64(depth);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ClearDepthf(GLfloat d)
+{
+	double t0 = now();
+
+	real.gl.ClearDepthf(d);
+	trace_end(60, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(60, t0);
+		capture_f32(d);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data)
+{
+	double t0 = now();
+
+	real.gl.ClearNamedBufferData(buffer, internalformat, format, type, data);
+	trace_end(61, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(61, t0);
+		capture_u32((GLuint) buffer);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) type);
+		capture_data(data, capture_pixel_size(format, type));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data)
+{
+	double t0 = now();
+
+	real.gl.ClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+	trace_end(62, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(62, t0);
+		capture_u32((GLuint) buffer);
+		capture_u32((GLuint) internalformat);
+		capture_u64((GLuint64) offset);
+		capture_u64((GLuint64) size);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) type);
+		capture_data(data, capture_pixel_size(format, type));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, const GLfloat depth, GLint stencil)
+{
+	double t0 = now();
+
+	real.gl.ClearNamedFramebufferfi(framebuffer, buffer, depth, stencil);
+	trace_end(63, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(63, t0);
+		capture_u32((GLuint) framebuffer);
+		capture_u32((GLuint) buffer);
+		capture_f32(depth);
+		capture_u32((GLuint) stencil);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.ClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+	trace_end(64, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(64, t0);
+		capture_u32((GLuint) framebuffer);
+		capture_u32((GLuint) buffer);
+		capture_u32((GLuint) drawbuffer);
+		capture_data(value, buffer == GL_COLOR ? 16 : 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value)
+{
+	double t0 = now();
+
+	real.gl.ClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+	trace_end(65, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(65, t0);
+		capture_u32((GLuint) framebuffer);
+		capture_u32((GLuint) buffer);
+		capture_u32((GLuint) drawbuffer);
+		capture_data(value, buffer == GL_COLOR ? 16 : 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value)
+{
+	double t0 = now();
+
+	real.gl.ClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+	trace_end(66, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(66, t0);
+		capture_u32((GLuint) framebuffer);
+		capture_u32((GLuint) buffer);
+		capture_u32((GLuint) drawbuffer);
+		capture_data(value, buffer == GL_COLOR ? 16 : 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ClearStencil(GLint s)
+{
+	double t0 = now();
+
+	real.gl.ClearStencil(s);
+	trace_end(67, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(67, t0);
+		capture_u32((GLuint) s);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void *data)
+{
+	double t0 = now();
+
+	real.gl.ClearTexImage(texture, level, format, type, data);
+	trace_end(68, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(68, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) type);
+		capture_data(data, capture_pixel_size(format, type));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data)
+{
+	double t0 = now();
+
+	real.gl.ClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+	trace_end(69, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(69, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) xoffset);
+		capture_u32((GLuint) yoffset);
+		capture_u32((GLuint) zoffset);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) depth);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) type);
+		capture_data(data, capture_pixel_size(format, type));
+		capture_end();
+	}
+}
+
+static GLenum APIENTRY trace_ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+	GLenum res;
+	double t0 = now();
+
+	res = real.gl.ClientWaitSync(sync, flags, timeout);
+	trace_end(70, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(70, t0);
+		capture_u64((GLuint64) (size_t) sync);
+		capture_u32((GLuint) flags);
+		capture_u64((GLuint64) timeout);
+		capture_end();
+	}
+	return res;
+}
+
+static void APIENTRY trace_ClipControl(GLenum origin, GLenum depth)
+{
+	double t0 = now();
+
+	real.gl.ClipControl(origin, depth);
+	trace_end(71, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(71, t0);
+		capture_u32((GLuint) origin);
+		capture_u32((GLuint) depth);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+	double t0 = now();
+
+	real.gl.ColorMask(red, green, blue, alpha);
+	trace_end(72, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(72, t0);
+		capture_u32((GLuint) red);
+		capture_u32((GLuint) green);
+		capture_u32((GLuint) blue);
+		capture_u32((GLuint) alpha);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+{
+	double t0 = now();
+
+	real.gl.ColorMaski(index, r, g, b, a);
+	trace_end(73, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(73, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) r);
+		capture_u32((GLuint) g);
+		capture_u32((GLuint) b);
+		capture_u32((GLuint) a);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CompileShader(GLuint shader)
+{
+	double t0 = now();
+
+	real.gl.CompileShader(shader);
+	trace_end(74, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(74, t0);
+		capture_u32((GLuint) shader);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CompileShaderIncludeARB(GLuint shader, GLsizei count, const GLchar *const*path, const GLint *length)
+{
+	double t0 = now();
+
+	real.gl.CompileShaderIncludeARB(shader, count, path, length);
+	trace_end(75, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_unsupported(75, t0);
+	}
+}
+
+static void APIENTRY trace_CompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data)
+{
+	double t0 = now();
+
+	real.gl.CompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+	trace_end(76, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(76, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) border);
+		capture_u32((GLuint) imageSize);
+		capture_pixels(data, imageSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+{
+	double t0 = now();
+
+	real.gl.CompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+	trace_end(77, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(77, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) border);
+		capture_u32((GLuint) imageSize);
+		capture_pixels(data, imageSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data)
+{
+	double t0 = now();
+
+	real.gl.CompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+	trace_end(78, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(78, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) depth);
+		capture_u32((GLuint) border);
+		capture_u32((GLuint) imageSize);
+		capture_pixels(data, imageSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+	double t0 = now();
+
+	real.gl.CompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+	trace_end(79, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(79, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) xoffset);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) imageSize);
+		capture_pixels(data, imageSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+	double t0 = now();
+
+	real.gl.CompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+	trace_end(80, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(80, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) xoffset);
+		capture_u32((GLuint) yoffset);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) imageSize);
+		capture_pixels(data, imageSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+	double t0 = now();
+
+	real.gl.CompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	trace_end(81, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(81, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) xoffset);
+		capture_u32((GLuint) yoffset);
+		capture_u32((GLuint) zoffset);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) depth);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) imageSize);
+		capture_pixels(data, imageSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+	double t0 = now();
+
+	real.gl.CompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+	trace_end(82, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(82, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) xoffset);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) imageSize);
+		capture_pixels(data, imageSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+	double t0 = now();
+
+	real.gl.CompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+	trace_end(83, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(83, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) xoffset);
+		capture_u32((GLuint) yoffset);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) imageSize);
+		capture_pixels(data, imageSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+	double t0 = now();
+
+	real.gl.CompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	trace_end(84, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(84, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) xoffset);
+		capture_u32((GLuint) yoffset);
+		capture_u32((GLuint) zoffset);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) depth);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) imageSize);
+		capture_pixels(data, imageSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+	double t0 = now();
+
+	real.gl.CopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+	trace_end(85, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(85, t0);
+		capture_u32((GLuint) readTarget);
+		capture_u32((GLuint) writeTarget);
+		capture_u64((GLuint64) readOffset);
+		capture_u64((GLuint64) writeOffset);
+		capture_u64((GLuint64) size);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth)
+{
+	double t0 = now();
+
+	real.gl.CopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+	trace_end(86, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(86, t0);
+		capture_u32((GLuint) srcName);
+		capture_u32((GLuint) srcTarget);
+		capture_u32((GLuint) srcLevel);
+		capture_u32((GLuint) srcX);
+		capture_u32((GLuint) srcY);
+		capture_u32((GLuint) srcZ);
+		capture_u32((GLuint) dstName);
+		capture_u32((GLuint) dstTarget);
+		capture_u32((GLuint) dstLevel);
+		capture_u32((GLuint) dstX);
+		capture_u32((GLuint) dstY);
+		capture_u32((GLuint) dstZ);
+		capture_u32((GLuint) srcWidth);
+		capture_u32((GLuint) srcHeight);
+		capture_u32((GLuint) srcDepth);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+	double t0 = now();
+
+	real.gl.CopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+	trace_end(87, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(87, t0);
+		capture_u32((GLuint) readBuffer);
+		capture_u32((GLuint) writeBuffer);
+		capture_u64((GLuint64) readOffset);
+		capture_u64((GLuint64) writeOffset);
+		capture_u64((GLuint64) size);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+	double t0 = now();
+
+	real.gl.CopyTexImage1D(target, level, internalformat, x, y, width, border);
+	trace_end(88, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(88, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) border);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+	double t0 = now();
+
+	real.gl.CopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+	trace_end(89, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(89, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) border);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+	double t0 = now();
+
+	real.gl.CopyTexSubImage1D(target, level, xoffset, x, y, width);
+	trace_end(90, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(90, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) xoffset);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_u32((GLuint) width);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	double t0 = now();
+
+	real.gl.CopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+	trace_end(91, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(91, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) xoffset);
+		capture_u32((GLuint) yoffset);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	double t0 = now();
+
+	real.gl.CopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+	trace_end(92, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(92, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) xoffset);
+		capture_u32((GLuint) yoffset);
+		capture_u32((GLuint) zoffset);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+	double t0 = now();
+
+	real.gl.CopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+	trace_end(93, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(93, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) xoffset);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_u32((GLuint) width);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	double t0 = now();
+
+	real.gl.CopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+	trace_end(94, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(94, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) xoffset);
+		capture_u32((GLuint) yoffset);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	double t0 = now();
+
+	real.gl.CopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+	trace_end(95, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(95, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) xoffset);
+		capture_u32((GLuint) yoffset);
+		capture_u32((GLuint) zoffset);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CreateBuffers(GLsizei n, GLuint *buffers)
+{
+	double t0 = now();
+
+	real.gl.CreateBuffers(n, buffers);
+	trace_end(96, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(96, t0);
+		capture_u32((GLuint) n);
+		capture_data(buffers, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CreateFramebuffers(GLsizei n, GLuint *framebuffers)
+{
+	double t0 = now();
+
+	real.gl.CreateFramebuffers(n, framebuffers);
+	trace_end(97, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(97, t0);
+		capture_u32((GLuint) n);
+		capture_data(framebuffers, n * 4);
+		capture_end();
+	}
+}
+
+static GLuint APIENTRY trace_CreateProgram(void)
+{
+	GLuint res;
+	double t0 = now();
+
+	res = real.gl.CreateProgram();
+	trace_end(98, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(98, t0);
+		capture_u32((GLuint) res);
+		capture_end();
+	}
+	return res;
+}
+
+static void APIENTRY trace_CreateProgramPipelines(GLsizei n, GLuint *pipelines)
+{
+	double t0 = now();
+
+	real.gl.CreateProgramPipelines(n, pipelines);
+	trace_end(99, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(99, t0);
+		capture_u32((GLuint) n);
+		capture_data(pipelines, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CreateQueries(GLenum target, GLsizei n, GLuint *ids)
+{
+	double t0 = now();
+
+	real.gl.CreateQueries(target, n, ids);
+	trace_end(100, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(100, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) n);
+		capture_data(ids, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CreateRenderbuffers(GLsizei n, GLuint *renderbuffers)
+{
+	double t0 = now();
+
+	real.gl.CreateRenderbuffers(n, renderbuffers);
+	trace_end(101, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(101, t0);
+		capture_u32((GLuint) n);
+		capture_data(renderbuffers, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CreateSamplers(GLsizei n, GLuint *samplers)
+{
+	double t0 = now();
+
+	real.gl.CreateSamplers(n, samplers);
+	trace_end(102, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(102, t0);
+		capture_u32((GLuint) n);
+		capture_data(samplers, n * 4);
+		capture_end();
+	}
+}
+
+static GLuint APIENTRY trace_CreateShader(GLenum type)
+{
+	GLuint res;
+	double t0 = now();
+
+	res = real.gl.CreateShader(type);
+	trace_end(103, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(103, t0);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) res);
+		capture_end();
+	}
+	return res;
+}
+
+static GLuint APIENTRY trace_CreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings)
+{
+	GLuint res;
+	double t0 = now();
+
+	res = real.gl.CreateShaderProgramv(type, count, strings);
+	trace_end(104, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(104, t0);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) count);
+		capture_strings(count, strings, NULL);
+		capture_u32((GLuint) res);
+		capture_end();
+	}
+	return res;
+}
+
+static GLsync APIENTRY trace_CreateSyncFromCLeventARB(struct _cl_context *context, struct _cl_event *event, GLbitfield flags)
+{
+	GLsync res;
+	double t0 = now();
+
+	res = real.gl.CreateSyncFromCLeventARB(context, event, flags);
+	trace_end(105, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_unsupported(105, t0);
+	}
+	return res;
+}
+
+static void APIENTRY trace_CreateTextures(GLenum target, GLsizei n, GLuint *textures)
+{
+	double t0 = now();
+
+	real.gl.CreateTextures(target, n, textures);
+	trace_end(106, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(106, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) n);
+		capture_data(textures, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CreateTransformFeedbacks(GLsizei n, GLuint *ids)
+{
+	double t0 = now();
+
+	real.gl.CreateTransformFeedbacks(n, ids);
+	trace_end(107, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(107, t0);
+		capture_u32((GLuint) n);
+		capture_data(ids, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CreateVertexArrays(GLsizei n, GLuint *arrays)
+{
+	double t0 = now();
+
+	real.gl.CreateVertexArrays(n, arrays);
+	trace_end(108, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(108, t0);
+		capture_u32((GLuint) n);
+		capture_data(arrays, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_CullFace(GLenum mode)
+{
+	double t0 = now();
+
+	real.gl.CullFace(mode);
+	trace_end(109, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(109, t0);
+		capture_u32((GLuint) mode);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DebugMessageCallback(GLDEBUGPROC callback, const void *userParam)
+{
+	double t0 = now();
+
+	real.gl.DebugMessageCallback(callback, userParam);
+	trace_end(110, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_unsupported(110, t0);
+	}
+}
+
+static void APIENTRY trace_DebugMessageCallbackARB(GLDEBUGPROCARB callback, const void *userParam)
+{
+	double t0 = now();
+
+	real.gl.DebugMessageCallbackARB(callback, userParam);
+	trace_end(111, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_unsupported(111, t0);
+	}
+}
+
+static void APIENTRY trace_DebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled)
+{
+	double t0 = now();
+
+	real.gl.DebugMessageControl(source, type, severity, count, ids, enabled);
+	trace_end(112, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(112, t0);
+		capture_u32((GLuint) source);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) severity);
+		capture_u32((GLuint) count);
+		capture_data(ids, count * 4);
+		capture_u32((GLuint) enabled);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DebugMessageControlARB(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled)
+{
+	double t0 = now();
+
+	real.gl.DebugMessageControlARB(source, type, severity, count, ids, enabled);
+	trace_end(113, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(113, t0);
+		capture_u32((GLuint) source);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) severity);
+		capture_u32((GLuint) count);
+		capture_data(ids, count * 4);
+		capture_u32((GLuint) enabled);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf)
+{
+	double t0 = now();
+
+	real.gl.DebugMessageInsert(source, type, id, severity, length, buf);
+	trace_end(114, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(114, t0);
+		capture_u32((GLuint) source);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) id);
+		capture_u32((GLuint) severity);
+		capture_u32((GLuint) length);
+		capture_string(buf, length);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DebugMessageInsertARB(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf)
+{
+	double t0 = now();
+
+	real.gl.DebugMessageInsertARB(source, type, id, severity, length, buf);
+	trace_end(115, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(115, t0);
+		capture_u32((GLuint) source);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) id);
+		capture_u32((GLuint) severity);
+		capture_u32((GLuint) length);
+		capture_string(buf, length);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DeleteBuffers(GLsizei n, const GLuint *buffers)
+{
+	double t0 = now();
+
+	real.gl.DeleteBuffers(n, buffers);
+	trace_end(116, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(116, t0);
+		capture_u32((GLuint) n);
+		capture_data(buffers, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
+{
+	double t0 = now();
+
+	real.gl.DeleteFramebuffers(n, framebuffers);
+	trace_end(117, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(117, t0);
+		capture_u32((GLuint) n);
+		capture_data(framebuffers, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DeleteNamedStringARB(GLint namelen, const GLchar *name)
+{
+	double t0 = now();
+
+	real.gl.DeleteNamedStringARB(namelen, name);
+	trace_end(118, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_unsupported(118, t0);
+	}
+}
+
+static void APIENTRY trace_DeleteProgram(GLuint program)
+{
+	double t0 = now();
+
+	real.gl.DeleteProgram(program);
+	trace_end(119, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(119, t0);
+		capture_u32((GLuint) program);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DeleteProgramPipelines(GLsizei n, const GLuint *pipelines)
+{
+	double t0 = now();
+
+	real.gl.DeleteProgramPipelines(n, pipelines);
+	trace_end(120, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(120, t0);
+		capture_u32((GLuint) n);
+		capture_data(pipelines, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DeleteQueries(GLsizei n, const GLuint *ids)
+{
+	double t0 = now();
+
+	real.gl.DeleteQueries(n, ids);
+	trace_end(121, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(121, t0);
+		capture_u32((GLuint) n);
+		capture_data(ids, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
+{
+	double t0 = now();
+
+	real.gl.DeleteRenderbuffers(n, renderbuffers);
+	trace_end(122, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(122, t0);
+		capture_u32((GLuint) n);
+		capture_data(renderbuffers, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DeleteSamplers(GLsizei count, const GLuint *samplers)
+{
+	double t0 = now();
+
+	real.gl.DeleteSamplers(count, samplers);
+	trace_end(123, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(123, t0);
+		capture_u32((GLuint) count);
+		capture_data(samplers, count * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DeleteShader(GLuint shader)
+{
+	double t0 = now();
+
+	real.gl.DeleteShader(shader);
+	trace_end(124, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(124, t0);
+		capture_u32((GLuint) shader);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DeleteSync(GLsync sync)
+{
+	double t0 = now();
+
+	real.gl.DeleteSync(sync);
+	trace_end(125, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(125, t0);
+		capture_u64((GLuint64) (size_t) sync);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DeleteTextures(GLsizei n, const GLuint *textures)
+{
+	double t0 = now();
+
+	real.gl.DeleteTextures(n, textures);
+	trace_end(126, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(126, t0);
+		capture_u32((GLuint) n);
+		capture_data(textures, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DeleteTransformFeedbacks(GLsizei n, const GLuint *ids)
+{
+	double t0 = now();
+
+	real.gl.DeleteTransformFeedbacks(n, ids);
+	trace_end(127, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(127, t0);
+		capture_u32((GLuint) n);
+		capture_data(ids, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DeleteVertexArrays(GLsizei n, const GLuint *arrays)
+{
+	double t0 = now();
+
+	real.gl.DeleteVertexArrays(n, arrays);
+	trace_end(128, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(128, t0);
+		capture_u32((GLuint) n);
+		capture_data(arrays, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DepthFunc(GLenum func)
+{
+	double t0 = now();
+
+	real.gl.DepthFunc(func);
+	trace_end(129, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(129, t0);
+		capture_u32((GLuint) func);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DepthMask(GLboolean flag)
+{
+	double t0 = now();
+
+	real.gl.DepthMask(flag);
+	trace_end(130, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(130, t0);
+		capture_u32((GLuint) flag);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DepthRange(GLdouble near, GLdouble far)
+{
+	double t0 = now();
+
+	real.gl.DepthRange(near, far);
+	trace_end(131, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(131, t0);
+		capture_f64(near);
+		capture_f64(far);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v)
+{
+	double t0 = now();
+
+	real.gl.DepthRangeArrayv(first, count, v);
+	trace_end(132, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(132, t0);
+		capture_u32((GLuint) first);
+		capture_u32((GLuint) count);
+		capture_data(v, count * 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DepthRangeIndexed(GLuint index, GLdouble n, GLdouble f)
+{
+	double t0 = now();
+
+	real.gl.DepthRangeIndexed(index, n, f);
+	trace_end(133, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(133, t0);
+		capture_u32((GLuint) index);
+		capture_f64(n);
+		capture_f64(f);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DepthRangef(GLfloat n, GLfloat f)
+{
+	double t0 = now();
+
+	real.gl.DepthRangef(n, f);
+	trace_end(134, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(134, t0);
+		capture_f32(n);
+		capture_f32(f);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DetachShader(GLuint program, GLuint shader)
+{
+	double t0 = now();
+
+	real.gl.DetachShader(program, shader);
+	trace_end(135, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(135, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) shader);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Disable(GLenum cap)
+{
+	double t0 = now();
+
+	real.gl.Disable(cap);
+	trace_end(136, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(136, t0);
+		capture_u32((GLuint) cap);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DisableVertexArrayAttrib(GLuint vaobj, GLuint index)
+{
+	double t0 = now();
+
+	real.gl.DisableVertexArrayAttrib(vaobj, index);
+	trace_end(137, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(137, t0);
+		capture_u32((GLuint) vaobj);
+		capture_u32((GLuint) index);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DisableVertexAttribArray(GLuint index)
+{
+	double t0 = now();
+
+	real.gl.DisableVertexAttribArray(index);
+	trace_end(138, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(138, t0);
+		capture_u32((GLuint) index);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Disablei(GLenum target, GLuint index)
+{
+	double t0 = now();
+
+	real.gl.Disablei(target, index);
+	trace_end(139, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(139, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) index);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z)
+{
+	double t0 = now();
+
+	real.gl.DispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+	trace_end(140, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(140, t0);
+		capture_u32((GLuint) num_groups_x);
+		capture_u32((GLuint) num_groups_y);
+		capture_u32((GLuint) num_groups_z);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DispatchComputeGroupSizeARB(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z, GLuint group_size_x, GLuint group_size_y, GLuint group_size_z)
+{
+	double t0 = now();
+
+	real.gl.DispatchComputeGroupSizeARB(num_groups_x, num_groups_y, num_groups_z, group_size_x, group_size_y, group_size_z);
+	trace_end(141, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(141, t0);
+		capture_u32((GLuint) num_groups_x);
+		capture_u32((GLuint) num_groups_y);
+		capture_u32((GLuint) num_groups_z);
+		capture_u32((GLuint) group_size_x);
+		capture_u32((GLuint) group_size_y);
+		capture_u32((GLuint) group_size_z);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DispatchComputeIndirect(GLintptr indirect)
+{
+	double t0 = now();
+
+	real.gl.DispatchComputeIndirect(indirect);
+	trace_end(142, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(142, t0);
+		capture_u64((GLuint64) indirect);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+	double t0 = now();
+
+	real.gl.DrawArrays(mode, first, count);
+	trace_end(143, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(143, t0);
+		capture_u32((GLuint) mode);
+		capture_u32((GLuint) first);
+		capture_u32((GLuint) count);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DrawArraysIndirect(GLenum mode, const void *indirect)
+{
+	double t0 = now();
+
+	real.gl.DrawArraysIndirect(mode, indirect);
+	trace_end(144, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(144, t0);
+		capture_u32((GLuint) mode);
+		capture_u64((GLuint64) (size_t) indirect);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+{
+	double t0 = now();
+
+	real.gl.DrawArraysInstanced(mode, first, count, instancecount);
+	trace_end(145, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(145, t0);
+		capture_u32((GLuint) mode);
+		capture_u32((GLuint) first);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) instancecount);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)
+{
+	double t0 = now();
+
+	real.gl.DrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+	trace_end(146, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(146, t0);
+		capture_u32((GLuint) mode);
+		capture_u32((GLuint) first);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) instancecount);
+		capture_u32((GLuint) baseinstance);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DrawBuffer(GLenum buf)
+{
+	double t0 = now();
+
+	real.gl.DrawBuffer(buf);
+	trace_end(147, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(147, t0);
+		capture_u32((GLuint) buf);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DrawBuffers(GLsizei n, const GLenum *bufs)
+{
+	double t0 = now();
+
+	real.gl.DrawBuffers(n, bufs);
+	trace_end(148, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(148, t0);
+		capture_u32((GLuint) n);
+		capture_data(bufs, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
+{
+	double t0 = now();
+
+	real.gl.DrawElements(mode, count, type, indices);
+	trace_end(149, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(149, t0);
+		capture_u32((GLuint) mode);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) type);
+		capture_u64((GLuint64) (size_t) indices);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+	double t0 = now();
+
+	real.gl.DrawElementsBaseVertex(mode, count, type, indices, basevertex);
+	trace_end(150, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(150, t0);
+		capture_u32((GLuint) mode);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) type);
+		capture_u64((GLuint64) (size_t) indices);
+		capture_u32((GLuint) basevertex);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DrawElementsIndirect(GLenum mode, GLenum type, const void *indirect)
+{
+	double t0 = now();
+
+	real.gl.DrawElementsIndirect(mode, type, indirect);
+	trace_end(151, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(151, t0);
+		capture_u32((GLuint) mode);
+		capture_u32((GLuint) type);
+		capture_u64((GLuint64) (size_t) indirect);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount)
+{
+	double t0 = now();
+
+	real.gl.DrawElementsInstanced(mode, count, type, indices, instancecount);
+	trace_end(152, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(152, t0);
+		capture_u32((GLuint) mode);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) type);
+		capture_u64((GLuint64) (size_t) indices);
+		capture_u32((GLuint) instancecount);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance)
+{
+	double t0 = now();
+
+	real.gl.DrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+	trace_end(153, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(153, t0);
+		capture_u32((GLuint) mode);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) type);
+		capture_u64((GLuint64) (size_t) indices);
+		capture_u32((GLuint) instancecount);
+		capture_u32((GLuint) baseinstance);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex)
+{
+	double t0 = now();
+
+	real.gl.DrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+	trace_end(154, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(154, t0);
+		capture_u32((GLuint) mode);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) type);
+		capture_u64((GLuint64) (size_t) indices);
+		capture_u32((GLuint) instancecount);
+		capture_u32((GLuint) basevertex);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance)
+{
+	double t0 = now();
+
+	real.gl.DrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+	trace_end(155, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(155, t0);
+		capture_u32((GLuint) mode);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) type);
+		capture_u64((GLuint64) (size_t) indices);
+		capture_u32((GLuint) instancecount);
+		capture_u32((GLuint) basevertex);
+		capture_u32((GLuint) baseinstance);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices)
+{
+	double t0 = now();
+
+	real.gl.DrawRangeElements(mode, start, end, count, type, indices);
+	trace_end(156, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(156, t0);
+		capture_u32((GLuint) mode);
+		capture_u32((GLuint) start);
+		capture_u32((GLuint) end);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) type);
+		capture_u64((GLuint64) (size_t) indices);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+	double t0 = now();
+
+	real.gl.DrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+	trace_end(157, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(157, t0);
+		capture_u32((GLuint) mode);
+		capture_u32((GLuint) start);
+		capture_u32((GLuint) end);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) type);
+		capture_u64((GLuint64) (size_t) indices);
+		capture_u32((GLuint) basevertex);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DrawTransformFeedback(GLenum mode, GLuint id)
+{
+	double t0 = now();
+
+	real.gl.DrawTransformFeedback(mode, id);
+	trace_end(158, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(158, t0);
+		capture_u32((GLuint) mode);
+		capture_u32((GLuint) id);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount)
+{
+	double t0 = now();
+
+	real.gl.DrawTransformFeedbackInstanced(mode, id, instancecount);
+	trace_end(159, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(159, t0);
+		capture_u32((GLuint) mode);
+		capture_u32((GLuint) id);
+		capture_u32((GLuint) instancecount);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream)
+{
+	double t0 = now();
+
+	real.gl.DrawTransformFeedbackStream(mode, id, stream);
+	trace_end(160, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(160, t0);
+		capture_u32((GLuint) mode);
+		capture_u32((GLuint) id);
+		capture_u32((GLuint) stream);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_DrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount)
+{
+	double t0 = now();
+
+	real.gl.DrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+	trace_end(161, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(161, t0);
+		capture_u32((GLuint) mode);
+		capture_u32((GLuint) id);
+		capture_u32((GLuint) stream);
+		capture_u32((GLuint) instancecount);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Enable(GLenum cap)
+{
+	double t0 = now();
+
+	real.gl.Enable(cap);
+	trace_end(162, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(162, t0);
+		capture_u32((GLuint) cap);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_EnableVertexArrayAttrib(GLuint vaobj, GLuint index)
+{
+	double t0 = now();
+
+	real.gl.EnableVertexArrayAttrib(vaobj, index);
+	trace_end(163, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(163, t0);
+		capture_u32((GLuint) vaobj);
+		capture_u32((GLuint) index);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_EnableVertexAttribArray(GLuint index)
+{
+	double t0 = now();
+
+	real.gl.EnableVertexAttribArray(index);
+	trace_end(164, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(164, t0);
+		capture_u32((GLuint) index);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Enablei(GLenum target, GLuint index)
+{
+	double t0 = now();
+
+	real.gl.Enablei(target, index);
+	trace_end(165, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(165, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) index);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_EndConditionalRender(void)
+{
+	double t0 = now();
+
+	real.gl.EndConditionalRender();
+	trace_end(166, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(166, t0);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_EndQuery(GLenum target)
+{
+	double t0 = now();
+
+	real.gl.EndQuery(target);
+	trace_end(167, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(167, t0);
+		capture_u32((GLuint) target);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_EndQueryIndexed(GLenum target, GLuint index)
+{
+	double t0 = now();
+
+	real.gl.EndQueryIndexed(target, index);
+	trace_end(168, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(168, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) index);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_EndTransformFeedback(void)
+{
+	double t0 = now();
+
+	real.gl.EndTransformFeedback();
+	trace_end(169, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(169, t0);
+		capture_end();
+	}
+}
+
+static GLsync APIENTRY trace_FenceSync(GLenum condition, GLbitfield flags)
+{
+	GLsync res;
+	double t0 = now();
+
+	res = real.gl.FenceSync(condition, flags);
+	trace_end(170, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(170, t0);
+		capture_u32((GLuint) condition);
+		capture_u32((GLuint) flags);
+		capture_u64((GLuint64) (size_t) res);
+		capture_end();
+	}
+	return res;
+}
+
+static void APIENTRY trace_Finish(void)
+{
+	double t0 = now();
+
+	real.gl.Finish();
+	trace_end(171, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(171, t0);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Flush(void)
+{
+	double t0 = now();
+
+	real.gl.Flush();
+	trace_end(172, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(172, t0);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_FlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
+{
+	double t0 = now();
+
+	if (trace_mode & GL3W_TRACE_CAPTURE)
+		capture_unmap(0, target, offset, length);
+	real.gl.FlushMappedBufferRange(target, offset, length);
+	trace_end(173, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(173, t0);
+		capture_u32((GLuint) target);
+		capture_u64((GLuint64) offset);
+		capture_u64((GLuint64) length);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_FlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+	double t0 = now();
+
+	if (trace_mode & GL3W_TRACE_CAPTURE)
+		capture_unmap(1, buffer, offset, length);
+	real.gl.FlushMappedNamedBufferRange(buffer, offset, length);
+	trace_end(174, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(174, t0);
+		capture_u32((GLuint) buffer);
+		capture_u64((GLuint64) offset);
+		capture_u64((GLuint64) length);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_FramebufferParameteri(GLenum target, GLenum pname, GLint param)
+{
+	double t0 = now();
+
+	real.gl.FramebufferParameteri(target, pname, param);
+	trace_end(175, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(175, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) pname);
+		capture_u32((GLuint) param);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_FramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+	double t0 = now();
+
+	real.gl.FramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+	trace_end(176, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(176, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) attachment);
+		capture_u32((GLuint) renderbuffertarget);
+		capture_u32((GLuint) renderbuffer);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_FramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level)
+{
+	double t0 = now();
+
+	real.gl.FramebufferTexture(target, attachment, texture, level);
+	trace_end(177, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(177, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) attachment);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_FramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+	double t0 = now();
+
+	real.gl.FramebufferTexture1D(target, attachment, textarget, texture, level);
+	trace_end(178, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(178, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) attachment);
+		capture_u32((GLuint) textarget);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_FramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+	double t0 = now();
+
+	real.gl.FramebufferTexture2D(target, attachment, textarget, texture, level);
+	trace_end(179, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(179, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) attachment);
+		capture_u32((GLuint) textarget);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_FramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+{
+	double t0 = now();
+
+	real.gl.FramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+	trace_end(180, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(180, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) attachment);
+		capture_u32((GLuint) textarget);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) zoffset);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_FramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+	double t0 = now();
+
+	real.gl.FramebufferTextureLayer(target, attachment, texture, level, layer);
+	trace_end(181, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(181, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) attachment);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) layer);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_FrontFace(GLenum mode)
+{
+	double t0 = now();
+
+	real.gl.FrontFace(mode);
+	trace_end(182, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(182, t0);
+		capture_u32((GLuint) mode);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GenBuffers(GLsizei n, GLuint *buffers)
+{
+	double t0 = now();
+
+	real.gl.GenBuffers(n, buffers);
+	trace_end(183, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(183, t0);
+		capture_u32((GLuint) n);
+		capture_data(buffers, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GenFramebuffers(GLsizei n, GLuint *framebuffers)
+{
+	double t0 = now();
+
+	real.gl.GenFramebuffers(n, framebuffers);
+	trace_end(184, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(184, t0);
+		capture_u32((GLuint) n);
+		capture_data(framebuffers, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GenProgramPipelines(GLsizei n, GLuint *pipelines)
+{
+	double t0 = now();
+
+	real.gl.GenProgramPipelines(n, pipelines);
+	trace_end(185, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(185, t0);
+		capture_u32((GLuint) n);
+		capture_data(pipelines, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GenQueries(GLsizei n, GLuint *ids)
+{
+	double t0 = now();
+
+	real.gl.GenQueries(n, ids);
+	trace_end(186, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(186, t0);
+		capture_u32((GLuint) n);
+		capture_data(ids, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GenRenderbuffers(GLsizei n, GLuint *renderbuffers)
+{
+	double t0 = now();
+
+	real.gl.GenRenderbuffers(n, renderbuffers);
+	trace_end(187, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(187, t0);
+		capture_u32((GLuint) n);
+		capture_data(renderbuffers, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GenSamplers(GLsizei count, GLuint *samplers)
+{
+	double t0 = now();
+
+	real.gl.GenSamplers(count, samplers);
+	trace_end(188, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(188, t0);
+		capture_u32((GLuint) count);
+		capture_data(samplers, count * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GenTextures(GLsizei n, GLuint *textures)
+{
+	double t0 = now();
+
+	real.gl.GenTextures(n, textures);
+	trace_end(189, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(189, t0);
+		capture_u32((GLuint) n);
+		capture_data(textures, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GenTransformFeedbacks(GLsizei n, GLuint *ids)
+{
+	double t0 = now();
+
+	real.gl.GenTransformFeedbacks(n, ids);
+	trace_end(190, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(190, t0);
+		capture_u32((GLuint) n);
+		capture_data(ids, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GenVertexArrays(GLsizei n, GLuint *arrays)
+{
+	double t0 = now();
+
+	real.gl.GenVertexArrays(n, arrays);
+	trace_end(191, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(191, t0);
+		capture_u32((GLuint) n);
+		capture_data(arrays, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GenerateMipmap(GLenum target)
+{
+	double t0 = now();
+
+	real.gl.GenerateMipmap(target);
+	trace_end(192, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(192, t0);
+		capture_u32((GLuint) target);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GenerateTextureMipmap(GLuint texture)
+{
+	double t0 = now();
+
+	real.gl.GenerateTextureMipmap(texture);
+	trace_end(193, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(193, t0);
+		capture_u32((GLuint) texture);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+	trace_end(194, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(194, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) bufferIndex);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+	double t0 = now();
+
+	real.gl.GetActiveAttrib(program, index, bufSize, length, size, type, name);
+	trace_end(195, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(195, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name)
+{
+	double t0 = now();
+
+	real.gl.GetActiveSubroutineName(program, shadertype, index, bufsize, length, name);
+	trace_end(196, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(196, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) shadertype);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) bufsize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name)
+{
+	double t0 = now();
+
+	real.gl.GetActiveSubroutineUniformName(program, shadertype, index, bufsize, length, name);
+	trace_end(197, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(197, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) shadertype);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) bufsize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values)
+{
+	double t0 = now();
+
+	real.gl.GetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+	trace_end(198, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(198, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) shadertype);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+	double t0 = now();
+
+	real.gl.GetActiveUniform(program, index, bufSize, length, size, type, name);
+	trace_end(199, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(199, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName)
+{
+	double t0 = now();
+
+	real.gl.GetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+	trace_end(200, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(200, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) uniformBlockIndex);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+	trace_end(201, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(201, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) uniformBlockIndex);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName)
+{
+	double t0 = now();
+
+	real.gl.GetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+	trace_end(202, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(202, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) uniformIndex);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+	trace_end(203, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(203, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) uniformCount);
+		capture_data(uniformIndices, uniformCount * 4);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders)
+{
+	double t0 = now();
+
+	real.gl.GetAttachedShaders(program, maxCount, count, shaders);
+	trace_end(204, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(204, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) maxCount);
+		capture_end();
+	}
+}
+
+static GLint APIENTRY trace_GetAttribLocation(GLuint program, const GLchar *name)
+{
+	GLint res;
+	double t0 = now();
+
+	res = real.gl.GetAttribLocation(program, name);
+	trace_end(205, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(205, t0);
+		capture_u32((GLuint) program);
+		capture_string(name, -1);
+		capture_end();
+	}
+	return res;
+}
+
+static void APIENTRY trace_GetBooleani_v(GLenum target, GLuint index, GLboolean *data)
+{
+	double t0 = now();
+
+	real.gl.GetBooleani_v(target, index, data);
+	trace_end(206, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(206, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) index);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetBooleanv(GLenum pname, GLboolean *data)
+{
+	double t0 = now();
+
+	real.gl.GetBooleanv(pname, data);
+	trace_end(207, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(207, t0);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params)
+{
+	double t0 = now();
+
+	real.gl.GetBufferParameteri64v(target, pname, params);
+	trace_end(208, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(208, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetBufferParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetBufferParameteriv(target, pname, params);
+	trace_end(209, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(209, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetBufferPointerv(GLenum target, GLenum pname, void **params)
+{
+	double t0 = now();
+
+	real.gl.GetBufferPointerv(target, pname, params);
+	trace_end(210, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(210, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data)
+{
+	double t0 = now();
+
+	real.gl.GetBufferSubData(target, offset, size, data);
+	trace_end(211, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(211, t0);
+		capture_u32((GLuint) target);
+		capture_u64((GLuint64) offset);
+		capture_u64((GLuint64) size);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetCompressedTexImage(GLenum target, GLint level, void *img)
+{
+	double t0 = now();
+
+	real.gl.GetCompressedTexImage(target, level, img);
+	trace_end(212, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_unsupported(212, t0);
+	}
+}
+
+static void APIENTRY trace_GetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, void *pixels)
+{
+	double t0 = now();
+
+	real.gl.GetCompressedTextureImage(texture, level, bufSize, pixels);
+	trace_end(213, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(213, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels)
+{
+	double t0 = now();
+
+	real.gl.GetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+	trace_end(214, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(214, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) xoffset);
+		capture_u32((GLuint) yoffset);
+		capture_u32((GLuint) zoffset);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) depth);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static GLuint APIENTRY trace_GetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog)
+{
+	GLuint res;
+	double t0 = now();
+
+	res = real.gl.GetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+	trace_end(215, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(215, t0);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+	return res;
+}
+
+static GLuint APIENTRY trace_GetDebugMessageLogARB(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog)
+{
+	GLuint res;
+	double t0 = now();
+
+	res = real.gl.GetDebugMessageLogARB(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+	trace_end(216, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(216, t0);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+	return res;
+}
+
+static void APIENTRY trace_GetDoublei_v(GLenum target, GLuint index, GLdouble *data)
+{
+	double t0 = now();
+
+	real.gl.GetDoublei_v(target, index, data);
+	trace_end(217, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(217, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) index);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetDoublev(GLenum pname, GLdouble *data)
+{
+	double t0 = now();
+
+	real.gl.GetDoublev(pname, data);
+	trace_end(218, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(218, t0);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static GLenum APIENTRY trace_GetError(void)
+{
+	GLenum res;
+	double t0 = now();
+
+	res = real.gl.GetError();
+	trace_end(219, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(219, t0);
+		capture_end();
+	}
+	return res;
+}
+
+static void APIENTRY trace_GetFloati_v(GLenum target, GLuint index, GLfloat *data)
+{
+	double t0 = now();
+
+	real.gl.GetFloati_v(target, index, data);
+	trace_end(220, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(220, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) index);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetFloatv(GLenum pname, GLfloat *data)
+{
+	double t0 = now();
+
+	real.gl.GetFloatv(pname, data);
+	trace_end(221, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(221, t0);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static GLint APIENTRY trace_GetFragDataIndex(GLuint program, const GLchar *name)
+{
+	GLint res;
+	double t0 = now();
+
+	res = real.gl.GetFragDataIndex(program, name);
+	trace_end(222, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(222, t0);
+		capture_u32((GLuint) program);
+		capture_string(name, -1);
+		capture_end();
+	}
+	return res;
+}
+
+static GLint APIENTRY trace_GetFragDataLocation(GLuint program, const GLchar *name)
+{
+	GLint res;
+	double t0 = now();
+
+	res = real.gl.GetFragDataLocation(program, name);
+	trace_end(223, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(223, t0);
+		capture_u32((GLuint) program);
+		capture_string(name, -1);
+		capture_end();
+	}
+	return res;
+}
+
+static void APIENTRY trace_GetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+	trace_end(224, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(224, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) attachment);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetFramebufferParameteriv(target, pname, params);
+	trace_end(225, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(225, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static GLenum APIENTRY trace_GetGraphicsResetStatus(void)
+{
+	GLenum res;
+	double t0 = now();
+
+	res = real.gl.GetGraphicsResetStatus();
+	trace_end(226, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(226, t0);
+		capture_end();
+	}
+	return res;
+}
+
+static GLenum APIENTRY trace_GetGraphicsResetStatusARB(void)
+{
+	GLenum res;
+	double t0 = now();
+
+	res = real.gl.GetGraphicsResetStatusARB();
+	trace_end(227, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(227, t0);
+		capture_end();
+	}
+	return res;
+}
+
+static GLuint64 APIENTRY trace_GetImageHandleARB(GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format)
+{
+	GLuint64 res;
+	double t0 = now();
+
+	res = real.gl.GetImageHandleARB(texture, level, layered, layer, format);
+	trace_end(228, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(228, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) layered);
+		capture_u32((GLuint) layer);
+		capture_u32((GLuint) format);
+		capture_end();
+	}
+	return res;
+}
+
+static void APIENTRY trace_GetInteger64i_v(GLenum target, GLuint index, GLint64 *data)
+{
+	double t0 = now();
+
+	real.gl.GetInteger64i_v(target, index, data);
+	trace_end(229, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(229, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) index);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetInteger64v(GLenum pname, GLint64 *data)
+{
+	double t0 = now();
+
+	real.gl.GetInteger64v(pname, data);
+	trace_end(230, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(230, t0);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetIntegeri_v(GLenum target, GLuint index, GLint *data)
+{
+	double t0 = now();
+
+	real.gl.GetIntegeri_v(target, index, data);
+	trace_end(231, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(231, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) index);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetIntegerv(GLenum pname, GLint *data)
+{
+	double t0 = now();
+
+	real.gl.GetIntegerv(pname, data);
+	trace_end(232, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(232, t0);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint64 *params)
+{
+	double t0 = now();
+
+	real.gl.GetInternalformati64v(target, internalformat, pname, bufSize, params);
+	trace_end(233, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(233, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) pname);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetInternalformativ(target, internalformat, pname, bufSize, params);
+	trace_end(234, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(234, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) pname);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetMultisamplefv(GLenum pname, GLuint index, GLfloat *val)
+{
+	double t0 = now();
+
+	real.gl.GetMultisamplefv(pname, index, val);
+	trace_end(235, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(235, t0);
+		capture_u32((GLuint) pname);
+		capture_u32((GLuint) index);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 *params)
+{
+	double t0 = now();
+
+	real.gl.GetNamedBufferParameteri64v(buffer, pname, params);
+	trace_end(236, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(236, t0);
+		capture_u32((GLuint) buffer);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetNamedBufferParameteriv(buffer, pname, params);
+	trace_end(237, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(237, t0);
+		capture_u32((GLuint) buffer);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetNamedBufferPointerv(GLuint buffer, GLenum pname, void **params)
+{
+	double t0 = now();
+
+	real.gl.GetNamedBufferPointerv(buffer, pname, params);
+	trace_end(238, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(238, t0);
+		capture_u32((GLuint) buffer);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data)
+{
+	double t0 = now();
+
+	real.gl.GetNamedBufferSubData(buffer, offset, size, data);
+	trace_end(239, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(239, t0);
+		capture_u32((GLuint) buffer);
+		capture_u64((GLuint64) offset);
+		capture_u64((GLuint64) size);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+	trace_end(240, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(240, t0);
+		capture_u32((GLuint) framebuffer);
+		capture_u32((GLuint) attachment);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint *param)
+{
+	double t0 = now();
+
+	real.gl.GetNamedFramebufferParameteriv(framebuffer, pname, param);
+	trace_end(241, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(241, t0);
+		capture_u32((GLuint) framebuffer);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetNamedRenderbufferParameteriv(renderbuffer, pname, params);
+	trace_end(242, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(242, t0);
+		capture_u32((GLuint) renderbuffer);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetNamedStringARB(GLint namelen, const GLchar *name, GLsizei bufSize, GLint *stringlen, GLchar *string)
+{
+	double t0 = now();
+
+	real.gl.GetNamedStringARB(namelen, name, bufSize, stringlen, string);
+	trace_end(243, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_unsupported(243, t0);
+	}
+}
+
+static void APIENTRY trace_GetNamedStringivARB(GLint namelen, const GLchar *name, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetNamedStringivARB(namelen, name, pname, params);
+	trace_end(244, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_unsupported(244, t0);
+	}
+}
+
+static void APIENTRY trace_GetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+	double t0 = now();
+
+	real.gl.GetObjectLabel(identifier, name, bufSize, length, label);
+	trace_end(245, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(245, t0);
+		capture_u32((GLuint) identifier);
+		capture_u32((GLuint) name);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+	double t0 = now();
+
+	real.gl.GetObjectPtrLabel(ptr, bufSize, length, label);
+	trace_end(246, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_unsupported(246, t0);
+	}
+}
+
+static void APIENTRY trace_GetPointerv(GLenum pname, void **params)
+{
+	double t0 = now();
+
+	real.gl.GetPointerv(pname, params);
+	trace_end(247, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(247, t0);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary)
+{
+	double t0 = now();
+
+	real.gl.GetProgramBinary(program, bufSize, length, binaryFormat, binary);
+	trace_end(248, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(248, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+	double t0 = now();
+
+	real.gl.GetProgramInfoLog(program, bufSize, length, infoLog);
+	trace_end(249, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(249, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetProgramInterfaceiv(program, programInterface, pname, params);
+	trace_end(250, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(250, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) programInterface);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+	double t0 = now();
+
+	real.gl.GetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+	trace_end(251, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(251, t0);
+		capture_u32((GLuint) pipeline);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetProgramPipelineiv(pipeline, pname, params);
+	trace_end(252, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(252, t0);
+		capture_u32((GLuint) pipeline);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static GLuint APIENTRY trace_GetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name)
+{
+	GLuint res;
+	double t0 = now();
+
+	res = real.gl.GetProgramResourceIndex(program, programInterface, name);
+	trace_end(253, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(253, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) programInterface);
+		capture_string(name, -1);
+		capture_end();
+	}
+	return res;
+}
+
+static GLint APIENTRY trace_GetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name)
+{
+	GLint res;
+	double t0 = now();
+
+	res = real.gl.GetProgramResourceLocation(program, programInterface, name);
+	trace_end(254, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(254, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) programInterface);
+		capture_string(name, -1);
+		capture_end();
+	}
+	return res;
+}
+
+static GLint APIENTRY trace_GetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar *name)
+{
+	GLint res;
+	double t0 = now();
+
+	res = real.gl.GetProgramResourceLocationIndex(program, programInterface, name);
+	trace_end(255, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(255, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) programInterface);
+		capture_string(name, -1);
+		capture_end();
+	}
+	return res;
+}
+
+static void APIENTRY trace_GetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name)
+{
+	double t0 = now();
+
+	real.gl.GetProgramResourceName(program, programInterface, index, bufSize, length, name);
+	trace_end(256, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(256, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) programInterface);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei bufSize, GLsizei *length, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetProgramResourceiv(program, programInterface, index, propCount, props, bufSize, length, params);
+	trace_end(257, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(257, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) programInterface);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) propCount);
+		capture_data(props, propCount * 4);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint *values)
+{
+	double t0 = now();
+
+	real.gl.GetProgramStageiv(program, shadertype, pname, values);
+	trace_end(258, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(258, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) shadertype);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetProgramiv(GLuint program, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetProgramiv(program, pname, params);
+	trace_end(259, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(259, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+	double t0 = now();
+
+	real.gl.GetQueryBufferObjecti64v(id, buffer, pname, offset);
+	trace_end(260, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(260, t0);
+		capture_u32((GLuint) id);
+		capture_u32((GLuint) buffer);
+		capture_u32((GLuint) pname);
+		capture_u64((GLuint64) offset);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+	double t0 = now();
+
+	real.gl.GetQueryBufferObjectiv(id, buffer, pname, offset);
+	trace_end(261, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(261, t0);
+		capture_u32((GLuint) id);
+		capture_u32((GLuint) buffer);
+		capture_u32((GLuint) pname);
+		capture_u64((GLuint64) offset);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+	double t0 = now();
+
+	real.gl.GetQueryBufferObjectui64v(id, buffer, pname, offset);
+	trace_end(262, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(262, t0);
+		capture_u32((GLuint) id);
+		capture_u32((GLuint) buffer);
+		capture_u32((GLuint) pname);
+		capture_u64((GLuint64) offset);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+	double t0 = now();
+
+	real.gl.GetQueryBufferObjectuiv(id, buffer, pname, offset);
+	trace_end(263, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(263, t0);
+		capture_u32((GLuint) id);
+		capture_u32((GLuint) buffer);
+		capture_u32((GLuint) pname);
+		capture_u64((GLuint64) offset);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetQueryIndexediv(target, index, pname, params);
+	trace_end(264, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(264, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params)
+{
+	double t0 = now();
+
+	real.gl.GetQueryObjecti64v(id, pname, params);
+	trace_end(265, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(265, t0);
+		capture_u32((GLuint) id);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetQueryObjectiv(GLuint id, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetQueryObjectiv(id, pname, params);
+	trace_end(266, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(266, t0);
+		capture_u32((GLuint) id);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params)
+{
+	double t0 = now();
+
+	real.gl.GetQueryObjectui64v(id, pname, params);
+	trace_end(267, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(267, t0);
+		capture_u32((GLuint) id);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
+{
+	double t0 = now();
+
+	real.gl.GetQueryObjectuiv(id, pname, params);
+	trace_end(268, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(268, t0);
+		capture_u32((GLuint) id);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetQueryiv(GLenum target, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetQueryiv(target, pname, params);
+	trace_end(269, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(269, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetRenderbufferParameteriv(target, pname, params);
+	trace_end(270, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(270, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetSamplerParameterIiv(sampler, pname, params);
+	trace_end(271, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(271, t0);
+		capture_u32((GLuint) sampler);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params)
+{
+	double t0 = now();
+
+	real.gl.GetSamplerParameterIuiv(sampler, pname, params);
+	trace_end(272, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(272, t0);
+		capture_u32((GLuint) sampler);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params)
+{
+	double t0 = now();
+
+	real.gl.GetSamplerParameterfv(sampler, pname, params);
+	trace_end(273, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(273, t0);
+		capture_u32((GLuint) sampler);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetSamplerParameteriv(sampler, pname, params);
+	trace_end(274, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(274, t0);
+		capture_u32((GLuint) sampler);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+	double t0 = now();
+
+	real.gl.GetShaderInfoLog(shader, bufSize, length, infoLog);
+	trace_end(275, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(275, t0);
+		capture_u32((GLuint) shader);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision)
+{
+	double t0 = now();
+
+	real.gl.GetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+	trace_end(276, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(276, t0);
+		capture_u32((GLuint) shadertype);
+		capture_u32((GLuint) precisiontype);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source)
+{
+	double t0 = now();
+
+	real.gl.GetShaderSource(shader, bufSize, length, source);
+	trace_end(277, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(277, t0);
+		capture_u32((GLuint) shader);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetShaderiv(GLuint shader, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetShaderiv(shader, pname, params);
+	trace_end(278, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(278, t0);
+		capture_u32((GLuint) shader);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static const GLubyte *APIENTRY trace_GetString(GLenum name)
+{
+	const GLubyte *res;
+	double t0 = now();
+
+	res = real.gl.GetString(name);
+	trace_end(279, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(279, t0);
+		capture_u32((GLuint) name);
+		capture_end();
+	}
+	return res;
+}
+
+static const GLubyte *APIENTRY trace_GetStringi(GLenum name, GLuint index)
+{
+	const GLubyte *res;
+	double t0 = now();
+
+	res = real.gl.GetStringi(name, index);
+	trace_end(280, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(280, t0);
+		capture_u32((GLuint) name);
+		capture_u32((GLuint) index);
+		capture_end();
+	}
+	return res;
+}
+
+static GLuint APIENTRY trace_GetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name)
+{
+	GLuint res;
+	double t0 = now();
+
+	res = real.gl.GetSubroutineIndex(program, shadertype, name);
+	trace_end(281, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(281, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) shadertype);
+		capture_string(name, -1);
+		capture_end();
+	}
+	return res;
+}
+
+static GLint APIENTRY trace_GetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name)
+{
+	GLint res;
+	double t0 = now();
+
+	res = real.gl.GetSubroutineUniformLocation(program, shadertype, name);
+	trace_end(282, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(282, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) shadertype);
+		capture_string(name, -1);
+		capture_end();
+	}
+	return res;
+}
+
+static void APIENTRY trace_GetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values)
+{
+	double t0 = now();
+
+	real.gl.GetSynciv(sync, pname, bufSize, length, values);
+	trace_end(283, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(283, t0);
+		capture_u64((GLuint64) (size_t) sync);
+		capture_u32((GLuint) pname);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels)
+{
+	double t0 = now();
+
+	real.gl.GetTexImage(target, level, format, type, pixels);
+	trace_end(284, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_unsupported(284, t0);
+	}
+}
+
+static void APIENTRY trace_GetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params)
+{
+	double t0 = now();
+
+	real.gl.GetTexLevelParameterfv(target, level, pname, params);
+	trace_end(285, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(285, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetTexLevelParameteriv(target, level, pname, params);
+	trace_end(286, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(286, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetTexParameterIiv(GLenum target, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetTexParameterIiv(target, pname, params);
+	trace_end(287, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(287, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params)
+{
+	double t0 = now();
+
+	real.gl.GetTexParameterIuiv(target, pname, params);
+	trace_end(288, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(288, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetTexParameterfv(GLenum target, GLenum pname, GLfloat *params)
+{
+	double t0 = now();
+
+	real.gl.GetTexParameterfv(target, pname, params);
+	trace_end(289, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(289, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetTexParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetTexParameteriv(target, pname, params);
+	trace_end(290, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(290, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static GLuint64 APIENTRY trace_GetTextureHandleARB(GLuint texture)
+{
+	GLuint64 res;
+	double t0 = now();
+
+	res = real.gl.GetTextureHandleARB(texture);
+	trace_end(291, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(291, t0);
+		capture_u32((GLuint) texture);
+		capture_end();
+	}
+	return res;
+}
+
+static void APIENTRY trace_GetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+	double t0 = now();
+
+	real.gl.GetTextureImage(texture, level, format, type, bufSize, pixels);
+	trace_end(292, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(292, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat *params)
+{
+	double t0 = now();
+
+	real.gl.GetTextureLevelParameterfv(texture, level, pname, params);
+	trace_end(293, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(293, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetTextureLevelParameteriv(texture, level, pname, params);
+	trace_end(294, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(294, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetTextureParameterIiv(GLuint texture, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetTextureParameterIiv(texture, pname, params);
+	trace_end(295, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(295, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint *params)
+{
+	double t0 = now();
+
+	real.gl.GetTextureParameterIuiv(texture, pname, params);
+	trace_end(296, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(296, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetTextureParameterfv(GLuint texture, GLenum pname, GLfloat *params)
+{
+	double t0 = now();
+
+	real.gl.GetTextureParameterfv(texture, pname, params);
+	trace_end(297, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(297, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetTextureParameteriv(GLuint texture, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetTextureParameteriv(texture, pname, params);
+	trace_end(298, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(298, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static GLuint64 APIENTRY trace_GetTextureSamplerHandleARB(GLuint texture, GLuint sampler)
+{
+	GLuint64 res;
+	double t0 = now();
+
+	res = real.gl.GetTextureSamplerHandleARB(texture, sampler);
+	trace_end(299, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(299, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) sampler);
+		capture_end();
+	}
+	return res;
+}
+
+static void APIENTRY trace_GetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+	double t0 = now();
+
+	real.gl.GetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+	trace_end(300, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(300, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) xoffset);
+		capture_u32((GLuint) yoffset);
+		capture_u32((GLuint) zoffset);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) depth);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name)
+{
+	double t0 = now();
+
+	real.gl.GetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+	trace_end(301, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(301, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64 *param)
+{
+	double t0 = now();
+
+	real.gl.GetTransformFeedbacki64_v(xfb, pname, index, param);
+	trace_end(302, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(302, t0);
+		capture_u32((GLuint) xfb);
+		capture_u32((GLuint) pname);
+		capture_u32((GLuint) index);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint *param)
+{
+	double t0 = now();
+
+	real.gl.GetTransformFeedbacki_v(xfb, pname, index, param);
+	trace_end(303, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(303, t0);
+		capture_u32((GLuint) xfb);
+		capture_u32((GLuint) pname);
+		capture_u32((GLuint) index);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *param)
+{
+	double t0 = now();
+
+	real.gl.GetTransformFeedbackiv(xfb, pname, param);
+	trace_end(304, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(304, t0);
+		capture_u32((GLuint) xfb);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static GLuint APIENTRY trace_GetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName)
+{
+	GLuint res;
+	double t0 = now();
+
+	res = real.gl.GetUniformBlockIndex(program, uniformBlockName);
+	trace_end(305, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(305, t0);
+		capture_u32((GLuint) program);
+		capture_string(uniformBlockName, -1);
+		capture_end();
+	}
+	return res;
+}
+
+static void APIENTRY trace_GetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices)
+{
+	double t0 = now();
+
+	real.gl.GetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+	trace_end(306, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(306, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) uniformCount);
+		capture_strings(uniformCount, uniformNames, NULL);
+		capture_end();
+	}
+}
+
+static GLint APIENTRY trace_GetUniformLocation(GLuint program, const GLchar *name)
+{
+	GLint res;
+	double t0 = now();
+
+	res = real.gl.GetUniformLocation(program, name);
+	trace_end(307, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(307, t0);
+		capture_u32((GLuint) program);
+		capture_string(name, -1);
+		capture_u32((GLuint) res);
+		capture_end();
+	}
+	return res;
+}
+
+static void APIENTRY trace_GetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params)
+{
+	double t0 = now();
+
+	real.gl.GetUniformSubroutineuiv(shadertype, location, params);
+	trace_end(308, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(308, t0);
+		capture_u32((GLuint) shadertype);
+		capture_u32((GLuint) location);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetUniformdv(GLuint program, GLint location, GLdouble *params)
+{
+	double t0 = now();
+
+	real.gl.GetUniformdv(program, location, params);
+	trace_end(309, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(309, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetUniformfv(GLuint program, GLint location, GLfloat *params)
+{
+	double t0 = now();
+
+	real.gl.GetUniformfv(program, location, params);
+	trace_end(310, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(310, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetUniformiv(GLuint program, GLint location, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetUniformiv(program, location, params);
+	trace_end(311, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(311, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetUniformuiv(GLuint program, GLint location, GLuint *params)
+{
+	double t0 = now();
+
+	real.gl.GetUniformuiv(program, location, params);
+	trace_end(312, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(312, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 *param)
+{
+	double t0 = now();
+
+	real.gl.GetVertexArrayIndexed64iv(vaobj, index, pname, param);
+	trace_end(313, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(313, t0);
+		capture_u32((GLuint) vaobj);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint *param)
+{
+	double t0 = now();
+
+	real.gl.GetVertexArrayIndexediv(vaobj, index, pname, param);
+	trace_end(314, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(314, t0);
+		capture_u32((GLuint) vaobj);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param)
+{
+	double t0 = now();
+
+	real.gl.GetVertexArrayiv(vaobj, pname, param);
+	trace_end(315, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(315, t0);
+		capture_u32((GLuint) vaobj);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetVertexAttribIiv(GLuint index, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetVertexAttribIiv(index, pname, params);
+	trace_end(316, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(316, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params)
+{
+	double t0 = now();
+
+	real.gl.GetVertexAttribIuiv(index, pname, params);
+	trace_end(317, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(317, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params)
+{
+	double t0 = now();
+
+	real.gl.GetVertexAttribLdv(index, pname, params);
+	trace_end(318, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(318, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetVertexAttribLui64vARB(GLuint index, GLenum pname, GLuint64EXT *params)
+{
+	double t0 = now();
+
+	real.gl.GetVertexAttribLui64vARB(index, pname, params);
+	trace_end(319, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(319, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer)
+{
+	double t0 = now();
+
+	real.gl.GetVertexAttribPointerv(index, pname, pointer);
+	trace_end(320, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(320, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params)
+{
+	double t0 = now();
+
+	real.gl.GetVertexAttribdv(index, pname, params);
+	trace_end(321, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(321, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params)
+{
+	double t0 = now();
+
+	real.gl.GetVertexAttribfv(index, pname, params);
+	trace_end(322, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(322, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetVertexAttribiv(GLuint index, GLenum pname, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetVertexAttribiv(index, pname, params);
+	trace_end(323, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(323, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) pname);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetnCompressedTexImage(GLenum target, GLint lod, GLsizei bufSize, void *pixels)
+{
+	double t0 = now();
+
+	real.gl.GetnCompressedTexImage(target, lod, bufSize, pixels);
+	trace_end(324, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(324, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) lod);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetnCompressedTexImageARB(GLenum target, GLint lod, GLsizei bufSize, void *img)
+{
+	double t0 = now();
+
+	real.gl.GetnCompressedTexImageARB(target, lod, bufSize, img);
+	trace_end(325, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(325, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) lod);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetnTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+	double t0 = now();
+
+	real.gl.GetnTexImage(target, level, format, type, bufSize, pixels);
+	trace_end(326, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(326, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetnTexImageARB(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *img)
+{
+	double t0 = now();
+
+	real.gl.GetnTexImageARB(target, level, format, type, bufSize, img);
+	trace_end(327, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(327, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble *params)
+{
+	double t0 = now();
+
+	real.gl.GetnUniformdv(program, location, bufSize, params);
+	trace_end(328, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(328, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetnUniformdvARB(GLuint program, GLint location, GLsizei bufSize, GLdouble *params)
+{
+	double t0 = now();
+
+	real.gl.GetnUniformdvARB(program, location, bufSize, params);
+	trace_end(329, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(329, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat *params)
+{
+	double t0 = now();
+
+	real.gl.GetnUniformfv(program, location, bufSize, params);
+	trace_end(330, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(330, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetnUniformfvARB(GLuint program, GLint location, GLsizei bufSize, GLfloat *params)
+{
+	double t0 = now();
+
+	real.gl.GetnUniformfvARB(program, location, bufSize, params);
+	trace_end(331, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(331, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetnUniformiv(program, location, bufSize, params);
+	trace_end(332, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(332, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetnUniformivARB(GLuint program, GLint location, GLsizei bufSize, GLint *params)
+{
+	double t0 = now();
+
+	real.gl.GetnUniformivARB(program, location, bufSize, params);
+	trace_end(333, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(333, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint *params)
+{
+	double t0 = now();
+
+	real.gl.GetnUniformuiv(program, location, bufSize, params);
+	trace_end(334, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(334, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_GetnUniformuivARB(GLuint program, GLint location, GLsizei bufSize, GLuint *params)
+{
+	double t0 = now();
+
+	real.gl.GetnUniformuivARB(program, location, bufSize, params);
+	trace_end(335, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(335, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) bufSize);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Hint(GLenum target, GLenum mode)
+{
+	double t0 = now();
+
+	real.gl.Hint(target, mode);
+	trace_end(336, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(336, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) mode);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_InvalidateBufferData(GLuint buffer)
+{
+	double t0 = now();
+
+	real.gl.InvalidateBufferData(buffer);
+	trace_end(337, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(337, t0);
+		capture_u32((GLuint) buffer);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_InvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+	double t0 = now();
+
+	real.gl.InvalidateBufferSubData(buffer, offset, length);
+	trace_end(338, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(338, t0);
+		capture_u32((GLuint) buffer);
+		capture_u64((GLuint64) offset);
+		capture_u64((GLuint64) length);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_InvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments)
+{
+	double t0 = now();
+
+	real.gl.InvalidateFramebuffer(target, numAttachments, attachments);
+	trace_end(339, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(339, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) numAttachments);
+		capture_data(attachments, numAttachments * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_InvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments)
+{
+	double t0 = now();
+
+	real.gl.InvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+	trace_end(340, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(340, t0);
+		capture_u32((GLuint) framebuffer);
+		capture_u32((GLuint) numAttachments);
+		capture_data(attachments, numAttachments * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_InvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	double t0 = now();
+
+	real.gl.InvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+	trace_end(341, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(341, t0);
+		capture_u32((GLuint) framebuffer);
+		capture_u32((GLuint) numAttachments);
+		capture_data(attachments, numAttachments * 4);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_InvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	double t0 = now();
+
+	real.gl.InvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+	trace_end(342, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(342, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) numAttachments);
+		capture_data(attachments, numAttachments * 4);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_InvalidateTexImage(GLuint texture, GLint level)
+{
+	double t0 = now();
+
+	real.gl.InvalidateTexImage(texture, level);
+	trace_end(343, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(343, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_InvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth)
+{
+	double t0 = now();
+
+	real.gl.InvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+	trace_end(344, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(344, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) xoffset);
+		capture_u32((GLuint) yoffset);
+		capture_u32((GLuint) zoffset);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) depth);
+		capture_end();
+	}
+}
+
+static GLboolean APIENTRY trace_IsBuffer(GLuint buffer)
+{
+	GLboolean res;
+	double t0 = now();
+
+	res = real.gl.IsBuffer(buffer);
+	trace_end(345, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(345, t0);
+		capture_u32((GLuint) buffer);
+		capture_end();
+	}
+	return res;
+}
+
+static GLboolean APIENTRY trace_IsEnabled(GLenum cap)
+{
+	GLboolean res;
+	double t0 = now();
+
+	res = real.gl.IsEnabled(cap);
+	trace_end(346, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(346, t0);
+		capture_u32((GLuint) cap);
+		capture_end();
+	}
+	return res;
+}
+
+static GLboolean APIENTRY trace_IsEnabledi(GLenum target, GLuint index)
+{
+	GLboolean res;
+	double t0 = now();
+
+	res = real.gl.IsEnabledi(target, index);
+	trace_end(347, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(347, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) index);
+		capture_end();
+	}
+	return res;
+}
+
+static GLboolean APIENTRY trace_IsFramebuffer(GLuint framebuffer)
+{
+	GLboolean res;
+	double t0 = now();
+
+	res = real.gl.IsFramebuffer(framebuffer);
+	trace_end(348, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(348, t0);
+		capture_u32((GLuint) framebuffer);
+		capture_end();
+	}
+	return res;
+}
+
+static GLboolean APIENTRY trace_IsImageHandleResidentARB(GLuint64 handle)
+{
+	GLboolean res;
+	double t0 = now();
+
+	res = real.gl.IsImageHandleResidentARB(handle);
+	trace_end(349, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(349, t0);
+		capture_u64((GLuint64) handle);
+		capture_end();
+	}
+	return res;
+}
+
+static GLboolean APIENTRY trace_IsNamedStringARB(GLint namelen, const GLchar *name)
+{
+	GLboolean res;
+	double t0 = now();
+
+	res = real.gl.IsNamedStringARB(namelen, name);
+	trace_end(350, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_unsupported(350, t0);
+	}
+	return res;
+}
+
+static GLboolean APIENTRY trace_IsProgram(GLuint program)
+{
+	GLboolean res;
+	double t0 = now();
+
+	res = real.gl.IsProgram(program);
+	trace_end(351, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(351, t0);
+		capture_u32((GLuint) program);
+		capture_end();
+	}
+	return res;
+}
+
+static GLboolean APIENTRY trace_IsProgramPipeline(GLuint pipeline)
+{
+	GLboolean res;
+	double t0 = now();
+
+	res = real.gl.IsProgramPipeline(pipeline);
+	trace_end(352, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(352, t0);
+		capture_u32((GLuint) pipeline);
+		capture_end();
+	}
+	return res;
+}
+
+static GLboolean APIENTRY trace_IsQuery(GLuint id)
+{
+	GLboolean res;
+	double t0 = now();
+
+	res = real.gl.IsQuery(id);
+	trace_end(353, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(353, t0);
+		capture_u32((GLuint) id);
+		capture_end();
+	}
+	return res;
+}
+
+static GLboolean APIENTRY trace_IsRenderbuffer(GLuint renderbuffer)
+{
+	GLboolean res;
+	double t0 = now();
+
+	res = real.gl.IsRenderbuffer(renderbuffer);
+	trace_end(354, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(354, t0);
+		capture_u32((GLuint) renderbuffer);
+		capture_end();
+	}
+	return res;
+}
+
+static GLboolean APIENTRY trace_IsSampler(GLuint sampler)
+{
+	GLboolean res;
+	double t0 = now();
+
+	res = real.gl.IsSampler(sampler);
+	trace_end(355, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(355, t0);
+		capture_u32((GLuint) sampler);
+		capture_end();
+	}
+	return res;
+}
+
+static GLboolean APIENTRY trace_IsShader(GLuint shader)
+{
+	GLboolean res;
+	double t0 = now();
+
+	res = real.gl.IsShader(shader);
+	trace_end(356, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(356, t0);
+		capture_u32((GLuint) shader);
+		capture_end();
+	}
+	return res;
+}
+
+static GLboolean APIENTRY trace_IsSync(GLsync sync)
+{
+	GLboolean res;
+	double t0 = now();
+
+	res = real.gl.IsSync(sync);
+	trace_end(357, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(357, t0);
+		capture_u64((GLuint64) (size_t) sync);
+		capture_end();
+	}
+	return res;
+}
+
+static GLboolean APIENTRY trace_IsTexture(GLuint texture)
+{
+	GLboolean res;
+	double t0 = now();
+
+	res = real.gl.IsTexture(texture);
+	trace_end(358, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(358, t0);
+		capture_u32((GLuint) texture);
+		capture_end();
+	}
+	return res;
+}
+
+static GLboolean APIENTRY trace_IsTextureHandleResidentARB(GLuint64 handle)
+{
+	GLboolean res;
+	double t0 = now();
+
+	res = real.gl.IsTextureHandleResidentARB(handle);
+	trace_end(359, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(359, t0);
+		capture_u64((GLuint64) handle);
+		capture_end();
+	}
+	return res;
+}
+
+static GLboolean APIENTRY trace_IsTransformFeedback(GLuint id)
+{
+	GLboolean res;
+	double t0 = now();
+
+	res = real.gl.IsTransformFeedback(id);
+	trace_end(360, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(360, t0);
+		capture_u32((GLuint) id);
+		capture_end();
+	}
+	return res;
+}
+
+static GLboolean APIENTRY trace_IsVertexArray(GLuint array)
+{
+	GLboolean res;
+	double t0 = now();
+
+	res = real.gl.IsVertexArray(array);
+	trace_end(361, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(361, t0);
+		capture_u32((GLuint) array);
+		capture_end();
+	}
+	return res;
+}
+
+static void APIENTRY trace_LineWidth(GLfloat width)
+{
+	double t0 = now();
+
+	real.gl.LineWidth(width);
+	trace_end(362, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(362, t0);
+		capture_f32(width);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_LinkProgram(GLuint program)
+{
+	double t0 = now();
+
+	real.gl.LinkProgram(program);
+	trace_end(363, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(363, t0);
+		capture_u32((GLuint) program);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_LogicOp(GLenum opcode)
+{
+	double t0 = now();
+
+	real.gl.LogicOp(opcode);
+	trace_end(364, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(364, t0);
+		capture_u32((GLuint) opcode);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_MakeImageHandleNonResidentARB(GLuint64 handle)
+{
+	double t0 = now();
+
+	real.gl.MakeImageHandleNonResidentARB(handle);
+	trace_end(365, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(365, t0);
+		capture_u64((GLuint64) handle);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_MakeImageHandleResidentARB(GLuint64 handle, GLenum access)
+{
+	double t0 = now();
+
+	real.gl.MakeImageHandleResidentARB(handle, access);
+	trace_end(366, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(366, t0);
+		capture_u64((GLuint64) handle);
+		capture_u32((GLuint) access);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_MakeTextureHandleNonResidentARB(GLuint64 handle)
+{
+	double t0 = now();
+
+	real.gl.MakeTextureHandleNonResidentARB(handle);
+	trace_end(367, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(367, t0);
+		capture_u64((GLuint64) handle);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_MakeTextureHandleResidentARB(GLuint64 handle)
+{
+	double t0 = now();
+
+	real.gl.MakeTextureHandleResidentARB(handle);
+	trace_end(368, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(368, t0);
+		capture_u64((GLuint64) handle);
+		capture_end();
+	}
+}
+
+static void *APIENTRY trace_MapBuffer(GLenum target, GLenum access)
+{
+	void *res;
+	double t0 = now();
+
+	res = real.gl.MapBuffer(target, access);
+	trace_end(369, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(369, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) access);
+		capture_map(0, target, res, capture_buffer_size(0, target), access == GL_READ_ONLY ? GL_MAP_READ_BIT : GL_MAP_WRITE_BIT);
+		capture_end();
+	}
+	return res;
+}
+
+static void *APIENTRY trace_MapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+	void *res;
+	double t0 = now();
+
+	res = real.gl.MapBufferRange(target, offset, length, access);
+	trace_end(370, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(370, t0);
+		capture_u32((GLuint) target);
+		capture_u64((GLuint64) offset);
+		capture_u64((GLuint64) length);
+		capture_u32((GLuint) access);
+		capture_map(0, target, res, length, access);
+		capture_end();
+	}
+	return res;
+}
+
+static void *APIENTRY trace_MapNamedBuffer(GLuint buffer, GLenum access)
+{
+	void *res;
+	double t0 = now();
+
+	res = real.gl.MapNamedBuffer(buffer, access);
+	trace_end(371, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(371, t0);
+		capture_u32((GLuint) buffer);
+		capture_u32((GLuint) access);
+		capture_map(1, buffer, res, capture_buffer_size(1, buffer), access == GL_READ_ONLY ? GL_MAP_READ_BIT : GL_MAP_WRITE_BIT);
+		capture_end();
+	}
+	return res;
+}
+
+static void *APIENTRY trace_MapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+	void *res;
+	double t0 = now();
+
+	res = real.gl.MapNamedBufferRange(buffer, offset, length, access);
+	trace_end(372, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(372, t0);
+		capture_u32((GLuint) buffer);
+		capture_u64((GLuint64) offset);
+		capture_u64((GLuint64) length);
+		capture_u32((GLuint) access);
+		capture_map(1, buffer, res, length, access);
+		capture_end();
+	}
+	return res;
+}
+
+static void APIENTRY trace_MemoryBarrier(GLbitfield barriers)
+{
+	double t0 = now();
+
+	real.gl.MemoryBarrier(barriers);
+	trace_end(373, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(373, t0);
+		capture_u32((GLuint) barriers);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_MemoryBarrierByRegion(GLbitfield barriers)
+{
+	double t0 = now();
+
+	real.gl.MemoryBarrierByRegion(barriers);
+	trace_end(374, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(374, t0);
+		capture_u32((GLuint) barriers);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_MinSampleShading(GLfloat value)
+{
+	double t0 = now();
+
+	real.gl.MinSampleShading(value);
+	trace_end(375, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(375, t0);
+		capture_f32(value);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_MinSampleShadingARB(GLfloat value)
+{
+	double t0 = now();
+
+	real.gl.MinSampleShadingARB(value);
+	trace_end(376, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(376, t0);
+		capture_f32(value);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_MultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount)
+{
+	double t0 = now();
+
+	real.gl.MultiDrawArrays(mode, first, count, drawcount);
+	trace_end(377, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(377, t0);
+		capture_u32((GLuint) mode);
+		capture_data(first, drawcount * 4);
+		capture_data(count, drawcount * 4);
+		capture_u32((GLuint) drawcount);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_MultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride)
+{
+	double t0 = now();
+
+	real.gl.MultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+	trace_end(378, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(378, t0);
+		capture_u32((GLuint) mode);
+		capture_u64((GLuint64) (size_t) indirect);
+		capture_u32((GLuint) drawcount);
+		capture_u32((GLuint) stride);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_MultiDrawArraysIndirectCountARB(GLenum mode, GLintptr indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+	double t0 = now();
+
+	real.gl.MultiDrawArraysIndirectCountARB(mode, indirect, drawcount, maxdrawcount, stride);
+	trace_end(379, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(379, t0);
+		capture_u32((GLuint) mode);
+		capture_u64((GLuint64) indirect);
+		capture_u64((GLuint64) drawcount);
+		capture_u32((GLuint) maxdrawcount);
+		capture_u32((GLuint) stride);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_MultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount)
+{
+	double t0 = now();
+
+	real.gl.MultiDrawElements(mode, count, type, indices, drawcount);
+	trace_end(380, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(380, t0);
+		capture_u32((GLuint) mode);
+		capture_data(count, drawcount * 4);
+		capture_u32((GLuint) type);
+		capture_offsets(indices, drawcount);
+		capture_u32((GLuint) drawcount);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_MultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex)
+{
+	double t0 = now();
+
+	real.gl.MultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+	trace_end(381, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(381, t0);
+		capture_u32((GLuint) mode);
+		capture_data(count, drawcount * 4);
+		capture_u32((GLuint) type);
+		capture_offsets(indices, drawcount);
+		capture_u32((GLuint) drawcount);
+		capture_data(basevertex, drawcount * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_MultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride)
+{
+	double t0 = now();
+
+	real.gl.MultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+	trace_end(382, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(382, t0);
+		capture_u32((GLuint) mode);
+		capture_u32((GLuint) type);
+		capture_u64((GLuint64) (size_t) indirect);
+		capture_u32((GLuint) drawcount);
+		capture_u32((GLuint) stride);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_MultiDrawElementsIndirectCountARB(GLenum mode, GLenum type, GLintptr indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+	double t0 = now();
+
+	real.gl.MultiDrawElementsIndirectCountARB(mode, type, indirect, drawcount, maxdrawcount, stride);
+	trace_end(383, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(383, t0);
+		capture_u32((GLuint) mode);
+		capture_u32((GLuint) type);
+		capture_u64((GLuint64) indirect);
+		capture_u64((GLuint64) drawcount);
+		capture_u32((GLuint) maxdrawcount);
+		capture_u32((GLuint) stride);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_NamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage)
+{
+	double t0 = now();
+
+	real.gl.NamedBufferData(buffer, size, data, usage);
+	trace_end(384, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(384, t0);
+		capture_u32((GLuint) buffer);
+		capture_u64((GLuint64) size);
+		capture_data(data, size);
+		capture_u32((GLuint) usage);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_NamedBufferPageCommitmentARB(GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit)
+{
+	double t0 = now();
+
+	real.gl.NamedBufferPageCommitmentARB(buffer, offset, size, commit);
+	trace_end(385, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(385, t0);
+		capture_u32((GLuint) buffer);
+		capture_u64((GLuint64) offset);
+		capture_u64((GLuint64) size);
+		capture_u32((GLuint) commit);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_NamedBufferPageCommitmentEXT(GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit)
+{
+	double t0 = now();
+
+	real.gl.NamedBufferPageCommitmentEXT(buffer, offset, size, commit);
+	trace_end(386, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(386, t0);
+		capture_u32((GLuint) buffer);
+		capture_u64((GLuint64) offset);
+		capture_u64((GLuint64) size);
+		capture_u32((GLuint) commit);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_NamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+	double t0 = now();
+
+	real.gl.NamedBufferStorage(buffer, size, data, flags);
+	trace_end(387, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(387, t0);
+		capture_u32((GLuint) buffer);
+		capture_u64((GLuint64) size);
+		capture_data(data, size);
+		capture_u32((GLuint) flags);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_NamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data)
+{
+	double t0 = now();
+
+	real.gl.NamedBufferSubData(buffer, offset, size, data);
+	trace_end(388, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(388, t0);
+		capture_u32((GLuint) buffer);
+		capture_u64((GLuint64) offset);
+		capture_u64((GLuint64) size);
+		capture_data(data, size);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_NamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf)
+{
+	double t0 = now();
+
+	real.gl.NamedFramebufferDrawBuffer(framebuffer, buf);
+	trace_end(389, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(389, t0);
+		capture_u32((GLuint) framebuffer);
+		capture_u32((GLuint) buf);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_NamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum *bufs)
+{
+	double t0 = now();
+
+	real.gl.NamedFramebufferDrawBuffers(framebuffer, n, bufs);
+	trace_end(390, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(390, t0);
+		capture_u32((GLuint) framebuffer);
+		capture_u32((GLuint) n);
+		capture_data(bufs, n * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_NamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param)
+{
+	double t0 = now();
+
+	real.gl.NamedFramebufferParameteri(framebuffer, pname, param);
+	trace_end(391, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(391, t0);
+		capture_u32((GLuint) framebuffer);
+		capture_u32((GLuint) pname);
+		capture_u32((GLuint) param);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_NamedFramebufferReadBuffer(GLuint framebuffer, GLenum src)
+{
+	double t0 = now();
+
+	real.gl.NamedFramebufferReadBuffer(framebuffer, src);
+	trace_end(392, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(392, t0);
+		capture_u32((GLuint) framebuffer);
+		capture_u32((GLuint) src);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_NamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+	double t0 = now();
+
+	real.gl.NamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+	trace_end(393, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(393, t0);
+		capture_u32((GLuint) framebuffer);
+		capture_u32((GLuint) attachment);
+		capture_u32((GLuint) renderbuffertarget);
+		capture_u32((GLuint) renderbuffer);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_NamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level)
+{
+	double t0 = now();
+
+	real.gl.NamedFramebufferTexture(framebuffer, attachment, texture, level);
+	trace_end(394, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(394, t0);
+		capture_u32((GLuint) framebuffer);
+		capture_u32((GLuint) attachment);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_NamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+	double t0 = now();
+
+	real.gl.NamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+	trace_end(395, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(395, t0);
+		capture_u32((GLuint) framebuffer);
+		capture_u32((GLuint) attachment);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) layer);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_NamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height)
+{
+	double t0 = now();
+
+	real.gl.NamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+	trace_end(396, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(396, t0);
+		capture_u32((GLuint) renderbuffer);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_NamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+	double t0 = now();
+
+	real.gl.NamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+	trace_end(397, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(397, t0);
+		capture_u32((GLuint) renderbuffer);
+		capture_u32((GLuint) samples);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_NamedStringARB(GLenum type, GLint namelen, const GLchar *name, GLint stringlen, const GLchar *string)
+{
+	double t0 = now();
+
+	real.gl.NamedStringARB(type, namelen, name, stringlen, string);
+	trace_end(398, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_unsupported(398, t0);
+	}
+}
+
+static void APIENTRY trace_ObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label)
+{
+	double t0 = now();
+
+	real.gl.ObjectLabel(identifier, name, length, label);
+	trace_end(399, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(399, t0);
+		capture_u32((GLuint) identifier);
+		capture_u32((GLuint) name);
+		capture_u32((GLuint) length);
+		capture_string(label, length);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label)
+{
+	double t0 = now();
+
+	real.gl.ObjectPtrLabel(ptr, length, label);
+	trace_end(400, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_unsupported(400, t0);
+	}
+}
+
+static void APIENTRY trace_PatchParameterfv(GLenum pname, const GLfloat *values)
+{
+	double t0 = now();
+
+	real.gl.PatchParameterfv(pname, values);
+	trace_end(401, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(401, t0);
+		capture_u32((GLuint) pname);
+		capture_data(values, pname == GL_PATCH_DEFAULT_OUTER_LEVEL ? 16 : 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_PatchParameteri(GLenum pname, GLint value)
+{
+	double t0 = now();
+
+	real.gl.PatchParameteri(pname, value);
+	trace_end(402, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(402, t0);
+		capture_u32((GLuint) pname);
+		capture_u32((GLuint) value);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_PauseTransformFeedback(void)
+{
+	double t0 = now();
+
+	real.gl.PauseTransformFeedback();
+	trace_end(403, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(403, t0);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_PixelStoref(GLenum pname, GLfloat param)
+{
+	double t0 = now();
+
+	real.gl.PixelStoref(pname, param);
+	trace_end(404, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(404, t0);
+		capture_u32((GLuint) pname);
+		capture_f32(param);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_PixelStorei(GLenum pname, GLint param)
+{
+	double t0 = now();
+
+	real.gl.PixelStorei(pname, param);
+	trace_end(405, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(405, t0);
+		capture_u32((GLuint) pname);
+		capture_u32((GLuint) param);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_PointParameterf(GLenum pname, GLfloat param)
+{
+	double t0 = now();
+
+	real.gl.PointParameterf(pname, param);
+	trace_end(406, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(406, t0);
+		capture_u32((GLuint) pname);
+		capture_f32(param);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_PointParameterfv(GLenum pname, const GLfloat *params)
+{
+	double t0 = now();
+
+	real.gl.PointParameterfv(pname, params);
+	trace_end(407, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(407, t0);
+		capture_u32((GLuint) pname);
+		capture_data(params, 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_PointParameteri(GLenum pname, GLint param)
+{
+	double t0 = now();
+
+	real.gl.PointParameteri(pname, param);
+	trace_end(408, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(408, t0);
+		capture_u32((GLuint) pname);
+		capture_u32((GLuint) param);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_PointParameteriv(GLenum pname, const GLint *params)
+{
+	double t0 = now();
+
+	real.gl.PointParameteriv(pname, params);
+	trace_end(409, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(409, t0);
+		capture_u32((GLuint) pname);
+		capture_data(params, 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_PointSize(GLfloat size)
+{
+	double t0 = now();
+
+	real.gl.PointSize(size);
+	trace_end(410, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(410, t0);
+		capture_f32(size);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_PolygonMode(GLenum face, GLenum mode)
+{
+	double t0 = now();
+
+	real.gl.PolygonMode(face, mode);
+	trace_end(411, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(411, t0);
+		capture_u32((GLuint) face);
+		capture_u32((GLuint) mode);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_PolygonOffset(GLfloat factor, GLfloat units)
+{
+	double t0 = now();
+
+	real.gl.PolygonOffset(factor, units);
+	trace_end(412, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(412, t0);
+		capture_f32(factor);
+		capture_f32(units);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_PopDebugGroup(void)
+{
+	double t0 = now();
+
+	real.gl.PopDebugGroup();
+	trace_end(413, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(413, t0);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_PrimitiveRestartIndex(GLuint index)
+{
+	double t0 = now();
+
+	real.gl.PrimitiveRestartIndex(index);
+	trace_end(414, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(414, t0);
+		capture_u32((GLuint) index);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length)
+{
+	double t0 = now();
+
+	real.gl.ProgramBinary(program, binaryFormat, binary, length);
+	trace_end(415, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(415, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) binaryFormat);
+		capture_data(binary, length);
+		capture_u32((GLuint) length);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramParameteri(GLuint program, GLenum pname, GLint value)
+{
+	double t0 = now();
+
+	real.gl.ProgramParameteri(program, pname, value);
+	trace_end(416, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(416, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) pname);
+		capture_u32((GLuint) value);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform1d(GLuint program, GLint location, GLdouble v0)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform1d(program, location, v0);
+	trace_end(417, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(417, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_f64(v0);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform1dv(program, location, count, value);
+	trace_end(418, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(418, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform1f(GLuint program, GLint location, GLfloat v0)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform1f(program, location, v0);
+	trace_end(419, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(419, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_f32(v0);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform1fv(program, location, count, value);
+	trace_end(420, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(420, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform1i(GLuint program, GLint location, GLint v0)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform1i(program, location, v0);
+	trace_end(421, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(421, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) v0);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform1iv(program, location, count, value);
+	trace_end(422, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(422, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform1ui(GLuint program, GLint location, GLuint v0)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform1ui(program, location, v0);
+	trace_end(423, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(423, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) v0);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform1uiv(program, location, count, value);
+	trace_end(424, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(424, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform2d(program, location, v0, v1);
+	trace_end(425, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(425, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_f64(v0);
+		capture_f64(v1);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform2dv(program, location, count, value);
+	trace_end(426, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(426, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform2f(program, location, v0, v1);
+	trace_end(427, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(427, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_f32(v0);
+		capture_f32(v1);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform2fv(program, location, count, value);
+	trace_end(428, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(428, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform2i(program, location, v0, v1);
+	trace_end(429, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(429, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) v0);
+		capture_u32((GLuint) v1);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform2iv(program, location, count, value);
+	trace_end(430, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(430, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform2ui(program, location, v0, v1);
+	trace_end(431, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(431, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) v0);
+		capture_u32((GLuint) v1);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform2uiv(program, location, count, value);
+	trace_end(432, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(432, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform3d(program, location, v0, v1, v2);
+	trace_end(433, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(433, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_f64(v0);
+		capture_f64(v1);
+		capture_f64(v2);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform3dv(program, location, count, value);
+	trace_end(434, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(434, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 24);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform3f(program, location, v0, v1, v2);
+	trace_end(435, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(435, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_f32(v0);
+		capture_f32(v1);
+		capture_f32(v2);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform3fv(program, location, count, value);
+	trace_end(436, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(436, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 12);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform3i(program, location, v0, v1, v2);
+	trace_end(437, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(437, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) v0);
+		capture_u32((GLuint) v1);
+		capture_u32((GLuint) v2);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform3iv(program, location, count, value);
+	trace_end(438, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(438, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 12);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform3ui(program, location, v0, v1, v2);
+	trace_end(439, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(439, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) v0);
+		capture_u32((GLuint) v1);
+		capture_u32((GLuint) v2);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform3uiv(program, location, count, value);
+	trace_end(440, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(440, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 12);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform4d(program, location, v0, v1, v2, v3);
+	trace_end(441, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(441, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_f64(v0);
+		capture_f64(v1);
+		capture_f64(v2);
+		capture_f64(v3);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform4dv(program, location, count, value);
+	trace_end(442, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(442, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 32);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform4f(program, location, v0, v1, v2, v3);
+	trace_end(443, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(443, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_f32(v0);
+		capture_f32(v1);
+		capture_f32(v2);
+		capture_f32(v3);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform4fv(program, location, count, value);
+	trace_end(444, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(444, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform4i(program, location, v0, v1, v2, v3);
+	trace_end(445, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(445, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) v0);
+		capture_u32((GLuint) v1);
+		capture_u32((GLuint) v2);
+		capture_u32((GLuint) v3);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform4iv(program, location, count, value);
+	trace_end(446, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(446, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform4ui(program, location, v0, v1, v2, v3);
+	trace_end(447, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(447, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) v0);
+		capture_u32((GLuint) v1);
+		capture_u32((GLuint) v2);
+		capture_u32((GLuint) v3);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniform4uiv(program, location, count, value);
+	trace_end(448, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(448, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniformHandleui64ARB(GLuint program, GLint location, GLuint64 value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniformHandleui64ARB(program, location, value);
+	trace_end(449, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(449, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u64((GLuint64) value);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniformHandleui64vARB(GLuint program, GLint location, GLsizei count, const GLuint64 *values)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniformHandleui64vARB(program, location, count, values);
+	trace_end(450, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(450, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(values, count * 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniformMatrix2dv(program, location, count, transpose, value);
+	trace_end(451, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(451, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 32);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniformMatrix2fv(program, location, count, transpose, value);
+	trace_end(452, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(452, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+	trace_end(453, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(453, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 48);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+	trace_end(454, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(454, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 24);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+	trace_end(455, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(455, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 64);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+	trace_end(456, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(456, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 32);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniformMatrix3dv(program, location, count, transpose, value);
+	trace_end(457, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(457, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 72);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniformMatrix3fv(program, location, count, transpose, value);
+	trace_end(458, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(458, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 36);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+	trace_end(459, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(459, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 48);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+	trace_end(460, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(460, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 24);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+	trace_end(461, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(461, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 96);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+	trace_end(462, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(462, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 48);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniformMatrix4dv(program, location, count, transpose, value);
+	trace_end(463, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(463, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 128);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniformMatrix4fv(program, location, count, transpose, value);
+	trace_end(464, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(464, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 64);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+	trace_end(465, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(465, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 64);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+	trace_end(466, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(466, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 32);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+	trace_end(467, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(467, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 96);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.ProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+	trace_end(468, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(468, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 48);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ProvokingVertex(GLenum mode)
+{
+	double t0 = now();
+
+	real.gl.ProvokingVertex(mode);
+	trace_end(469, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(469, t0);
+		capture_u32((GLuint) mode);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_PushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message)
+{
+	double t0 = now();
+
+	real.gl.PushDebugGroup(source, id, length, message);
+	trace_end(470, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(470, t0);
+		capture_u32((GLuint) source);
+		capture_u32((GLuint) id);
+		capture_u32((GLuint) length);
+		capture_string(message, length);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_QueryCounter(GLuint id, GLenum target)
+{
+	double t0 = now();
+
+	real.gl.QueryCounter(id, target);
+	trace_end(471, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(471, t0);
+		capture_u32((GLuint) id);
+		capture_u32((GLuint) target);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ReadBuffer(GLenum src)
+{
+	double t0 = now();
+
+	real.gl.ReadBuffer(src);
+	trace_end(472, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(472, t0);
+		capture_u32((GLuint) src);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+{
+	double t0 = now();
+
+	real.gl.ReadPixels(x, y, width, height, format, type, pixels);
+	trace_end(473, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(473, t0);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) type);
+		capture_pack(pixels);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data)
+{
+	double t0 = now();
+
+	real.gl.ReadnPixels(x, y, width, height, format, type, bufSize, data);
+	trace_end(474, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(474, t0);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) bufSize);
+		capture_pack(data);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ReadnPixelsARB(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data)
+{
+	double t0 = now();
+
+	real.gl.ReadnPixelsARB(x, y, width, height, format, type, bufSize, data);
+	trace_end(475, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(475, t0);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) bufSize);
+		capture_pack(data);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ReleaseShaderCompiler(void)
+{
+	double t0 = now();
+
+	real.gl.ReleaseShaderCompiler();
+	trace_end(476, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(476, t0);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_RenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+	double t0 = now();
+
+	real.gl.RenderbufferStorage(target, internalformat, width, height);
+	trace_end(477, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(477, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_RenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+	double t0 = now();
+
+	real.gl.RenderbufferStorageMultisample(target, samples, internalformat, width, height);
+	trace_end(478, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(478, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) samples);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ResumeTransformFeedback(void)
+{
+	double t0 = now();
+
+	real.gl.ResumeTransformFeedback();
+	trace_end(479, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(479, t0);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_SampleCoverage(GLfloat value, GLboolean invert)
+{
+	double t0 = now();
+
+	real.gl.SampleCoverage(value, invert);
+	trace_end(480, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(480, t0);
+		capture_f32(value);
+		capture_u32((GLuint) invert);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_SampleMaski(GLuint maskNumber, GLbitfield mask)
+{
+	double t0 = now();
+
+	real.gl.SampleMaski(maskNumber, mask);
+	trace_end(481, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(481, t0);
+		capture_u32((GLuint) maskNumber);
+		capture_u32((GLuint) mask);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_SamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param)
+{
+	double t0 = now();
+
+	real.gl.SamplerParameterIiv(sampler, pname, param);
+	trace_end(482, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(482, t0);
+		capture_u32((GLuint) sampler);
+		capture_u32((GLuint) pname);
+		capture_data(param, capture_param_size(pname));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_SamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param)
+{
+	double t0 = now();
+
+	real.gl.SamplerParameterIuiv(sampler, pname, param);
+	trace_end(483, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(483, t0);
+		capture_u32((GLuint) sampler);
+		capture_u32((GLuint) pname);
+		capture_data(param, capture_param_size(pname));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_SamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
+{
+	double t0 = now();
+
+	real.gl.SamplerParameterf(sampler, pname, param);
+	trace_end(484, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(484, t0);
+		capture_u32((GLuint) sampler);
+		capture_u32((GLuint) pname);
+		capture_f32(param);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_SamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param)
+{
+	double t0 = now();
+
+	real.gl.SamplerParameterfv(sampler, pname, param);
+	trace_end(485, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(485, t0);
+		capture_u32((GLuint) sampler);
+		capture_u32((GLuint) pname);
+		capture_data(param, capture_param_size(pname));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_SamplerParameteri(GLuint sampler, GLenum pname, GLint param)
+{
+	double t0 = now();
+
+	real.gl.SamplerParameteri(sampler, pname, param);
+	trace_end(486, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(486, t0);
+		capture_u32((GLuint) sampler);
+		capture_u32((GLuint) pname);
+		capture_u32((GLuint) param);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_SamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param)
+{
+	double t0 = now();
+
+	real.gl.SamplerParameteriv(sampler, pname, param);
+	trace_end(487, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(487, t0);
+		capture_u32((GLuint) sampler);
+		capture_u32((GLuint) pname);
+		capture_data(param, capture_param_size(pname));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	double t0 = now();
+
+	real.gl.Scissor(x, y, width, height);
+	trace_end(488, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(488, t0);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ScissorArrayv(GLuint first, GLsizei count, const GLint *v)
+{
+	double t0 = now();
+
+	real.gl.ScissorArrayv(first, count, v);
+	trace_end(489, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(489, t0);
+		capture_u32((GLuint) first);
+		capture_u32((GLuint) count);
+		capture_data(v, count * 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height)
+{
+	double t0 = now();
+
+	real.gl.ScissorIndexed(index, left, bottom, width, height);
+	trace_end(490, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(490, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) left);
+		capture_u32((GLuint) bottom);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ScissorIndexedv(GLuint index, const GLint *v)
+{
+	double t0 = now();
+
+	real.gl.ScissorIndexedv(index, v);
+	trace_end(491, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(491, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryformat, const void *binary, GLsizei length)
+{
+	double t0 = now();
+
+	real.gl.ShaderBinary(count, shaders, binaryformat, binary, length);
+	trace_end(492, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(492, t0);
+		capture_u32((GLuint) count);
+		capture_data(shaders, length);
+		capture_u32((GLuint) binaryformat);
+		capture_data(binary, length);
+		capture_u32((GLuint) length);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length)
+{
+	double t0 = now();
+
+	real.gl.ShaderSource(shader, count, string, length);
+	trace_end(493, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(493, t0);
+		capture_u32((GLuint) shader);
+		capture_u32((GLuint) count);
+		capture_strings(count, string, length);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding)
+{
+	double t0 = now();
+
+	real.gl.ShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+	trace_end(494, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(494, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) storageBlockIndex);
+		capture_u32((GLuint) storageBlockBinding);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_StencilFunc(GLenum func, GLint ref, GLuint mask)
+{
+	double t0 = now();
+
+	real.gl.StencilFunc(func, ref, mask);
+	trace_end(495, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(495, t0);
+		capture_u32((GLuint) func);
+		capture_u32((GLuint) ref);
+		capture_u32((GLuint) mask);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask)
+{
+	double t0 = now();
+
+	real.gl.StencilFuncSeparate(face, func, ref, mask);
+	trace_end(496, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(496, t0);
+		capture_u32((GLuint) face);
+		capture_u32((GLuint) func);
+		capture_u32((GLuint) ref);
+		capture_u32((GLuint) mask);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_StencilMask(GLuint mask)
+{
+	double t0 = now();
+
+	real.gl.StencilMask(mask);
+	trace_end(497, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(497, t0);
+		capture_u32((GLuint) mask);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_StencilMaskSeparate(GLenum face, GLuint mask)
+{
+	double t0 = now();
+
+	real.gl.StencilMaskSeparate(face, mask);
+	trace_end(498, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(498, t0);
+		capture_u32((GLuint) face);
+		capture_u32((GLuint) mask);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_StencilOp(GLenum fail, GLenum zfail, GLenum zpass)
+{
+	double t0 = now();
+
+	real.gl.StencilOp(fail, zfail, zpass);
+	trace_end(499, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(499, t0);
+		capture_u32((GLuint) fail);
+		capture_u32((GLuint) zfail);
+		capture_u32((GLuint) zpass);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_StencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+{
+	double t0 = now();
+
+	real.gl.StencilOpSeparate(face, sfail, dpfail, dppass);
+	trace_end(500, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(500, t0);
+		capture_u32((GLuint) face);
+		capture_u32((GLuint) sfail);
+		capture_u32((GLuint) dpfail);
+		capture_u32((GLuint) dppass);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TexBuffer(GLenum target, GLenum internalformat, GLuint buffer)
+{
+	double t0 = now();
+
+	real.gl.TexBuffer(target, internalformat, buffer);
+	trace_end(501, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(501, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) buffer);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+	double t0 = now();
+
+	real.gl.TexBufferRange(target, internalformat, buffer, offset, size);
+	trace_end(502, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(502, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) buffer);
+		capture_u64((GLuint64) offset);
+		capture_u64((GLuint64) size);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+	double t0 = now();
+
+	real.gl.TexImage1D(target, level, internalformat, width, border, format, type, pixels);
+	trace_end(503, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(503, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) border);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) type);
+		capture_pixels(pixels, capture_image_size(format, type, width, 1, 1));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+	double t0 = now();
+
+	real.gl.TexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+	trace_end(504, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(504, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) border);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) type);
+		capture_pixels(pixels, capture_image_size(format, type, width, height, 1));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+	double t0 = now();
+
+	real.gl.TexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	trace_end(505, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(505, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) samples);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) fixedsamplelocations);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+	double t0 = now();
+
+	real.gl.TexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+	trace_end(506, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(506, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) depth);
+		capture_u32((GLuint) border);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) type);
+		capture_pixels(pixels, capture_image_size(format, type, width, height, depth));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+	double t0 = now();
+
+	real.gl.TexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	trace_end(507, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(507, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) samples);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) depth);
+		capture_u32((GLuint) fixedsamplelocations);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TexPageCommitmentARB(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean resident)
+{
+	double t0 = now();
+
+	real.gl.TexPageCommitmentARB(target, level, xoffset, yoffset, zoffset, width, height, depth, resident);
+	trace_end(508, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(508, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) xoffset);
+		capture_u32((GLuint) yoffset);
+		capture_u32((GLuint) zoffset);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) depth);
+		capture_u32((GLuint) resident);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TexParameterIiv(GLenum target, GLenum pname, const GLint *params)
+{
+	double t0 = now();
+
+	real.gl.TexParameterIiv(target, pname, params);
+	trace_end(509, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(509, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) pname);
+		capture_data(params, capture_param_size(pname));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TexParameterIuiv(GLenum target, GLenum pname, const GLuint *params)
+{
+	double t0 = now();
+
+	real.gl.TexParameterIuiv(target, pname, params);
+	trace_end(510, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(510, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) pname);
+		capture_data(params, capture_param_size(pname));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TexParameterf(GLenum target, GLenum pname, GLfloat param)
+{
+	double t0 = now();
+
+	real.gl.TexParameterf(target, pname, param);
+	trace_end(511, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(511, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) pname);
+		capture_f32(param);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TexParameterfv(GLenum target, GLenum pname, const GLfloat *params)
+{
+	double t0 = now();
+
+	real.gl.TexParameterfv(target, pname, params);
+	trace_end(512, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(512, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) pname);
+		capture_data(params, capture_param_size(pname));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TexParameteri(GLenum target, GLenum pname, GLint param)
+{
+	double t0 = now();
+
+	real.gl.TexParameteri(target, pname, param);
+	trace_end(513, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(513, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) pname);
+		capture_u32((GLuint) param);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TexParameteriv(GLenum target, GLenum pname, const GLint *params)
+{
+	double t0 = now();
+
+	real.gl.TexParameteriv(target, pname, params);
+	trace_end(514, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(514, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) pname);
+		capture_data(params, capture_param_size(pname));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+	double t0 = now();
+
+	real.gl.TexStorage1D(target, levels, internalformat, width);
+	trace_end(515, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(515, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) levels);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) width);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+	double t0 = now();
+
+	real.gl.TexStorage2D(target, levels, internalformat, width, height);
+	trace_end(516, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(516, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) levels);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+	double t0 = now();
+
+	real.gl.TexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	trace_end(517, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(517, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) samples);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) fixedsamplelocations);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+	double t0 = now();
+
+	real.gl.TexStorage3D(target, levels, internalformat, width, height, depth);
+	trace_end(518, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(518, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) levels);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) depth);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+	double t0 = now();
+
+	real.gl.TexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	trace_end(519, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(519, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) samples);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) depth);
+		capture_u32((GLuint) fixedsamplelocations);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+{
+	double t0 = now();
+
+	real.gl.TexSubImage1D(target, level, xoffset, width, format, type, pixels);
+	trace_end(520, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(520, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) xoffset);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) type);
+		capture_pixels(pixels, capture_image_size(format, type, width, 1, 1));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+	double t0 = now();
+
+	real.gl.TexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+	trace_end(521, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(521, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) xoffset);
+		capture_u32((GLuint) yoffset);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) type);
+		capture_pixels(pixels, capture_image_size(format, type, width, height, 1));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+	double t0 = now();
+
+	real.gl.TexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	trace_end(522, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(522, t0);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) xoffset);
+		capture_u32((GLuint) yoffset);
+		capture_u32((GLuint) zoffset);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) depth);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) type);
+		capture_pixels(pixels, capture_image_size(format, type, width, height, depth));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TextureBarrier(void)
+{
+	double t0 = now();
+
+	real.gl.TextureBarrier();
+	trace_end(523, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(523, t0);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer)
+{
+	double t0 = now();
+
+	real.gl.TextureBuffer(texture, internalformat, buffer);
+	trace_end(524, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(524, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) buffer);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+	double t0 = now();
+
+	real.gl.TextureBufferRange(texture, internalformat, buffer, offset, size);
+	trace_end(525, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(525, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) buffer);
+		capture_u64((GLuint64) offset);
+		capture_u64((GLuint64) size);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TextureParameterIiv(GLuint texture, GLenum pname, const GLint *params)
+{
+	double t0 = now();
+
+	real.gl.TextureParameterIiv(texture, pname, params);
+	trace_end(526, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(526, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) pname);
+		capture_data(params, capture_param_size(pname));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TextureParameterIuiv(GLuint texture, GLenum pname, const GLuint *params)
+{
+	double t0 = now();
+
+	real.gl.TextureParameterIuiv(texture, pname, params);
+	trace_end(527, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(527, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) pname);
+		capture_data(params, capture_param_size(pname));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TextureParameterf(GLuint texture, GLenum pname, GLfloat param)
+{
+	double t0 = now();
+
+	real.gl.TextureParameterf(texture, pname, param);
+	trace_end(528, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(528, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) pname);
+		capture_f32(param);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TextureParameterfv(GLuint texture, GLenum pname, const GLfloat *param)
+{
+	double t0 = now();
+
+	real.gl.TextureParameterfv(texture, pname, param);
+	trace_end(529, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(529, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) pname);
+		capture_data(param, capture_param_size(pname));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TextureParameteri(GLuint texture, GLenum pname, GLint param)
+{
+	double t0 = now();
+
+	real.gl.TextureParameteri(texture, pname, param);
+	trace_end(530, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(530, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) pname);
+		capture_u32((GLuint) param);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TextureParameteriv(GLuint texture, GLenum pname, const GLint *param)
+{
+	double t0 = now();
+
+	real.gl.TextureParameteriv(texture, pname, param);
+	trace_end(531, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(531, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) pname);
+		capture_data(param, capture_param_size(pname));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+	double t0 = now();
+
+	real.gl.TextureStorage1D(texture, levels, internalformat, width);
+	trace_end(532, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(532, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) levels);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) width);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+	double t0 = now();
+
+	real.gl.TextureStorage2D(texture, levels, internalformat, width, height);
+	trace_end(533, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(533, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) levels);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+	double t0 = now();
+
+	real.gl.TextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+	trace_end(534, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(534, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) samples);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) fixedsamplelocations);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+	double t0 = now();
+
+	real.gl.TextureStorage3D(texture, levels, internalformat, width, height, depth);
+	trace_end(535, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(535, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) levels);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) depth);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+	double t0 = now();
+
+	real.gl.TextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+	trace_end(536, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(536, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) samples);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) depth);
+		capture_u32((GLuint) fixedsamplelocations);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+{
+	double t0 = now();
+
+	real.gl.TextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+	trace_end(537, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(537, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) xoffset);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) type);
+		capture_pixels(pixels, capture_image_size(format, type, width, 1, 1));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+	double t0 = now();
+
+	real.gl.TextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+	trace_end(538, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(538, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) xoffset);
+		capture_u32((GLuint) yoffset);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) type);
+		capture_pixels(pixels, capture_image_size(format, type, width, height, 1));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+	double t0 = now();
+
+	real.gl.TextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	trace_end(539, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(539, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) level);
+		capture_u32((GLuint) xoffset);
+		capture_u32((GLuint) yoffset);
+		capture_u32((GLuint) zoffset);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_u32((GLuint) depth);
+		capture_u32((GLuint) format);
+		capture_u32((GLuint) type);
+		capture_pixels(pixels, capture_image_size(format, type, width, height, depth));
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers)
+{
+	double t0 = now();
+
+	real.gl.TextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+	trace_end(540, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(540, t0);
+		capture_u32((GLuint) texture);
+		capture_u32((GLuint) target);
+		capture_u32((GLuint) origtexture);
+		capture_u32((GLuint) internalformat);
+		capture_u32((GLuint) minlevel);
+		capture_u32((GLuint) numlevels);
+		capture_u32((GLuint) minlayer);
+		capture_u32((GLuint) numlayers);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer)
+{
+	double t0 = now();
+
+	real.gl.TransformFeedbackBufferBase(xfb, index, buffer);
+	trace_end(541, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(541, t0);
+		capture_u32((GLuint) xfb);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) buffer);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+	double t0 = now();
+
+	real.gl.TransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+	trace_end(542, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(542, t0);
+		capture_u32((GLuint) xfb);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) buffer);
+		capture_u64((GLuint64) offset);
+		capture_u64((GLuint64) size);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_TransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode)
+{
+	double t0 = now();
+
+	real.gl.TransformFeedbackVaryings(program, count, varyings, bufferMode);
+	trace_end(543, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(543, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) count);
+		capture_strings(count, varyings, NULL);
+		capture_u32((GLuint) bufferMode);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform1d(GLint location, GLdouble x)
+{
+	double t0 = now();
+
+	real.gl.Uniform1d(location, x);
+	trace_end(544, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(544, t0);
+		capture_u32((GLuint) location);
+		capture_f64(x);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform1dv(GLint location, GLsizei count, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.Uniform1dv(location, count, value);
+	trace_end(545, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(545, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform1f(GLint location, GLfloat v0)
+{
+	double t0 = now();
+
+	real.gl.Uniform1f(location, v0);
+	trace_end(546, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(546, t0);
+		capture_u32((GLuint) location);
+		capture_f32(v0);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform1fv(GLint location, GLsizei count, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.Uniform1fv(location, count, value);
+	trace_end(547, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(547, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform1i(GLint location, GLint v0)
+{
+	double t0 = now();
+
+	real.gl.Uniform1i(location, v0);
+	trace_end(548, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(548, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) v0);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform1iv(GLint location, GLsizei count, const GLint *value)
+{
+	double t0 = now();
+
+	real.gl.Uniform1iv(location, count, value);
+	trace_end(549, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(549, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform1ui(GLint location, GLuint v0)
+{
+	double t0 = now();
+
+	real.gl.Uniform1ui(location, v0);
+	trace_end(550, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(550, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) v0);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform1uiv(GLint location, GLsizei count, const GLuint *value)
+{
+	double t0 = now();
+
+	real.gl.Uniform1uiv(location, count, value);
+	trace_end(551, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(551, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform2d(GLint location, GLdouble x, GLdouble y)
+{
+	double t0 = now();
+
+	real.gl.Uniform2d(location, x, y);
+	trace_end(552, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(552, t0);
+		capture_u32((GLuint) location);
+		capture_f64(x);
+		capture_f64(y);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform2dv(GLint location, GLsizei count, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.Uniform2dv(location, count, value);
+	trace_end(553, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(553, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform2f(GLint location, GLfloat v0, GLfloat v1)
+{
+	double t0 = now();
+
+	real.gl.Uniform2f(location, v0, v1);
+	trace_end(554, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(554, t0);
+		capture_u32((GLuint) location);
+		capture_f32(v0);
+		capture_f32(v1);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform2fv(GLint location, GLsizei count, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.Uniform2fv(location, count, value);
+	trace_end(555, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(555, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform2i(GLint location, GLint v0, GLint v1)
+{
+	double t0 = now();
+
+	real.gl.Uniform2i(location, v0, v1);
+	trace_end(556, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(556, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) v0);
+		capture_u32((GLuint) v1);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform2iv(GLint location, GLsizei count, const GLint *value)
+{
+	double t0 = now();
+
+	real.gl.Uniform2iv(location, count, value);
+	trace_end(557, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(557, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform2ui(GLint location, GLuint v0, GLuint v1)
+{
+	double t0 = now();
+
+	real.gl.Uniform2ui(location, v0, v1);
+	trace_end(558, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(558, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) v0);
+		capture_u32((GLuint) v1);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform2uiv(GLint location, GLsizei count, const GLuint *value)
+{
+	double t0 = now();
+
+	real.gl.Uniform2uiv(location, count, value);
+	trace_end(559, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(559, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z)
+{
+	double t0 = now();
+
+	real.gl.Uniform3d(location, x, y, z);
+	trace_end(560, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(560, t0);
+		capture_u32((GLuint) location);
+		capture_f64(x);
+		capture_f64(y);
+		capture_f64(z);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform3dv(GLint location, GLsizei count, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.Uniform3dv(location, count, value);
+	trace_end(561, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(561, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 24);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+	double t0 = now();
+
+	real.gl.Uniform3f(location, v0, v1, v2);
+	trace_end(562, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(562, t0);
+		capture_u32((GLuint) location);
+		capture_f32(v0);
+		capture_f32(v1);
+		capture_f32(v2);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform3fv(GLint location, GLsizei count, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.Uniform3fv(location, count, value);
+	trace_end(563, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(563, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 12);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform3i(GLint location, GLint v0, GLint v1, GLint v2)
+{
+	double t0 = now();
+
+	real.gl.Uniform3i(location, v0, v1, v2);
+	trace_end(564, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(564, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) v0);
+		capture_u32((GLuint) v1);
+		capture_u32((GLuint) v2);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform3iv(GLint location, GLsizei count, const GLint *value)
+{
+	double t0 = now();
+
+	real.gl.Uniform3iv(location, count, value);
+	trace_end(565, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(565, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 12);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+	double t0 = now();
+
+	real.gl.Uniform3ui(location, v0, v1, v2);
+	trace_end(566, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(566, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) v0);
+		capture_u32((GLuint) v1);
+		capture_u32((GLuint) v2);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform3uiv(GLint location, GLsizei count, const GLuint *value)
+{
+	double t0 = now();
+
+	real.gl.Uniform3uiv(location, count, value);
+	trace_end(567, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(567, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 12);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+	double t0 = now();
+
+	real.gl.Uniform4d(location, x, y, z, w);
+	trace_end(568, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(568, t0);
+		capture_u32((GLuint) location);
+		capture_f64(x);
+		capture_f64(y);
+		capture_f64(z);
+		capture_f64(w);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform4dv(GLint location, GLsizei count, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.Uniform4dv(location, count, value);
+	trace_end(569, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(569, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 32);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+	double t0 = now();
+
+	real.gl.Uniform4f(location, v0, v1, v2, v3);
+	trace_end(570, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(570, t0);
+		capture_u32((GLuint) location);
+		capture_f32(v0);
+		capture_f32(v1);
+		capture_f32(v2);
+		capture_f32(v3);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform4fv(GLint location, GLsizei count, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.Uniform4fv(location, count, value);
+	trace_end(571, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(571, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+	double t0 = now();
+
+	real.gl.Uniform4i(location, v0, v1, v2, v3);
+	trace_end(572, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(572, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) v0);
+		capture_u32((GLuint) v1);
+		capture_u32((GLuint) v2);
+		capture_u32((GLuint) v3);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform4iv(GLint location, GLsizei count, const GLint *value)
+{
+	double t0 = now();
+
+	real.gl.Uniform4iv(location, count, value);
+	trace_end(573, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(573, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+	double t0 = now();
+
+	real.gl.Uniform4ui(location, v0, v1, v2, v3);
+	trace_end(574, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(574, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) v0);
+		capture_u32((GLuint) v1);
+		capture_u32((GLuint) v2);
+		capture_u32((GLuint) v3);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Uniform4uiv(GLint location, GLsizei count, const GLuint *value)
+{
+	double t0 = now();
+
+	real.gl.Uniform4uiv(location, count, value);
+	trace_end(575, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(575, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_UniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
+{
+	double t0 = now();
+
+	real.gl.UniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+	trace_end(576, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(576, t0);
+		capture_u32((GLuint) program);
+		capture_u32((GLuint) uniformBlockIndex);
+		capture_u32((GLuint) uniformBlockBinding);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_UniformHandleui64ARB(GLint location, GLuint64 value)
+{
+	double t0 = now();
+
+	real.gl.UniformHandleui64ARB(location, value);
+	trace_end(577, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(577, t0);
+		capture_u32((GLuint) location);
+		capture_u64((GLuint64) value);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_UniformHandleui64vARB(GLint location, GLsizei count, const GLuint64 *value)
+{
+	double t0 = now();
+
+	real.gl.UniformHandleui64vARB(location, count, value);
+	trace_end(578, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(578, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_data(value, count * 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_UniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.UniformMatrix2dv(location, count, transpose, value);
+	trace_end(579, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(579, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 32);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_UniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.UniformMatrix2fv(location, count, transpose, value);
+	trace_end(580, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(580, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_UniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.UniformMatrix2x3dv(location, count, transpose, value);
+	trace_end(581, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(581, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 48);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_UniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.UniformMatrix2x3fv(location, count, transpose, value);
+	trace_end(582, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(582, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 24);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_UniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.UniformMatrix2x4dv(location, count, transpose, value);
+	trace_end(583, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(583, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 64);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_UniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.UniformMatrix2x4fv(location, count, transpose, value);
+	trace_end(584, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(584, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 32);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_UniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.UniformMatrix3dv(location, count, transpose, value);
+	trace_end(585, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(585, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 72);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_UniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.UniformMatrix3fv(location, count, transpose, value);
+	trace_end(586, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(586, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 36);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_UniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.UniformMatrix3x2dv(location, count, transpose, value);
+	trace_end(587, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(587, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 48);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_UniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.UniformMatrix3x2fv(location, count, transpose, value);
+	trace_end(588, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(588, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 24);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_UniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.UniformMatrix3x4dv(location, count, transpose, value);
+	trace_end(589, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(589, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 96);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_UniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.UniformMatrix3x4fv(location, count, transpose, value);
+	trace_end(590, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(590, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 48);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_UniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.UniformMatrix4dv(location, count, transpose, value);
+	trace_end(591, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(591, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 128);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_UniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.UniformMatrix4fv(location, count, transpose, value);
+	trace_end(592, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(592, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 64);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_UniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.UniformMatrix4x2dv(location, count, transpose, value);
+	trace_end(593, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(593, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 64);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_UniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.UniformMatrix4x2fv(location, count, transpose, value);
+	trace_end(594, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(594, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 32);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_UniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+	double t0 = now();
+
+	real.gl.UniformMatrix4x3dv(location, count, transpose, value);
+	trace_end(595, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(595, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 96);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_UniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	double t0 = now();
+
+	real.gl.UniformMatrix4x3fv(location, count, transpose, value);
+	trace_end(596, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(596, t0);
+		capture_u32((GLuint) location);
+		capture_u32((GLuint) count);
+		capture_u32((GLuint) transpose);
+		capture_data(value, count * 48);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_UniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices)
+{
+	double t0 = now();
+
+	real.gl.UniformSubroutinesuiv(shadertype, count, indices);
+	trace_end(597, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(597, t0);
+		capture_u32((GLuint) shadertype);
+		capture_u32((GLuint) count);
+		capture_data(indices, count * 4);
+		capture_end();
+	}
+}
+
+static GLboolean APIENTRY trace_UnmapBuffer(GLenum target)
+{
+	GLboolean res;
+	double t0 = now();
+
+	if (trace_mode & GL3W_TRACE_CAPTURE)
+		capture_unmap(0, target, 0, -1);
+	res = real.gl.UnmapBuffer(target);
+	trace_end(598, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(598, t0);
+		capture_u32((GLuint) target);
+		capture_end();
+	}
+	return res;
+}
+
+static GLboolean APIENTRY trace_UnmapNamedBuffer(GLuint buffer)
+{
+	GLboolean res;
+	double t0 = now();
+
+	if (trace_mode & GL3W_TRACE_CAPTURE)
+		capture_unmap(1, buffer, 0, -1);
+	res = real.gl.UnmapNamedBuffer(buffer);
+	trace_end(599, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(599, t0);
+		capture_u32((GLuint) buffer);
+		capture_end();
+	}
+	return res;
+}
+
+static void APIENTRY trace_UseProgram(GLuint program)
+{
+	double t0 = now();
+
+	real.gl.UseProgram(program);
+	trace_end(600, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(600, t0);
+		capture_u32((GLuint) program);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_UseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program)
+{
+	double t0 = now();
+
+	real.gl.UseProgramStages(pipeline, stages, program);
+	trace_end(601, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(601, t0);
+		capture_u32((GLuint) pipeline);
+		capture_u32((GLuint) stages);
+		capture_u32((GLuint) program);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ValidateProgram(GLuint program)
+{
+	double t0 = now();
+
+	real.gl.ValidateProgram(program);
+	trace_end(602, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(602, t0);
+		capture_u32((GLuint) program);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ValidateProgramPipeline(GLuint pipeline)
+{
+	double t0 = now();
+
+	real.gl.ValidateProgramPipeline(pipeline);
+	trace_end(603, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(603, t0);
+		capture_u32((GLuint) pipeline);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex)
+{
+	double t0 = now();
+
+	real.gl.VertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+	trace_end(604, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(604, t0);
+		capture_u32((GLuint) vaobj);
+		capture_u32((GLuint) attribindex);
+		capture_u32((GLuint) bindingindex);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+	double t0 = now();
+
+	real.gl.VertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+	trace_end(605, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(605, t0);
+		capture_u32((GLuint) vaobj);
+		capture_u32((GLuint) attribindex);
+		capture_u32((GLuint) size);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) normalized);
+		capture_u32((GLuint) relativeoffset);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+	double t0 = now();
+
+	real.gl.VertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+	trace_end(606, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(606, t0);
+		capture_u32((GLuint) vaobj);
+		capture_u32((GLuint) attribindex);
+		capture_u32((GLuint) size);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) relativeoffset);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+	double t0 = now();
+
+	real.gl.VertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+	trace_end(607, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(607, t0);
+		capture_u32((GLuint) vaobj);
+		capture_u32((GLuint) attribindex);
+		capture_u32((GLuint) size);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) relativeoffset);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor)
+{
+	double t0 = now();
+
+	real.gl.VertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+	trace_end(608, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(608, t0);
+		capture_u32((GLuint) vaobj);
+		capture_u32((GLuint) bindingindex);
+		capture_u32((GLuint) divisor);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexArrayElementBuffer(GLuint vaobj, GLuint buffer)
+{
+	double t0 = now();
+
+	real.gl.VertexArrayElementBuffer(vaobj, buffer);
+	trace_end(609, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(609, t0);
+		capture_u32((GLuint) vaobj);
+		capture_u32((GLuint) buffer);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+	double t0 = now();
+
+	real.gl.VertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+	trace_end(610, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(610, t0);
+		capture_u32((GLuint) vaobj);
+		capture_u32((GLuint) bindingindex);
+		capture_u32((GLuint) buffer);
+		capture_u64((GLuint64) offset);
+		capture_u32((GLuint) stride);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides)
+{
+	double t0 = now();
+
+	real.gl.VertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+	trace_end(611, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(611, t0);
+		capture_u32((GLuint) vaobj);
+		capture_u32((GLuint) first);
+		capture_u32((GLuint) count);
+		capture_data(buffers, count * 4);
+		capture_data(offsets, count * 8);
+		capture_data(strides, count * 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib1d(GLuint index, GLdouble x)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib1d(index, x);
+	trace_end(612, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(612, t0);
+		capture_u32((GLuint) index);
+		capture_f64(x);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib1dv(GLuint index, const GLdouble *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib1dv(index, v);
+	trace_end(613, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(613, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib1f(GLuint index, GLfloat x)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib1f(index, x);
+	trace_end(614, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(614, t0);
+		capture_u32((GLuint) index);
+		capture_f32(x);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib1fv(GLuint index, const GLfloat *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib1fv(index, v);
+	trace_end(615, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(615, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib1s(GLuint index, GLshort x)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib1s(index, x);
+	trace_end(616, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(616, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) x);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib1sv(GLuint index, const GLshort *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib1sv(index, v);
+	trace_end(617, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(617, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 2);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib2d(GLuint index, GLdouble x, GLdouble y)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib2d(index, x, y);
+	trace_end(618, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(618, t0);
+		capture_u32((GLuint) index);
+		capture_f64(x);
+		capture_f64(y);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib2dv(GLuint index, const GLdouble *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib2dv(index, v);
+	trace_end(619, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(619, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib2f(index, x, y);
+	trace_end(620, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(620, t0);
+		capture_u32((GLuint) index);
+		capture_f32(x);
+		capture_f32(y);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib2fv(GLuint index, const GLfloat *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib2fv(index, v);
+	trace_end(621, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(621, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib2s(GLuint index, GLshort x, GLshort y)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib2s(index, x, y);
+	trace_end(622, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(622, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib2sv(GLuint index, const GLshort *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib2sv(index, v);
+	trace_end(623, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(623, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib3d(index, x, y, z);
+	trace_end(624, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(624, t0);
+		capture_u32((GLuint) index);
+		capture_f64(x);
+		capture_f64(y);
+		capture_f64(z);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib3dv(GLuint index, const GLdouble *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib3dv(index, v);
+	trace_end(625, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(625, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 24);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib3f(index, x, y, z);
+	trace_end(626, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(626, t0);
+		capture_u32((GLuint) index);
+		capture_f32(x);
+		capture_f32(y);
+		capture_f32(z);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib3fv(GLuint index, const GLfloat *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib3fv(index, v);
+	trace_end(627, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(627, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 12);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib3s(index, x, y, z);
+	trace_end(628, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(628, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_u32((GLuint) z);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib3sv(GLuint index, const GLshort *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib3sv(index, v);
+	trace_end(629, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(629, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 6);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib4Nbv(GLuint index, const GLbyte *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib4Nbv(index, v);
+	trace_end(630, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(630, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib4Niv(GLuint index, const GLint *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib4Niv(index, v);
+	trace_end(631, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(631, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib4Nsv(GLuint index, const GLshort *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib4Nsv(index, v);
+	trace_end(632, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(632, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib4Nub(index, x, y, z, w);
+	trace_end(633, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(633, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_u32((GLuint) z);
+		capture_u32((GLuint) w);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib4Nubv(GLuint index, const GLubyte *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib4Nubv(index, v);
+	trace_end(634, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(634, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib4Nuiv(GLuint index, const GLuint *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib4Nuiv(index, v);
+	trace_end(635, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(635, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib4Nusv(GLuint index, const GLushort *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib4Nusv(index, v);
+	trace_end(636, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(636, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib4bv(GLuint index, const GLbyte *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib4bv(index, v);
+	trace_end(637, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(637, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib4d(index, x, y, z, w);
+	trace_end(638, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(638, t0);
+		capture_u32((GLuint) index);
+		capture_f64(x);
+		capture_f64(y);
+		capture_f64(z);
+		capture_f64(w);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib4dv(GLuint index, const GLdouble *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib4dv(index, v);
+	trace_end(639, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(639, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 32);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib4f(index, x, y, z, w);
+	trace_end(640, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(640, t0);
+		capture_u32((GLuint) index);
+		capture_f32(x);
+		capture_f32(y);
+		capture_f32(z);
+		capture_f32(w);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib4fv(GLuint index, const GLfloat *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib4fv(index, v);
+	trace_end(641, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(641, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib4iv(GLuint index, const GLint *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib4iv(index, v);
+	trace_end(642, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(642, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib4s(index, x, y, z, w);
+	trace_end(643, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(643, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_u32((GLuint) z);
+		capture_u32((GLuint) w);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib4sv(GLuint index, const GLshort *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib4sv(index, v);
+	trace_end(644, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(644, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib4ubv(GLuint index, const GLubyte *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib4ubv(index, v);
+	trace_end(645, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(645, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib4uiv(GLuint index, const GLuint *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib4uiv(index, v);
+	trace_end(646, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(646, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttrib4usv(GLuint index, const GLushort *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttrib4usv(index, v);
+	trace_end(647, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(647, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribBinding(GLuint attribindex, GLuint bindingindex)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribBinding(attribindex, bindingindex);
+	trace_end(648, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(648, t0);
+		capture_u32((GLuint) attribindex);
+		capture_u32((GLuint) bindingindex);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribDivisor(GLuint index, GLuint divisor)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribDivisor(index, divisor);
+	trace_end(649, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(649, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) divisor);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+	trace_end(650, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(650, t0);
+		capture_u32((GLuint) attribindex);
+		capture_u32((GLuint) size);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) normalized);
+		capture_u32((GLuint) relativeoffset);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribI1i(GLuint index, GLint x)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribI1i(index, x);
+	trace_end(651, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(651, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) x);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribI1iv(GLuint index, const GLint *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribI1iv(index, v);
+	trace_end(652, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(652, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribI1ui(GLuint index, GLuint x)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribI1ui(index, x);
+	trace_end(653, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(653, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) x);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribI1uiv(GLuint index, const GLuint *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribI1uiv(index, v);
+	trace_end(654, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(654, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribI2i(GLuint index, GLint x, GLint y)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribI2i(index, x, y);
+	trace_end(655, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(655, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribI2iv(GLuint index, const GLint *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribI2iv(index, v);
+	trace_end(656, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(656, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribI2ui(GLuint index, GLuint x, GLuint y)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribI2ui(index, x, y);
+	trace_end(657, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(657, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribI2uiv(GLuint index, const GLuint *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribI2uiv(index, v);
+	trace_end(658, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(658, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribI3i(GLuint index, GLint x, GLint y, GLint z)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribI3i(index, x, y, z);
+	trace_end(659, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(659, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_u32((GLuint) z);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribI3iv(GLuint index, const GLint *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribI3iv(index, v);
+	trace_end(660, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(660, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 12);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribI3ui(index, x, y, z);
+	trace_end(661, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(661, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_u32((GLuint) z);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribI3uiv(GLuint index, const GLuint *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribI3uiv(index, v);
+	trace_end(662, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(662, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 12);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribI4bv(GLuint index, const GLbyte *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribI4bv(index, v);
+	trace_end(663, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(663, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribI4i(index, x, y, z, w);
+	trace_end(664, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(664, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_u32((GLuint) z);
+		capture_u32((GLuint) w);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribI4iv(GLuint index, const GLint *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribI4iv(index, v);
+	trace_end(665, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(665, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribI4sv(GLuint index, const GLshort *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribI4sv(index, v);
+	trace_end(666, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(666, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribI4ubv(GLuint index, const GLubyte *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribI4ubv(index, v);
+	trace_end(667, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(667, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribI4ui(index, x, y, z, w);
+	trace_end(668, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(668, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_u32((GLuint) z);
+		capture_u32((GLuint) w);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribI4uiv(GLuint index, const GLuint *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribI4uiv(index, v);
+	trace_end(669, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(669, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribI4usv(GLuint index, const GLushort *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribI4usv(index, v);
+	trace_end(670, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(670, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribIFormat(attribindex, size, type, relativeoffset);
+	trace_end(671, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(671, t0);
+		capture_u32((GLuint) attribindex);
+		capture_u32((GLuint) size);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) relativeoffset);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribIPointer(index, size, type, stride, pointer);
+	trace_end(672, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(672, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) size);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) stride);
+		capture_u64((GLuint64) (size_t) pointer);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribL1d(GLuint index, GLdouble x)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribL1d(index, x);
+	trace_end(673, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(673, t0);
+		capture_u32((GLuint) index);
+		capture_f64(x);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribL1dv(GLuint index, const GLdouble *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribL1dv(index, v);
+	trace_end(674, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(674, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribL1ui64ARB(GLuint index, GLuint64EXT x)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribL1ui64ARB(index, x);
+	trace_end(675, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(675, t0);
+		capture_u32((GLuint) index);
+		capture_u64((GLuint64) x);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribL1ui64vARB(GLuint index, const GLuint64EXT *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribL1ui64vARB(index, v);
+	trace_end(676, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(676, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 8);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribL2d(GLuint index, GLdouble x, GLdouble y)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribL2d(index, x, y);
+	trace_end(677, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(677, t0);
+		capture_u32((GLuint) index);
+		capture_f64(x);
+		capture_f64(y);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribL2dv(GLuint index, const GLdouble *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribL2dv(index, v);
+	trace_end(678, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(678, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribL3d(index, x, y, z);
+	trace_end(679, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(679, t0);
+		capture_u32((GLuint) index);
+		capture_f64(x);
+		capture_f64(y);
+		capture_f64(z);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribL3dv(GLuint index, const GLdouble *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribL3dv(index, v);
+	trace_end(680, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(680, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 24);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribL4d(index, x, y, z, w);
+	trace_end(681, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(681, t0);
+		capture_u32((GLuint) index);
+		capture_f64(x);
+		capture_f64(y);
+		capture_f64(z);
+		capture_f64(w);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribL4dv(GLuint index, const GLdouble *v)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribL4dv(index, v);
+	trace_end(682, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(682, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 32);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribLFormat(attribindex, size, type, relativeoffset);
+	trace_end(683, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(683, t0);
+		capture_u32((GLuint) attribindex);
+		capture_u32((GLuint) size);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) relativeoffset);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribLPointer(index, size, type, stride, pointer);
+	trace_end(684, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(684, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) size);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) stride);
+		capture_u64((GLuint64) (size_t) pointer);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribP1ui(index, type, normalized, value);
+	trace_end(685, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(685, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) normalized);
+		capture_u32((GLuint) value);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribP1uiv(index, type, normalized, value);
+	trace_end(686, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(686, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) normalized);
+		capture_data(value, 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribP2ui(index, type, normalized, value);
+	trace_end(687, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(687, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) normalized);
+		capture_u32((GLuint) value);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribP2uiv(index, type, normalized, value);
+	trace_end(688, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(688, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) normalized);
+		capture_data(value, 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribP3ui(index, type, normalized, value);
+	trace_end(689, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(689, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) normalized);
+		capture_u32((GLuint) value);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribP3uiv(index, type, normalized, value);
+	trace_end(690, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(690, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) normalized);
+		capture_data(value, 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribP4ui(index, type, normalized, value);
+	trace_end(691, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(691, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) normalized);
+		capture_u32((GLuint) value);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribP4uiv(index, type, normalized, value);
+	trace_end(692, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(692, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) normalized);
+		capture_data(value, 4);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer)
+{
+	double t0 = now();
+
+	real.gl.VertexAttribPointer(index, size, type, normalized, stride, pointer);
+	trace_end(693, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(693, t0);
+		capture_u32((GLuint) index);
+		capture_u32((GLuint) size);
+		capture_u32((GLuint) type);
+		capture_u32((GLuint) normalized);
+		capture_u32((GLuint) stride);
+		capture_u64((GLuint64) (size_t) pointer);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_VertexBindingDivisor(GLuint bindingindex, GLuint divisor)
+{
+	double t0 = now();
+
+	real.gl.VertexBindingDivisor(bindingindex, divisor);
+	trace_end(694, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(694, t0);
+		capture_u32((GLuint) bindingindex);
+		capture_u32((GLuint) divisor);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	double t0 = now();
+
+	real.gl.Viewport(x, y, width, height);
+	trace_end(695, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(695, t0);
+		capture_u32((GLuint) x);
+		capture_u32((GLuint) y);
+		capture_u32((GLuint) width);
+		capture_u32((GLuint) height);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ViewportArrayv(GLuint first, GLsizei count, const GLfloat *v)
+{
+	double t0 = now();
+
+	real.gl.ViewportArrayv(first, count, v);
+	trace_end(696, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(696, t0);
+		capture_u32((GLuint) first);
+		capture_u32((GLuint) count);
+		capture_data(v, count * 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h)
+{
+	double t0 = now();
+
+	real.gl.ViewportIndexedf(index, x, y, w, h);
+	trace_end(697, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(697, t0);
+		capture_u32((GLuint) index);
+		capture_f32(x);
+		capture_f32(y);
+		capture_f32(w);
+		capture_f32(h);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_ViewportIndexedfv(GLuint index, const GLfloat *v)
+{
+	double t0 = now();
+
+	real.gl.ViewportIndexedfv(index, v);
+	trace_end(698, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(698, t0);
+		capture_u32((GLuint) index);
+		capture_data(v, 16);
+		capture_end();
+	}
+}
+
+static void APIENTRY trace_WaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+	double t0 = now();
+
+	real.gl.WaitSync(sync, flags, timeout);
+	trace_end(699, t0);
+	if (trace_mode & GL3W_TRACE_CAPTURE) {
+		capture_begin(699, t0);
+		capture_u64((GLuint64) (size_t) sync);
+		capture_u32((GLuint) flags);
+		capture_u64((GLuint64) timeout);
+		capture_end();
+	}
+}
+
+static const GL3WglProc trace_procs[GL3W_PROC_COUNT] = {
+	(GL3WglProc) trace_ActiveShaderProgram,
+	(GL3WglProc) trace_ActiveTexture,
+	(GL3WglProc) trace_AttachShader,
+	(GL3WglProc) trace_BeginConditionalRender,
+	(GL3WglProc) trace_BeginQuery,
+	(GL3WglProc) trace_BeginQueryIndexed,
+	(GL3WglProc) trace_BeginTransformFeedback,
+	(GL3WglProc) trace_BindAttribLocation,
+	(GL3WglProc) trace_BindBuffer,
+	(GL3WglProc) trace_BindBufferBase,
+	(GL3WglProc) trace_BindBufferRange,
+	(GL3WglProc) trace_BindBuffersBase,
+	(GL3WglProc) trace_BindBuffersRange,
+	(GL3WglProc) trace_BindFragDataLocation,
+	(GL3WglProc) trace_BindFragDataLocationIndexed,
+	(GL3WglProc) trace_BindFramebuffer,
+	(GL3WglProc) trace_BindImageTexture,
+	(GL3WglProc) trace_BindImageTextures,
+	(GL3WglProc) trace_BindProgramPipeline,
+	(GL3WglProc) trace_BindRenderbuffer,
+	(GL3WglProc) trace_BindSampler,
+	(GL3WglProc) trace_BindSamplers,
+	(GL3WglProc) trace_BindTexture,
+	(GL3WglProc) trace_BindTextureUnit,
+	(GL3WglProc) trace_BindTextures,
+	(GL3WglProc) trace_BindTransformFeedback,
+	(GL3WglProc) trace_BindVertexArray,
+	(GL3WglProc) trace_BindVertexBuffer,
+	(GL3WglProc) trace_BindVertexBuffers,
+	(GL3WglProc) trace_BlendColor,
+	(GL3WglProc) trace_BlendEquation,
+	(GL3WglProc) trace_BlendEquationSeparate,
+	(GL3WglProc) trace_BlendEquationSeparatei,
+	(GL3WglProc) trace_BlendEquationSeparateiARB,
+	(GL3WglProc) trace_BlendEquationi,
+	(GL3WglProc) trace_BlendEquationiARB,
+	(GL3WglProc) trace_BlendFunc,
+	(GL3WglProc) trace_BlendFuncSeparate,
+	(GL3WglProc) trace_BlendFuncSeparatei,
+	(GL3WglProc) trace_BlendFuncSeparateiARB,
+	(GL3WglProc) trace_BlendFunci,
+	(GL3WglProc) trace_BlendFunciARB,
+	(GL3WglProc) trace_BlitFramebuffer,
+	(GL3WglProc) trace_BlitNamedFramebuffer,
+	(GL3WglProc) trace_BufferData,
+	(GL3WglProc) trace_BufferPageCommitmentARB,
+	(GL3WglProc) trace_BufferStorage,
+	(GL3WglProc) trace_BufferSubData,
+	(GL3WglProc) trace_CheckFramebufferStatus,
+	(GL3WglProc) trace_CheckNamedFramebufferStatus,
+	(GL3WglProc) trace_ClampColor,
+	(GL3WglProc) trace_Clear,
+	(GL3WglProc) trace_ClearBufferData,
+	(GL3WglProc) trace_ClearBufferSubData,
+	(GL3WglProc) trace_ClearBufferfi,
+	(GL3WglProc) trace_ClearBufferfv,
+	(GL3WglProc) trace_ClearBufferiv,
+	(GL3WglProc) trace_ClearBufferuiv,
+	(GL3WglProc) trace_ClearColor,
+	(GL3WglProc) trace_ClearDepth,
+	(GL3WglProc) trace_ClearDepthf,
+	(GL3WglProc) trace_ClearNamedBufferData,
+	(GL3WglProc) trace_ClearNamedBufferSubData,
+	(GL3WglProc) trace_ClearNamedFramebufferfi,
+	(GL3WglProc) trace_ClearNamedFramebufferfv,
+	(GL3WglProc) trace_ClearNamedFramebufferiv,
+	(GL3WglProc) trace_ClearNamedFramebufferuiv,
+	(GL3WglProc) trace_ClearStencil,
+	(GL3WglProc) trace_ClearTexImage,
+	(GL3WglProc) trace_ClearTexSubImage,
+	(GL3WglProc) trace_ClientWaitSync,
+	(GL3WglProc) trace_ClipControl,
+	(GL3WglProc) trace_ColorMask,
+	(GL3WglProc) trace_ColorMaski,
+	(GL3WglProc) trace_CompileShader,
+	(GL3WglProc) trace_CompileShaderIncludeARB,
+	(GL3WglProc) trace_CompressedTexImage1D,
+	(GL3WglProc) trace_CompressedTexImage2D,
+	(GL3WglProc) trace_CompressedTexImage3D,
+	(GL3WglProc) trace_CompressedTexSubImage1D,
+	(GL3WglProc) trace_CompressedTexSubImage2D,
+	(GL3WglProc) trace_CompressedTexSubImage3D,
+	(GL3WglProc) trace_CompressedTextureSubImage1D,
+	(GL3WglProc) trace_CompressedTextureSubImage2D,
+	(GL3WglProc) trace_CompressedTextureSubImage3D,
+	(GL3WglProc) trace_CopyBufferSubData,
+	(GL3WglProc) trace_CopyImageSubData,
+	(GL3WglProc) trace_CopyNamedBufferSubData,
+	(GL3WglProc) trace_CopyTexImage1D,
+	(GL3WglProc) trace_CopyTexImage2D,
+	(GL3WglProc) trace_CopyTexSubImage1D,
+	(GL3WglProc) trace_CopyTexSubImage2D,
+	(GL3WglProc) trace_CopyTexSubImage3D,
+	(GL3WglProc) trace_CopyTextureSubImage1D,
+	(GL3WglProc) trace_CopyTextureSubImage2D,
+	(GL3WglProc) trace_CopyTextureSubImage3D,
+	(GL3WglProc) trace_CreateBuffers,
+	(GL3WglProc) trace_CreateFramebuffers,
+	(GL3WglProc) trace_CreateProgram,
+	(GL3WglProc) trace_CreateProgramPipelines,
+	(GL3WglProc) trace_CreateQueries,
+	(GL3WglProc) trace_CreateRenderbuffers,
+	(GL3WglProc) trace_CreateSamplers,
+	(GL3WglProc) trace_CreateShader,
+	(GL3WglProc) trace_CreateShaderProgramv,
+	(GL3WglProc) trace_CreateSyncFromCLeventARB,
+	(GL3WglProc) trace_CreateTextures,
+	(GL3WglProc) trace_CreateTransformFeedbacks,
+	(GL3WglProc) trace_CreateVertexArrays,
+	(GL3WglProc) trace_CullFace,
+	(GL3WglProc) trace_DebugMessageCallback,
+	(GL3WglProc) trace_DebugMessageCallbackARB,
+	(GL3WglProc) trace_DebugMessageControl,
+	(GL3WglProc) trace_DebugMessageControlARB,
+	(GL3WglProc) trace_DebugMessageInsert,
+	(GL3WglProc) trace_DebugMessageInsertARB,
+	(GL3WglProc) trace_DeleteBuffers,
+	(GL3WglProc) trace_DeleteFramebuffers,
+	(GL3WglProc) trace_DeleteNamedStringARB,
+	(GL3WglProc) trace_DeleteProgram,
+	(GL3WglProc) trace_DeleteProgramPipelines,
+	(GL3WglProc) trace_DeleteQueries,
+	(GL3WglProc) trace_DeleteRenderbuffers,
+	(GL3WglProc) trace_DeleteSamplers,
+	(GL3WglProc) trace_DeleteShader,
+	(GL3WglProc) trace_DeleteSync,
+	(GL3WglProc) trace_DeleteTextures,
+	(GL3WglProc) trace_DeleteTransformFeedbacks,
+	(GL3WglProc) trace_DeleteVertexArrays,
+	(GL3WglProc) trace_DepthFunc,
+	(GL3WglProc) trace_DepthMask,
+	(GL3WglProc) trace_DepthRange,
+	(GL3WglProc) trace_DepthRangeArrayv,
+	(GL3WglProc) trace_DepthRangeIndexed,
+	(GL3WglProc) trace_DepthRangef,
+	(GL3WglProc) trace_DetachShader,
+	(GL3WglProc) trace_Disable,
+	(GL3WglProc) trace_DisableVertexArrayAttrib,
+	(GL3WglProc) trace_DisableVertexAttribArray,
+	(GL3WglProc) trace_Disablei,
+	(GL3WglProc) trace_DispatchCompute,
+	(GL3WglProc) trace_DispatchComputeGroupSizeARB,
+	(GL3WglProc) trace_DispatchComputeIndirect,
+	(GL3WglProc) trace_DrawArrays,
+	(GL3WglProc) trace_DrawArraysIndirect,
+	(GL3WglProc) trace_DrawArraysInstanced,
+	(GL3WglProc) trace_DrawArraysInstancedBaseInstance,
+	(GL3WglProc) trace_DrawBuffer,
+	(GL3WglProc) trace_DrawBuffers,
+	(GL3WglProc) trace_DrawElements,
+	(GL3WglProc) trace_DrawElementsBaseVertex,
+	(GL3WglProc) trace_DrawElementsIndirect,
+	(GL3WglProc) trace_DrawElementsInstanced,
+	(GL3WglProc) trace_DrawElementsInstancedBaseInstance,
+	(GL3WglProc) trace_DrawElementsInstancedBaseVertex,
+	(GL3WglProc) trace_DrawElementsInstancedBaseVertexBaseInstance,
+	(GL3WglProc) trace_DrawRangeElements,
+	(GL3WglProc) trace_DrawRangeElementsBaseVertex,
+	(GL3WglProc) trace_DrawTransformFeedback,
+	(GL3WglProc) trace_DrawTransformFeedbackInstanced,
+	(GL3WglProc) trace_DrawTransformFeedbackStream,
+	(GL3WglProc) trace_DrawTransformFeedbackStreamInstanced,
+	(GL3WglProc) trace_Enable,
+	(GL3WglProc) trace_EnableVertexArrayAttrib,
+	(GL3WglProc) trace_EnableVertexAttribArray,
+	(GL3WglProc) trace_Enablei,
+	(GL3WglProc) trace_EndConditionalRender,
+	(GL3WglProc) trace_EndQuery,
+	(GL3WglProc) trace_EndQueryIndexed,
+	(GL3WglProc) trace_EndTransformFeedback,
+	(GL3WglProc) trace_FenceSync,
+	(GL3WglProc) trace_Finish,
+	(GL3WglProc) trace_Flush,
+	(GL3WglProc) trace_FlushMappedBufferRange,
+	(GL3WglProc) trace_FlushMappedNamedBufferRange,
+	(GL3WglProc) trace_FramebufferParameteri,
+	(GL3WglProc) trace_FramebufferRenderbuffer,
+	(GL3WglProc) trace_FramebufferTexture,
+	(GL3WglProc) trace_FramebufferTexture1D,
+	(GL3WglProc) trace_FramebufferTexture2D,
+	(GL3WglProc) trace_FramebufferTexture3D,
+	(GL3WglProc) trace_FramebufferTextureLayer,
+	(GL3WglProc) trace_FrontFace,
+	(GL3WglProc) trace_GenBuffers,
+	(GL3WglProc) trace_GenFramebuffers,
+	(GL3WglProc) trace_GenProgramPipelines,
+	(GL3WglProc) trace_GenQueries,
+	(GL3WglProc) trace_GenRenderbuffers,
+	(GL3WglProc) trace_GenSamplers,
+	(GL3WglProc) trace_GenTextures,
+	(GL3WglProc) trace_GenTransformFeedbacks,
+	(GL3WglProc) trace_GenVertexArrays,
+	(GL3WglProc) trace_GenerateMipmap,
+	(GL3WglProc) trace_GenerateTextureMipmap,
+	(GL3WglProc) trace_GetActiveAtomicCounterBufferiv,
+	(GL3WglProc) trace_GetActiveAttrib,
+	(GL3WglProc) trace_GetActiveSubroutineName,
+	(GL3WglProc) trace_GetActiveSubroutineUniformName,
+	(GL3WglProc) trace_GetActiveSubroutineUniformiv,
+	(GL3WglProc) trace_GetActiveUniform,
+	(GL3WglProc) trace_GetActiveUniformBlockName,
+	(GL3WglProc) trace_GetActiveUniformBlockiv,
+	(GL3WglProc) trace_GetActiveUniformName,
+	(GL3WglProc) trace_GetActiveUniformsiv,
+	(GL3WglProc) trace_GetAttachedShaders,
+	(GL3WglProc) trace_GetAttribLocation,
+	(GL3WglProc) trace_GetBooleani_v,
+	(GL3WglProc) trace_GetBooleanv,
+	(GL3WglProc) trace_GetBufferParameteri64v,
+	(GL3WglProc) trace_GetBufferParameteriv,
+	(GL3WglProc) trace_GetBufferPointerv,
+	(GL3WglProc) trace_GetBufferSubData,
+	(GL3WglProc) trace_GetCompressedTexImage,
+	(GL3WglProc) trace_GetCompressedTextureImage,
+	(GL3WglProc) trace_GetCompressedTextureSubImage,
+	(GL3WglProc) trace_GetDebugMessageLog,
+	(GL3WglProc) trace_GetDebugMessageLogARB,
+	(GL3WglProc) trace_GetDoublei_v,
+	(GL3WglProc) trace_GetDoublev,
+	(GL3WglProc) trace_GetError,
+	(GL3WglProc) trace_GetFloati_v,
+	(GL3WglProc) trace_GetFloatv,
+	(GL3WglProc) trace_GetFragDataIndex,
+	(GL3WglProc) trace_GetFragDataLocation,
+	(GL3WglProc) trace_GetFramebufferAttachmentParameteriv,
+	(GL3WglProc) trace_GetFramebufferParameteriv,
+	(GL3WglProc) trace_GetGraphicsResetStatus,
+	(GL3WglProc) trace_GetGraphicsResetStatusARB,
+	(GL3WglProc) trace_GetImageHandleARB,
+	(GL3WglProc) trace_GetInteger64i_v,
+	(GL3WglProc) trace_GetInteger64v,
+	(GL3WglProc) trace_GetIntegeri_v,
+	(GL3WglProc) trace_GetIntegerv,
+	(GL3WglProc) trace_GetInternalformati64v,
+	(GL3WglProc) trace_GetInternalformativ,
+	(GL3WglProc) trace_GetMultisamplefv,
+	(GL3WglProc) trace_GetNamedBufferParameteri64v,
+	(GL3WglProc) trace_GetNamedBufferParameteriv,
+	(GL3WglProc) trace_GetNamedBufferPointerv,
+	(GL3WglProc) trace_GetNamedBufferSubData,
+	(GL3WglProc) trace_GetNamedFramebufferAttachmentParameteriv,
+	(GL3WglProc) trace_GetNamedFramebufferParameteriv,
+	(GL3WglProc) trace_GetNamedRenderbufferParameteriv,
+	(GL3WglProc) trace_GetNamedStringARB,
+	(GL3WglProc) trace_GetNamedStringivARB,
+	(GL3WglProc) trace_GetObjectLabel,
+	(GL3WglProc) trace_GetObjectPtrLabel,
+	(GL3WglProc) trace_GetPointerv,
+	(GL3WglProc) trace_GetProgramBinary,
+	(GL3WglProc) trace_GetProgramInfoLog,
+	(GL3WglProc) trace_GetProgramInterfaceiv,
+	(GL3WglProc) trace_GetProgramPipelineInfoLog,
+	(GL3WglProc) trace_GetProgramPipelineiv,
+	(GL3WglProc) trace_GetProgramResourceIndex,
+	(GL3WglProc) trace_GetProgramResourceLocation,
+	(GL3WglProc) trace_GetProgramResourceLocationIndex,
+	(GL3WglProc) trace_GetProgramResourceName,
+	(GL3WglProc) trace_GetProgramResourceiv,
+	(GL3WglProc) trace_GetProgramStageiv,
+	(GL3WglProc) trace_GetProgramiv,
+	(GL3WglProc) trace_GetQueryBufferObjecti64v,
+	(GL3WglProc) trace_GetQueryBufferObjectiv,
+	(GL3WglProc) trace_GetQueryBufferObjectui64v,
+	(GL3WglProc) trace_GetQueryBufferObjectuiv,
+	(GL3WglProc) trace_GetQueryIndexediv,
+	(GL3WglProc) trace_GetQueryObjecti64v,
+	(GL3WglProc) trace_GetQueryObjectiv,
+	(GL3WglProc) trace_GetQueryObjectui64v,
+	(GL3WglProc) trace_GetQueryObjectuiv,
+	(GL3WglProc) trace_GetQueryiv,
+	(GL3WglProc) trace_GetRenderbufferParameteriv,
+	(GL3WglProc) trace_GetSamplerParameterIiv,
+	(GL3WglProc) trace_GetSamplerParameterIuiv,
+	(GL3WglProc) trace_GetSamplerParameterfv,
+	(GL3WglProc) trace_GetSamplerParameteriv,
+	(GL3WglProc) trace_GetShaderInfoLog,
+	(GL3WglProc) trace_GetShaderPrecisionFormat,
+	(GL3WglProc) trace_GetShaderSource,
+	(GL3WglProc) trace_GetShaderiv,
+	(GL3WglProc) trace_GetString,
+	(GL3WglProc) trace_GetStringi,
+	(GL3WglProc) trace_GetSubroutineIndex,
+	(GL3WglProc) trace_GetSubroutineUniformLocation,
+	(GL3WglProc) trace_GetSynciv,
+	(GL3WglProc) trace_GetTexImage,
+	(GL3WglProc) trace_GetTexLevelParameterfv,
+	(GL3WglProc) trace_GetTexLevelParameteriv,
+	(GL3WglProc) trace_GetTexParameterIiv,
+	(GL3WglProc) trace_GetTexParameterIuiv,
+	(GL3WglProc) trace_GetTexParameterfv,
+	(GL3WglProc) trace_GetTexParameteriv,
+	(GL3WglProc) trace_GetTextureHandleARB,
+	(GL3WglProc) trace_GetTextureImage,
+	(GL3WglProc) trace_GetTextureLevelParameterfv,
+	(GL3WglProc) trace_GetTextureLevelParameteriv,
+	(GL3WglProc) trace_GetTextureParameterIiv,
+	(GL3WglProc) trace_GetTextureParameterIuiv,
+	(GL3WglProc) trace_GetTextureParameterfv,
+	(GL3WglProc) trace_GetTextureParameteriv,
+	(GL3WglProc) trace_GetTextureSamplerHandleARB,
+	(GL3WglProc) trace_GetTextureSubImage,
+	(GL3WglProc) trace_GetTransformFeedbackVarying,
+	(GL3WglProc) trace_GetTransformFeedbacki64_v,
+	(GL3WglProc) trace_GetTransformFeedbacki_v,
+	(GL3WglProc) trace_GetTransformFeedbackiv,
+	(GL3WglProc) trace_GetUniformBlockIndex,
+	(GL3WglProc) trace_GetUniformIndices,
+	(GL3WglProc) trace_GetUniformLocation,
+	(GL3WglProc) trace_GetUniformSubroutineuiv,
+	(GL3WglProc) trace_GetUniformdv,
+	(GL3WglProc) trace_GetUniformfv,
+	(GL3WglProc) trace_GetUniformiv,
+	(GL3WglProc) trace_GetUniformuiv,
+	(GL3WglProc) trace_GetVertexArrayIndexed64iv,
+	(GL3WglProc) trace_GetVertexArrayIndexediv,
+	(GL3WglProc) trace_GetVertexArrayiv,
+	(GL3WglProc) trace_GetVertexAttribIiv,
+	(GL3WglProc) trace_GetVertexAttribIuiv,
+	(GL3WglProc) trace_GetVertexAttribLdv,
+	(GL3WglProc) trace_GetVertexAttribLui64vARB,
+	(GL3WglProc) trace_GetVertexAttribPointerv,
+	(GL3WglProc) trace_GetVertexAttribdv,
+	(GL3WglProc) trace_GetVertexAttribfv,
+	(GL3WglProc) trace_GetVertexAttribiv,
+	(GL3WglProc) trace_GetnCompressedTexImage,
+	(GL3WglProc) trace_GetnCompressedTexImageARB,
+	(GL3WglProc) trace_GetnTexImage,
+	(GL3WglProc) trace_GetnTexImageARB,
+	(GL3WglProc) trace_GetnUniformdv,
+	(GL3WglProc) trace_GetnUniformdvARB,
+	(GL3WglProc) trace_GetnUniformfv,
+	(GL3WglProc) trace_GetnUniformfvARB,
+	(GL3WglProc) trace_GetnUniformiv,
+	(GL3WglProc) trace_GetnUniformivARB,
+	(GL3WglProc) trace_GetnUniformuiv,
+	(GL3WglProc) trace_GetnUniformuivARB,
+	(GL3WglProc) trace_Hint,
+	(GL3WglProc) trace_InvalidateBufferData,
+	(GL3WglProc) trace_InvalidateBufferSubData,
+	(GL3WglProc) trace_InvalidateFramebuffer,
+	(GL3WglProc) trace_InvalidateNamedFramebufferData,
+	(GL3WglProc) trace_InvalidateNamedFramebufferSubData,
+	(GL3WglProc) trace_InvalidateSubFramebuffer,
+	(GL3WglProc) trace_InvalidateTexImage,
+	(GL3WglProc) trace_InvalidateTexSubImage,
+	(GL3WglProc) trace_IsBuffer,
+	(GL3WglProc) trace_IsEnabled,
+	(GL3WglProc) trace_IsEnabledi,
+	(GL3WglProc) trace_IsFramebuffer,
+	(GL3WglProc) trace_IsImageHandleResidentARB,
+	(GL3WglProc) trace_IsNamedStringARB,
+	(GL3WglProc) trace_IsProgram,
+	(GL3WglProc) trace_IsProgramPipeline,
+	(GL3WglProc) trace_IsQuery,
+	(GL3WglProc) trace_IsRenderbuffer,
+	(GL3WglProc) trace_IsSampler,
+	(GL3WglProc) trace_IsShader,
+	(GL3WglProc) trace_IsSync,
+	(GL3WglProc) trace_IsTexture,
+	(GL3WglProc) trace_IsTextureHandleResidentARB,
+	(GL3WglProc) trace_IsTransformFeedback,
+	(GL3WglProc) trace_IsVertexArray,
+	(GL3WglProc) trace_LineWidth,
+	(GL3WglProc) trace_LinkProgram,
+	(GL3WglProc) trace_LogicOp,
+	(GL3WglProc) trace_MakeImageHandleNonResidentARB,
+	(GL3WglProc) trace_MakeImageHandleResidentARB,
+	(GL3WglProc) trace_MakeTextureHandleNonResidentARB,
+	(GL3WglProc) trace_MakeTextureHandleResidentARB,
+	(GL3WglProc) trace_MapBuffer,
+	(GL3WglProc) trace_MapBufferRange,
+	(GL3WglProc) trace_MapNamedBuffer,
+	(GL3WglProc) trace_MapNamedBufferRange,
+	(GL3WglProc) trace_MemoryBarrier,
+	(GL3WglProc) trace_MemoryBarrierByRegion,
+	(GL3WglProc) trace_MinSampleShading,
+	(GL3WglProc) trace_MinSampleShadingARB,
+	(GL3WglProc) trace_MultiDrawArrays,
+	(GL3WglProc) trace_MultiDrawArraysIndirect,
+	(GL3WglProc) trace_MultiDrawArraysIndirectCountARB,
+	(GL3WglProc) trace_MultiDrawElements,
+	(GL3WglProc) trace_MultiDrawElementsBaseVertex,
+	(GL3WglProc) trace_MultiDrawElementsIndirect,
+	(GL3WglProc) trace_MultiDrawElementsIndirectCountARB,
+	(GL3WglProc) trace_NamedBufferData,
+	(GL3WglProc) trace_NamedBufferPageCommitmentARB,
+	(GL3WglProc) trace_NamedBufferPageCommitmentEXT,
+	(GL3WglProc) trace_NamedBufferStorage,
+	(GL3WglProc) trace_NamedBufferSubData,
+	(GL3WglProc) trace_NamedFramebufferDrawBuffer,
+	(GL3WglProc) trace_NamedFramebufferDrawBuffers,
+	(GL3WglProc) trace_NamedFramebufferParameteri,
+	(GL3WglProc) trace_NamedFramebufferReadBuffer,
+	(GL3WglProc) trace_NamedFramebufferRenderbuffer,
+	(GL3WglProc) trace_NamedFramebufferTexture,
+	(GL3WglProc) trace_NamedFramebufferTextureLayer,
+	(GL3WglProc) trace_NamedRenderbufferStorage,
+	(GL3WglProc) trace_NamedRenderbufferStorageMultisample,
+	(GL3WglProc) trace_NamedStringARB,
+	(GL3WglProc) trace_ObjectLabel,
+	(GL3WglProc) trace_ObjectPtrLabel,
+	(GL3WglProc) trace_PatchParameterfv,
+	(GL3WglProc) trace_PatchParameteri,
+	(GL3WglProc) trace_PauseTransformFeedback,
+	(GL3WglProc) trace_PixelStoref,
+	(GL3WglProc) trace_PixelStorei,
+	(GL3WglProc) trace_PointParameterf,
+	(GL3WglProc) trace_PointParameterfv,
+	(GL3WglProc) trace_PointParameteri,
+	(GL3WglProc) trace_PointParameteriv,
+	(GL3WglProc) trace_PointSize,
+	(GL3WglProc) trace_PolygonMode,
+	(GL3WglProc) trace_PolygonOffset,
+	(GL3WglProc) trace_PopDebugGroup,
+	(GL3WglProc) trace_PrimitiveRestartIndex,
+	(GL3WglProc) trace_ProgramBinary,
+	(GL3WglProc) trace_ProgramParameteri,
+	(GL3WglProc) trace_ProgramUniform1d,
+	(GL3WglProc) trace_ProgramUniform1dv,
+	(GL3WglProc) trace_ProgramUniform1f,
+	(GL3WglProc) trace_ProgramUniform1fv,
+	(GL3WglProc) trace_ProgramUniform1i,
+	(GL3WglProc) trace_ProgramUniform1iv,
+	(GL3WglProc) trace_ProgramUniform1ui,
+	(GL3WglProc) trace_ProgramUniform1uiv,
+	(GL3WglProc) trace_ProgramUniform2d,
+	(GL3WglProc) trace_ProgramUniform2dv,
+	(GL3WglProc) trace_ProgramUniform2f,
+	(GL3WglProc) trace_ProgramUniform2fv,
+	(GL3WglProc) trace_ProgramUniform2i,
+	(GL3WglProc) trace_ProgramUniform2iv,
+	(GL3WglProc) trace_ProgramUniform2ui,
+	(GL3WglProc) trace_ProgramUniform2uiv,
+	(GL3WglProc) trace_ProgramUniform3d,
+	(GL3WglProc) trace_ProgramUniform3dv,
+	(GL3WglProc) trace_ProgramUniform3f,
+	(GL3WglProc) trace_ProgramUniform3fv,
+	(GL3WglProc) trace_ProgramUniform3i,
+	(GL3WglProc) trace_ProgramUniform3iv,
+	(GL3WglProc) trace_ProgramUniform3ui,
+	(GL3WglProc) trace_ProgramUniform3uiv,
+	(GL3WglProc) trace_ProgramUniform4d,
+	(GL3WglProc) trace_ProgramUniform4dv,
+	(GL3WglProc) trace_ProgramUniform4f,
+	(GL3WglProc) trace_ProgramUniform4fv,
+	(GL3WglProc) trace_ProgramUniform4i,
+	(GL3WglProc) trace_ProgramUniform4iv,
+	(GL3WglProc) trace_ProgramUniform4ui,
+	(GL3WglProc) trace_ProgramUniform4uiv,
+	(GL3WglProc) trace_ProgramUniformHandleui64ARB,
+	(GL3WglProc) trace_ProgramUniformHandleui64vARB,
+	(GL3WglProc) trace_ProgramUniformMatrix2dv,
+	(GL3WglProc) trace_ProgramUniformMatrix2fv,
+	(GL3WglProc) trace_ProgramUniformMatrix2x3dv,
+	(GL3WglProc) trace_ProgramUniformMatrix2x3fv,
+	(GL3WglProc) trace_ProgramUniformMatrix2x4dv,
+	(GL3WglProc) trace_ProgramUniformMatrix2x4fv,
+	(GL3WglProc) trace_ProgramUniformMatrix3dv,
+	(GL3WglProc) trace_ProgramUniformMatrix3fv,
+	(GL3WglProc) trace_ProgramUniformMatrix3x2dv,
+	(GL3WglProc) trace_ProgramUniformMatrix3x2fv,
+	(GL3WglProc) trace_ProgramUniformMatrix3x4dv,
+	(GL3WglProc) trace_ProgramUniformMatrix3x4fv,
+	(GL3WglProc) trace_ProgramUniformMatrix4dv,
+	(GL3WglProc) trace_ProgramUniformMatrix4fv,
+	(GL3WglProc) trace_ProgramUniformMatrix4x2dv,
+	(GL3WglProc) trace_ProgramUniformMatrix4x2fv,
+	(GL3WglProc) trace_ProgramUniformMatrix4x3dv,
+	(GL3WglProc) trace_ProgramUniformMatrix4x3fv,
+	(GL3WglProc) trace_ProvokingVertex,
+	(GL3WglProc) trace_PushDebugGroup,
+	(GL3WglProc) trace_QueryCounter,
+	(GL3WglProc) trace_ReadBuffer,
+	(GL3WglProc) trace_ReadPixels,
+	(GL3WglProc) trace_ReadnPixels,
+	(GL3WglProc) trace_ReadnPixelsARB,
+	(GL3WglProc) trace_ReleaseShaderCompiler,
+	(GL3WglProc) trace_RenderbufferStorage,
+	(GL3WglProc) trace_RenderbufferStorageMultisample,
+	(GL3WglProc) trace_ResumeTransformFeedback,
+	(GL3WglProc) trace_SampleCoverage,
+	(GL3WglProc) trace_SampleMaski,
+	(GL3WglProc) trace_SamplerParameterIiv,
+	(GL3WglProc) trace_SamplerParameterIuiv,
+	(GL3WglProc) trace_SamplerParameterf,
+	(GL3WglProc) trace_SamplerParameterfv,
+	(GL3WglProc) trace_SamplerParameteri,
+	(GL3WglProc) trace_SamplerParameteriv,
+	(GL3WglProc) trace_Scissor,
+	(GL3WglProc) trace_ScissorArrayv,
+	(GL3WglProc) trace_ScissorIndexed,
+	(GL3WglProc) trace_ScissorIndexedv,
+	(GL3WglProc) trace_ShaderBinary,
+	(GL3WglProc) trace_ShaderSource,
+	(GL3WglProc) trace_ShaderStorageBlockBinding,
+	(GL3WglProc) trace_StencilFunc,
+	(GL3WglProc) trace_StencilFuncSeparate,
+	(GL3WglProc) trace_StencilMask,
+	(GL3WglProc) trace_StencilMaskSeparate,
+	(GL3WglProc) trace_StencilOp,
+	(GL3WglProc) trace_StencilOpSeparate,
+	(GL3WglProc) trace_TexBuffer,
+	(GL3WglProc) trace_TexBufferRange,
+	(GL3WglProc) trace_TexImage1D,
+	(GL3WglProc) trace_TexImage2D,
+	(GL3WglProc) trace_TexImage2DMultisample,
+	(GL3WglProc) trace_TexImage3D,
+	(GL3WglProc) trace_TexImage3DMultisample,
+	(GL3WglProc) trace_TexPageCommitmentARB,
+	(GL3WglProc) trace_TexParameterIiv,
+	(GL3WglProc) trace_TexParameterIuiv,
+	(GL3WglProc) trace_TexParameterf,
+	(GL3WglProc) trace_TexParameterfv,
+	(GL3WglProc) trace_TexParameteri,
+	(GL3WglProc) trace_TexParameteriv,
+	(GL3WglProc) trace_TexStorage1D,
+	(GL3WglProc) trace_TexStorage2D,
+	(GL3WglProc) trace_TexStorage2DMultisample,
+	(GL3WglProc) trace_TexStorage3D,
+	(GL3WglProc) trace_TexStorage3DMultisample,
+	(GL3WglProc) trace_TexSubImage1D,
+	(GL3WglProc) trace_TexSubImage2D,
+	(GL3WglProc) trace_TexSubImage3D,
+	(GL3WglProc) trace_TextureBarrier,
+	(GL3WglProc) trace_TextureBuffer,
+	(GL3WglProc) trace_TextureBufferRange,
+	(GL3WglProc) trace_TextureParameterIiv,
+	(GL3WglProc) trace_TextureParameterIuiv,
+	(GL3WglProc) trace_TextureParameterf,
+	(GL3WglProc) trace_TextureParameterfv,
+	(GL3WglProc) trace_TextureParameteri,
+	(GL3WglProc) trace_TextureParameteriv,
+	(GL3WglProc) trace_TextureStorage1D,
+	(GL3WglProc) trace_TextureStorage2D,
+	(GL3WglProc) trace_TextureStorage2DMultisample,
+	(GL3WglProc) trace_TextureStorage3D,
+	(GL3WglProc) trace_TextureStorage3DMultisample,
+	(GL3WglProc) trace_TextureSubImage1D,
+	(GL3WglProc) trace_TextureSubImage2D,
+	(GL3WglProc) trace_TextureSubImage3D,
+	(GL3WglProc) trace_TextureView,
+	(GL3WglProc) trace_TransformFeedbackBufferBase,
+	(GL3WglProc) trace_TransformFeedbackBufferRange,
+	(GL3WglProc) trace_TransformFeedbackVaryings,
+	(GL3WglProc) trace_Uniform1d,
+	(GL3WglProc) trace_Uniform1dv,
+	(GL3WglProc) trace_Uniform1f,
+	(GL3WglProc) trace_Uniform1fv,
+	(GL3WglProc) trace_Uniform1i,
+	(GL3WglProc) trace_Uniform1iv,
+	(GL3WglProc) trace_Uniform1ui,
+	(GL3WglProc) trace_Uniform1uiv,
+	(GL3WglProc) trace_Uniform2d,
+	(GL3WglProc) trace_Uniform2dv,
+	(GL3WglProc) trace_Uniform2f,
+	(GL3WglProc) trace_Uniform2fv,
+	(GL3WglProc) trace_Uniform2i,
+	(GL3WglProc) trace_Uniform2iv,
+	(GL3WglProc) trace_Uniform2ui,
+	(GL3WglProc) trace_Uniform2uiv,
+	(GL3WglProc) trace_Uniform3d,
+	(GL3WglProc) trace_Uniform3dv,
+	(GL3WglProc) trace_Uniform3f,
+	(GL3WglProc) trace_Uniform3fv,
+	(GL3WglProc) trace_Uniform3i,
+	(GL3WglProc) trace_Uniform3iv,
+	(GL3WglProc) trace_Uniform3ui,
+	(GL3WglProc) trace_Uniform3uiv,
+	(GL3WglProc) trace_Uniform4d,
+	(GL3WglProc) trace_Uniform4dv,
+	(GL3WglProc) trace_Uniform4f,
+	(GL3WglProc) trace_Uniform4fv,
+	(GL3WglProc) trace_Uniform4i,
+	(GL3WglProc) trace_Uniform4iv,
+	(GL3WglProc) trace_Uniform4ui,
+	(GL3WglProc) trace_Uniform4uiv,
+	(GL3WglProc) trace_UniformBlockBinding,
+	(GL3WglProc) trace_UniformHandleui64ARB,
+	(GL3WglProc) trace_UniformHandleui64vARB,
+	(GL3WglProc) trace_UniformMatrix2dv,
+	(GL3WglProc) trace_UniformMatrix2fv,
+	(GL3WglProc) trace_UniformMatrix2x3dv,
+	(GL3WglProc) trace_UniformMatrix2x3fv,
+	(GL3WglProc) trace_UniformMatrix2x4dv,
+	(GL3WglProc) trace_UniformMatrix2x4fv,
+	(GL3WglProc) trace_UniformMatrix3dv,
+	(GL3WglProc) trace_UniformMatrix3fv,
+	(GL3WglProc) trace_UniformMatrix3x2dv,
+	(GL3WglProc) trace_UniformMatrix3x2fv,
+	(GL3WglProc) trace_UniformMatrix3x4dv,
+	(GL3WglProc) trace_UniformMatrix3x4fv,
+	(GL3WglProc) trace_UniformMatrix4dv,
+	(GL3WglProc) trace_UniformMatrix4fv,
+	(GL3WglProc) trace_UniformMatrix4x2dv,
+	(GL3WglProc) trace_UniformMatrix4x2fv,
+	(GL3WglProc) trace_UniformMatrix4x3dv,
+	(GL3WglProc) trace_UniformMatrix4x3fv,
+	(GL3WglProc) trace_UniformSubroutinesuiv,
+	(GL3WglProc) trace_UnmapBuffer,
+	(GL3WglProc) trace_UnmapNamedBuffer,
+	(GL3WglProc) trace_UseProgram,
+	(GL3WglProc) trace_UseProgramStages,
+	(GL3WglProc) trace_ValidateProgram,
+	(GL3WglProc) trace_ValidateProgramPipeline,
+	(GL3WglProc) trace_VertexArrayAttribBinding,
+	(GL3WglProc) trace_VertexArrayAttribFormat,
+	(GL3WglProc) trace_VertexArrayAttribIFormat,
+	(GL3WglProc) trace_VertexArrayAttribLFormat,
+	(GL3WglProc) trace_VertexArrayBindingDivisor,
+	(GL3WglProc) trace_VertexArrayElementBuffer,
+	(GL3WglProc) trace_VertexArrayVertexBuffer,
+	(GL3WglProc) trace_VertexArrayVertexBuffers,
+	(GL3WglProc) trace_VertexAttrib1d,
+	(GL3WglProc) trace_VertexAttrib1dv,
+	(GL3WglProc) trace_VertexAttrib1f,
+	(GL3WglProc) trace_VertexAttrib1fv,
+	(GL3WglProc) trace_VertexAttrib1s,
+	(GL3WglProc) trace_VertexAttrib1sv,
+	(GL3WglProc) trace_VertexAttrib2d,
+	(GL3WglProc) trace_VertexAttrib2dv,
+	(GL3WglProc) trace_VertexAttrib2f,
+	(GL3WglProc) trace_VertexAttrib2fv,
+	(GL3WglProc) trace_VertexAttrib2s,
+	(GL3WglProc) trace_VertexAttrib2sv,
+	(GL3WglProc) trace_VertexAttrib3d,
+	(GL3WglProc) trace_VertexAttrib3dv,
+	(GL3WglProc) trace_VertexAttrib3f,
+	(GL3WglProc) trace_VertexAttrib3fv,
+	(GL3WglProc) trace_VertexAttrib3s,
+	(GL3WglProc) trace_VertexAttrib3sv,
+	(GL3WglProc) trace_VertexAttrib4Nbv,
+	(GL3WglProc) trace_VertexAttrib4Niv,
+	(GL3WglProc) trace_VertexAttrib4Nsv,
+	(GL3WglProc) trace_VertexAttrib4Nub,
+	(GL3WglProc) trace_VertexAttrib4Nubv,
+	(GL3WglProc) trace_VertexAttrib4Nuiv,
+	(GL3WglProc) trace_VertexAttrib4Nusv,
+	(GL3WglProc) trace_VertexAttrib4bv,
+	(GL3WglProc) trace_VertexAttrib4d,
+	(GL3WglProc) trace_VertexAttrib4dv,
+	(GL3WglProc) trace_VertexAttrib4f,
+	(GL3WglProc) trace_VertexAttrib4fv,
+	(GL3WglProc) trace_VertexAttrib4iv,
+	(GL3WglProc) trace_VertexAttrib4s,
+	(GL3WglProc) trace_VertexAttrib4sv,
+	(GL3WglProc) trace_VertexAttrib4ubv,
+	(GL3WglProc) trace_VertexAttrib4uiv,
+	(GL3WglProc) trace_VertexAttrib4usv,
+	(GL3WglProc) trace_VertexAttribBinding,
+	(GL3WglProc) trace_VertexAttribDivisor,
+	(GL3WglProc) trace_VertexAttribFormat,
+	(GL3WglProc) trace_VertexAttribI1i,
+	(GL3WglProc) trace_VertexAttribI1iv,
+	(GL3WglProc) trace_VertexAttribI1ui,
+	(GL3WglProc) trace_VertexAttribI1uiv,
+	(GL3WglProc) trace_VertexAttribI2i,
+	(GL3WglProc) trace_VertexAttribI2iv,
+	(GL3WglProc) trace_VertexAttribI2ui,
+	(GL3WglProc) trace_VertexAttribI2uiv,
+	(GL3WglProc) trace_VertexAttribI3i,
+	(GL3WglProc) trace_VertexAttribI3iv,
+	(GL3WglProc) trace_VertexAttribI3ui,
+	(GL3WglProc) trace_VertexAttribI3uiv,
+	(GL3WglProc) trace_VertexAttribI4bv,
+	(GL3WglProc) trace_VertexAttribI4i,
+	(GL3WglProc) trace_VertexAttribI4iv,
+	(GL3WglProc) trace_VertexAttribI4sv,
+	(GL3WglProc) trace_VertexAttribI4ubv,
+	(GL3WglProc) trace_VertexAttribI4ui,
+	(GL3WglProc) trace_VertexAttribI4uiv,
+	(GL3WglProc) trace_VertexAttribI4usv,
+	(GL3WglProc) trace_VertexAttribIFormat,
+	(GL3WglProc) trace_VertexAttribIPointer,
+	(GL3WglProc) trace_VertexAttribL1d,
+	(GL3WglProc) trace_VertexAttribL1dv,
+	(GL3WglProc) trace_VertexAttribL1ui64ARB,
+	(GL3WglProc) trace_VertexAttribL1ui64vARB,
+	(GL3WglProc) trace_VertexAttribL2d,
+	(GL3WglProc) trace_VertexAttribL2dv,
+	(GL3WglProc) trace_VertexAttribL3d,
+	(GL3WglProc) trace_VertexAttribL3dv,
+	(GL3WglProc) trace_VertexAttribL4d,
+	(GL3WglProc) trace_VertexAttribL4dv,
+	(GL3WglProc) trace_VertexAttribLFormat,
+	(GL3WglProc) trace_VertexAttribLPointer,
+	(GL3WglProc) trace_VertexAttribP1ui,
+	(GL3WglProc) trace_VertexAttribP1uiv,
+	(GL3WglProc) trace_VertexAttribP2ui,
+	(GL3WglProc) trace_VertexAttribP2uiv,
+	(GL3WglProc) trace_VertexAttribP3ui,
+	(GL3WglProc) trace_VertexAttribP3uiv,
+	(GL3WglProc) trace_VertexAttribP4ui,
+	(GL3WglProc) trace_VertexAttribP4uiv,
+	(GL3WglProc) trace_VertexAttribPointer,
+	(GL3WglProc) trace_VertexBindingDivisor,
+	(GL3WglProc) trace_Viewport,
+	(GL3WglProc) trace_ViewportArrayv,
+	(GL3WglProc) trace_ViewportIndexedf,
+	(GL3WglProc) trace_ViewportIndexedfv,
+	(GL3WglProc) trace_WaitSync,
+};
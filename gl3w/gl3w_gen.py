@@ -0,0 +1,2208 @@
+#!/usr/bin/env python3
+
+#   This file is derived from gl3w_gen.py, part of gl3w
+#   (hosted at https://github.com/skaslev/gl3w)
+#
+#   This is free and unencumbered software released into the public domain.
+#
+#   Unlike upstream it never downloads anything: it regenerates
+#   GL/gl3w.h and gl3w.c from the GL/glcorearb.h sitting next to it.
+#
+#   Usage: python3 gl3w_gen.py   (from the gl3w/ directory)
+#          python3 gl3w_gen.py --manifest OUT.h SOURCE...
+#
+#   The second form scans C sources for the entry points they call and
+#   writes them out as a manifest for gl3wInitSubset().
+
+import os
+import re
+import sys
+
+UNLICENSE = r'''/*
+
+    This file was generated with gl3w_gen.py, part of gl3w
+    (hosted at https://github.com/skaslev/gl3w)
+
+    This is free and unencumbered software released into the public domain.
+
+    Anyone is free to copy, modify, publish, use, compile, sell, or
+    distribute this software, either in source code form or as a compiled
+    binary, for any purpose, commercial or non-commercial, and by any
+    means.
+
+    In jurisdictions that recognize copyright laws, the author or authors
+    of this software dedicate any and all copyright interest in the
+    software to the public domain. We make this dedication for the benefit
+    of the public at large and to the detriment of our heirs and
+    successors. We intend this dedication to be an overt act of
+    relinquishment in perpetuity of all present and future rights to this
+    software under copyright law.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+    OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+    ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+    OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+'''
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+
+# Each prototype in glcorearb.h sits inside exactly one GL_VERSION_x_y
+# or extension block. Returns {proc: block name}.
+def read_procs():
+    procs = {}
+    feature = None
+    p = re.compile(r'GLAPI.*APIENTRY\s+(\w+)')
+    begin = re.compile(r'#define (GL_VERSION_\d_\d|GL_[A-Z]+_\w+) 1\s*$')
+    end = re.compile(r'#endif /\* (GL_\w+) \*/')
+    with open(os.path.join(HERE, 'GL', 'glcorearb.h'), 'r') as f:
+        for line in f:
+            m = begin.match(line)
+            if m:
+                feature = m.group(1)
+                continue
+            m = end.match(line)
+            if m and m.group(1) == feature:
+                feature = None
+                continue
+            m = p.match(line)
+            if m:
+                procs.setdefault(m.group(1), feature)
+    return procs
+
+
+# Returns {proc: (return type, [(parameter declaration, name)])}.
+def read_prototypes():
+    protos = {}
+    p = re.compile(r'GLAPI\s+(.*?)\s*APIENTRY\s+(\w+)\s*\((.*)\);')
+    with open(os.path.join(HERE, 'GL', 'glcorearb.h'), 'r') as f:
+        for line in f:
+            m = p.match(line)
+            if not m or m.group(2) in protos:
+                continue
+            params = []
+            if m.group(3).strip() != 'void':
+                for param in m.group(3).split(','):
+                    param = param.strip()
+                    params.append((param, re.search(r'(\w+)$', param).group(1)))
+            protos[m.group(2)] = (m.group(1), params)
+    return protos
+
+
+# Every extension block in glcorearb.h, with or without entry points.
+def read_extensions():
+    p = re.compile(r'#define (GL_[A-Z]+_\w+) 1\s*$')
+    with open(os.path.join(HERE, 'GL', 'glcorearb.h'), 'r') as f:
+        return sorted(set(m.group(1) for m in map(p.match, f)
+                          if m and not proc_version(m.group(1))))
+
+
+def proc_version(feature):
+    m = re.match(r'GL_VERSION_(\d)_(\d)$', feature)
+    return int(m.group(1)) * 10 + int(m.group(2)) if m else 0
+
+
+def proc_t(proc):
+    return 'PFN{0}PROC'.format(proc.upper())
+
+
+# Order-preserving minimal perfect hash (Czech, Havas, Majewski).
+# Every name becomes an edge between two vertices of a random graph;
+# once the graph is acyclic, vertex values are assigned so that the two
+# endpoints of each edge sum to that name's slot modulo the name count.
+
+def fnv1a(seed, s):
+    h = seed
+    for c in s.encode('ascii'):
+        h = ((h ^ c) * 16777619) & 0xffffffff
+    return h
+
+
+def perfect_hash(names):
+    n = len(names)
+    m = n * 21 // 10 + 1
+    seed = 0
+    while True:
+        seed1 = fnv1a(0x811c9dc5, 'seed1:%d' % seed)
+        seed2 = fnv1a(0x811c9dc5, 'seed2:%d' % seed)
+        seed += 1
+        edges = []
+        adj = [[] for _ in range(m)]
+        ok = True
+        for i, name in enumerate(names):
+            a = fnv1a(seed1, name) % m
+            b = fnv1a(seed2, name) % m
+            if a == b:
+                ok = False
+                break
+            edges.append((a, b))
+            adj[a].append((b, i))
+            adj[b].append((a, i))
+        if not ok:
+            continue
+        g = [None] * m
+        for root in range(m):
+            if g[root] is not None:
+                continue
+            g[root] = 0
+            stack = [(root, -1)]
+            while ok and stack:
+                v, via = stack.pop()
+                for w, i in adj[v]:
+                    if i == via:
+                        continue
+                    if g[w] is not None:
+                        ok = False
+                        break
+                    g[w] = (i - g[v]) % n
+                    stack.append((w, i))
+            if not ok:
+                break
+        if ok:
+            return seed1, seed2, m, g
+
+
+def c_array(values, per_line=12):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('\t' + ', '.join('%d' % v for v in values[i:i+per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def write_header(procs, exts):
+    with open(os.path.join(HERE, 'GL', 'gl3w.h'), 'wb') as f:
+        w = lambda s: f.write(s.encode('utf-8'))
+        w(UNLICENSE)
+        w(r'''#ifndef __gl3w_h_
+#define __gl3w_h_
+
+#include <GL/glcorearb.h>
+
+#ifndef __gl_h_
+#define __gl_h_
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GL3W_OK 0
+#define GL3W_ERROR_INIT -1
+#define GL3W_ERROR_OPENGL_VERSION -3
+#define GL3W_ERROR_MISSING -4
+
+typedef void (*GL3WglProc)(void);
+
+/* What an application needs from the context. All lists are NULL
+ * terminated and optional. Core entry points up to major.minor and the
+ * entry points of the listed extensions are required. A manifest, when
+ * given, limits loading to the entry points it names; those outside
+ * the required set are loaded if available but may be missing. Entry
+ * points of extensions promoted to core are declared under their core
+ * version only, so list them in the manifest.
+ */
+struct GL3WSubset {
+	int major, minor;
+	const char *const *extensions;
+	const char *const *procs;
+};
+
+/* gl3w api */
+int gl3wInit(void);
+int gl3wIsSupported(int major, int minor);
+GL3WglProc gl3wGetProcAddress(const char *proc);
+
+/* Load only the entry points a subset needs. Everything else points at
+ * a stub that reports its name and aborts when called. Returns GL3W_OK,
+ * or GL3W_ERROR_MISSING with gl3wMissing() naming the first required
+ * extension or entry point the context lacks.
+ */
+int gl3wInitSubset(const struct GL3WSubset *subset);
+const char *gl3wMissing(void);
+
+/* Slot of a core entry point in gl3wProcs, or -1 if unknown. */
+int gl3wProcIndex(const char *proc);
+const char *gl3wProcName(int slot);
+
+/* Instrumented dispatch. While tracing, every loaded entry point in
+ * gl3wProcs is swapped for a wrapper that counts calls and their CPU
+ * time and, with GL3W_TRACE_ERRORS, checks glGetError() after each
+ * call. GL3W_TRACE_OFF swaps the driver's entry points back, so tracing
+ * costs nothing while it's off. Statistics are indexed by slot. Built
+ * with GCC or Clang they are updated atomically, so several GL threads
+ * may be traced at once; other compilers update them unsynchronized,
+ * so trace one GL thread at a time there.
+ */
+#define GL3W_TRACE_OFF    0
+#define GL3W_TRACE_CALLS  1
+#define GL3W_TRACE_ERRORS 3
+#define GL3W_TRACE_CAPTURE 4
+
+struct GL3WTraceStat {
+	unsigned long calls;
+	unsigned long errors;
+	double seconds;
+};
+
+void gl3wTrace(int mode);
+int gl3wTraceMode(void);
+const struct GL3WTraceStat *gl3wTraceStats(void);
+void gl3wTraceReset(void);
+
+/* Capture records every call with its arguments, and the data behind
+ * its pointers, to a trace file for gl3wReplay(). It is a trace mode of
+ * its own and combines with the others. gl3wCaptureFrame() marks the
+ * end of a frame. Objects are remapped at replay, so start capturing
+ * before the application creates any. Capture isn't synchronized:
+ * make GL calls from one thread while it runs.
+ */
+int gl3wCaptureStart(const char *path);
+void gl3wCaptureFrame(void);
+void gl3wCaptureStop(void);
+
+/* Re-issue a captured trace held in memory on the current context.
+ * frame, if given, is called at each frame marker, e.g. to swap
+ * buffers. GL3W_REPLAY_TIMED keeps the original call timing, otherwise
+ * calls are issued as fast as possible. Returns 0, or -1 for a trace
+ * that is malformed or truncated.
+ */
+#define GL3W_REPLAY_TIMED 1
+
+struct GL3WReplayStats {
+	unsigned long calls;
+	unsigned long skipped;
+	unsigned long frames;
+};
+
+int gl3wReplay(const void *trace, size_t size, int flags,
+	       void (*frame)(void *), void *arg, struct GL3WReplayStats *stats);
+
+/* Extension registry. The extensions the context advertises are
+ * enumerated once at init into a hash set, so gl3wIsExtensionSupported()
+ * takes constant time. Extensions known to glcorearb.h also get a
+ * compile-time ID and a bit in gl3wExtensions, making gl3wHasExt() a
+ * single bit test for use in hot paths.
+ */
+enum GL3WExtension {
+''' + ''.join('\t{0},\n'.format(e.replace('GL_', 'GL3W_', 1))
+                  for e in exts) + r'''	GL3W_EXTENSION_COUNT
+};
+
+extern unsigned gl3wExtensions[(GL3W_EXTENSION_COUNT + 31) / 32];
+
+#define gl3wHasExt(ext) ((gl3wExtensions[(ext) / 32] >> ((ext) % 32)) & 1u)
+
+int gl3wIsExtensionSupported(const char *ext);
+
+/* Resolve many entry points at once, each distinct name at most once.
+ * Returns the number of entry points found.
+ */
+int gl3wGetProcAddresses(const char *const *procs, GL3WglProc *res, int count);
+
+/* OpenGL functions */
+#define GL3W_PROC_COUNT ''' + str(len(procs)) + r'''
+
+union GL3WProcs {
+	GL3WglProc ptr[GL3W_PROC_COUNT];
+	struct {
+''')
+        for proc in procs:
+            w('\t\t{0: <52} {1};\n'.format(proc_t(proc), proc[2:]))
+        w(r'''	} gl;
+};
+
+extern union GL3WProcs gl3wProcs;
+
+''')
+        for proc in procs:
+            w('#define {0: <45} gl3wProcs.gl.{1}\n'.format(proc, proc[2:]))
+        w(r'''
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+''')
+
+
+def write_source(features, exts, protos):
+    procs = sorted(features)
+    seed1, seed2, m, g = perfect_hash(procs)
+    with open(os.path.join(HERE, 'gl3w.c'), 'wb') as f:
+        w = lambda s: f.write(s.encode('utf-8'))
+        w(UNLICENSE)
+        w(r'''#if !defined(_WIN32) && !defined(__APPLE__) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <GL/gl3w.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ARRAY_SIZE(x)  (sizeof(x) / sizeof((x)[0]))
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN 1
+#include <windows.h>
+
+static HMODULE libgl;
+
+static void open_libgl(void)
+{
+	libgl = LoadLibraryA("opengl32.dll");
+}
+
+static void close_libgl(void)
+{
+	FreeLibrary(libgl);
+}
+
+static GL3WglProc get_proc(const char *proc)
+{
+	GL3WglProc res;
+
+	res = (GL3WglProc) wglGetProcAddress(proc);
+	if (!res)
+		res = (GL3WglProc) GetProcAddress(libgl, proc);
+	return res;
+}
+
+static double now(void)
+{
+	LARGE_INTEGER count, freq;
+
+	QueryPerformanceCounter(&count);
+	QueryPerformanceFrequency(&freq);
+	return (double) count.QuadPart / freq.QuadPart;
+}
+#elif defined(__APPLE__) || defined(__APPLE_CC__)
+#include <Carbon/Carbon.h>
+
+CFBundleRef bundle;
+CFURLRef bundleURL;
+
+static void open_libgl(void)
+{
+	bundleURL = CFURLCreateWithFileSystemPath(kCFAllocatorDefault,
+		CFSTR("/System/Library/Frameworks/OpenGL.framework"),
+		kCFURLPOSIXPathStyle, true);
+
+	bundle = CFBundleCreate(kCFAllocatorDefault, bundleURL);
+	assert(bundle != NULL);
+}
+
+static void close_libgl(void)
+{
+	CFRelease(bundle);
+	CFRelease(bundleURL);
+}
+
+static GL3WglProc get_proc(const char *proc)
+{
+	GL3WglProc res;
+
+	CFStringRef procname = CFStringCreateWithCString(kCFAllocatorDefault, proc,
+		kCFStringEncodingASCII);
+	res = (GL3WglProc) CFBundleGetFunctionPointerForName(bundle, procname);
+	CFRelease(procname);
+	return res;
+}
+
+static double now(void)
+{
+	return CFAbsoluteTimeGetCurrent();
+}
+#else
+#include <dlfcn.h>
+#include <time.h>
+#include <GL/glx.h>
+
+static void *libgl;
+
+static void open_libgl(void)
+{
+	libgl = dlopen("libGL.so.1", RTLD_LAZY | RTLD_GLOBAL);
+}
+
+static void close_libgl(void)
+{
+	dlclose(libgl);
+}
+
+static GL3WglProc get_proc(const char *proc)
+{
+	GL3WglProc res;
+
+	res = (GL3WglProc) glXGetProcAddress((const GLubyte *) proc);
+	if (!res)
+		res = (GL3WglProc) dlsym(libgl, proc);
+	return res;
+}
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+#endif
+
+static struct {
+	int major, minor;
+} version;
+
+static int parse_version(void)
+{
+	if (!glGetIntegerv)
+		return -1;
+
+	glGetIntegerv(GL_MAJOR_VERSION, &version.major);
+	glGetIntegerv(GL_MINOR_VERSION, &version.minor);
+
+	if (version.major < 3)
+		return -1;
+	return 0;
+}
+
+static void load_procs(void);
+static void load_extensions(void);
+
+/* The library stays open for gl3wGetProcAddress() after init. */
+int gl3wInit(void)
+{
+	gl3wTrace(GL3W_TRACE_OFF);
+	if (!libgl) {
+		open_libgl();
+		atexit(close_libgl);
+	}
+	load_procs();
+	if (parse_version())
+		return -1;
+	load_extensions();
+	return 0;
+}
+
+int gl3wIsSupported(int major, int minor)
+{
+	if (major < 3)
+		return 0;
+	if (version.major == major)
+		return version.minor >= minor;
+	return version.major >= major;
+}
+
+''')
+        w('static const char *const proc_names[] = {\n')
+        for proc in procs:
+            w('\t"{0}",\n'.format(proc))
+        w('};\n\n')
+        w('/* Core version (major * 10 + minor) introducing each entry point,\n')
+        w(' * or 0 for extension entry points.\n */\n')
+        w('static const unsigned char proc_versions[] = {\n')
+        w(c_array([proc_version(features[p]) for p in procs], 20) + '\n')
+        w('};\n\n')
+        w('static const char *const ext_names[] = {\n')
+        for ext in exts:
+            w('\t"{0}",\n'.format(ext))
+        w('};\n\n')
+        w('/* Extension ID plus one, or 0 for core entry points. */\n')
+        w('static const unsigned char proc_exts[] = {\n')
+        ext_ids = [exts.index(features[p]) + 1 if features[p] in exts else 0
+                   for p in procs]
+        w(c_array(ext_ids, 20) + '\n')
+        w('};\n\n')
+        w('#define PROC_SEED1 0x%08xu\n' % seed1)
+        w('#define PROC_SEED2 0x%08xu\n\n' % seed2)
+        w('static const unsigned short proc_graph[%d] = {\n' % m)
+        w(c_array(g) + '\n')
+        w('};\n\n')
+        w(r'''static unsigned fnv1a(unsigned h, const char *s)
+{
+	while (*s)
+		h = ((h ^ (unsigned char) *s++) * 16777619u) & 0xffffffffu;
+	return h;
+}
+
+static unsigned proc_hash(unsigned h, const char *proc)
+{
+	return fnv1a(h, proc) % ARRAY_SIZE(proc_graph);
+}
+
+int gl3wProcIndex(const char *proc)
+{
+	unsigned a = proc_graph[proc_hash(PROC_SEED1, proc)];
+	unsigned b = proc_graph[proc_hash(PROC_SEED2, proc)];
+	unsigned slot = (a + b) % GL3W_PROC_COUNT;
+
+	if (strcmp(proc_names[slot], proc))
+		return -1;
+	return slot;
+}
+
+const char *gl3wProcName(int slot)
+{
+	if (slot < 0 || slot >= GL3W_PROC_COUNT)
+		return NULL;
+	return proc_names[slot];
+}
+
+static const GL3WglProc trace_procs[GL3W_PROC_COUNT];
+static union GL3WProcs real;
+static int trace_mode;
+
+static int is_stub(int slot);
+static void trace_resolved(int slot, GL3WglProc proc);
+
+static GL3WglProc lookup_proc(const char *proc)
+{
+	int slot = gl3wProcIndex(proc);
+
+	if (slot < 0)
+		return get_proc(proc);
+	if ((trace_mode ? !real.ptr[slot] : !gl3wProcs.ptr[slot]) ||
+	    is_stub(slot)) {
+		GL3WglProc res = get_proc(proc);
+
+		if (!res)
+			return NULL;
+		trace_resolved(slot, res);
+	}
+	return gl3wProcs.ptr[slot];
+}
+
+GL3WglProc gl3wGetProcAddress(const char *proc)
+{
+	return lookup_proc(proc);
+}
+
+int gl3wGetProcAddresses(const char *const *procs, GL3WglProc *res, int count)
+{
+	int i, j, found = 0;
+
+	for (i = 0; i < count; i++) {
+		res[i] = NULL;
+		if (gl3wProcIndex(procs[i]) < 0) {
+			for (j = 0; j < i; j++) {
+				if (!strcmp(procs[i], procs[j])) {
+					res[i] = res[j];
+					break;
+				}
+			}
+			if (j < i) {
+				found += res[i] != NULL;
+				continue;
+			}
+		}
+		res[i] = lookup_proc(procs[i]);
+		found += res[i] != NULL;
+	}
+	return found;
+}
+
+union GL3WProcs gl3wProcs;
+
+static void load_procs(void)
+{
+	size_t i;
+
+	for (i = 0; i < ARRAY_SIZE(proc_names); i++)
+		gl3wProcs.ptr[i] = get_proc(proc_names[i]);
+}
+
+static void missing_proc(int slot)
+{
+	fprintf(stderr, "gl3w: %s called but not loaded\n", proc_names[slot]);
+	abort();
+}
+
+#define STUB(i) static void stub##i(void) { missing_proc(i); }
+''')
+        for i in range(0, len(procs), 6):
+            w(' '.join('STUB(%d)' % j for j in range(i, min(i + 6, len(procs)))) + '\n')
+        w('\nstatic const GL3WglProc proc_stubs[GL3W_PROC_COUNT] = {\n')
+        for i in range(0, len(procs), 8):
+            w('\t' + ', '.join('stub%d' % j for j in range(i, min(i + 8, len(procs)))) + ',\n')
+        w('};\n')
+        w(r'''
+/* While tracing, gl3wProcs holds wrappers and the driver's entry
+ * points live in the real table.
+ */
+static int is_stub(int slot)
+{
+	if (trace_mode)
+		return real.ptr[slot] == proc_stubs[slot];
+	return gl3wProcs.ptr[slot] == proc_stubs[slot];
+}
+
+static const char *missing;
+
+const char *gl3wMissing(void)
+{
+	return missing;
+}
+
+unsigned gl3wExtensions[(GL3W_EXTENSION_COUNT + 31) / 32];
+
+/* Open addressing with linear probing, at most half full. The strings
+ * belong to the context and live as long as it does.
+ */
+static const char **ext_set;
+static unsigned ext_mask;
+
+static int ext_cmp(const void *a, const void *b)
+{
+	return strcmp((const char *) a, *(const char *const *) b);
+}
+
+/* ID of a known extension, or -1. */
+static int ext_id(const char *ext)
+{
+	const char *const *p = (const char *const *) bsearch(ext, ext_names,
+		ARRAY_SIZE(ext_names), sizeof(*ext_names), ext_cmp);
+
+	return p ? (int) (p - ext_names) : -1;
+}
+
+static void load_extensions(void)
+{
+	GLint i, n = 0;
+	unsigned h, size = 16;
+	const char *ext;
+	int id;
+
+	free(ext_set);
+	memset(gl3wExtensions, 0, sizeof(gl3wExtensions));
+	glGetIntegerv(GL_NUM_EXTENSIONS, &n);
+	while (size < 2 * (unsigned) n)
+		size *= 2;
+	ext_set = (const char **) calloc(size, sizeof(*ext_set));
+	if (!ext_set)
+		return;
+	ext_mask = size - 1;
+	for (i = 0; i < n; i++) {
+		ext = (const char *) glGetStringi(GL_EXTENSIONS, i);
+		if (!ext || gl3wIsExtensionSupported(ext))
+			continue;
+		for (h = fnv1a(2166136261u, ext); ext_set[h & ext_mask]; h++)
+			;
+		ext_set[h & ext_mask] = ext;
+		if ((id = ext_id(ext)) >= 0)
+			gl3wExtensions[id / 32] |= 1u << (id % 32);
+	}
+}
+
+int gl3wIsExtensionSupported(const char *ext)
+{
+	unsigned h;
+
+	if (!ext_set)
+		return 0;
+	for (h = fnv1a(2166136261u, ext); ext_set[h & ext_mask]; h++)
+		if (!strcmp(ext_set[h & ext_mask], ext))
+			return 1;
+	return 0;
+}
+
+enum { SKIP, OPTIONAL, REQUIRED };
+
+int gl3wInitSubset(const struct GL3WSubset *subset)
+{
+	static const char *const bootstrap[] = {
+		"glGetIntegerv", "glGetString", "glGetStringi"
+	};
+	unsigned char want[GL3W_PROC_COUNT];
+	const char *const *p;
+	int i, slot, ext, need, ret = GL3W_OK;
+
+	gl3wTrace(GL3W_TRACE_OFF);
+	if (!libgl) {
+		open_libgl();
+		atexit(close_libgl);
+	}
+	missing = NULL;
+	memcpy(gl3wProcs.ptr, proc_stubs, sizeof(proc_stubs));
+	for (i = 0; i < (int) ARRAY_SIZE(bootstrap); i++) {
+		GL3WglProc proc = get_proc(bootstrap[i]);
+
+		if (!proc)
+			return GL3W_ERROR_INIT;
+		gl3wProcs.ptr[gl3wProcIndex(bootstrap[i])] = proc;
+	}
+	if (parse_version())
+		return GL3W_ERROR_INIT;
+	load_extensions();
+	need = subset->major * 10 + subset->minor;
+	if (version.major * 10 + version.minor < need)
+		return GL3W_ERROR_OPENGL_VERSION;
+
+	for (i = 0; i < GL3W_PROC_COUNT; i++)
+		want[i] = proc_versions[i] && proc_versions[i] <= need ?
+			REQUIRED : SKIP;
+	for (p = subset->extensions; p && *p; p++) {
+		if (!gl3wIsExtensionSupported(*p)) {
+			if (!missing)
+				missing = *p;
+			ret = GL3W_ERROR_MISSING;
+			continue;
+		}
+		ext = ext_id(*p) + 1;
+		for (i = 0; ext && i < GL3W_PROC_COUNT; i++)
+			if (proc_exts[i] == ext)
+				want[i] = REQUIRED;
+	}
+	if (subset->procs) {
+		unsigned char listed[GL3W_PROC_COUNT] = {0};
+
+		for (p = subset->procs; *p; p++)
+			if ((slot = gl3wProcIndex(*p)) >= 0)
+				listed[slot] = 1;
+		for (i = 0; i < GL3W_PROC_COUNT; i++) {
+			if (!listed[i])
+				want[i] = SKIP;
+			else if (want[i] == SKIP)
+				want[i] = OPTIONAL;
+		}
+	}
+
+	for (i = 0; i < GL3W_PROC_COUNT; i++) {
+		GL3WglProc proc;
+
+		if (want[i] == SKIP)
+			continue;
+		proc = get_proc(proc_names[i]);
+		if (proc) {
+			gl3wProcs.ptr[i] = proc;
+		} else if (want[i] == REQUIRED) {
+			if (!missing)
+				missing = proc_names[i];
+			ret = GL3W_ERROR_MISSING;
+		}
+	}
+	return ret;
+}
+''')
+        write_trace(w, procs, protos)
+
+
+def write_trace(w, procs, protos):
+    w(CAPTURE_C)
+    w(r'''
+static struct GL3WTraceStat trace_stats[GL3W_PROC_COUNT];
+static int trace_reported[GL3W_PROC_COUNT];
+
+static void trace_resolved(int slot, GL3WglProc proc)
+{
+	if (trace_mode) {
+		real.ptr[slot] = proc;
+		gl3wProcs.ptr[slot] = trace_procs[slot];
+	} else {
+		gl3wProcs.ptr[slot] = proc;
+	}
+}
+
+void gl3wTrace(int mode)
+{
+	int i;
+
+	if (!capture_file)
+		mode &= ~GL3W_TRACE_CAPTURE;
+	/* A subset may have left glGetError() unloaded. */
+	if ((mode & GL3W_TRACE_ERRORS) == GL3W_TRACE_ERRORS)
+		lookup_proc("glGetError");
+	if (!trace_mode && mode) {
+		real = gl3wProcs;
+		for (i = 0; i < GL3W_PROC_COUNT; i++)
+			if (gl3wProcs.ptr[i])
+				gl3wProcs.ptr[i] = trace_procs[i];
+	} else if (trace_mode && !mode) {
+		gl3wProcs = real;
+	}
+	trace_mode = mode;
+}
+
+int gl3wTraceMode(void)
+{
+	return trace_mode;
+}
+
+const struct GL3WTraceStat *gl3wTraceStats(void)
+{
+	return trace_stats;
+}
+
+void gl3wTraceReset(void)
+{
+	memset(trace_stats, 0, sizeof(trace_stats));
+	memset(trace_reported, 0, sizeof(trace_reported));
+}
+
+/* Other threads' contexts, such as a streaming worker's, dispatch
+ * through the same table, so the statistics are updated atomically
+ * where the compiler has the GNU builtins for it.
+ */
+#ifdef __GNUC__
+static void add_count(unsigned long *count)
+{
+	__atomic_fetch_add(count, 1, __ATOMIC_RELAXED);
+}
+
+static void add_seconds(double *sum, double seconds)
+{
+	double old;
+
+	__atomic_load(sum, &old, __ATOMIC_RELAXED);
+	while (!__atomic_compare_exchange(sum, &old, &(double){old + seconds},
+					  1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+		;
+}
+
+/* Sets *flag and returns whether it was clear. */
+static int first_time(int *flag)
+{
+	return !__atomic_exchange_n(flag, 1, __ATOMIC_RELAXED);
+}
+#else
+static void add_count(unsigned long *count)
+{
+	++*count;
+}
+
+static void add_seconds(double *sum, double seconds)
+{
+	*sum += seconds;
+}
+
+static int first_time(int *flag)
+{
+	int old = *flag;
+
+	*flag = 1;
+	return !old;
+}
+#endif
+
+static void trace_end(int slot, double start)
+{
+	GLenum err;
+
+	add_count(&trace_stats[slot].calls);
+	add_seconds(&trace_stats[slot].seconds, now() - start);
+	if ((trace_mode & GL3W_TRACE_ERRORS) != GL3W_TRACE_ERRORS ||
+	    slot == GETERROR_SLOT)
+		return;
+	while ((err = real.gl.GetError()) != GL_NO_ERROR) {
+		add_count(&trace_stats[slot].errors);
+		if (first_time(&trace_reported[slot])) {
+			fprintf(stderr, "gl3w: %s: error 0x%04x\n",
+				proc_names[slot], (unsigned) err);
+		}
+	}
+}
+'''.replace('GETERROR_SLOT', str(procs.index('glGetError'))))
+    for slot, proc in enumerate(procs):
+        ret, params = protos[proc]
+        decl = ', '.join(p for p, _ in params) or 'void'
+        args = ', '.join(n for _, n in params)
+        assert not {'t0', 'res', 'rs', 'rx'} & set(n for _, n in params)
+        assert not [n for _, n in params if n.startswith('c_')]
+        spec = classify(proc, ret, params)
+        sep = '' if ret.endswith('*') else ' '
+        w('\nstatic {0}{1}APIENTRY trace_{2}({3})\n{{\n'.format(ret, sep, proc[2:], decl))
+        if ret != 'void':
+            w('\t{0}{1}res;\n'.format(ret, sep))
+        w('\tdouble t0 = now();\n\n')
+        if proc in UNMAPS:
+            named, key, flush = UNMAPS[proc]
+            w('\tif (trace_mode & GL3W_TRACE_CAPTURE)\n')
+            w('\t\tcapture_unmap({0}, {1}, {2});\n'.format(
+                named, key, ', '.join(flush) if flush else '0, -1'))
+        call = 'real.gl.{0}({1})'.format(proc[2:], args)
+        if ret != 'void':
+            w('\tres = {0};\n'.format(call))
+        else:
+            w('\t{0};\n'.format(call))
+        w('\ttrace_end({0}, t0);\n'.format(slot))
+        w('\tif (trace_mode & GL3W_TRACE_CAPTURE) {\n')
+        if spec is None:
+            w('\t\tcapture_unsupported({0}, t0);\n'.format(slot))
+        else:
+            w('\t\tcapture_begin({0}, t0);\n'.format(slot))
+            for line in capture_stmts(proc, ret, spec):
+                w('\t\t' + line + '\n')
+            w('\t\tcapture_end();\n')
+        w('\t}\n')
+        if ret != 'void':
+            w('\treturn res;\n')
+        w('}\n')
+    w('\nstatic const GL3WglProc trace_procs[GL3W_PROC_COUNT] = {\n')
+    for proc in procs:
+        w('\t(GL3WglProc) trace_{0},\n'.format(proc[2:]))
+    w('};\n')
+
+
+
+
+# Capture and replay. Every wrapper can serialize its call into a trace
+# file, and gl3w_replay.c decodes and re-issues those calls. Parameters
+# are classified below into scalar kinds, object names remapped at
+# replay, and pointers whose referenced data is either copied into the
+# trace or, in the core profile, an offset into a bound buffer.
+# Entry points with pointers that can't be classified are recorded as
+# unsupported and skipped by replay.
+
+SCALARS = {
+    'GLenum': 'u32', 'GLboolean': 'u32', 'GLbitfield': 'u32',
+    'GLint': 'u32', 'GLuint': 'u32', 'GLsizei': 'u32', 'GLshort': 'u32',
+    'GLubyte': 'u32', 'GLfloat': 'f32', 'GLdouble': 'f64',
+    'GLintptr': 'u64', 'GLsizeiptr': 'u64', 'GLuint64': 'u64',
+    'GLuint64EXT': 'u64', 'GLsync': 'sync',
+}
+
+ELEMENT_SIZES = {
+    'b': 1, 'ub': 1, 's': 2, 'us': 2, 'i': 4, 'ui': 4, 'f': 4, 'd': 8,
+    'ui64ARB': 8, 'Handleui64ARB': 8,
+}
+
+NAMESPACES = {
+    'buffer': 'BUFFER', 'buffers': 'BUFFER',
+    'readBuffer': 'BUFFER', 'writeBuffer': 'BUFFER',
+    'texture': 'TEXTURE', 'textures': 'TEXTURE', 'origtexture': 'TEXTURE',
+    'array': 'VERTEX_ARRAY', 'arrays': 'VERTEX_ARRAY',
+    'vaobj': 'VERTEX_ARRAY',
+    'framebuffer': 'FRAMEBUFFER', 'framebuffers': 'FRAMEBUFFER',
+    'readFramebuffer': 'FRAMEBUFFER', 'drawFramebuffer': 'FRAMEBUFFER',
+    'renderbuffer': 'RENDERBUFFER', 'renderbuffers': 'RENDERBUFFER',
+    'sampler': 'SAMPLER', 'samplers': 'SAMPLER',
+    'program': 'PROGRAM', 'shader': 'PROGRAM', 'shaders': 'PROGRAM',
+    'pipeline': 'PIPELINE', 'pipelines': 'PIPELINE',
+    'xfb': 'TRANSFORM_FEEDBACK',
+}
+
+UNSUPPORTED = {
+    'glCompileShaderIncludeARB', 'glCreateSyncFromCLeventARB',
+    'glDebugMessageCallback', 'glDebugMessageCallbackARB',
+    'glDeleteNamedStringARB', 'glGetCompressedTexImage',
+    'glGetNamedStringARB', 'glGetNamedStringivARB', 'glGetObjectPtrLabel',
+    'glGetTexImage', 'glIsNamedStringARB', 'glNamedStringARB',
+    'glObjectPtrLabel',
+}
+
+MAPS = {
+    'glMapBuffer': ('0', 'target', 'capture_buffer_size(0, target)',
+                    'access == GL_READ_ONLY ? GL_MAP_READ_BIT : GL_MAP_WRITE_BIT'),
+    'glMapBufferRange': ('0', 'target', 'length', 'access'),
+    'glMapNamedBuffer': ('1', 'buffer', 'capture_buffer_size(1, buffer)',
+                         'access == GL_READ_ONLY ? GL_MAP_READ_BIT : GL_MAP_WRITE_BIT'),
+    'glMapNamedBufferRange': ('1', 'buffer', 'length', 'access'),
+}
+
+UNMAPS = {
+    'glUnmapBuffer': ('0', 'target', None),
+    'glUnmapNamedBuffer': ('1', 'buffer', None),
+    'glFlushMappedBufferRange': ('0', 'target', ('offset', 'length')),
+    'glFlushMappedNamedBufferRange': ('1', 'buffer', ('offset', 'length')),
+}
+
+
+def namespace(proc, name):
+    if name in ('id', 'ids'):
+        if 'Quer' in proc:
+            return 'QUERY'
+        if 'TransformFeedback' in proc:
+            return 'TRANSFORM_FEEDBACK'
+        return None
+    return NAMESPACES.get(name)
+
+
+def base_type(decl):
+    decl = re.sub(r'\bconst\b', '', decl)
+    return decl.replace('*', ' ').split()[0]
+
+
+def pointer_size(proc, name, names):
+    """Byte count of the data behind an input pointer, as a C expression."""
+    m = re.match(r'gl(Program)?Uniform([1-4])(f|d|i|ui)v$', proc)
+    if m:
+        return 'count * %d' % (int(m.group(2)) * ELEMENT_SIZES[m.group(3)])
+    m = re.match(r'gl(Program)?UniformMatrix([2-4])(x([2-4]))?(f|d)v$', proc)
+    if m:
+        rows = int(m.group(4) or m.group(2))
+        return 'count * %d' % (int(m.group(2)) * rows * ELEMENT_SIZES[m.group(5)])
+    if re.match(r'gl(Program)?UniformHandleui64vARB$', proc):
+        return 'count * 8'
+    m = re.match(r'glVertexAttrib[IL]?([1-4])N?(b|s|i|f|d|ub|us|ui|ui64ARB)v$', proc)
+    if m:
+        return '%d' % (int(m.group(1)) * ELEMENT_SIZES[m.group(2)])
+    if re.match(r'glVertexAttribP[1-4]uiv$', proc):
+        return '4'
+    if re.match(r'gl(Tex|Texture|Sampler)Parameter(I?iv|I?uiv|fv)$', proc):
+        return 'capture_param_size(pname)'
+    if proc == 'glVertexAttribL1ui64vARB':
+        return '8'
+    if proc in ('glPointParameterfv', 'glPointParameteriv'):
+        return '4'
+    if proc == 'glPatchParameterfv':
+        return 'pname == GL_PATCH_DEFAULT_OUTER_LEVEL ? 16 : 8'
+    if re.match(r'glClear(Buffer|NamedFramebuffer)(f|i|ui)v$', proc):
+        return 'buffer == GL_COLOR ? 16 : 4'
+    if re.match(r'glClear(Named)?Buffer(Sub)?Data$|glClearTex(Sub)?Image$', proc):
+        return 'capture_pixel_size(format, type)'
+    if proc in ('glViewportIndexedfv', 'glScissorIndexedv'):
+        return '16'
+    if proc in ('glViewportArrayv', 'glScissorArrayv'):
+        return 'count * 16'
+    if proc == 'glDepthRangeArrayv':
+        return 'count * 16'
+    if 'size' in names and name == 'data':
+        return 'size'
+    if proc in ('glProgramBinary', 'glShaderBinary'):
+        return 'length'
+    if 'imageSize' in names:
+        return 'imageSize'
+    for count in ('drawcount', 'n', 'count', 'numAttachments', 'propCount',
+                  'uniformCount'):
+        if count in names:
+            if name in ('offsets', 'sizes'):
+                return '%s * 8' % count
+            return '%s * 4' % count
+    return None
+
+
+def classify(proc, ret, params):
+    """Returns ([(decl, name, kind, arg)], return kind) or None."""
+    if proc in UNSUPPORTED:
+        return None
+    names = [n for _, n in params]
+    has_program = 'program' in names
+    out = []
+    for decl, name in params:
+        t = base_type(decl)
+        if '*' not in decl:
+            if t not in SCALARS:
+                return None
+            kind = SCALARS[t]
+            ns = namespace(proc, name) if t == 'GLuint' else None
+            if ns:
+                out.append((decl, name, 'name', ns))
+            elif t == 'GLint' and name == 'location' and 'Uniform' in proc:
+                out.append((decl, name, 'loc', 'program' if has_program else None))
+            else:
+                out.append((decl, name, kind, t))
+        elif not decl.startswith('const'):
+            if re.match(r'gl(Gen|Create)\w+s$', proc) and name != 'params':
+                out.append((decl, name, 'names_out',
+                            (namespace(proc, name), names[-2])))
+            elif proc in ('glReadPixels', 'glReadnPixels', 'glReadnPixelsARB'):
+                out.append((decl, name, 'pack', None))
+            elif proc in ('glGetBufferSubData', 'glGetNamedBufferSubData'):
+                out.append((decl, name, 'out', 'size'))
+            elif 'bufSize' in names:
+                out.append((decl, name, 'out', 'bufSize * 8'))
+            else:
+                out.append((decl, name, 'out', None))
+        elif t == 'GLchar' and decl.count('*') == 1:
+            counted = 'length' in names and names.index('length') < names.index(name)
+            out.append((decl, name, 'string', 'length' if counted else None))
+        elif t == 'GLchar':
+            count = 'uniformCount' if 'uniformCount' in names else 'count'
+            lengths = 'length' if 'length' in names else None
+            out.append((decl, name, 'strings', (count, lengths)))
+        elif proc == 'glShaderSource' and name == 'length':
+            out.append((decl, name, 'skip', None))
+        elif name in ('pointer', 'indirect') or \
+                (name == 'indices' and proc.startswith('glDraw')):
+            out.append((decl, name, 'offset', None))
+        elif name == 'indices' and proc.startswith('glMultiDrawElements'):
+            out.append((decl, name, 'offsets', 'drawcount'))
+        elif re.match(r'gl(Tex|Texture)(Sub)?Image[1-3]D$', proc):
+            dims = {'1': 'width, 1, 1', '2': 'width, height, 1',
+                    '3': 'width, height, depth'}[proc[-2]]
+            out.append((decl, name, 'pixels',
+                        'capture_image_size(format, type, %s)' % dims))
+        elif re.match(r'glCompressedTex(ture)?(Sub)?Image[1-3]D$', proc):
+            out.append((decl, name, 'pixels', 'imageSize'))
+        elif t == 'GLuint' and namespace(proc, name):
+            size = pointer_size(proc, name, names)
+            if size is None:
+                return None
+            out.append((decl, name, 'names_in', (namespace(proc, name), size)))
+        else:
+            size = pointer_size(proc, name, names)
+            if size is None:
+                return None
+            out.append((decl, name, 'data', size))
+    if proc in ('glCreateProgram', 'glCreateShader', 'glCreateShaderProgramv'):
+        rkind = 'program'
+    elif proc == 'glGetUniformLocation':
+        rkind = 'location'
+    elif proc == 'glFenceSync':
+        rkind = 'sync'
+    elif proc in MAPS:
+        rkind = 'map'
+    else:
+        rkind = None
+    return out, rkind
+
+
+def capture_stmts(proc, ret, spec):
+    params, rkind = spec
+    lines = []
+    for decl, name, kind, arg in params:
+        if kind in ('u32', 'name', 'loc'):
+            lines.append('capture_u32((GLuint) %s);' % name)
+        elif kind == 'f32':
+            lines.append('capture_f32(%s);' % name)
+        elif kind == 'f64':
+            lines.append('capture_f64(%s);' % name)
+        elif kind == 'u64':
+            lines.append('capture_u64((GLuint64) %s);' % name)
+        elif kind == 'sync':
+            lines.append('capture_u64((GLuint64) (size_t) %s);' % name)
+        elif kind == 'offset':
+            lines.append('capture_u64((GLuint64) (size_t) %s);' % name)
+        elif kind == 'offsets':
+            lines.append('capture_offsets(%s, %s);' % (name, arg))
+        elif kind == 'string':
+            lines.append('capture_string(%s, %s);' % (name, arg or '-1'))
+        elif kind == 'strings':
+            lines.append('capture_strings(%s, %s, %s);' %
+                         (arg[0], name, arg[1] or 'NULL'))
+        elif kind in ('data', 'names_in'):
+            size = arg[1] if kind == 'names_in' else arg
+            lines.append('capture_data(%s, %s);' % (name, size))
+        elif kind == 'names_out':
+            lines.append('capture_data(%s, %s * 4);' % (name, arg[1]))
+        elif kind == 'pixels':
+            lines.append('capture_pixels(%s, %s);' % (name, arg))
+        elif kind == 'pack':
+            lines.append('capture_pack(%s);' % name)
+    if rkind in ('program', 'location'):
+        lines.append('capture_u32((GLuint) res);')
+    elif rkind == 'sync':
+        lines.append('capture_u64((GLuint64) (size_t) res);')
+    elif rkind == 'map':
+        lines.append('capture_map(%s, %s, res, %s, %s);' % MAPS[proc])
+    return lines
+
+
+def replay_case(slot, proc, ret, spec):
+    params, rkind = spec
+    decls = []
+    post = []
+    pre = []
+    for decl, name, kind, arg in params:
+        t = base_type(decl)
+        if kind == 'u32':
+            decls.append('%s = (%s) rd_u32(rx);' % (decl, t))
+        elif kind == 'f32':
+            decls.append('%s = rd_f32(rx);' % decl.replace('const ', ''))
+        elif kind == 'f64':
+            decls.append('%s = rd_f64(rx);' % decl)
+        elif kind == 'u64':
+            decls.append('%s = (%s) rd_u64(rx);' % (decl, t))
+        elif kind == 'sync':
+            decls.append('%s = replay_sync(rs, rd_u64(rx));' % decl)
+        elif kind == 'name':
+            decls.append('%s = remap(rs, NS_%s, rd_u32(rx));' % (decl, arg))
+        elif kind == 'loc':
+            decls.append('%s = remap_location(rs, %s, (GLint) rd_u32(rx));' %
+                         (decl, arg or 'rs->program'))
+        elif kind == 'offset':
+            decls.append('%s = (const void *) (size_t) rd_u64(rx);' % decl)
+        elif kind == 'offsets':
+            decls.append('%s = rd_offsets(rs, rx);' % decl)
+        elif kind == 'string':
+            decls.append('%s = rd_string(rx);' % decl)
+        elif kind == 'strings':
+            decls.append('%s = rd_strings(rs, rx);' % decl)
+        elif kind == 'skip':
+            decls.append('%s = NULL;' % decl)
+        elif kind == 'data':
+            decls.append('%s = rd_data(rx);' % decl)
+        elif kind == 'names_in':
+            decls.append('%s = rd_names(rs, rx, NS_%s);' % (decl, arg[0]))
+        elif kind == 'names_out':
+            decls.append('const GLuint *c_%s = rd_data(rx);' % name)
+            decls.append('%s = rd_out(rs, %s * 4);' % (decl, arg[1]))
+            post.append('remap_names(rs, NS_%s, c_%s, %s, %s);' %
+                        (arg[0], name, name, arg[1]))
+        elif kind == 'pixels':
+            decls.append('%s = rd_pixels(rx);' % decl)
+        elif kind == 'pack':
+            decls.append('%s = rd_pack(rs, rx, (size_t) width * height * 16);' % decl)
+        elif kind == 'out':
+            decls.append('%s = rd_out(rs, %s);' % (decl, arg or 'REPLAY_OUT_SIZE'))
+    args = ', '.join(n for _, n, _, _ in params)
+    if rkind in ('program', 'location'):
+        decls.append('GLint c_res = (GLint) rd_u32(rx);')
+    elif rkind == 'sync':
+        decls.append('GLuint64 c_res = rd_u64(rx);')
+    if rkind == 'program':
+        post.append('set_name(rs, NS_PROGRAM, c_res, res);')
+    elif rkind == 'location':
+        post.append('set_location(rs, program, c_res, res);')
+    elif rkind == 'sync':
+        post.append('set_sync(rs, c_res, res);')
+    elif rkind == 'map':
+        named, key, size = MAPS[proc][:3]
+        size = size.replace('capture_buffer_size', 'replay_buffer_size')
+        post.append('set_map(rs, %s, %s, res, %s);' % (named, key, size))
+    if proc in UNMAPS and UNMAPS[proc][2] is None:
+        post.append('set_map(rs, %s, %s, NULL, 0);' % UNMAPS[proc][:2])
+    if proc == 'glUseProgram':
+        post.append('rs->program = program;')
+    if rkind:
+        sep = '' if ret.endswith('*') else ' '
+        decls.append('%s%sres;' % (ret, sep))
+        call = 'res = %s(%s);' % (proc, args)
+    else:
+        call = '%s(%s);' % (proc, args)
+    lines = ['case %d: {' % slot]
+    lines += ['\t' + d for d in decls]
+    if decls:
+        lines.append('')
+    lines += ['\t' + p for p in pre]
+    lines.append('\t' + call)
+    lines += ['\t' + p for p in post]
+    lines.append('\tbreak;')
+    lines.append('}')
+    return lines
+
+
+CAPTURE_C = r'''
+/* Capture. A trace file starts with the magic "GL3WTRC", a version and
+ * a byte order mark, each 32-bit, followed by records. A record has a
+ * 16-byte header (16-bit slot, 16-bit flags, 32-bit payload length,
+ * 64-bit nanoseconds since the capture started) and a payload of the
+ * call's arguments in parameter order. Blobs are length prefixed and
+ * 8-byte aligned in the file so replay can use them in place.
+ */
+#define CAPTURE_VERSION     1
+#define CAPTURE_FRAME       0xffff
+#define CAPTURE_NAME        0xfffe
+#define CAPTURE_MAPDATA     0xfffd
+#define CAPTURE_UNSUPPORTED 1
+
+struct capture_mapping {
+	int named;
+	GLuint key;
+	unsigned char *ptr;
+	GLsizeiptr length;
+	GLbitfield access;
+};
+
+static FILE *capture_file;
+static unsigned char *capture_buf;
+static size_t capture_len, capture_cap, capture_start;
+static GLuint64 capture_pos;
+static double capture_epoch;
+static unsigned char capture_named[(GL3W_PROC_COUNT + 7) / 8];
+static struct capture_mapping capture_maps[16];
+
+static void capture_put(const void *data, size_t len)
+{
+	if (capture_len + len > capture_cap) {
+		size_t cap = capture_cap ? capture_cap : 4096;
+		unsigned char *buf;
+
+		while (cap < capture_len + len)
+			cap *= 2;
+		buf = (unsigned char *) realloc(capture_buf, cap);
+		if (!buf) {
+			fprintf(stderr, "gl3w: capture: out of memory\n");
+			abort();
+		}
+		capture_buf = buf;
+		capture_cap = cap;
+	}
+	memcpy(capture_buf + capture_len, data, len);
+	capture_len += len;
+}
+
+static void capture_u16(unsigned short v) { capture_put(&v, sizeof(v)); }
+static void capture_u32(GLuint v) { capture_put(&v, sizeof(v)); }
+static void capture_u64(GLuint64 v) { capture_put(&v, sizeof(v)); }
+static void capture_f32(GLfloat v) { capture_put(&v, sizeof(v)); }
+static void capture_f64(GLdouble v) { capture_put(&v, sizeof(v)); }
+
+static void capture_align(void)
+{
+	static const unsigned char zero[8];
+
+	capture_put(zero, (8 - (capture_pos + capture_len) % 8) % 8);
+}
+
+static void capture_blob(const void *data, size_t len)
+{
+	capture_u32((GLuint) len);
+	capture_align();
+	capture_put(data, len);
+}
+
+static void capture_header(unsigned short slot, unsigned short flags, double t)
+{
+	capture_start = capture_len;
+	capture_u16(slot);
+	capture_u16(flags);
+	capture_u32(0);
+	capture_u64((GLuint64) ((t - capture_epoch) * 1e9));
+}
+
+static void capture_end(void)
+{
+	GLuint len = (GLuint) (capture_len - capture_start - 16);
+
+	memcpy(capture_buf + capture_start + 4, &len, sizeof(len));
+	if (fwrite(capture_buf, capture_len, 1, capture_file) != 1)
+		fprintf(stderr, "gl3w: capture: write failed\n");
+	capture_pos += capture_len;
+	capture_len = 0;
+}
+
+static void capture_begin(int slot, double t)
+{
+	if (!(capture_named[slot / 8] & (1 << (slot % 8)))) {
+		capture_named[slot / 8] |= 1 << (slot % 8);
+		capture_header(CAPTURE_NAME, 0, t);
+		capture_u32(slot);
+		capture_blob(proc_names[slot], strlen(proc_names[slot]) + 1);
+		capture_end();
+	}
+	capture_header((unsigned short) slot, 0, t);
+}
+
+static void capture_unsupported(int slot, double t)
+{
+	capture_begin(slot, t);
+	memcpy(capture_buf + capture_start + 2, "\1\0", 2);
+	capture_end();
+}
+
+/* Pointers come in three flavors: 0 for NULL, 1 for an offset into a
+ * bound buffer, 2 for data copied into the trace.
+ */
+static void capture_data(const void *data, GLsizeiptr len)
+{
+	if (!data) {
+		capture_u32(0);
+	} else {
+		capture_u32(2);
+		capture_blob(data, len > 0 ? (size_t) len : 0);
+	}
+}
+
+static void capture_pixels(const void *data, GLsizeiptr len)
+{
+	GLint buffer = 0;
+
+	real.gl.GetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING, &buffer);
+	if (buffer) {
+		capture_u32(1);
+		capture_u64((GLuint64) (size_t) data);
+	} else {
+		capture_data(data, len);
+	}
+}
+
+static void capture_pack(const void *data)
+{
+	GLint buffer = 0;
+
+	real.gl.GetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &buffer);
+	if (buffer) {
+		capture_u32(1);
+		capture_u64((GLuint64) (size_t) data);
+	} else {
+		capture_u32(0);
+	}
+}
+
+static void capture_string(const GLchar *s, GLsizei len)
+{
+	/* A NULL string is recorded as an empty one */
+	if (!s) {
+		s = "";
+		len = 0;
+	} else if (len < 0) {
+		len = (GLsizei) strlen(s);
+	}
+	capture_u32(len + 1);
+	capture_align();
+	capture_put(s, len);
+	capture_put("", 1);
+}
+
+static void capture_strings(GLsizei count, const GLchar *const *s,
+			    const GLint *lens)
+{
+	GLsizei i;
+
+	capture_u32(count);
+	for (i = 0; i < count; i++)
+		capture_string(s[i], lens ? lens[i] : -1);
+}
+
+static void capture_offsets(const void *const *offsets, GLsizei count)
+{
+	GLsizei i;
+
+	capture_u32(count);
+	for (i = 0; i < count; i++)
+		capture_u64((GLuint64) (size_t) offsets[i]);
+}
+
+static size_t capture_param_size(GLenum pname)
+{
+	switch (pname) {
+	case GL_TEXTURE_BORDER_COLOR:
+	case GL_TEXTURE_SWIZZLE_RGBA:
+		return 16;
+	}
+	return 4;
+}
+
+static size_t capture_pixel_size(GLenum format, GLenum type)
+{
+	size_t components, size;
+
+	switch (type) {
+	case GL_UNSIGNED_BYTE_3_3_2:
+	case GL_UNSIGNED_BYTE_2_3_3_REV:
+		return 1;
+	case GL_UNSIGNED_SHORT_5_6_5:
+	case GL_UNSIGNED_SHORT_5_6_5_REV:
+	case GL_UNSIGNED_SHORT_4_4_4_4:
+	case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+	case GL_UNSIGNED_SHORT_5_5_5_1:
+	case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+		return 2;
+	case GL_UNSIGNED_INT_8_8_8_8:
+	case GL_UNSIGNED_INT_8_8_8_8_REV:
+	case GL_UNSIGNED_INT_10_10_10_2:
+	case GL_UNSIGNED_INT_2_10_10_10_REV:
+	case GL_UNSIGNED_INT_24_8:
+	case GL_UNSIGNED_INT_10F_11F_11F_REV:
+	case GL_UNSIGNED_INT_5_9_9_9_REV:
+		return 4;
+	case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+		return 8;
+	case GL_SHORT:
+	case GL_UNSIGNED_SHORT:
+	case GL_HALF_FLOAT:
+		size = 2;
+		break;
+	case GL_INT:
+	case GL_UNSIGNED_INT:
+	case GL_FLOAT:
+		size = 4;
+		break;
+	default:
+		size = 1;
+	}
+	switch (format) {
+	case GL_RG:
+	case GL_RG_INTEGER:
+	case GL_DEPTH_STENCIL:
+		components = 2;
+		break;
+	case GL_RGB:
+	case GL_BGR:
+	case GL_RGB_INTEGER:
+	case GL_BGR_INTEGER:
+		components = 3;
+		break;
+	case GL_RGBA:
+	case GL_BGRA:
+	case GL_RGBA_INTEGER:
+	case GL_BGRA_INTEGER:
+		components = 4;
+		break;
+	default:
+		components = 1;
+	}
+	return components * size;
+}
+
+/* Honors GL_UNPACK_ALIGNMENT but not the other unpack parameters. */
+static size_t capture_image_size(GLenum format, GLenum type,
+				 GLsizei width, GLsizei height, GLsizei depth)
+{
+	GLint align = 4;
+	size_t row, stride;
+
+	if (width <= 0 || height <= 0 || depth <= 0)
+		return 0;
+	real.gl.GetIntegerv(GL_UNPACK_ALIGNMENT, &align);
+	row = capture_pixel_size(format, type) * width;
+	stride = (row + align - 1) / align * align;
+	return stride * ((size_t) height * depth - 1) + row;
+}
+
+static GLsizeiptr capture_buffer_size(int named, GLuint key)
+{
+	GLint64 size = 0;
+
+	if (named)
+		real.gl.GetNamedBufferParameteri64v(key, GL_BUFFER_SIZE, &size);
+	else
+		real.gl.GetBufferParameteri64v(key, GL_BUFFER_SIZE, &size);
+	return (GLsizeiptr) size;
+}
+
+static struct capture_mapping *capture_find(int named, GLuint key)
+{
+	size_t i;
+
+	for (i = 0; i < ARRAY_SIZE(capture_maps); i++)
+		if (capture_maps[i].ptr && capture_maps[i].named == named &&
+		    capture_maps[i].key == key)
+			return capture_maps + i;
+	return NULL;
+}
+
+static void capture_map(int named, GLuint key, void *ptr,
+			GLsizeiptr length, GLbitfield access)
+{
+	struct capture_mapping *m = capture_find(named, key);
+	size_t i;
+
+	for (i = 0; !m && i < ARRAY_SIZE(capture_maps); i++)
+		if (!capture_maps[i].ptr)
+			m = capture_maps + i;
+	if (!m || !ptr)
+		return;
+	m->named = named;
+	m->key = key;
+	m->ptr = (unsigned char *) ptr;
+	m->length = length;
+	m->access = access;
+}
+
+/* Writes through a mapping are invisible to the wrappers, so they are
+ * recorded when flushed or unmapped. Persistent mappings that are
+ * never flushed explicitly can't be captured.
+ */
+static void capture_unmap(int named, GLuint key, GLintptr offset,
+			  GLsizeiptr length)
+{
+	struct capture_mapping *m = capture_find(named, key);
+
+	if (!m)
+		return;
+	if (length < 0 && (!(m->access & GL_MAP_WRITE_BIT) ||
+			   (m->access & GL_MAP_FLUSH_EXPLICIT_BIT))) {
+		m->ptr = NULL;
+		return;
+	}
+	if (length < 0)
+		length = m->length;
+	capture_header(CAPTURE_MAPDATA, 0, now());
+	capture_u32(named);
+	capture_u32(key);
+	capture_u64(offset);
+	capture_blob(m->ptr + offset, length);
+	capture_end();
+	if (offset == 0 && length == m->length && !(m->access & GL_MAP_FLUSH_EXPLICIT_BIT))
+		m->ptr = NULL;
+}
+
+int gl3wCaptureStart(const char *path)
+{
+	GLuint header[4];
+
+	gl3wCaptureStop();
+	capture_file = fopen(path, "wb");
+	if (!capture_file)
+		return -1;
+	memcpy(header, "GL3WTRC", 8);
+	header[2] = CAPTURE_VERSION;
+	header[3] = 0x01020304;
+	fwrite(header, sizeof(header), 1, capture_file);
+	capture_pos = sizeof(header);
+	capture_epoch = now();
+	lookup_proc("glGetBufferParameteri64v");
+	gl3wTrace(trace_mode | GL3W_TRACE_CAPTURE);
+	return 0;
+}
+
+void gl3wCaptureFrame(void)
+{
+	if (!(trace_mode & GL3W_TRACE_CAPTURE))
+		return;
+	capture_header(CAPTURE_FRAME, 0, now());
+	capture_end();
+}
+
+void gl3wCaptureStop(void)
+{
+	if (!capture_file)
+		return;
+	gl3wTrace(trace_mode & ~GL3W_TRACE_CAPTURE);
+	fclose(capture_file);
+	capture_file = NULL;
+	free(capture_buf);
+	capture_buf = NULL;
+	capture_len = capture_cap = 0;
+	memset(capture_named, 0, sizeof(capture_named));
+	memset(capture_maps, 0, sizeof(capture_maps));
+}
+'''
+
+
+REPLAY_C = r'''#if !defined(_WIN32) && !defined(__APPLE__) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <GL/gl3w.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN 1
+#include <windows.h>
+
+static double now(void)
+{
+	LARGE_INTEGER count, freq;
+
+	QueryPerformanceCounter(&count);
+	QueryPerformanceFrequency(&freq);
+	return (double) count.QuadPart / freq.QuadPart;
+}
+
+static void pause_for(double seconds)
+{
+	Sleep((DWORD) (seconds * 1e3));
+}
+#else
+#include <time.h>
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void pause_for(double seconds)
+{
+	struct timespec ts;
+
+	ts.tv_sec = (time_t) seconds;
+	ts.tv_nsec = (long) ((seconds - ts.tv_sec) * 1e9);
+	nanosleep(&ts, NULL);
+}
+#endif
+
+#define ARRAY_SIZE(x)  (sizeof(x) / sizeof((x)[0]))
+
+#define REPLAY_FRAME       0xffff
+#define REPLAY_NAME        0xfffe
+#define REPLAY_MAPDATA     0xfffd
+#define REPLAY_UNSUPPORTED 1
+#define REPLAY_OUT_SIZE    65536
+
+enum {
+	NS_BUFFER, NS_TEXTURE, NS_VERTEX_ARRAY, NS_FRAMEBUFFER,
+	NS_RENDERBUFFER, NS_SAMPLER, NS_QUERY, NS_TRANSFORM_FEEDBACK,
+	NS_PROGRAM, NS_PIPELINE, NS_COUNT
+};
+
+struct reader {
+	const unsigned char *base, *p, *end;
+	int error;
+};
+
+struct location {
+	GLuint program;
+	GLint captured, replayed;
+};
+
+struct sync {
+	GLuint64 captured;
+	GLsync replayed;
+};
+
+struct mapping {
+	int named;
+	GLuint key;
+	unsigned char *ptr;
+	GLuint64 len;
+};
+
+struct replay {
+	GLuint *names[NS_COUNT];
+	size_t names_len[NS_COUNT];
+	struct location *locations;
+	size_t nlocations;
+	struct sync *syncs;
+	size_t nsyncs;
+	struct mapping maps[16];
+	void *scratch[64];
+	int nscratch;
+	GLuint program;
+};
+
+static int take(struct reader *r, size_t len)
+{
+	if (r->error || (size_t) (r->end - r->p) < len) {
+		r->error = 1;
+		return 0;
+	}
+	return 1;
+}
+
+static GLuint rd_u32(struct reader *r)
+{
+	GLuint v = 0;
+
+	if (take(r, sizeof(v))) {
+		memcpy(&v, r->p, sizeof(v));
+		r->p += sizeof(v);
+	}
+	return v;
+}
+
+static GLuint64 rd_u64(struct reader *r)
+{
+	GLuint64 v = 0;
+
+	if (take(r, sizeof(v))) {
+		memcpy(&v, r->p, sizeof(v));
+		r->p += sizeof(v);
+	}
+	return v;
+}
+
+static GLfloat rd_f32(struct reader *r)
+{
+	GLfloat v = 0;
+
+	if (take(r, sizeof(v))) {
+		memcpy(&v, r->p, sizeof(v));
+		r->p += sizeof(v);
+	}
+	return v;
+}
+
+static GLdouble rd_f64(struct reader *r)
+{
+	GLdouble v = 0;
+
+	if (take(r, sizeof(v))) {
+		memcpy(&v, r->p, sizeof(v));
+		r->p += sizeof(v);
+	}
+	return v;
+}
+
+/* Blobs are used in place from the mapped trace. */
+static const void *rd_blob(struct reader *r, size_t *len)
+{
+	const void *data;
+	size_t pad;
+
+	*len = rd_u32(r);
+	pad = (8 - (size_t) (r->p - r->base) % 8) % 8;
+	if (!take(r, pad + *len))
+		return NULL;
+	data = r->p + pad;
+	r->p += pad + *len;
+	return data;
+}
+
+static void *rd_out(struct replay *rp, size_t len)
+{
+	void *p;
+
+	if (rp->nscratch == (int) ARRAY_SIZE(rp->scratch))
+		return NULL;
+	p = calloc(len ? len : 1, 1);
+	rp->scratch[rp->nscratch++] = p;
+	return p;
+}
+
+static const void *rd_data(struct reader *r)
+{
+	size_t len;
+
+	if (rd_u32(r) == 0)
+		return NULL;
+	return rd_blob(r, &len);
+}
+
+static const void *rd_pixels(struct reader *r)
+{
+	size_t len;
+
+	switch (rd_u32(r)) {
+	case 0:
+		return NULL;
+	case 1:
+		return (const void *) (size_t) rd_u64(r);
+	}
+	return rd_blob(r, &len);
+}
+
+static void *rd_pack(struct replay *rp, struct reader *r, size_t len)
+{
+	if (rd_u32(r) == 1)
+		return (void *) (size_t) rd_u64(r);
+	return rd_out(rp, len);
+}
+
+static const GLchar *rd_string(struct reader *r)
+{
+	size_t len;
+
+	return (const GLchar *) rd_blob(r, &len);
+}
+
+static const GLchar *const *rd_strings(struct replay *rp, struct reader *r)
+{
+	GLuint i, count = rd_u32(r);
+	const GLchar **s = (const GLchar **) rd_out(rp, count * sizeof(*s));
+
+	for (i = 0; s && i < count; i++)
+		s[i] = rd_string(r);
+	return s;
+}
+
+static const void *const *rd_offsets(struct replay *rp, struct reader *r)
+{
+	GLuint i, count = rd_u32(r);
+	const void **p = (const void **) rd_out(rp, count * sizeof(*p));
+
+	for (i = 0; p && i < count; i++)
+		p[i] = (const void *) (size_t) rd_u64(r);
+	return p;
+}
+
+static GLuint remap(struct replay *rp, int ns, GLuint captured)
+{
+	if (captured < rp->names_len[ns] && rp->names[ns][captured])
+		return rp->names[ns][captured];
+	return captured;
+}
+
+static void set_name(struct replay *rp, int ns, GLuint captured, GLuint name)
+{
+	if (captured >= rp->names_len[ns]) {
+		size_t len = rp->names_len[ns] ? rp->names_len[ns] : 64;
+		GLuint *names;
+
+		while (len <= captured)
+			len *= 2;
+		names = (GLuint *) realloc(rp->names[ns], len * sizeof(*names));
+		if (!names)
+			return;
+		memset(names + rp->names_len[ns], 0,
+		       (len - rp->names_len[ns]) * sizeof(*names));
+		rp->names[ns] = names;
+		rp->names_len[ns] = len;
+	}
+	rp->names[ns][captured] = name;
+}
+
+static void remap_names(struct replay *rp, int ns, const GLuint *captured,
+			const GLuint *names, GLsizei n)
+{
+	GLsizei i;
+
+	for (i = 0; captured && i < n; i++)
+		set_name(rp, ns, captured[i], names[i]);
+}
+
+static const GLuint *rd_names(struct replay *rp, struct reader *r, int ns)
+{
+	size_t i, len;
+	const GLuint *captured;
+	GLuint *names;
+
+	if (rd_u32(r) == 0)
+		return NULL;
+	captured = (const GLuint *) rd_blob(r, &len);
+	names = (GLuint *) rd_out(rp, len);
+	if (!captured || !names)
+		return NULL;
+	for (i = 0; i < len / sizeof(GLuint); i++) {
+		GLuint name;
+
+		memcpy(&name, captured + i, sizeof(name));
+		names[i] = remap(rp, ns, name);
+	}
+	return names;
+}
+
+/* Only locations that differ from the capture are stored, which keeps
+ * the common case a single comparison.
+ */
+static GLint remap_location(struct replay *rp, GLuint program, GLint captured)
+{
+	size_t i;
+
+	for (i = 0; i < rp->nlocations; i++)
+		if (rp->locations[i].program == program &&
+		    rp->locations[i].captured == captured)
+			return rp->locations[i].replayed;
+	return captured;
+}
+
+static void set_location(struct replay *rp, GLuint program, GLint captured,
+			 GLint location)
+{
+	struct location *locations;
+
+	if (captured == location || remap_location(rp, program, captured) == location)
+		return;
+	locations = (struct location *) realloc(rp->locations,
+		(rp->nlocations + 1) * sizeof(*locations));
+	if (!locations)
+		return;
+	locations[rp->nlocations].program = program;
+	locations[rp->nlocations].captured = captured;
+	locations[rp->nlocations].replayed = location;
+	rp->locations = locations;
+	rp->nlocations++;
+}
+
+static GLsync replay_sync(struct replay *rp, GLuint64 captured)
+{
+	size_t i;
+
+	for (i = 0; i < rp->nsyncs; i++)
+		if (rp->syncs[i].captured == captured)
+			return rp->syncs[i].replayed;
+	return NULL;
+}
+
+static void set_sync(struct replay *rp, GLuint64 captured, GLsync sync)
+{
+	size_t i;
+	struct sync *syncs;
+
+	for (i = 0; i < rp->nsyncs; i++) {
+		if (rp->syncs[i].captured == captured) {
+			rp->syncs[i].replayed = sync;
+			return;
+		}
+	}
+	syncs = (struct sync *) realloc(rp->syncs, (rp->nsyncs + 1) * sizeof(*syncs));
+	if (!syncs)
+		return;
+	syncs[rp->nsyncs].captured = captured;
+	syncs[rp->nsyncs].replayed = sync;
+	rp->syncs = syncs;
+	rp->nsyncs++;
+}
+
+static struct mapping *find_map(struct replay *rp, int named, GLuint key)
+{
+	size_t i;
+
+	for (i = 0; i < ARRAY_SIZE(rp->maps); i++)
+		if (rp->maps[i].ptr && rp->maps[i].named == named &&
+		    rp->maps[i].key == key)
+			return rp->maps + i;
+	return NULL;
+}
+
+static GLsizeiptr replay_buffer_size(int named, GLuint key)
+{
+	GLint64 size = 0;
+
+	if (named)
+		glGetNamedBufferParameteri64v(key, GL_BUFFER_SIZE, &size);
+	else
+		glGetBufferParameteri64v(key, GL_BUFFER_SIZE, &size);
+	return (GLsizeiptr) size;
+}
+
+static void set_map(struct replay *rp, int named, GLuint key, void *ptr,
+		    GLsizeiptr len)
+{
+	struct mapping *m = find_map(rp, named, key);
+	size_t i;
+
+	for (i = 0; !m && i < ARRAY_SIZE(rp->maps); i++)
+		if (!rp->maps[i].ptr)
+			m = rp->maps + i;
+	if (!m)
+		return;
+	m->named = named;
+	m->key = key;
+	m->ptr = (unsigned char *) ptr;
+	m->len = len > 0 ? (GLuint64) len : 0;
+}
+
+static void replay_mapdata(struct replay *rp, struct reader *r)
+{
+	int named = rd_u32(r);
+	GLuint key = rd_u32(r);
+	GLuint64 offset = rd_u64(r);
+	size_t len;
+	const void *data = rd_blob(r, &len);
+	struct mapping *m;
+
+	if (named)
+		key = remap(rp, NS_BUFFER, key);
+	m = find_map(rp, named, key);
+	/* A corrupt trace must not write outside the mapped range */
+	if (m && data && offset <= m->len && len <= m->len - offset)
+		memcpy(m->ptr + offset, data, len);
+}
+
+static int replay_call(struct replay *rs, int slot, struct reader *rx)
+{
+	switch (slot) {
+'''
+
+REPLAY_TAIL = r'''	default:
+		return 0;
+	}
+	return 1;
+}
+
+int gl3wReplay(const void *trace, size_t size, int flags,
+	       void (*frame)(void *), void *arg, struct GL3WReplayStats *stats)
+{
+	struct replay rp;
+	struct reader r;
+	GLuint header[4];
+	int *slots, i, ret = 0;
+	double start = now();
+
+	memset(stats, 0, sizeof(*stats));
+	if (size < sizeof(header))
+		return -1;
+	memcpy(header, trace, sizeof(header));
+	if (memcmp(header, "GL3WTRC", 8) || header[2] != 1 ||
+	    header[3] != 0x01020304)
+		return -1;
+	slots = (int *) malloc(0x10000 * sizeof(*slots));
+	if (!slots)
+		return -1;
+	for (i = 0; i < 0x10000; i++)
+		slots[i] = -1;
+	memset(&rp, 0, sizeof(rp));
+	r.base = (const unsigned char *) trace;
+	r.p = r.base + sizeof(header);
+	r.end = r.base + size;
+	r.error = 0;
+
+	while (r.p < r.end) {
+		struct reader rec;
+		unsigned short slot, rflags;
+		GLuint len;
+		GLuint64 t;
+
+		if (!take(&r, 16)) {
+			ret = -1;
+			break;
+		}
+		memcpy(&slot, r.p, 2);
+		memcpy(&rflags, r.p + 2, 2);
+		memcpy(&len, r.p + 4, 4);
+		memcpy(&t, r.p + 8, 8);
+		r.p += 16;
+		if (!take(&r, len)) {
+			ret = -1;
+			break;
+		}
+		rec.base = r.base;
+		rec.p = r.p;
+		rec.end = r.p + len;
+		rec.error = 0;
+		r.p += len;
+
+		if (flags & GL3W_REPLAY_TIMED) {
+			double wait = start + t / 1e9 - now();
+
+			if (wait > 0.002)
+				pause_for(wait - 0.001);
+			while (now() < start + t / 1e9)
+				;
+		}
+		if (slot == REPLAY_FRAME) {
+			stats->frames++;
+			if (frame)
+				frame(arg);
+		} else if (slot == REPLAY_NAME) {
+			GLuint captured = rd_u32(&rec);
+			const GLchar *name = rd_string(&rec);
+
+			if (name && captured < 0x10000)
+				slots[captured] = gl3wProcIndex(name);
+		} else if (slot == REPLAY_MAPDATA) {
+			replay_mapdata(&rp, &rec);
+		} else if ((rflags & REPLAY_UNSUPPORTED) || slots[slot] < 0 ||
+			   !replay_call(&rp, slots[slot], &rec) || rec.error) {
+			stats->skipped++;
+		} else {
+			stats->calls++;
+		}
+		while (rp.nscratch)
+			free(rp.scratch[--rp.nscratch]);
+	}
+
+	for (i = 0; i < NS_COUNT; i++)
+		free(rp.names[i]);
+	free(rp.locations);
+	free(rp.syncs);
+	free(slots);
+	return ret;
+}
+'''
+
+
+def write_replay(procs, protos):
+    with open(os.path.join(HERE, 'gl3w_replay.c'), 'wb') as f:
+        w = lambda s: f.write(s.encode('utf-8'))
+        w(UNLICENSE)
+        w(REPLAY_C)
+        for slot, proc in enumerate(procs):
+            ret, params = protos[proc]
+            spec = classify(proc, ret, params)
+            if spec is None:
+                continue
+            for line in replay_case(slot, proc, ret, spec):
+                w(('\t' + line if line else '') + '\n')
+        w(REPLAY_TAIL)
+
+
+def write_manifest(path, sources, features):
+    used = set()
+    p = re.compile(r'\b(gl[A-Z]\w*)\b')
+    for source in sources:
+        with open(source, 'r') as f:
+            used.update(m for m in p.findall(f.read()) if m in features)
+    with open(path, 'wb') as f:
+        w = lambda s: f.write(s.encode('utf-8'))
+        w('/* Generated by gl3w_gen.py --manifest from {0} */\n\n'
+          .format(' '.join(sources)))
+        w('static const char *const gl3w_manifest[] = {\n')
+        for proc in sorted(used):
+            w('    "{0}",\n'.format(proc))
+        w('    NULL\n};\n')
+
+
+if __name__ == '__main__':
+    features = read_procs()
+    if len(sys.argv) > 2 and sys.argv[1] == '--manifest':
+        write_manifest(sys.argv[2], sys.argv[3:], features)
+    else:
+        exts = read_extensions()
+        write_header(sorted(features), exts)
+        protos = read_prototypes()
+        write_source(features, exts, protos)
+        write_replay(sorted(features), protos)
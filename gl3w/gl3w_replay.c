@@ -0,0 +1,6442 @@
+/*
+
+    This file was generated with gl3w_gen.py, part of gl3w
+    (hosted at https://github.com/skaslev/gl3w)
+
+    This is free and unencumbered software released into the public domain.
+
+    Anyone is free to copy, modify, publish, use, compile, sell, or
+    distribute this software, either in source code form or as a compiled
+    binary, for any purpose, commercial or non-commercial, and by any
+    means.
+
+    In jurisdictions that recognize copyright laws, the author or authors
+    of this software dedicate any and all copyright interest in the
+    software to the public domain. We make this dedication for the benefit
+    of the public at large and to the detriment of our heirs and
+    successors. We intend this dedication to be an overt act of
+    relinquishment in perpetuity of all present and future rights to this
+    software under copyright law.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+    OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+    ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+    OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#if !defined(_WIN32) && !defined(__APPLE__) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <GL/gl3w.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN 1
+#include <windows.h>
+
+static double now(void)
+{
+	LARGE_INTEGER count, freq;
+
+	QueryPerformanceCounter(&count);
+	QueryPerformanceFrequency(&freq);
+	return (double) count.QuadPart / freq.QuadPart;
+}
+
+static void pause_for(double seconds)
+{
+	Sleep((DWORD) (seconds * 1e3));
+}
+#else
+#include <time.h>
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void pause_for(double seconds)
+{
+	struct timespec ts;
+
+	ts.tv_sec = (time_t) seconds;
+	ts.tv_nsec = (long) ((seconds - ts.tv_sec) * 1e9);
+	nanosleep(&ts, NULL);
+}
+#endif
+
+#define ARRAY_SIZE(x)  (sizeof(x) / sizeof((x)[0]))
+
+#define REPLAY_FRAME       0xffff
+#define REPLAY_NAME        0xfffe
+#define REPLAY_MAPDATA     0xfffd
+#define REPLAY_UNSUPPORTED 1
+#define REPLAY_OUT_SIZE    65536
+
+enum {
+	NS_BUFFER, NS_TEXTURE, NS_VERTEX_ARRAY, NS_FRAMEBUFFER,
+	NS_RENDERBUFFER, NS_SAMPLER, NS_QUERY, NS_TRANSFORM_FEEDBACK,
+	NS_PROGRAM, NS_PIPELINE, NS_COUNT
+};
+
+struct reader {
+	const unsigned char *base, *p, *end;
+	int error;
+};
+
+struct location {
+	GLuint program;
+	GLint captured, replayed;
+};
+
+struct sync {
+	GLuint64 captured;
+	GLsync replayed;
+};
+
+struct mapping {
+	int named;
+	GLuint key;
+	unsigned char *ptr;
+	GLuint64 len;
+};
+
+struct replay {
+	GLuint *names[NS_COUNT];
+	size_t names_len[NS_COUNT];
+	struct location *locations;
+	size_t nlocations;
+	struct sync *syncs;
+	size_t nsyncs;
+	struct mapping maps[16];
+	void *scratch[64];
+	int nscratch;
+	GLuint program;
+};
+
+static int take(struct reader *r, size_t len)
+{
+	if (r->error || (size_t) (r->end - r->p) < len) {
+		r->error = 1;
+		return 0;
+	}
+	return 1;
+}
+
+static GLuint rd_u32(struct reader *r)
+{
+	GLuint v = 0;
+
+	if (take(r, sizeof(v))) {
+		memcpy(&v, r->p, sizeof(v));
+		r->p += sizeof(v);
+	}
+	return v;
+}
+
+static GLuint64 rd_u64(struct reader *r)
+{
+	GLuint64 v = 0;
+
+	if (take(r, sizeof(v))) {
+		memcpy(&v, r->p, sizeof(v));
+		r->p += sizeof(v);
+	}
+	return v;
+}
+
+static GLfloat rd_f32(struct reader *r)
+{
+	GLfloat v = 0;
+
+	if (take(r, sizeof(v))) {
+		memcpy(&v, r->p, sizeof(v));
+		r->p += sizeof(v);
+	}
+	return v;
+}
+
+static GLdouble rd_f64(struct reader *r)
+{
+	GLdouble v = 0;
+
+	if (take(r, sizeof(v))) {
+		memcpy(&v, r->p, sizeof(v));
+		r->p += sizeof(v);
+	}
+	return v;
+}
+
+/* Blobs are used in place from the mapped trace. */
+static const void *rd_blob(struct reader *r, size_t *len)
+{
+	const void *data;
+	size_t pad;
+
+	*len = rd_u32(r);
+	pad = (8 - (size_t) (r->p - r->base) % 8) % 8;
+	if (!take(r, pad + *len))
+		return NULL;
+	data = r->p + pad;
+	r->p += pad + *len;
+	return data;
+}
+
+static void *rd_out(struct replay *rp, size_t len)
+{
+	void *p;
+
+	if (rp->nscratch == (int) ARRAY_SIZE(rp->scratch))
+		return NULL;
+	p = calloc(len ? len : 1, 1);
+	rp->scratch[rp->nscratch++] = p;
+	return p;
+}
+
+static const void *rd_data(struct reader *r)
+{
+	size_t len;
+
+	if (rd_u32(r) == 0)
+		return NULL;
+	return rd_blob(r, &len);
+}
+
+static const void *rd_pixels(struct reader *r)
+{
+	size_t len;
+
+	switch (rd_u32(r)) {
+	case 0:
+		return NULL;
+	case 1:
+		return (const void *) (size_t) rd_u64(r);
+	}
+	return rd_blob(r, &len);
+}
+
+static void *rd_pack(struct replay *rp, struct reader *r, size_t len)
+{
+	if (rd_u32(r) == 1)
+		return (void *) (size_t) rd_u64(r);
+	return rd_out(rp, len);
+}
+
+static const GLchar *rd_string(struct reader *r)
+{
+	size_t len;
+
+	return (const GLchar *) rd_blob(r, &len);
+}
+
+static const GLchar *const *rd_strings(struct replay *rp, struct reader *r)
+{
+	GLuint i, count = rd_u32(r);
+	const GLchar **s = (const GLchar **) rd_out(rp, count * sizeof(*s));
+
+	for (i = 0; s && i < count; i++)
+		s[i] = rd_string(r);
+	return s;
+}
+
+static const void *const *rd_offsets(struct replay *rp, struct reader *r)
+{
+	GLuint i, count = rd_u32(r);
+	const void **p = (const void **) rd_out(rp, count * sizeof(*p));
+
+	for (i = 0; p && i < count; i++)
+		p[i] = (const void *) (size_t) rd_u64(r);
+	return p;
+}
+
+static GLuint remap(struct replay *rp, int ns, GLuint captured)
+{
+	if (captured < rp->names_len[ns] && rp->names[ns][captured])
+		return rp->names[ns][captured];
+	return captured;
+}
+
+static void set_name(struct replay *rp, int ns, GLuint captured, GLuint name)
+{
+	if (captured >= rp->names_len[ns]) {
+		size_t len = rp->names_len[ns] ? rp->names_len[ns] : 64;
+		GLuint *names;
+
+		while (len <= captured)
+			len *= 2;
+		names = (GLuint *) realloc(rp->names[ns], len * sizeof(*names));
+		if (!names)
+			return;
+		memset(names + rp->names_len[ns], 0,
+		       (len - rp->names_len[ns]) * sizeof(*names));
+		rp->names[ns] = names;
+		rp->names_len[ns] = len;
+	}
+	rp->names[ns][captured] = name;
+}
+
+static void remap_names(struct replay *rp, int ns, const GLuint *captured,
+			const GLuint *names, GLsizei n)
+{
+	GLsizei i;
+
+	for (i = 0; captured && i < n; i++)
+		set_name(rp, ns, captured[i], names[i]);
+}
+
+static const GLuint *rd_names(struct replay *rp, struct reader *r, int ns)
+{
+	size_t i, len;
+	const GLuint *captured;
+	GLuint *names;
+
+	if (rd_u32(r) == 0)
+		return NULL;
+	captured = (const GLuint *) rd_blob(r, &len);
+	names = (GLuint *) rd_out(rp, len);
+	if (!captured || !names)
+		return NULL;
+	for (i = 0; i < len / sizeof(GLuint); i++) {
+		GLuint name;
+
+		memcpy(&name, captured + i, sizeof(name));
+		names[i] = remap(rp, ns, name);
+	}
+	return names;
+}
+
+/* Only locations that differ from the capture are stored, which keeps
+ * the common case a single comparison.
+ */
+static GLint remap_location(struct replay *rp, GLuint program, GLint captured)
+{
+	size_t i;
+
+	for (i = 0; i < rp->nlocations; i++)
+		if (rp->locations[i].program == program &&
+		    rp->locations[i].captured == captured)
+			return rp->locations[i].replayed;
+	return captured;
+}
+
+static void set_location(struct replay *rp, GLuint program, GLint captured,
+			 GLint location)
+{
+	struct location *locations;
+
+	if (captured == location || remap_location(rp, program, captured) == location)
+		return;
+	locations = (struct location *) realloc(rp->locations,
+		(rp->nlocations + 1) * sizeof(*locations));
+	if (!locations)
+		return;
+	locations[rp->nlocations].program = program;
+	locations[rp->nlocations].captured = captured;
+	locations[rp->nlocations].replayed = location;
+	rp->locations = locations;
+	rp->nlocations++;
+}
+
+static GLsync replay_sync(struct replay *rp, GLuint64 captured)
+{
+	size_t i;
+
+	for (i = 0; i < rp->nsyncs; i++)
+		if (rp->syncs[i].captured == captured)
+			return rp->syncs[i].replayed;
+	return NULL;
+}
+
+static void set_sync(struct replay *rp, GLuint64 captured, GLsync sync)
+{
+	size_t i;
+	struct sync *syncs;
+
+	for (i = 0; i < rp->nsyncs; i++) {
+		if (rp->syncs[i].captured == captured) {
+			rp->syncs[i].replayed = sync;
+			return;
+		}
+	}
+	syncs = (struct sync *) realloc(rp->syncs, (rp->nsyncs + 1) * sizeof(*syncs));
+	if (!syncs)
+		return;
+	syncs[rp->nsyncs].captured = captured;
+	syncs[rp->nsyncs].replayed = sync;
+	rp->syncs = syncs;
+	rp->nsyncs++;
+}
+
+static struct mapping *find_map(struct replay *rp, int named, GLuint key)
+{
+	size_t i;
+
+	for (i = 0; i < ARRAY_SIZE(rp->maps); i++)
+		if (rp->maps[i].ptr && rp->maps[i].named == named &&
+		    rp->maps[i].key == key)
+			return rp->maps + i;
+	return NULL;
+}
+
+static GLsizeiptr replay_buffer_size(int named, GLuint key)
+{
+	GLint64 size = 0;
+
+	if (named)
+		glGetNamedBufferParameteri64v(key, GL_BUFFER_SIZE, &size);
+	else
+		glGetBufferParameteri64v(key, GL_BUFFER_SIZE, &size);
+	return (GLsizeiptr) size;
+}
+
+static void set_map(struct replay *rp, int named, GLuint key, void *ptr,
+		    GLsizeiptr len)
+{
+	struct mapping *m = find_map(rp, named, key);
+	size_t i;
+
+	for (i = 0; !m && i < ARRAY_SIZE(rp->maps); i++)
+		if (!rp->maps[i].ptr)
+			m = rp->maps + i;
+	if (!m)
+		return;
+	m->named = named;
+	m->key = key;
+	m->ptr = (unsigned char *) ptr;
+	m->len = len > 0 ? (GLuint64) len : 0;
+}
+
+static void replay_mapdata(struct replay *rp, struct reader *r)
+{
+	int named = rd_u32(r);
+	GLuint key = rd_u32(r);
+	GLuint64 offset = rd_u64(r);
+	size_t len;
+	const void *data = rd_blob(r, &len);
+	struct mapping *m;
+
+	if (named)
+		key = remap(rp, NS_BUFFER, key);
+	m = find_map(rp, named, key);
+	/* A corrupt trace must not write outside the mapped range */
+	if (m && data && offset <= m->len && len <= m->len - offset)
+		memcpy(m->ptr + offset, data, len);
+}
+
+static int replay_call(struct replay *rs, int slot, struct reader *rx)
+{
+	switch (slot) {
+	case 0: {
+		GLuint pipeline = remap(rs, NS_PIPELINE, rd_u32(rx));
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+
+		glActiveShaderProgram(pipeline, program);
+		break;
+	}
+	case 1: {
+		GLenum texture = (GLenum) rd_u32(rx);
+
+		glActiveTexture(texture);
+		break;
+	}
+	case 2: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLuint shader = remap(rs, NS_PROGRAM, rd_u32(rx));
+
+		glAttachShader(program, shader);
+		break;
+	}
+	case 3: {
+		GLuint id = (GLuint) rd_u32(rx);
+		GLenum mode = (GLenum) rd_u32(rx);
+
+		glBeginConditionalRender(id, mode);
+		break;
+	}
+	case 4: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLuint id = remap(rs, NS_QUERY, rd_u32(rx));
+
+		glBeginQuery(target, id);
+		break;
+	}
+	case 5: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLuint index = (GLuint) rd_u32(rx);
+		GLuint id = remap(rs, NS_QUERY, rd_u32(rx));
+
+		glBeginQueryIndexed(target, index, id);
+		break;
+	}
+	case 6: {
+		GLenum primitiveMode = (GLenum) rd_u32(rx);
+
+		glBeginTransformFeedback(primitiveMode);
+		break;
+	}
+	case 7: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLchar *name = rd_string(rx);
+
+		glBindAttribLocation(program, index, name);
+		break;
+	}
+	case 8: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+
+		glBindBuffer(target, buffer);
+		break;
+	}
+	case 9: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLuint index = (GLuint) rd_u32(rx);
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+
+		glBindBufferBase(target, index, buffer);
+		break;
+	}
+	case 10: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLuint index = (GLuint) rd_u32(rx);
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLintptr offset = (GLintptr) rd_u64(rx);
+		GLsizeiptr size = (GLsizeiptr) rd_u64(rx);
+
+		glBindBufferRange(target, index, buffer, offset, size);
+		break;
+	}
+	case 11: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLuint first = (GLuint) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLuint *buffers = rd_names(rs, rx, NS_BUFFER);
+
+		glBindBuffersBase(target, first, count, buffers);
+		break;
+	}
+	case 12: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLuint first = (GLuint) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLuint *buffers = rd_names(rs, rx, NS_BUFFER);
+		const GLintptr *offsets = rd_data(rx);
+		const GLsizeiptr *sizes = rd_data(rx);
+
+		glBindBuffersRange(target, first, count, buffers, offsets, sizes);
+		break;
+	}
+	case 13: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLuint color = (GLuint) rd_u32(rx);
+		const GLchar *name = rd_string(rx);
+
+		glBindFragDataLocation(program, color, name);
+		break;
+	}
+	case 14: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLuint colorNumber = (GLuint) rd_u32(rx);
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLchar *name = rd_string(rx);
+
+		glBindFragDataLocationIndexed(program, colorNumber, index, name);
+		break;
+	}
+	case 15: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLuint framebuffer = remap(rs, NS_FRAMEBUFFER, rd_u32(rx));
+
+		glBindFramebuffer(target, framebuffer);
+		break;
+	}
+	case 16: {
+		GLuint unit = (GLuint) rd_u32(rx);
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+		GLboolean layered = (GLboolean) rd_u32(rx);
+		GLint layer = (GLint) rd_u32(rx);
+		GLenum access = (GLenum) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+
+		glBindImageTexture(unit, texture, level, layered, layer, access, format);
+		break;
+	}
+	case 17: {
+		GLuint first = (GLuint) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLuint *textures = rd_names(rs, rx, NS_TEXTURE);
+
+		glBindImageTextures(first, count, textures);
+		break;
+	}
+	case 18: {
+		GLuint pipeline = remap(rs, NS_PIPELINE, rd_u32(rx));
+
+		glBindProgramPipeline(pipeline);
+		break;
+	}
+	case 19: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLuint renderbuffer = remap(rs, NS_RENDERBUFFER, rd_u32(rx));
+
+		glBindRenderbuffer(target, renderbuffer);
+		break;
+	}
+	case 20: {
+		GLuint unit = (GLuint) rd_u32(rx);
+		GLuint sampler = remap(rs, NS_SAMPLER, rd_u32(rx));
+
+		glBindSampler(unit, sampler);
+		break;
+	}
+	case 21: {
+		GLuint first = (GLuint) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLuint *samplers = rd_names(rs, rx, NS_SAMPLER);
+
+		glBindSamplers(first, count, samplers);
+		break;
+	}
+	case 22: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+
+		glBindTexture(target, texture);
+		break;
+	}
+	case 23: {
+		GLuint unit = (GLuint) rd_u32(rx);
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+
+		glBindTextureUnit(unit, texture);
+		break;
+	}
+	case 24: {
+		GLuint first = (GLuint) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLuint *textures = rd_names(rs, rx, NS_TEXTURE);
+
+		glBindTextures(first, count, textures);
+		break;
+	}
+	case 25: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLuint id = remap(rs, NS_TRANSFORM_FEEDBACK, rd_u32(rx));
+
+		glBindTransformFeedback(target, id);
+		break;
+	}
+	case 26: {
+		GLuint array = remap(rs, NS_VERTEX_ARRAY, rd_u32(rx));
+
+		glBindVertexArray(array);
+		break;
+	}
+	case 27: {
+		GLuint bindingindex = (GLuint) rd_u32(rx);
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLintptr offset = (GLintptr) rd_u64(rx);
+		GLsizei stride = (GLsizei) rd_u32(rx);
+
+		glBindVertexBuffer(bindingindex, buffer, offset, stride);
+		break;
+	}
+	case 28: {
+		GLuint first = (GLuint) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLuint *buffers = rd_names(rs, rx, NS_BUFFER);
+		const GLintptr *offsets = rd_data(rx);
+		const GLsizei *strides = rd_data(rx);
+
+		glBindVertexBuffers(first, count, buffers, offsets, strides);
+		break;
+	}
+	case 29: {
+		GLfloat red = rd_f32(rx);
+		GLfloat green = rd_f32(rx);
+		GLfloat blue = rd_f32(rx);
+		GLfloat alpha = rd_f32(rx);
+
+		glBlendColor(red, green, blue, alpha);
+		break;
+	}
+	case 30: {
+		GLenum mode = (GLenum) rd_u32(rx);
+
+		glBlendEquation(mode);
+		break;
+	}
+	case 31: {
+		GLenum modeRGB = (GLenum) rd_u32(rx);
+		GLenum modeAlpha = (GLenum) rd_u32(rx);
+
+		glBlendEquationSeparate(modeRGB, modeAlpha);
+		break;
+	}
+	case 32: {
+		GLuint buf = (GLuint) rd_u32(rx);
+		GLenum modeRGB = (GLenum) rd_u32(rx);
+		GLenum modeAlpha = (GLenum) rd_u32(rx);
+
+		glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+		break;
+	}
+	case 33: {
+		GLuint buf = (GLuint) rd_u32(rx);
+		GLenum modeRGB = (GLenum) rd_u32(rx);
+		GLenum modeAlpha = (GLenum) rd_u32(rx);
+
+		glBlendEquationSeparateiARB(buf, modeRGB, modeAlpha);
+		break;
+	}
+	case 34: {
+		GLuint buf = (GLuint) rd_u32(rx);
+		GLenum mode = (GLenum) rd_u32(rx);
+
+		glBlendEquationi(buf, mode);
+		break;
+	}
+	case 35: {
+		GLuint buf = (GLuint) rd_u32(rx);
+		GLenum mode = (GLenum) rd_u32(rx);
+
+		glBlendEquationiARB(buf, mode);
+		break;
+	}
+	case 36: {
+		GLenum sfactor = (GLenum) rd_u32(rx);
+		GLenum dfactor = (GLenum) rd_u32(rx);
+
+		glBlendFunc(sfactor, dfactor);
+		break;
+	}
+	case 37: {
+		GLenum sfactorRGB = (GLenum) rd_u32(rx);
+		GLenum dfactorRGB = (GLenum) rd_u32(rx);
+		GLenum sfactorAlpha = (GLenum) rd_u32(rx);
+		GLenum dfactorAlpha = (GLenum) rd_u32(rx);
+
+		glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+		break;
+	}
+	case 38: {
+		GLuint buf = (GLuint) rd_u32(rx);
+		GLenum srcRGB = (GLenum) rd_u32(rx);
+		GLenum dstRGB = (GLenum) rd_u32(rx);
+		GLenum srcAlpha = (GLenum) rd_u32(rx);
+		GLenum dstAlpha = (GLenum) rd_u32(rx);
+
+		glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+		break;
+	}
+	case 39: {
+		GLuint buf = (GLuint) rd_u32(rx);
+		GLenum srcRGB = (GLenum) rd_u32(rx);
+		GLenum dstRGB = (GLenum) rd_u32(rx);
+		GLenum srcAlpha = (GLenum) rd_u32(rx);
+		GLenum dstAlpha = (GLenum) rd_u32(rx);
+
+		glBlendFuncSeparateiARB(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+		break;
+	}
+	case 40: {
+		GLuint buf = (GLuint) rd_u32(rx);
+		GLenum src = (GLenum) rd_u32(rx);
+		GLenum dst = (GLenum) rd_u32(rx);
+
+		glBlendFunci(buf, src, dst);
+		break;
+	}
+	case 41: {
+		GLuint buf = (GLuint) rd_u32(rx);
+		GLenum src = (GLenum) rd_u32(rx);
+		GLenum dst = (GLenum) rd_u32(rx);
+
+		glBlendFunciARB(buf, src, dst);
+		break;
+	}
+	case 42: {
+		GLint srcX0 = (GLint) rd_u32(rx);
+		GLint srcY0 = (GLint) rd_u32(rx);
+		GLint srcX1 = (GLint) rd_u32(rx);
+		GLint srcY1 = (GLint) rd_u32(rx);
+		GLint dstX0 = (GLint) rd_u32(rx);
+		GLint dstY0 = (GLint) rd_u32(rx);
+		GLint dstX1 = (GLint) rd_u32(rx);
+		GLint dstY1 = (GLint) rd_u32(rx);
+		GLbitfield mask = (GLbitfield) rd_u32(rx);
+		GLenum filter = (GLenum) rd_u32(rx);
+
+		glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+		break;
+	}
+	case 43: {
+		GLuint readFramebuffer = remap(rs, NS_FRAMEBUFFER, rd_u32(rx));
+		GLuint drawFramebuffer = remap(rs, NS_FRAMEBUFFER, rd_u32(rx));
+		GLint srcX0 = (GLint) rd_u32(rx);
+		GLint srcY0 = (GLint) rd_u32(rx);
+		GLint srcX1 = (GLint) rd_u32(rx);
+		GLint srcY1 = (GLint) rd_u32(rx);
+		GLint dstX0 = (GLint) rd_u32(rx);
+		GLint dstY0 = (GLint) rd_u32(rx);
+		GLint dstX1 = (GLint) rd_u32(rx);
+		GLint dstY1 = (GLint) rd_u32(rx);
+		GLbitfield mask = (GLbitfield) rd_u32(rx);
+		GLenum filter = (GLenum) rd_u32(rx);
+
+		glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+		break;
+	}
+	case 44: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLsizeiptr size = (GLsizeiptr) rd_u64(rx);
+		const void *data = rd_data(rx);
+		GLenum usage = (GLenum) rd_u32(rx);
+
+		glBufferData(target, size, data, usage);
+		break;
+	}
+	case 45: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLintptr offset = (GLintptr) rd_u64(rx);
+		GLsizeiptr size = (GLsizeiptr) rd_u64(rx);
+		GLboolean commit = (GLboolean) rd_u32(rx);
+
+		glBufferPageCommitmentARB(target, offset, size, commit);
+		break;
+	}
+	case 46: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLsizeiptr size = (GLsizeiptr) rd_u64(rx);
+		const void *data = rd_data(rx);
+		GLbitfield flags = (GLbitfield) rd_u32(rx);
+
+		glBufferStorage(target, size, data, flags);
+		break;
+	}
+	case 47: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLintptr offset = (GLintptr) rd_u64(rx);
+		GLsizeiptr size = (GLsizeiptr) rd_u64(rx);
+		const void *data = rd_data(rx);
+
+		glBufferSubData(target, offset, size, data);
+		break;
+	}
+	case 48: {
+		GLenum target = (GLenum) rd_u32(rx);
+
+		glCheckFramebufferStatus(target);
+		break;
+	}
+	case 49: {
+		GLuint framebuffer = remap(rs, NS_FRAMEBUFFER, rd_u32(rx));
+		GLenum target = (GLenum) rd_u32(rx);
+
+		glCheckNamedFramebufferStatus(framebuffer, target);
+		break;
+	}
+	case 50: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum clamp = (GLenum) rd_u32(rx);
+
+		glClampColor(target, clamp);
+		break;
+	}
+	case 51: {
+		GLbitfield mask = (GLbitfield) rd_u32(rx);
+
+		glClear(mask);
+		break;
+	}
+	case 52: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *data = rd_data(rx);
+
+		glClearBufferData(target, internalformat, format, type, data);
+		break;
+	}
+	case 53: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLintptr offset = (GLintptr) rd_u64(rx);
+		GLsizeiptr size = (GLsizeiptr) rd_u64(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *data = rd_data(rx);
+
+		glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+		break;
+	}
+	case 54: {
+		GLenum buffer = (GLenum) rd_u32(rx);
+		GLint drawbuffer = (GLint) rd_u32(rx);
+		GLfloat depth = rd_f32(rx);
+		GLint stencil = (GLint) rd_u32(rx);
+
+		glClearBufferfi(buffer, drawbuffer, depth, stencil);
+		break;
+	}
+	case 55: {
+		GLenum buffer = (GLenum) rd_u32(rx);
+		GLint drawbuffer = (GLint) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glClearBufferfv(buffer, drawbuffer, value);
+		break;
+	}
+	case 56: {
+		GLenum buffer = (GLenum) rd_u32(rx);
+		GLint drawbuffer = (GLint) rd_u32(rx);
+		const GLint *value = rd_data(rx);
+
+		glClearBufferiv(buffer, drawbuffer, value);
+		break;
+	}
+	case 57: {
+		GLenum buffer = (GLenum) rd_u32(rx);
+		GLint drawbuffer = (GLint) rd_u32(rx);
+		const GLuint *value = rd_data(rx);
+
+		glClearBufferuiv(buffer, drawbuffer, value);
+		break;
+	}
+	case 58: {
+		GLfloat red = rd_f32(rx);
+		GLfloat green = rd_f32(rx);
+		GLfloat blue = rd_f32(rx);
+		GLfloat alpha = rd_f32(rx);
+
+		glClearColor(red, green, blue, alpha);
+		break;
+	}
+	case 59: {
+		GLdouble depth = rd_f64(rx);
+
+		glClearDepth(depth);
+		break;
+	}
+	case 60: {
+		GLfloat d = rd_f32(rx);
+
+		glClearDepthf(d);
+		break;
+	}
+	case 61: {
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *data = rd_data(rx);
+
+		glClearNamedBufferData(buffer, internalformat, format, type, data);
+		break;
+	}
+	case 62: {
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLintptr offset = (GLintptr) rd_u64(rx);
+		GLsizeiptr size = (GLsizeiptr) rd_u64(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *data = rd_data(rx);
+
+		glClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+		break;
+	}
+	case 63: {
+		GLuint framebuffer = remap(rs, NS_FRAMEBUFFER, rd_u32(rx));
+		GLenum buffer = (GLenum) rd_u32(rx);
+		GLfloat depth = rd_f32(rx);
+		GLint stencil = (GLint) rd_u32(rx);
+
+		glClearNamedFramebufferfi(framebuffer, buffer, depth, stencil);
+		break;
+	}
+	case 64: {
+		GLuint framebuffer = remap(rs, NS_FRAMEBUFFER, rd_u32(rx));
+		GLenum buffer = (GLenum) rd_u32(rx);
+		GLint drawbuffer = (GLint) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+		break;
+	}
+	case 65: {
+		GLuint framebuffer = remap(rs, NS_FRAMEBUFFER, rd_u32(rx));
+		GLenum buffer = (GLenum) rd_u32(rx);
+		GLint drawbuffer = (GLint) rd_u32(rx);
+		const GLint *value = rd_data(rx);
+
+		glClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+		break;
+	}
+	case 66: {
+		GLuint framebuffer = remap(rs, NS_FRAMEBUFFER, rd_u32(rx));
+		GLenum buffer = (GLenum) rd_u32(rx);
+		GLint drawbuffer = (GLint) rd_u32(rx);
+		const GLuint *value = rd_data(rx);
+
+		glClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+		break;
+	}
+	case 67: {
+		GLint s = (GLint) rd_u32(rx);
+
+		glClearStencil(s);
+		break;
+	}
+	case 68: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *data = rd_data(rx);
+
+		glClearTexImage(texture, level, format, type, data);
+		break;
+	}
+	case 69: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+		GLint xoffset = (GLint) rd_u32(rx);
+		GLint yoffset = (GLint) rd_u32(rx);
+		GLint zoffset = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLsizei depth = (GLsizei) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *data = rd_data(rx);
+
+		glClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+		break;
+	}
+	case 70: {
+		GLsync sync = replay_sync(rs, rd_u64(rx));
+		GLbitfield flags = (GLbitfield) rd_u32(rx);
+		GLuint64 timeout = (GLuint64) rd_u64(rx);
+
+		glClientWaitSync(sync, flags, timeout);
+		break;
+	}
+	case 71: {
+		GLenum origin = (GLenum) rd_u32(rx);
+		GLenum depth = (GLenum) rd_u32(rx);
+
+		glClipControl(origin, depth);
+		break;
+	}
+	case 72: {
+		GLboolean red = (GLboolean) rd_u32(rx);
+		GLboolean green = (GLboolean) rd_u32(rx);
+		GLboolean blue = (GLboolean) rd_u32(rx);
+		GLboolean alpha = (GLboolean) rd_u32(rx);
+
+		glColorMask(red, green, blue, alpha);
+		break;
+	}
+	case 73: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLboolean r = (GLboolean) rd_u32(rx);
+		GLboolean g = (GLboolean) rd_u32(rx);
+		GLboolean b = (GLboolean) rd_u32(rx);
+		GLboolean a = (GLboolean) rd_u32(rx);
+
+		glColorMaski(index, r, g, b, a);
+		break;
+	}
+	case 74: {
+		GLuint shader = remap(rs, NS_PROGRAM, rd_u32(rx));
+
+		glCompileShader(shader);
+		break;
+	}
+	case 76: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint level = (GLint) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLint border = (GLint) rd_u32(rx);
+		GLsizei imageSize = (GLsizei) rd_u32(rx);
+		const void *data = rd_pixels(rx);
+
+		glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+		break;
+	}
+	case 77: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint level = (GLint) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLint border = (GLint) rd_u32(rx);
+		GLsizei imageSize = (GLsizei) rd_u32(rx);
+		const void *data = rd_pixels(rx);
+
+		glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+		break;
+	}
+	case 78: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint level = (GLint) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLsizei depth = (GLsizei) rd_u32(rx);
+		GLint border = (GLint) rd_u32(rx);
+		GLsizei imageSize = (GLsizei) rd_u32(rx);
+		const void *data = rd_pixels(rx);
+
+		glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+		break;
+	}
+	case 79: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint level = (GLint) rd_u32(rx);
+		GLint xoffset = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLsizei imageSize = (GLsizei) rd_u32(rx);
+		const void *data = rd_pixels(rx);
+
+		glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+		break;
+	}
+	case 80: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint level = (GLint) rd_u32(rx);
+		GLint xoffset = (GLint) rd_u32(rx);
+		GLint yoffset = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLsizei imageSize = (GLsizei) rd_u32(rx);
+		const void *data = rd_pixels(rx);
+
+		glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+		break;
+	}
+	case 81: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint level = (GLint) rd_u32(rx);
+		GLint xoffset = (GLint) rd_u32(rx);
+		GLint yoffset = (GLint) rd_u32(rx);
+		GLint zoffset = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLsizei depth = (GLsizei) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLsizei imageSize = (GLsizei) rd_u32(rx);
+		const void *data = rd_pixels(rx);
+
+		glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+		break;
+	}
+	case 82: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+		GLint xoffset = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLsizei imageSize = (GLsizei) rd_u32(rx);
+		const void *data = rd_pixels(rx);
+
+		glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+		break;
+	}
+	case 83: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+		GLint xoffset = (GLint) rd_u32(rx);
+		GLint yoffset = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLsizei imageSize = (GLsizei) rd_u32(rx);
+		const void *data = rd_pixels(rx);
+
+		glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+		break;
+	}
+	case 84: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+		GLint xoffset = (GLint) rd_u32(rx);
+		GLint yoffset = (GLint) rd_u32(rx);
+		GLint zoffset = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLsizei depth = (GLsizei) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLsizei imageSize = (GLsizei) rd_u32(rx);
+		const void *data = rd_pixels(rx);
+
+		glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+		break;
+	}
+	case 85: {
+		GLenum readTarget = (GLenum) rd_u32(rx);
+		GLenum writeTarget = (GLenum) rd_u32(rx);
+		GLintptr readOffset = (GLintptr) rd_u64(rx);
+		GLintptr writeOffset = (GLintptr) rd_u64(rx);
+		GLsizeiptr size = (GLsizeiptr) rd_u64(rx);
+
+		glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+		break;
+	}
+	case 86: {
+		GLuint srcName = (GLuint) rd_u32(rx);
+		GLenum srcTarget = (GLenum) rd_u32(rx);
+		GLint srcLevel = (GLint) rd_u32(rx);
+		GLint srcX = (GLint) rd_u32(rx);
+		GLint srcY = (GLint) rd_u32(rx);
+		GLint srcZ = (GLint) rd_u32(rx);
+		GLuint dstName = (GLuint) rd_u32(rx);
+		GLenum dstTarget = (GLenum) rd_u32(rx);
+		GLint dstLevel = (GLint) rd_u32(rx);
+		GLint dstX = (GLint) rd_u32(rx);
+		GLint dstY = (GLint) rd_u32(rx);
+		GLint dstZ = (GLint) rd_u32(rx);
+		GLsizei srcWidth = (GLsizei) rd_u32(rx);
+		GLsizei srcHeight = (GLsizei) rd_u32(rx);
+		GLsizei srcDepth = (GLsizei) rd_u32(rx);
+
+		glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+		break;
+	}
+	case 87: {
+		GLuint readBuffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLuint writeBuffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLintptr readOffset = (GLintptr) rd_u64(rx);
+		GLintptr writeOffset = (GLintptr) rd_u64(rx);
+		GLsizeiptr size = (GLsizeiptr) rd_u64(rx);
+
+		glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+		break;
+	}
+	case 88: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint level = (GLint) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLint x = (GLint) rd_u32(rx);
+		GLint y = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLint border = (GLint) rd_u32(rx);
+
+		glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+		break;
+	}
+	case 89: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint level = (GLint) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLint x = (GLint) rd_u32(rx);
+		GLint y = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLint border = (GLint) rd_u32(rx);
+
+		glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+		break;
+	}
+	case 90: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint level = (GLint) rd_u32(rx);
+		GLint xoffset = (GLint) rd_u32(rx);
+		GLint x = (GLint) rd_u32(rx);
+		GLint y = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+
+		glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+		break;
+	}
+	case 91: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint level = (GLint) rd_u32(rx);
+		GLint xoffset = (GLint) rd_u32(rx);
+		GLint yoffset = (GLint) rd_u32(rx);
+		GLint x = (GLint) rd_u32(rx);
+		GLint y = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+
+		glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+		break;
+	}
+	case 92: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint level = (GLint) rd_u32(rx);
+		GLint xoffset = (GLint) rd_u32(rx);
+		GLint yoffset = (GLint) rd_u32(rx);
+		GLint zoffset = (GLint) rd_u32(rx);
+		GLint x = (GLint) rd_u32(rx);
+		GLint y = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+
+		glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+		break;
+	}
+	case 93: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+		GLint xoffset = (GLint) rd_u32(rx);
+		GLint x = (GLint) rd_u32(rx);
+		GLint y = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+
+		glCopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+		break;
+	}
+	case 94: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+		GLint xoffset = (GLint) rd_u32(rx);
+		GLint yoffset = (GLint) rd_u32(rx);
+		GLint x = (GLint) rd_u32(rx);
+		GLint y = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+
+		glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+		break;
+	}
+	case 95: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+		GLint xoffset = (GLint) rd_u32(rx);
+		GLint yoffset = (GLint) rd_u32(rx);
+		GLint zoffset = (GLint) rd_u32(rx);
+		GLint x = (GLint) rd_u32(rx);
+		GLint y = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+
+		glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+		break;
+	}
+	case 96: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *c_buffers = rd_data(rx);
+		GLuint *buffers = rd_out(rs, n * 4);
+
+		glCreateBuffers(n, buffers);
+		remap_names(rs, NS_BUFFER, c_buffers, buffers, n);
+		break;
+	}
+	case 97: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *c_framebuffers = rd_data(rx);
+		GLuint *framebuffers = rd_out(rs, n * 4);
+
+		glCreateFramebuffers(n, framebuffers);
+		remap_names(rs, NS_FRAMEBUFFER, c_framebuffers, framebuffers, n);
+		break;
+	}
+	case 98: {
+		GLint c_res = (GLint) rd_u32(rx);
+		GLuint res;
+
+		res = glCreateProgram();
+		set_name(rs, NS_PROGRAM, c_res, res);
+		break;
+	}
+	case 99: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *c_pipelines = rd_data(rx);
+		GLuint *pipelines = rd_out(rs, n * 4);
+
+		glCreateProgramPipelines(n, pipelines);
+		remap_names(rs, NS_PIPELINE, c_pipelines, pipelines, n);
+		break;
+	}
+	case 100: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *c_ids = rd_data(rx);
+		GLuint *ids = rd_out(rs, n * 4);
+
+		glCreateQueries(target, n, ids);
+		remap_names(rs, NS_QUERY, c_ids, ids, n);
+		break;
+	}
+	case 101: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *c_renderbuffers = rd_data(rx);
+		GLuint *renderbuffers = rd_out(rs, n * 4);
+
+		glCreateRenderbuffers(n, renderbuffers);
+		remap_names(rs, NS_RENDERBUFFER, c_renderbuffers, renderbuffers, n);
+		break;
+	}
+	case 102: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *c_samplers = rd_data(rx);
+		GLuint *samplers = rd_out(rs, n * 4);
+
+		glCreateSamplers(n, samplers);
+		remap_names(rs, NS_SAMPLER, c_samplers, samplers, n);
+		break;
+	}
+	case 103: {
+		GLenum type = (GLenum) rd_u32(rx);
+		GLint c_res = (GLint) rd_u32(rx);
+		GLuint res;
+
+		res = glCreateShader(type);
+		set_name(rs, NS_PROGRAM, c_res, res);
+		break;
+	}
+	case 104: {
+		GLenum type = (GLenum) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLchar *const*strings = rd_strings(rs, rx);
+		GLint c_res = (GLint) rd_u32(rx);
+		GLuint res;
+
+		res = glCreateShaderProgramv(type, count, strings);
+		set_name(rs, NS_PROGRAM, c_res, res);
+		break;
+	}
+	case 106: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *c_textures = rd_data(rx);
+		GLuint *textures = rd_out(rs, n * 4);
+
+		glCreateTextures(target, n, textures);
+		remap_names(rs, NS_TEXTURE, c_textures, textures, n);
+		break;
+	}
+	case 107: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *c_ids = rd_data(rx);
+		GLuint *ids = rd_out(rs, n * 4);
+
+		glCreateTransformFeedbacks(n, ids);
+		remap_names(rs, NS_TRANSFORM_FEEDBACK, c_ids, ids, n);
+		break;
+	}
+	case 108: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *c_arrays = rd_data(rx);
+		GLuint *arrays = rd_out(rs, n * 4);
+
+		glCreateVertexArrays(n, arrays);
+		remap_names(rs, NS_VERTEX_ARRAY, c_arrays, arrays, n);
+		break;
+	}
+	case 109: {
+		GLenum mode = (GLenum) rd_u32(rx);
+
+		glCullFace(mode);
+		break;
+	}
+	case 112: {
+		GLenum source = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLenum severity = (GLenum) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLuint *ids = rd_data(rx);
+		GLboolean enabled = (GLboolean) rd_u32(rx);
+
+		glDebugMessageControl(source, type, severity, count, ids, enabled);
+		break;
+	}
+	case 113: {
+		GLenum source = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLenum severity = (GLenum) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLuint *ids = rd_data(rx);
+		GLboolean enabled = (GLboolean) rd_u32(rx);
+
+		glDebugMessageControlARB(source, type, severity, count, ids, enabled);
+		break;
+	}
+	case 114: {
+		GLenum source = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLuint id = (GLuint) rd_u32(rx);
+		GLenum severity = (GLenum) rd_u32(rx);
+		GLsizei length = (GLsizei) rd_u32(rx);
+		const GLchar *buf = rd_string(rx);
+
+		glDebugMessageInsert(source, type, id, severity, length, buf);
+		break;
+	}
+	case 115: {
+		GLenum source = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLuint id = (GLuint) rd_u32(rx);
+		GLenum severity = (GLenum) rd_u32(rx);
+		GLsizei length = (GLsizei) rd_u32(rx);
+		const GLchar *buf = rd_string(rx);
+
+		glDebugMessageInsertARB(source, type, id, severity, length, buf);
+		break;
+	}
+	case 116: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *buffers = rd_names(rs, rx, NS_BUFFER);
+
+		glDeleteBuffers(n, buffers);
+		break;
+	}
+	case 117: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *framebuffers = rd_names(rs, rx, NS_FRAMEBUFFER);
+
+		glDeleteFramebuffers(n, framebuffers);
+		break;
+	}
+	case 119: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+
+		glDeleteProgram(program);
+		break;
+	}
+	case 120: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *pipelines = rd_names(rs, rx, NS_PIPELINE);
+
+		glDeleteProgramPipelines(n, pipelines);
+		break;
+	}
+	case 121: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *ids = rd_names(rs, rx, NS_QUERY);
+
+		glDeleteQueries(n, ids);
+		break;
+	}
+	case 122: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *renderbuffers = rd_names(rs, rx, NS_RENDERBUFFER);
+
+		glDeleteRenderbuffers(n, renderbuffers);
+		break;
+	}
+	case 123: {
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLuint *samplers = rd_names(rs, rx, NS_SAMPLER);
+
+		glDeleteSamplers(count, samplers);
+		break;
+	}
+	case 124: {
+		GLuint shader = remap(rs, NS_PROGRAM, rd_u32(rx));
+
+		glDeleteShader(shader);
+		break;
+	}
+	case 125: {
+		GLsync sync = replay_sync(rs, rd_u64(rx));
+
+		glDeleteSync(sync);
+		break;
+	}
+	case 126: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *textures = rd_names(rs, rx, NS_TEXTURE);
+
+		glDeleteTextures(n, textures);
+		break;
+	}
+	case 127: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *ids = rd_names(rs, rx, NS_TRANSFORM_FEEDBACK);
+
+		glDeleteTransformFeedbacks(n, ids);
+		break;
+	}
+	case 128: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *arrays = rd_names(rs, rx, NS_VERTEX_ARRAY);
+
+		glDeleteVertexArrays(n, arrays);
+		break;
+	}
+	case 129: {
+		GLenum func = (GLenum) rd_u32(rx);
+
+		glDepthFunc(func);
+		break;
+	}
+	case 130: {
+		GLboolean flag = (GLboolean) rd_u32(rx);
+
+		glDepthMask(flag);
+		break;
+	}
+	case 131: {
+		GLdouble near = rd_f64(rx);
+		GLdouble far = rd_f64(rx);
+
+		glDepthRange(near, far);
+		break;
+	}
+	case 132: {
+		GLuint first = (GLuint) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLdouble *v = rd_data(rx);
+
+		glDepthRangeArrayv(first, count, v);
+		break;
+	}
+	case 133: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLdouble n = rd_f64(rx);
+		GLdouble f = rd_f64(rx);
+
+		glDepthRangeIndexed(index, n, f);
+		break;
+	}
+	case 134: {
+		GLfloat n = rd_f32(rx);
+		GLfloat f = rd_f32(rx);
+
+		glDepthRangef(n, f);
+		break;
+	}
+	case 135: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLuint shader = remap(rs, NS_PROGRAM, rd_u32(rx));
+
+		glDetachShader(program, shader);
+		break;
+	}
+	case 136: {
+		GLenum cap = (GLenum) rd_u32(rx);
+
+		glDisable(cap);
+		break;
+	}
+	case 137: {
+		GLuint vaobj = remap(rs, NS_VERTEX_ARRAY, rd_u32(rx));
+		GLuint index = (GLuint) rd_u32(rx);
+
+		glDisableVertexArrayAttrib(vaobj, index);
+		break;
+	}
+	case 138: {
+		GLuint index = (GLuint) rd_u32(rx);
+
+		glDisableVertexAttribArray(index);
+		break;
+	}
+	case 139: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLuint index = (GLuint) rd_u32(rx);
+
+		glDisablei(target, index);
+		break;
+	}
+	case 140: {
+		GLuint num_groups_x = (GLuint) rd_u32(rx);
+		GLuint num_groups_y = (GLuint) rd_u32(rx);
+		GLuint num_groups_z = (GLuint) rd_u32(rx);
+
+		glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+		break;
+	}
+	case 141: {
+		GLuint num_groups_x = (GLuint) rd_u32(rx);
+		GLuint num_groups_y = (GLuint) rd_u32(rx);
+		GLuint num_groups_z = (GLuint) rd_u32(rx);
+		GLuint group_size_x = (GLuint) rd_u32(rx);
+		GLuint group_size_y = (GLuint) rd_u32(rx);
+		GLuint group_size_z = (GLuint) rd_u32(rx);
+
+		glDispatchComputeGroupSizeARB(num_groups_x, num_groups_y, num_groups_z, group_size_x, group_size_y, group_size_z);
+		break;
+	}
+	case 142: {
+		GLintptr indirect = (GLintptr) rd_u64(rx);
+
+		glDispatchComputeIndirect(indirect);
+		break;
+	}
+	case 143: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		GLint first = (GLint) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+
+		glDrawArrays(mode, first, count);
+		break;
+	}
+	case 144: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		const void *indirect = (const void *) (size_t) rd_u64(rx);
+
+		glDrawArraysIndirect(mode, indirect);
+		break;
+	}
+	case 145: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		GLint first = (GLint) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLsizei instancecount = (GLsizei) rd_u32(rx);
+
+		glDrawArraysInstanced(mode, first, count, instancecount);
+		break;
+	}
+	case 146: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		GLint first = (GLint) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLsizei instancecount = (GLsizei) rd_u32(rx);
+		GLuint baseinstance = (GLuint) rd_u32(rx);
+
+		glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+		break;
+	}
+	case 147: {
+		GLenum buf = (GLenum) rd_u32(rx);
+
+		glDrawBuffer(buf);
+		break;
+	}
+	case 148: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLenum *bufs = rd_data(rx);
+
+		glDrawBuffers(n, bufs);
+		break;
+	}
+	case 149: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *indices = (const void *) (size_t) rd_u64(rx);
+
+		glDrawElements(mode, count, type, indices);
+		break;
+	}
+	case 150: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *indices = (const void *) (size_t) rd_u64(rx);
+		GLint basevertex = (GLint) rd_u32(rx);
+
+		glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+		break;
+	}
+	case 151: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *indirect = (const void *) (size_t) rd_u64(rx);
+
+		glDrawElementsIndirect(mode, type, indirect);
+		break;
+	}
+	case 152: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *indices = (const void *) (size_t) rd_u64(rx);
+		GLsizei instancecount = (GLsizei) rd_u32(rx);
+
+		glDrawElementsInstanced(mode, count, type, indices, instancecount);
+		break;
+	}
+	case 153: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *indices = (const void *) (size_t) rd_u64(rx);
+		GLsizei instancecount = (GLsizei) rd_u32(rx);
+		GLuint baseinstance = (GLuint) rd_u32(rx);
+
+		glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+		break;
+	}
+	case 154: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *indices = (const void *) (size_t) rd_u64(rx);
+		GLsizei instancecount = (GLsizei) rd_u32(rx);
+		GLint basevertex = (GLint) rd_u32(rx);
+
+		glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+		break;
+	}
+	case 155: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *indices = (const void *) (size_t) rd_u64(rx);
+		GLsizei instancecount = (GLsizei) rd_u32(rx);
+		GLint basevertex = (GLint) rd_u32(rx);
+		GLuint baseinstance = (GLuint) rd_u32(rx);
+
+		glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+		break;
+	}
+	case 156: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		GLuint start = (GLuint) rd_u32(rx);
+		GLuint end = (GLuint) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *indices = (const void *) (size_t) rd_u64(rx);
+
+		glDrawRangeElements(mode, start, end, count, type, indices);
+		break;
+	}
+	case 157: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		GLuint start = (GLuint) rd_u32(rx);
+		GLuint end = (GLuint) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *indices = (const void *) (size_t) rd_u64(rx);
+		GLint basevertex = (GLint) rd_u32(rx);
+
+		glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+		break;
+	}
+	case 158: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		GLuint id = remap(rs, NS_TRANSFORM_FEEDBACK, rd_u32(rx));
+
+		glDrawTransformFeedback(mode, id);
+		break;
+	}
+	case 159: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		GLuint id = remap(rs, NS_TRANSFORM_FEEDBACK, rd_u32(rx));
+		GLsizei instancecount = (GLsizei) rd_u32(rx);
+
+		glDrawTransformFeedbackInstanced(mode, id, instancecount);
+		break;
+	}
+	case 160: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		GLuint id = remap(rs, NS_TRANSFORM_FEEDBACK, rd_u32(rx));
+		GLuint stream = (GLuint) rd_u32(rx);
+
+		glDrawTransformFeedbackStream(mode, id, stream);
+		break;
+	}
+	case 161: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		GLuint id = remap(rs, NS_TRANSFORM_FEEDBACK, rd_u32(rx));
+		GLuint stream = (GLuint) rd_u32(rx);
+		GLsizei instancecount = (GLsizei) rd_u32(rx);
+
+		glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+		break;
+	}
+	case 162: {
+		GLenum cap = (GLenum) rd_u32(rx);
+
+		glEnable(cap);
+		break;
+	}
+	case 163: {
+		GLuint vaobj = remap(rs, NS_VERTEX_ARRAY, rd_u32(rx));
+		GLuint index = (GLuint) rd_u32(rx);
+
+		glEnableVertexArrayAttrib(vaobj, index);
+		break;
+	}
+	case 164: {
+		GLuint index = (GLuint) rd_u32(rx);
+
+		glEnableVertexAttribArray(index);
+		break;
+	}
+	case 165: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLuint index = (GLuint) rd_u32(rx);
+
+		glEnablei(target, index);
+		break;
+	}
+	case 166: {
+		glEndConditionalRender();
+		break;
+	}
+	case 167: {
+		GLenum target = (GLenum) rd_u32(rx);
+
+		glEndQuery(target);
+		break;
+	}
+	case 168: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLuint index = (GLuint) rd_u32(rx);
+
+		glEndQueryIndexed(target, index);
+		break;
+	}
+	case 169: {
+		glEndTransformFeedback();
+		break;
+	}
+	case 170: {
+		GLenum condition = (GLenum) rd_u32(rx);
+		GLbitfield flags = (GLbitfield) rd_u32(rx);
+		GLuint64 c_res = rd_u64(rx);
+		GLsync res;
+
+		res = glFenceSync(condition, flags);
+		set_sync(rs, c_res, res);
+		break;
+	}
+	case 171: {
+		glFinish();
+		break;
+	}
+	case 172: {
+		glFlush();
+		break;
+	}
+	case 173: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLintptr offset = (GLintptr) rd_u64(rx);
+		GLsizeiptr length = (GLsizeiptr) rd_u64(rx);
+
+		glFlushMappedBufferRange(target, offset, length);
+		break;
+	}
+	case 174: {
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLintptr offset = (GLintptr) rd_u64(rx);
+		GLsizeiptr length = (GLsizeiptr) rd_u64(rx);
+
+		glFlushMappedNamedBufferRange(buffer, offset, length);
+		break;
+	}
+	case 175: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint param = (GLint) rd_u32(rx);
+
+		glFramebufferParameteri(target, pname, param);
+		break;
+	}
+	case 176: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum attachment = (GLenum) rd_u32(rx);
+		GLenum renderbuffertarget = (GLenum) rd_u32(rx);
+		GLuint renderbuffer = remap(rs, NS_RENDERBUFFER, rd_u32(rx));
+
+		glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+		break;
+	}
+	case 177: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum attachment = (GLenum) rd_u32(rx);
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+
+		glFramebufferTexture(target, attachment, texture, level);
+		break;
+	}
+	case 178: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum attachment = (GLenum) rd_u32(rx);
+		GLenum textarget = (GLenum) rd_u32(rx);
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+
+		glFramebufferTexture1D(target, attachment, textarget, texture, level);
+		break;
+	}
+	case 179: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum attachment = (GLenum) rd_u32(rx);
+		GLenum textarget = (GLenum) rd_u32(rx);
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+
+		glFramebufferTexture2D(target, attachment, textarget, texture, level);
+		break;
+	}
+	case 180: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum attachment = (GLenum) rd_u32(rx);
+		GLenum textarget = (GLenum) rd_u32(rx);
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+		GLint zoffset = (GLint) rd_u32(rx);
+
+		glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+		break;
+	}
+	case 181: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum attachment = (GLenum) rd_u32(rx);
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+		GLint layer = (GLint) rd_u32(rx);
+
+		glFramebufferTextureLayer(target, attachment, texture, level, layer);
+		break;
+	}
+	case 182: {
+		GLenum mode = (GLenum) rd_u32(rx);
+
+		glFrontFace(mode);
+		break;
+	}
+	case 183: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *c_buffers = rd_data(rx);
+		GLuint *buffers = rd_out(rs, n * 4);
+
+		glGenBuffers(n, buffers);
+		remap_names(rs, NS_BUFFER, c_buffers, buffers, n);
+		break;
+	}
+	case 184: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *c_framebuffers = rd_data(rx);
+		GLuint *framebuffers = rd_out(rs, n * 4);
+
+		glGenFramebuffers(n, framebuffers);
+		remap_names(rs, NS_FRAMEBUFFER, c_framebuffers, framebuffers, n);
+		break;
+	}
+	case 185: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *c_pipelines = rd_data(rx);
+		GLuint *pipelines = rd_out(rs, n * 4);
+
+		glGenProgramPipelines(n, pipelines);
+		remap_names(rs, NS_PIPELINE, c_pipelines, pipelines, n);
+		break;
+	}
+	case 186: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *c_ids = rd_data(rx);
+		GLuint *ids = rd_out(rs, n * 4);
+
+		glGenQueries(n, ids);
+		remap_names(rs, NS_QUERY, c_ids, ids, n);
+		break;
+	}
+	case 187: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *c_renderbuffers = rd_data(rx);
+		GLuint *renderbuffers = rd_out(rs, n * 4);
+
+		glGenRenderbuffers(n, renderbuffers);
+		remap_names(rs, NS_RENDERBUFFER, c_renderbuffers, renderbuffers, n);
+		break;
+	}
+	case 188: {
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLuint *c_samplers = rd_data(rx);
+		GLuint *samplers = rd_out(rs, count * 4);
+
+		glGenSamplers(count, samplers);
+		remap_names(rs, NS_SAMPLER, c_samplers, samplers, count);
+		break;
+	}
+	case 189: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *c_textures = rd_data(rx);
+		GLuint *textures = rd_out(rs, n * 4);
+
+		glGenTextures(n, textures);
+		remap_names(rs, NS_TEXTURE, c_textures, textures, n);
+		break;
+	}
+	case 190: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *c_ids = rd_data(rx);
+		GLuint *ids = rd_out(rs, n * 4);
+
+		glGenTransformFeedbacks(n, ids);
+		remap_names(rs, NS_TRANSFORM_FEEDBACK, c_ids, ids, n);
+		break;
+	}
+	case 191: {
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLuint *c_arrays = rd_data(rx);
+		GLuint *arrays = rd_out(rs, n * 4);
+
+		glGenVertexArrays(n, arrays);
+		remap_names(rs, NS_VERTEX_ARRAY, c_arrays, arrays, n);
+		break;
+	}
+	case 192: {
+		GLenum target = (GLenum) rd_u32(rx);
+
+		glGenerateMipmap(target);
+		break;
+	}
+	case 193: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+
+		glGenerateTextureMipmap(texture);
+		break;
+	}
+	case 194: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLuint bufferIndex = (GLuint) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+		break;
+	}
+	case 195: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLuint index = (GLuint) rd_u32(rx);
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLsizei *length = rd_out(rs, bufSize * 8);
+		GLint *size = rd_out(rs, bufSize * 8);
+		GLenum *type = rd_out(rs, bufSize * 8);
+		GLchar *name = rd_out(rs, bufSize * 8);
+
+		glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+		break;
+	}
+	case 196: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLenum shadertype = (GLenum) rd_u32(rx);
+		GLuint index = (GLuint) rd_u32(rx);
+		GLsizei bufsize = (GLsizei) rd_u32(rx);
+		GLsizei *length = rd_out(rs, REPLAY_OUT_SIZE);
+		GLchar *name = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetActiveSubroutineName(program, shadertype, index, bufsize, length, name);
+		break;
+	}
+	case 197: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLenum shadertype = (GLenum) rd_u32(rx);
+		GLuint index = (GLuint) rd_u32(rx);
+		GLsizei bufsize = (GLsizei) rd_u32(rx);
+		GLsizei *length = rd_out(rs, REPLAY_OUT_SIZE);
+		GLchar *name = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetActiveSubroutineUniformName(program, shadertype, index, bufsize, length, name);
+		break;
+	}
+	case 198: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLenum shadertype = (GLenum) rd_u32(rx);
+		GLuint index = (GLuint) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *values = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+		break;
+	}
+	case 199: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLuint index = (GLuint) rd_u32(rx);
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLsizei *length = rd_out(rs, bufSize * 8);
+		GLint *size = rd_out(rs, bufSize * 8);
+		GLenum *type = rd_out(rs, bufSize * 8);
+		GLchar *name = rd_out(rs, bufSize * 8);
+
+		glGetActiveUniform(program, index, bufSize, length, size, type, name);
+		break;
+	}
+	case 200: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLuint uniformBlockIndex = (GLuint) rd_u32(rx);
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLsizei *length = rd_out(rs, bufSize * 8);
+		GLchar *uniformBlockName = rd_out(rs, bufSize * 8);
+
+		glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+		break;
+	}
+	case 201: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLuint uniformBlockIndex = (GLuint) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+		break;
+	}
+	case 202: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLuint uniformIndex = (GLuint) rd_u32(rx);
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLsizei *length = rd_out(rs, bufSize * 8);
+		GLchar *uniformName = rd_out(rs, bufSize * 8);
+
+		glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+		break;
+	}
+	case 203: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLsizei uniformCount = (GLsizei) rd_u32(rx);
+		const GLuint *uniformIndices = rd_data(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+		break;
+	}
+	case 204: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLsizei maxCount = (GLsizei) rd_u32(rx);
+		GLsizei *count = rd_out(rs, REPLAY_OUT_SIZE);
+		GLuint *shaders = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetAttachedShaders(program, maxCount, count, shaders);
+		break;
+	}
+	case 205: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		const GLchar *name = rd_string(rx);
+
+		glGetAttribLocation(program, name);
+		break;
+	}
+	case 206: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLuint index = (GLuint) rd_u32(rx);
+		GLboolean *data = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetBooleani_v(target, index, data);
+		break;
+	}
+	case 207: {
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLboolean *data = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetBooleanv(pname, data);
+		break;
+	}
+	case 208: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint64 *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetBufferParameteri64v(target, pname, params);
+		break;
+	}
+	case 209: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetBufferParameteriv(target, pname, params);
+		break;
+	}
+	case 210: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		void **params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetBufferPointerv(target, pname, params);
+		break;
+	}
+	case 211: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLintptr offset = (GLintptr) rd_u64(rx);
+		GLsizeiptr size = (GLsizeiptr) rd_u64(rx);
+		void *data = rd_out(rs, size);
+
+		glGetBufferSubData(target, offset, size, data);
+		break;
+	}
+	case 213: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		void *pixels = rd_out(rs, bufSize * 8);
+
+		glGetCompressedTextureImage(texture, level, bufSize, pixels);
+		break;
+	}
+	case 214: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+		GLint xoffset = (GLint) rd_u32(rx);
+		GLint yoffset = (GLint) rd_u32(rx);
+		GLint zoffset = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLsizei depth = (GLsizei) rd_u32(rx);
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		void *pixels = rd_out(rs, bufSize * 8);
+
+		glGetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+		break;
+	}
+	case 215: {
+		GLuint count = (GLuint) rd_u32(rx);
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLenum *sources = rd_out(rs, bufSize * 8);
+		GLenum *types = rd_out(rs, bufSize * 8);
+		GLuint *ids = rd_out(rs, bufSize * 8);
+		GLenum *severities = rd_out(rs, bufSize * 8);
+		GLsizei *lengths = rd_out(rs, bufSize * 8);
+		GLchar *messageLog = rd_out(rs, bufSize * 8);
+
+		glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+		break;
+	}
+	case 216: {
+		GLuint count = (GLuint) rd_u32(rx);
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLenum *sources = rd_out(rs, bufSize * 8);
+		GLenum *types = rd_out(rs, bufSize * 8);
+		GLuint *ids = rd_out(rs, bufSize * 8);
+		GLenum *severities = rd_out(rs, bufSize * 8);
+		GLsizei *lengths = rd_out(rs, bufSize * 8);
+		GLchar *messageLog = rd_out(rs, bufSize * 8);
+
+		glGetDebugMessageLogARB(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+		break;
+	}
+	case 217: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLuint index = (GLuint) rd_u32(rx);
+		GLdouble *data = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetDoublei_v(target, index, data);
+		break;
+	}
+	case 218: {
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLdouble *data = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetDoublev(pname, data);
+		break;
+	}
+	case 219: {
+		glGetError();
+		break;
+	}
+	case 220: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLuint index = (GLuint) rd_u32(rx);
+		GLfloat *data = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetFloati_v(target, index, data);
+		break;
+	}
+	case 221: {
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLfloat *data = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetFloatv(pname, data);
+		break;
+	}
+	case 222: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		const GLchar *name = rd_string(rx);
+
+		glGetFragDataIndex(program, name);
+		break;
+	}
+	case 223: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		const GLchar *name = rd_string(rx);
+
+		glGetFragDataLocation(program, name);
+		break;
+	}
+	case 224: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum attachment = (GLenum) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+		break;
+	}
+	case 225: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetFramebufferParameteriv(target, pname, params);
+		break;
+	}
+	case 226: {
+		glGetGraphicsResetStatus();
+		break;
+	}
+	case 227: {
+		glGetGraphicsResetStatusARB();
+		break;
+	}
+	case 228: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+		GLboolean layered = (GLboolean) rd_u32(rx);
+		GLint layer = (GLint) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+
+		glGetImageHandleARB(texture, level, layered, layer, format);
+		break;
+	}
+	case 229: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLuint index = (GLuint) rd_u32(rx);
+		GLint64 *data = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetInteger64i_v(target, index, data);
+		break;
+	}
+	case 230: {
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint64 *data = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetInteger64v(pname, data);
+		break;
+	}
+	case 231: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLuint index = (GLuint) rd_u32(rx);
+		GLint *data = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetIntegeri_v(target, index, data);
+		break;
+	}
+	case 232: {
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *data = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetIntegerv(pname, data);
+		break;
+	}
+	case 233: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLint64 *params = rd_out(rs, bufSize * 8);
+
+		glGetInternalformati64v(target, internalformat, pname, bufSize, params);
+		break;
+	}
+	case 234: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLint *params = rd_out(rs, bufSize * 8);
+
+		glGetInternalformativ(target, internalformat, pname, bufSize, params);
+		break;
+	}
+	case 235: {
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLuint index = (GLuint) rd_u32(rx);
+		GLfloat *val = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetMultisamplefv(pname, index, val);
+		break;
+	}
+	case 236: {
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint64 *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetNamedBufferParameteri64v(buffer, pname, params);
+		break;
+	}
+	case 237: {
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetNamedBufferParameteriv(buffer, pname, params);
+		break;
+	}
+	case 238: {
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		void **params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetNamedBufferPointerv(buffer, pname, params);
+		break;
+	}
+	case 239: {
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLintptr offset = (GLintptr) rd_u64(rx);
+		GLsizeiptr size = (GLsizeiptr) rd_u64(rx);
+		void *data = rd_out(rs, size);
+
+		glGetNamedBufferSubData(buffer, offset, size, data);
+		break;
+	}
+	case 240: {
+		GLuint framebuffer = remap(rs, NS_FRAMEBUFFER, rd_u32(rx));
+		GLenum attachment = (GLenum) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+		break;
+	}
+	case 241: {
+		GLuint framebuffer = remap(rs, NS_FRAMEBUFFER, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *param = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetNamedFramebufferParameteriv(framebuffer, pname, param);
+		break;
+	}
+	case 242: {
+		GLuint renderbuffer = remap(rs, NS_RENDERBUFFER, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetNamedRenderbufferParameteriv(renderbuffer, pname, params);
+		break;
+	}
+	case 245: {
+		GLenum identifier = (GLenum) rd_u32(rx);
+		GLuint name = (GLuint) rd_u32(rx);
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLsizei *length = rd_out(rs, bufSize * 8);
+		GLchar *label = rd_out(rs, bufSize * 8);
+
+		glGetObjectLabel(identifier, name, bufSize, length, label);
+		break;
+	}
+	case 247: {
+		GLenum pname = (GLenum) rd_u32(rx);
+		void **params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetPointerv(pname, params);
+		break;
+	}
+	case 248: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLsizei *length = rd_out(rs, bufSize * 8);
+		GLenum *binaryFormat = rd_out(rs, bufSize * 8);
+		void *binary = rd_out(rs, bufSize * 8);
+
+		glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+		break;
+	}
+	case 249: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLsizei *length = rd_out(rs, bufSize * 8);
+		GLchar *infoLog = rd_out(rs, bufSize * 8);
+
+		glGetProgramInfoLog(program, bufSize, length, infoLog);
+		break;
+	}
+	case 250: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLenum programInterface = (GLenum) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetProgramInterfaceiv(program, programInterface, pname, params);
+		break;
+	}
+	case 251: {
+		GLuint pipeline = remap(rs, NS_PIPELINE, rd_u32(rx));
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLsizei *length = rd_out(rs, bufSize * 8);
+		GLchar *infoLog = rd_out(rs, bufSize * 8);
+
+		glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+		break;
+	}
+	case 252: {
+		GLuint pipeline = remap(rs, NS_PIPELINE, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetProgramPipelineiv(pipeline, pname, params);
+		break;
+	}
+	case 253: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLenum programInterface = (GLenum) rd_u32(rx);
+		const GLchar *name = rd_string(rx);
+
+		glGetProgramResourceIndex(program, programInterface, name);
+		break;
+	}
+	case 254: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLenum programInterface = (GLenum) rd_u32(rx);
+		const GLchar *name = rd_string(rx);
+
+		glGetProgramResourceLocation(program, programInterface, name);
+		break;
+	}
+	case 255: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLenum programInterface = (GLenum) rd_u32(rx);
+		const GLchar *name = rd_string(rx);
+
+		glGetProgramResourceLocationIndex(program, programInterface, name);
+		break;
+	}
+	case 256: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLenum programInterface = (GLenum) rd_u32(rx);
+		GLuint index = (GLuint) rd_u32(rx);
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLsizei *length = rd_out(rs, bufSize * 8);
+		GLchar *name = rd_out(rs, bufSize * 8);
+
+		glGetProgramResourceName(program, programInterface, index, bufSize, length, name);
+		break;
+	}
+	case 257: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLenum programInterface = (GLenum) rd_u32(rx);
+		GLuint index = (GLuint) rd_u32(rx);
+		GLsizei propCount = (GLsizei) rd_u32(rx);
+		const GLenum *props = rd_data(rx);
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLsizei *length = rd_out(rs, bufSize * 8);
+		GLint *params = rd_out(rs, bufSize * 8);
+
+		glGetProgramResourceiv(program, programInterface, index, propCount, props, bufSize, length, params);
+		break;
+	}
+	case 258: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLenum shadertype = (GLenum) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *values = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetProgramStageiv(program, shadertype, pname, values);
+		break;
+	}
+	case 259: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetProgramiv(program, pname, params);
+		break;
+	}
+	case 260: {
+		GLuint id = remap(rs, NS_QUERY, rd_u32(rx));
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLintptr offset = (GLintptr) rd_u64(rx);
+
+		glGetQueryBufferObjecti64v(id, buffer, pname, offset);
+		break;
+	}
+	case 261: {
+		GLuint id = remap(rs, NS_QUERY, rd_u32(rx));
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLintptr offset = (GLintptr) rd_u64(rx);
+
+		glGetQueryBufferObjectiv(id, buffer, pname, offset);
+		break;
+	}
+	case 262: {
+		GLuint id = remap(rs, NS_QUERY, rd_u32(rx));
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLintptr offset = (GLintptr) rd_u64(rx);
+
+		glGetQueryBufferObjectui64v(id, buffer, pname, offset);
+		break;
+	}
+	case 263: {
+		GLuint id = remap(rs, NS_QUERY, rd_u32(rx));
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLintptr offset = (GLintptr) rd_u64(rx);
+
+		glGetQueryBufferObjectuiv(id, buffer, pname, offset);
+		break;
+	}
+	case 264: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLuint index = (GLuint) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetQueryIndexediv(target, index, pname, params);
+		break;
+	}
+	case 265: {
+		GLuint id = remap(rs, NS_QUERY, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint64 *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetQueryObjecti64v(id, pname, params);
+		break;
+	}
+	case 266: {
+		GLuint id = remap(rs, NS_QUERY, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetQueryObjectiv(id, pname, params);
+		break;
+	}
+	case 267: {
+		GLuint id = remap(rs, NS_QUERY, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLuint64 *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetQueryObjectui64v(id, pname, params);
+		break;
+	}
+	case 268: {
+		GLuint id = remap(rs, NS_QUERY, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLuint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetQueryObjectuiv(id, pname, params);
+		break;
+	}
+	case 269: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetQueryiv(target, pname, params);
+		break;
+	}
+	case 270: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetRenderbufferParameteriv(target, pname, params);
+		break;
+	}
+	case 271: {
+		GLuint sampler = remap(rs, NS_SAMPLER, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetSamplerParameterIiv(sampler, pname, params);
+		break;
+	}
+	case 272: {
+		GLuint sampler = remap(rs, NS_SAMPLER, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLuint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetSamplerParameterIuiv(sampler, pname, params);
+		break;
+	}
+	case 273: {
+		GLuint sampler = remap(rs, NS_SAMPLER, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLfloat *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetSamplerParameterfv(sampler, pname, params);
+		break;
+	}
+	case 274: {
+		GLuint sampler = remap(rs, NS_SAMPLER, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetSamplerParameteriv(sampler, pname, params);
+		break;
+	}
+	case 275: {
+		GLuint shader = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLsizei *length = rd_out(rs, bufSize * 8);
+		GLchar *infoLog = rd_out(rs, bufSize * 8);
+
+		glGetShaderInfoLog(shader, bufSize, length, infoLog);
+		break;
+	}
+	case 276: {
+		GLenum shadertype = (GLenum) rd_u32(rx);
+		GLenum precisiontype = (GLenum) rd_u32(rx);
+		GLint *range = rd_out(rs, REPLAY_OUT_SIZE);
+		GLint *precision = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+		break;
+	}
+	case 277: {
+		GLuint shader = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLsizei *length = rd_out(rs, bufSize * 8);
+		GLchar *source = rd_out(rs, bufSize * 8);
+
+		glGetShaderSource(shader, bufSize, length, source);
+		break;
+	}
+	case 278: {
+		GLuint shader = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetShaderiv(shader, pname, params);
+		break;
+	}
+	case 279: {
+		GLenum name = (GLenum) rd_u32(rx);
+
+		glGetString(name);
+		break;
+	}
+	case 280: {
+		GLenum name = (GLenum) rd_u32(rx);
+		GLuint index = (GLuint) rd_u32(rx);
+
+		glGetStringi(name, index);
+		break;
+	}
+	case 281: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLenum shadertype = (GLenum) rd_u32(rx);
+		const GLchar *name = rd_string(rx);
+
+		glGetSubroutineIndex(program, shadertype, name);
+		break;
+	}
+	case 282: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLenum shadertype = (GLenum) rd_u32(rx);
+		const GLchar *name = rd_string(rx);
+
+		glGetSubroutineUniformLocation(program, shadertype, name);
+		break;
+	}
+	case 283: {
+		GLsync sync = replay_sync(rs, rd_u64(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLsizei *length = rd_out(rs, bufSize * 8);
+		GLint *values = rd_out(rs, bufSize * 8);
+
+		glGetSynciv(sync, pname, bufSize, length, values);
+		break;
+	}
+	case 285: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint level = (GLint) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLfloat *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetTexLevelParameterfv(target, level, pname, params);
+		break;
+	}
+	case 286: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint level = (GLint) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetTexLevelParameteriv(target, level, pname, params);
+		break;
+	}
+	case 287: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetTexParameterIiv(target, pname, params);
+		break;
+	}
+	case 288: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLuint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetTexParameterIuiv(target, pname, params);
+		break;
+	}
+	case 289: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLfloat *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetTexParameterfv(target, pname, params);
+		break;
+	}
+	case 290: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetTexParameteriv(target, pname, params);
+		break;
+	}
+	case 291: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+
+		glGetTextureHandleARB(texture);
+		break;
+	}
+	case 292: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		void *pixels = rd_out(rs, bufSize * 8);
+
+		glGetTextureImage(texture, level, format, type, bufSize, pixels);
+		break;
+	}
+	case 293: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLfloat *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetTextureLevelParameterfv(texture, level, pname, params);
+		break;
+	}
+	case 294: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetTextureLevelParameteriv(texture, level, pname, params);
+		break;
+	}
+	case 295: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetTextureParameterIiv(texture, pname, params);
+		break;
+	}
+	case 296: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLuint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetTextureParameterIuiv(texture, pname, params);
+		break;
+	}
+	case 297: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLfloat *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetTextureParameterfv(texture, pname, params);
+		break;
+	}
+	case 298: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetTextureParameteriv(texture, pname, params);
+		break;
+	}
+	case 299: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLuint sampler = remap(rs, NS_SAMPLER, rd_u32(rx));
+
+		glGetTextureSamplerHandleARB(texture, sampler);
+		break;
+	}
+	case 300: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+		GLint xoffset = (GLint) rd_u32(rx);
+		GLint yoffset = (GLint) rd_u32(rx);
+		GLint zoffset = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLsizei depth = (GLsizei) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		void *pixels = rd_out(rs, bufSize * 8);
+
+		glGetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+		break;
+	}
+	case 301: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLuint index = (GLuint) rd_u32(rx);
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLsizei *length = rd_out(rs, bufSize * 8);
+		GLsizei *size = rd_out(rs, bufSize * 8);
+		GLenum *type = rd_out(rs, bufSize * 8);
+		GLchar *name = rd_out(rs, bufSize * 8);
+
+		glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+		break;
+	}
+	case 302: {
+		GLuint xfb = remap(rs, NS_TRANSFORM_FEEDBACK, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLuint index = (GLuint) rd_u32(rx);
+		GLint64 *param = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetTransformFeedbacki64_v(xfb, pname, index, param);
+		break;
+	}
+	case 303: {
+		GLuint xfb = remap(rs, NS_TRANSFORM_FEEDBACK, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLuint index = (GLuint) rd_u32(rx);
+		GLint *param = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetTransformFeedbacki_v(xfb, pname, index, param);
+		break;
+	}
+	case 304: {
+		GLuint xfb = remap(rs, NS_TRANSFORM_FEEDBACK, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *param = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetTransformFeedbackiv(xfb, pname, param);
+		break;
+	}
+	case 305: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		const GLchar *uniformBlockName = rd_string(rx);
+
+		glGetUniformBlockIndex(program, uniformBlockName);
+		break;
+	}
+	case 306: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLsizei uniformCount = (GLsizei) rd_u32(rx);
+		const GLchar *const*uniformNames = rd_strings(rs, rx);
+		GLuint *uniformIndices = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+		break;
+	}
+	case 307: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		const GLchar *name = rd_string(rx);
+		GLint c_res = (GLint) rd_u32(rx);
+		GLint res;
+
+		res = glGetUniformLocation(program, name);
+		set_location(rs, program, c_res, res);
+		break;
+	}
+	case 308: {
+		GLenum shadertype = (GLenum) rd_u32(rx);
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLuint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetUniformSubroutineuiv(shadertype, location, params);
+		break;
+	}
+	case 309: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLdouble *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetUniformdv(program, location, params);
+		break;
+	}
+	case 310: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLfloat *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetUniformfv(program, location, params);
+		break;
+	}
+	case 311: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetUniformiv(program, location, params);
+		break;
+	}
+	case 312: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLuint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetUniformuiv(program, location, params);
+		break;
+	}
+	case 313: {
+		GLuint vaobj = remap(rs, NS_VERTEX_ARRAY, rd_u32(rx));
+		GLuint index = (GLuint) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint64 *param = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetVertexArrayIndexed64iv(vaobj, index, pname, param);
+		break;
+	}
+	case 314: {
+		GLuint vaobj = remap(rs, NS_VERTEX_ARRAY, rd_u32(rx));
+		GLuint index = (GLuint) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *param = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetVertexArrayIndexediv(vaobj, index, pname, param);
+		break;
+	}
+	case 315: {
+		GLuint vaobj = remap(rs, NS_VERTEX_ARRAY, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *param = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetVertexArrayiv(vaobj, pname, param);
+		break;
+	}
+	case 316: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetVertexAttribIiv(index, pname, params);
+		break;
+	}
+	case 317: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLuint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetVertexAttribIuiv(index, pname, params);
+		break;
+	}
+	case 318: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLdouble *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetVertexAttribLdv(index, pname, params);
+		break;
+	}
+	case 319: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLuint64EXT *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetVertexAttribLui64vARB(index, pname, params);
+		break;
+	}
+	case 320: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		void **pointer = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetVertexAttribPointerv(index, pname, pointer);
+		break;
+	}
+	case 321: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLdouble *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetVertexAttribdv(index, pname, params);
+		break;
+	}
+	case 322: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLfloat *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetVertexAttribfv(index, pname, params);
+		break;
+	}
+	case 323: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint *params = rd_out(rs, REPLAY_OUT_SIZE);
+
+		glGetVertexAttribiv(index, pname, params);
+		break;
+	}
+	case 324: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint lod = (GLint) rd_u32(rx);
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		void *pixels = rd_out(rs, bufSize * 8);
+
+		glGetnCompressedTexImage(target, lod, bufSize, pixels);
+		break;
+	}
+	case 325: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint lod = (GLint) rd_u32(rx);
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		void *img = rd_out(rs, bufSize * 8);
+
+		glGetnCompressedTexImageARB(target, lod, bufSize, img);
+		break;
+	}
+	case 326: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint level = (GLint) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		void *pixels = rd_out(rs, bufSize * 8);
+
+		glGetnTexImage(target, level, format, type, bufSize, pixels);
+		break;
+	}
+	case 327: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint level = (GLint) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		void *img = rd_out(rs, bufSize * 8);
+
+		glGetnTexImageARB(target, level, format, type, bufSize, img);
+		break;
+	}
+	case 328: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLdouble *params = rd_out(rs, bufSize * 8);
+
+		glGetnUniformdv(program, location, bufSize, params);
+		break;
+	}
+	case 329: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLdouble *params = rd_out(rs, bufSize * 8);
+
+		glGetnUniformdvARB(program, location, bufSize, params);
+		break;
+	}
+	case 330: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLfloat *params = rd_out(rs, bufSize * 8);
+
+		glGetnUniformfv(program, location, bufSize, params);
+		break;
+	}
+	case 331: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLfloat *params = rd_out(rs, bufSize * 8);
+
+		glGetnUniformfvARB(program, location, bufSize, params);
+		break;
+	}
+	case 332: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLint *params = rd_out(rs, bufSize * 8);
+
+		glGetnUniformiv(program, location, bufSize, params);
+		break;
+	}
+	case 333: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLint *params = rd_out(rs, bufSize * 8);
+
+		glGetnUniformivARB(program, location, bufSize, params);
+		break;
+	}
+	case 334: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLuint *params = rd_out(rs, bufSize * 8);
+
+		glGetnUniformuiv(program, location, bufSize, params);
+		break;
+	}
+	case 335: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		GLuint *params = rd_out(rs, bufSize * 8);
+
+		glGetnUniformuivARB(program, location, bufSize, params);
+		break;
+	}
+	case 336: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum mode = (GLenum) rd_u32(rx);
+
+		glHint(target, mode);
+		break;
+	}
+	case 337: {
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+
+		glInvalidateBufferData(buffer);
+		break;
+	}
+	case 338: {
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLintptr offset = (GLintptr) rd_u64(rx);
+		GLsizeiptr length = (GLsizeiptr) rd_u64(rx);
+
+		glInvalidateBufferSubData(buffer, offset, length);
+		break;
+	}
+	case 339: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLsizei numAttachments = (GLsizei) rd_u32(rx);
+		const GLenum *attachments = rd_data(rx);
+
+		glInvalidateFramebuffer(target, numAttachments, attachments);
+		break;
+	}
+	case 340: {
+		GLuint framebuffer = remap(rs, NS_FRAMEBUFFER, rd_u32(rx));
+		GLsizei numAttachments = (GLsizei) rd_u32(rx);
+		const GLenum *attachments = rd_data(rx);
+
+		glInvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+		break;
+	}
+	case 341: {
+		GLuint framebuffer = remap(rs, NS_FRAMEBUFFER, rd_u32(rx));
+		GLsizei numAttachments = (GLsizei) rd_u32(rx);
+		const GLenum *attachments = rd_data(rx);
+		GLint x = (GLint) rd_u32(rx);
+		GLint y = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+
+		glInvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+		break;
+	}
+	case 342: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLsizei numAttachments = (GLsizei) rd_u32(rx);
+		const GLenum *attachments = rd_data(rx);
+		GLint x = (GLint) rd_u32(rx);
+		GLint y = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+
+		glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+		break;
+	}
+	case 343: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+
+		glInvalidateTexImage(texture, level);
+		break;
+	}
+	case 344: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+		GLint xoffset = (GLint) rd_u32(rx);
+		GLint yoffset = (GLint) rd_u32(rx);
+		GLint zoffset = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLsizei depth = (GLsizei) rd_u32(rx);
+
+		glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+		break;
+	}
+	case 345: {
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+
+		glIsBuffer(buffer);
+		break;
+	}
+	case 346: {
+		GLenum cap = (GLenum) rd_u32(rx);
+
+		glIsEnabled(cap);
+		break;
+	}
+	case 347: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLuint index = (GLuint) rd_u32(rx);
+
+		glIsEnabledi(target, index);
+		break;
+	}
+	case 348: {
+		GLuint framebuffer = remap(rs, NS_FRAMEBUFFER, rd_u32(rx));
+
+		glIsFramebuffer(framebuffer);
+		break;
+	}
+	case 349: {
+		GLuint64 handle = (GLuint64) rd_u64(rx);
+
+		glIsImageHandleResidentARB(handle);
+		break;
+	}
+	case 351: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+
+		glIsProgram(program);
+		break;
+	}
+	case 352: {
+		GLuint pipeline = remap(rs, NS_PIPELINE, rd_u32(rx));
+
+		glIsProgramPipeline(pipeline);
+		break;
+	}
+	case 353: {
+		GLuint id = remap(rs, NS_QUERY, rd_u32(rx));
+
+		glIsQuery(id);
+		break;
+	}
+	case 354: {
+		GLuint renderbuffer = remap(rs, NS_RENDERBUFFER, rd_u32(rx));
+
+		glIsRenderbuffer(renderbuffer);
+		break;
+	}
+	case 355: {
+		GLuint sampler = remap(rs, NS_SAMPLER, rd_u32(rx));
+
+		glIsSampler(sampler);
+		break;
+	}
+	case 356: {
+		GLuint shader = remap(rs, NS_PROGRAM, rd_u32(rx));
+
+		glIsShader(shader);
+		break;
+	}
+	case 357: {
+		GLsync sync = replay_sync(rs, rd_u64(rx));
+
+		glIsSync(sync);
+		break;
+	}
+	case 358: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+
+		glIsTexture(texture);
+		break;
+	}
+	case 359: {
+		GLuint64 handle = (GLuint64) rd_u64(rx);
+
+		glIsTextureHandleResidentARB(handle);
+		break;
+	}
+	case 360: {
+		GLuint id = remap(rs, NS_TRANSFORM_FEEDBACK, rd_u32(rx));
+
+		glIsTransformFeedback(id);
+		break;
+	}
+	case 361: {
+		GLuint array = remap(rs, NS_VERTEX_ARRAY, rd_u32(rx));
+
+		glIsVertexArray(array);
+		break;
+	}
+	case 362: {
+		GLfloat width = rd_f32(rx);
+
+		glLineWidth(width);
+		break;
+	}
+	case 363: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+
+		glLinkProgram(program);
+		break;
+	}
+	case 364: {
+		GLenum opcode = (GLenum) rd_u32(rx);
+
+		glLogicOp(opcode);
+		break;
+	}
+	case 365: {
+		GLuint64 handle = (GLuint64) rd_u64(rx);
+
+		glMakeImageHandleNonResidentARB(handle);
+		break;
+	}
+	case 366: {
+		GLuint64 handle = (GLuint64) rd_u64(rx);
+		GLenum access = (GLenum) rd_u32(rx);
+
+		glMakeImageHandleResidentARB(handle, access);
+		break;
+	}
+	case 367: {
+		GLuint64 handle = (GLuint64) rd_u64(rx);
+
+		glMakeTextureHandleNonResidentARB(handle);
+		break;
+	}
+	case 368: {
+		GLuint64 handle = (GLuint64) rd_u64(rx);
+
+		glMakeTextureHandleResidentARB(handle);
+		break;
+	}
+	case 369: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum access = (GLenum) rd_u32(rx);
+		void *res;
+
+		res = glMapBuffer(target, access);
+		set_map(rs, 0, target, res, replay_buffer_size(0, target));
+		break;
+	}
+	case 370: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLintptr offset = (GLintptr) rd_u64(rx);
+		GLsizeiptr length = (GLsizeiptr) rd_u64(rx);
+		GLbitfield access = (GLbitfield) rd_u32(rx);
+		void *res;
+
+		res = glMapBufferRange(target, offset, length, access);
+		set_map(rs, 0, target, res, length);
+		break;
+	}
+	case 371: {
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLenum access = (GLenum) rd_u32(rx);
+		void *res;
+
+		res = glMapNamedBuffer(buffer, access);
+		set_map(rs, 1, buffer, res, replay_buffer_size(1, buffer));
+		break;
+	}
+	case 372: {
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLintptr offset = (GLintptr) rd_u64(rx);
+		GLsizeiptr length = (GLsizeiptr) rd_u64(rx);
+		GLbitfield access = (GLbitfield) rd_u32(rx);
+		void *res;
+
+		res = glMapNamedBufferRange(buffer, offset, length, access);
+		set_map(rs, 1, buffer, res, length);
+		break;
+	}
+	case 373: {
+		GLbitfield barriers = (GLbitfield) rd_u32(rx);
+
+		glMemoryBarrier(barriers);
+		break;
+	}
+	case 374: {
+		GLbitfield barriers = (GLbitfield) rd_u32(rx);
+
+		glMemoryBarrierByRegion(barriers);
+		break;
+	}
+	case 375: {
+		GLfloat value = rd_f32(rx);
+
+		glMinSampleShading(value);
+		break;
+	}
+	case 376: {
+		GLfloat value = rd_f32(rx);
+
+		glMinSampleShadingARB(value);
+		break;
+	}
+	case 377: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		const GLint *first = rd_data(rx);
+		const GLsizei *count = rd_data(rx);
+		GLsizei drawcount = (GLsizei) rd_u32(rx);
+
+		glMultiDrawArrays(mode, first, count, drawcount);
+		break;
+	}
+	case 378: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		const void *indirect = (const void *) (size_t) rd_u64(rx);
+		GLsizei drawcount = (GLsizei) rd_u32(rx);
+		GLsizei stride = (GLsizei) rd_u32(rx);
+
+		glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+		break;
+	}
+	case 379: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		GLintptr indirect = (GLintptr) rd_u64(rx);
+		GLintptr drawcount = (GLintptr) rd_u64(rx);
+		GLsizei maxdrawcount = (GLsizei) rd_u32(rx);
+		GLsizei stride = (GLsizei) rd_u32(rx);
+
+		glMultiDrawArraysIndirectCountARB(mode, indirect, drawcount, maxdrawcount, stride);
+		break;
+	}
+	case 380: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		const GLsizei *count = rd_data(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *const*indices = rd_offsets(rs, rx);
+		GLsizei drawcount = (GLsizei) rd_u32(rx);
+
+		glMultiDrawElements(mode, count, type, indices, drawcount);
+		break;
+	}
+	case 381: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		const GLsizei *count = rd_data(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *const*indices = rd_offsets(rs, rx);
+		GLsizei drawcount = (GLsizei) rd_u32(rx);
+		const GLint *basevertex = rd_data(rx);
+
+		glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+		break;
+	}
+	case 382: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *indirect = (const void *) (size_t) rd_u64(rx);
+		GLsizei drawcount = (GLsizei) rd_u32(rx);
+		GLsizei stride = (GLsizei) rd_u32(rx);
+
+		glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+		break;
+	}
+	case 383: {
+		GLenum mode = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLintptr indirect = (GLintptr) rd_u64(rx);
+		GLintptr drawcount = (GLintptr) rd_u64(rx);
+		GLsizei maxdrawcount = (GLsizei) rd_u32(rx);
+		GLsizei stride = (GLsizei) rd_u32(rx);
+
+		glMultiDrawElementsIndirectCountARB(mode, type, indirect, drawcount, maxdrawcount, stride);
+		break;
+	}
+	case 384: {
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLsizeiptr size = (GLsizeiptr) rd_u64(rx);
+		const void *data = rd_data(rx);
+		GLenum usage = (GLenum) rd_u32(rx);
+
+		glNamedBufferData(buffer, size, data, usage);
+		break;
+	}
+	case 385: {
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLintptr offset = (GLintptr) rd_u64(rx);
+		GLsizeiptr size = (GLsizeiptr) rd_u64(rx);
+		GLboolean commit = (GLboolean) rd_u32(rx);
+
+		glNamedBufferPageCommitmentARB(buffer, offset, size, commit);
+		break;
+	}
+	case 386: {
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLintptr offset = (GLintptr) rd_u64(rx);
+		GLsizeiptr size = (GLsizeiptr) rd_u64(rx);
+		GLboolean commit = (GLboolean) rd_u32(rx);
+
+		glNamedBufferPageCommitmentEXT(buffer, offset, size, commit);
+		break;
+	}
+	case 387: {
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLsizeiptr size = (GLsizeiptr) rd_u64(rx);
+		const void *data = rd_data(rx);
+		GLbitfield flags = (GLbitfield) rd_u32(rx);
+
+		glNamedBufferStorage(buffer, size, data, flags);
+		break;
+	}
+	case 388: {
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLintptr offset = (GLintptr) rd_u64(rx);
+		GLsizeiptr size = (GLsizeiptr) rd_u64(rx);
+		const void *data = rd_data(rx);
+
+		glNamedBufferSubData(buffer, offset, size, data);
+		break;
+	}
+	case 389: {
+		GLuint framebuffer = remap(rs, NS_FRAMEBUFFER, rd_u32(rx));
+		GLenum buf = (GLenum) rd_u32(rx);
+
+		glNamedFramebufferDrawBuffer(framebuffer, buf);
+		break;
+	}
+	case 390: {
+		GLuint framebuffer = remap(rs, NS_FRAMEBUFFER, rd_u32(rx));
+		GLsizei n = (GLsizei) rd_u32(rx);
+		const GLenum *bufs = rd_data(rx);
+
+		glNamedFramebufferDrawBuffers(framebuffer, n, bufs);
+		break;
+	}
+	case 391: {
+		GLuint framebuffer = remap(rs, NS_FRAMEBUFFER, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint param = (GLint) rd_u32(rx);
+
+		glNamedFramebufferParameteri(framebuffer, pname, param);
+		break;
+	}
+	case 392: {
+		GLuint framebuffer = remap(rs, NS_FRAMEBUFFER, rd_u32(rx));
+		GLenum src = (GLenum) rd_u32(rx);
+
+		glNamedFramebufferReadBuffer(framebuffer, src);
+		break;
+	}
+	case 393: {
+		GLuint framebuffer = remap(rs, NS_FRAMEBUFFER, rd_u32(rx));
+		GLenum attachment = (GLenum) rd_u32(rx);
+		GLenum renderbuffertarget = (GLenum) rd_u32(rx);
+		GLuint renderbuffer = remap(rs, NS_RENDERBUFFER, rd_u32(rx));
+
+		glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+		break;
+	}
+	case 394: {
+		GLuint framebuffer = remap(rs, NS_FRAMEBUFFER, rd_u32(rx));
+		GLenum attachment = (GLenum) rd_u32(rx);
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+
+		glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+		break;
+	}
+	case 395: {
+		GLuint framebuffer = remap(rs, NS_FRAMEBUFFER, rd_u32(rx));
+		GLenum attachment = (GLenum) rd_u32(rx);
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+		GLint layer = (GLint) rd_u32(rx);
+
+		glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+		break;
+	}
+	case 396: {
+		GLuint renderbuffer = remap(rs, NS_RENDERBUFFER, rd_u32(rx));
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+
+		glNamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+		break;
+	}
+	case 397: {
+		GLuint renderbuffer = remap(rs, NS_RENDERBUFFER, rd_u32(rx));
+		GLsizei samples = (GLsizei) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+
+		glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+		break;
+	}
+	case 399: {
+		GLenum identifier = (GLenum) rd_u32(rx);
+		GLuint name = (GLuint) rd_u32(rx);
+		GLsizei length = (GLsizei) rd_u32(rx);
+		const GLchar *label = rd_string(rx);
+
+		glObjectLabel(identifier, name, length, label);
+		break;
+	}
+	case 401: {
+		GLenum pname = (GLenum) rd_u32(rx);
+		const GLfloat *values = rd_data(rx);
+
+		glPatchParameterfv(pname, values);
+		break;
+	}
+	case 402: {
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint value = (GLint) rd_u32(rx);
+
+		glPatchParameteri(pname, value);
+		break;
+	}
+	case 403: {
+		glPauseTransformFeedback();
+		break;
+	}
+	case 404: {
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLfloat param = rd_f32(rx);
+
+		glPixelStoref(pname, param);
+		break;
+	}
+	case 405: {
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint param = (GLint) rd_u32(rx);
+
+		glPixelStorei(pname, param);
+		break;
+	}
+	case 406: {
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLfloat param = rd_f32(rx);
+
+		glPointParameterf(pname, param);
+		break;
+	}
+	case 407: {
+		GLenum pname = (GLenum) rd_u32(rx);
+		const GLfloat *params = rd_data(rx);
+
+		glPointParameterfv(pname, params);
+		break;
+	}
+	case 408: {
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint param = (GLint) rd_u32(rx);
+
+		glPointParameteri(pname, param);
+		break;
+	}
+	case 409: {
+		GLenum pname = (GLenum) rd_u32(rx);
+		const GLint *params = rd_data(rx);
+
+		glPointParameteriv(pname, params);
+		break;
+	}
+	case 410: {
+		GLfloat size = rd_f32(rx);
+
+		glPointSize(size);
+		break;
+	}
+	case 411: {
+		GLenum face = (GLenum) rd_u32(rx);
+		GLenum mode = (GLenum) rd_u32(rx);
+
+		glPolygonMode(face, mode);
+		break;
+	}
+	case 412: {
+		GLfloat factor = rd_f32(rx);
+		GLfloat units = rd_f32(rx);
+
+		glPolygonOffset(factor, units);
+		break;
+	}
+	case 413: {
+		glPopDebugGroup();
+		break;
+	}
+	case 414: {
+		GLuint index = (GLuint) rd_u32(rx);
+
+		glPrimitiveRestartIndex(index);
+		break;
+	}
+	case 415: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLenum binaryFormat = (GLenum) rd_u32(rx);
+		const void *binary = rd_data(rx);
+		GLsizei length = (GLsizei) rd_u32(rx);
+
+		glProgramBinary(program, binaryFormat, binary, length);
+		break;
+	}
+	case 416: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint value = (GLint) rd_u32(rx);
+
+		glProgramParameteri(program, pname, value);
+		break;
+	}
+	case 417: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLdouble v0 = rd_f64(rx);
+
+		glProgramUniform1d(program, location, v0);
+		break;
+	}
+	case 418: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glProgramUniform1dv(program, location, count, value);
+		break;
+	}
+	case 419: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLfloat v0 = rd_f32(rx);
+
+		glProgramUniform1f(program, location, v0);
+		break;
+	}
+	case 420: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glProgramUniform1fv(program, location, count, value);
+		break;
+	}
+	case 421: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLint v0 = (GLint) rd_u32(rx);
+
+		glProgramUniform1i(program, location, v0);
+		break;
+	}
+	case 422: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLint *value = rd_data(rx);
+
+		glProgramUniform1iv(program, location, count, value);
+		break;
+	}
+	case 423: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLuint v0 = (GLuint) rd_u32(rx);
+
+		glProgramUniform1ui(program, location, v0);
+		break;
+	}
+	case 424: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLuint *value = rd_data(rx);
+
+		glProgramUniform1uiv(program, location, count, value);
+		break;
+	}
+	case 425: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLdouble v0 = rd_f64(rx);
+		GLdouble v1 = rd_f64(rx);
+
+		glProgramUniform2d(program, location, v0, v1);
+		break;
+	}
+	case 426: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glProgramUniform2dv(program, location, count, value);
+		break;
+	}
+	case 427: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLfloat v0 = rd_f32(rx);
+		GLfloat v1 = rd_f32(rx);
+
+		glProgramUniform2f(program, location, v0, v1);
+		break;
+	}
+	case 428: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glProgramUniform2fv(program, location, count, value);
+		break;
+	}
+	case 429: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLint v0 = (GLint) rd_u32(rx);
+		GLint v1 = (GLint) rd_u32(rx);
+
+		glProgramUniform2i(program, location, v0, v1);
+		break;
+	}
+	case 430: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLint *value = rd_data(rx);
+
+		glProgramUniform2iv(program, location, count, value);
+		break;
+	}
+	case 431: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLuint v0 = (GLuint) rd_u32(rx);
+		GLuint v1 = (GLuint) rd_u32(rx);
+
+		glProgramUniform2ui(program, location, v0, v1);
+		break;
+	}
+	case 432: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLuint *value = rd_data(rx);
+
+		glProgramUniform2uiv(program, location, count, value);
+		break;
+	}
+	case 433: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLdouble v0 = rd_f64(rx);
+		GLdouble v1 = rd_f64(rx);
+		GLdouble v2 = rd_f64(rx);
+
+		glProgramUniform3d(program, location, v0, v1, v2);
+		break;
+	}
+	case 434: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glProgramUniform3dv(program, location, count, value);
+		break;
+	}
+	case 435: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLfloat v0 = rd_f32(rx);
+		GLfloat v1 = rd_f32(rx);
+		GLfloat v2 = rd_f32(rx);
+
+		glProgramUniform3f(program, location, v0, v1, v2);
+		break;
+	}
+	case 436: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glProgramUniform3fv(program, location, count, value);
+		break;
+	}
+	case 437: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLint v0 = (GLint) rd_u32(rx);
+		GLint v1 = (GLint) rd_u32(rx);
+		GLint v2 = (GLint) rd_u32(rx);
+
+		glProgramUniform3i(program, location, v0, v1, v2);
+		break;
+	}
+	case 438: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLint *value = rd_data(rx);
+
+		glProgramUniform3iv(program, location, count, value);
+		break;
+	}
+	case 439: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLuint v0 = (GLuint) rd_u32(rx);
+		GLuint v1 = (GLuint) rd_u32(rx);
+		GLuint v2 = (GLuint) rd_u32(rx);
+
+		glProgramUniform3ui(program, location, v0, v1, v2);
+		break;
+	}
+	case 440: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLuint *value = rd_data(rx);
+
+		glProgramUniform3uiv(program, location, count, value);
+		break;
+	}
+	case 441: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLdouble v0 = rd_f64(rx);
+		GLdouble v1 = rd_f64(rx);
+		GLdouble v2 = rd_f64(rx);
+		GLdouble v3 = rd_f64(rx);
+
+		glProgramUniform4d(program, location, v0, v1, v2, v3);
+		break;
+	}
+	case 442: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glProgramUniform4dv(program, location, count, value);
+		break;
+	}
+	case 443: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLfloat v0 = rd_f32(rx);
+		GLfloat v1 = rd_f32(rx);
+		GLfloat v2 = rd_f32(rx);
+		GLfloat v3 = rd_f32(rx);
+
+		glProgramUniform4f(program, location, v0, v1, v2, v3);
+		break;
+	}
+	case 444: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glProgramUniform4fv(program, location, count, value);
+		break;
+	}
+	case 445: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLint v0 = (GLint) rd_u32(rx);
+		GLint v1 = (GLint) rd_u32(rx);
+		GLint v2 = (GLint) rd_u32(rx);
+		GLint v3 = (GLint) rd_u32(rx);
+
+		glProgramUniform4i(program, location, v0, v1, v2, v3);
+		break;
+	}
+	case 446: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLint *value = rd_data(rx);
+
+		glProgramUniform4iv(program, location, count, value);
+		break;
+	}
+	case 447: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLuint v0 = (GLuint) rd_u32(rx);
+		GLuint v1 = (GLuint) rd_u32(rx);
+		GLuint v2 = (GLuint) rd_u32(rx);
+		GLuint v3 = (GLuint) rd_u32(rx);
+
+		glProgramUniform4ui(program, location, v0, v1, v2, v3);
+		break;
+	}
+	case 448: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLuint *value = rd_data(rx);
+
+		glProgramUniform4uiv(program, location, count, value);
+		break;
+	}
+	case 449: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLuint64 value = (GLuint64) rd_u64(rx);
+
+		glProgramUniformHandleui64ARB(program, location, value);
+		break;
+	}
+	case 450: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLuint64 *values = rd_data(rx);
+
+		glProgramUniformHandleui64vARB(program, location, count, values);
+		break;
+	}
+	case 451: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glProgramUniformMatrix2dv(program, location, count, transpose, value);
+		break;
+	}
+	case 452: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glProgramUniformMatrix2fv(program, location, count, transpose, value);
+		break;
+	}
+	case 453: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+		break;
+	}
+	case 454: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+		break;
+	}
+	case 455: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+		break;
+	}
+	case 456: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+		break;
+	}
+	case 457: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glProgramUniformMatrix3dv(program, location, count, transpose, value);
+		break;
+	}
+	case 458: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glProgramUniformMatrix3fv(program, location, count, transpose, value);
+		break;
+	}
+	case 459: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+		break;
+	}
+	case 460: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+		break;
+	}
+	case 461: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+		break;
+	}
+	case 462: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+		break;
+	}
+	case 463: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glProgramUniformMatrix4dv(program, location, count, transpose, value);
+		break;
+	}
+	case 464: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glProgramUniformMatrix4fv(program, location, count, transpose, value);
+		break;
+	}
+	case 465: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+		break;
+	}
+	case 466: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+		break;
+	}
+	case 467: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+		break;
+	}
+	case 468: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLint location = remap_location(rs, program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+		break;
+	}
+	case 469: {
+		GLenum mode = (GLenum) rd_u32(rx);
+
+		glProvokingVertex(mode);
+		break;
+	}
+	case 470: {
+		GLenum source = (GLenum) rd_u32(rx);
+		GLuint id = (GLuint) rd_u32(rx);
+		GLsizei length = (GLsizei) rd_u32(rx);
+		const GLchar *message = rd_string(rx);
+
+		glPushDebugGroup(source, id, length, message);
+		break;
+	}
+	case 471: {
+		GLuint id = remap(rs, NS_QUERY, rd_u32(rx));
+		GLenum target = (GLenum) rd_u32(rx);
+
+		glQueryCounter(id, target);
+		break;
+	}
+	case 472: {
+		GLenum src = (GLenum) rd_u32(rx);
+
+		glReadBuffer(src);
+		break;
+	}
+	case 473: {
+		GLint x = (GLint) rd_u32(rx);
+		GLint y = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		void *pixels = rd_pack(rs, rx, (size_t) width * height * 16);
+
+		glReadPixels(x, y, width, height, format, type, pixels);
+		break;
+	}
+	case 474: {
+		GLint x = (GLint) rd_u32(rx);
+		GLint y = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		void *data = rd_pack(rs, rx, (size_t) width * height * 16);
+
+		glReadnPixels(x, y, width, height, format, type, bufSize, data);
+		break;
+	}
+	case 475: {
+		GLint x = (GLint) rd_u32(rx);
+		GLint y = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLsizei bufSize = (GLsizei) rd_u32(rx);
+		void *data = rd_pack(rs, rx, (size_t) width * height * 16);
+
+		glReadnPixelsARB(x, y, width, height, format, type, bufSize, data);
+		break;
+	}
+	case 476: {
+		glReleaseShaderCompiler();
+		break;
+	}
+	case 477: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+
+		glRenderbufferStorage(target, internalformat, width, height);
+		break;
+	}
+	case 478: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLsizei samples = (GLsizei) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+
+		glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+		break;
+	}
+	case 479: {
+		glResumeTransformFeedback();
+		break;
+	}
+	case 480: {
+		GLfloat value = rd_f32(rx);
+		GLboolean invert = (GLboolean) rd_u32(rx);
+
+		glSampleCoverage(value, invert);
+		break;
+	}
+	case 481: {
+		GLuint maskNumber = (GLuint) rd_u32(rx);
+		GLbitfield mask = (GLbitfield) rd_u32(rx);
+
+		glSampleMaski(maskNumber, mask);
+		break;
+	}
+	case 482: {
+		GLuint sampler = remap(rs, NS_SAMPLER, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		const GLint *param = rd_data(rx);
+
+		glSamplerParameterIiv(sampler, pname, param);
+		break;
+	}
+	case 483: {
+		GLuint sampler = remap(rs, NS_SAMPLER, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		const GLuint *param = rd_data(rx);
+
+		glSamplerParameterIuiv(sampler, pname, param);
+		break;
+	}
+	case 484: {
+		GLuint sampler = remap(rs, NS_SAMPLER, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLfloat param = rd_f32(rx);
+
+		glSamplerParameterf(sampler, pname, param);
+		break;
+	}
+	case 485: {
+		GLuint sampler = remap(rs, NS_SAMPLER, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		const GLfloat *param = rd_data(rx);
+
+		glSamplerParameterfv(sampler, pname, param);
+		break;
+	}
+	case 486: {
+		GLuint sampler = remap(rs, NS_SAMPLER, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint param = (GLint) rd_u32(rx);
+
+		glSamplerParameteri(sampler, pname, param);
+		break;
+	}
+	case 487: {
+		GLuint sampler = remap(rs, NS_SAMPLER, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		const GLint *param = rd_data(rx);
+
+		glSamplerParameteriv(sampler, pname, param);
+		break;
+	}
+	case 488: {
+		GLint x = (GLint) rd_u32(rx);
+		GLint y = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+
+		glScissor(x, y, width, height);
+		break;
+	}
+	case 489: {
+		GLuint first = (GLuint) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLint *v = rd_data(rx);
+
+		glScissorArrayv(first, count, v);
+		break;
+	}
+	case 490: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLint left = (GLint) rd_u32(rx);
+		GLint bottom = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+
+		glScissorIndexed(index, left, bottom, width, height);
+		break;
+	}
+	case 491: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLint *v = rd_data(rx);
+
+		glScissorIndexedv(index, v);
+		break;
+	}
+	case 492: {
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLuint *shaders = rd_names(rs, rx, NS_PROGRAM);
+		GLenum binaryformat = (GLenum) rd_u32(rx);
+		const void *binary = rd_data(rx);
+		GLsizei length = (GLsizei) rd_u32(rx);
+
+		glShaderBinary(count, shaders, binaryformat, binary, length);
+		break;
+	}
+	case 493: {
+		GLuint shader = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLchar *const*string = rd_strings(rs, rx);
+		const GLint *length = NULL;
+
+		glShaderSource(shader, count, string, length);
+		break;
+	}
+	case 494: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLuint storageBlockIndex = (GLuint) rd_u32(rx);
+		GLuint storageBlockBinding = (GLuint) rd_u32(rx);
+
+		glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+		break;
+	}
+	case 495: {
+		GLenum func = (GLenum) rd_u32(rx);
+		GLint ref = (GLint) rd_u32(rx);
+		GLuint mask = (GLuint) rd_u32(rx);
+
+		glStencilFunc(func, ref, mask);
+		break;
+	}
+	case 496: {
+		GLenum face = (GLenum) rd_u32(rx);
+		GLenum func = (GLenum) rd_u32(rx);
+		GLint ref = (GLint) rd_u32(rx);
+		GLuint mask = (GLuint) rd_u32(rx);
+
+		glStencilFuncSeparate(face, func, ref, mask);
+		break;
+	}
+	case 497: {
+		GLuint mask = (GLuint) rd_u32(rx);
+
+		glStencilMask(mask);
+		break;
+	}
+	case 498: {
+		GLenum face = (GLenum) rd_u32(rx);
+		GLuint mask = (GLuint) rd_u32(rx);
+
+		glStencilMaskSeparate(face, mask);
+		break;
+	}
+	case 499: {
+		GLenum fail = (GLenum) rd_u32(rx);
+		GLenum zfail = (GLenum) rd_u32(rx);
+		GLenum zpass = (GLenum) rd_u32(rx);
+
+		glStencilOp(fail, zfail, zpass);
+		break;
+	}
+	case 500: {
+		GLenum face = (GLenum) rd_u32(rx);
+		GLenum sfail = (GLenum) rd_u32(rx);
+		GLenum dpfail = (GLenum) rd_u32(rx);
+		GLenum dppass = (GLenum) rd_u32(rx);
+
+		glStencilOpSeparate(face, sfail, dpfail, dppass);
+		break;
+	}
+	case 501: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+
+		glTexBuffer(target, internalformat, buffer);
+		break;
+	}
+	case 502: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLintptr offset = (GLintptr) rd_u64(rx);
+		GLsizeiptr size = (GLsizeiptr) rd_u64(rx);
+
+		glTexBufferRange(target, internalformat, buffer, offset, size);
+		break;
+	}
+	case 503: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint level = (GLint) rd_u32(rx);
+		GLint internalformat = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLint border = (GLint) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *pixels = rd_pixels(rx);
+
+		glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+		break;
+	}
+	case 504: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint level = (GLint) rd_u32(rx);
+		GLint internalformat = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLint border = (GLint) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *pixels = rd_pixels(rx);
+
+		glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+		break;
+	}
+	case 505: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLsizei samples = (GLsizei) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLboolean fixedsamplelocations = (GLboolean) rd_u32(rx);
+
+		glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+		break;
+	}
+	case 506: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint level = (GLint) rd_u32(rx);
+		GLint internalformat = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLsizei depth = (GLsizei) rd_u32(rx);
+		GLint border = (GLint) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *pixels = rd_pixels(rx);
+
+		glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+		break;
+	}
+	case 507: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLsizei samples = (GLsizei) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLsizei depth = (GLsizei) rd_u32(rx);
+		GLboolean fixedsamplelocations = (GLboolean) rd_u32(rx);
+
+		glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+		break;
+	}
+	case 508: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint level = (GLint) rd_u32(rx);
+		GLint xoffset = (GLint) rd_u32(rx);
+		GLint yoffset = (GLint) rd_u32(rx);
+		GLint zoffset = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLsizei depth = (GLsizei) rd_u32(rx);
+		GLboolean resident = (GLboolean) rd_u32(rx);
+
+		glTexPageCommitmentARB(target, level, xoffset, yoffset, zoffset, width, height, depth, resident);
+		break;
+	}
+	case 509: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		const GLint *params = rd_data(rx);
+
+		glTexParameterIiv(target, pname, params);
+		break;
+	}
+	case 510: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		const GLuint *params = rd_data(rx);
+
+		glTexParameterIuiv(target, pname, params);
+		break;
+	}
+	case 511: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLfloat param = rd_f32(rx);
+
+		glTexParameterf(target, pname, param);
+		break;
+	}
+	case 512: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		const GLfloat *params = rd_data(rx);
+
+		glTexParameterfv(target, pname, params);
+		break;
+	}
+	case 513: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint param = (GLint) rd_u32(rx);
+
+		glTexParameteri(target, pname, param);
+		break;
+	}
+	case 514: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLenum pname = (GLenum) rd_u32(rx);
+		const GLint *params = rd_data(rx);
+
+		glTexParameteriv(target, pname, params);
+		break;
+	}
+	case 515: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLsizei levels = (GLsizei) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+
+		glTexStorage1D(target, levels, internalformat, width);
+		break;
+	}
+	case 516: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLsizei levels = (GLsizei) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+
+		glTexStorage2D(target, levels, internalformat, width, height);
+		break;
+	}
+	case 517: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLsizei samples = (GLsizei) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLboolean fixedsamplelocations = (GLboolean) rd_u32(rx);
+
+		glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+		break;
+	}
+	case 518: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLsizei levels = (GLsizei) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLsizei depth = (GLsizei) rd_u32(rx);
+
+		glTexStorage3D(target, levels, internalformat, width, height, depth);
+		break;
+	}
+	case 519: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLsizei samples = (GLsizei) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLsizei depth = (GLsizei) rd_u32(rx);
+		GLboolean fixedsamplelocations = (GLboolean) rd_u32(rx);
+
+		glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+		break;
+	}
+	case 520: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint level = (GLint) rd_u32(rx);
+		GLint xoffset = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *pixels = rd_pixels(rx);
+
+		glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+		break;
+	}
+	case 521: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint level = (GLint) rd_u32(rx);
+		GLint xoffset = (GLint) rd_u32(rx);
+		GLint yoffset = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *pixels = rd_pixels(rx);
+
+		glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+		break;
+	}
+	case 522: {
+		GLenum target = (GLenum) rd_u32(rx);
+		GLint level = (GLint) rd_u32(rx);
+		GLint xoffset = (GLint) rd_u32(rx);
+		GLint yoffset = (GLint) rd_u32(rx);
+		GLint zoffset = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLsizei depth = (GLsizei) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *pixels = rd_pixels(rx);
+
+		glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+		break;
+	}
+	case 523: {
+		glTextureBarrier();
+		break;
+	}
+	case 524: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+
+		glTextureBuffer(texture, internalformat, buffer);
+		break;
+	}
+	case 525: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLintptr offset = (GLintptr) rd_u64(rx);
+		GLsizeiptr size = (GLsizeiptr) rd_u64(rx);
+
+		glTextureBufferRange(texture, internalformat, buffer, offset, size);
+		break;
+	}
+	case 526: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		const GLint *params = rd_data(rx);
+
+		glTextureParameterIiv(texture, pname, params);
+		break;
+	}
+	case 527: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		const GLuint *params = rd_data(rx);
+
+		glTextureParameterIuiv(texture, pname, params);
+		break;
+	}
+	case 528: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLfloat param = rd_f32(rx);
+
+		glTextureParameterf(texture, pname, param);
+		break;
+	}
+	case 529: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		const GLfloat *param = rd_data(rx);
+
+		glTextureParameterfv(texture, pname, param);
+		break;
+	}
+	case 530: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		GLint param = (GLint) rd_u32(rx);
+
+		glTextureParameteri(texture, pname, param);
+		break;
+	}
+	case 531: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLenum pname = (GLenum) rd_u32(rx);
+		const GLint *param = rd_data(rx);
+
+		glTextureParameteriv(texture, pname, param);
+		break;
+	}
+	case 532: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLsizei levels = (GLsizei) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+
+		glTextureStorage1D(texture, levels, internalformat, width);
+		break;
+	}
+	case 533: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLsizei levels = (GLsizei) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+
+		glTextureStorage2D(texture, levels, internalformat, width, height);
+		break;
+	}
+	case 534: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLsizei samples = (GLsizei) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLboolean fixedsamplelocations = (GLboolean) rd_u32(rx);
+
+		glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+		break;
+	}
+	case 535: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLsizei levels = (GLsizei) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLsizei depth = (GLsizei) rd_u32(rx);
+
+		glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+		break;
+	}
+	case 536: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLsizei samples = (GLsizei) rd_u32(rx);
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLsizei depth = (GLsizei) rd_u32(rx);
+		GLboolean fixedsamplelocations = (GLboolean) rd_u32(rx);
+
+		glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+		break;
+	}
+	case 537: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+		GLint xoffset = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *pixels = rd_pixels(rx);
+
+		glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+		break;
+	}
+	case 538: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+		GLint xoffset = (GLint) rd_u32(rx);
+		GLint yoffset = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *pixels = rd_pixels(rx);
+
+		glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+		break;
+	}
+	case 539: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLint level = (GLint) rd_u32(rx);
+		GLint xoffset = (GLint) rd_u32(rx);
+		GLint yoffset = (GLint) rd_u32(rx);
+		GLint zoffset = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+		GLsizei depth = (GLsizei) rd_u32(rx);
+		GLenum format = (GLenum) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		const void *pixels = rd_pixels(rx);
+
+		glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+		break;
+	}
+	case 540: {
+		GLuint texture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLenum target = (GLenum) rd_u32(rx);
+		GLuint origtexture = remap(rs, NS_TEXTURE, rd_u32(rx));
+		GLenum internalformat = (GLenum) rd_u32(rx);
+		GLuint minlevel = (GLuint) rd_u32(rx);
+		GLuint numlevels = (GLuint) rd_u32(rx);
+		GLuint minlayer = (GLuint) rd_u32(rx);
+		GLuint numlayers = (GLuint) rd_u32(rx);
+
+		glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+		break;
+	}
+	case 541: {
+		GLuint xfb = remap(rs, NS_TRANSFORM_FEEDBACK, rd_u32(rx));
+		GLuint index = (GLuint) rd_u32(rx);
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+
+		glTransformFeedbackBufferBase(xfb, index, buffer);
+		break;
+	}
+	case 542: {
+		GLuint xfb = remap(rs, NS_TRANSFORM_FEEDBACK, rd_u32(rx));
+		GLuint index = (GLuint) rd_u32(rx);
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLintptr offset = (GLintptr) rd_u64(rx);
+		GLsizeiptr size = (GLsizeiptr) rd_u64(rx);
+
+		glTransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+		break;
+	}
+	case 543: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLchar *const*varyings = rd_strings(rs, rx);
+		GLenum bufferMode = (GLenum) rd_u32(rx);
+
+		glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+		break;
+	}
+	case 544: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLdouble x = rd_f64(rx);
+
+		glUniform1d(location, x);
+		break;
+	}
+	case 545: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glUniform1dv(location, count, value);
+		break;
+	}
+	case 546: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLfloat v0 = rd_f32(rx);
+
+		glUniform1f(location, v0);
+		break;
+	}
+	case 547: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glUniform1fv(location, count, value);
+		break;
+	}
+	case 548: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLint v0 = (GLint) rd_u32(rx);
+
+		glUniform1i(location, v0);
+		break;
+	}
+	case 549: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLint *value = rd_data(rx);
+
+		glUniform1iv(location, count, value);
+		break;
+	}
+	case 550: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLuint v0 = (GLuint) rd_u32(rx);
+
+		glUniform1ui(location, v0);
+		break;
+	}
+	case 551: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLuint *value = rd_data(rx);
+
+		glUniform1uiv(location, count, value);
+		break;
+	}
+	case 552: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLdouble x = rd_f64(rx);
+		GLdouble y = rd_f64(rx);
+
+		glUniform2d(location, x, y);
+		break;
+	}
+	case 553: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glUniform2dv(location, count, value);
+		break;
+	}
+	case 554: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLfloat v0 = rd_f32(rx);
+		GLfloat v1 = rd_f32(rx);
+
+		glUniform2f(location, v0, v1);
+		break;
+	}
+	case 555: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glUniform2fv(location, count, value);
+		break;
+	}
+	case 556: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLint v0 = (GLint) rd_u32(rx);
+		GLint v1 = (GLint) rd_u32(rx);
+
+		glUniform2i(location, v0, v1);
+		break;
+	}
+	case 557: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLint *value = rd_data(rx);
+
+		glUniform2iv(location, count, value);
+		break;
+	}
+	case 558: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLuint v0 = (GLuint) rd_u32(rx);
+		GLuint v1 = (GLuint) rd_u32(rx);
+
+		glUniform2ui(location, v0, v1);
+		break;
+	}
+	case 559: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLuint *value = rd_data(rx);
+
+		glUniform2uiv(location, count, value);
+		break;
+	}
+	case 560: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLdouble x = rd_f64(rx);
+		GLdouble y = rd_f64(rx);
+		GLdouble z = rd_f64(rx);
+
+		glUniform3d(location, x, y, z);
+		break;
+	}
+	case 561: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glUniform3dv(location, count, value);
+		break;
+	}
+	case 562: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLfloat v0 = rd_f32(rx);
+		GLfloat v1 = rd_f32(rx);
+		GLfloat v2 = rd_f32(rx);
+
+		glUniform3f(location, v0, v1, v2);
+		break;
+	}
+	case 563: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glUniform3fv(location, count, value);
+		break;
+	}
+	case 564: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLint v0 = (GLint) rd_u32(rx);
+		GLint v1 = (GLint) rd_u32(rx);
+		GLint v2 = (GLint) rd_u32(rx);
+
+		glUniform3i(location, v0, v1, v2);
+		break;
+	}
+	case 565: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLint *value = rd_data(rx);
+
+		glUniform3iv(location, count, value);
+		break;
+	}
+	case 566: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLuint v0 = (GLuint) rd_u32(rx);
+		GLuint v1 = (GLuint) rd_u32(rx);
+		GLuint v2 = (GLuint) rd_u32(rx);
+
+		glUniform3ui(location, v0, v1, v2);
+		break;
+	}
+	case 567: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLuint *value = rd_data(rx);
+
+		glUniform3uiv(location, count, value);
+		break;
+	}
+	case 568: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLdouble x = rd_f64(rx);
+		GLdouble y = rd_f64(rx);
+		GLdouble z = rd_f64(rx);
+		GLdouble w = rd_f64(rx);
+
+		glUniform4d(location, x, y, z, w);
+		break;
+	}
+	case 569: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glUniform4dv(location, count, value);
+		break;
+	}
+	case 570: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLfloat v0 = rd_f32(rx);
+		GLfloat v1 = rd_f32(rx);
+		GLfloat v2 = rd_f32(rx);
+		GLfloat v3 = rd_f32(rx);
+
+		glUniform4f(location, v0, v1, v2, v3);
+		break;
+	}
+	case 571: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glUniform4fv(location, count, value);
+		break;
+	}
+	case 572: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLint v0 = (GLint) rd_u32(rx);
+		GLint v1 = (GLint) rd_u32(rx);
+		GLint v2 = (GLint) rd_u32(rx);
+		GLint v3 = (GLint) rd_u32(rx);
+
+		glUniform4i(location, v0, v1, v2, v3);
+		break;
+	}
+	case 573: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLint *value = rd_data(rx);
+
+		glUniform4iv(location, count, value);
+		break;
+	}
+	case 574: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLuint v0 = (GLuint) rd_u32(rx);
+		GLuint v1 = (GLuint) rd_u32(rx);
+		GLuint v2 = (GLuint) rd_u32(rx);
+		GLuint v3 = (GLuint) rd_u32(rx);
+
+		glUniform4ui(location, v0, v1, v2, v3);
+		break;
+	}
+	case 575: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLuint *value = rd_data(rx);
+
+		glUniform4uiv(location, count, value);
+		break;
+	}
+	case 576: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+		GLuint uniformBlockIndex = (GLuint) rd_u32(rx);
+		GLuint uniformBlockBinding = (GLuint) rd_u32(rx);
+
+		glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+		break;
+	}
+	case 577: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLuint64 value = (GLuint64) rd_u64(rx);
+
+		glUniformHandleui64ARB(location, value);
+		break;
+	}
+	case 578: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLuint64 *value = rd_data(rx);
+
+		glUniformHandleui64vARB(location, count, value);
+		break;
+	}
+	case 579: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glUniformMatrix2dv(location, count, transpose, value);
+		break;
+	}
+	case 580: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glUniformMatrix2fv(location, count, transpose, value);
+		break;
+	}
+	case 581: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glUniformMatrix2x3dv(location, count, transpose, value);
+		break;
+	}
+	case 582: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glUniformMatrix2x3fv(location, count, transpose, value);
+		break;
+	}
+	case 583: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glUniformMatrix2x4dv(location, count, transpose, value);
+		break;
+	}
+	case 584: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glUniformMatrix2x4fv(location, count, transpose, value);
+		break;
+	}
+	case 585: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glUniformMatrix3dv(location, count, transpose, value);
+		break;
+	}
+	case 586: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glUniformMatrix3fv(location, count, transpose, value);
+		break;
+	}
+	case 587: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glUniformMatrix3x2dv(location, count, transpose, value);
+		break;
+	}
+	case 588: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glUniformMatrix3x2fv(location, count, transpose, value);
+		break;
+	}
+	case 589: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glUniformMatrix3x4dv(location, count, transpose, value);
+		break;
+	}
+	case 590: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glUniformMatrix3x4fv(location, count, transpose, value);
+		break;
+	}
+	case 591: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glUniformMatrix4dv(location, count, transpose, value);
+		break;
+	}
+	case 592: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glUniformMatrix4fv(location, count, transpose, value);
+		break;
+	}
+	case 593: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glUniformMatrix4x2dv(location, count, transpose, value);
+		break;
+	}
+	case 594: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glUniformMatrix4x2fv(location, count, transpose, value);
+		break;
+	}
+	case 595: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLdouble *value = rd_data(rx);
+
+		glUniformMatrix4x3dv(location, count, transpose, value);
+		break;
+	}
+	case 596: {
+		GLint location = remap_location(rs, rs->program, (GLint) rd_u32(rx));
+		GLsizei count = (GLsizei) rd_u32(rx);
+		GLboolean transpose = (GLboolean) rd_u32(rx);
+		const GLfloat *value = rd_data(rx);
+
+		glUniformMatrix4x3fv(location, count, transpose, value);
+		break;
+	}
+	case 597: {
+		GLenum shadertype = (GLenum) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLuint *indices = rd_data(rx);
+
+		glUniformSubroutinesuiv(shadertype, count, indices);
+		break;
+	}
+	case 598: {
+		GLenum target = (GLenum) rd_u32(rx);
+
+		glUnmapBuffer(target);
+		set_map(rs, 0, target, NULL, 0);
+		break;
+	}
+	case 599: {
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+
+		glUnmapNamedBuffer(buffer);
+		set_map(rs, 1, buffer, NULL, 0);
+		break;
+	}
+	case 600: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+
+		glUseProgram(program);
+		rs->program = program;
+		break;
+	}
+	case 601: {
+		GLuint pipeline = remap(rs, NS_PIPELINE, rd_u32(rx));
+		GLbitfield stages = (GLbitfield) rd_u32(rx);
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+
+		glUseProgramStages(pipeline, stages, program);
+		break;
+	}
+	case 602: {
+		GLuint program = remap(rs, NS_PROGRAM, rd_u32(rx));
+
+		glValidateProgram(program);
+		break;
+	}
+	case 603: {
+		GLuint pipeline = remap(rs, NS_PIPELINE, rd_u32(rx));
+
+		glValidateProgramPipeline(pipeline);
+		break;
+	}
+	case 604: {
+		GLuint vaobj = remap(rs, NS_VERTEX_ARRAY, rd_u32(rx));
+		GLuint attribindex = (GLuint) rd_u32(rx);
+		GLuint bindingindex = (GLuint) rd_u32(rx);
+
+		glVertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+		break;
+	}
+	case 605: {
+		GLuint vaobj = remap(rs, NS_VERTEX_ARRAY, rd_u32(rx));
+		GLuint attribindex = (GLuint) rd_u32(rx);
+		GLint size = (GLint) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLboolean normalized = (GLboolean) rd_u32(rx);
+		GLuint relativeoffset = (GLuint) rd_u32(rx);
+
+		glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+		break;
+	}
+	case 606: {
+		GLuint vaobj = remap(rs, NS_VERTEX_ARRAY, rd_u32(rx));
+		GLuint attribindex = (GLuint) rd_u32(rx);
+		GLint size = (GLint) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLuint relativeoffset = (GLuint) rd_u32(rx);
+
+		glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+		break;
+	}
+	case 607: {
+		GLuint vaobj = remap(rs, NS_VERTEX_ARRAY, rd_u32(rx));
+		GLuint attribindex = (GLuint) rd_u32(rx);
+		GLint size = (GLint) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLuint relativeoffset = (GLuint) rd_u32(rx);
+
+		glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+		break;
+	}
+	case 608: {
+		GLuint vaobj = remap(rs, NS_VERTEX_ARRAY, rd_u32(rx));
+		GLuint bindingindex = (GLuint) rd_u32(rx);
+		GLuint divisor = (GLuint) rd_u32(rx);
+
+		glVertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+		break;
+	}
+	case 609: {
+		GLuint vaobj = remap(rs, NS_VERTEX_ARRAY, rd_u32(rx));
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+
+		glVertexArrayElementBuffer(vaobj, buffer);
+		break;
+	}
+	case 610: {
+		GLuint vaobj = remap(rs, NS_VERTEX_ARRAY, rd_u32(rx));
+		GLuint bindingindex = (GLuint) rd_u32(rx);
+		GLuint buffer = remap(rs, NS_BUFFER, rd_u32(rx));
+		GLintptr offset = (GLintptr) rd_u64(rx);
+		GLsizei stride = (GLsizei) rd_u32(rx);
+
+		glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+		break;
+	}
+	case 611: {
+		GLuint vaobj = remap(rs, NS_VERTEX_ARRAY, rd_u32(rx));
+		GLuint first = (GLuint) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLuint *buffers = rd_names(rs, rx, NS_BUFFER);
+		const GLintptr *offsets = rd_data(rx);
+		const GLsizei *strides = rd_data(rx);
+
+		glVertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+		break;
+	}
+	case 612: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLdouble x = rd_f64(rx);
+
+		glVertexAttrib1d(index, x);
+		break;
+	}
+	case 613: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLdouble *v = rd_data(rx);
+
+		glVertexAttrib1dv(index, v);
+		break;
+	}
+	case 614: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLfloat x = rd_f32(rx);
+
+		glVertexAttrib1f(index, x);
+		break;
+	}
+	case 615: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLfloat *v = rd_data(rx);
+
+		glVertexAttrib1fv(index, v);
+		break;
+	}
+	case 616: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLshort x = (GLshort) rd_u32(rx);
+
+		glVertexAttrib1s(index, x);
+		break;
+	}
+	case 617: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLshort *v = rd_data(rx);
+
+		glVertexAttrib1sv(index, v);
+		break;
+	}
+	case 618: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLdouble x = rd_f64(rx);
+		GLdouble y = rd_f64(rx);
+
+		glVertexAttrib2d(index, x, y);
+		break;
+	}
+	case 619: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLdouble *v = rd_data(rx);
+
+		glVertexAttrib2dv(index, v);
+		break;
+	}
+	case 620: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLfloat x = rd_f32(rx);
+		GLfloat y = rd_f32(rx);
+
+		glVertexAttrib2f(index, x, y);
+		break;
+	}
+	case 621: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLfloat *v = rd_data(rx);
+
+		glVertexAttrib2fv(index, v);
+		break;
+	}
+	case 622: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLshort x = (GLshort) rd_u32(rx);
+		GLshort y = (GLshort) rd_u32(rx);
+
+		glVertexAttrib2s(index, x, y);
+		break;
+	}
+	case 623: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLshort *v = rd_data(rx);
+
+		glVertexAttrib2sv(index, v);
+		break;
+	}
+	case 624: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLdouble x = rd_f64(rx);
+		GLdouble y = rd_f64(rx);
+		GLdouble z = rd_f64(rx);
+
+		glVertexAttrib3d(index, x, y, z);
+		break;
+	}
+	case 625: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLdouble *v = rd_data(rx);
+
+		glVertexAttrib3dv(index, v);
+		break;
+	}
+	case 626: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLfloat x = rd_f32(rx);
+		GLfloat y = rd_f32(rx);
+		GLfloat z = rd_f32(rx);
+
+		glVertexAttrib3f(index, x, y, z);
+		break;
+	}
+	case 627: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLfloat *v = rd_data(rx);
+
+		glVertexAttrib3fv(index, v);
+		break;
+	}
+	case 628: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLshort x = (GLshort) rd_u32(rx);
+		GLshort y = (GLshort) rd_u32(rx);
+		GLshort z = (GLshort) rd_u32(rx);
+
+		glVertexAttrib3s(index, x, y, z);
+		break;
+	}
+	case 629: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLshort *v = rd_data(rx);
+
+		glVertexAttrib3sv(index, v);
+		break;
+	}
+	case 630: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLbyte *v = rd_data(rx);
+
+		glVertexAttrib4Nbv(index, v);
+		break;
+	}
+	case 631: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLint *v = rd_data(rx);
+
+		glVertexAttrib4Niv(index, v);
+		break;
+	}
+	case 632: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLshort *v = rd_data(rx);
+
+		glVertexAttrib4Nsv(index, v);
+		break;
+	}
+	case 633: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLubyte x = (GLubyte) rd_u32(rx);
+		GLubyte y = (GLubyte) rd_u32(rx);
+		GLubyte z = (GLubyte) rd_u32(rx);
+		GLubyte w = (GLubyte) rd_u32(rx);
+
+		glVertexAttrib4Nub(index, x, y, z, w);
+		break;
+	}
+	case 634: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLubyte *v = rd_data(rx);
+
+		glVertexAttrib4Nubv(index, v);
+		break;
+	}
+	case 635: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLuint *v = rd_data(rx);
+
+		glVertexAttrib4Nuiv(index, v);
+		break;
+	}
+	case 636: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLushort *v = rd_data(rx);
+
+		glVertexAttrib4Nusv(index, v);
+		break;
+	}
+	case 637: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLbyte *v = rd_data(rx);
+
+		glVertexAttrib4bv(index, v);
+		break;
+	}
+	case 638: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLdouble x = rd_f64(rx);
+		GLdouble y = rd_f64(rx);
+		GLdouble z = rd_f64(rx);
+		GLdouble w = rd_f64(rx);
+
+		glVertexAttrib4d(index, x, y, z, w);
+		break;
+	}
+	case 639: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLdouble *v = rd_data(rx);
+
+		glVertexAttrib4dv(index, v);
+		break;
+	}
+	case 640: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLfloat x = rd_f32(rx);
+		GLfloat y = rd_f32(rx);
+		GLfloat z = rd_f32(rx);
+		GLfloat w = rd_f32(rx);
+
+		glVertexAttrib4f(index, x, y, z, w);
+		break;
+	}
+	case 641: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLfloat *v = rd_data(rx);
+
+		glVertexAttrib4fv(index, v);
+		break;
+	}
+	case 642: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLint *v = rd_data(rx);
+
+		glVertexAttrib4iv(index, v);
+		break;
+	}
+	case 643: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLshort x = (GLshort) rd_u32(rx);
+		GLshort y = (GLshort) rd_u32(rx);
+		GLshort z = (GLshort) rd_u32(rx);
+		GLshort w = (GLshort) rd_u32(rx);
+
+		glVertexAttrib4s(index, x, y, z, w);
+		break;
+	}
+	case 644: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLshort *v = rd_data(rx);
+
+		glVertexAttrib4sv(index, v);
+		break;
+	}
+	case 645: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLubyte *v = rd_data(rx);
+
+		glVertexAttrib4ubv(index, v);
+		break;
+	}
+	case 646: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLuint *v = rd_data(rx);
+
+		glVertexAttrib4uiv(index, v);
+		break;
+	}
+	case 647: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLushort *v = rd_data(rx);
+
+		glVertexAttrib4usv(index, v);
+		break;
+	}
+	case 648: {
+		GLuint attribindex = (GLuint) rd_u32(rx);
+		GLuint bindingindex = (GLuint) rd_u32(rx);
+
+		glVertexAttribBinding(attribindex, bindingindex);
+		break;
+	}
+	case 649: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLuint divisor = (GLuint) rd_u32(rx);
+
+		glVertexAttribDivisor(index, divisor);
+		break;
+	}
+	case 650: {
+		GLuint attribindex = (GLuint) rd_u32(rx);
+		GLint size = (GLint) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLboolean normalized = (GLboolean) rd_u32(rx);
+		GLuint relativeoffset = (GLuint) rd_u32(rx);
+
+		glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+		break;
+	}
+	case 651: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLint x = (GLint) rd_u32(rx);
+
+		glVertexAttribI1i(index, x);
+		break;
+	}
+	case 652: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLint *v = rd_data(rx);
+
+		glVertexAttribI1iv(index, v);
+		break;
+	}
+	case 653: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLuint x = (GLuint) rd_u32(rx);
+
+		glVertexAttribI1ui(index, x);
+		break;
+	}
+	case 654: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLuint *v = rd_data(rx);
+
+		glVertexAttribI1uiv(index, v);
+		break;
+	}
+	case 655: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLint x = (GLint) rd_u32(rx);
+		GLint y = (GLint) rd_u32(rx);
+
+		glVertexAttribI2i(index, x, y);
+		break;
+	}
+	case 656: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLint *v = rd_data(rx);
+
+		glVertexAttribI2iv(index, v);
+		break;
+	}
+	case 657: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLuint x = (GLuint) rd_u32(rx);
+		GLuint y = (GLuint) rd_u32(rx);
+
+		glVertexAttribI2ui(index, x, y);
+		break;
+	}
+	case 658: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLuint *v = rd_data(rx);
+
+		glVertexAttribI2uiv(index, v);
+		break;
+	}
+	case 659: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLint x = (GLint) rd_u32(rx);
+		GLint y = (GLint) rd_u32(rx);
+		GLint z = (GLint) rd_u32(rx);
+
+		glVertexAttribI3i(index, x, y, z);
+		break;
+	}
+	case 660: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLint *v = rd_data(rx);
+
+		glVertexAttribI3iv(index, v);
+		break;
+	}
+	case 661: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLuint x = (GLuint) rd_u32(rx);
+		GLuint y = (GLuint) rd_u32(rx);
+		GLuint z = (GLuint) rd_u32(rx);
+
+		glVertexAttribI3ui(index, x, y, z);
+		break;
+	}
+	case 662: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLuint *v = rd_data(rx);
+
+		glVertexAttribI3uiv(index, v);
+		break;
+	}
+	case 663: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLbyte *v = rd_data(rx);
+
+		glVertexAttribI4bv(index, v);
+		break;
+	}
+	case 664: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLint x = (GLint) rd_u32(rx);
+		GLint y = (GLint) rd_u32(rx);
+		GLint z = (GLint) rd_u32(rx);
+		GLint w = (GLint) rd_u32(rx);
+
+		glVertexAttribI4i(index, x, y, z, w);
+		break;
+	}
+	case 665: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLint *v = rd_data(rx);
+
+		glVertexAttribI4iv(index, v);
+		break;
+	}
+	case 666: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLshort *v = rd_data(rx);
+
+		glVertexAttribI4sv(index, v);
+		break;
+	}
+	case 667: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLubyte *v = rd_data(rx);
+
+		glVertexAttribI4ubv(index, v);
+		break;
+	}
+	case 668: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLuint x = (GLuint) rd_u32(rx);
+		GLuint y = (GLuint) rd_u32(rx);
+		GLuint z = (GLuint) rd_u32(rx);
+		GLuint w = (GLuint) rd_u32(rx);
+
+		glVertexAttribI4ui(index, x, y, z, w);
+		break;
+	}
+	case 669: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLuint *v = rd_data(rx);
+
+		glVertexAttribI4uiv(index, v);
+		break;
+	}
+	case 670: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLushort *v = rd_data(rx);
+
+		glVertexAttribI4usv(index, v);
+		break;
+	}
+	case 671: {
+		GLuint attribindex = (GLuint) rd_u32(rx);
+		GLint size = (GLint) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLuint relativeoffset = (GLuint) rd_u32(rx);
+
+		glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+		break;
+	}
+	case 672: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLint size = (GLint) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLsizei stride = (GLsizei) rd_u32(rx);
+		const void *pointer = (const void *) (size_t) rd_u64(rx);
+
+		glVertexAttribIPointer(index, size, type, stride, pointer);
+		break;
+	}
+	case 673: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLdouble x = rd_f64(rx);
+
+		glVertexAttribL1d(index, x);
+		break;
+	}
+	case 674: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLdouble *v = rd_data(rx);
+
+		glVertexAttribL1dv(index, v);
+		break;
+	}
+	case 675: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLuint64EXT x = (GLuint64EXT) rd_u64(rx);
+
+		glVertexAttribL1ui64ARB(index, x);
+		break;
+	}
+	case 676: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLuint64EXT *v = rd_data(rx);
+
+		glVertexAttribL1ui64vARB(index, v);
+		break;
+	}
+	case 677: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLdouble x = rd_f64(rx);
+		GLdouble y = rd_f64(rx);
+
+		glVertexAttribL2d(index, x, y);
+		break;
+	}
+	case 678: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLdouble *v = rd_data(rx);
+
+		glVertexAttribL2dv(index, v);
+		break;
+	}
+	case 679: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLdouble x = rd_f64(rx);
+		GLdouble y = rd_f64(rx);
+		GLdouble z = rd_f64(rx);
+
+		glVertexAttribL3d(index, x, y, z);
+		break;
+	}
+	case 680: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLdouble *v = rd_data(rx);
+
+		glVertexAttribL3dv(index, v);
+		break;
+	}
+	case 681: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLdouble x = rd_f64(rx);
+		GLdouble y = rd_f64(rx);
+		GLdouble z = rd_f64(rx);
+		GLdouble w = rd_f64(rx);
+
+		glVertexAttribL4d(index, x, y, z, w);
+		break;
+	}
+	case 682: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLdouble *v = rd_data(rx);
+
+		glVertexAttribL4dv(index, v);
+		break;
+	}
+	case 683: {
+		GLuint attribindex = (GLuint) rd_u32(rx);
+		GLint size = (GLint) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLuint relativeoffset = (GLuint) rd_u32(rx);
+
+		glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+		break;
+	}
+	case 684: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLint size = (GLint) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLsizei stride = (GLsizei) rd_u32(rx);
+		const void *pointer = (const void *) (size_t) rd_u64(rx);
+
+		glVertexAttribLPointer(index, size, type, stride, pointer);
+		break;
+	}
+	case 685: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLboolean normalized = (GLboolean) rd_u32(rx);
+		GLuint value = (GLuint) rd_u32(rx);
+
+		glVertexAttribP1ui(index, type, normalized, value);
+		break;
+	}
+	case 686: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLboolean normalized = (GLboolean) rd_u32(rx);
+		const GLuint *value = rd_data(rx);
+
+		glVertexAttribP1uiv(index, type, normalized, value);
+		break;
+	}
+	case 687: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLboolean normalized = (GLboolean) rd_u32(rx);
+		GLuint value = (GLuint) rd_u32(rx);
+
+		glVertexAttribP2ui(index, type, normalized, value);
+		break;
+	}
+	case 688: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLboolean normalized = (GLboolean) rd_u32(rx);
+		const GLuint *value = rd_data(rx);
+
+		glVertexAttribP2uiv(index, type, normalized, value);
+		break;
+	}
+	case 689: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLboolean normalized = (GLboolean) rd_u32(rx);
+		GLuint value = (GLuint) rd_u32(rx);
+
+		glVertexAttribP3ui(index, type, normalized, value);
+		break;
+	}
+	case 690: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLboolean normalized = (GLboolean) rd_u32(rx);
+		const GLuint *value = rd_data(rx);
+
+		glVertexAttribP3uiv(index, type, normalized, value);
+		break;
+	}
+	case 691: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLboolean normalized = (GLboolean) rd_u32(rx);
+		GLuint value = (GLuint) rd_u32(rx);
+
+		glVertexAttribP4ui(index, type, normalized, value);
+		break;
+	}
+	case 692: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLboolean normalized = (GLboolean) rd_u32(rx);
+		const GLuint *value = rd_data(rx);
+
+		glVertexAttribP4uiv(index, type, normalized, value);
+		break;
+	}
+	case 693: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLint size = (GLint) rd_u32(rx);
+		GLenum type = (GLenum) rd_u32(rx);
+		GLboolean normalized = (GLboolean) rd_u32(rx);
+		GLsizei stride = (GLsizei) rd_u32(rx);
+		const void *pointer = (const void *) (size_t) rd_u64(rx);
+
+		glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+		break;
+	}
+	case 694: {
+		GLuint bindingindex = (GLuint) rd_u32(rx);
+		GLuint divisor = (GLuint) rd_u32(rx);
+
+		glVertexBindingDivisor(bindingindex, divisor);
+		break;
+	}
+	case 695: {
+		GLint x = (GLint) rd_u32(rx);
+		GLint y = (GLint) rd_u32(rx);
+		GLsizei width = (GLsizei) rd_u32(rx);
+		GLsizei height = (GLsizei) rd_u32(rx);
+
+		glViewport(x, y, width, height);
+		break;
+	}
+	case 696: {
+		GLuint first = (GLuint) rd_u32(rx);
+		GLsizei count = (GLsizei) rd_u32(rx);
+		const GLfloat *v = rd_data(rx);
+
+		glViewportArrayv(first, count, v);
+		break;
+	}
+	case 697: {
+		GLuint index = (GLuint) rd_u32(rx);
+		GLfloat x = rd_f32(rx);
+		GLfloat y = rd_f32(rx);
+		GLfloat w = rd_f32(rx);
+		GLfloat h = rd_f32(rx);
+
+		glViewportIndexedf(index, x, y, w, h);
+		break;
+	}
+	case 698: {
+		GLuint index = (GLuint) rd_u32(rx);
+		const GLfloat *v = rd_data(rx);
+
+		glViewportIndexedfv(index, v);
+		break;
+	}
+	case 699: {
+		GLsync sync = replay_sync(rs, rd_u64(rx));
+		GLbitfield flags = (GLbitfield) rd_u32(rx);
+		GLuint64 timeout = (GLuint64) rd_u64(rx);
+
+		glWaitSync(sync, flags, timeout);
+		break;
+	}
+	default:
+		return 0;
+	}
+	return 1;
+}
+
+int gl3wReplay(const void *trace, size_t size, int flags,
+	       void (*frame)(void *), void *arg, struct GL3WReplayStats *stats)
+{
+	struct replay rp;
+	struct reader r;
+	GLuint header[4];
+	int *slots, i, ret = 0;
+	double start = now();
+
+	memset(stats, 0, sizeof(*stats));
+	if (size < sizeof(header))
+		return -1;
+	memcpy(header, trace, sizeof(header));
+	if (memcmp(header, "GL3WTRC", 8) || header[2] != 1 ||
+	    header[3] != 0x01020304)
+		return -1;
+	slots = (int *) malloc(0x10000 * sizeof(*slots));
+	if (!slots)
+		return -1;
+	for (i = 0; i < 0x10000; i++)
+		slots[i] = -1;
+	memset(&rp, 0, sizeof(rp));
+	r.base = (const unsigned char *) trace;
+	r.p = r.base + sizeof(header);
+	r.end = r.base + size;
+	r.error = 0;
+
+	while (r.p < r.end) {
+		struct reader rec;
+		unsigned short slot, rflags;
+		GLuint len;
+		GLuint64 t;
+
+		if (!take(&r, 16)) {
+			ret = -1;
+			break;
+		}
+		memcpy(&slot, r.p, 2);
+		memcpy(&rflags, r.p + 2, 2);
+		memcpy(&len, r.p + 4, 4);
+		memcpy(&t, r.p + 8, 8);
+		r.p += 16;
+		if (!take(&r, len)) {
+			ret = -1;
+			break;
+		}
+		rec.base = r.base;
+		rec.p = r.p;
+		rec.end = r.p + len;
+		rec.error = 0;
+		r.p += len;
+
+		if (flags & GL3W_REPLAY_TIMED) {
+			double wait = start + t / 1e9 - now();
+
+			if (wait > 0.002)
+				pause_for(wait - 0.001);
+			while (now() < start + t / 1e9)
+				;
+		}
+		if (slot == REPLAY_FRAME) {
+			stats->frames++;
+			if (frame)
+				frame(arg);
+		} else if (slot == REPLAY_NAME) {
+			GLuint captured = rd_u32(&rec);
+			const GLchar *name = rd_string(&rec);
+
+			if (name && captured < 0x10000)
+				slots[captured] = gl3wProcIndex(name);
+		} else if (slot == REPLAY_MAPDATA) {
+			replay_mapdata(&rp, &rec);
+		} else if ((rflags & REPLAY_UNSUPPORTED) || slots[slot] < 0 ||
+			   !replay_call(&rp, slots[slot], &rec) || rec.error) {
+			stats->skipped++;
+		} else {
+			stats->calls++;
+		}
+		while (rp.nscratch)
+			free(rp.scratch[--rp.nscratch]);
+	}
+
+	for (i = 0; i < NS_COUNT; i++)
+		free(rp.names[i]);
+	free(rp.locations);
+	free(rp.syncs);
+	free(slots);
+	return ret;
+}
@@ -0,0 +1,142 @@
+#include <string.h>
+
+#include "gpucull.h"
+
+static const char *const CULL_VARYINGS[] = {"instance", NULL};
+
+/* Bounds are the circle around a square of half-size scale at any
+ * rotation, matching the CPU culling in cull.c.
+ */
+static const struct shader_source CULL_SHADER = {
+    .name = "cull",
+    .vert =
+        "layout(location = 1) in vec3 source;\n"
+        "out vec3 vinstance;\n"
+        "void main() {\n"
+        "    vinstance = source;\n"
+        "}\n",
+    .geom =
+        "layout(points) in;\n"
+        "layout(points, max_vertices = 1) out;\n"
+        "in vec3 vinstance[];\n"
+        "out vec3 instance;\n"
+        "uniform vec4 view;\n"
+        "void main() {\n"
+        "    vec3 i = vinstance[0];\n"
+        "    float r = i.z * 1.41421356;\n"
+        "    if (all(greaterThanEqual(i.xy + r, view.xy)) &&\n"
+        "        all(lessThanEqual(i.xy - r, view.zw))) {\n"
+        "        instance = i;\n"
+        "        EmitVertex();\n"
+        "        EndPrimitive();\n"
+        "    }\n"
+        "}\n",
+    .varyings = CULL_VARYINGS,
+};
+
+void
+gpu_cull_init(struct gpu_cull *cull, GLuint buffer, GLsizei count)
+{
+    shader_set_init(&cull->shaders, &CULL_SHADER);
+    cull->program = shader_variant(&cull->shaders, 0);
+    cull->uniform_view = glGetUniformLocation(cull->program, "view");
+    cull->count = count;
+
+    glGenVertexArrays(1, &cull->vao);
+    glBindVertexArray(cull->vao);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(1);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glGenBuffers(GPU_CULL_SLOTS, cull->buffers);
+    for (int i = 0; i < GPU_CULL_SLOTS; i++) {
+        glBindBuffer(GL_TRANSFORM_FEEDBACK_BUFFER, cull->buffers[i]);
+        glBufferData(GL_TRANSFORM_FEEDBACK_BUFFER,
+                     count * 3 * sizeof(GLfloat), NULL, GL_DYNAMIC_COPY);
+    }
+    glBindBuffer(GL_TRANSFORM_FEEDBACK_BUFFER, 0);
+    glGenQueries(GPU_CULL_SLOTS, cull->queries);
+    memset(cull->pending, 0, sizeof(cull->pending));
+    cull->next = 0;
+    cull->ready = -1;
+    cull->visible = 0;
+}
+
+/* Collects finished counts, newest first, so a stale result never
+ * replaces a fresher one.
+ */
+static void
+poll(struct gpu_cull *cull)
+{
+    for (unsigned i = 1; i <= GPU_CULL_SLOTS; i++) {
+        int slot = (cull->next + GPU_CULL_SLOTS - i) % GPU_CULL_SLOTS;
+        if (!cull->pending[slot])
+            continue;
+        GLuint available = 0;
+        glGetQueryObjectuiv(cull->queries[slot], GL_QUERY_RESULT_AVAILABLE,
+                            &available);
+        if (!available)
+            continue;
+        glGetQueryObjectuiv(cull->queries[slot], GL_QUERY_RESULT,
+                            &cull->visible);
+        cull->ready = slot;
+        /* Anything older is superseded */
+        for (unsigned j = i; j <= GPU_CULL_SLOTS; j++) {
+            int old = (cull->next + GPU_CULL_SLOTS - j) % GPU_CULL_SLOTS;
+            cull->pending[old] = 0;
+        }
+        return;
+    }
+}
+
+void
+gpu_cull_run(struct gpu_cull *cull, const float view[4])
+{
+    poll(cull);
+    unsigned slot = cull->next;
+    if ((int) slot == cull->ready || cull->pending[slot]) {
+        /* Ring is full: every slot is in flight or being drawn */
+        return;
+    }
+
+    glUseProgram(cull->program);
+    glUniform4fv(cull->uniform_view, 1, view);
+    glEnable(GL_RASTERIZER_DISCARD);
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, cull->buffers[slot]);
+    glBeginQuery(GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN,
+                 cull->queries[slot]);
+    glBeginTransformFeedback(GL_POINTS);
+    glBindVertexArray(cull->vao);
+    glDrawArrays(GL_POINTS, 0, cull->count);
+    glBindVertexArray(0);
+    glEndTransformFeedback();
+    glEndQuery(GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN);
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0);
+    glDisable(GL_RASTERIZER_DISCARD);
+    glUseProgram(0);
+
+    cull->pending[slot] = 1;
+    cull->next = (slot + 1) % GPU_CULL_SLOTS;
+}
+
+int
+gpu_cull_result(struct gpu_cull *cull, GLuint *buffer, GLuint *count)
+{
+    poll(cull);
+    if (cull->ready < 0)
+        return 0;
+    *buffer = cull->buffers[cull->ready];
+    *count = cull->visible;
+    return 1;
+}
+
+void
+gpu_cull_free(struct gpu_cull *cull)
+{
+    glDeleteQueries(GPU_CULL_SLOTS, cull->queries);
+    glDeleteBuffers(GPU_CULL_SLOTS, cull->buffers);
+    glDeleteVertexArrays(1, &cull->vao);
+    shader_set_free(&cull->shaders);
+}
@@ -0,0 +1,46 @@
+#ifndef GPUCULL_H
+#define GPUCULL_H
+
+#include <GL/gl3w.h>
+
+#include "shader.h"
+
+#define GPU_CULL_SLOTS 3
+
+/* View culling on the device for OpenGL 3.3, which lacks compute
+ * shaders. Instances (x, y, scale) run through a geometry shader with
+ * rasterization discarded, and the visible ones are compacted into an
+ * output buffer by transform feedback. Each pass writes to the next
+ * of a ring of buffers and is counted by a primitives written query.
+ * Draws use the newest pass whose count is already available, so the
+ * CPU never waits on a query. Results lag the view by a frame or two:
+ * cull against a slightly enlarged view.
+ */
+struct gpu_cull {
+    struct shader_set shaders;
+    GLuint program;
+    GLint uniform_view;
+    GLuint vao;
+    GLsizei count;
+    GLuint buffers[GPU_CULL_SLOTS];
+    GLuint queries[GPU_CULL_SLOTS];
+    int pending[GPU_CULL_SLOTS];
+    unsigned next;
+    int ready;          /* newest slot with a known count, or -1 */
+    GLuint visible;     /* count for that slot */
+};
+
+/* Instances are read from buffer, count of them packed as 3 floats. */
+void gpu_cull_init(struct gpu_cull *, GLuint buffer, GLsizei count);
+
+/* Queues a culling pass against view (min x, min y, max x, max y). */
+void gpu_cull_run(struct gpu_cull *, const float view[4]);
+
+/* Gets the newest compacted instance buffer and its count without
+ * blocking. Returns 0 until the first pass has completed.
+ */
+int gpu_cull_result(struct gpu_cull *, GLuint *buffer, GLuint *count);
+
+void gpu_cull_free(struct gpu_cull *);
+
+#endif
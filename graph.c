@@ -0,0 +1,301 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "graph.h"
+
+enum {
+    GRAPH_IMPORTED,
+    GRAPH_TRANSIENT,
+    GRAPH_BUFFER
+};
+
+static void
+overflow(const char *what)
+{
+    fprintf(stderr, "error: render graph: too many %s\n", what);
+    exit(EXIT_FAILURE);
+}
+
+void
+graph_init(struct graph *g, struct target_pool *pool)
+{
+    memset(g, 0, sizeof(*g));
+    g->pool = pool;
+}
+
+void
+graph_reset(struct graph *g)
+{
+    g->pass_count = 0;
+    g->resource_count = 0;
+    g->order_count = 0;
+}
+
+static int
+add_resource(struct graph *g, const char *name, int kind)
+{
+    if (g->resource_count == GRAPH_MAX_RESOURCES)
+        overflow("resources");
+    struct graph_resource *r = g->resources + g->resource_count;
+    memset(r, 0, sizeof(*r));
+    r->name = name;
+    r->kind = kind;
+    r->writer = -1;
+    r->pooled = -1;
+    return g->resource_count++;
+}
+
+int
+graph_import(struct graph *g, const char *name, GLuint fbo,
+             int width, int height)
+{
+    int i = add_resource(g, name, GRAPH_IMPORTED);
+    g->resources[i].fbo = fbo;
+    g->resources[i].desc.width = width;
+    g->resources[i].desc.height = height;
+    return i;
+}
+
+int
+graph_create(struct graph *g, const char *name,
+             const struct target_desc *desc)
+{
+    int i = add_resource(g, name, GRAPH_TRANSIENT);
+    g->resources[i].desc = *desc;
+    return i;
+}
+
+int
+graph_buffer(struct graph *g, const char *name)
+{
+    return add_resource(g, name, GRAPH_BUFFER);
+}
+
+int
+graph_pass(struct graph *g, const char *name, graph_fn fn, void *arg)
+{
+    if (g->pass_count == GRAPH_MAX_PASSES)
+        overflow("passes");
+    struct graph_pass *p = g->passes + g->pass_count;
+    memset(p, 0, sizeof(*p));
+    p->name = name;
+    p->fn = fn;
+    p->arg = arg;
+    p->target = -1;
+    return g->pass_count++;
+}
+
+static void
+add_edge(int *list, int *count, int pass)
+{
+    for (int i = 0; i < *count; i++)
+        if (list[i] == pass)
+            return;
+    list[(*count)++] = pass;
+}
+
+static void
+add_use(struct graph_pass *p, int resource)
+{
+    for (int i = 0; i < p->use_count; i++)
+        if (p->uses[i] == resource)
+            return;
+    if (p->use_count == GRAPH_MAX_USES)
+        overflow("resources used by one pass");
+    p->uses[p->use_count++] = resource;
+}
+
+void
+graph_read(struct graph *g, int pass, int resource)
+{
+    struct graph_pass *p = g->passes + pass;
+    struct graph_resource *r = g->resources + resource;
+    if (r->writer >= 0 && r->writer != pass)
+        add_edge(p->deps, &p->dep_count, r->writer);
+    add_edge(r->readers, &r->reader_count, pass);
+    add_use(p, resource);
+}
+
+void
+graph_write(struct graph *g, int pass, int resource)
+{
+    struct graph_pass *p = g->passes + pass;
+    struct graph_resource *r = g->resources + resource;
+    if (r->writer >= 0 && r->writer != pass)
+        add_edge(p->deps, &p->dep_count, r->writer);
+    for (int i = 0; i < r->reader_count; i++)
+        if (r->readers[i] != pass)
+            add_edge(p->after, &p->after_count, r->readers[i]);
+    r->reader_count = 0;
+    r->writer = pass;
+    add_use(p, resource);
+    if (r->kind != GRAPH_BUFFER) {
+        if (p->target >= 0 && p->target != resource) {
+            fprintf(stderr, "error: render graph: pass %s writes two "
+                    "targets\n", p->name);
+            exit(EXIT_FAILURE);
+        }
+        p->target = resource;
+    }
+    if (r->kind == GRAPH_IMPORTED)
+        p->root = true;
+}
+
+void
+graph_keep(struct graph *g, int pass)
+{
+    g->passes[pass].root = true;
+}
+
+static void
+mark_live(struct graph *g, int pass)
+{
+    struct graph_pass *p = g->passes + pass;
+    if (p->live)
+        return;
+    p->live = true;
+    for (int i = 0; i < p->dep_count; i++)
+        mark_live(g, p->deps[i]);
+}
+
+/* Kahn's algorithm over the live passes. Among the ready ones, a pass
+ * drawing to the target already bound goes first, saving a bind;
+ * otherwise declaration order decides.
+ */
+static void
+schedule(struct graph *g)
+{
+    int waiting[GRAPH_MAX_PASSES] = {0};
+    bool done[GRAPH_MAX_PASSES] = {false};
+    for (int i = 0; i < g->pass_count; i++) {
+        struct graph_pass *p = g->passes + i;
+        for (int j = 0; j < p->dep_count; j++)
+            waiting[i] += g->passes[p->deps[j]].live;
+        for (int j = 0; j < p->after_count; j++)
+            waiting[i] += g->passes[p->after[j]].live;
+    }
+    int bound = -1;
+    g->order_count = 0;
+    for (;;) {
+        int next = -1;
+        for (int i = 0; i < g->pass_count; i++) {
+            struct graph_pass *p = g->passes + i;
+            if (!p->live || done[i] || waiting[i])
+                continue;
+            if (next < 0)
+                next = i;
+            if (p->target >= 0 && p->target == bound) {
+                next = i;
+                break;
+            }
+        }
+        if (next < 0)
+            break;
+        done[next] = true;
+        g->order[g->order_count++] = next;
+        if (g->passes[next].target >= 0)
+            bound = g->passes[next].target;
+        for (int i = 0; i < g->pass_count; i++) {
+            struct graph_pass *p = g->passes + i;
+            for (int j = 0; j < p->dep_count; j++)
+                waiting[i] -= p->deps[j] == next;
+            for (int j = 0; j < p->after_count; j++)
+                waiting[i] -= p->after[j] == next;
+        }
+    }
+}
+
+/* Transients are acquired in order of first use and released after
+ * their last, so one whose lifetime has ended before another's begins
+ * hands it the same target. Commands run in order, so reusing a target
+ * within the frame never waits on the GPU.
+ */
+static void
+allocate(struct graph *g)
+{
+    for (int i = 0; i < g->resource_count; i++) {
+        g->resources[i].first = -1;
+        g->resources[i].last = -1;
+    }
+    for (int pos = 0; pos < g->order_count; pos++) {
+        struct graph_pass *p = g->passes + g->order[pos];
+        for (int j = 0; j < p->use_count; j++) {
+            struct graph_resource *r = g->resources + p->uses[j];
+            if (r->first < 0)
+                r->first = pos;
+            r->last = pos;
+        }
+    }
+
+    bool given[TARGET_POOL_CAPACITY] = {false};
+    g->stats.transients = 0;
+    g->stats.targets = 0;
+    for (int pos = 0; pos < g->order_count; pos++) {
+        for (int i = 0; i < g->resource_count; i++) {
+            struct graph_resource *r = g->resources + i;
+            if (r->kind != GRAPH_TRANSIENT || r->first != pos)
+                continue;
+            int t = target_pool_acquire(g->pool, &r->desc);
+            g->stats.transients++;
+            g->stats.targets += !given[t];
+            given[t] = true;
+            r->pooled = t;
+            r->fbo = g->pool->targets[t].fbo;
+            r->texture = r->desc.samples ? 0 : g->pool->targets[t].storage;
+        }
+        for (int i = 0; i < g->resource_count; i++) {
+            struct graph_resource *r = g->resources + i;
+            if (r->kind == GRAPH_TRANSIENT && r->last == pos)
+                target_pool_release(g->pool, r->pooled);
+        }
+    }
+}
+
+void
+graph_execute(struct graph *g)
+{
+    for (int i = 0; i < g->pass_count; i++)
+        g->passes[i].live = false;
+    for (int i = 0; i < g->pass_count; i++)
+        if (g->passes[i].root)
+            mark_live(g, i);
+    schedule(g);
+    allocate(g);
+
+    g->stats.passes = g->order_count;
+    g->stats.culled = g->pass_count - g->order_count;
+    g->stats.binds = 0;
+    GLuint bound = 0;
+    bool known = false;
+    for (int pos = 0; pos < g->order_count; pos++) {
+        struct graph_pass *p = g->passes + g->order[pos];
+        if (p->target >= 0) {
+            struct graph_resource *r = g->resources + p->target;
+            if (!known || r->fbo != bound) {
+                glBindFramebuffer(GL_FRAMEBUFFER, r->fbo);
+                g->stats.binds++;
+                bound = r->fbo;
+                known = true;
+            }
+            glViewport(0, 0, r->desc.width, r->desc.height);
+        }
+        p->fn(g, p->arg);
+    }
+    if (bound) {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        g->stats.binds++;
+    }
+}
+
+GLuint
+graph_framebuffer(const struct graph *g, int resource)
+{
+    return g->resources[resource].fbo;
+}
+
+GLuint
+graph_texture(const struct graph *g, int resource)
+{
+    return g->resources[resource].texture;
+}
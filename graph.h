@@ -0,0 +1,108 @@
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <GL/gl3w.h>
+
+#include "targetpool.h"
+
+#define GRAPH_MAX_PASSES    32
+#define GRAPH_MAX_RESOURCES 32
+#define GRAPH_MAX_USES      8   /* reads or writes per pass */
+
+struct graph;
+typedef void (*graph_fn)(struct graph *, void *arg);
+
+struct graph_resource {
+    const char *name;
+    int kind;
+    struct target_desc desc;
+    GLuint fbo;         /* for targets: bound while a pass writes it */
+    GLuint texture;     /* single-sampled transients only */
+    int writer;         /* pass that wrote the current version */
+    int readers[GRAPH_MAX_PASSES];  /* ... and the passes reading it */
+    int reader_count;
+    int first, last;    /* schedule positions using it */
+    int pooled;         /* target in the pool, while executing */
+};
+
+struct graph_pass {
+    const char *name;
+    graph_fn fn;
+    void *arg;
+    int uses[GRAPH_MAX_USES];   /* resources read or written */
+    int use_count;
+    int deps[GRAPH_MAX_PASSES]; /* passes whose results it uses */
+    int dep_count;
+    int after[GRAPH_MAX_PASSES];  /* passes reading what it overwrites */
+    int after_count;
+    int target;         /* render target written, or -1 */
+    bool root;          /* writes something outside the graph */
+    bool live;
+};
+
+struct graph_stats {
+    int passes;
+    int culled;
+    int transients;     /* transient targets declared */
+    int targets;        /* pooled targets they were given */
+    int binds;          /* framebuffer binds */
+};
+
+/* A frame graph. Each frame, passes are declared with the resources
+ * they read and write: render targets, which are imported (such as
+ * the window) or transient, and buffers, which are tracked only for
+ * ordering. A write makes a new version of a resource, so reads see
+ * the last write declared before them. Executing the graph
+ *  - culls passes whose results nothing outside the graph depends on,
+ *  - orders the rest, preferring to keep the same target bound,
+ *  - gives each transient target storage from a target pool for its
+ *    lifetime, so transients of the same description whose lifetimes
+ *    don't overlap share one,
+ * and then runs the passes with their target bound and its viewport
+ * set.
+ */
+struct graph {
+    struct graph_pass passes[GRAPH_MAX_PASSES];
+    int pass_count;
+    struct graph_resource resources[GRAPH_MAX_RESOURCES];
+    int resource_count;
+    struct target_pool *pool;
+    int order[GRAPH_MAX_PASSES];
+    int order_count;
+    struct graph_stats stats;  /* of the last execution */
+};
+
+void graph_init(struct graph *, struct target_pool *);
+
+/* Forgets the last frame's passes and resources. */
+void graph_reset(struct graph *);
+
+int graph_import(struct graph *, const char *name, GLuint fbo,
+                 int width, int height);
+int graph_create(struct graph *, const char *name,
+                 const struct target_desc *);
+int graph_buffer(struct graph *, const char *name);
+
+int graph_pass(struct graph *, const char *name, graph_fn, void *arg);
+void graph_read(struct graph *, int pass, int resource);
+
+/* A pass renders into at most one target; it may write any number of
+ * buffers. Writing keeps the previous contents, so it also depends on
+ * the previous write. Passes may rebind the read framebuffer but must
+ * leave their target bound for drawing.
+ */
+void graph_write(struct graph *, int pass, int resource);
+
+/* Marks a pass as having effects beyond its declared writes. */
+void graph_keep(struct graph *, int pass);
+
+/* Transient targets are back in the pool when it returns. */
+void graph_execute(struct graph *);
+
+/* During execution: storage given to a target. */
+GLuint graph_framebuffer(const struct graph *, int resource);
+GLuint graph_texture(const struct graph *, int resource);
+
+#endif
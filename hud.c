@@ -0,0 +1,334 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+
+#include "hud.h"
+
+#define GLYPH_W   5   /* font pixels */
+#define GLYPH_H   7
+#define ADVANCE   6
+#define LEADING   9
+#define TEXELS    4   /* SDF texels per font pixel */
+#define PAD       1.5f  /* font pixels of field around each glyph */
+#define CELL_W    32  /* (GLYPH_W + 2 * PAD) * TEXELS */
+#define CELL_H    40
+#define COLUMNS   16
+#define ROWS      6
+#define SOLID     95  /* a filled cell after the 95 printable glyphs */
+#define GRAPH_H   40  /* font pixels for 2 / 60 s */
+#define MARGIN    4
+
+/* Printable ASCII from the space on, one row of 5 bits per byte with
+ * the leftmost pixel in bit 4.
+ */
+static const unsigned char FONT[95][GLYPH_H] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},  /* space */
+    {0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04},  /* ! */
+    {0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00},  /* " */
+    {0x0a, 0x0a, 0x1f, 0x0a, 0x1f, 0x0a, 0x0a},  /* # */
+    {0x04, 0x0f, 0x14, 0x0e, 0x05, 0x1e, 0x04},  /* $ */
+    {0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03},  /* % */
+    {0x0c, 0x12, 0x14, 0x08, 0x15, 0x12, 0x0d},  /* & */
+    {0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00},  /* ' */
+    {0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02},  /* ( */
+    {0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08},  /* ) */
+    {0x00, 0x04, 0x15, 0x0e, 0x15, 0x04, 0x00},  /* * */
+    {0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00},  /* + */
+    {0x00, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x08},  /* , */
+    {0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00},  /* - */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c},  /* . */
+    {0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00},  /* / */
+    {0x0e, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0e},  /* 0 */
+    {0x04, 0x0c, 0x04, 0x04, 0x04, 0x04, 0x0e},  /* 1 */
+    {0x0e, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1f},  /* 2 */
+    {0x1f, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0e},  /* 3 */
+    {0x02, 0x06, 0x0a, 0x12, 0x1f, 0x02, 0x02},  /* 4 */
+    {0x1f, 0x10, 0x1e, 0x01, 0x01, 0x11, 0x0e},  /* 5 */
+    {0x06, 0x08, 0x10, 0x1e, 0x11, 0x11, 0x0e},  /* 6 */
+    {0x1f, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08},  /* 7 */
+    {0x0e, 0x11, 0x11, 0x0e, 0x11, 0x11, 0x0e},  /* 8 */
+    {0x0e, 0x11, 0x11, 0x0f, 0x01, 0x02, 0x0c},  /* 9 */
+    {0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00},  /* : */
+    {0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x04, 0x08},  /* ; */
+    {0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02},  /* < */
+    {0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00},  /* = */
+    {0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08},  /* > */
+    {0x0e, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04},  /* ? */
+    {0x0e, 0x11, 0x01, 0x0d, 0x15, 0x15, 0x0e},  /* @ */
+    {0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11},  /* A */
+    {0x1e, 0x11, 0x11, 0x1e, 0x11, 0x11, 0x1e},  /* B */
+    {0x0e, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0e},  /* C */
+    {0x1c, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1c},  /* D */
+    {0x1f, 0x10, 0x10, 0x1e, 0x10, 0x10, 0x1f},  /* E */
+    {0x1f, 0x10, 0x10, 0x1e, 0x10, 0x10, 0x10},  /* F */
+    {0x0e, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0f},  /* G */
+    {0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11},  /* H */
+    {0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e},  /* I */
+    {0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0c},  /* J */
+    {0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11},  /* K */
+    {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1f},  /* L */
+    {0x11, 0x1b, 0x15, 0x15, 0x11, 0x11, 0x11},  /* M */
+    {0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11},  /* N */
+    {0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e},  /* O */
+    {0x1e, 0x11, 0x11, 0x1e, 0x10, 0x10, 0x10},  /* P */
+    {0x0e, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0d},  /* Q */
+    {0x1e, 0x11, 0x11, 0x1e, 0x14, 0x12, 0x11},  /* R */
+    {0x0f, 0x10, 0x10, 0x0e, 0x01, 0x01, 0x1e},  /* S */
+    {0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04},  /* T */
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e},  /* U */
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x04},  /* V */
+    {0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0a},  /* W */
+    {0x11, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x11},  /* X */
+    {0x11, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04},  /* Y */
+    {0x1f, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1f},  /* Z */
+    {0x0e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0e},  /* [ */
+    {0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00},  /* backslash */
+    {0x0e, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0e},  /* ] */
+    {0x04, 0x0a, 0x11, 0x00, 0x00, 0x00, 0x00},  /* ^ */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f},  /* _ */
+    {0x08, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00},  /* ` */
+    {0x00, 0x00, 0x0e, 0x01, 0x0f, 0x11, 0x0f},  /* a */
+    {0x10, 0x10, 0x16, 0x19, 0x11, 0x11, 0x1e},  /* b */
+    {0x00, 0x00, 0x0e, 0x10, 0x10, 0x11, 0x0e},  /* c */
+    {0x01, 0x01, 0x0d, 0x13, 0x11, 0x11, 0x0f},  /* d */
+    {0x00, 0x00, 0x0e, 0x11, 0x1f, 0x10, 0x0e},  /* e */
+    {0x06, 0x09, 0x08, 0x1c, 0x08, 0x08, 0x08},  /* f */
+    {0x00, 0x0f, 0x11, 0x11, 0x0f, 0x01, 0x0e},  /* g */
+    {0x10, 0x10, 0x16, 0x19, 0x11, 0x11, 0x11},  /* h */
+    {0x04, 0x00, 0x0c, 0x04, 0x04, 0x04, 0x0e},  /* i */
+    {0x02, 0x00, 0x06, 0x02, 0x02, 0x12, 0x0c},  /* j */
+    {0x10, 0x10, 0x12, 0x14, 0x18, 0x14, 0x12},  /* k */
+    {0x0c, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e},  /* l */
+    {0x00, 0x00, 0x1a, 0x15, 0x15, 0x11, 0x11},  /* m */
+    {0x00, 0x00, 0x16, 0x19, 0x11, 0x11, 0x11},  /* n */
+    {0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e},  /* o */
+    {0x00, 0x00, 0x1e, 0x11, 0x1e, 0x10, 0x10},  /* p */
+    {0x00, 0x00, 0x0d, 0x13, 0x0f, 0x01, 0x01},  /* q */
+    {0x00, 0x00, 0x16, 0x19, 0x10, 0x10, 0x10},  /* r */
+    {0x00, 0x00, 0x0e, 0x10, 0x0e, 0x01, 0x1e},  /* s */
+    {0x08, 0x08, 0x1c, 0x08, 0x08, 0x09, 0x06},  /* t */
+    {0x00, 0x00, 0x11, 0x11, 0x11, 0x13, 0x0d},  /* u */
+    {0x00, 0x00, 0x11, 0x11, 0x11, 0x0a, 0x04},  /* v */
+    {0x00, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a},  /* w */
+    {0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11},  /* x */
+    {0x00, 0x00, 0x11, 0x11, 0x0f, 0x01, 0x0e},  /* y */
+    {0x00, 0x00, 0x1f, 0x02, 0x04, 0x08, 0x1f},  /* z */
+    {0x02, 0x04, 0x04, 0x08, 0x04, 0x04, 0x02},  /* { */
+    {0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04},  /* | */
+    {0x08, 0x04, 0x04, 0x02, 0x04, 0x04, 0x08},  /* } */
+    {0x00, 0x00, 0x08, 0x15, 0x02, 0x00, 0x00},  /* ~ */
+};
+
+static const struct shader_source HUD_SHADER = {
+    .name = "hud",
+    .vert =
+        "layout(location = 0) in vec2 corner;\n"
+        "layout(location = 1) in vec4 rect;\n"
+        "layout(location = 3) in vec4 region;\n"
+        "layout(location = 4) in vec4 tint;\n"
+        "uniform vec2 scale;\n"
+        "out vec2 uv;\n"
+        "out vec4 color;\n"
+        "void main() {\n"
+        "    vec2 p = corner * rect.zw + rect.xy;\n"
+        "    gl_Position = vec4(p * scale + vec2(-1, 1), 0, 1);\n"
+        "    uv = mix(region.xy, region.zw, corner * 0.5 + 0.5);\n"
+        "    color = tint;\n"
+        "}\n",
+    .frag =
+        "in vec2 uv;\n"
+        "in vec4 color;\n"
+        "uniform sampler2DArray font;\n"
+        "out vec4 fragment;\n"
+        "void main() {\n"
+        "    float d = texture(font, vec3(uv, 0)).r;\n"
+        "    float w = max(fwidth(d), 1e-5);\n"
+        "    float a = clamp((d - 0.5) / w + 0.5, 0, 1);\n"
+        "    fragment = vec4(color.rgb, color.a * a);\n"
+        "}\n",
+};
+
+static int
+glyph_pixel(const unsigned char *rows, int x, int y)
+{
+    if (x < 0 || x >= GLYPH_W || y < 0 || y >= GLYPH_H)
+        return 0;
+    return rows[y] >> (GLYPH_W - 1 - x) & 1;
+}
+
+/* Exact distance from every texel center to the nearest pixel of the
+ * other kind, in font pixels, mapped so the edge lands on 0.5.
+ */
+static void
+render_cell(unsigned char *dst, int stride, const unsigned char *rows)
+{
+    for (int ty = 0; ty < CELL_H; ty++) {
+        for (int tx = 0; tx < CELL_W; tx++) {
+            float fx = (tx + 0.5f) / TEXELS - PAD;
+            float fy = (ty + 0.5f) / TEXELS - PAD;
+            int inside = glyph_pixel(rows, floorf(fx), floorf(fy));
+            float best = PAD * PAD;
+            for (int y = -2; y < GLYPH_H + 2; y++) {
+                for (int x = -2; x < GLYPH_W + 2; x++) {
+                    if (glyph_pixel(rows, x, y) == inside)
+                        continue;
+                    float dx = fmaxf(fabsf(fx - x - 0.5f) - 0.5f, 0);
+                    float dy = fmaxf(fabsf(fy - y - 0.5f) - 0.5f, 0);
+                    best = fminf(best, dx * dx + dy * dy);
+                }
+            }
+            float d = sqrtf(best) / PAD;
+            dst[ty * stride + tx] = 127.5f + (inside ? d : -d) * 127.5f;
+        }
+    }
+}
+
+void
+hud_init(struct hud *hud, float scale)
+{
+    memset(hud, 0, sizeof(*hud));
+    hud->scale = scale;
+    shader_set_init(&hud->shaders, &HUD_SHADER);
+    hud->program = shader_variant(&hud->shaders, 0);
+
+    int width = COLUMNS * CELL_W;
+    int height = ROWS * CELL_H;
+    unsigned char *field = calloc((size_t) width * height, 1);
+    if (!field) {
+        fprintf(stderr, "error: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    static const unsigned char solid[GLYPH_H] = {
+        0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f
+    };
+    for (int i = 0; i <= SOLID; i++) {
+        unsigned char *cell = field + (i / COLUMNS * CELL_H) * width +
+                              i % COLUMNS * CELL_W;
+        render_cell(cell, width, i == SOLID ? solid : FONT[i]);
+    }
+    glGenTextures(1, &hud->font);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, hud->font);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_R8, width, height, 1, 0,
+                 GL_RED, GL_UNSIGNED_BYTE, field);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S,
+                    GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T,
+                    GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    free(field);
+}
+
+void
+hud_frame(struct hud *hud, double seconds)
+{
+    hud->frames[hud->next] = seconds * 1000;
+    hud->next = (hud->next + 1) % HUD_HISTORY;
+}
+
+void
+hud_clear(struct hud *hud)
+{
+    hud->lines = 0;
+}
+
+void
+hud_printf(struct hud *hud, const char *fmt, ...)
+{
+    if (hud->lines == HUD_LINES)
+        return;
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(hud->text[hud->lines++], HUD_COLUMNS, fmt, ap);
+    va_end(ap);
+}
+
+/* A rectangle in screen pixels filled from the middle of the solid
+ * cell, where the field is flat.
+ */
+static void
+draw_rect(struct sprite_batch *batch, float x, float y, float w, float h,
+          uint32_t color)
+{
+    float u = (SOLID % COLUMNS + 0.5f) / COLUMNS;
+    float v = (SOLID / COLUMNS + 0.5f) / ROWS;
+    struct sprite s = {
+        .x = x + w / 2, .y = y + h / 2, .w = w / 2, .h = h / 2,
+        .u0 = u, .v0 = v, .u1 = u, .v1 = v,
+        .color = color,
+    };
+    sprite_draw(batch, &s);
+}
+
+static void
+draw_glyph(struct sprite_batch *batch, float x, float y, float scale,
+           int c)
+{
+    int i = c - ' ';
+    float w = CELL_W / (float) TEXELS * scale / 2;
+    float h = CELL_H / (float) TEXELS * scale / 2;
+    struct sprite s = {
+        .x = x - PAD * scale + w, .y = y - PAD * scale + h,
+        .w = w, .h = h,
+        .u0 = (float) (i % COLUMNS) / COLUMNS,
+        .v0 = (float) (i / COLUMNS) / ROWS,
+        .u1 = (float) (i % COLUMNS + 1) / COLUMNS,
+        .v1 = (float) (i / COLUMNS + 1) / ROWS,
+        .color = 0xffffffff,
+    };
+    sprite_draw(batch, &s);
+}
+
+void
+hud_draw(struct hud *hud, struct sprite_batch *batch)
+{
+    float s = hud->scale;
+    int columns = HUD_HISTORY / ADVANCE;
+    for (int i = 0; i < hud->lines; i++) {
+        int n = strlen(hud->text[i]);
+        columns = n > columns ? n : columns;
+    }
+    float left = 8 + MARGIN * s;
+    float top = 8 + MARGIN * s;
+    float graph = top + hud->lines * LEADING * s;
+
+    sprite_program(batch, hud->program);
+    sprite_texture(batch, hud->font);
+    draw_rect(batch, 8, 8, (columns * ADVANCE + 2 * MARGIN) * s,
+              graph - 8 + (GRAPH_H + MARGIN) * s, 0xb0000000);
+
+    /* One bar per frame, oldest on the left, full height at 2 / 60 s
+     * with a line at 1 / 60 s
+     */
+    for (int i = 0; i < HUD_HISTORY; i++) {
+        float ms = hud->frames[(hud->next + i) % HUD_HISTORY];
+        float h = fminf(ms * 60 / 2000, 1) * GRAPH_H * s;
+        uint32_t color = ms <= 1000 / 60.0f ? 0xff40d040 :
+                         ms <= 2000 / 60.0f ? 0xff30d0e0 : 0xff4040e0;
+        draw_rect(batch, left + i * s, graph + GRAPH_H * s - h, s, h,
+                  color);
+    }
+    draw_rect(batch, left, graph + GRAPH_H * s / 2, HUD_HISTORY * s, 1,
+              0x80ffffff);
+
+    for (int i = 0; i < hud->lines; i++) {
+        const char *p = hud->text[i];
+        for (int x = 0; p[x]; x++) {
+            if (p[x] > ' ' && p[x] < 127)
+                draw_glyph(batch, left + x * ADVANCE * s,
+                           top + i * LEADING * s, s, p[x]);
+        }
+    }
+}
+
+void
+hud_free(struct hud *hud)
+{
+    glDeleteTextures(1, &hud->font);
+    shader_set_free(&hud->shaders);
+}
@@ -0,0 +1,49 @@
+#ifndef HUD_H
+#define HUD_H
+
+#include <GL/gl3w.h>
+
+#include "shader.h"
+#include "sprite.h"
+
+#define HUD_HISTORY 120  /* frames in the frame time graph */
+#define HUD_LINES   10
+#define HUD_COLUMNS 80
+
+/* An on-screen overlay of text lines above a graph of recent frame
+ * times. Glyphs come from a signed distance field atlas generated at
+ * startup from a built-in 5x7 bitmap font, so text stays sharp at any
+ * size. The panel, the graph bars and the text are all sprites with
+ * the same texture and program, drawn through the sprite batcher as a
+ * single instanced call.
+ */
+struct hud {
+    struct shader_set shaders;
+    GLuint program;
+    GLuint font;         /* one-layer GL_TEXTURE_2D_ARRAY, R8 */
+    float scale;         /* screen pixels per font pixel */
+    float frames[HUD_HISTORY];  /* milliseconds, oldest first from next */
+    int next;
+    char text[HUD_LINES][HUD_COLUMNS];
+    int lines;
+};
+
+void hud_init(struct hud *, float scale);
+
+/* Records the duration of the last frame for the graph. */
+void hud_frame(struct hud *, double seconds);
+
+/* The text persists until cleared, so it only needs updating when the
+ * numbers change. Lines beyond HUD_LINES are dropped.
+ */
+void hud_clear(struct hud *);
+void hud_printf(struct hud *, const char *fmt, ...);
+
+/* Queues the overlay at the top left of the target. Draw it last: it
+ * switches the batch's texture and program, and leaves them set.
+ */
+void hud_draw(struct hud *, struct sprite_batch *);
+
+void hud_free(struct hud *);
+
+#endif
@@ -0,0 +1,157 @@
+#include <stdlib.h>
+#include <pthread.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "jobs.h"
+
+#define MAX_THREADS 64
+
+static pthread_t threads[MAX_THREADS];
+static int thread_count;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t wake = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t idle = PTHREAD_COND_INITIALIZER;
+
+/* One jobs_run() call, kept on its submitter's stack */
+struct job {
+    job_fn fn;
+    void *arg;
+    size_t count;
+    size_t next;      /* next index to claim */
+    int busy;         /* workers inside, guarded by lock */
+    struct job *link;
+};
+
+/* Open jobs, newest first, guarded by lock. generation counts
+ * submissions so workers can tell a newer job is waiting.
+ */
+static struct job *jobs;
+static unsigned long generation;
+static int quit;
+
+static int
+cpu_count(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? n : 1;
+#endif
+}
+
+/* Claims and runs indices until none are left or, for workers, until
+ * a newer job arrives. Passing seen as NULL never yields.
+ */
+static void
+work(struct job *j, const unsigned long *seen)
+{
+    size_t i;
+    while ((i = __atomic_fetch_add(&j->next, 1, __ATOMIC_RELAXED)) <
+           j->count) {
+        j->fn(j->arg, i);
+        if (seen && __atomic_load_n(&generation, __ATOMIC_RELAXED) != *seen)
+            break;
+    }
+}
+
+/* The newest job with indices left to claim, if any. */
+static struct job *
+claimable(void)
+{
+    for (struct job *j = jobs; j; j = j->link)
+        if (__atomic_load_n(&j->next, __ATOMIC_RELAXED) < j->count)
+            return j;
+    return NULL;
+}
+
+static void *
+worker(void *unused)
+{
+    (void) unused;
+    pthread_mutex_lock(&lock);
+    for (;;) {
+        struct job *j;
+        while (!(j = claimable()) && !quit)
+            pthread_cond_wait(&wake, &lock);
+        if (quit)
+            break;
+        unsigned long seen = generation;
+        j->busy++;
+        pthread_mutex_unlock(&lock);
+        work(j, &seen);
+        pthread_mutex_lock(&lock);
+        if (!--j->busy)
+            pthread_cond_broadcast(&idle);
+    }
+    pthread_mutex_unlock(&lock);
+    return NULL;
+}
+
+void
+jobs_init(int n)
+{
+    if (!n)
+        n = cpu_count() - 1;
+    if (n > MAX_THREADS)
+        n = MAX_THREADS;
+    quit = 0;
+    for (thread_count = 0; thread_count < n; thread_count++)
+        if (pthread_create(threads + thread_count, NULL, worker, NULL))
+            break;
+}
+
+void
+jobs_run(job_fn fn, void *arg, size_t count)
+{
+    if (!thread_count || count < 2) {
+        for (size_t i = 0; i < count; i++)
+            fn(arg, i);
+        return;
+    }
+    struct job j = {fn, arg, count, 0, 0, NULL};
+    pthread_mutex_lock(&lock);
+    j.link = jobs;
+    jobs = &j;
+    __atomic_fetch_add(&generation, 1, __ATOMIC_RELAXED);
+    pthread_cond_broadcast(&wake);
+    pthread_mutex_unlock(&lock);
+
+    work(&j, NULL);
+
+    /* Every index is claimed: wait out workers still running one, then
+     * unlink the job before it goes out of scope.
+     */
+    pthread_mutex_lock(&lock);
+    while (j.busy)
+        pthread_cond_wait(&idle, &lock);
+    struct job **p = &jobs;
+    while (*p != &j)
+        p = &(*p)->link;
+    *p = j.link;
+    pthread_mutex_unlock(&lock);
+}
+
+int
+jobs_threads(void)
+{
+    return thread_count + 1;
+}
+
+void
+jobs_shutdown(void)
+{
+    pthread_mutex_lock(&lock);
+    quit = 1;
+    pthread_cond_broadcast(&wake);
+    pthread_mutex_unlock(&lock);
+    for (int i = 0; i < thread_count; i++)
+        pthread_join(threads[i], NULL);
+    thread_count = 0;
+}
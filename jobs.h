@@ -0,0 +1,33 @@
+#ifndef JOBS_H
+#define JOBS_H
+
+#include <stddef.h>
+
+/* A fixed pool of worker threads for data-parallel work. A job is a
+ * function run once for every index of a range; the pool hands out
+ * indices one at a time, so uneven items balance themselves. The
+ * submitting thread works alongside the pool and returns once every
+ * index is done.
+ *
+ * Jobs may be submitted from several threads at once; none waits for
+ * another's job to finish. Workers move to the newest job between
+ * indices, so a short job, such as the render thread's per-frame
+ * update, isn't stuck behind a long background one, whose submitter
+ * keeps working on it meanwhile. A job's function must not submit
+ * jobs itself.
+ */
+typedef void (*job_fn)(void *arg, size_t index);
+
+/* Starts threads workers, or one per extra CPU if 0. Without a pool,
+ * jobs_run() runs everything on the calling thread.
+ */
+void jobs_init(int threads);
+
+void jobs_run(job_fn, void *arg, size_t count);
+
+/* Threads working on a job, counting the submitter. */
+int jobs_threads(void);
+
+void jobs_shutdown(void);
+
+#endif
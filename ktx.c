@@ -0,0 +1,712 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#include "ktx.h"
+#include "jobs.h"
+
+/* S3TC isn't core, so glcorearb.h doesn't define its formats */
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT        0x83f0
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT       0x83f1
+#define GL_COMPRESSED_RGBA_S3TC_DXT3_EXT       0x83f2
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT       0x83f3
+#define GL_COMPRESSED_SRGB_S3TC_DXT1_EXT       0x8c4c
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT 0x8c4d
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT 0x8c4e
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT 0x8c4f
+
+enum decoder {
+    DECODE_NONE,
+    DECODE_BC1,
+    DECODE_BC1A,
+    DECODE_BC2,
+    DECODE_BC3,
+    DECODE_ETC2,
+    DECODE_ETC2A1,
+    DECODE_ETC2_EAC,
+};
+
+struct ktx_format {
+    GLenum internal;
+    uint32_t vk;        /* VkFormat, for KTX2 */
+    int block_size;     /* bytes per 4x4 block, 0 if uncompressed */
+    enum decoder decoder;
+    int srgb;
+    int (*native)(void);
+};
+
+static int
+has_s3tc(void)
+{
+    return gl3wIsExtensionSupported("GL_EXT_texture_compression_s3tc");
+}
+
+static int
+has_s3tc_srgb(void)
+{
+    return has_s3tc() &&
+        (gl3wIsExtensionSupported("GL_EXT_texture_sRGB") ||
+         gl3wIsExtensionSupported("GL_EXT_texture_compression_s3tc_srgb"));
+}
+
+static int
+has_bptc(void)
+{
+    return gl3wIsSupported(4, 2) ||
+        gl3wHasExt(GL3W_ARB_texture_compression_bptc);
+}
+
+static int
+has_etc2(void)
+{
+    return gl3wIsSupported(4, 3) || gl3wHasExt(GL3W_ARB_ES3_compatibility);
+}
+
+static int
+has_core(void)
+{
+    return 1;  /* including RGTC, core since 3.0 */
+}
+
+static const struct ktx_format formats[] = {
+    {GL_COMPRESSED_RGB_S3TC_DXT1_EXT, 131, 8, DECODE_BC1, 0, has_s3tc},
+    {GL_COMPRESSED_SRGB_S3TC_DXT1_EXT, 132, 8, DECODE_BC1, 1, has_s3tc_srgb},
+    {GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, 133, 8, DECODE_BC1A, 0, has_s3tc},
+    {GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT, 134, 8, DECODE_BC1A, 1,
+     has_s3tc_srgb},
+    {GL_COMPRESSED_RGBA_S3TC_DXT3_EXT, 135, 16, DECODE_BC2, 0, has_s3tc},
+    {GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT, 136, 16, DECODE_BC2, 1,
+     has_s3tc_srgb},
+    {GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, 137, 16, DECODE_BC3, 0, has_s3tc},
+    {GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT, 138, 16, DECODE_BC3, 1,
+     has_s3tc_srgb},
+    {GL_COMPRESSED_RED_RGTC1, 139, 8, DECODE_NONE, 0, has_core},
+    {GL_COMPRESSED_SIGNED_RED_RGTC1, 140, 8, DECODE_NONE, 0, has_core},
+    {GL_COMPRESSED_RG_RGTC2, 141, 16, DECODE_NONE, 0, has_core},
+    {GL_COMPRESSED_SIGNED_RG_RGTC2, 142, 16, DECODE_NONE, 0, has_core},
+    {GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT, 143, 16, DECODE_NONE, 0,
+     has_bptc},
+    {GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT, 144, 16, DECODE_NONE, 0, has_bptc},
+    {GL_COMPRESSED_RGBA_BPTC_UNORM, 145, 16, DECODE_NONE, 0, has_bptc},
+    {GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM, 146, 16, DECODE_NONE, 1, has_bptc},
+    {GL_COMPRESSED_RGB8_ETC2, 147, 8, DECODE_ETC2, 0, has_etc2},
+    {GL_COMPRESSED_SRGB8_ETC2, 148, 8, DECODE_ETC2, 1, has_etc2},
+    {GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2, 149, 8, DECODE_ETC2A1, 0,
+     has_etc2},
+    {GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2, 150, 8, DECODE_ETC2A1, 1,
+     has_etc2},
+    {GL_COMPRESSED_RGBA8_ETC2_EAC, 151, 16, DECODE_ETC2_EAC, 0, has_etc2},
+    {GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC, 152, 16, DECODE_ETC2_EAC, 1,
+     has_etc2},
+    {GL_COMPRESSED_R11_EAC, 153, 8, DECODE_NONE, 0, has_etc2},
+    {GL_COMPRESSED_SIGNED_R11_EAC, 154, 8, DECODE_NONE, 0, has_etc2},
+    {GL_COMPRESSED_RG11_EAC, 155, 16, DECODE_NONE, 0, has_etc2},
+    {GL_COMPRESSED_SIGNED_RG11_EAC, 156, 16, DECODE_NONE, 0, has_etc2},
+    {GL_RGBA8, 37, 0, DECODE_NONE, 0, has_core},
+    {GL_SRGB8_ALPHA8, 43, 0, DECODE_NONE, 1, has_core},
+};
+
+static const unsigned char KTX1_ID[12] = {
+    0xab, 'K', 'T', 'X', ' ', '1', '1', 0xbb, '\r', '\n', 0x1a, '\n'
+};
+static const unsigned char KTX2_ID[12] = {
+    0xab, 'K', 'T', 'X', ' ', '2', '0', 0xbb, '\r', '\n', 0x1a, '\n'
+};
+
+static const struct ktx_format *
+find_format(GLenum internal, uint32_t vk)
+{
+    for (size_t i = 0; i < sizeof(formats) / sizeof(*formats); i++)
+        if (internal ? formats[i].internal == internal : formats[i].vk == vk)
+            return formats + i;
+    return NULL;
+}
+
+static uint32_t
+u32(const unsigned char *p)
+{
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+static uint64_t
+u64(const unsigned char *p)
+{
+    uint64_t v;
+    memcpy(&v, p, 8);
+    return v;
+}
+
+static int
+parse_ktx1(struct ktx *k, const unsigned char *p, size_t size)
+{
+    if (size < 64 || u32(p + 12) != 0x04030201)
+        return -1;
+    uint32_t type = u32(p + 16);
+    uint32_t format = u32(p + 24);
+    uint32_t internal = u32(p + 28);
+    uint32_t depth = u32(p + 44);
+    uint32_t layers = u32(p + 48);
+    uint32_t faces = u32(p + 52);
+    uint32_t levels = u32(p + 56);
+    uint32_t kv = u32(p + 60);
+    k->format = find_format(internal, 0);
+    if (!k->format || depth > 1 || faces != 1 || levels > KTX_MAX_LEVELS)
+        return -1;
+    /* Uncompressed levels are sized and uploaded as 8-bit RGBA */
+    if (!k->format->block_size &&
+        (format != GL_RGBA || type != GL_UNSIGNED_BYTE))
+        return -1;
+    k->gl_format = format;
+    k->gl_type = type;
+    k->width = u32(p + 36);
+    k->height = u32(p + 40);
+    k->layers = layers ? layers : 1;
+    k->levels = levels ? levels : 1;
+
+    size_t off = 64;
+    if (kv > size - off)
+        return -1;
+    off += kv;
+    for (int i = 0; i < k->levels; i++) {
+        if (size - off < 4)
+            return -1;
+        size_t len = u32(p + off);
+        off += 4;
+        if (len > size - off)
+            return -1;
+        k->level[i].data = p + off;
+        k->level[i].size = len;
+        off += (len + 3) & ~(size_t) 3;
+        if (off > size)
+            off = size;
+    }
+    return 0;
+}
+
+static int
+parse_ktx2(struct ktx *k, const unsigned char *p, size_t size)
+{
+    if (size < 80)
+        return -1;
+    uint32_t vk = u32(p + 12);
+    uint32_t depth = u32(p + 28);
+    uint32_t layers = u32(p + 32);
+    uint32_t faces = u32(p + 36);
+    uint32_t levels = u32(p + 40);
+    uint32_t scheme = u32(p + 44);
+    k->format = find_format(0, vk);
+    if (!k->format || depth > 1 || faces != 1 || scheme ||
+        levels > KTX_MAX_LEVELS)
+        return -1;
+    k->gl_format = GL_RGBA;
+    k->gl_type = GL_UNSIGNED_BYTE;
+    k->width = u32(p + 20);
+    k->height = u32(p + 24);
+    k->layers = layers ? layers : 1;
+    k->levels = levels ? levels : 1;
+    if (size < 80 + (size_t) k->levels * 24)
+        return -1;
+    for (int i = 0; i < k->levels; i++) {
+        uint64_t off = u64(p + 80 + i * 24);
+        uint64_t len = u64(p + 80 + i * 24 + 8);
+        if (off > size || len > size - off)
+            return -1;
+        k->level[i].data = p + off;
+        k->level[i].size = len;
+    }
+    return 0;
+}
+
+/* Bytes of level i over all layers */
+static size_t
+level_size(const struct ktx *k, int i)
+{
+    size_t w = k->width >> i ? k->width >> i : 1;
+    size_t h = k->height >> i ? k->height >> i : 1;
+    size_t layer;
+    if (k->format->block_size)
+        layer = (w + 3) / 4 * ((h + 3) / 4) * k->format->block_size;
+    else
+        layer = w * h * 4;
+    return layer * k->layers;
+}
+
+/* Level data must cover every block of every layer */
+static int
+sizes_valid(const struct ktx *k)
+{
+    if (k->width < 1 || k->height < 1 || k->width > 1 << 16 ||
+        k->height > 1 << 16 || k->layers > 2048)
+        return 0;
+    for (int i = 0; i < k->levels; i++)
+        if (k->level[i].size < level_size(k, i))
+            return 0;
+    return 1;
+}
+
+int
+ktx_open(struct ktx *k, const char *path)
+{
+    memset(k, 0, sizeof(*k));
+    if (mapfile_open(&k->file, path))
+        return -1;
+    const unsigned char *p = k->file.data;
+    size_t size = k->file.size;
+    int r = -1;
+    if (size >= 12 && !memcmp(p, KTX1_ID, 12))
+        r = parse_ktx1(k, p, size);
+    else if (size >= 12 && !memcmp(p, KTX2_ID, 12))
+        r = parse_ktx2(k, p, size);
+    if (r || !sizes_valid(k)) {
+        mapfile_close(&k->file);
+        errno = EINVAL;
+        return -1;
+    }
+    return 0;
+}
+
+int
+ktx_native(const struct ktx *k)
+{
+    return k->format->native();
+}
+
+/* Block decoders. Each writes a 4x4 block of RGBA8 to dst, a row
+ * being stride bytes apart.
+ */
+
+static void
+rgb565(uint16_t c, unsigned char *rgb)
+{
+    int r = c >> 11 & 31;
+    int g = c >> 5 & 63;
+    int b = c & 31;
+    rgb[0] = r << 3 | r >> 2;
+    rgb[1] = g << 2 | g >> 4;
+    rgb[2] = b << 3 | b >> 2;
+}
+
+/* BC1 blocks with c0 <= c1 have three colors and a fourth that's black,
+ * or transparent with alpha. BC2 and BC3 always use four colors.
+ */
+enum bc1_mode {BC1_FOUR, BC1_BLACK, BC1_ALPHA};
+
+static void
+decode_bc1(const unsigned char *src, unsigned char *dst, size_t stride,
+           enum bc1_mode mode)
+{
+    uint16_t c0 = src[0] | src[1] << 8;
+    uint16_t c1 = src[2] | src[3] << 8;
+    uint32_t bits = u32(src + 4);
+    unsigned char palette[4][4];
+    rgb565(c0, palette[0]);
+    rgb565(c1, palette[1]);
+    for (int i = 0; i < 3; i++) {
+        int a = palette[0][i];
+        int b = palette[1][i];
+        if (c0 > c1 || mode == BC1_FOUR) {
+            palette[2][i] = (2 * a + b) / 3;
+            palette[3][i] = (a + 2 * b) / 3;
+        } else {
+            palette[2][i] = (a + b) / 2;
+            palette[3][i] = 0;
+        }
+    }
+    palette[0][3] = palette[1][3] = palette[2][3] = palette[3][3] = 0xff;
+    if (c0 <= c1 && mode == BC1_ALPHA)
+        palette[3][3] = 0;
+    for (int y = 0; y < 4; y++)
+        for (int x = 0; x < 4; x++)
+            memcpy(dst + y * stride + x * 4,
+                   palette[bits >> (2 * (y * 4 + x)) & 3], 4);
+}
+
+static void
+decode_bc2(const unsigned char *src, unsigned char *dst, size_t stride)
+{
+    decode_bc1(src + 8, dst, stride, BC1_FOUR);
+    for (int i = 0; i < 16; i++) {
+        int a = src[i / 2] >> (i % 2 * 4) & 15;
+        dst[i / 4 * stride + i % 4 * 4 + 3] = a * 17;
+    }
+}
+
+static void
+decode_bc3(const unsigned char *src, unsigned char *dst, size_t stride)
+{
+    decode_bc1(src + 8, dst, stride, BC1_FOUR);
+    int a0 = src[0];
+    int a1 = src[1];
+    int alpha[8] = {a0, a1};
+    if (a0 > a1) {
+        for (int i = 1; i < 7; i++)
+            alpha[i + 1] = ((7 - i) * a0 + i * a1) / 7;
+    } else {
+        for (int i = 1; i < 5; i++)
+            alpha[i + 1] = ((5 - i) * a0 + i * a1) / 5;
+        alpha[6] = 0;
+        alpha[7] = 255;
+    }
+    uint64_t bits = 0;
+    for (int i = 0; i < 6; i++)
+        bits |= (uint64_t) src[2 + i] << (8 * i);
+    for (int i = 0; i < 16; i++)
+        dst[i / 4 * stride + i % 4 * 4 + 3] = alpha[bits >> (3 * i) & 7];
+}
+
+static const int etc_modifiers[8][2] = {
+    {2, 8}, {5, 17}, {9, 29}, {13, 42},
+    {18, 60}, {24, 80}, {33, 106}, {47, 183},
+};
+
+static const int etc_distances[8] = {3, 6, 11, 16, 23, 32, 41, 64};
+
+static int
+clamp255(int v)
+{
+    return v < 0 ? 0 : v > 255 ? 255 : v;
+}
+
+static uint64_t
+be64(const unsigned char *p)
+{
+    uint64_t v = 0;
+    for (int i = 0; i < 8; i++)
+        v = v << 8 | p[i];
+    return v;
+}
+
+#define BITS(v, hi, lo) ((int) ((v) >> (lo) & ((1u << ((hi) - (lo) + 1)) - 1)))
+
+static int
+extend4(int v)
+{
+    return v << 4 | v;
+}
+
+static int
+extend5(int v)
+{
+    return v << 3 | v >> 2;
+}
+
+/* Writes the four paint colors of the T and H modes. */
+static void
+etc2_paint(unsigned char paint[4][4], const int c1[3], const int c2[3],
+           int d, int h_mode)
+{
+    for (int i = 0; i < 3; i++) {
+        if (h_mode) {
+            paint[0][i] = clamp255(c1[i] + d);
+            paint[1][i] = clamp255(c1[i] - d);
+            paint[2][i] = clamp255(c2[i] + d);
+            paint[3][i] = clamp255(c2[i] - d);
+        } else {
+            paint[0][i] = c1[i];
+            paint[1][i] = clamp255(c2[i] + d);
+            paint[2][i] = c2[i];
+            paint[3][i] = clamp255(c2[i] - d);
+        }
+    }
+}
+
+/* ETC2 RGB, including its T, H and planar modes. With punchthrough
+ * alpha, bit 33 is the opaque flag instead of the differential flag.
+ */
+static void
+decode_etc2(const unsigned char *src, unsigned char *dst, size_t stride,
+            int punchthrough)
+{
+    uint64_t v = be64(src);
+    int diff = punchthrough || BITS(v, 33, 33);
+    int opaque = !punchthrough || BITS(v, 33, 33);
+    int flip = BITS(v, 32, 32);
+    uint32_t idx = (uint32_t) v;
+    int base[2][3];
+
+    for (int y = 0; y < 4; y++)
+        for (int x = 0; x < 4; x++)
+            dst[y * stride + x * 4 + 3] = 0xff;
+
+    if (!diff) {
+        for (int i = 0; i < 3; i++) {
+            base[0][i] = extend4(BITS(v, 63 - i * 8, 60 - i * 8));
+            base[1][i] = extend4(BITS(v, 59 - i * 8, 56 - i * 8));
+        }
+    } else {
+        int overflow = -1;
+        for (int i = 0; i < 3; i++) {
+            int c = BITS(v, 63 - i * 8, 59 - i * 8);
+            int d = BITS(v, 58 - i * 8, 56 - i * 8);
+            d = d >= 4 ? d - 8 : d;
+            if (overflow < 0 && (c + d < 0 || c + d > 31))
+                overflow = i;
+            base[0][i] = extend5(c);
+            base[1][i] = extend5(c + d);
+        }
+        if (overflow == 0 || overflow == 1) {
+            /* T and H modes: two colors and a distance */
+            int c1[3], c2[3], d;
+            int h_mode = overflow == 1;
+            if (!h_mode) {
+                c1[0] = BITS(v, 60, 59) << 2 | BITS(v, 57, 56);
+                c1[1] = BITS(v, 55, 52);
+                c1[2] = BITS(v, 51, 48);
+                c2[0] = BITS(v, 47, 44);
+                c2[1] = BITS(v, 43, 40);
+                c2[2] = BITS(v, 39, 36);
+                d = BITS(v, 35, 34) << 1 | BITS(v, 32, 32);
+            } else {
+                c1[0] = BITS(v, 62, 59);
+                c1[1] = BITS(v, 58, 56) << 1 | BITS(v, 52, 52);
+                c1[2] = BITS(v, 51, 51) << 3 | BITS(v, 49, 47);
+                c2[0] = BITS(v, 46, 43);
+                c2[1] = BITS(v, 42, 39);
+                c2[2] = BITS(v, 38, 35);
+                int k1 = c1[0] << 8 | c1[1] << 4 | c1[2];
+                int k2 = c2[0] << 8 | c2[1] << 4 | c2[2];
+                d = BITS(v, 34, 34) << 2 | BITS(v, 32, 32) << 1 | (k1 >= k2);
+            }
+            for (int i = 0; i < 3; i++) {
+                c1[i] = extend4(c1[i]);
+                c2[i] = extend4(c2[i]);
+            }
+            unsigned char paint[4][4];
+            etc2_paint(paint, c1, c2, etc_distances[d], h_mode);
+            for (int y = 0; y < 4; y++) {
+                for (int x = 0; x < 4; x++) {
+                    int i = x * 4 + y;
+                    int p = (idx >> (i + 16) & 1) << 1 | (idx >> i & 1);
+                    unsigned char *out = dst + y * stride + x * 4;
+                    if (!opaque && p == 2) {
+                        memset(out, 0, 4);
+                    } else {
+                        memcpy(out, paint[p], 3);
+                    }
+                }
+            }
+            return;
+        }
+        if (overflow == 2) {
+            /* Planar mode: a gradient from three colors */
+            int o[3], h[3], w[3];
+            o[0] = BITS(v, 62, 57);
+            o[1] = BITS(v, 56, 56) << 6 | BITS(v, 54, 49);
+            o[2] = BITS(v, 48, 48) << 5 | BITS(v, 44, 43) << 3 |
+                   BITS(v, 41, 39);
+            h[0] = BITS(v, 38, 34) << 1 | BITS(v, 32, 32);
+            h[1] = BITS(v, 31, 25);
+            h[2] = BITS(v, 24, 19);
+            w[0] = BITS(v, 18, 13);
+            w[1] = BITS(v, 12, 6);
+            w[2] = BITS(v, 5, 0);
+            static const int bits[3] = {6, 7, 6};
+            for (int i = 0; i < 3; i++) {
+                int n = bits[i];
+                o[i] = o[i] << (8 - n) | o[i] >> (2 * n - 8);
+                h[i] = h[i] << (8 - n) | h[i] >> (2 * n - 8);
+                w[i] = w[i] << (8 - n) | w[i] >> (2 * n - 8);
+            }
+            for (int y = 0; y < 4; y++) {
+                for (int x = 0; x < 4; x++) {
+                    unsigned char *out = dst + y * stride + x * 4;
+                    for (int i = 0; i < 3; i++)
+                        out[i] = clamp255((x * (h[i] - o[i]) +
+                                           y * (w[i] - o[i]) +
+                                           4 * o[i] + 2) >> 2);
+                }
+            }
+            return;
+        }
+    }
+
+    int table[2] = {BITS(v, 39, 37), BITS(v, 36, 34)};
+    for (int y = 0; y < 4; y++) {
+        for (int x = 0; x < 4; x++) {
+            int sub = flip ? y >= 2 : x >= 2;
+            int i = x * 4 + y;
+            int msb = idx >> (i + 16) & 1;
+            int lsb = idx >> i & 1;
+            unsigned char *out = dst + y * stride + x * 4;
+            if (!opaque && msb && !lsb) {
+                memset(out, 0, 4);
+                continue;
+            }
+            int m = etc_modifiers[table[sub]][lsb];
+            if (!opaque && !lsb)
+                m = 0;
+            if (msb)
+                m = -m;
+            for (int c = 0; c < 3; c++)
+                out[c] = clamp255(base[sub][c] + m);
+        }
+    }
+}
+
+static const int eac_modifiers[16][8] = {
+    {-3, -6, -9, -15, 2, 5, 8, 14},
+    {-3, -7, -10, -13, 2, 6, 9, 12},
+    {-2, -5, -8, -13, 1, 4, 7, 12},
+    {-2, -4, -6, -13, 1, 3, 5, 12},
+    {-3, -6, -8, -12, 2, 5, 7, 11},
+    {-3, -7, -9, -11, 2, 6, 8, 10},
+    {-4, -7, -8, -11, 3, 6, 7, 10},
+    {-3, -5, -8, -11, 2, 4, 7, 10},
+    {-2, -6, -8, -10, 1, 5, 7, 9},
+    {-2, -5, -8, -10, 1, 4, 7, 9},
+    {-2, -4, -8, -10, 1, 3, 7, 9},
+    {-2, -5, -7, -10, 1, 4, 6, 9},
+    {-3, -4, -7, -10, 2, 3, 6, 9},
+    {-1, -2, -3, -10, 0, 1, 2, 9},
+    {-4, -6, -8, -9, 3, 5, 7, 8},
+    {-3, -5, -7, -9, 2, 4, 6, 8},
+};
+
+static void
+decode_eac_alpha(const unsigned char *src, unsigned char *dst, size_t stride)
+{
+    uint64_t v = be64(src);
+    int base = BITS(v, 63, 56);
+    int mul = BITS(v, 55, 52);
+    const int *table = eac_modifiers[BITS(v, 51, 48)];
+    for (int y = 0; y < 4; y++) {
+        for (int x = 0; x < 4; x++) {
+            int i = x * 4 + y;
+            int m = table[v >> (45 - 3 * i) & 7];
+            dst[y * stride + x * 4 + 3] = clamp255(base + m * mul);
+        }
+    }
+}
+
+static void
+decode_block(enum decoder decoder, const unsigned char *src,
+             unsigned char *dst, size_t stride)
+{
+    switch (decoder) {
+        case DECODE_NONE:
+            break;
+        case DECODE_BC1:
+            decode_bc1(src, dst, stride, BC1_BLACK);
+            break;
+        case DECODE_BC1A:
+            decode_bc1(src, dst, stride, BC1_ALPHA);
+            break;
+        case DECODE_BC2:
+            decode_bc2(src, dst, stride);
+            break;
+        case DECODE_BC3:
+            decode_bc3(src, dst, stride);
+            break;
+        case DECODE_ETC2:
+            decode_etc2(src, dst, stride, 0);
+            break;
+        case DECODE_ETC2A1:
+            decode_etc2(src, dst, stride, 1);
+            break;
+        case DECODE_ETC2_EAC:
+            decode_etc2(src + 8, dst, stride, 0);
+            decode_eac_alpha(src, dst, stride);
+            break;
+    }
+}
+
+struct decode_job {
+    const struct ktx_format *format;
+    const unsigned char *src;
+    unsigned char *dst;
+    int width;
+    int height;
+    int rows;  /* block rows per layer */
+};
+
+/* One job index is one row of blocks of one layer. Edge blocks are
+ * decoded to scratch and clipped.
+ */
+static void
+decode_row(void *arg, size_t index)
+{
+    const struct decode_job *job = arg;
+    int layer = index / job->rows;
+    int by = index % job->rows;
+    int cols = (job->width + 3) / 4;
+    size_t stride = (size_t) job->width * 4;
+    const unsigned char *src = job->src +
+        (index * cols) * job->format->block_size;
+    unsigned char *layer_dst = job->dst +
+        (size_t) layer * job->height * stride;
+    for (int bx = 0; bx < cols; bx++) {
+        unsigned char block[4 * 4 * 4];
+        decode_block(job->format->decoder, src, block, 16);
+        src += job->format->block_size;
+        int w = job->width - bx * 4 < 4 ? job->width - bx * 4 : 4;
+        int h = job->height - by * 4 < 4 ? job->height - by * 4 : 4;
+        for (int y = 0; y < h; y++)
+            memcpy(layer_dst + (by * 4 + y) * stride + bx * 16,
+                   block + y * 16, w * 4);
+    }
+}
+
+GLuint
+ktx_upload(const struct ktx *k)
+{
+    const struct ktx_format *f = k->format;
+    int native = f->native();
+    if (!native && f->decoder == DECODE_NONE)
+        return 0;
+
+    GLuint texture;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    unsigned char *rgba = NULL;
+    for (int i = 0; i < k->levels; i++) {
+        int w = k->width >> i ? k->width >> i : 1;
+        int h = k->height >> i ? k->height >> i : 1;
+        if (native && f->block_size) {
+            glCompressedTexImage3D(GL_TEXTURE_2D_ARRAY, i, f->internal,
+                                   w, h, k->layers, 0, level_size(k, i),
+                                   k->level[i].data);
+        } else if (native) {
+            glTexImage3D(GL_TEXTURE_2D_ARRAY, i, f->internal, w, h,
+                         k->layers, 0, k->gl_format, k->gl_type,
+                         k->level[i].data);
+        } else {
+            /* Levels only shrink, so the first buffer fits them all */
+            if (!rgba)
+                rgba = malloc((size_t) w * h * k->layers * 4);
+            if (!rgba) {
+                glDeleteTextures(1, &texture);
+                texture = 0;
+                break;
+            }
+            struct decode_job job = {f, k->level[i].data, rgba, w, h,
+                                     (h + 3) / 4};
+            jobs_run(decode_row, &job, (size_t) job.rows * k->layers);
+            glTexImage3D(GL_TEXTURE_2D_ARRAY, i,
+                         f->srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8,
+                         w, h, k->layers, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                         rgba);
+        }
+    }
+    free(rgba);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    if (texture) {
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL,
+                        k->levels - 1);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER,
+                        k->levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER,
+                        GL_LINEAR);
+    }
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    return texture;
+}
+
+void
+ktx_close(struct ktx *k)
+{
+    mapfile_close(&k->file);
+}
@@ -0,0 +1,48 @@
+#ifndef KTX_H
+#define KTX_H
+
+#include <stddef.h>
+#include <GL/gl3w.h>
+
+#include "mapfile.h"
+
+#define KTX_MAX_LEVELS 16
+
+/* A KTX or KTX2 file, mapped. Only 2D textures and 2D arrays are
+ * accepted, without supercompression.
+ */
+struct ktx {
+    struct mapfile file;
+    const struct ktx_format *format;
+    GLenum gl_format;   /* uncompressed KTX1 only */
+    GLenum gl_type;
+    int width;
+    int height;
+    int layers;
+    int levels;
+    struct {
+        const void *data;
+        size_t size;    /* all layers */
+    } level[KTX_MAX_LEVELS];
+};
+
+/* Returns 0, or -1 with errno set: EINVAL for anything this loader
+ * doesn't accept.
+ */
+int ktx_open(struct ktx *, const char *path);
+
+/* True if the format can go to the driver as it is. Otherwise it's
+ * decompressed on the CPU when uploaded, if a decoder exists.
+ */
+int ktx_native(const struct ktx *);
+
+/* Uploads every level into a new GL_TEXTURE_2D_ARRAY. Native formats
+ * are passed straight from the mapping to glCompressedTexImage3D;
+ * others are decompressed to RGBA8 in parallel on the job pool.
+ * Returns 0 if the format is neither native nor decodable.
+ */
+GLuint ktx_upload(const struct ktx *);
+
+void ktx_close(struct ktx *);
+
+#endif
@@ -0,0 +1,96 @@
+/* Generated by gl3w_gen.py --manifest from demo.c shader.c debug.c mesh.c drawlist.c cull.c gpucull.c sprite.c atlas.c stream.c ktx.c jobs.c mipmap.c hud.c particle.c cpuparticle.c dynres.c aa.c targetpool.c graph.c */
+
+static const char *const gl3w_manifest[] = {
+    "glAttachShader",
+    "glBeginQuery",
+    "glBeginTransformFeedback",
+    "glBindBuffer",
+    "glBindBufferBase",
+    "glBindFramebuffer",
+    "glBindRenderbuffer",
+    "glBindTexture",
+    "glBindVertexArray",
+    "glBlendFunc",
+    "glBlitFramebuffer",
+    "glBufferData",
+    "glBufferStorage",
+    "glBufferSubData",
+    "glCheckFramebufferStatus",
+    "glClear",
+    "glClearColor",
+    "glClientWaitSync",
+    "glCompileShader",
+    "glCompressedTexImage3D",
+    "glCreateProgram",
+    "glCreateShader",
+    "glDebugMessageCallback",
+    "glDebugMessageControl",
+    "glDeleteBuffers",
+    "glDeleteFramebuffers",
+    "glDeleteProgram",
+    "glDeleteQueries",
+    "glDeleteRenderbuffers",
+    "glDeleteShader",
+    "glDeleteSync",
+    "glDeleteTextures",
+    "glDeleteVertexArrays",
+    "glDisable",
+    "glDrawArrays",
+    "glDrawArraysInstanced",
+    "glDrawElements",
+    "glDrawElementsInstancedBaseVertex",
+    "glEnable",
+    "glEnableVertexAttribArray",
+    "glEndQuery",
+    "glEndTransformFeedback",
+    "glFenceSync",
+    "glFinish",
+    "glFlush",
+    "glFramebufferRenderbuffer",
+    "glFramebufferTexture2D",
+    "glGenBuffers",
+    "glGenFramebuffers",
+    "glGenQueries",
+    "glGenRenderbuffers",
+    "glGenTextures",
+    "glGenVertexArrays",
+    "glGetIntegerv",
+    "glGetProgramBinary",
+    "glGetProgramInfoLog",
+    "glGetProgramiv",
+    "glGetQueryObjectui64v",
+    "glGetQueryObjectuiv",
+    "glGetShaderInfoLog",
+    "glGetShaderiv",
+    "glGetString",
+    "glGetUniformLocation",
+    "glLinkProgram",
+    "glMapBufferRange",
+    "glMultiDrawArrays",
+    "glMultiDrawArraysIndirect",
+    "glMultiDrawElementsBaseVertex",
+    "glMultiDrawElementsIndirect",
+    "glPixelStorei",
+    "glPointSize",
+    "glProgramBinary",
+    "glProgramParameteri",
+    "glQueryCounter",
+    "glRenderbufferStorageMultisample",
+    "glShaderSource",
+    "glTexImage2D",
+    "glTexImage3D",
+    "glTexParameteri",
+    "glTexSubImage3D",
+    "glTransformFeedbackVaryings",
+    "glUniform1f",
+    "glUniform1ui",
+    "glUniform2f",
+    "glUniform2fv",
+    "glUniform4fv",
+    "glUnmapBuffer",
+    "glUseProgram",
+    "glVertexAttribDivisor",
+    "glVertexAttribPointer",
+    "glViewport",
+    NULL
+};
@@ -0,0 +1,97 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include "mapfile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <errno.h>
+
+int
+mapfile_open(struct mapfile *m, const char *path)
+{
+    m->data = NULL;
+    m->size = 0;
+    m->mapping = NULL;
+    m->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL,
+                          OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (m->file == INVALID_HANDLE_VALUE) {
+        errno = ENOENT;
+        return -1;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(m->file, &size)) {
+        CloseHandle(m->file);
+        errno = EIO;
+        return -1;
+    }
+    m->size = size.QuadPart;
+    if (m->size) {
+        m->mapping = CreateFileMappingA(m->file, NULL, PAGE_READONLY,
+                                        0, 0, NULL);
+        if (m->mapping)
+            m->data = MapViewOfFile(m->mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!m->data) {
+            if (m->mapping)
+                CloseHandle(m->mapping);
+            CloseHandle(m->file);
+            errno = ENOMEM;
+            return -1;
+        }
+    }
+    return 0;
+}
+
+void
+mapfile_close(struct mapfile *m)
+{
+    if (m->data)
+        UnmapViewOfFile(m->data);
+    if (m->mapping)
+        CloseHandle(m->mapping);
+    CloseHandle(m->file);
+    m->data = NULL;
+}
+
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+int
+mapfile_open(struct mapfile *m, const char *path)
+{
+    m->data = NULL;
+    m->size = 0;
+    int fd = open(path, O_RDONLY);
+    if (fd == -1)
+        return -1;
+    struct stat st;
+    if (fstat(fd, &st) == -1) {
+        close(fd);
+        return -1;
+    }
+    m->size = st.st_size;
+    if (m->size) {
+        void *p = mmap(NULL, m->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) {
+            close(fd);
+            return -1;
+        }
+        m->data = p;
+    }
+    close(fd);  /* the mapping keeps the file open */
+    return 0;
+}
+
+void
+mapfile_close(struct mapfile *m)
+{
+    if (m->data)
+        munmap((void *) m->data, m->size);
+    m->data = NULL;
+}
+#endif
@@ -0,0 +1,20 @@
+#ifndef MAPFILE_H
+#define MAPFILE_H
+
+#include <stddef.h>
+
+/* A read-only file mapped into memory in its entirety. */
+struct mapfile {
+    const void *data;
+    size_t size;
+#ifdef _WIN32
+    void *file;
+    void *mapping;
+#endif
+};
+
+/* Returns 0 on success, or -1 with errno describing the failure. */
+int mapfile_open(struct mapfile *, const char *path);
+void mapfile_close(struct mapfile *);
+
+#endif
@@ -0,0 +1,186 @@
+#include <errno.h>
+#include <limits.h>
+#include <string.h>
+
+#include "mesh.h"
+
+#define MAX_LOCATIONS 16  /* GL_MAX_VERTEX_ATTRIBS is at least this */
+
+static int
+blob_valid(const struct mesh *m, uint64_t offset, uint64_t size)
+{
+    return offset % MESH_ALIGN == 0 &&
+           offset <= m->file.size &&
+           size <= m->file.size - offset;
+}
+
+/* Whether glVertexAttribPointer() accepts the attribute and it lies
+ * within one vertex.
+ */
+static int
+attrib_valid(const struct mesh_attrib *a, uint32_t stride)
+{
+    uint64_t size;
+    switch (a->type) {
+        case GL_BYTE:
+        case GL_UNSIGNED_BYTE:  size = 1; break;
+        case GL_SHORT:
+        case GL_UNSIGNED_SHORT:
+        case GL_HALF_FLOAT:     size = 2; break;
+        case GL_INT:
+        case GL_UNSIGNED_INT:
+        case GL_FLOAT:          size = 4; break;
+        case GL_DOUBLE:         size = 8; break;
+        case GL_INT_2_10_10_10_REV:
+        case GL_UNSIGNED_INT_2_10_10_10_REV:
+            /* Four components packed in one word */
+            if (a->size != 4)
+                return 0;
+            size = 1;
+            break;
+        default:
+            return 0;
+    }
+    return a->location < MAX_LOCATIONS &&
+           a->size >= 1 && a->size <= 4 &&
+           a->offset + size * a->size <= stride;
+}
+
+static int
+header_valid(const struct mesh *m)
+{
+    const struct mesh_header *h = m->header;
+    if (h->magic != MESH_MAGIC || h->version != MESH_VERSION ||
+        h->attrib_count > MESH_MAX_ATTRIBS)
+        return 0;
+    if (h->vertex_count > INT_MAX || h->index_count > INT_MAX)
+        return 0;  /* draw counts are GLsizei */
+    if ((uint64_t) h->vertex_count * h->stride != h->vertex_size ||
+        !blob_valid(m, h->vertex_offset, h->vertex_size))
+        return 0;
+    for (uint32_t i = 0; i < h->attrib_count; i++)
+        if (!attrib_valid(h->attribs + i, h->stride))
+            return 0;
+    size_t index_size;
+    switch (h->index_type) {
+        case 0:                 index_size = 0; break;
+        case GL_UNSIGNED_SHORT: index_size = 2; break;
+        case GL_UNSIGNED_INT:   index_size = 4; break;
+        default:
+            return 0;
+    }
+    if ((uint64_t) h->index_count * index_size != h->index_size)
+        return 0;
+    return !h->index_size || blob_valid(m, h->index_offset, h->index_size);
+}
+
+/* Whether every index names a vertex. Drawing reads vertices through
+ * the indices, so one out of range would read past the vertex buffer.
+ * This is the one pass over the file's data before upload.
+ */
+static int
+indices_valid(const struct mesh *m)
+{
+    const struct mesh_header *h = m->header;
+    const char *base = m->file.data;
+    const void *indices = base + h->index_offset;
+    uint32_t max = 0;
+    if (h->index_type == GL_UNSIGNED_SHORT) {
+        const uint16_t *p = indices;
+        for (uint32_t i = 0; i < h->index_count; i++)
+            if (p[i] > max)
+                max = p[i];
+    } else {
+        const uint32_t *p = indices;
+        for (uint32_t i = 0; i < h->index_count; i++)
+            if (p[i] > max)
+                max = p[i];
+    }
+    return !h->index_count || max < h->vertex_count;
+}
+
+int
+mesh_open(struct mesh *m, const char *path)
+{
+    if (mapfile_open(&m->file, path))
+        return -1;
+    m->header = m->file.data;
+    if (m->file.size < sizeof(*m->header) || !header_valid(m) ||
+        (m->header->index_size && !indices_valid(m))) {
+        mapfile_close(&m->file);
+        errno = EINVAL;
+        return -1;
+    }
+    const char *base = m->file.data;
+    m->vertices = base + m->header->vertex_offset;
+    m->indices = m->header->index_size ? base + m->header->index_offset : NULL;
+    return 0;
+}
+
+void
+mesh_close(struct mesh *m)
+{
+    mapfile_close(&m->file);
+}
+
+/* The mapped pages are read by the driver during the call, faulting
+ * them in from the file as needed: there is no staging copy.
+ */
+static void
+buffer_upload(GLenum target, GLsizeiptr size, const void *data)
+{
+    if (gl3wIsSupported(4, 4) || gl3wHasExt(GL3W_ARB_buffer_storage))
+        glBufferStorage(target, size, data, 0);
+    else
+        glBufferData(target, size, data, GL_STATIC_DRAW);
+}
+
+void
+mesh_upload(const struct mesh *m, struct mesh_gl *gl)
+{
+    const struct mesh_header *h = m->header;
+    glGenVertexArrays(1, &gl->vao);
+    glBindVertexArray(gl->vao);
+
+    glGenBuffers(1, &gl->vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, gl->vbo);
+    buffer_upload(GL_ARRAY_BUFFER, h->vertex_size, m->vertices);
+    for (uint32_t i = 0; i < h->attrib_count; i++) {
+        const struct mesh_attrib *a = h->attribs + i;
+        glVertexAttribPointer(a->location, a->size, a->type, a->normalized,
+                              h->stride, (void *) (uintptr_t) a->offset);
+        glEnableVertexAttribArray(a->location);
+    }
+
+    gl->ibo = 0;
+    gl->index_type = h->index_type;
+    gl->count = h->index_type ? h->index_count : h->vertex_count;
+    if (h->index_type) {
+        /* Element array binding is VAO state: no unbind here */
+        glGenBuffers(1, &gl->ibo);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, gl->ibo);
+        buffer_upload(GL_ELEMENT_ARRAY_BUFFER, h->index_size, m->indices);
+    }
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void
+mesh_draw(const struct mesh_gl *gl)
+{
+    glBindVertexArray(gl->vao);
+    if (gl->index_type)
+        glDrawElements(GL_TRIANGLES, gl->count, gl->index_type, 0);
+    else
+        glDrawArrays(GL_TRIANGLES, 0, gl->count);
+    glBindVertexArray(0);
+}
+
+void
+mesh_gl_free(struct mesh_gl *gl)
+{
+    glDeleteVertexArrays(1, &gl->vao);
+    glDeleteBuffers(1, &gl->vbo);
+    if (gl->ibo)
+        glDeleteBuffers(1, &gl->ibo);
+}
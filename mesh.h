@@ -0,0 +1,83 @@
+#ifndef MESH_H
+#define MESH_H
+
+#include <stdint.h>
+#include <GL/gl3w.h>
+
+#include "mapfile.h"
+
+/* Binary mesh container, little-endian. A fixed header describes one
+ * interleaved vertex blob and an optional index blob. Both blobs start
+ * on a MESH_ALIGN boundary, so their mapped pages can be handed to the
+ * driver as they are, without parsing or copying.
+ */
+#define MESH_MAGIC       0x4853454dUL  /* "MESH" */
+#define MESH_VERSION     1
+#define MESH_ALIGN       4096
+#define MESH_MAX_ATTRIBS 8
+
+/* Header flags */
+#define MESH_QUANTIZED 1  /* positions normalized to bounds */
+
+/* Attribute locations written by meshconv */
+#define MESH_POSITION 0
+#define MESH_COLOR    2
+#define MESH_NORMAL   3
+#define MESH_TEXCOORD 4
+
+struct mesh_attrib {
+    uint32_t location;
+    uint32_t size;        /* components */
+    uint32_t type;        /* GL_FLOAT, GL_HALF_FLOAT, ... */
+    uint32_t normalized;
+    uint32_t offset;      /* within a vertex */
+};
+
+struct mesh_header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t vertex_count;
+    uint32_t stride;
+    uint32_t index_count;
+    uint32_t index_type;  /* GL_UNSIGNED_SHORT, GL_UNSIGNED_INT, or 0 */
+    uint32_t attrib_count;
+    uint32_t flags;
+    uint64_t vertex_offset;
+    uint64_t vertex_size;
+    uint64_t index_offset;
+    uint64_t index_size;
+    float bounds[2][3];   /* min, max position */
+    struct mesh_attrib attribs[MESH_MAX_ATTRIBS];
+};
+
+struct mesh {
+    struct mapfile file;
+    const struct mesh_header *header;
+    const void *vertices;
+    const void *indices;
+};
+
+/* Vertex array and buffers of an uploaded mesh. */
+struct mesh_gl {
+    GLuint vao;
+    GLuint vbo;
+    GLuint ibo;
+    GLsizei count;
+    GLenum index_type;
+};
+
+/* Maps and validates a mesh file: the header, every attribute against
+ * the stride, and every index against the vertex count. Returns 0, or
+ * -1 with errno set.
+ */
+int mesh_open(struct mesh *, const char *path);
+void mesh_close(struct mesh *);
+
+/* Uploads straight from the mapped file into immutable storage when
+ * available, otherwise into GL_STATIC_DRAW buffers.
+ */
+void mesh_upload(const struct mesh *, struct mesh_gl *);
+void mesh_draw(const struct mesh_gl *);
+void mesh_gl_free(struct mesh_gl *);
+
+#endif
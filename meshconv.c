@@ -0,0 +1,382 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <getopt.h>
+
+#include "mesh.h"
+#include "vformat.h"
+#include "vcache.h"
+
+#define ACMR_FIFO 16
+
+/* Converts a Wavefront OBJ file into the binary mesh format. Faces are
+ * triangulated as fans, and each distinct position/texcoord/normal
+ * triple becomes one vertex. Vertex colors given as "v x y z r g b"
+ * are kept. With -c, attributes are stored compressed: positions as
+ * normalized shorts relative to the mesh bounds, normals and colors as
+ * packed 10-10-10-2 integers, and texcoords as half floats. Triangles
+ * are reordered for the post-transform vertex cache and vertices for
+ * fetch locality, unless -n is given.
+ */
+
+struct array {
+    void *data;
+    size_t len;
+    size_t cap;
+};
+
+static void *
+push(struct array *a, size_t size)
+{
+    if (a->len == a->cap) {
+        a->cap = a->cap ? a->cap * 2 : 1024;
+        a->data = realloc(a->data, a->cap * size);
+        if (!a->data) {
+            fprintf(stderr, "meshconv: out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    return (char *) a->data + a->len++ * size;
+}
+
+/* Position, texcoord and normal indices, 0 for none */
+struct ref {
+    long v, vt, vn;
+};
+
+struct vertex_table {
+    uint32_t *slots;  /* vertex index plus one, 0 for empty */
+    size_t mask;
+    struct array vertices;
+};
+
+static uint32_t
+intern(struct vertex_table *t, struct ref r)
+{
+    if (t->vertices.len * 2 >= t->mask + 1) {
+        size_t size = (t->mask + 1) * 2;
+        uint32_t *slots = calloc(size, sizeof(*slots));
+        if (!slots) {
+            fprintf(stderr, "meshconv: out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+        free(t->slots);
+        t->slots = slots;
+        t->mask = size - 1;
+        struct ref *refs = t->vertices.data;
+        for (size_t i = 0; i < t->vertices.len; i++) {
+            struct ref *e = refs + i;
+            size_t h = (e->v * 31 + e->vt) * 31 + e->vn;
+            while (t->slots[h & t->mask])
+                h++;
+            t->slots[h & t->mask] = i + 1;
+        }
+    }
+    size_t h = (r.v * 31 + r.vt) * 31 + r.vn;
+    struct ref *refs = t->vertices.data;
+    for (;; h++) {
+        uint32_t slot = t->slots[h & t->mask];
+        if (!slot)
+            break;
+        struct ref *e = refs + slot - 1;
+        if (e->v == r.v && e->vt == r.vt && e->vn == r.vn)
+            return slot - 1;
+    }
+    *(struct ref *) push(&t->vertices, sizeof(r)) = r;
+    t->slots[h & t->mask] = t->vertices.len;
+    return t->vertices.len - 1;
+}
+
+/* One attribute, gathered as floats before encoding */
+struct stream {
+    uint32_t location;
+    unsigned components;
+    enum vformat format;
+    const float *data;
+};
+
+/* Resolves a 1-based or negative (relative) OBJ index. */
+static long
+resolve(long i, size_t count, long line)
+{
+    if (i < 0)
+        i += count + 1;
+    if (i < 1 || (size_t) i > count) {
+        fprintf(stderr, "meshconv: line %ld: index out of range\n", line);
+        exit(EXIT_FAILURE);
+    }
+    return i;
+}
+
+static void
+write_all(FILE *f, const void *data, size_t size, const char *path)
+{
+    if (size && fwrite(data, size, 1, f) != 1) {
+        fprintf(stderr, "meshconv: %s: %s\n", path, strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void
+pad_to(FILE *f, uint64_t offset, const char *path)
+{
+    static const char zero[MESH_ALIGN];
+    long pos = ftell(f);
+    write_all(f, zero, offset - pos, path);
+}
+
+int
+main(int argc, char **argv)
+{
+    bool compress = false;
+    bool optimize = true;
+    int opt;
+    while ((opt = getopt(argc, argv, "cn")) != -1) {
+        switch (opt) {
+            case 'c':
+                compress = true;
+                break;
+            case 'n':
+                optimize = false;
+                break;
+            default:
+                exit(EXIT_FAILURE);
+        }
+    }
+    if (argc - optind != 2) {
+        fprintf(stderr, "usage: meshconv [-c] [-n] in.obj out.mesh\n");
+        exit(EXIT_FAILURE);
+    }
+    argv += optind - 1;
+    FILE *in = fopen(argv[1], "r");
+    if (!in) {
+        fprintf(stderr, "meshconv: %s: %s\n", argv[1], strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    struct array positions = {0};  /* float[6], xyz rgb */
+    struct array texcoords = {0};  /* float[2] */
+    struct array normals = {0};    /* float[3] */
+    struct array indices = {0};    /* uint32_t */
+    struct vertex_table table = {.mask = 1023};
+    table.slots = calloc(table.mask + 1, sizeof(*table.slots));
+    int colors = -1;  /* unknown until the first position */
+
+    char buf[4096];
+    long line = 0;
+    while (fgets(buf, sizeof(buf), in)) {
+        line++;
+        float *f;
+        if (!strncmp(buf, "v ", 2)) {
+            f = push(&positions, sizeof(float[6]));
+            int n = sscanf(buf + 2, "%f %f %f %f %f %f",
+                           f, f + 1, f + 2, f + 3, f + 4, f + 5);
+            if (colors == -1)
+                colors = n == 6;
+            if (n < 3 || (colors && n != 6)) {
+                fprintf(stderr, "meshconv: line %ld: bad vertex\n", line);
+                exit(EXIT_FAILURE);
+            }
+        } else if (!strncmp(buf, "vt ", 3)) {
+            f = push(&texcoords, sizeof(float[2]));
+            f[1] = 0;
+            if (sscanf(buf + 3, "%f %f", f, f + 1) < 1) {
+                fprintf(stderr, "meshconv: line %ld: bad texcoord\n", line);
+                exit(EXIT_FAILURE);
+            }
+        } else if (!strncmp(buf, "vn ", 3)) {
+            f = push(&normals, sizeof(float[3]));
+            if (sscanf(buf + 3, "%f %f %f", f, f + 1, f + 2) != 3) {
+                fprintf(stderr, "meshconv: line %ld: bad normal\n", line);
+                exit(EXIT_FAILURE);
+            }
+        } else if (!strncmp(buf, "f ", 2)) {
+            uint32_t first = 0, prev = 0;
+            int n = 0;
+            for (char *tok = strtok(buf + 2, " \t\r\n"); tok;
+                 tok = strtok(NULL, " \t\r\n"), n++) {
+                struct ref r = {0, 0, 0};
+                char *p = tok;
+                r.v = resolve(strtol(p, &p, 10), positions.len, line);
+                if (*p == '/') {
+                    p++;
+                    if (*p != '/')
+                        r.vt = resolve(strtol(p, &p, 10), texcoords.len, line);
+                    if (*p == '/')
+                        r.vn = resolve(strtol(p + 1, &p, 10), normals.len, line);
+                }
+                uint32_t v = intern(&table, r);
+                if (n == 0)
+                    first = v;
+                if (n >= 2) {
+                    *(uint32_t *) push(&indices, sizeof(uint32_t)) = first;
+                    *(uint32_t *) push(&indices, sizeof(uint32_t)) = prev;
+                    *(uint32_t *) push(&indices, sizeof(uint32_t)) = v;
+                }
+                prev = v;
+            }
+        }
+    }
+    fclose(in);
+    if (!indices.len) {
+        fprintf(stderr, "meshconv: %s: no faces\n", argv[1]);
+        exit(EXIT_FAILURE);
+    }
+
+    /* Triangle order for the vertex cache, then vertex order for fetch */
+    uint32_t *index32 = indices.data;
+    size_t vertex_count = table.vertices.len;
+    double acmr = vcache_acmr(index32, indices.len, vertex_count, ACMR_FIFO);
+    if (optimize) {
+        uint32_t *remap = malloc(vertex_count * sizeof(*remap));
+        struct ref *refs = malloc(vertex_count * sizeof(*refs));
+        if (!remap || !refs ||
+            vcache_optimize(index32, indices.len, vertex_count)) {
+            fprintf(stderr, "meshconv: out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+        size_t used = vcache_fetch_remap(remap, index32, indices.len,
+                                         vertex_count);
+        /* Vertices only degenerate faces referred to are dropped */
+        const struct ref *old = table.vertices.data;
+        for (size_t i = 0; i < vertex_count; i++)
+            if (remap[i] != UINT32_MAX)
+                refs[remap[i]] = old[i];
+        free(table.vertices.data);
+        table.vertices.data = refs;
+        table.vertices.len = used;
+        vertex_count = used;
+        free(remap);
+    }
+    printf("ACMR (FIFO %d): %.3f -> %.3f\n", ACMR_FIFO, acmr,
+           vcache_acmr(index32, indices.len, vertex_count, ACMR_FIFO));
+
+    /* Gather one float stream per attribute */
+    struct mesh_header h = {
+        .magic = MESH_MAGIC,
+        .version = MESH_VERSION,
+        .vertex_count = table.vertices.len,
+        .index_count = indices.len,
+    };
+    size_t count = h.vertex_count;
+    float *data = calloc(count, sizeof(float[11]));
+    if (!data) {
+        fprintf(stderr, "meshconv: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    float *sp = data;
+    float *sc = sp + count * 3;
+    float *sn = sc + count * 3;
+    float *st = sn + count * 3;
+    const struct ref *refs = table.vertices.data;
+    const float (*pos)[6] = positions.data;
+    const float (*uv)[2] = texcoords.data;
+    const float (*nrm)[3] = normals.data;
+    for (int j = 0; j < 3; j++) {
+        h.bounds[0][j] = pos[refs[0].v - 1][j];
+        h.bounds[1][j] = pos[refs[0].v - 1][j];
+    }
+    for (size_t i = 0; i < count; i++) {
+        const float *p = pos[refs[i].v - 1];
+        for (int j = 0; j < 3; j++) {
+            h.bounds[0][j] = p[j] < h.bounds[0][j] ? p[j] : h.bounds[0][j];
+            h.bounds[1][j] = p[j] > h.bounds[1][j] ? p[j] : h.bounds[1][j];
+        }
+        memcpy(sp + i * 3, p, 12);
+        memcpy(sc + i * 3, p + 3, 12);
+        if (refs[i].vn)
+            memcpy(sn + i * 3, nrm[refs[i].vn - 1], 12);
+        if (refs[i].vt)
+            memcpy(st + i * 2, uv[refs[i].vt - 1], 8);
+    }
+
+    /* Compressed positions are normalized to their bounds */
+    if (compress) {
+        h.flags |= MESH_QUANTIZED;
+        for (int j = 0; j < 3; j++) {
+            float center = (h.bounds[0][j] + h.bounds[1][j]) / 2;
+            float extent = (h.bounds[1][j] - h.bounds[0][j]) / 2;
+            float scale = extent > 0 ? 1 / extent : 0;
+            for (size_t i = 0; i < count; i++)
+                sp[i * 3 + j] = (sp[i * 3 + j] - center) * scale;
+        }
+    }
+
+    /* Vertex layout */
+    struct stream streams[MESH_MAX_ATTRIBS];
+    unsigned nstreams = 0;
+    streams[nstreams++] = (struct stream){
+        MESH_POSITION, 3, compress ? VFORMAT_SNORM16 : VFORMAT_FLOAT, sp};
+    if (colors == 1)
+        streams[nstreams++] = (struct stream){
+            MESH_COLOR, 3, compress ? VFORMAT_UNORM10 : VFORMAT_FLOAT, sc};
+    if (normals.len)
+        streams[nstreams++] = (struct stream){
+            MESH_NORMAL, 3, compress ? VFORMAT_SNORM10 : VFORMAT_FLOAT, sn};
+    if (texcoords.len)
+        streams[nstreams++] = (struct stream){
+            MESH_TEXCOORD, 2, compress ? VFORMAT_HALF : VFORMAT_FLOAT, st};
+    for (unsigned i = 0; i < nstreams; i++) {
+        struct mesh_attrib *a = h.attribs + i;
+        a->location = streams[i].location;
+        a->offset = h.stride;
+        vformat_attrib(streams[i].format, streams[i].components, a);
+        h.stride += vformat_size(streams[i].format, streams[i].components);
+    }
+    h.attrib_count = nstreams;
+
+    /* Encode and interleave */
+    unsigned char *vertices = calloc(count, h.stride);
+    if (!vertices) {
+        fprintf(stderr, "meshconv: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    for (unsigned i = 0; i < nstreams; i++)
+        vformat_encode(streams[i].format, streams[i].components,
+                       vertices + h.attribs[i].offset, h.stride,
+                       streams[i].data, count);
+    free(data);
+
+    /* 16-bit indices when they fit */
+    size_t index_size = h.vertex_count <= 0x10000 ? 2 : 4;
+    if (index_size == 2) {
+        uint16_t *index16 = (uint16_t *) index32;
+        for (uint32_t i = 0; i < h.index_count; i++)
+            index16[i] = index32[i];
+    }
+    h.index_type = index_size == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+    h.vertex_size = (uint64_t) h.vertex_count * h.stride;
+    h.index_size = (uint64_t) h.index_count * index_size;
+    h.vertex_offset = MESH_ALIGN;
+    h.index_offset = (h.vertex_offset + h.vertex_size + MESH_ALIGN - 1) /
+                     MESH_ALIGN * MESH_ALIGN;
+
+    FILE *f = fopen(argv[2], "wb");
+    if (!f) {
+        fprintf(stderr, "meshconv: %s: %s\n", argv[2], strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+    write_all(f, &h, sizeof(h), argv[2]);
+    pad_to(f, h.vertex_offset, argv[2]);
+    write_all(f, vertices, h.vertex_size, argv[2]);
+    pad_to(f, h.index_offset, argv[2]);
+    write_all(f, indices.data, h.index_size, argv[2]);
+    if (fclose(f)) {
+        fprintf(stderr, "meshconv: %s: %s\n", argv[2], strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+    printf("%s: %lu vertices, %lu triangles\n", argv[2],
+           (unsigned long) h.vertex_count,
+           (unsigned long) h.index_count / 3);
+
+    free(vertices);
+    free(positions.data);
+    free(texcoords.data);
+    free(normals.data);
+    free(indices.data);
+    free(table.vertices.data);
+    free(table.slots);
+    return 0;
+}
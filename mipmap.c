@@ -0,0 +1,298 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "mipmap.h"
+#include "jobs.h"
+
+#define BAND   16    /* rows per task */
+#define TAPS   8
+#define LINEAR 4096  /* entries in the linear to sRGB table */
+
+static float srgb_to_linear[256];
+static unsigned char linear_to_srgb[LINEAR];
+static float kaiser[TAPS];
+static pthread_once_t tables_once = PTHREAD_ONCE_INIT;
+
+static double
+bessel_i0(double x)
+{
+    double sum = 1, term = 1;
+    for (int k = 1; k < 32; k++) {
+        term *= (x / (2 * k)) * (x / (2 * k));
+        sum += term;
+    }
+    return sum;
+}
+
+static void
+init_tables(void)
+{
+    const double pi = 3.141592653589793;
+    for (int i = 0; i < 256; i++) {
+        double c = i / 255.0;
+        srgb_to_linear[i] = c <= 0.04045 ? c / 12.92
+                                         : pow((c + 0.055) / 1.055, 2.4);
+    }
+    for (int i = 0; i < LINEAR; i++) {
+        double l = (i + 0.5) / LINEAR;
+        double c = l <= 0.0031308 ? l * 12.92
+                                  : 1.055 * pow(l, 1 / 2.4) - 0.055;
+        linear_to_srgb[i] = c * 255 + 0.5;
+    }
+
+    /* Taps sit at source offsets -3.5 to 3.5 from the destination
+     * center: sinc at the destination's Nyquist rate, windowed over
+     * four destination texels with alpha = 4.
+     */
+    double sum = 0;
+    for (int i = 0; i < TAPS; i++) {
+        double t = i - 3.5;
+        double x = pi * t / 2;
+        double sinc = sin(x) / x;
+        double r = t / 4;
+        double window = bessel_i0(4 * sqrt(1 - r * r)) / bessel_i0(4);
+        kaiser[i] = sinc * window;
+        sum += kaiser[i];
+    }
+    for (int i = 0; i < TAPS; i++)
+        kaiser[i] /= sum;
+}
+
+struct level_job {
+    const float *src;
+    int sw, sh;
+    float *dst;
+    int dw, dh;
+    float *tmp;      /* Kaiser: dw by sh, filtered horizontally */
+    unsigned char *out;
+    int srgb;
+};
+
+static void
+encode_row(unsigned char *out, const float *src, int n, int srgb)
+{
+    for (int i = 0; i < n * 4; i++) {
+        float v = src[i];
+        v = v < 0 ? 0 : v > 1 ? 1 : v;
+        if (srgb && i % 4 != 3)
+            out[i] = linear_to_srgb[(int) (v * (LINEAR - 1))];
+        else
+            out[i] = v * 255 + 0.5f;
+    }
+}
+
+static void
+box_band(void *arg, size_t band)
+{
+    const struct level_job *job = arg;
+    int y1 = (band + 1) * BAND < (size_t) job->dh ? (int) (band + 1) * BAND
+                                                   : job->dh;
+    for (int y = band * BAND; y < y1; y++) {
+        /* Odd sizes drop the last row or column; 1 texel wide repeats */
+        const float *r0 = job->src + (size_t) (2 * y) * job->sw * 4;
+        const float *r1 = job->sh > 1 ? r0 + (size_t) job->sw * 4 : r0;
+        int dx = job->sw > 1;
+        float *d = job->dst + (size_t) y * job->dw * 4;
+        int x = 0;
+#if defined(__AVX__)
+        if (dx) {
+            __m256 quarter = _mm256_set1_ps(0.25f);
+            for (; x + 2 <= job->dw; x += 2) {
+                __m256 a = _mm256_add_ps(_mm256_loadu_ps(r0 + x * 8),
+                                         _mm256_loadu_ps(r1 + x * 8));
+                __m256 b = _mm256_add_ps(_mm256_loadu_ps(r0 + x * 8 + 8),
+                                         _mm256_loadu_ps(r1 + x * 8 + 8));
+                __m256 s = _mm256_add_ps(_mm256_permute2f128_ps(a, b, 0x20),
+                                         _mm256_permute2f128_ps(a, b, 0x31));
+                _mm256_storeu_ps(d + x * 4, _mm256_mul_ps(s, quarter));
+            }
+        }
+#endif
+#if defined(__SSE2__)
+        __m128 q = _mm_set1_ps(0.25f);
+        for (; x < job->dw; x++) {
+            const float *p0 = r0 + x * 8;
+            const float *p1 = r1 + x * 8;
+            __m128 s = _mm_add_ps(
+                _mm_add_ps(_mm_loadu_ps(p0), _mm_loadu_ps(p0 + dx * 4)),
+                _mm_add_ps(_mm_loadu_ps(p1), _mm_loadu_ps(p1 + dx * 4)));
+            _mm_storeu_ps(d + x * 4, _mm_mul_ps(s, q));
+        }
+#else
+        for (; x < job->dw; x++)
+            for (int c = 0; c < 4; c++)
+                d[x * 4 + c] = 0.25f * (r0[x * 8 + c] +
+                                        r0[x * 8 + dx * 4 + c] +
+                                        r1[x * 8 + c] +
+                                        r1[x * 8 + dx * 4 + c]);
+#endif
+        encode_row(job->out + (size_t) y * job->dw * 4, d, job->dw,
+                   job->srgb);
+    }
+}
+
+/* Sums TAPS pixels, stride floats apart, starting at src[first]. Taps
+ * past either edge clamp to it.
+ */
+static void
+kaiser_pixel(float *dst, const float *src, int first, int count,
+             size_t stride)
+{
+#if defined(__SSE2__)
+    __m128 sum = _mm_setzero_ps();
+    for (int k = 0; k < TAPS; k++) {
+        int i = first + k;
+        i = i < 0 ? 0 : i >= count ? count - 1 : i;
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(kaiser[k]),
+                                         _mm_loadu_ps(src + i * stride)));
+    }
+    _mm_storeu_ps(dst, sum);
+#else
+    float sum[4] = {0, 0, 0, 0};
+    for (int k = 0; k < TAPS; k++) {
+        int i = first + k;
+        i = i < 0 ? 0 : i >= count ? count - 1 : i;
+        for (int c = 0; c < 4; c++)
+            sum[c] += kaiser[k] * src[i * stride + c];
+    }
+    memcpy(dst, sum, sizeof(sum));
+#endif
+}
+
+static void
+kaiser_rows(void *arg, size_t band)
+{
+    const struct level_job *job = arg;
+    int y1 = (band + 1) * BAND < (size_t) job->sh ? (int) (band + 1) * BAND
+                                                   : job->sh;
+    for (int y = band * BAND; y < y1; y++) {
+        const float *s = job->src + (size_t) y * job->sw * 4;
+        float *t = job->tmp + (size_t) y * job->dw * 4;
+        int x = 0;
+#if defined(__AVX__)
+        /* Interior pairs of pixels, clear of both edges */
+        for (x = 2; x + 1 < job->dw && 2 * x + 6 < job->sw; x += 2) {
+            __m256 sum = _mm256_setzero_ps();
+            for (int k = 0; k < TAPS; k++) {
+                const float *p = s + (2 * x - 3 + k) * 4;
+                __m256 v = _mm256_insertf128_ps(
+                    _mm256_castps128_ps256(_mm_loadu_ps(p)),
+                    _mm_loadu_ps(p + 8), 1);
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(
+                    _mm256_set1_ps(kaiser[k]), v));
+            }
+            _mm256_storeu_ps(t + x * 4, sum);
+        }
+        for (int e = 0; e < 2 && e < job->dw; e++)
+            kaiser_pixel(t + e * 4, s, 2 * e - 3, job->sw, 4);
+#endif
+        for (; x < job->dw; x++)
+            kaiser_pixel(t + x * 4, s, 2 * x - 3, job->sw, 4);
+    }
+}
+
+static void
+kaiser_columns(void *arg, size_t band)
+{
+    const struct level_job *job = arg;
+    int y1 = (band + 1) * BAND < (size_t) job->dh ? (int) (band + 1) * BAND
+                                                   : job->dh;
+    size_t stride = (size_t) job->dw * 4;
+    for (int y = band * BAND; y < y1; y++) {
+        float *d = job->dst + y * stride;
+        for (int x = 0; x < job->dw; x++)
+            kaiser_pixel(d + x * 4, job->tmp + x * 4, 2 * y - 3, job->sh,
+                         stride);
+        encode_row(job->out + y * stride, d, job->dw, job->srgb);
+    }
+}
+
+int
+mipmap_build(struct mipmap_chain *chain, const unsigned char *rgba,
+             int width, int height, enum mipmap_filter filter, int srgb)
+{
+    pthread_once(&tables_once, init_tables);
+    memset(chain, 0, sizeof(*chain));
+    int w = width, h = height;
+    for (;;) {
+        int i = chain->levels++;
+        chain->width[i] = w;
+        chain->height[i] = h;
+        chain->offset[i] = chain->size;
+        chain->size += (size_t) w * h * 4;
+        if ((w == 1 && h == 1) || filter == MIPMAP_NONE ||
+            chain->levels == MIPMAP_MAX_LEVELS)
+            break;
+        w = w > 1 ? w / 2 : 1;
+        h = h > 1 ? h / 2 : 1;
+    }
+    /* Level 1 is the largest after the base, even for 1 by N images
+     * that only halve along one side. Kaiser's horizontal pass holds a
+     * level's width by its source's height.
+     */
+    size_t pixels = (size_t) width * height;
+    size_t second = 1, rows = 1;
+    for (int i = 1; i < chain->levels; i++) {
+        size_t n = (size_t) chain->width[i] * chain->height[i - 1];
+        rows = n > rows ? n : rows;
+    }
+    if (chain->levels > 1)
+        second = (size_t) chain->width[1] * chain->height[1];
+    chain->data = malloc(chain->size);
+    float *a = malloc(pixels * 4 * sizeof(float));
+    float *b = malloc(second * 4 * sizeof(float));
+    float *tmp = filter == MIPMAP_KAISER ?
+        malloc(rows * 4 * sizeof(float)) : NULL;
+    if (!chain->data || !a || !b || (filter == MIPMAP_KAISER && !tmp)) {
+        free(chain->data);
+        free(a);
+        free(b);
+        free(tmp);
+        return -1;
+    }
+
+    memcpy(chain->data, rgba, pixels * 4);
+    for (size_t i = 0; i < pixels * 4; i++) {
+        if (srgb && i % 4 != 3)
+            a[i] = srgb_to_linear[rgba[i]];
+        else
+            a[i] = rgba[i] / 255.0f;
+    }
+
+    /* Levels never grow, so two buffers alternate */
+    for (int i = 1; i < chain->levels; i++) {
+        struct level_job job = {
+            a, chain->width[i - 1], chain->height[i - 1],
+            b, chain->width[i], chain->height[i],
+            tmp, chain->data + chain->offset[i], srgb
+        };
+        if (filter == MIPMAP_BOX) {
+            jobs_run(box_band, &job, (job.dh + BAND - 1) / BAND);
+        } else {
+            jobs_run(kaiser_rows, &job, (job.sh + BAND - 1) / BAND);
+            jobs_run(kaiser_columns, &job, (job.dh + BAND - 1) / BAND);
+        }
+        float *swap = a;
+        a = b;
+        b = swap;
+    }
+    free(a);
+    free(b);
+    free(tmp);
+    return 0;
+}
+
+void
+mipmap_free(struct mipmap_chain *chain)
+{
+    free(chain->data);
+    chain->data = NULL;
+}
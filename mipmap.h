@@ -0,0 +1,36 @@
+#ifndef MIPMAP_H
+#define MIPMAP_H
+
+#include <stddef.h>
+
+#define MIPMAP_MAX_LEVELS 16
+
+enum mipmap_filter {
+    MIPMAP_NONE,
+    MIPMAP_BOX,     /* 2x2 average */
+    MIPMAP_KAISER,  /* 8-tap Kaiser-windowed sinc, sharper */
+};
+
+/* A full RGBA8 mip chain in one allocation, level 0 first. */
+struct mipmap_chain {
+    int levels;
+    int width[MIPMAP_MAX_LEVELS];
+    int height[MIPMAP_MAX_LEVELS];
+    size_t offset[MIPMAP_MAX_LEVELS];
+    size_t size;
+    unsigned char *data;
+};
+
+/* Builds the chain down to 1x1 on the job pool: levels one after
+ * another, each split into bands of rows that are filtered in
+ * parallel. Filtering happens in linear floating point, 4 channels per
+ * SSE vector or 2 pixels per AVX vector. With srgb, color channels are
+ * decoded from sRGB first and encoded again after, so averages aren't
+ * darkened; alpha is always linear. Returns 0, or -1 when out of
+ * memory.
+ */
+int mipmap_build(struct mipmap_chain *, const unsigned char *rgba,
+                 int width, int height, enum mipmap_filter, int srgb);
+void mipmap_free(struct mipmap_chain *);
+
+#endif
@@ -0,0 +1,205 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "particle.h"
+
+#define PARTICLE_SIZE 4.0f  /* pixels */
+
+#define STR(x) #x
+#define XSTR(x) STR(x)
+
+static const char *const UPDATE_VARYINGS[] = {
+    "next_position", "next_velocity", "next_age", NULL
+};
+
+/* Spawning and aging follow the same rules as the CPU simulation. The
+ * hash gives each particle its own random launch every time it
+ * respawns.
+ */
+static const struct shader_source UPDATE_SHADER = {
+    .name = "particle_update",
+    .vert =
+        "const float LIFETIME = " XSTR(PARTICLE_LIFETIME) ";\n"
+        "const float GRAVITY = " XSTR(PARTICLE_GRAVITY) ";\n"
+        "const float FLOOR = " XSTR(PARTICLE_FLOOR) ";\n"
+        "const float BOUNCE = " XSTR(PARTICLE_BOUNCE) ";\n"
+        "layout(location = 0) in vec2 position;\n"
+        "layout(location = 1) in vec2 velocity;\n"
+        "layout(location = 2) in float age;\n"
+        "uniform float dt;\n"
+        "uniform float time;\n"
+        "uniform uint seed;\n"
+        "out vec2 next_position;\n"
+        "out vec2 next_velocity;\n"
+        "out float next_age;\n"
+        "float random(uint x) {\n"
+        "    x ^= x >> 16;\n"
+        "    x *= 0x7feb352du;\n"
+        "    x ^= x >> 15;\n"
+        "    x *= 0x846ca68bu;\n"
+        "    x ^= x >> 16;\n"
+        "    return float(x) / 4294967296.0;\n"
+        "}\n"
+        "void main() {\n"
+        "    vec2 p = position;\n"
+        "    vec2 v = velocity;\n"
+        "    float a = age + dt;\n"
+        "    if (a >= LIFETIME || (age < 0 && a >= 0)) {\n"
+        "        uint id = uint(gl_VertexID) * 2u + seed * 0x9e3779b9u;\n"
+        "        float angle = (random(id) - 0.5) * 0.6;\n"
+        "        float speed = 1.4 + 0.5 * random(id + 1u);\n"
+        "        p = vec2(0.6 * sin(0.7 * time), -0.9);\n"
+        "        v = speed * vec2(sin(angle), cos(angle));\n"
+        "        a = mod(a, LIFETIME);\n"
+        "    } else if (a >= 0) {\n"
+        "        v.y += GRAVITY * dt;\n"
+        "        p += v * dt;\n"
+        "        if (p.y < FLOOR) {\n"
+        "            p.y = 2 * FLOOR - p.y;\n"
+        "            v.y *= -BOUNCE;\n"
+        "        }\n"
+        "    }\n"
+        "    next_position = p;\n"
+        "    next_velocity = v;\n"
+        "    next_age = a;\n"
+        "}\n",
+    .varyings = UPDATE_VARYINGS,
+};
+
+static const struct shader_source DRAW_SHADER = {
+    .name = "particle_draw",
+    .vert =
+        "const float LIFETIME = " XSTR(PARTICLE_LIFETIME) ";\n"
+        "layout(location = 0) in vec2 position;\n"
+        "layout(location = 2) in float age;\n"
+        "out float life;\n"
+        "void main() {\n"
+        "    life = age / LIFETIME;\n"
+        "    if (age < 0)\n"
+        "        gl_Position = vec4(0, 0, 2, 1);  /* clipped */\n"
+        "    else\n"
+        "        gl_Position = vec4(position, 0, 1);\n"
+        "}\n",
+    .frag =
+        "in float life;\n"
+        "out vec4 fragment;\n"
+        "void main() {\n"
+        "    vec2 c = gl_PointCoord * 2 - 1;\n"
+        "    float r = dot(c, c);\n"
+        "    if (r > 1)\n"
+        "        discard;\n"
+        "    vec3 color = mix(vec3(1, 0.9, 0.3), vec3(1, 0.2, 0.1), life);\n"
+        "    fragment = vec4(color, (1 - life) * (1 - r));\n"
+        "}\n",
+};
+
+void
+particle_renderer_init(struct particle_renderer *renderer)
+{
+    shader_set_init(&renderer->shaders, &DRAW_SHADER);
+    renderer->program = shader_variant(&renderer->shaders, 0);
+}
+
+void
+particle_render(struct particle_renderer *renderer, GLuint vao,
+                GLsizei count)
+{
+    glUseProgram(renderer->program);
+    glPointSize(PARTICLE_SIZE);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE);
+    glBindVertexArray(vao);
+    glDrawArrays(GL_POINTS, 0, count);
+    glBindVertexArray(0);
+    glDisable(GL_BLEND);
+    glUseProgram(0);
+}
+
+void
+particle_renderer_free(struct particle_renderer *renderer)
+{
+    shader_set_free(&renderer->shaders);
+}
+
+void
+particle_init(struct particle_system *ps, GLsizei count)
+{
+    shader_set_init(&ps->update_shaders, &UPDATE_SHADER);
+    ps->update_program = shader_variant(&ps->update_shaders, 0);
+    particle_renderer_init(&ps->renderer);
+    ps->uniform_dt = glGetUniformLocation(ps->update_program, "dt");
+    ps->uniform_time = glGetUniformLocation(ps->update_program, "time");
+    ps->uniform_seed = glGetUniformLocation(ps->update_program, "seed");
+    ps->count = count;
+    ps->current = 0;
+    ps->time = 0;
+    ps->frame = 0;
+
+    /* Births are staggered over one lifetime for a steady stream */
+    float *state = malloc((size_t) count * 5 * sizeof(*state));
+    if (!state) {
+        fprintf(stderr, "error: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    for (GLsizei i = 0; i < count; i++) {
+        float *s = state + (size_t) i * 5;
+        s[0] = s[1] = s[2] = s[3] = 0;
+        s[4] = -PARTICLE_LIFETIME * i / count;
+    }
+    glGenBuffers(2, ps->buffers);
+    glGenVertexArrays(2, ps->vaos);
+    GLsizei stride = 5 * sizeof(GLfloat);
+    for (int i = 0; i < 2; i++) {
+        glBindVertexArray(ps->vaos[i]);
+        glBindBuffer(GL_ARRAY_BUFFER, ps->buffers[i]);
+        glBufferData(GL_ARRAY_BUFFER, (size_t) count * stride,
+                     i ? NULL : state, GL_DYNAMIC_COPY);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, stride, 0);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride,
+                              (void *) (2 * sizeof(GLfloat)));
+        glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, stride,
+                              (void *) (4 * sizeof(GLfloat)));
+        for (GLuint a = 0; a < 3; a++)
+            glEnableVertexAttribArray(a);
+    }
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    free(state);
+}
+
+void
+particle_update(struct particle_system *ps, float dt)
+{
+    int next = !ps->current;
+    ps->time += dt;
+    glUseProgram(ps->update_program);
+    glUniform1f(ps->uniform_dt, dt);
+    glUniform1f(ps->uniform_time, ps->time);
+    glUniform1ui(ps->uniform_seed, ps->frame++);
+    glEnable(GL_RASTERIZER_DISCARD);
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, ps->buffers[next]);
+    glBeginTransformFeedback(GL_POINTS);
+    glBindVertexArray(ps->vaos[ps->current]);
+    glDrawArrays(GL_POINTS, 0, ps->count);
+    glBindVertexArray(0);
+    glEndTransformFeedback();
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0);
+    glDisable(GL_RASTERIZER_DISCARD);
+    glUseProgram(0);
+    ps->current = next;
+}
+
+void
+particle_draw(struct particle_system *ps)
+{
+    particle_render(&ps->renderer, ps->vaos[ps->current], ps->count);
+}
+
+void
+particle_free(struct particle_system *ps)
+{
+    glDeleteVertexArrays(2, ps->vaos);
+    glDeleteBuffers(2, ps->buffers);
+    particle_renderer_free(&ps->renderer);
+    shader_set_free(&ps->update_shaders);
+}
@@ -0,0 +1,60 @@
+#ifndef PARTICLE_H
+#define PARTICLE_H
+
+#include <GL/gl3w.h>
+
+#include "shader.h"
+
+/* Particles fountain from an emitter swinging along the bottom of the
+ * view, fall under gravity and bounce off the floor until they expire
+ * and respawn. Particles not yet born have a negative age.
+ */
+#define PARTICLE_LIFETIME 3.0f   /* seconds */
+#define PARTICLE_GRAVITY  -1.5f  /* units per second squared */
+#define PARTICLE_FLOOR    -1.0f
+#define PARTICLE_BOUNCE   0.5f   /* speed kept when bouncing */
+
+/* Point sprites shared by both simulations: positions (vec2) are read
+ * from attribute 0 and ages from attribute 2.
+ */
+struct particle_renderer {
+    struct shader_set shaders;
+    GLuint program;
+};
+
+/* A particle simulated entirely on the device. State (position,
+ * velocity, age) lives in two buffers: each update runs the previous
+ * state through a vertex shader with rasterization discarded and
+ * captures the next one into the other buffer with transform
+ * feedback. Particles are drawn as point sprites straight from the
+ * newest buffer, so no particle data ever crosses the bus.
+ */
+struct particle_system {
+    struct shader_set update_shaders;
+    struct particle_renderer renderer;
+    GLuint update_program;
+    GLint uniform_dt;
+    GLint uniform_time;
+    GLint uniform_seed;
+    GLuint buffers[2];
+    GLuint vaos[2];      /* each reads the state in the same buffer */
+    int current;         /* buffer holding the newest state */
+    GLsizei count;
+    double time;
+    unsigned frame;
+};
+
+void particle_renderer_init(struct particle_renderer *);
+void particle_render(struct particle_renderer *, GLuint vao, GLsizei count);
+void particle_renderer_free(struct particle_renderer *);
+
+void particle_init(struct particle_system *, GLsizei count);
+
+/* Advances the simulation by dt seconds. */
+void particle_update(struct particle_system *, float dt);
+
+void particle_draw(struct particle_system *);
+
+void particle_free(struct particle_system *);
+
+#endif
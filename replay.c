@@ -0,0 +1,118 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <getopt.h>
+
+#define GLFW_INCLUDE_NONE
+#include <GL/gl3w.h>
+#include <GLFW/glfw3.h>
+
+#include "mapfile.h"
+
+/* Replays a trace captured with gl3wCaptureStart() (demo -r) into a
+ * hidden window and reports how long the driver took.
+ */
+
+static void
+swap(void *arg)
+{
+    glfwSwapBuffers(arg);
+    glfwPollEvents();
+}
+
+static void
+usage(FILE *f)
+{
+    fprintf(f, "usage: replay [-T] [-n count] [-s WxH] trace\n");
+    fprintf(f, "  -T       keep the captured call timing\n");
+    fprintf(f, "  -n count replay the trace count times\n");
+    fprintf(f, "  -s WxH   window size [640x640]\n");
+}
+
+int
+main(int argc, char **argv)
+{
+    /* Options */
+    int flags = 0;
+    int count = 1;
+    int width = 640;
+    int height = 640;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "Tn:s:h")) != -1) {
+        switch (opt) {
+            case 'T':
+                flags |= GL3W_REPLAY_TIMED;
+                break;
+            case 'n':
+                count = atoi(optarg);
+                break;
+            case 's':
+                if (sscanf(optarg, "%dx%d", &width, &height) != 2) {
+                    fprintf(stderr, "replay: invalid size, %s\n", optarg);
+                    exit(EXIT_FAILURE);
+                }
+                break;
+            case 'h':
+                usage(stdout);
+                exit(EXIT_SUCCESS);
+            default:
+                usage(stderr);
+                exit(EXIT_FAILURE);
+        }
+    }
+    if (optind != argc - 1) {
+        usage(stderr);
+        exit(EXIT_FAILURE);
+    }
+
+    struct mapfile trace;
+    const char *path = argv[optind];
+    if (mapfile_open(&trace, path)) {
+        fprintf(stderr, "replay: %s: %s\n", path, strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    /* Create a hidden window with a context like the captured one */
+    if (!glfwInit()) {
+        fprintf(stderr, "GLFW3: failed to initialize\n");
+        exit(EXIT_FAILURE);
+    }
+    glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    GLFWwindow *window = glfwCreateWindow(width, height, "replay", NULL, NULL);
+    if (!window) {
+        fprintf(stderr, "GLFW3: failed to create window\n");
+        exit(EXIT_FAILURE);
+    }
+    glfwMakeContextCurrent(window);
+    glfwSwapInterval(0);
+    if (gl3wInit()) {
+        fprintf(stderr, "gl3w: failed to initialize\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int i = 0; i < count; i++) {
+        struct GL3WReplayStats stats;
+        double start = glfwGetTime();
+        if (gl3wReplay(trace.data, trace.size, flags, swap, window, &stats)) {
+            fprintf(stderr, "replay: %s: invalid trace\n", path);
+            exit(EXIT_FAILURE);
+        }
+        glFinish();
+        double seconds = glfwGetTime() - start;
+        printf("%lu frames, %lu calls, %lu skipped, %.3f s",
+               stats.frames, stats.calls, stats.skipped, seconds);
+        if (stats.frames)
+            printf(", %.3f ms/frame", seconds * 1e3 / stats.frames);
+        putchar('\n');
+    }
+
+    mapfile_close(&trace);
+    glfwTerminate();
+    return 0;
+}
@@ -0,0 +1,258 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "shader.h"
+
+#define GLSL_VERSION "#version 330\n"
+#define CACHE_MAGIC  0x31425347UL  /* "GSB1" */
+
+static const char *const feature_names[] = {
+#define X(name) #name,
+    SHADER_FEATURES(X)
+#undef X
+};
+
+static const char *cache_dir;
+
+static GLuint
+compile_sources(GLenum type, GLsizei count, const GLchar **sources)
+{
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, count, sources, NULL);
+    glCompileShader(shader);
+    GLint param;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &param);
+    if (!param) {
+        GLchar log[4096];
+        glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+        fprintf(stderr, "error: %s: %s\n",
+                type == GL_FRAGMENT_SHADER ? "frag" :
+                type == GL_GEOMETRY_SHADER ? "geom" : "vert", (char *) log);
+        exit(EXIT_FAILURE);
+    }
+    return shader;
+}
+
+GLuint
+compile_shader(GLenum type, const GLchar *source)
+{
+    return compile_sources(type, 1, &source);
+}
+
+static void
+check_link(GLuint program)
+{
+    GLint param;
+    glGetProgramiv(program, GL_LINK_STATUS, &param);
+    if (!param) {
+        GLchar log[4096];
+        glGetProgramInfoLog(program, sizeof(log), NULL, log);
+        fprintf(stderr, "error: link: %s\n", (char *) log);
+        exit(EXIT_FAILURE);
+    }
+}
+
+GLuint
+link_program(GLuint vert, GLuint frag)
+{
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vert);
+    glAttachShader(program, frag);
+    glLinkProgram(program);
+    check_link(program);
+    return program;
+}
+
+static uint64_t
+fnv1a(uint64_t h, const char *s)
+{
+    for (; *s; s++)
+        h = (h ^ (unsigned char) *s) * UINT64_C(0x100000001b3);
+    return h;
+}
+
+static void
+build_defines(char *buf, size_t len, unsigned features)
+{
+    buf[0] = 0;
+    for (unsigned i = 0; i < SHADER_FEATURE_COUNT; i++) {
+        if (features & (1u << i)) {
+            size_t n = strlen(buf);
+            snprintf(buf + n, len - n, "#define %s 1\n", feature_names[i]);
+        }
+    }
+}
+
+/* Program binaries are only valid for the exact driver that produced
+ * them, so the driver strings are part of the cache key.
+ */
+static void
+cache_path(char *path, size_t len, const char *defines,
+           const struct shader_source *source)
+{
+    uint64_t h = UINT64_C(0xcbf29ce484222325);
+    h = fnv1a(h, (const char *) glGetString(GL_VENDOR));
+    h = fnv1a(h, (const char *) glGetString(GL_RENDERER));
+    h = fnv1a(h, (const char *) glGetString(GL_VERSION));
+    h = fnv1a(h, defines);
+    h = fnv1a(h, source->vert);
+    if (source->geom)
+        h = fnv1a(h, source->geom);
+    if (source->frag)
+        h = fnv1a(h, source->frag);
+    for (const char *const *v = source->varyings; v && *v; v++)
+        h = fnv1a(fnv1a(h, *v), ",");
+    snprintf(path, len, "%s/%s-%016llx.bin",
+             cache_dir, source->name, (unsigned long long) h);
+}
+
+static int
+cache_supported(void)
+{
+    if (!cache_dir)
+        return 0;
+    if (!gl3wIsSupported(4, 1) && !gl3wHasExt(GL3W_ARB_get_program_binary))
+        return 0;
+    GLint formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    return formats > 0;
+}
+
+static GLuint
+cache_load(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return 0;
+    uint32_t header[3];
+    GLuint program = 0;
+    void *binary = NULL;
+    if (fread(header, sizeof(header), 1, f) == 1 &&
+        header[0] == CACHE_MAGIC &&
+        (binary = malloc(header[2])) &&
+        fread(binary, header[2], 1, f) == 1) {
+        program = glCreateProgram();
+        glProgramBinary(program, header[1], binary, header[2]);
+        GLint param;
+        glGetProgramiv(program, GL_LINK_STATUS, &param);
+        if (!param) {
+            /* Stale binary, e.g. after a driver upgrade. */
+            glDeleteProgram(program);
+            program = 0;
+        }
+    }
+    free(binary);
+    fclose(f);
+    return program;
+}
+
+static void
+cache_store(const char *path, GLuint program)
+{
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    void *binary = length > 0 ? malloc(length) : NULL;
+    if (!binary)
+        return;
+    GLenum format;
+    glGetProgramBinary(program, length, &length, &format, binary);
+    uint32_t header[3] = {CACHE_MAGIC, format, length};
+    FILE *f = fopen(path, "wb");
+    if (f) {
+        if (fwrite(header, sizeof(header), 1, f) != 1 ||
+            fwrite(binary, length, 1, f) != 1)
+            fprintf(stderr, "warning: %s: short write\n", path);
+        fclose(f);
+    }
+    free(binary);
+}
+
+static GLuint
+build_variant(const struct shader_source *source, unsigned features)
+{
+    char defines[256];
+    build_defines(defines, sizeof(defines), features);
+
+    char path[1024];
+    int cached = cache_supported();
+    if (cached) {
+        cache_path(path, sizeof(path), defines, source);
+        GLuint program = cache_load(path);
+        if (program)
+            return program;
+    }
+
+    static const GLenum types[] = {
+        GL_VERTEX_SHADER, GL_GEOMETRY_SHADER, GL_FRAGMENT_SHADER
+    };
+    const GLchar *stages[] = {source->vert, source->geom, source->frag};
+    GLuint shaders[3] = {0, 0, 0};
+    GLuint program = glCreateProgram();
+    for (int i = 0; i < 3; i++) {
+        if (stages[i]) {
+            const GLchar *sources[] = {GLSL_VERSION, defines, stages[i]};
+            shaders[i] = compile_sources(types[i], 3, sources);
+            glAttachShader(program, shaders[i]);
+        }
+    }
+    if (source->varyings) {
+        GLsizei count = 0;
+        while (source->varyings[count])
+            count++;
+        glTransformFeedbackVaryings(program, count, source->varyings,
+                                    GL_INTERLEAVED_ATTRIBS);
+    }
+    if (cached)
+        glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+                            GL_TRUE);
+    glLinkProgram(program);
+    check_link(program);
+    for (int i = 0; i < 3; i++)
+        if (shaders[i])
+            glDeleteShader(shaders[i]);
+
+    if (cached)
+        cache_store(path, program);
+    return program;
+}
+
+void
+shader_cache_dir(const char *dir)
+{
+    cache_dir = dir;
+}
+
+void
+shader_set_init(struct shader_set *set, const struct shader_source *source)
+{
+    set->source = source;
+    memset(set->programs, 0, sizeof(set->programs));
+}
+
+void
+shader_set_precompile(struct shader_set *set)
+{
+    for (unsigned i = 0; i < SHADER_VARIANT_COUNT; i++)
+        if ((i & set->source->features) == i)
+            shader_variant(set, i);
+}
+
+GLuint
+shader_variant(struct shader_set *set, unsigned features)
+{
+    features &= set->source->features;
+    if (!set->programs[features])
+        set->programs[features] = build_variant(set->source, features);
+    return set->programs[features];
+}
+
+void
+shader_set_free(struct shader_set *set)
+{
+    for (unsigned i = 0; i < SHADER_VARIANT_COUNT; i++)
+        if (set->programs[i])
+            glDeleteProgram(set->programs[i]);
+    memset(set->programs, 0, sizeof(set->programs));
+}
@@ -0,0 +1,65 @@
+#ifndef SHADER_H
+#define SHADER_H
+
+#include <GL/gl3w.h>
+
+/* Feature switches a shader source may declare. Every switch becomes a
+ * preprocessor define in the variant compiled for it, so a variant is
+ * fully specialized and never branches on features at run time.
+ */
+#define SHADER_FEATURES(X) \
+    X(INSTANCING)          \
+    X(COMPRESSED)          \
+    X(VERTEX_COLOR)
+
+enum shader_feature_index {
+#define X(name) SHADER_INDEX_##name,
+    SHADER_FEATURES(X)
+#undef X
+    SHADER_FEATURE_COUNT
+};
+
+enum shader_feature {
+#define X(name) SHADER_##name = 1u << SHADER_INDEX_##name,
+    SHADER_FEATURES(X)
+#undef X
+};
+
+#define SHADER_VARIANT_COUNT (1u << SHADER_FEATURE_COUNT)
+
+/* Shader sources are written without a #version line: it's prepended
+ * along with the feature defines of the requested variant. The
+ * geometry and fragment stages are optional, and varyings, if given,
+ * is a NULL-terminated list of outputs captured interleaved by
+ * transform feedback.
+ */
+struct shader_source {
+    const char *name;
+    unsigned features;  /* switches this source declares */
+    const GLchar *vert;
+    const GLchar *geom;
+    const GLchar *frag;
+    const char *const *varyings;
+};
+
+/* One program slot per feature bitmask. Masks are first reduced to
+ * the switches the source declares, so unused bits never duplicate a
+ * program.
+ */
+struct shader_set {
+    const struct shader_source *source;
+    GLuint programs[SHADER_VARIANT_COUNT];
+};
+
+GLuint compile_shader(GLenum type, const GLchar *source);
+GLuint link_program(GLuint vert, GLuint frag);
+
+/* Enable the on-disk program binary cache, or disable it with NULL. */
+void shader_cache_dir(const char *dir);
+
+void shader_set_init(struct shader_set *, const struct shader_source *);
+void shader_set_precompile(struct shader_set *);
+GLuint shader_variant(struct shader_set *, unsigned features);
+void shader_set_free(struct shader_set *);
+
+#endif
@@ -0,0 +1,232 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sprite.h"
+
+#define ATTRIB_CORNER   0
+#define ATTRIB_RECT     1
+#define ATTRIB_ROTATION 2
+#define ATTRIB_REGION   3
+#define ATTRIB_TINT     4
+#define ATTRIB_LAYER    5
+
+static const struct shader_source SPRITE_SHADER = {
+    .name = "sprite",
+    .vert =
+        "layout(location = 0) in vec2 corner;\n"
+        "layout(location = 1) in vec4 rect;\n"
+        "layout(location = 2) in float rotation;\n"
+        "layout(location = 3) in vec4 region;\n"
+        "layout(location = 4) in vec4 tint;\n"
+        "layout(location = 5) in float layer;\n"
+        "uniform vec2 scale;\n"
+        "out vec3 uv;\n"
+        "out vec4 color;\n"
+        "void main() {\n"
+        "    float c = cos(rotation);\n"
+        "    float s = sin(rotation);\n"
+        "    vec2 p = mat2(c, s, -s, c) * (corner * rect.zw) + rect.xy;\n"
+        "    gl_Position = vec4(p * scale + vec2(-1, 1), 0, 1);\n"
+        "    vec2 t = corner * 0.5 + 0.5;\n"
+        "    uv = vec3(mix(region.xy, region.zw, t), layer);\n"
+        "    color = tint;\n"
+        "}\n",
+    .frag =
+        "in vec3 uv;\n"
+        "in vec4 color;\n"
+        "uniform sampler2DArray sprite;\n"
+        "out vec4 fragment;\n"
+        "void main() {\n"
+        "    fragment = texture(sprite, uv) * color;\n"
+        "}\n",
+};
+
+static const float CORNERS[] = {
+    -1.0f,  1.0f,
+    -1.0f, -1.0f,
+     1.0f,  1.0f,
+     1.0f, -1.0f
+};
+
+void
+sprite_batch_init(struct sprite_batch *batch)
+{
+    memset(batch, 0, sizeof(*batch));
+    batch->sprites = malloc(SPRITE_CAPACITY * sizeof(*batch->sprites));
+    if (!batch->sprites) {
+        fprintf(stderr, "error: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    shader_set_init(&batch->shaders, &SPRITE_SHADER);
+    batch->default_program = shader_variant(&batch->shaders, 0);
+    batch->default_scale = glGetUniformLocation(batch->default_program,
+                                                "scale");
+    batch->program = batch->default_program;
+    batch->uniform_scale = batch->default_scale;
+
+    static const uint32_t white = 0xffffffff;
+    glGenTextures(1, &batch->white);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, batch->white);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, 1, 1, 1, 0, GL_RGBA,
+                 GL_UNSIGNED_BYTE, &white);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+    glGenBuffers(1, &batch->vbo_corners);
+    glBindBuffer(GL_ARRAY_BUFFER, batch->vbo_corners);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(CORNERS), CORNERS, GL_STATIC_DRAW);
+    glGenBuffers(1, &batch->vbo_instances);
+    glBindBuffer(GL_ARRAY_BUFFER, batch->vbo_instances);
+    glBufferData(GL_ARRAY_BUFFER, SPRITE_CAPACITY * sizeof(struct sprite),
+                 NULL, GL_STREAM_DRAW);
+
+    glGenVertexArrays(1, &batch->vao);
+    glBindVertexArray(batch->vao);
+    glBindBuffer(GL_ARRAY_BUFFER, batch->vbo_corners);
+    glVertexAttribPointer(ATTRIB_CORNER, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(ATTRIB_CORNER);
+    static const GLuint instanced[] = {
+        ATTRIB_RECT, ATTRIB_ROTATION, ATTRIB_REGION, ATTRIB_TINT,
+        ATTRIB_LAYER
+    };
+    for (size_t i = 0; i < sizeof(instanced) / sizeof(*instanced); i++) {
+        glVertexAttribDivisor(instanced[i], 1);
+        glEnableVertexAttribArray(instanced[i]);
+    }
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void
+sprite_begin(struct sprite_batch *batch, int width, int height)
+{
+    batch->scale[0] = 2.0f / width;
+    batch->scale[1] = -2.0f / height;
+    batch->len = 0;
+    batch->texture = 0;
+    batch->program = batch->default_program;
+    batch->uniform_scale = batch->default_scale;
+    memset(&batch->stats, 0, sizeof(batch->stats));
+}
+
+void
+sprite_texture(struct sprite_batch *batch, GLuint texture)
+{
+    if (texture != batch->texture && batch->len) {
+        sprite_flush(batch);
+        batch->stats.texture_breaks++;
+    }
+    batch->texture = texture;
+}
+
+void
+sprite_program(struct sprite_batch *batch, GLuint program)
+{
+    if (!program)
+        program = batch->default_program;
+    if (program == batch->program)
+        return;
+    if (batch->len) {
+        sprite_flush(batch);
+        batch->stats.program_breaks++;
+    }
+    batch->program = program;
+    batch->uniform_scale = program == batch->default_program ?
+        batch->default_scale : glGetUniformLocation(program, "scale");
+}
+
+void
+sprite_draw(struct sprite_batch *batch, const struct sprite *sprite)
+{
+    if (batch->len == SPRITE_CAPACITY) {
+        sprite_flush(batch);
+        batch->stats.full_breaks++;
+    }
+    batch->sprites[batch->len++] = *sprite;
+    batch->stats.sprites++;
+}
+
+/* Instance attributes are pointed at this batch's place in the stream
+ * buffer, since base instances need OpenGL 4.2.
+ */
+static void
+point_attribs(size_t offset)
+{
+    const char *base = (const char *) (offset * sizeof(struct sprite));
+    GLsizei stride = sizeof(struct sprite);
+    glVertexAttribPointer(ATTRIB_RECT, 4, GL_FLOAT, GL_FALSE, stride,
+                          base + offsetof(struct sprite, x));
+    glVertexAttribPointer(ATTRIB_ROTATION, 1, GL_FLOAT, GL_FALSE, stride,
+                          base + offsetof(struct sprite, rotation));
+    glVertexAttribPointer(ATTRIB_REGION, 4, GL_FLOAT, GL_FALSE, stride,
+                          base + offsetof(struct sprite, u0));
+    glVertexAttribPointer(ATTRIB_TINT, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride,
+                          base + offsetof(struct sprite, color));
+    glVertexAttribPointer(ATTRIB_LAYER, 1, GL_FLOAT, GL_FALSE, stride,
+                          base + offsetof(struct sprite, layer));
+}
+
+void
+sprite_flush(struct sprite_batch *batch)
+{
+    if (!batch->len)
+        return;
+    size_t size = batch->len * sizeof(struct sprite);
+    glBindBuffer(GL_ARRAY_BUFFER, batch->vbo_instances);
+    if (batch->offset + batch->len > SPRITE_CAPACITY) {
+        /* Orphan: earlier draws keep the old storage */
+        glBufferData(GL_ARRAY_BUFFER, SPRITE_CAPACITY * sizeof(struct sprite),
+                     NULL, GL_STREAM_DRAW);
+        batch->offset = 0;
+    }
+    void *p = glMapBufferRange(GL_ARRAY_BUFFER,
+                               batch->offset * sizeof(struct sprite), size,
+                               GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT |
+                               GL_MAP_INVALIDATE_RANGE_BIT);
+    if (!p) {
+        fprintf(stderr, "warning: sprite buffer map failed, "
+                "dropped %zu sprites\n", batch->len);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        batch->len = 0;
+        return;
+    }
+    memcpy(p, batch->sprites, size);
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+
+    glBindVertexArray(batch->vao);
+    point_attribs(batch->offset);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glUseProgram(batch->program);
+    glUniform2fv(batch->uniform_scale, 1, batch->scale);
+    glBindTexture(GL_TEXTURE_2D_ARRAY,
+                  batch->texture ? batch->texture : batch->white);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, batch->len);
+    glDisable(GL_BLEND);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    glUseProgram(0);
+    glBindVertexArray(0);
+
+    batch->offset += batch->len;
+    batch->len = 0;
+    batch->stats.batches++;
+}
+
+void
+sprite_end(struct sprite_batch *batch)
+{
+    sprite_flush(batch);
+}
+
+void
+sprite_batch_free(struct sprite_batch *batch)
+{
+    glDeleteVertexArrays(1, &batch->vao);
+    glDeleteBuffers(1, &batch->vbo_instances);
+    glDeleteBuffers(1, &batch->vbo_corners);
+    glDeleteTextures(1, &batch->white);
+    shader_set_free(&batch->shaders);
+    free(batch->sprites);
+}
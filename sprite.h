@@ -0,0 +1,76 @@
+#ifndef SPRITE_H
+#define SPRITE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <GL/gl3w.h>
+
+#include "shader.h"
+
+#define SPRITE_CAPACITY 16384  /* sprites per flush */
+
+/* One instance of the unit square, in pixels with the origin at the
+ * top left of the target.
+ */
+struct sprite {
+    float x, y;          /* center */
+    float w, h;          /* half extents */
+    float rotation;      /* radians, clockwise on screen */
+    float u0, v0, u1, v1;  /* texture region */
+    float layer;         /* texture array layer, e.g. an atlas page */
+    uint32_t color;      /* RGBA8 tint, red in the low byte */
+};
+
+struct sprite_stats {
+    size_t sprites;
+    size_t batches;         /* draw calls */
+    size_t texture_breaks;  /* flushes forced by a texture change */
+    size_t program_breaks;  /* ... by a program change */
+    size_t full_breaks;     /* ... by a full batch */
+};
+
+/* Collects sprites into a batch drawn with one instanced call. The
+ * batch is flushed when the texture or program changes, when it
+ * fills, and at the end of the frame. Instances stream into a buffer
+ * written with unsynchronized appends and orphaned when it wraps, so
+ * flushing never waits on earlier draws.
+ */
+struct sprite_batch {
+    struct shader_set shaders;
+    GLuint default_program;
+    GLint default_scale;
+    GLuint program;
+    GLint uniform_scale;  /* of program */
+    GLuint texture;
+    GLuint white;        /* texture for untextured sprites */
+    GLuint vbo_corners;
+    GLuint vbo_instances;
+    GLuint vao;
+    size_t offset;       /* next free instance in the buffer */
+    size_t len;
+    struct sprite *sprites;
+    float scale[2];
+    struct sprite_stats stats;  /* since sprite_begin() */
+};
+
+void sprite_batch_init(struct sprite_batch *);
+
+/* Starts a frame drawing to a width by height target. */
+void sprite_begin(struct sprite_batch *, int width, int height);
+
+/* Textures are GL_TEXTURE_2D_ARRAY, so one texture such as an atlas
+ * can serve every sprite. A texture of 0 draws untextured.
+ */
+void sprite_texture(struct sprite_batch *, GLuint texture);
+
+/* Custom programs must accept the instance layout of the default
+ * sprite shader and its "scale" uniform. 0 restores the default.
+ */
+void sprite_program(struct sprite_batch *, GLuint program);
+
+void sprite_draw(struct sprite_batch *, const struct sprite *);
+void sprite_flush(struct sprite_batch *);
+void sprite_end(struct sprite_batch *);
+void sprite_batch_free(struct sprite_batch *);
+
+#endif
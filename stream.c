@@ -0,0 +1,262 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include "stream.h"
+#include "mapfile.h"
+#include "ktx.h"
+#include "mipmap.h"
+
+/* Parses a binary PPM (P6, 8-bit) header, returning a pointer to the
+ * pixels or NULL.
+ */
+static const unsigned char *
+ppm_header(const struct mapfile *f, int *width, int *height)
+{
+    const char *p = f->data;
+    const char *end = p + f->size;
+    long fields[3];
+    if (f->size < 2 || p[0] != 'P' || p[1] != '6')
+        return NULL;
+    p += 2;
+    for (int i = 0; i < 3; i++) {
+        for (;;) {
+            while (p < end && (*p == ' ' || *p == '\t' ||
+                               *p == '\r' || *p == '\n'))
+                p++;
+            if (p < end && *p == '#')
+                while (p < end && *p != '\n')
+                    p++;
+            else
+                break;
+        }
+        fields[i] = 0;
+        if (p == end || *p < '0' || *p > '9')
+            return NULL;
+        while (p < end && *p >= '0' && *p <= '9' && fields[i] < 1 << 16)
+            fields[i] = fields[i] * 10 + *p++ - '0';
+    }
+    /* Exactly one whitespace byte precedes the pixels */
+    if (p == end || fields[2] != 255 || !fields[0] || !fields[1])
+        return NULL;
+    p++;
+    if ((size_t) (end - p) < (size_t) fields[0] * fields[1] * 3)
+        return NULL;
+    *width = fields[0];
+    *height = fields[1];
+    return (const unsigned char *) p;
+}
+
+static void
+finish(struct stream_texture *t)
+{
+    /* Flush so the fence is visible to the render context */
+    t->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();
+    __atomic_store_n(&t->state, STREAM_UPLOADED, __ATOMIC_RELEASE);
+}
+
+static void
+fail(struct stream_texture *t, const char *why)
+{
+    fprintf(stderr, "warning: %s: %s\n", t->path, why);
+    __atomic_store_n(&t->state, STREAM_FAILED, __ATOMIC_RELEASE);
+}
+
+/* KTX levels go to the driver straight from the mapping. */
+static void
+load_ktx(struct stream_texture *t)
+{
+    struct ktx k;
+    if (ktx_open(&k, t->path)) {
+        fail(t, errno == EINVAL ? "unsupported KTX file" : strerror(errno));
+        return;
+    }
+    t->width = k.width;
+    t->height = k.height;
+    t->texture = ktx_upload(&k);
+    ktx_close(&k);
+    if (!t->texture)
+        fail(t, "compressed format unsupported by the driver");
+    else
+        finish(t);
+}
+
+static void
+load_ppm(struct streamer *streamer, struct stream_texture *t)
+{
+    struct mapfile f;
+    if (mapfile_open(&f, t->path)) {
+        fail(t, strerror(errno));
+        return;
+    }
+    const unsigned char *src = ppm_header(&f, &t->width, &t->height);
+    if (!src) {
+        mapfile_close(&f);
+        fail(t, "not a binary PPM");
+        return;
+    }
+
+    /* Expand to RGBA and build the chain here, on the worker, so the
+     * filtering stays off the render thread.
+     */
+    size_t pixels = (size_t) t->width * t->height;
+    unsigned char *rgba = malloc(pixels * 4);
+    if (!rgba) {
+        mapfile_close(&f);
+        fail(t, strerror(errno));
+        return;
+    }
+    for (size_t i = 0; i < pixels; i++) {
+        rgba[i * 4 + 0] = src[i * 3 + 0];
+        rgba[i * 4 + 1] = src[i * 3 + 1];
+        rgba[i * 4 + 2] = src[i * 3 + 2];
+        rgba[i * 4 + 3] = 0xff;
+    }
+    mapfile_close(&f);
+    struct mipmap_chain chain;
+    int r = mipmap_build(&chain, rgba, t->width, t->height,
+                         streamer->filter, 1);
+    free(rgba);
+    if (r) {
+        fail(t, "out of memory");
+        return;
+    }
+
+    /* Orphan the staging buffer and upload every level out of it */
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, streamer->pbo);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, chain.size, NULL, GL_STREAM_DRAW);
+    void *dst = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, chain.size,
+                                 GL_MAP_WRITE_BIT |
+                                 GL_MAP_INVALIDATE_BUFFER_BIT);
+    if (!dst) {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        mipmap_free(&chain);
+        fail(t, "could not map the staging buffer");
+        return;
+    }
+    memcpy(dst, chain.data, chain.size);
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+    glGenTextures(1, &t->texture);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, t->texture);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL,
+                    chain.levels - 1);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER,
+                    chain.levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    for (int i = 0; i < chain.levels; i++) {
+        glTexImage3D(GL_TEXTURE_2D_ARRAY, i, GL_RGBA8, chain.width[i],
+                     chain.height[i], 1, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                     (void *) chain.offset[i]);
+    }
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    mipmap_free(&chain);
+    finish(t);
+}
+
+static void
+load(struct streamer *streamer, struct stream_texture *t)
+{
+    const char *dot = strrchr(t->path, '.');
+    if (dot && (!strcmp(dot, ".ktx") || !strcmp(dot, ".ktx2")))
+        load_ktx(t);
+    else
+        load_ppm(streamer, t);
+}
+
+static void *
+worker(void *arg)
+{
+    struct streamer *streamer = arg;
+    glfwMakeContextCurrent(streamer->window);
+    glGenBuffers(1, &streamer->pbo);
+    pthread_mutex_lock(&streamer->lock);
+    for (;;) {
+        while (!streamer->head && !streamer->quit)
+            pthread_cond_wait(&streamer->wake, &streamer->lock);
+        struct stream_texture *t = streamer->head;
+        if (!t)
+            break;
+        streamer->head = t->next;
+        if (!streamer->head)
+            streamer->tail = NULL;
+        pthread_mutex_unlock(&streamer->lock);
+        load(streamer, t);
+        pthread_mutex_lock(&streamer->lock);
+    }
+    pthread_mutex_unlock(&streamer->lock);
+    glDeleteBuffers(1, &streamer->pbo);
+    glfwMakeContextCurrent(NULL);
+    return NULL;
+}
+
+int
+streamer_init(struct streamer *streamer, GLFWwindow *share)
+{
+    memset(streamer, 0, sizeof(*streamer));
+    glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+    streamer->window = glfwCreateWindow(1, 1, "stream", NULL, share);
+    glfwWindowHint(GLFW_VISIBLE, GL_TRUE);
+    if (!streamer->window)
+        return -1;
+    pthread_mutex_init(&streamer->lock, NULL);
+    pthread_cond_init(&streamer->wake, NULL);
+    if (pthread_create(&streamer->thread, NULL, worker, streamer)) {
+        glfwDestroyWindow(streamer->window);
+        return -1;
+    }
+    return 0;
+}
+
+void
+stream_load(struct streamer *streamer, struct stream_texture *t,
+            const char *path)
+{
+    memset(t, 0, sizeof(*t));
+    t->path = path;
+    t->state = STREAM_QUEUED;
+    pthread_mutex_lock(&streamer->lock);
+    if (streamer->tail)
+        streamer->tail->next = t;
+    else
+        streamer->head = t;
+    streamer->tail = t;
+    pthread_cond_signal(&streamer->wake);
+    pthread_mutex_unlock(&streamer->lock);
+}
+
+int
+stream_ready(struct stream_texture *t)
+{
+    switch (__atomic_load_n(&t->state, __ATOMIC_ACQUIRE)) {
+        case STREAM_READY:
+            return 1;
+        case STREAM_UPLOADED:
+            break;
+        default:
+            return 0;
+    }
+    GLenum r = glClientWaitSync(t->fence, 0, 0);
+    if (r != GL_ALREADY_SIGNALED && r != GL_CONDITION_SATISFIED)
+        return 0;
+    glDeleteSync(t->fence);
+    t->fence = 0;
+    t->state = STREAM_READY;
+    return 1;
+}
+
+void
+streamer_free(struct streamer *streamer)
+{
+    pthread_mutex_lock(&streamer->lock);
+    streamer->quit = 1;
+    pthread_cond_signal(&streamer->wake);
+    pthread_mutex_unlock(&streamer->lock);
+    pthread_join(streamer->thread, NULL);
+    pthread_cond_destroy(&streamer->wake);
+    pthread_mutex_destroy(&streamer->lock);
+    glfwDestroyWindow(streamer->window);
+}
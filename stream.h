@@ -0,0 +1,70 @@
+#ifndef STREAM_H
+#define STREAM_H
+
+#include <pthread.h>
+
+#define GLFW_INCLUDE_NONE
+#include <GL/gl3w.h>
+#include <GLFW/glfw3.h>
+
+#include "mipmap.h"
+
+enum stream_state {
+    STREAM_QUEUED,
+    STREAM_UPLOADED,  /* fence inserted, copy may still be in flight */
+    STREAM_READY,
+    STREAM_FAILED
+};
+
+/* A texture loaded in the background: a one-layer GL_TEXTURE_2D_ARRAY
+ * so it can be drawn by the sprite batcher. Nothing but the state may
+ * be touched until stream_ready() returns true.
+ */
+struct stream_texture {
+    const char *path;
+    GLuint texture;
+    int width;
+    int height;
+    GLsync fence;
+    int state;
+    struct stream_texture *next;
+};
+
+/* Loads textures on a worker thread with its own context, shared with
+ * the render context. The worker decodes each PPM, builds its mip
+ * chain with filter and copies it through a pixel unpack buffer into
+ * the texture, or uploads KTX levels from their mapping, and inserts a
+ * fence.
+ * The render thread polls that fence without waiting, so neither file
+ * I/O nor the upload ever stalls a frame.
+ */
+struct streamer {
+    GLFWwindow *window;  /* hidden, owns the worker's context */
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    struct stream_texture *head;
+    struct stream_texture *tail;
+    int quit;
+    GLuint pbo;
+    enum mipmap_filter filter;  /* for PPM; set before the first load */
+};
+
+/* Call from the main thread: GLFW only creates windows there. Returns
+ * 0, or -1 if the shared context couldn't be created.
+ */
+int streamer_init(struct streamer *, GLFWwindow *share);
+
+/* Queues a binary PPM, or a .ktx or .ktx2 file, for loading. The
+ * texture must stay put until the streamer is freed.
+ */
+void stream_load(struct streamer *, struct stream_texture *,
+                 const char *path);
+
+/* Render thread: true once the texture may be used. Never blocks. */
+int stream_ready(struct stream_texture *);
+
+/* Finishes queued loads and stops the worker. */
+void streamer_free(struct streamer *);
+
+#endif
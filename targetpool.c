@@ -0,0 +1,157 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "targetpool.h"
+
+void
+target_pool_init(struct target_pool *pool, int max_age)
+{
+    memset(pool, 0, sizeof(*pool));
+    pool->max_age = max_age;
+}
+
+static size_t
+pixel_size(GLenum format)
+{
+    switch (format) {
+        case GL_R8:
+            return 1;
+        case GL_RG8:
+        case GL_R16F:
+            return 2;
+        case GL_RGBA16F:
+        case GL_RG32F:
+            return 8;
+        case GL_RGBA32F:
+            return 16;
+        default:
+            return 4;
+    }
+}
+
+static void
+create(struct render_target *t, const struct target_desc *d)
+{
+    t->desc = *d;
+    t->bytes = (size_t) d->width * d->height * pixel_size(d->format) *
+               (d->samples ? d->samples : 1);
+    glGenFramebuffers(1, &t->fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, t->fbo);
+    if (d->samples) {
+        glGenRenderbuffers(1, &t->storage);
+        glBindRenderbuffer(GL_RENDERBUFFER, t->storage);
+        glRenderbufferStorageMultisample(GL_RENDERBUFFER, d->samples,
+                                         d->format, d->width, d->height);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                                  GL_RENDERBUFFER, t->storage);
+    } else {
+        /* The format and type only describe absent data */
+        glGenTextures(1, &t->storage);
+        glBindTexture(GL_TEXTURE_2D, t->storage);
+        glTexImage2D(GL_TEXTURE_2D, 0, d->format, d->width, d->height, 0,
+                     GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                               GL_TEXTURE_2D, t->storage, 0);
+    }
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        fprintf(stderr, "error: render target incomplete (0x%x)\n",
+                status);
+        exit(EXIT_FAILURE);
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+static void
+destroy(struct render_target *t)
+{
+    glDeleteFramebuffers(1, &t->fbo);
+    if (t->desc.samples)
+        glDeleteRenderbuffers(1, &t->storage);
+    else
+        glDeleteTextures(1, &t->storage);
+}
+
+int
+target_pool_acquire(struct target_pool *pool, const struct target_desc *d)
+{
+    int hole = -1;
+    for (int i = 0; i < pool->count; i++) {
+        struct render_target *t = pool->targets + i;
+        if (!t->fbo) {
+            hole = hole < 0 ? i : hole;
+        } else if (!t->busy && t->desc.width == d->width &&
+                   t->desc.height == d->height &&
+                   t->desc.format == d->format &&
+                   t->desc.samples == d->samples) {
+            t->busy = true;
+            pool->stats.hits++;
+            return i;
+        }
+    }
+    if (hole < 0) {
+        if (pool->count == TARGET_POOL_CAPACITY) {
+            fprintf(stderr, "error: render target pool full\n");
+            exit(EXIT_FAILURE);
+        }
+        hole = pool->count++;
+    }
+    struct render_target *t = pool->targets + hole;
+    create(t, d);
+    t->busy = true;
+    pool->stats.misses++;
+    pool->stats.targets++;
+    pool->stats.bytes += t->bytes;
+    return hole;
+}
+
+void
+target_pool_release(struct target_pool *pool, int target)
+{
+    pool->targets[target].busy = false;
+    pool->targets[target].released = pool->frame;
+}
+
+void
+target_pool_frame(struct target_pool *pool)
+{
+    /* Targets are held by index, so deleting one leaves a hole that
+     * the next new target fills.
+     */
+    for (int i = 0; i < pool->count; i++) {
+        struct render_target *t = pool->targets + i;
+        if (!t->fbo || t->busy || pool->frame - t->released < pool->max_age)
+            continue;
+        destroy(t);
+        t->fbo = 0;
+        pool->stats.evicted++;
+        pool->stats.targets--;
+        pool->stats.bytes -= t->bytes;
+    }
+    while (pool->count && !pool->targets[pool->count - 1].fbo)
+        pool->count--;
+    pool->frame++;
+}
+
+double
+target_pool_hit_rate(const struct target_pool *pool)
+{
+    unsigned long total = pool->stats.hits + pool->stats.misses;
+    return total ? (double) pool->stats.hits / total : 0;
+}
+
+void
+target_pool_free(struct target_pool *pool)
+{
+    for (int i = 0; i < pool->count; i++)
+        if (pool->targets[i].fbo)
+            destroy(pool->targets + i);
+    memset(pool, 0, sizeof(*pool));
+}
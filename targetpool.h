@@ -0,0 +1,68 @@
+#ifndef TARGETPOOL_H
+#define TARGETPOOL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <GL/gl3w.h>
+
+#define TARGET_POOL_CAPACITY 32
+
+/* Color target storage: a texture, or a renderbuffer if multisampled.
+ * The internal format must be color-renderable.
+ */
+struct target_desc {
+    int width, height;
+    GLenum format;
+    int samples;  /* 0 for a single-sampled texture */
+};
+
+struct render_target {
+    struct target_desc desc;
+    GLuint fbo;
+    GLuint storage;   /* texture or renderbuffer */
+    size_t bytes;
+    bool busy;
+    long released;    /* frame it was last released in */
+};
+
+struct target_pool_stats {
+    unsigned long hits;
+    unsigned long misses;   /* acquisitions that created a target */
+    unsigned long evicted;
+    int targets;
+    size_t bytes;           /* estimated, held by all targets */
+};
+
+/* Render targets recycled across frames, so offscreen passes don't
+ * create and delete GL objects every frame: drivers make creation
+ * expensive, and the churn shows up as hitches. A target is handed
+ * out again for the same size, format and sample count. Targets left
+ * free for max_age frames are deleted, so a target nobody
+ * asks for any more, such as after a mode change, doesn't hold memory
+ * for long.
+ */
+struct target_pool {
+    struct render_target targets[TARGET_POOL_CAPACITY];
+    int count;
+    int max_age;
+    long frame;
+    struct target_pool_stats stats;
+};
+
+void target_pool_init(struct target_pool *, int max_age);
+
+/* Returns the index of a free target matching desc, creating one if
+ * there is none. It stays busy until released.
+ */
+int target_pool_acquire(struct target_pool *, const struct target_desc *);
+void target_pool_release(struct target_pool *, int target);
+
+/* Ends a frame, deleting targets that have aged out. */
+void target_pool_frame(struct target_pool *);
+
+/* Fraction of acquisitions served without creating a target. */
+double target_pool_hit_rate(const struct target_pool *);
+
+void target_pool_free(struct target_pool *);
+
+#endif
@@ -0,0 +1,190 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "vcache.h"
+
+#define CACHE_SIZE      32
+#define DECAY_POWER     1.5f
+#define LAST_TRI_SCORE  0.75f
+#define VALENCE_SCALE   2.0f
+#define VALENCE_POWER   0.5f
+
+struct vertex {
+    int cache;           /* position in the LRU cache, or -1 */
+    uint32_t remaining;  /* triangles not yet emitted */
+    uint32_t first;      /* into the adjacency list */
+    float score;
+};
+
+static float
+vertex_score(const struct vertex *v)
+{
+    if (!v->remaining)
+        return -1.0f;
+    float score = 0.0f;
+    if (v->cache >= 0) {
+        if (v->cache < 3) {
+            /* The last triangle's vertices are deliberately penalized,
+             * or the ordering degenerates into strips.
+             */
+            score = LAST_TRI_SCORE;
+        } else {
+            float scale = 1.0f / (CACHE_SIZE - 3);
+            score = powf(1.0f - (v->cache - 3) * scale, DECAY_POWER);
+        }
+    }
+    return score + VALENCE_SCALE * powf(v->remaining, -VALENCE_POWER);
+}
+
+int
+vcache_optimize(uint32_t *indices, size_t index_count, size_t vertex_count)
+{
+    size_t tri_count = index_count / 3;
+    struct vertex *verts = calloc(vertex_count, sizeof(*verts));
+    uint32_t *adjacency = malloc(index_count * sizeof(*adjacency));
+    float *tri_score = malloc(tri_count * sizeof(*tri_score));
+    char *emitted = calloc(tri_count, 1);
+    uint32_t *out = malloc(index_count * sizeof(*out));
+    if (!verts || !adjacency || !tri_score || !emitted || !out) {
+        free(verts);
+        free(adjacency);
+        free(tri_score);
+        free(emitted);
+        free(out);
+        return -1;
+    }
+
+    /* Triangle adjacency per vertex, as one flat list */
+    for (size_t i = 0; i < index_count; i++)
+        verts[indices[i]].remaining++;
+    uint32_t offset = 0;
+    for (size_t i = 0; i < vertex_count; i++) {
+        verts[i].first = offset;
+        offset += verts[i].remaining;
+        verts[i].remaining = 0;
+        verts[i].cache = -1;
+    }
+    for (size_t i = 0; i < index_count; i++) {
+        struct vertex *v = verts + indices[i];
+        adjacency[v->first + v->remaining++] = i / 3;
+    }
+    for (size_t i = 0; i < vertex_count; i++)
+        verts[i].score = vertex_score(verts + i);
+    for (size_t t = 0; t < tri_count; t++)
+        tri_score[t] = verts[indices[t * 3 + 0]].score +
+                       verts[indices[t * 3 + 1]].score +
+                       verts[indices[t * 3 + 2]].score;
+
+    uint32_t cache[CACHE_SIZE + 3];
+    unsigned cache_len = 0;
+    long best = -1;
+    size_t scan = 0;  /* triangles before this one are all emitted */
+    for (size_t n = 0; n < tri_count; n++) {
+        if (best < 0) {
+            /* Nothing in the cache: fall back to a full search */
+            float best_score = -1.0f;
+            while (emitted[scan])
+                scan++;
+            for (size_t t = scan; t < tri_count; t++) {
+                if (!emitted[t] && tri_score[t] > best_score) {
+                    best_score = tri_score[t];
+                    best = t;
+                }
+            }
+        }
+        const uint32_t *tri = indices + best * 3;
+        memcpy(out + n * 3, tri, 3 * sizeof(*tri));
+        emitted[best] = 1;
+
+        /* Retire the triangle from its vertices' adjacency */
+        for (int k = 0; k < 3; k++) {
+            struct vertex *v = verts + tri[k];
+            uint32_t *list = adjacency + v->first;
+            for (uint32_t j = 0; j < v->remaining; j++) {
+                if (list[j] == (uint32_t) best) {
+                    list[j] = list[--v->remaining];
+                    break;
+                }
+            }
+        }
+
+        /* Move the triangle's vertices to the front of the LRU cache */
+        uint32_t next[CACHE_SIZE + 3];
+        unsigned next_len = 0;
+        for (int k = 0; k < 3; k++)
+            next[next_len++] = tri[k];
+        for (unsigned j = 0; j < cache_len; j++)
+            if (cache[j] != tri[0] && cache[j] != tri[1] && cache[j] != tri[2])
+                next[next_len++] = cache[j];
+        for (unsigned j = 0; j < next_len; j++) {
+            struct vertex *v = verts + next[j];
+            v->cache = j < CACHE_SIZE ? (int) j : -1;
+            v->score = vertex_score(v);
+        }
+
+        /* Rescore triangles around touched vertices and pick the best */
+        best = -1;
+        float best_score = -1.0f;
+        for (unsigned j = 0; j < next_len; j++) {
+            const struct vertex *v = verts + next[j];
+            for (uint32_t a = 0; a < v->remaining; a++) {
+                uint32_t t = adjacency[v->first + a];
+                float s = verts[indices[t * 3 + 0]].score +
+                          verts[indices[t * 3 + 1]].score +
+                          verts[indices[t * 3 + 2]].score;
+                tri_score[t] = s;
+                if (s > best_score) {
+                    best_score = s;
+                    best = t;
+                }
+            }
+        }
+        cache_len = next_len < CACHE_SIZE ? next_len : CACHE_SIZE;
+        memcpy(cache, next, cache_len * sizeof(*cache));
+    }
+
+    memcpy(indices, out, tri_count * 3 * sizeof(*out));
+    free(verts);
+    free(adjacency);
+    free(tri_score);
+    free(emitted);
+    free(out);
+    return 0;
+}
+
+size_t
+vcache_fetch_remap(uint32_t *remap, uint32_t *indices, size_t index_count,
+                   size_t vertex_count)
+{
+    memset(remap, 0xff, vertex_count * sizeof(*remap));
+    uint32_t next = 0;
+    for (size_t i = 0; i < index_count; i++) {
+        if (remap[indices[i]] == UINT32_MAX)
+            remap[indices[i]] = next++;
+        indices[i] = remap[indices[i]];
+    }
+    return next;
+}
+
+double
+vcache_acmr(const uint32_t *indices, size_t index_count, size_t vertex_count,
+            unsigned cache_size)
+{
+    /* A vertex is cached if fewer than cache_size misses happened
+     * since it was loaded, which is exactly a FIFO.
+     */
+    size_t *loaded = calloc(vertex_count, sizeof(*loaded));
+    if (!loaded || index_count < 3) {
+        free(loaded);
+        return 0.0;
+    }
+    size_t misses = 0;
+    for (size_t i = 0; i < index_count; i++) {
+        size_t *v = loaded + indices[i];
+        if (!*v || misses - *v >= cache_size)
+            *v = ++misses;
+    }
+    free(loaded);
+    return (double) misses / (index_count / 3);
+}
@@ -0,0 +1,32 @@
+#ifndef VCACHE_H
+#define VCACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Post-transform vertex cache optimization for indexed triangle lists.
+ * These run offline in meshconv but are cheap enough to run on meshes
+ * built at load time.
+ */
+
+/* Reorders triangles with Forsyth's linear-speed algorithm so that
+ * consecutive triangles share recently transformed vertices. Returns
+ * 0, or -1 when out of memory with indices untouched.
+ */
+int vcache_optimize(uint32_t *indices, size_t index_count, size_t vertex_count);
+
+/* Renumbers vertices in order of first use so vertex fetch walks
+ * memory forward. Writes remap[old] = new, or UINT32_MAX for unused
+ * vertices, and returns the number of vertices used.
+ */
+size_t vcache_fetch_remap(uint32_t *remap, uint32_t *indices,
+                          size_t index_count, size_t vertex_count);
+
+/* Average cache miss ratio: vertices transformed per triangle with a
+ * FIFO cache of cache_size entries. 0.5 is the ideal for large grids,
+ * 3.0 means no reuse at all.
+ */
+double vcache_acmr(const uint32_t *indices, size_t index_count,
+                   size_t vertex_count, unsigned cache_size);
+
+#endif
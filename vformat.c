@@ -0,0 +1,243 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "vformat.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+unsigned
+vformat_size(enum vformat format, unsigned components)
+{
+    switch (format) {
+        case VFORMAT_FLOAT:   return components * 4;
+        case VFORMAT_HALF:    return (components * 2 + 3) & ~3u;
+        case VFORMAT_SNORM16: return (components * 2 + 3) & ~3u;
+        case VFORMAT_SNORM10: return 4;
+        case VFORMAT_UNORM10: return 4;
+    }
+    abort();
+}
+
+void
+vformat_attrib(enum vformat format, unsigned components, struct mesh_attrib *a)
+{
+    a->size = components;
+    a->normalized = GL_FALSE;
+    switch (format) {
+        case VFORMAT_FLOAT:
+            a->type = GL_FLOAT;
+            break;
+        case VFORMAT_HALF:
+            a->type = GL_HALF_FLOAT;
+            break;
+        case VFORMAT_SNORM16:
+            a->type = GL_SHORT;
+            a->normalized = GL_TRUE;
+            break;
+        case VFORMAT_SNORM10:
+            a->type = GL_INT_2_10_10_10_REV;
+            a->size = 4;
+            a->normalized = GL_TRUE;
+            break;
+        case VFORMAT_UNORM10:
+            a->type = GL_UNSIGNED_INT_2_10_10_10_REV;
+            a->size = 4;
+            a->normalized = GL_TRUE;
+            break;
+    }
+}
+
+/* Round-to-nearest-even float to half conversion: values past the half
+ * range become infinity, NaNs stay quiet NaNs, and tiny values become
+ * correctly rounded subnormals.
+ */
+static uint16_t
+half(float f)
+{
+    uint32_t x;
+    memcpy(&x, &f, sizeof(x));
+    uint32_t sign = x & 0x80000000u;
+    x ^= sign;
+    uint32_t h;
+    if (x >= 0x47800000u) {
+        h = x > 0x7f800000u ? 0x7e00 : 0x7c00;
+    } else if (x < 0x38800000u) {
+        /* Adding 0.5 aligns the subnormal mantissa and rounds it */
+        float a;
+        memcpy(&a, &x, sizeof(a));
+        a += 0.5f;
+        memcpy(&h, &a, sizeof(h));
+        h -= 0x3f000000u;
+    } else {
+        uint32_t odd = (x >> 13) & 1;
+        x += 0xfffu - 0x38000000u + odd;
+        h = x >> 13;
+    }
+    return h | sign >> 16;
+}
+
+#if defined(__SSE2__) && !defined(__F16C__)
+/* The scalar algorithm above, four lanes at a time. Returns the halves
+ * sign extended to 32 bits, ready for a saturating pack.
+ */
+static __m128i
+half4(__m128 f)
+{
+    __m128 sign = _mm_and_ps(f, _mm_castsi128_ps(_mm_set1_epi32(0x80000000)));
+    __m128 absf = _mm_xor_ps(f, sign);
+    __m128i x = _mm_castps_si128(absf);
+    __m128i regular = _mm_cmpgt_epi32(_mm_set1_epi32(0x47800000), x);
+    __m128i nan = _mm_castps_si128(_mm_cmpunord_ps(absf, absf));
+    __m128i special = _mm_or_si128(_mm_and_si128(nan, _mm_set1_epi32(0x200)),
+                                   _mm_set1_epi32(0x7c00));
+    __m128i tiny = _mm_cmpgt_epi32(_mm_set1_epi32(0x38800000), x);
+    __m128i subnormal =
+        _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(absf, _mm_set1_ps(0.5f))),
+                      _mm_set1_epi32(0x3f000000));
+    __m128i odd = _mm_srai_epi32(_mm_slli_epi32(x, 18), 31);
+    __m128i normal = _mm_add_epi32(x, _mm_set1_epi32(0xfff - 0x38000000));
+    normal = _mm_srli_epi32(_mm_sub_epi32(normal, odd), 13);
+    __m128i h = _mm_or_si128(_mm_and_si128(tiny, subnormal),
+                             _mm_andnot_si128(tiny, normal));
+    h = _mm_or_si128(_mm_and_si128(regular, h),
+                     _mm_andnot_si128(regular, special));
+    return _mm_or_si128(h, _mm_srai_epi32(_mm_castps_si128(sign), 16));
+}
+#endif
+
+void
+vformat_half(uint16_t *dst, const float *src, size_t n)
+{
+    size_t i = 0;
+#if defined(__F16C__)
+    for (; i + 4 <= n; i += 4) {
+        __m128i h = _mm_cvtps_ph(_mm_loadu_ps(src + i), 0);
+        _mm_storel_epi64((__m128i *) (dst + i), h);
+    }
+#elif defined(__SSE2__)
+    for (; i + 8 <= n; i += 8) {
+        __m128i lo = half4(_mm_loadu_ps(src + i));
+        __m128i hi = half4(_mm_loadu_ps(src + i + 4));
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_packs_epi32(lo, hi));
+    }
+#endif
+    for (; i < n; i++)
+        dst[i] = half(src[i]);
+}
+
+/* Clamps to [lo, 1], scales, and rounds to the nearest integer, ties
+ * to even in both paths.
+ */
+static void
+quantize(int32_t *dst, const float *src, size_t n, float lo, float scale)
+{
+    size_t i = 0;
+#if defined(__SSE2__)
+    __m128 vlo = _mm_set1_ps(lo);
+    __m128 vhi = _mm_set1_ps(1.0f);
+    __m128 vscale = _mm_set1_ps(scale);
+    for (; i + 4 <= n; i += 4) {
+        __m128 f = _mm_loadu_ps(src + i);
+        f = _mm_mul_ps(_mm_min_ps(_mm_max_ps(f, vlo), vhi), vscale);
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_cvtps_epi32(f));
+    }
+#endif
+    for (; i < n; i++) {
+        float f = src[i] < lo ? lo : src[i] > 1.0f ? 1.0f : src[i];
+        dst[i] = lrintf(f * scale);
+    }
+}
+
+#define CHUNK 1024
+
+void
+vformat_snorm16(int16_t *dst, const float *src, size_t n)
+{
+    int32_t q[CHUNK];
+    for (size_t i = 0; i < n; i += CHUNK) {
+        size_t len = n - i < CHUNK ? n - i : CHUNK;
+        quantize(q, src + i, len, -1.0f, 32767.0f);
+        size_t j = 0;
+#if defined(__SSE2__)
+        for (; j + 8 <= len; j += 8) {
+            __m128i lo = _mm_loadu_si128((__m128i *) (q + j));
+            __m128i hi = _mm_loadu_si128((__m128i *) (q + j + 4));
+            _mm_storeu_si128((__m128i *) (dst + i + j),
+                             _mm_packs_epi32(lo, hi));
+        }
+#endif
+        for (; j < len; j++)
+            dst[i + j] = q[j];
+    }
+}
+
+static void
+pack10(uint32_t *dst, const float *src, size_t n, float lo, float scale)
+{
+    int32_t q[CHUNK * 3];
+    for (size_t i = 0; i < n; i += CHUNK) {
+        size_t len = n - i < CHUNK ? n - i : CHUNK;
+        quantize(q, src + i * 3, len * 3, lo, scale);
+        for (size_t j = 0; j < len; j++)
+            dst[i + j] = (q[j * 3 + 0] & 0x3ffu) |
+                         (q[j * 3 + 1] & 0x3ffu) << 10 |
+                         (q[j * 3 + 2] & 0x3ffu) << 20;
+    }
+}
+
+void
+vformat_snorm10(uint32_t *dst, const float *src, size_t n)
+{
+    pack10(dst, src, n, -1.0f, 511.0f);
+}
+
+void
+vformat_unorm10(uint32_t *dst, const float *src, size_t n)
+{
+    pack10(dst, src, n, 0.0f, 1023.0f);
+}
+
+/* Encodes a contiguous run, then scatters it into the interleaved
+ * destination.
+ */
+void
+vformat_encode(enum vformat format, unsigned components, void *dst,
+               size_t stride, const float *src, size_t count)
+{
+    unsigned size = vformat_size(format, components);
+    unsigned bytes = format == VFORMAT_FLOAT ? components * 4 :
+                     format == VFORMAT_HALF || format == VFORMAT_SNORM16 ?
+                     components * 2 : 4;
+    unsigned char buf[CHUNK * 16];
+    size_t per = sizeof(buf) / size;
+    for (size_t i = 0; i < count; i += per) {
+        size_t len = count - i < per ? count - i : per;
+        const float *s = src + i * components;
+        switch (format) {
+            case VFORMAT_FLOAT:
+                memcpy(buf, s, len * bytes);
+                break;
+            case VFORMAT_HALF:
+                vformat_half((uint16_t *) buf, s, len * components);
+                break;
+            case VFORMAT_SNORM16:
+                vformat_snorm16((int16_t *) buf, s, len * components);
+                break;
+            case VFORMAT_SNORM10:
+                vformat_snorm10((uint32_t *) buf, s, len);
+                break;
+            case VFORMAT_UNORM10:
+                vformat_unorm10((uint32_t *) buf, s, len);
+                break;
+        }
+        unsigned char *d = (unsigned char *) dst + i * stride;
+        for (size_t j = 0; j < len; j++)
+            memcpy(d + j * stride, buf + j * bytes, bytes);
+    }
+}
@@ -0,0 +1,50 @@
+#ifndef VFORMAT_H
+#define VFORMAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <GL/gl3w.h>
+
+#include "mesh.h"
+
+/* Compact vertex attribute encodings. Each takes float input and
+ * writes one packed element per vertex:
+ *
+ *   VFORMAT_FLOAT      32-bit floats, unchanged
+ *   VFORMAT_HALF       16-bit floats, round to nearest even
+ *   VFORMAT_SNORM16    normalized shorts, input clamped to [-1, 1]
+ *   VFORMAT_SNORM10    GL_INT_2_10_10_10_REV xyz, input in [-1, 1]
+ *   VFORMAT_UNORM10    GL_UNSIGNED_INT_2_10_10_10_REV xyz, in [0, 1]
+ *
+ * The 10-bit formats always hold three components and a zero w.
+ */
+enum vformat {
+    VFORMAT_FLOAT,
+    VFORMAT_HALF,
+    VFORMAT_SNORM16,
+    VFORMAT_SNORM10,
+    VFORMAT_UNORM10,
+};
+
+/* Bytes per vertex of an attribute, padded to 4-byte alignment. */
+unsigned vformat_size(enum vformat, unsigned components);
+
+/* Fills in type, size and normalized for the VAO setup. */
+void vformat_attrib(enum vformat, unsigned components, struct mesh_attrib *);
+
+/* Encodes count vertices of components floats each from src into dst,
+ * stepping dst by stride bytes per vertex.
+ */
+void vformat_encode(enum vformat, unsigned components, void *dst,
+                    size_t stride, const float *src, size_t count);
+
+/* Bulk encoders over contiguous arrays, vectorized with SSE2 (and F16C
+ * for halves) where available. n counts floats, or vectors for the
+ * 10-bit formats.
+ */
+void vformat_half(uint16_t *dst, const float *src, size_t n);
+void vformat_snorm16(int16_t *dst, const float *src, size_t n);
+void vformat_snorm10(uint32_t *dst, const float *src, size_t n);
+void vformat_unorm10(uint32_t *dst, const float *src, size_t n);
+
+#endif